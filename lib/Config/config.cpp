@@ -4,7 +4,9 @@
 const DeviceConfig DEVICE_CONFIGS[] = {
     // Building device configuration
     {
-        .token = "OrMees1ToDgts03u5TsV",
+        .token = BUILDING_ACCESS_TOKEN,
+        .provisionKey = BUILDING_PROVISION_KEY,
+        .provisionSecret = BUILDING_PROVISION_SECRET,
         .deviceType = DEVICE_TYPE_BUILDING,
         .deviceName = "Building_Control_System",
 
@@ -40,7 +42,7 @@ const DeviceConfig DEVICE_CONFIGS[] = {
 
     // Carpark device configuration
     {
-        .token = "WsyJtTftCGVWuGCnQ0OQ", .deviceType = DEVICE_TYPE_CARPARK, .deviceName = "Carpark_Management_System",
+        .token = CARPARK_ACCESS_TOKEN, .provisionKey = CARPARK_PROVISION_KEY, .provisionSecret = CARPARK_PROVISION_SECRET, .deviceType = DEVICE_TYPE_CARPARK, .deviceName = "Carpark_Management_System",
 
         // Pin configuration
         .pins = {
@@ -100,7 +102,6 @@ void initConfigFromDeviceId(const char *deviceId)
         currentConfig = &DEVICE_CONFIGS[deviceMode];
         Serial.printf("Initialized device: %s (Type: %s) with ID: %s\n",
                       currentConfig->deviceName, currentConfig->deviceType, deviceId);
-        Serial.printf("Token: %s\n", currentConfig->token);
     }
     else
     {
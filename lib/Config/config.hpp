@@ -21,7 +21,11 @@ typedef struct {
 
 // Cấu trúc cấu hình thiết bị
 typedef struct {
+    // Access token cố định, chỉ dùng khi profile không có provisioning key
     const char* token;
+    // Khóa và secret của device profile trên ThingsBoard, access token được cấp khi provisioning. nullptr = không provisioning
+    const char* provisionKey;
+    const char* provisionSecret;
     const char* deviceType;
     const char* deviceName;
     
@@ -48,6 +52,33 @@ typedef struct {
 
 #define DEVICE_TYPE_BUILDING "building"
 #define DEVICE_TYPE_CARPARK "carpark"
+
+// Thông tin provisioning của từng device profile, truyền bằng build flag -D BUILDING_PROVISION_KEY=\"...\" (xem platformio.ini).
+// Khi không có key, thiết bị kết nối bằng access token cố định *_ACCESS_TOKEN như trước
+#ifdef BUILDING_PROVISION_KEY
+#ifndef BUILDING_PROVISION_SECRET
+#error "BUILDING_PROVISION_KEY cần đi kèm BUILDING_PROVISION_SECRET"
+#endif
+#else
+#undef BUILDING_PROVISION_SECRET
+#define BUILDING_PROVISION_KEY nullptr
+#define BUILDING_PROVISION_SECRET nullptr
+#endif
+#ifdef CARPARK_PROVISION_KEY
+#ifndef CARPARK_PROVISION_SECRET
+#error "CARPARK_PROVISION_KEY cần đi kèm CARPARK_PROVISION_SECRET"
+#endif
+#else
+#undef CARPARK_PROVISION_SECRET
+#define CARPARK_PROVISION_KEY nullptr
+#define CARPARK_PROVISION_SECRET nullptr
+#endif
+#ifndef BUILDING_ACCESS_TOKEN
+#define BUILDING_ACCESS_TOKEN "OrMees1ToDgts03u5TsV"
+#endif
+#ifndef CARPARK_ACCESS_TOKEN
+#define CARPARK_ACCESS_TOKEN "WsyJtTftCGVWuGCnQ0OQ"
+#endif
 // #define CURRENT_DEVICE_MODE 1  // Deprecated - now using NVS device ID
 
 extern const DeviceConfig DEVICE_CONFIGS[];
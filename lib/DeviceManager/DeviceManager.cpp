@@ -1,4 +1,5 @@
 #include "DeviceManager.hpp"
+#include <config.hpp>
 
 // Global instance
 DeviceManager deviceManager;
@@ -6,6 +7,8 @@ DeviceManager deviceManager;
 DeviceManager::DeviceManager() {
     server = nullptr;
     provisioningMode = false;
+    accessToken[0] = '\0';
+    accessTokenLoaded = false;
 }
 
 DeviceManager::~DeviceManager() {
@@ -52,9 +55,56 @@ void DeviceManager::factoryReset() {
     prefs.begin("device", false);
     prefs.clear();
     prefs.end();
+    accessToken[0] = '\0';
+    accessTokenLoaded = true;
     Serial.println("Factory reset completed. Device will restart in provisioning mode.");
 }
 
+const char* DeviceManager::getAccessToken() {
+    // Chỉ đọc NVS lần đầu, các lần sau dùng bản sao trong RAM
+    if (!accessTokenLoaded) {
+        prefs.begin("device", true);
+        size_t length = prefs.getString("access_token", accessToken, sizeof(accessToken));
+        prefs.end();
+        if (length == 0) {
+            accessToken[0] = '\0';
+        }
+        accessTokenLoaded = true;
+    }
+    if (accessToken[0] != '\0') {
+        return accessToken;
+    }
+    // Profile không có provisioning key: dùng access token cố định trong cấu hình
+    const DeviceConfig* config = getCurrentConfig();
+    return config != nullptr && config->provisionKey == nullptr ? config->token : nullptr;
+}
+
+bool DeviceManager::saveAccessToken(const char* token) {
+    if (token == nullptr || token[0] == '\0' || strlen(token) >= sizeof(accessToken)) {
+        return false;
+    }
+
+    prefs.begin("device", false);
+    bool saved = prefs.putString("access_token", token) == strlen(token);
+    prefs.end();
+
+    strcpy(accessToken, token);
+    accessTokenLoaded = true;
+    if (!saved) {
+        Serial.println("Không lưu được access token vào NVS, thiết bị sẽ provisioning lại sau khi khởi động lại");
+    }
+    return saved;
+}
+
+void DeviceManager::clearAccessToken() {
+    prefs.begin("device", false);
+    prefs.remove("access_token");
+    prefs.end();
+    accessToken[0] = '\0';
+    accessTokenLoaded = true;
+    Serial.println("Access token đã bị xóa, thiết bị sẽ provisioning lại");
+}
+
 String DeviceManager::generateDefaultDeviceId() {
     String mac = WiFi.macAddress();
     mac.replace(":", "");
@@ -10,6 +10,9 @@
 extern "C" {
 #endif
 
+// Độ dài tối đa của access token ThingsBoard (kể cả ký tự kết thúc)
+#define DEVICE_ACCESS_TOKEN_SIZE 33
+
 // Device profile structure
 struct DeviceProfile {
     char deviceId[16];        // "BLD001", "CPK001"
@@ -22,6 +25,8 @@ private:
     Preferences prefs;
     WebServer* server;
     bool provisioningMode;
+    char accessToken[DEVICE_ACCESS_TOKEN_SIZE]; // Bản sao của access token trong NVS, rỗng nếu chưa được cấp
+    bool accessTokenLoaded;
     
 public:
     DeviceManager();
@@ -33,6 +38,11 @@ public:
     void saveDeviceProfile(const DeviceProfile& profile);
     void factoryReset();
     
+    // Credentials được ThingsBoard cấp khi provisioning, lưu trong NVS để các lần khởi động sau kết nối ngay
+    const char* getAccessToken();           // Token cố định nếu profile không provisioning, nullptr nếu chưa được cấp token
+    bool saveAccessToken(const char* token);
+    void clearAccessToken();
+    
     // Provisioning functions
     void startProvisioningMode();
     void stopProvisioningMode();
@@ -1,9 +1,25 @@
+#ifdef ARDUINO
+
 #include <mqtt.hpp>
 #include <wifi.hpp> // Thêm dòng này để định nghĩa WIFI_SSID và WIFI_PASSWORD
+#include <BootValidator.h>
+#include <Arduino_MQTT_Client.h>
 
 // Variable definitions for extern declarations in mqtt.hpp
 WiFiClient wifiClient;
+#if MQTT_USE_TLS
+const char* mqttRootCA = nullptr;
+TlsClient mqttTlsClient(wifiClient);
+static TlsSessionCache mqttSessionCache;
+PubSubClient mqttClient(mqttTlsClient);
+static Client& mqttTransport = mqttTlsClient;
+#else
 PubSubClient mqttClient(wifiClient);
+static Client& mqttTransport = wifiClient;
+#endif
+MqttSession mqttSession(mqttClient);
+MqttHealth mqttHealth(mqttClient);
+static MqttReceiver mqttReceiver(mqttClient, mqttTransport, wifiClient, mqttSession.getMutex());
 
 // for scheduler task
 QueueHandle_t ledStateQueue; // Hàng đợi lưu trạng thái LED
@@ -63,49 +79,118 @@ void ledControlTask(void *pvParameters) {
     }
 }
 
-// Callback xử lý tin nhắn MQTT
-void mqttCallback(char* topic, byte* payload, unsigned int length) {
-    Serial.print("Tin nhắn đến từ topic: ");
-    Serial.println(topic);
-    Serial.print("Nội dung: ");
-    for (unsigned int i = 0; i < length; i++) {
-        Serial.print((char)payload[i]);
+// Cập nhật ledState từ shared attributes, chỉ được gọi khi message có ledState
+static void applySharedAttributes(JsonObject attributes) {
+    String ledStateStr = attributes[ledStateControlKey].as<String>();
+    Serial.print("Giá trị ledState: ");
+    Serial.println(ledStateStr);
+
+    bool newLedState = (ledStateStr == "ON");
+    if (xQueueSend(ledStateQueue, &newLedState, 0) != pdTRUE) {
+        Serial.println("Gửi trạng thái LED vào hàng đợi thất bại!");
+    } else {
+        Serial.print("Đã gửi ledState đến task điều khiển LED: ");
+        Serial.println(newLedState ? "ON" : "OFF");
     }
-    Serial.println();
-
-    if (strstr(topic, "v1/devices/me/attributes")) {
-        Serial.println("Xử lý thuộc tính chia sẻ...");
-        DynamicJsonDocument doc(1024);
-        DeserializationError error = deserializeJson(doc, payload, length);
-        if (error) {
-            Serial.printf("Lỗi parse JSON: %s\n", error.c_str());
-            return;
-        }
+}
 
-        if (doc.containsKey("ledState")) {
-            String ledStateStr = doc["ledState"].as<String>();
-            Serial.print("Giá trị ledState: ");
-            Serial.println(ledStateStr);
+static bool parseAttributes(const MqttMessage& message, DynamicJsonDocument& doc) {
+    DeserializationError error = deserializeJson(doc, message.payload, message.length);
+    if (error) {
+        Serial.printf("Lỗi parse JSON: %s\n", error.c_str());
+        return false;
+    }
+    return true;
+}
 
-            bool newLedState = (ledStateStr == "ON");
-            if (xQueueSend(ledStateQueue, &newLedState, 0) != pdTRUE) {
-                Serial.println("Gửi trạng thái LED vào hàng đợi thất bại!");
-            } else {
-                Serial.print("Đã gửi ledState đến task điều khiển LED: ");
-                Serial.println(newLedState ? "ON" : "OFF");
-            }
-        } else {
-            Serial.println("Không tìm thấy thuộc tính ledState!");
-        }
+// Handler cho v1/devices/me/attributes, topic dùng chung với OTA nên bỏ qua im lặng các message không có ledState
+void onSharedAttributes(const MqttMessage& message) {
+    DynamicJsonDocument doc(1024);
+    if (parseAttributes(message, doc) && doc.containsKey(ledStateControlKey)) {
+        applySharedAttributes(doc.as<JsonObject>());
     }
 }
 
+// Handler cho v1/devices/me/attributes/response/+
+void onAttributeResponse(const MqttMessage& message) {
+    DynamicJsonDocument doc(1024);
+    // Phản hồi của attributes request bọc giá trị trong {"shared":{...}}, có thể chứa cả key của module khác
+    if (parseAttributes(message, doc) && doc["shared"].containsKey(ledStateControlKey)) {
+        applySharedAttributes(doc["shared"].as<JsonObject>());
+    }
+}
+
+// Chạy sau mỗi lần kết nối, khi các subscription đã được khôi phục
+static void onSessionConnected() {
+    const DeviceConfig* config = getCurrentConfig();
+
+    // Gửi thông tin thiết bị
+    String macAddress = WiFi.macAddress();
+    String deviceType = String(config->deviceType);
+    String deviceName = String(config->deviceName);
+    String attributePayload = "{\"macAddress\":\"" + macAddress + "\",\"deviceType\":\"" + deviceType + "\",\"deviceName\":\"" + deviceName + "\"}";
+    mqttSession.publish("v1/devices/me/attributes", attributePayload.c_str());
+}
+
+// Xin access token bằng provisioning key/secret của loại thiết bị, chỉ chạy khi NVS chưa có token
+static bool obtainAccessToken(const DeviceConfig* config) {
+    DeviceProfile profile = deviceManager.getDeviceProfile();
+    char token[DEVICE_ACCESS_TOKEN_SIZE];
+
+    // Client riêng trên cùng transport, phiên chính chưa kết nối nên không dùng chung socket cùng lúc
+    Arduino_MQTT_Client provisionClient(mqttTransport);
+    MqttProvisioner provisioner(provisionClient);
+    unsigned long started = millis();
+    MqttProvisionResult result = provisioner.provision(THINGSBOARD_SERVER, THINGSBOARD_PORT, profile.deviceId,
+                                                       config->provisionKey, config->provisionSecret,
+                                                       token, sizeof(token));
+    if (result != MQTT_PROVISION_OK) {
+        Serial.printf("Provisioning %s thất bại (%d)\n", profile.deviceId, (int)result);
+        return false;
+    }
+
+    deviceManager.saveAccessToken(token);
+    Serial.printf("Provisioning %s thành công sau %lu ms\n", profile.deviceId, millis() - started);
+    return true;
+}
+
+// Thời gian tối đa task MQTT được ngủ khi không có dữ liệu đến (ms)
+#define MQTT_MAX_IDLE_WAIT 5000
+
+// Thời điểm task cần thức dậy: keepalive, gửi telemetry hoặc MQTT_MAX_IDLE_WAIT
+static uint32_t nextWakeupMs(const DeviceConfig* config) {
+    uint32_t waitMs = min((uint32_t)MQTT_MAX_IDLE_WAIT, mqttHealth.msUntilNextAction());
+    if (config->enableTempHumidity) {
+        uint32_t elapsed = millis() - previousDataSend;
+        uint32_t remaining = elapsed > config->envSensorInterval ? 0 : config->envSensorInterval - elapsed + 1;
+        waitMs = min(waitMs, remaining);
+    }
+    return waitMs;
+}
+
 // Task kết nối và gửi dữ liệu lên ThingsBoard
 void TaskThingsBoard(void *pvParameters) {
     const DeviceConfig* config = getCurrentConfig();
 
     mqttClient.setServer(THINGSBOARD_SERVER, THINGSBOARD_PORT);
-    mqttClient.setCallback(mqttCallback);
+
+    // Đăng ký topic để nhận shared attributes, được subscribe lại sau mỗi lần kết nối
+    mqttSession.subscribe("v1/devices/me/attributes", onSharedAttributes);
+    mqttSession.subscribe("v1/devices/me/attributes/response/+", onAttributeResponse);
+    mqttSession.onConnect(onSessionConnected);
+    // Giá trị ban đầu của ledState, nằm chung attributes request với các module khác sau mỗi lần kết nối
+    mqttSession.requestAttributesOnConnect(ledStateControlKey);
+
+#if MQTT_USE_TLS
+    // Session được lưu trong RTC/NVS nên các lần kết nối lại chỉ cần handshake rút gọn
+    if (mqttRootCA != nullptr) {
+        mqttTlsClient.setCACert(mqttRootCA);
+    } else {
+        Serial.println("Cảnh báo: chưa cấu hình Root CA, TLS không xác thực server!");
+        mqttTlsClient.setInsecure();
+    }
+    mqttTlsClient.setSessionCache(&mqttSessionCache);
+#endif
 
     while (1) {
         if (!reconnect()) {
@@ -113,29 +198,35 @@ void TaskThingsBoard(void *pvParameters) {
             continue;
         }
 
-        if (!mqttClient.connected()) {
+        mqttSession.lock();
+        mqttHealth.poll();
+        mqttSession.unlock();
+
+        if (!mqttSession.connected()) {
+            // Token được cấp ở lần khởi động đầu tiên và dùng lại từ NVS ở các lần sau
+            if (deviceManager.getAccessToken() == nullptr && !obtainAccessToken(config)) {
+                vTaskDelay(pdMS_TO_TICKS(5000)); // Thử lại sau 5 giây
+                continue;
+            }
             Serial.printf("Đang kết nối ThingsBoard %s...\n", config->deviceType);
-            if (!mqttClient.connect("ESP32Client", config->token, nullptr)) {
-                Serial.printf("Kết nối %s thất bại, rc=%d\n", config->deviceType, mqttClient.state());
+            if (!mqttSession.connect("ESP32Client", deviceManager.getAccessToken(), nullptr)) {
+                int state = mqttClient.state();
+                Serial.printf("Kết nối %s thất bại, rc=%d\n", config->deviceType, state);
+                // Token bị thu hồi hoặc thiết bị bị xóa trên server: xin token mới ở lần thử sau
+                if (config->provisionKey != nullptr &&
+                    (state == MQTT_CONNECT_BAD_CREDENTIALS || state == MQTT_CONNECT_UNAUTHORIZED)) {
+                    deviceManager.clearAccessToken();
+                }
                 vTaskDelay(pdMS_TO_TICKS(5000)); // Thử lại sau 5 giây
                 continue;
             }
             Serial.printf("Kết nối ThingsBoard %s thành công!\n", config->deviceType);
-
-            // Gửi thông tin thiết bị
-            String macAddress = WiFi.macAddress();
-            String deviceType = String(config->deviceType);
-            String deviceName = String(config->deviceName);
-            String attributePayload = "{\"macAddress\":\"" + macAddress + "\",\"deviceType\":\"" + deviceType + "\",\"deviceName\":\"" + deviceName + "\"}";
-            mqttClient.publish("v1/devices/me/attributes", attributePayload.c_str());
-
-            // Đăng ký topic để nhận shared attributes
-            mqttClient.subscribe("v1/devices/me/attributes");
-
-            // Yêu cầu giá trị ban đầu của ledState
-            String payload = "{\"shared\":[\"" + String(ledStateControlKey) + "\"]}";
-            mqttClient.publish("v1/devices/me/attributes", payload.c_str());
-            Serial.println("Yêu cầu giá trị ledState từ ThingsBoard");
+#if MQTT_USE_TLS
+            const TlsHandshakeStats& tls = mqttTlsClient.getStats();
+            Serial.printf("TLS handshake: %lu ms, gửi %lu B, nhận %lu B, %s\n",
+                          (unsigned long)tls.handshakeMs, (unsigned long)tls.bytesSent,
+                          (unsigned long)tls.bytesReceived, tls.resumed ? "resumed" : "full");
+#endif
         }
 
         // Gửi dữ liệu môi trường nếu được bật
@@ -152,13 +243,21 @@ void TaskThingsBoard(void *pvParameters) {
             if (!isnan(temp) && !isnan(hum)) {
                 Serial.printf("Gửi dữ liệu môi trường lên ThingsBoard %s...\n", config->deviceType);
                 String telemetryPayload = "{\"temperature\":" + String(temp) + ",\"humidity\":" + String(hum) + "}";
-                mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+                if (mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str())) {
+                    bootValidator.report(BOOT_PROBE_TELEMETRY);
+                }
             } else {
                 Serial.println("Không có dữ liệu môi trường hợp lệ để gửi!");
             }
         }
 
-        mqttClient.loop(); // Xử lý MQTT
-        vTaskDelay(pdMS_TO_TICKS(1000)); // Kiểm tra mỗi giây
+        mqttSession.lock();
+        mqttHealth.publishMetrics();
+        mqttSession.unlock();
+
+        // Xử lý MQTT: ngủ đến khi socket có dữ liệu và xử lý ngay các gói vừa đến
+        mqttReceiver.service(nextWakeupMs(config));
     }
-}
\ No newline at end of file
+}
+
+#endif // ARDUINO
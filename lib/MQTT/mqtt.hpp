@@ -8,15 +8,38 @@
 #include <config.hpp>
 #include <ThingsBoard.h>
 #include <control.hpp>
+#include <TlsClient.hpp>
+#include <mqtt_health.hpp>
+#include <mqtt_receiver.hpp>
+#include <mqtt_session.hpp>
+#include <mqtt_provision.hpp>
+#include <DeviceManager.hpp>
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Bật TLS cho MQTT bằng build flag -D MQTT_USE_TLS=1 (cổng 8883)
+#ifndef MQTT_USE_TLS
+#define MQTT_USE_TLS 0
+#endif
+
 constexpr char THINGSBOARD_SERVER[] = "app.coreiot.io";
+#if MQTT_USE_TLS
+constexpr uint16_t THINGSBOARD_PORT = 8883U;
+#else
 constexpr uint16_t THINGSBOARD_PORT = 1883U;
+#endif
 
 extern WiFiClient wifiClient;
+#if MQTT_USE_TLS
+// Root CA (PEM) của broker, nullptr = chỉ mã hóa, không xác thực server
+extern const char* mqttRootCA;
+extern TlsClient mqttTlsClient;
+#endif
 extern PubSubClient mqttClient;
+// Phiên MQTT duy nhất của thiết bị, dùng chung cho telemetry, attributes và OTA
+extern MqttSession mqttSession;
+extern MqttHealth mqttHealth;
 
 #define LED_PIN 48
 extern QueueHandle_t ledStateQueue;
@@ -24,7 +47,8 @@ extern const char* ledStateControlKey;
 
 void TaskThingsBoard(void *pvParameters);
 void ledControlTask(void *pvParameters);
-void mqttCallback(char* topic, byte* payload, unsigned int length);
+void onSharedAttributes(const MqttMessage& message);
+void onAttributeResponse(const MqttMessage& message);
 bool reconnect();
 
 #ifdef __cplusplus
@@ -0,0 +1,150 @@
+#include <mqtt_health.hpp>
+#include <WiFi.h>
+
+MqttHealth::MqttHealth(PubSubClient& client) : client(client) {
+    memset(&metrics, 0, sizeof(metrics));
+    metrics.pingIntervalSec = MQTT_KEEPALIVE;
+    wasConnected = false;
+    connectedBefore = false;
+    failedIntervalSec = 0;
+    failuresAtInterval = 0;
+    ceilingHeldProbes = 0;
+    seenPingResponses = 0;
+    stablePings = 0;
+    lastReportMs = 0;
+}
+
+void MqttHealth::applyPingSettings() {
+    client.setKeepAlive(MQTT_HEALTH_ADVERTISED_KEEPALIVE);
+    client.setPingInterval(metrics.pingIntervalSec);
+
+    // Giống RTO của TCP: SRTT + 4*RTTVAR, không vượt quá một chu kỳ ping
+    uint32_t timeout = MQTT_HEALTH_MIN_PING_TIMEOUT;
+    if (metrics.smoothedRttMs > 0) {
+        timeout = max(timeout, metrics.smoothedRttMs + 4 * metrics.rttVarianceMs);
+    }
+    timeout = min(timeout, (uint32_t)(metrics.pingIntervalSec * 1000UL));
+    client.setPingTimeout(timeout);
+}
+
+void MqttHealth::onConnected() {
+    if (connectedBefore) {
+        metrics.reconnects++;
+    }
+    connectedBefore = true;
+    metrics.connectedSinceMs = millis();
+    seenPingResponses = 0;
+    stablePings = 0;
+}
+
+void MqttHealth::onDisconnected() {
+    if (client.state() != MQTT_CONNECTION_TIMEOUT) {
+        return;
+    }
+
+    // Ping không có phản hồi sau một khoảng idle: có thể NAT đã xóa mapping trước đó.
+    // Luôn giảm chu kỳ ping, nhưng chỉ ghi nhận mức trần khi cùng một chu kỳ làm mất
+    // nhiều lần một kết nối mà các ping trước đó vẫn có phản hồi. Timeout khi chưa có
+    // PINGRESP nào thường do broker hoặc WiFi, không phải do NAT.
+    metrics.halfOpenDetected++;
+    if (seenPingResponses > 0) {
+        if (failedIntervalSec == metrics.pingIntervalSec) {
+            failuresAtInterval++;
+        } else {
+            failedIntervalSec = metrics.pingIntervalSec;
+            failuresAtInterval = 1;
+        }
+        if (failuresAtInterval >= MQTT_HEALTH_CEILING_FAILURES) {
+            metrics.natCeilingSec = metrics.pingIntervalSec;
+            ceilingHeldProbes = 0;
+        }
+    }
+    uint16_t reduced = metrics.pingIntervalSec * 3 / 4;
+    metrics.pingIntervalSec = max((uint16_t)MQTT_HEALTH_MIN_PING_INTERVAL, reduced);
+    Serial.printf("[MQTT] Half-open socket, giảm chu kỳ ping xuống %us\n", metrics.pingIntervalSec);
+}
+
+void MqttHealth::onRttSample(uint32_t rtt) {
+    metrics.lastRttMs = rtt;
+    if (metrics.smoothedRttMs == 0) {
+        metrics.smoothedRttMs = rtt;
+        metrics.rttVarianceMs = rtt / 2;
+    } else {
+        // RFC 6298: alpha = 1/8, beta = 1/4
+        uint32_t delta = rtt > metrics.smoothedRttMs ? rtt - metrics.smoothedRttMs : metrics.smoothedRttMs - rtt;
+        metrics.rttVarianceMs = (3 * metrics.rttVarianceMs + delta) / 4;
+        metrics.smoothedRttMs = (7 * metrics.smoothedRttMs + rtt) / 8;
+    }
+
+    // Kết nối ổn định ở chu kỳ hiện tại: dò chu kỳ dài hơn, nhưng luôn nằm dưới mức trần NAT đã biết
+    if (++stablePings >= MQTT_HEALTH_PROBE_PINGS) {
+        stablePings = 0;
+        uint16_t next = metrics.pingIntervalSec + MQTT_HEALTH_PING_STEP;
+        int limit = MQTT_HEALTH_MAX_PING_INTERVAL;
+        if (metrics.natCeilingSec > 0) {
+            limit = min(limit, (int)metrics.natCeilingSec - MQTT_HEALTH_PING_STEP);
+        }
+        if (next <= limit) {
+            metrics.pingIntervalSec = next;
+        } else if (metrics.natCeilingSec > 0 && ++ceilingHeldProbes >= MQTT_HEALTH_CEILING_REPROBE) {
+            // Ổn định lâu ngay dưới mức trần: mạng có thể đã đổi (AP, NAT khác), bỏ mức trần để dò lại
+            Serial.printf("[MQTT] Bỏ mức trần NAT %us, dò lại chu kỳ ping\n", metrics.natCeilingSec);
+            metrics.natCeilingSec = 0;
+            failedIntervalSec = 0;
+            failuresAtInterval = 0;
+            ceilingHeldProbes = 0;
+        }
+    }
+    applyPingSettings();
+}
+
+void MqttHealth::poll() {
+    bool isConnected = client.connected();
+    if (isConnected && !wasConnected) {
+        onConnected();
+    } else if (!isConnected && wasConnected) {
+        onDisconnected();
+    }
+    wasConnected = isConnected;
+
+    if (!isConnected) {
+        // Áp dụng trước lần connect kế tiếp
+        applyPingSettings();
+        return;
+    }
+
+    uint32_t responses = client.getPingResponses();
+    if (responses != seenPingResponses) {
+        seenPingResponses = responses;
+        onRttSample(client.getLastPingRtt());
+    }
+}
+
+uint32_t MqttHealth::msUntilNextAction() {
+    return client.connected() ? client.msUntilKeepAlive() : 0;
+}
+
+bool MqttHealth::publishMetrics(bool force) {
+    if (!client.connected()) {
+        return false;
+    }
+    uint32_t now = millis();
+    if (!force && lastReportMs != 0 && now - lastReportMs < MQTT_HEALTH_REPORT_INTERVAL) {
+        return false;
+    }
+    lastReportMs = now;
+
+    char payload[224];
+    snprintf(payload, sizeof(payload),
+             "{\"mqttRtt\":%lu,\"mqttRttAvg\":%lu,\"mqttPingInterval\":%u,\"mqttNatCeiling\":%u,"
+             "\"mqttReconnects\":%lu,\"mqttHalfOpen\":%lu,\"mqttUptime\":%lu,\"wifiRssi\":%d}",
+             (unsigned long)metrics.lastRttMs, (unsigned long)metrics.smoothedRttMs,
+             metrics.pingIntervalSec, metrics.natCeilingSec,
+             (unsigned long)metrics.reconnects, (unsigned long)metrics.halfOpenDetected,
+             (unsigned long)((now - metrics.connectedSinceMs) / 1000), (int)WiFi.RSSI());
+    return client.publish("v1/devices/me/telemetry", payload);
+}
+
+const MqttHealthMetrics& MqttHealth::getMetrics() const {
+    return metrics;
+}
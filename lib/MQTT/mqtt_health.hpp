@@ -0,0 +1,78 @@
+#ifndef MQTT_HEALTH_HPP
+#define MQTT_HEALTH_HPP
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Keepalive được quảng bá trong CONNECT, broker chỉ ngắt sau 1.5 lần giá trị này.
+// Chu kỳ PINGREQ thực tế được điều chỉnh trong khoảng [MIN, MAX] bên dưới.
+#ifndef MQTT_HEALTH_ADVERTISED_KEEPALIVE
+#define MQTT_HEALTH_ADVERTISED_KEEPALIVE 120
+#endif
+#ifndef MQTT_HEALTH_MIN_PING_INTERVAL
+#define MQTT_HEALTH_MIN_PING_INTERVAL 10
+#endif
+#ifndef MQTT_HEALTH_MAX_PING_INTERVAL
+#define MQTT_HEALTH_MAX_PING_INTERVAL MQTT_HEALTH_ADVERTISED_KEEPALIVE
+#endif
+#define MQTT_HEALTH_PING_STEP 15          // Tăng chu kỳ ping mỗi lần dò (giây)
+#define MQTT_HEALTH_PROBE_PINGS 4         // Số ping thành công liên tiếp trước khi tăng chu kỳ
+#define MQTT_HEALTH_CEILING_FAILURES 2    // Số lần mất kết nối ở cùng một chu kỳ trước khi ghi nhận mức trần NAT
+#define MQTT_HEALTH_CEILING_REPROBE 8     // Số lần dò bị mức trần chặn trước khi bỏ mức trần và dò lại
+#define MQTT_HEALTH_MIN_PING_TIMEOUT 1500 // ms
+#define MQTT_HEALTH_REPORT_INTERVAL 60000 // Chu kỳ gửi telemetry chất lượng kết nối (ms)
+
+// Connection quality metrics, published as telemetry by publishMetrics()
+struct MqttHealthMetrics {
+    uint32_t lastRttMs;
+    uint32_t smoothedRttMs;
+    uint32_t rttVarianceMs;
+    uint16_t pingIntervalSec;     // Current adapted idle ping interval
+    uint16_t natCeilingSec;       // Interval that repeatedly lost a healthy connection, 0 = unknown
+    uint32_t reconnects;          // Successful connections after the first one
+    uint32_t halfOpenDetected;    // Connections dropped because PINGRESP never arrived
+    uint32_t connectedSinceMs;
+};
+
+// Adapts the idle ping interval to the NAT/firewall timeout observed on the
+// path to the broker and times out pings from the measured RTT instead of a
+// whole keepalive period, so half-open sockets are detected within seconds.
+class MqttHealth {
+private:
+    PubSubClient& client;
+    MqttHealthMetrics metrics;
+    bool wasConnected;
+    bool connectedBefore;
+    uint32_t seenPingResponses;
+    uint32_t stablePings;
+    uint16_t failedIntervalSec;   // Interval of the last half-open connection
+    uint8_t failuresAtInterval;   // Half-open connections in a row at failedIntervalSec
+    uint8_t ceilingHeldProbes;    // Probes blocked by natCeilingSec since it was recorded
+    uint32_t lastReportMs;
+
+    void onConnected();
+    void onDisconnected();
+    void onRttSample(uint32_t rtt);
+    void applyPingSettings();
+
+public:
+    explicit MqttHealth(PubSubClient& client);
+
+    // Gọi mỗi vòng lặp của task MQTT, trước khi kết nối lại
+    void poll();
+    // Milliseconds until the client has keepalive work to do
+    uint32_t msUntilNextAction();
+    // Gửi telemetry chất lượng kết nối, giới hạn MQTT_HEALTH_REPORT_INTERVAL
+    bool publishMetrics(bool force = false);
+    const MqttHealthMetrics& getMetrics() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MQTT_HEALTH_HPP
@@ -0,0 +1,74 @@
+#include <mqtt_provision.hpp>
+
+MqttProvisioner::MqttProvisioner(IMQTT_Client& client) : client(client) {
+    token = nullptr;
+    tokenSize = 0;
+    result = MQTT_PROVISION_NO_RESPONSE;
+    responded = false;
+}
+
+void MqttProvisioner::onResponse(const Provision_Data& data) {
+    responded = true;
+
+    // Phản hồi thành công: {"status":"SUCCESS","credentialsType":"ACCESS_TOKEN","credentialsValue":"..."}
+    const char* status = data["status"];
+    const char* credentialsType = data["credentialsType"];
+    const char* credentialsValue = data["credentialsValue"];
+    if (status == nullptr || strcmp(status, "SUCCESS") != 0) {
+        const char* error = data["errorMsg"];
+        Serial.printf("Provisioning bị từ chối: %s\n", error != nullptr ? error : "không rõ lý do");
+        result = MQTT_PROVISION_REJECTED;
+        return;
+    }
+    if (credentialsType == nullptr || strcmp(credentialsType, "ACCESS_TOKEN") != 0 ||
+        credentialsValue == nullptr || credentialsValue[0] == '\0' || strlen(credentialsValue) >= tokenSize) {
+        Serial.printf("Provisioning trả về credentials không hỗ trợ: %s\n", credentialsType != nullptr ? credentialsType : "null");
+        result = MQTT_PROVISION_REJECTED;
+        return;
+    }
+
+    strcpy(token, credentialsValue);
+    result = MQTT_PROVISION_OK;
+}
+
+MqttProvisionResult MqttProvisioner::provision(const char* host, uint16_t port, const char* deviceName,
+                                               const char* provisionKey, const char* provisionSecret,
+                                               char* token, size_t tokenSize, uint32_t timeoutMs) {
+    if (token == nullptr || tokenSize == 0) {
+        return MQTT_PROVISION_REQUEST_FAILED;
+    }
+    this->token = token;
+    this->tokenSize = tokenSize;
+    result = MQTT_PROVISION_NO_RESPONSE;
+    responded = false;
+
+    ThingsBoardSized<> tb(client, MQTT_PROVISION_BUFFER_SIZE);
+    // Client id là tên thiết bị để nhiều thiết bị provisioning cùng lúc không ngắt kết nối của nhau
+    if (!tb.connect(host, "provision", port, deviceName)) {
+        Serial.println("Không kết nối được ThingsBoard để provisioning");
+        return MQTT_PROVISION_CONNECT_FAILED;
+    }
+
+    const Provision_Callback callback(Access_Token(), [this](const Provision_Data& data) { onResponse(data); },
+                                      provisionKey, provisionSecret, deviceName);
+    if (!tb.Provision_Request(callback)) {
+        Serial.println("Gửi yêu cầu provisioning thất bại");
+        tb.disconnect();
+        return MQTT_PROVISION_REQUEST_FAILED;
+    }
+    Serial.printf("Đã gửi yêu cầu provisioning cho %s\n", deviceName);
+
+    uint32_t started = millis();
+    while (!responded && millis() - started < timeoutMs) {
+        if (!tb.loop()) {
+            break;
+        }
+        vTaskDelay(pdMS_TO_TICKS(MQTT_PROVISION_POLL_INTERVAL));
+    }
+    tb.disconnect();
+
+    if (!responded) {
+        Serial.println("Không nhận được phản hồi provisioning");
+    }
+    return result;
+}
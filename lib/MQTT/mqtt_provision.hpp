@@ -0,0 +1,54 @@
+#ifndef MQTT_PROVISION_HPP
+#define MQTT_PROVISION_HPP
+
+#include <Arduino.h>
+#include <ThingsBoard.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Thời gian tối đa chờ phản hồi provisioning từ ThingsBoard (ms)
+#ifndef MQTT_PROVISION_TIMEOUT
+#define MQTT_PROVISION_TIMEOUT 10000
+#endif
+#define MQTT_PROVISION_BUFFER_SIZE 256 // Đủ cho request và phản hồi chứa access token
+#define MQTT_PROVISION_POLL_INTERVAL 10 // ms
+
+enum MqttProvisionResult {
+    MQTT_PROVISION_OK,
+    MQTT_PROVISION_CONNECT_FAILED,  // Không kết nối được broker với user "provision"
+    MQTT_PROVISION_REQUEST_FAILED,  // Không gửi được request
+    MQTT_PROVISION_REJECTED,        // Server từ chối, vd. sai key/secret hoặc thiết bị đã tồn tại
+    MQTT_PROVISION_NO_RESPONSE      // Không có phản hồi hoặc mất kết nối trước khi có phản hồi
+};
+
+// Runs the ThingsBoard device provisioning API once over its own client:
+// connects as "provision", sends Provision_Request with the key and secret
+// of the device profile and waits for the access token issued for the
+// device name. The caller caches the token in NVS, so later boots connect
+// with it directly and never repeat this round-trip.
+class MqttProvisioner {
+private:
+    IMQTT_Client& client;
+    char* token;
+    size_t tokenSize;
+    MqttProvisionResult result;
+    bool responded;
+
+    void onResponse(const Provision_Data& data);
+
+public:
+    explicit MqttProvisioner(IMQTT_Client& client);
+
+    // Chặn task gọi tới khi nhận được phản hồi hoặc hết timeoutMs, token chỉ được ghi khi trả về MQTT_PROVISION_OK
+    MqttProvisionResult provision(const char* host, uint16_t port, const char* deviceName,
+                                  const char* provisionKey, const char* provisionSecret,
+                                  char* token, size_t tokenSize, uint32_t timeoutMs = MQTT_PROVISION_TIMEOUT);
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MQTT_PROVISION_HPP
@@ -0,0 +1,64 @@
+#include <mqtt_receiver.hpp>
+#include <lwip/sockets.h>
+
+MqttReceiver::MqttReceiver(PubSubClient& client, Client& transport, WiFiClient& socket, SemaphoreHandle_t mutex)
+    : client(client), transport(transport), socket(socket), mutex(mutex) {
+}
+
+uint32_t MqttReceiver::drain() {
+    uint32_t handled = 0;
+    // Không giữ khóa trong select(), các task khác vẫn publish được khi task này đang ngủ
+    if (mutex != nullptr) {
+        xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    }
+    // loop() luôn được gọi một lần để xử lý keepalive, kể cả khi không có dữ liệu
+    if (!client.loop()) {
+        if (mutex != nullptr) {
+            xSemaphoreGiveRecursive(mutex);
+        }
+        return 0;
+    }
+    // WiFiClient và TlsClient có buffer riêng: select() không báo những byte đã được
+    // đọc khỏi socket, nên phải đọc hết qua available() trước khi ngủ lại
+    while (handled < MQTT_RECEIVER_MAX_BURST && client.connected() && transport.available() > 0) {
+        client.loop();
+        handled++;
+    }
+    if (mutex != nullptr) {
+        xSemaphoreGiveRecursive(mutex);
+    }
+    return handled;
+}
+
+bool MqttReceiver::waitReadable(uint32_t timeoutMs) {
+    int fd = socket.fd();
+    if (fd < 0 || !client.connected()) {
+        vTaskDelay(pdMS_TO_TICKS(timeoutMs));
+        return false;
+    }
+    if (transport.available() > 0) {
+        return true;
+    }
+
+    fd_set readSet;
+    FD_ZERO(&readSet);
+    FD_SET(fd, &readSet);
+    struct timeval tv;
+    tv.tv_sec = timeoutMs / 1000;
+    tv.tv_usec = (timeoutMs % 1000) * 1000;
+    // Socket bị đóng cũng được báo là readable, loop() sẽ phát hiện và cập nhật state
+    return select(fd + 1, &readSet, nullptr, nullptr, &tv) > 0;
+}
+
+uint32_t MqttReceiver::service(uint32_t timeoutMs) {
+    uint32_t handled = drain();
+    if (handled == MQTT_RECEIVER_MAX_BURST) {
+        // Vẫn còn dữ liệu, nhường CPU rồi quay lại ngay
+        taskYIELD();
+        return handled;
+    }
+    if (waitReadable(timeoutMs)) {
+        handled += drain();
+    }
+    return handled;
+}
@@ -0,0 +1,42 @@
+#ifndef MQTT_RECEIVER_HPP
+#define MQTT_RECEIVER_HPP
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <PubSubClient.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Số gói tối đa xử lý trong một lần drain, tránh chiếm CPU khi broker gửi liên tục
+#ifndef MQTT_RECEIVER_MAX_BURST
+#define MQTT_RECEIVER_MAX_BURST 32
+#endif
+
+// Event-driven receive path for a PubSubClient: the owning task sleeps in
+// select() on the lwIP socket and dispatches every pending message as soon
+// as it becomes readable, instead of calling loop() on a fixed timer.
+class MqttReceiver {
+private:
+    PubSubClient& client;
+    Client& transport;      // Client used by PubSubClient (WiFiClient or TlsClient)
+    WiFiClient& socket;     // Underlying TCP socket, used for select()
+    SemaphoreHandle_t mutex; // Khóa đệ quy của MqttSession, chỉ giữ trong lúc gọi loop()
+
+public:
+    MqttReceiver(PubSubClient& client, Client& transport, WiFiClient& socket, SemaphoreHandle_t mutex = nullptr);
+
+    // Gọi loop() rồi xử lý hết các gói đã nằm trong buffer, trả về số gói đã xử lý
+    uint32_t drain();
+    // Chờ socket có dữ liệu tối đa timeoutMs, trả về true nếu socket readable
+    bool waitReadable(uint32_t timeoutMs);
+    // drain() + chờ + drain(): dùng thay cho "loop(); vTaskDelay(...)" trong các task
+    uint32_t service(uint32_t timeoutMs);
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MQTT_RECEIVER_HPP
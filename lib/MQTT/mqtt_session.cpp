@@ -0,0 +1,194 @@
+#include <mqtt_session.hpp>
+
+MqttSession::MqttSession(PubSubClient& client)
+    : client(client), router(), routeCount(0), subscriptionCount(0), handlerCount(0),
+      connectHandlerCount(0), connectAttributeKeyCount(0), attributeRequestId(0), bufferSize(MQTT_MAX_PACKET_SIZE) {
+    mutex = xSemaphoreCreateRecursiveMutex();
+    client.setCallback([this](char* topic, uint8_t* payload, unsigned int length) {
+        dispatch(topic, payload, length);
+    });
+}
+
+uint8_t MqttSession::routeFor(const char* filter) {
+    for (uint8_t i = 0; i < routeCount; i++) {
+        if (strcmp(routeFilters[i], filter) == 0) {
+            return i;
+        }
+    }
+    if (routeCount >= MQTT_SESSION_MAX_HANDLERS || !router.add(filter, routeCount)) {
+        return TOPIC_NO_ROUTE;
+    }
+    routeFilters[routeCount] = filter;
+    return routeCount++;
+}
+
+bool MqttSession::addSubscription(const char* filter, uint8_t qos) {
+    lock();
+    bool added = true;
+    bool known = false;
+    for (uint8_t i = 0; i < subscriptionCount; i++) {
+        known = known || strcmp(subscriptions[i].filter, filter) == 0;
+    }
+    if (!known) {
+        if (subscriptionCount < MQTT_SESSION_MAX_SUBSCRIPTIONS) {
+            subscriptions[subscriptionCount++] = { filter, qos };
+            // Đang kết nối thì subscribe ngay, nếu không sẽ được subscribe trong connect()
+            if (client.connected()) {
+                client.subscribe(filter, qos);
+            }
+        } else {
+            Serial.printf("[MQTT] Hết chỗ cho subscription %s\n", filter);
+            added = false;
+        }
+    }
+    unlock();
+    return added;
+}
+
+bool MqttSession::addHandler(const char* filter, MqttMessageHandler handler) {
+    lock();
+    uint8_t route = routeFor(filter);
+    bool added = route != TOPIC_NO_ROUTE && handlerCount < MQTT_SESSION_MAX_HANDLERS;
+    if (added) {
+        handlers[handlerCount++] = { route, handler };
+    } else {
+        Serial.printf("[MQTT] Không thể đăng ký handler cho %s\n", filter);
+    }
+    unlock();
+    return added;
+}
+
+bool MqttSession::subscribe(const char* filter, MqttMessageHandler handler, uint8_t qos) {
+    return addHandler(filter, handler) && addSubscription(filter, qos);
+}
+
+bool MqttSession::onConnect(MqttConnectHandler handler) {
+    if (connectHandlerCount >= MQTT_SESSION_MAX_CONNECT_HANDLERS) {
+        return false;
+    }
+    connectHandlers[connectHandlerCount++] = handler;
+    return true;
+}
+
+bool MqttSession::requestAttributesOnConnect(const char* sharedKeys) {
+    if (connectAttributeKeyCount >= MQTT_SESSION_MAX_ATTRIBUTE_KEYS) {
+        return false;
+    }
+    connectAttributeKeys[connectAttributeKeyCount++] = sharedKeys;
+    return true;
+}
+
+uint32_t MqttSession::requestAttributes(const char* sharedKeys) {
+    return publishAttributeRequest(&sharedKeys, 1);
+}
+
+uint32_t MqttSession::publishAttributeRequest(const char* const* sharedKeys, uint8_t count) {
+    // {"sharedKeys":"a,b,c"}, key của các module nối bằng dấu phẩy
+    char payload[MQTT_SESSION_ATTRIBUTE_PAYLOAD_SIZE];
+    size_t length = snprintf(payload, sizeof(payload), "{\"sharedKeys\":\"");
+    for (uint8_t i = 0; i < count && length < sizeof(payload); i++) {
+        length += snprintf(payload + length, sizeof(payload) - length, i == 0 ? "%s" : ",%s", sharedKeys[i]);
+    }
+    if (length < sizeof(payload)) {
+        length += snprintf(payload + length, sizeof(payload) - length, "\"}");
+    }
+    if (length >= sizeof(payload)) {
+        Serial.printf("[MQTT] Attributes request vượt quá %u bytes\n", (unsigned)sizeof(payload));
+        return 0;
+    }
+
+    lock();
+    // Id 0 dùng để báo lỗi nên không bao giờ được gửi đi
+    if (++attributeRequestId == 0) {
+        attributeRequestId = 1;
+    }
+    uint32_t requestId = attributeRequestId;
+    unlock();
+
+    char topic[48];
+    snprintf(topic, sizeof(topic), "v1/devices/me/attributes/request/%u", (unsigned)requestId);
+    return publish(topic, payload) ? requestId : 0;
+}
+
+void MqttSession::requireBufferSize(uint16_t size) {
+    lock();
+    if (size > bufferSize) {
+        bufferSize = size;
+    }
+    unlock();
+}
+
+bool MqttSession::connect(const char* id, const char* user, const char* pass) {
+    lock();
+    // setBufferSize() cấp phát lại buffer, chỉ thay đổi khi chưa có kết nối
+    if (client.getBufferSize() != bufferSize && !client.setBufferSize(bufferSize)) {
+        Serial.printf("[MQTT] Không cấp phát được buffer %u bytes\n", bufferSize);
+    }
+    bool ok = client.connect(id, user, pass);
+    if (ok) {
+        for (uint8_t i = 0; i < subscriptionCount; i++) {
+            client.subscribe(subscriptions[i].filter, subscriptions[i].qos);
+        }
+        Serial.printf("[MQTT] Đã khôi phục %u subscription, buffer %u bytes\n", subscriptionCount, bufferSize);
+    }
+    unlock();
+
+    if (ok) {
+        for (uint8_t i = 0; i < connectHandlerCount; i++) {
+            connectHandlers[i]();
+        }
+        // Một round-trip cho toàn bộ cấu hình ban đầu thay vì một request cho mỗi module
+        if (connectAttributeKeyCount > 0) {
+            uint32_t requestId = publishAttributeRequest(connectAttributeKeys, connectAttributeKeyCount);
+            Serial.printf("[MQTT] Yêu cầu attributes ban đầu (ID: %u) %s\n", (unsigned)requestId, requestId != 0 ? "đã gửi" : "thất bại");
+        }
+    }
+    return ok;
+}
+
+bool MqttSession::connected() {
+    return client.connected();
+}
+
+bool MqttSession::publish(const char* topic, const char* payload, bool retained) {
+    lock();
+    bool ok = client.connected() && client.publish(topic, payload, retained);
+    unlock();
+    return ok;
+}
+
+void MqttSession::dispatch(char* topic, uint8_t* payload, unsigned int length) {
+    MqttMessage message;
+    message.topic = topic;
+    message.payload = payload;
+    message.length = length;
+    // Mọi filter khớp với topic đều được gọi, không chỉ filter có độ ưu tiên cao nhất,
+    // vd. "v1/devices/me/attributes" và "v1/devices/me/#" cùng nhận một message
+    size_t matched = router.match_all(topic, [this, &message](const Topic_Match<MQTT_SESSION_MAX_CAPTURES>& route) {
+        message.route = route;
+        for (uint8_t i = 0; i < handlerCount; i++) {
+            if (handlers[i].route == route.route) {
+                handlers[i].handler(message);
+            }
+        }
+    });
+    if (matched == 0) {
+        Serial.printf("[MQTT] Không có handler cho topic %s\n", topic);
+    }
+}
+
+void MqttSession::lock() {
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+}
+
+void MqttSession::unlock() {
+    xSemaphoreGiveRecursive(mutex);
+}
+
+SemaphoreHandle_t MqttSession::getMutex() const {
+    return mutex;
+}
+
+PubSubClient& MqttSession::getClient() {
+    return client;
+}
@@ -0,0 +1,111 @@
+#ifndef MQTT_SESSION_HPP
+#define MQTT_SESSION_HPP
+
+#include <Arduino.h>
+#include <PubSubClient.h>
+#include <Topic_Router.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Giới hạn số đăng ký của các module, toàn bộ được cấp phát tĩnh
+#ifndef MQTT_SESSION_MAX_SUBSCRIPTIONS
+#define MQTT_SESSION_MAX_SUBSCRIPTIONS 8
+#endif
+#ifndef MQTT_SESSION_MAX_HANDLERS
+#define MQTT_SESSION_MAX_HANDLERS 12
+#endif
+#ifndef MQTT_SESSION_MAX_CONNECT_HANDLERS
+#define MQTT_SESSION_MAX_CONNECT_HANDLERS 4
+#endif
+#ifndef MQTT_SESSION_MAX_ATTRIBUTE_KEYS
+#define MQTT_SESSION_MAX_ATTRIBUTE_KEYS 4
+#endif
+#define MQTT_SESSION_ATTRIBUTE_PAYLOAD_SIZE 256 // Payload của attributes request gộp từ mọi module
+#define MQTT_SESSION_ROUTER_NODES 32
+#define MQTT_SESSION_MAX_CAPTURES 2
+
+// Message delivered to the handlers registered for a topic filter
+struct MqttMessage {
+    const char* topic;
+    uint8_t* payload;
+    unsigned int length;
+    Topic_Match<MQTT_SESSION_MAX_CAPTURES> route;   // Giá trị của các level "+", vd. request id
+};
+
+typedef void (*MqttMessageHandler)(const MqttMessage& message);
+typedef void (*MqttConnectHandler)();
+
+// Owns the single broker session of the device. Subsystems (telemetry,
+// shared attributes, RPC, OTA) register their subscriptions and handlers
+// here instead of creating their own client: every subscription is restored
+// after a reconnect, the packet buffer is sized once for the largest
+// requirement and publishes from different tasks are serialized.
+class MqttSession {
+private:
+    struct Subscription {
+        const char* filter;
+        uint8_t qos;
+    };
+    struct Handler {
+        uint8_t route;
+        MqttMessageHandler handler;
+    };
+
+    PubSubClient& client;
+    SemaphoreHandle_t mutex;
+    Topic_Router<MQTT_SESSION_ROUTER_NODES, MQTT_SESSION_MAX_CAPTURES> router;
+    const char* routeFilters[MQTT_SESSION_MAX_HANDLERS];
+    uint8_t routeCount;
+    Subscription subscriptions[MQTT_SESSION_MAX_SUBSCRIPTIONS];
+    uint8_t subscriptionCount;
+    Handler handlers[MQTT_SESSION_MAX_HANDLERS];
+    uint8_t handlerCount;
+    MqttConnectHandler connectHandlers[MQTT_SESSION_MAX_CONNECT_HANDLERS];
+    uint8_t connectHandlerCount;
+    const char* connectAttributeKeys[MQTT_SESSION_MAX_ATTRIBUTE_KEYS];
+    uint8_t connectAttributeKeyCount;
+    uint32_t attributeRequestId;
+    uint16_t bufferSize;
+
+    uint8_t routeFor(const char* filter);
+    uint32_t publishAttributeRequest(const char* const* sharedKeys, uint8_t count);
+    void dispatch(char* topic, uint8_t* payload, unsigned int length);
+
+public:
+    explicit MqttSession(PubSubClient& client);
+
+    // Đăng ký topic filter, được subscribe lại sau mỗi lần kết nối
+    bool addSubscription(const char* filter, uint8_t qos = 0);
+    // Gắn handler cho topic filter (có thể hẹp hơn filter đã subscribe), nhiều handler được gọi theo thứ tự đăng ký.
+    // Khi nhiều filter khớp cùng một topic, handler của mọi filter đều được gọi: filter literal trước, rồi "+", rồi "#"
+    bool addHandler(const char* filter, MqttMessageHandler handler);
+    // addSubscription() + addHandler() với cùng một filter, xem addHandler() khi các filter chồng lên nhau
+    bool subscribe(const char* filter, MqttMessageHandler handler, uint8_t qos = 0);
+    // Gọi sau mỗi lần kết nối thành công, khi các subscription đã được khôi phục
+    bool onConnect(MqttConnectHandler handler);
+    // Shared attributes (các key cách nhau bởi dấu phẩy) cần sau mỗi lần kết nối, key của mọi module
+    // được gộp vào một attributes request duy nhất, gửi sau các handler của onConnect()
+    bool requestAttributesOnConnect(const char* sharedKeys);
+    // Gửi attributes request, phản hồi đến v1/devices/me/attributes/response/{id}; trả về id hoặc 0 nếu thất bại
+    uint32_t requestAttributes(const char* sharedKeys);
+    // Buffer của client được cấp phát theo yêu cầu lớn nhất trong các module
+    void requireBufferSize(uint16_t size);
+
+    bool connect(const char* id, const char* user, const char* pass);
+    bool connected();
+    bool publish(const char* topic, const char* payload, bool retained = false);
+
+    // Khóa đệ quy bảo vệ client, giữ trong lúc gọi loop() hoặc publish từ task khác
+    void lock();
+    void unlock();
+    SemaphoreHandle_t getMutex() const;
+    PubSubClient& getClient();
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MQTT_SESSION_HPP
@@ -0,0 +1,153 @@
+#include "BootValidator.h"
+
+static void copyString(char* destination, size_t size, const String& source) {
+    strncpy(destination, source.c_str(), size - 1);
+    destination[size - 1] = '\0';
+}
+
+BootValidator::BootValidator(BootPlatform& platform, BootAttempts& attempts)
+    : platform(platform), attempts(attempts), state(BOOT_NORMAL), required(0), passed(0), deadline(0) {
+    memset(&record, 0, sizeof(record));
+}
+
+BootState BootValidator::begin(uint8_t requiredProbes, uint32_t now) {
+    required = requiredProbes;
+    passed = 0;
+    state = BOOT_NORMAL;
+    if (!platform.loadRecord(record) || record.magic != BOOT_RECORD_MAGIC) {
+        memset(&record, 0, sizeof(record));
+        return state;
+    }
+
+    uint32_t running = platform.runningPartition();
+    switch (record.state) {
+        case BOOT_IMAGE_PENDING:
+            if (running != record.target) {
+                // Bootloader không khởi động được image mới và đã quay lại partition cũ
+                Serial.printf("Firmware %s v%s did not boot, running previous image\n", record.title, record.version);
+                record.state = BOOT_IMAGE_ROLLED_BACK;
+                platform.saveRecord(record);
+                state = BOOT_ROLLED_BACK;
+                break;
+            }
+            if (attempts.magic != BOOT_RECORD_MAGIC || attempts.target != record.target ||
+                attempts.check != ~(attempts.target ^ attempts.count)) {
+                attempts.magic = BOOT_RECORD_MAGIC;
+                attempts.target = record.target;
+                attempts.count = 0;
+            }
+            attempts.count++;
+            attempts.check = ~(attempts.target ^ attempts.count);
+            Serial.printf("Validating firmware %s v%s, boot attempt %lu/%d\n", record.title, record.version,
+                          (unsigned long)attempts.count, OTA_BOOT_MAX_ATTEMPTS);
+            state = BOOT_PENDING;
+            deadline = now + OTA_BOOT_DEADLINE;
+            if (attempts.count > OTA_BOOT_MAX_ATTEMPTS) {
+                rollBack("too many boot attempts");
+            }
+            break;
+        case BOOT_IMAGE_CONFIRMED:
+            // Image đã được thay bằng cách khác (nạp qua cổng serial...): thông tin không còn đúng
+            if (running != record.target) {
+                memset(&record, 0, sizeof(record));
+                platform.saveRecord(record);
+            }
+            break;
+        case BOOT_IMAGE_ROLLED_BACK:
+            state = BOOT_ROLLED_BACK;
+            break;
+        default:
+            break;
+    }
+    return state;
+}
+
+bool BootValidator::markPending(uint32_t target, const String& title, const String& version) {
+    memset(&record, 0, sizeof(record));
+    record.magic = BOOT_RECORD_MAGIC;
+    record.target = target;
+    record.previous = platform.runningPartition();
+    record.state = BOOT_IMAGE_PENDING;
+    copyString(record.title, sizeof(record.title), title);
+    copyString(record.version, sizeof(record.version), version);
+    // Bộ đếm bắt đầu lại từ 0 cho image mới
+    attempts.magic = 0;
+    return platform.saveRecord(record);
+}
+
+void BootValidator::report(uint8_t probe) {
+    __atomic_fetch_or(&passed, probe, __ATOMIC_RELAXED);
+}
+
+BootState BootValidator::poll(uint32_t now) {
+    if (state != BOOT_PENDING) {
+        return state;
+    }
+    if ((passed & required) == required) {
+        record.state = BOOT_IMAGE_CONFIRMED;
+        if (!platform.saveRecord(record)) {
+            // Thử lại ở lần gọi sau, trước thời hạn
+            return state;
+        }
+        platform.markValid();
+        attempts.magic = 0;
+        state = BOOT_CONFIRMED;
+        Serial.printf("Firmware %s v%s confirmed\n", record.title, record.version);
+    } else if ((int32_t)(now - deadline) >= 0) {
+        Serial.printf("Boot validation timed out, missing probes 0x%02x\n", getMissingProbes());
+        rollBack("health check timed out");
+    }
+    return state;
+}
+
+void BootValidator::rollBack(const char* reason) {
+    Serial.printf("Rolling back firmware %s v%s: %s\n", record.title, record.version, reason);
+    attempts.magic = 0;
+    if (!platform.setBootPartition(record.previous)) {
+        // Image cũ không còn hợp lệ: giữ image mới thay vì khởi động lại liên tục
+        Serial.println("Previous image is not bootable, keeping the new firmware");
+        record.state = BOOT_IMAGE_CONFIRMED;
+        platform.saveRecord(record);
+        state = BOOT_CONFIRMED;
+        return;
+    }
+    record.state = BOOT_IMAGE_ROLLED_BACK;
+    platform.saveRecord(record);
+    state = BOOT_ROLLED_BACK;
+    platform.restart();
+}
+
+void BootValidator::acknowledge() {
+    if (record.state == BOOT_IMAGE_ROLLED_BACK) {
+        record.state = BOOT_IMAGE_REJECTED;
+        platform.saveRecord(record);
+    }
+}
+
+BootState BootValidator::getState() const {
+    return state;
+}
+
+uint8_t BootValidator::getMissingProbes() const {
+    return required & ~passed;
+}
+
+bool BootValidator::matches(const String& title, const String& version) const {
+    return record.magic == BOOT_RECORD_MAGIC && title == record.title && version == record.version;
+}
+
+bool BootValidator::isInstalled(const String& title, const String& version) const {
+    return record.state == BOOT_IMAGE_CONFIRMED && matches(title, version);
+}
+
+bool BootValidator::isRejected(const String& title, const String& version) const {
+    return (record.state == BOOT_IMAGE_ROLLED_BACK || record.state == BOOT_IMAGE_REJECTED) && matches(title, version);
+}
+
+const char* BootValidator::getTitle() const {
+    return record.title;
+}
+
+const char* BootValidator::getVersion() const {
+    return record.version;
+}
@@ -0,0 +1,124 @@
+#ifndef BOOT_VALIDATOR_H
+#define BOOT_VALIDATOR_H
+
+#include <Arduino.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Thời gian tối đa để image mới vượt qua tất cả health probe sau khi khởi động
+#ifndef OTA_BOOT_DEADLINE
+#define OTA_BOOT_DEADLINE 300000
+#endif
+// Số lần khởi động image mới (kể cả các lần bị reset do crash/watchdog) trước khi quay lại image cũ
+#ifndef OTA_BOOT_MAX_ATTEMPTS
+#define OTA_BOOT_MAX_ATTEMPTS 3
+#endif
+#define BOOT_RECORD_MAGIC 0x424F4F54   // "BOOT"
+
+// Health probe, image mới chỉ được xác nhận khi tất cả probe yêu cầu đã được báo
+#define BOOT_PROBE_SENSORS   0x01  // Cảm biến đã khởi tạo và đọc được giá trị hợp lệ
+#define BOOT_PROBE_MQTT      0x02  // Đã kết nối ThingsBoard
+#define BOOT_PROBE_TELEMETRY 0x04  // Đã gửi telemetry
+
+enum BootImageState : uint8_t {
+    BOOT_IMAGE_PENDING,     // Image mới đã được đặt để boot, chưa được xác nhận
+    BOOT_IMAGE_CONFIRMED,   // Image đang chạy đã được xác nhận
+    BOOT_IMAGE_ROLLED_BACK, // Đã quay lại image cũ, chưa báo lên server
+    BOOT_IMAGE_REJECTED     // Đã quay lại image cũ và đã báo, firmware này không được tải lại
+};
+
+// Last installed firmware, persisted in NVS
+struct BootRecord {
+    uint32_t magic;
+    uint32_t target;        // Địa chỉ partition của image mới
+    uint32_t previous;      // Địa chỉ partition của image đã cài image mới
+    uint8_t state;          // BootImageState
+    char title[32];
+    char version[32];
+};
+
+// Boot counter of the image under test, kept in RTC memory so resets caused
+// by a crash or a watchdog are counted while a power cycle starts over
+struct BootAttempts {
+    uint32_t magic;
+    uint32_t target;
+    uint32_t count;
+    uint32_t check;         // ~(target ^ count), RTC memory không được khởi tạo khi cấp nguồn
+};
+
+// Partition table and persistent storage used by BootValidator, implemented
+// with the ESP-IDF OTA API on the device and faked on the host
+class BootPlatform {
+public:
+    virtual ~BootPlatform() {}
+    virtual uint32_t runningPartition() = 0;
+    // Đặt partition sẽ được boot, false nếu partition không chứa image hợp lệ
+    virtual bool setBootPartition(uint32_t address) = 0;
+    // Hủy rollback của bootloader (nếu được bật trong sdkconfig)
+    virtual void markValid() = 0;
+    virtual void restart() = 0;
+    virtual bool loadRecord(BootRecord& record) = 0;
+    virtual bool saveRecord(const BootRecord& record) = 0;
+};
+
+enum BootState : uint8_t {
+    BOOT_NORMAL,            // Không có image chờ xác nhận
+    BOOT_PENDING,           // Image mới đang được kiểm tra
+    BOOT_CONFIRMED,         // Image mới vừa được xác nhận trong lần khởi động này
+    BOOT_ROLLED_BACK        // Đang chạy image cũ sau khi image mới bị từ chối
+};
+
+// Boot validation of a freshly installed image: the image is marked pending
+// before the restart, then has OTA_BOOT_DEADLINE milliseconds and
+// OTA_BOOT_MAX_ATTEMPTS boots to report every required health probe. Once
+// they are all in the image is confirmed, otherwise the previous partition
+// is made bootable again and the device restarts into it. The rejected
+// firmware is remembered so it is not downloaded again.
+class BootValidator {
+private:
+    BootPlatform& platform;
+    BootAttempts& attempts;
+    BootRecord record;
+    BootState state;
+    uint8_t required;
+    volatile uint8_t passed;
+    uint32_t deadline;
+
+    bool matches(const String& title, const String& version) const;
+    void rollBack(const char* reason);
+
+public:
+    BootValidator(BootPlatform& platform, BootAttempts& attempts);
+
+    // Gọi sớm trong setup(), có thể khởi động lại thiết bị để quay lại image cũ
+    BootState begin(uint8_t requiredProbes, uint32_t now);
+    // Image vừa ghi vào partition target sẽ được boot sau lần khởi động lại kế tiếp
+    bool markPending(uint32_t target, const String& title, const String& version);
+    // Gọi từ bất kỳ task nào khi một health probe thành công
+    void report(uint8_t probe);
+    // Xác nhận image hoặc quay lại image cũ khi hết hạn, gọi định kỳ
+    BootState poll(uint32_t now);
+    // Kết quả rollback đã được báo lên server
+    void acknowledge();
+
+    BootState getState() const;
+    // Các probe yêu cầu chưa được báo
+    uint8_t getMissingProbes() const;
+    // Firmware này đang chạy và đã được xác nhận
+    bool isInstalled(const String& title, const String& version) const;
+    // Firmware này đã bị từ chối khi khởi động
+    bool isRejected(const String& title, const String& version) const;
+    // Tên/phiên bản của image cuối cùng, rỗng nếu chưa từng cài qua OTA
+    const char* getTitle() const;
+    const char* getVersion() const;
+};
+
+extern BootValidator bootValidator;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // BOOT_VALIDATOR_H
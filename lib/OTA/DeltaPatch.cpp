@@ -0,0 +1,221 @@
+#include "DeltaPatch.h"
+
+static uint32_t readUint32(const uint8_t* data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+DeltaPatch::DeltaPatch() {
+    begin(nullptr);
+}
+
+bool DeltaPatch::isPatch(const uint8_t* data, size_t length) {
+    return length >= 4 && memcmp(data, DELTA_PATCH_MAGIC, 4) == 0;
+}
+
+void DeltaPatch::begin(DeltaTarget* target) {
+    this->target = target;
+    state = STATE_HEADER;
+    headerLength = 0;
+    sourceSize = 0;
+    targetSize = 0;
+    produced = 0;
+    sourcePos = 0;
+    seek = 0;
+    diffRemaining = 0;
+    extraRemaining = 0;
+    literalRemaining = 0;
+    varint = 0;
+    varintShift = 0;
+    outputLength = 0;
+    sourceStart = 0;
+    sourceLength = 0;
+}
+
+bool DeltaPatch::readVarint(uint8_t byte) {
+    if (varintShift >= 32) {
+        state = STATE_ERROR;
+        return false;
+    }
+    varint |= (uint32_t)(byte & 0x7F) << varintShift;
+    varintShift += 7;
+    if (byte & 0x80) {
+        return false;
+    }
+    varintShift = 0;
+    return true;
+}
+
+bool DeltaPatch::parseHeader() {
+    if (!isPatch(header, sizeof(header))) {
+        return false;
+    }
+    sourceSize = readUint32(header + 4);
+    uint32_t sourceCrc = readUint32(header + 8);
+    targetSize = readUint32(header + 12);
+    return target != nullptr && target->beginTarget(sourceSize, sourceCrc, targetSize);
+}
+
+bool DeltaPatch::flush() {
+    if (outputLength == 0) {
+        return true;
+    }
+    bool ok = target->writeTarget(output, outputLength);
+    outputLength = 0;
+    return ok;
+}
+
+bool DeltaPatch::emit(uint8_t byte) {
+    output[outputLength++] = byte;
+    produced++;
+    return outputLength < sizeof(output) || flush();
+}
+
+bool DeltaPatch::sourceByte(uint8_t& byte) {
+    if (sourcePos >= sourceSize) {
+        return false;
+    }
+    if (sourcePos < sourceStart || sourcePos >= sourceStart + sourceLength) {
+        sourceStart = sourcePos;
+        sourceLength = min((uint32_t)sizeof(source), sourceSize - sourcePos);
+        if (!target->readSource(sourceStart, source, sourceLength)) {
+            sourceLength = 0;
+            return false;
+        }
+    }
+    byte = source[sourcePos++ - sourceStart];
+    return true;
+}
+
+bool DeltaPatch::copySource(uint32_t length) {
+    uint8_t byte;
+    for (uint32_t i = 0; i < length; i++) {
+        if (!sourceByte(byte) || !emit(byte)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+DeltaPatch::State DeltaPatch::afterDiff() {
+    return extraRemaining > 0 ? STATE_EXTRA : endRecord();
+}
+
+DeltaPatch::State DeltaPatch::endRecord() {
+    int64_t next = (int64_t)sourcePos + seek;
+    if (next < 0 || next > (int64_t)sourceSize) {
+        return STATE_ERROR;
+    }
+    sourcePos = (uint32_t)next;
+    if (produced < targetSize) {
+        return STATE_DIFF_LENGTH;
+    }
+    return flush() ? STATE_DONE : STATE_ERROR;
+}
+
+bool DeltaPatch::feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length && state != STATE_ERROR; i++) {
+        uint8_t byte = data[i];
+        switch (state) {
+            case STATE_HEADER:
+                header[headerLength++] = byte;
+                if (headerLength == sizeof(header)) {
+                    if (!parseHeader()) {
+                        state = STATE_ERROR;
+                    } else {
+                        state = targetSize > 0 ? STATE_DIFF_LENGTH : STATE_DONE;
+                    }
+                }
+                break;
+
+            case STATE_DIFF_LENGTH:
+                if (readVarint(byte)) {
+                    diffRemaining = varint;
+                    varint = 0;
+                    state = STATE_EXTRA_LENGTH;
+                }
+                break;
+
+            case STATE_EXTRA_LENGTH:
+                if (readVarint(byte)) {
+                    extraRemaining = varint;
+                    varint = 0;
+                    state = STATE_SEEK;
+                }
+                break;
+
+            case STATE_SEEK:
+                if (readVarint(byte)) {
+                    seek = (int32_t)(varint >> 1) ^ -(int32_t)(varint & 1);
+                    varint = 0;
+                    if ((uint64_t)produced + diffRemaining + extraRemaining > targetSize) {
+                        state = STATE_ERROR;
+                    } else {
+                        state = diffRemaining > 0 ? STATE_ZERO_RUN : afterDiff();
+                    }
+                }
+                break;
+
+            case STATE_ZERO_RUN:
+                if (readVarint(byte)) {
+                    uint32_t run = varint;
+                    varint = 0;
+                    // Byte diff bằng 0: sao chép nguyên source
+                    if (run > diffRemaining || !copySource(run)) {
+                        state = STATE_ERROR;
+                        break;
+                    }
+                    diffRemaining -= run;
+                    state = diffRemaining > 0 ? STATE_LITERAL_LENGTH : afterDiff();
+                }
+                break;
+
+            case STATE_LITERAL_LENGTH:
+                if (readVarint(byte)) {
+                    literalRemaining = varint;
+                    varint = 0;
+                    state = literalRemaining > 0 && literalRemaining <= diffRemaining ? STATE_LITERAL : STATE_ERROR;
+                }
+                break;
+
+            case STATE_LITERAL: {
+                uint8_t sourceValue;
+                if (!sourceByte(sourceValue) || !emit(sourceValue + byte)) {
+                    state = STATE_ERROR;
+                    break;
+                }
+                diffRemaining--;
+                if (--literalRemaining == 0) {
+                    state = diffRemaining > 0 ? STATE_ZERO_RUN : afterDiff();
+                }
+                break;
+            }
+
+            case STATE_EXTRA:
+                if (!emit(byte)) {
+                    state = STATE_ERROR;
+                    break;
+                }
+                if (--extraRemaining == 0) {
+                    state = endRecord();
+                }
+                break;
+
+            case STATE_DONE:
+                // Dữ liệu thừa sau khi target đã đủ
+                state = STATE_ERROR;
+                break;
+
+            default:
+                break;
+        }
+    }
+    return state != STATE_ERROR;
+}
+
+bool DeltaPatch::finished() const {
+    return state == STATE_DONE;
+}
+
+uint32_t DeltaPatch::getTargetSize() const {
+    return targetSize;
+}
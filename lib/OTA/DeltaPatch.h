@@ -0,0 +1,99 @@
+#ifndef DELTA_PATCH_H
+#define DELTA_PATCH_H
+
+#include <Arduino.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Định dạng patch, được tạo bởi tools/ota_delta.py:
+//   header: "TBD1", kích thước source, CRC32 source, kích thước target (uint32 little endian)
+//   record: varint diffLen, varint extraLen, zigzag varint seek
+//           diff:  lặp lại (varint số byte 0, varint số byte khác 0, các byte khác 0) đến đủ diffLen
+//           extra: extraLen byte được ghi nguyên vẹn
+// Giống bsdiff: target[i] = source[pos + i] + diff[i], sau mỗi record pos += diffLen + seek.
+// Các byte diff bằng 0 (vùng không đổi) chỉ tốn một varint nên patch nhỏ mà không cần nén.
+#define DELTA_PATCH_MAGIC "TBD1"
+#define DELTA_PATCH_HEADER_SIZE 16
+#ifndef DELTA_PATCH_BUFFER_SIZE
+#define DELTA_PATCH_BUFFER_SIZE 256
+#endif
+
+// Source image reader and target image writer used while applying a patch
+class DeltaTarget {
+public:
+    // Đọc image đang chạy (source)
+    virtual bool readSource(size_t offset, uint8_t* buffer, size_t length) = 0;
+    // Gọi một lần khi header đã được đọc, false để hủy
+    virtual bool beginTarget(uint32_t sourceSize, uint32_t sourceCrc, uint32_t targetSize) = 0;
+    // Ghi tuần tự image mới (target)
+    virtual bool writeTarget(uint8_t* data, size_t length) = 0;
+};
+
+// Streaming decoder for the patch format above: accepts the patch in chunks
+// of any size and produces the target image with a fixed amount of RAM,
+// reading the source image in small blocks.
+class DeltaPatch {
+private:
+    enum State : uint8_t {
+        STATE_HEADER,
+        STATE_DIFF_LENGTH,
+        STATE_EXTRA_LENGTH,
+        STATE_SEEK,
+        STATE_ZERO_RUN,
+        STATE_LITERAL_LENGTH,
+        STATE_LITERAL,
+        STATE_EXTRA,
+        STATE_DONE,
+        STATE_ERROR
+    };
+
+    DeltaTarget* target;
+    State state;
+    uint8_t header[DELTA_PATCH_HEADER_SIZE];
+    uint8_t headerLength;
+    uint32_t sourceSize;
+    uint32_t targetSize;
+    uint32_t produced;          // Số byte target đã tạo ra (kể cả đang trong buffer)
+    uint32_t sourcePos;
+    int32_t seek;
+    uint32_t diffRemaining;
+    uint32_t extraRemaining;
+    uint32_t literalRemaining;
+    uint32_t varint;
+    uint8_t varintShift;
+    uint8_t output[DELTA_PATCH_BUFFER_SIZE];
+    uint16_t outputLength;
+    uint8_t source[DELTA_PATCH_BUFFER_SIZE];
+    uint32_t sourceStart;
+    uint16_t sourceLength;
+
+    bool readVarint(uint8_t byte);
+    bool parseHeader();
+    bool emit(uint8_t byte);
+    bool flush();
+    bool sourceByte(uint8_t& byte);
+    bool copySource(uint32_t length);
+    State afterDiff();
+    State endRecord();
+
+public:
+    DeltaPatch();
+
+    // Nhận diện patch từ các byte đầu tiên của image
+    static bool isPatch(const uint8_t* data, size_t length);
+
+    void begin(DeltaTarget* target);
+    // Giải mã tiếp một đoạn patch, false nếu patch hỏng hoặc đọc/ghi thất bại
+    bool feed(const uint8_t* data, size_t length);
+    // Toàn bộ target đã được ghi
+    bool finished() const;
+    uint32_t getTargetSize() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DELTA_PATCH_H
@@ -0,0 +1,64 @@
+#ifdef ARDUINO
+
+#include "EspBootPlatform.h"
+#include <esp_attr.h>
+#include <esp_ota_ops.h>
+
+// Bộ đếm số lần khởi động, giữ nguyên qua các lần reset mềm, panic và watchdog
+RTC_NOINIT_ATTR static BootAttempts rtcBootAttempts;
+
+static EspBootPlatform bootPlatform;
+BootValidator bootValidator(bootPlatform, rtcBootAttempts);
+
+EspBootPlatform::EspBootPlatform(const char* nvsNamespace) : nvsNamespace(nvsNamespace) {
+}
+
+uint32_t EspBootPlatform::runningPartition() {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    return running != nullptr ? running->address : 0;
+}
+
+bool EspBootPlatform::setBootPartition(uint32_t address) {
+    const esp_partition_t* target = nullptr;
+    esp_partition_iterator_t it = esp_partition_find(ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_ANY, nullptr);
+    while (it != nullptr) {
+        const esp_partition_t* partition = esp_partition_get(it);
+        if (partition->address == address) {
+            target = partition;
+            break;
+        }
+        it = esp_partition_next(it);
+    }
+    esp_partition_iterator_release(it);
+    // esp_ota_set_boot_partition() kiểm tra image trước khi ghi otadata
+    return target != nullptr && esp_ota_set_boot_partition(target) == ESP_OK;
+}
+
+void EspBootPlatform::markValid() {
+    esp_ota_mark_app_valid_cancel_rollback();
+}
+
+void EspBootPlatform::restart() {
+    Serial.flush();
+    ESP.restart();
+}
+
+bool EspBootPlatform::loadRecord(BootRecord& record) {
+    if (!prefs.begin(nvsNamespace, true)) {
+        return false;
+    }
+    size_t length = prefs.getBytes("boot", &record, sizeof(record));
+    prefs.end();
+    return length == sizeof(record);
+}
+
+bool EspBootPlatform::saveRecord(const BootRecord& record) {
+    if (!prefs.begin(nvsNamespace, false)) {
+        return false;
+    }
+    bool ok = prefs.putBytes("boot", &record, sizeof(record)) == sizeof(record);
+    prefs.end();
+    return ok;
+}
+
+#endif // ARDUINO
@@ -0,0 +1,34 @@
+#ifndef ESP_BOOT_PLATFORM_H
+#define ESP_BOOT_PLATFORM_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "BootValidator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// BootPlatform on top of the ESP-IDF OTA partition API, the boot record is
+// stored in NVS next to the download checkpoint
+class EspBootPlatform : public BootPlatform {
+private:
+    Preferences prefs;
+    const char* nvsNamespace;
+
+public:
+    explicit EspBootPlatform(const char* nvsNamespace = "ota");
+
+    uint32_t runningPartition() override;
+    bool setBootPartition(uint32_t address) override;
+    void markValid() override;
+    void restart() override;
+    bool loadRecord(BootRecord& record) override;
+    bool saveRecord(const BootRecord& record) override;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ESP_BOOT_PLATFORM_H
@@ -0,0 +1,146 @@
+#include "HeatshrinkDecoder.h"
+
+HeatshrinkDecoder::HeatshrinkDecoder() {
+    begin(nullptr, nullptr);
+}
+
+bool HeatshrinkDecoder::isCompressed(const uint8_t* data, size_t length) {
+    return length >= 4 && memcmp(data, HEATSHRINK_MAGIC, 4) == 0;
+}
+
+void HeatshrinkDecoder::begin(HeatshrinkSink sink, void* context) {
+    this->sink = sink;
+    this->context = context;
+    state = STATE_HEADER;
+    headerLength = 0;
+    windowBits = 0;
+    lookaheadBits = 0;
+    outputSize = 0;
+    produced = 0;
+    bits = 0;
+    bitCount = 0;
+    index = 0;
+    head = 0;
+    outputLength = 0;
+    memset(window, 0, sizeof(window));
+}
+
+bool HeatshrinkDecoder::parseHeader() {
+    if (!isCompressed(header, sizeof(header))) {
+        return false;
+    }
+    windowBits = header[4];
+    lookaheadBits = header[5];
+    outputSize = (uint32_t)header[8] | ((uint32_t)header[9] << 8) | ((uint32_t)header[10] << 16) | ((uint32_t)header[11] << 24);
+    // Giống heatshrink: 4 <= W <= 15, 3 <= L < W; W còn bị giới hạn bởi window của thiết bị
+    return windowBits >= 4 && windowBits <= HEATSHRINK_MAX_WINDOW_BITS &&
+           lookaheadBits >= 3 && lookaheadBits < windowBits;
+}
+
+bool HeatshrinkDecoder::flush() {
+    if (outputLength == 0) {
+        return true;
+    }
+    bool ok = sink(context, output, outputLength);
+    outputLength = 0;
+    return ok;
+}
+
+bool HeatshrinkDecoder::emit(uint8_t byte) {
+    if (produced >= outputSize) {
+        return false;
+    }
+    window[head] = byte;
+    head = (head + 1) & ((1 << windowBits) - 1);
+    output[outputLength++] = byte;
+    produced++;
+    return outputLength < sizeof(output) || flush();
+}
+
+// Giải mã các phần tử đã có đủ bit trong bộ đệm bit
+bool HeatshrinkDecoder::decodeBits() {
+    for (;;) {
+        uint8_t needed = state == STATE_TAG ? 1 : state == STATE_LITERAL ? 8 :
+                         state == STATE_INDEX ? windowBits : lookaheadBits;
+        if (state == STATE_DONE || bitCount < needed) {
+            return true;
+        }
+        bitCount -= needed;
+        uint16_t value = (bits >> bitCount) & ((1u << needed) - 1);
+
+        switch (state) {
+            case STATE_TAG:
+                state = value ? STATE_LITERAL : STATE_INDEX;
+                break;
+
+            case STATE_LITERAL:
+                if (!emit((uint8_t)value)) {
+                    return false;
+                }
+                state = STATE_TAG;
+                break;
+
+            case STATE_INDEX:
+                index = value;
+                state = STATE_COUNT;
+                break;
+
+            case STATE_COUNT: {
+                uint16_t mask = (1 << windowBits) - 1;
+                uint16_t from = (head - index - 1) & mask;
+                for (uint16_t i = 0; i <= value; i++) {
+                    if (!emit(window[(from + i) & mask])) {
+                        return false;
+                    }
+                }
+                state = STATE_TAG;
+                break;
+            }
+
+            default:
+                return false;
+        }
+
+        // Các bit còn lại của byte cuối là bit đệm
+        if (produced == outputSize) {
+            state = STATE_DONE;
+            return flush();
+        }
+    }
+}
+
+bool HeatshrinkDecoder::feed(const uint8_t* data, size_t length) {
+    for (size_t i = 0; i < length && state != STATE_ERROR; i++) {
+        if (state == STATE_HEADER) {
+            header[headerLength++] = data[i];
+            if (headerLength == sizeof(header)) {
+                if (!parseHeader() || sink == nullptr) {
+                    state = STATE_ERROR;
+                } else {
+                    state = outputSize > 0 ? STATE_TAG : STATE_DONE;
+                }
+            }
+            continue;
+        }
+        if (state == STATE_DONE) {
+            // Dữ liệu thừa sau khi đã giải nén đủ
+            state = STATE_ERROR;
+            break;
+        }
+
+        bits = (bits << 8) | data[i];
+        bitCount += 8;
+        if (!decodeBits()) {
+            state = STATE_ERROR;
+        }
+    }
+    return state != STATE_ERROR;
+}
+
+bool HeatshrinkDecoder::finished() const {
+    return state == STATE_DONE;
+}
+
+uint32_t HeatshrinkDecoder::getOutputSize() const {
+    return outputSize;
+}
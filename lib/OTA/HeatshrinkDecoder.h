@@ -0,0 +1,83 @@
+#ifndef HEATSHRINK_DECODER_H
+#define HEATSHRINK_DECODER_H
+
+#include <Arduino.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Image nén, được tạo bởi tools/ota_compress.py:
+//   header: "TBZ1", window bits, lookahead bits, 2 byte dự phòng, kích thước sau giải nén (uint32 little endian)
+//   dữ liệu: luồng bit heatshrink (LZSS), bit cao trước
+//     1 + 8 bit              : literal
+//     0 + W bit + L bit      : sao chép (giá trị + 1) byte từ (giá trị + 1) byte phía trước
+#define HEATSHRINK_MAGIC "TBZ1"
+#define HEATSHRINK_HEADER_SIZE 12
+// Window lớn nhất được hỗ trợ, quyết định RAM của bộ giải nén (2^bits byte)
+#ifndef HEATSHRINK_MAX_WINDOW_BITS
+#define HEATSHRINK_MAX_WINDOW_BITS 11
+#endif
+#ifndef HEATSHRINK_OUTPUT_SIZE
+#define HEATSHRINK_OUTPUT_SIZE 256
+#endif
+
+// Nhận dữ liệu đã giải nén theo từng khối
+typedef bool (*HeatshrinkSink)(void* context, uint8_t* data, size_t length);
+
+// Streaming heatshrink decoder: accepts the compressed stream in chunks of
+// any size and passes the output on in small blocks, using only the
+// window buffer as history so the whole image never has to be in RAM.
+class HeatshrinkDecoder {
+private:
+    enum State : uint8_t {
+        STATE_HEADER,
+        STATE_TAG,
+        STATE_LITERAL,
+        STATE_INDEX,
+        STATE_COUNT,
+        STATE_DONE,
+        STATE_ERROR
+    };
+
+    HeatshrinkSink sink;
+    void* context;
+    State state;
+    uint8_t header[HEATSHRINK_HEADER_SIZE];
+    uint8_t headerLength;
+    uint8_t windowBits;
+    uint8_t lookaheadBits;
+    uint32_t outputSize;
+    uint32_t produced;
+    uint32_t bits;              // Các bit chưa dùng, bit cao nhất được đọc trước
+    uint8_t bitCount;
+    uint16_t index;
+    uint16_t head;              // Vị trí ghi kế tiếp trong window
+    uint8_t window[1 << HEATSHRINK_MAX_WINDOW_BITS];
+    uint8_t output[HEATSHRINK_OUTPUT_SIZE];
+    uint16_t outputLength;
+
+    bool parseHeader();
+    bool emit(uint8_t byte);
+    bool flush();
+    bool decodeBits();
+
+public:
+    HeatshrinkDecoder();
+
+    static bool isCompressed(const uint8_t* data, size_t length);
+
+    void begin(HeatshrinkSink sink, void* context);
+    // Giải nén tiếp một đoạn dữ liệu, false nếu dữ liệu hỏng hoặc sink báo lỗi
+    bool feed(const uint8_t* data, size_t length);
+    // Đã tạo đủ số byte ghi trong header
+    bool finished() const;
+    // Kích thước sau giải nén, hợp lệ sau khi header đã được đọc
+    uint32_t getOutputSize() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HEATSHRINK_DECODER_H
@@ -1,4 +1,18 @@
+#ifdef ARDUINO
+
 #include "OTA.h"
+#include "OtaWindow.h"
+#include "OtaChunkSizer.h"
+#include "OtaCheckpoint.h"
+#include "OtaImage.h"
+#include "OtaMetrics.h"
+#include "OtaHttp.h"
+#include "BootValidator.h"
+#include <config.hpp>
+#include <DeviceManager.hpp>
+#include <HashGenerator.h>
+#include <Partition_Updater.h>
+#include <Buffered_Updater.h>
 #include <vector>
 
 // Biến OTA toàn cục
@@ -10,180 +24,365 @@ byte* firmware_data = nullptr;
 
 // Timeout cho OTA
 unsigned long lastRequestTime = 0;
-const unsigned long OTA_REQUEST_TIMEOUT = 60000; // 60 giây
+const unsigned long OTA_REQUEST_TIMEOUT = 10000; // Timeout của mỗi chunk, 10 giây
+const unsigned long OTA_IDLE_WAIT = 1000; // Thời gian ngủ tối đa khi không có OTA
 
-// Thiết bị duy nhất với token cố định
-Alldevice device;
-WiFiClient wifiClient;
-PubSubClient mqttClient(wifiClient);
-const char* DEVICE_TOKEN = "EcmicQgZr1doHCGY5tb2";
-bool deviceConnected = false;
+// Task OTA, được đánh thức khi chunk vừa được ghi xong
+static TaskHandle_t otaTaskHandle = nullptr;
 
 // Biến toàn cục cho firmware request ID
 static int currentFirmwareRequestId = 0;
+static uint32_t requestGeneration = 0;  // otaWindow.getGeneration() của các request đang dùng currentFirmwareRequestId
+
+// Các chunk đang được tải song song
+static OtaWindow otaWindow;
+// Kích thước chunk được điều chỉnh theo thời gian phản hồi và số request thất bại
+static OtaChunkSizer otaChunkSizer;
+// Checksum được tính dần theo từng chunk đã ghi, không cần đọc lại flash khi kết thúc
+static HashGenerator otaHash;
+// Ghi thẳng vào partition OTA để có thể tiếp tục ghi từ giữa image sau khi khởi động lại
+static Partition_Updater otaUpdater;
+// Flash được ghi trên task riêng với hai buffer luân phiên: handler MQTT chỉ sao chép
+// dữ liệu, không bị chặn hàng chục ms mỗi lần xóa sector
+static Buffered_Updater otaWriter(otaUpdater, OTA_FLASH_BUFFER_SIZE);
+// Tiến độ tải được lưu trong NVS
+static OtaCheckpoint otaCheckpoint;
+// Image đầy đủ hoặc delta patch áp dụng lên firmware đang chạy
+static OtaImage otaImage(otaUpdater, otaWriter);
+// Độ trễ, thông lượng và ETA của lần tải hiện tại, gửi lên dưới dạng telemetry
+static OtaMetrics otaMetrics;
+
+#if OTA_USE_HTTP
+#ifndef OTA_HTTP_PORT
+#define OTA_HTTP_PORT (MQTT_USE_TLS ? 443 : 80)
+#endif
+// Kết nối HTTP riêng, phiên MQTT vẫn hoạt động trong lúc tải
+static WiFiClient otaHttpSocket;
+#if MQTT_USE_TLS
+static TlsClient otaHttpTls(otaHttpSocket);
+static OtaHttpDownloader otaHttp(otaHttpTls, THINGSBOARD_SERVER, OTA_HTTP_PORT);
+#else
+static OtaHttpDownloader otaHttp(otaHttpSocket, THINGSBOARD_SERVER, OTA_HTTP_PORT);
+#endif
+// startOtaProcess() chạy trong handler MQTT, việc tải được giao cho task OTA
+static volatile bool otaHttpPending = false;
+static volatile bool otaHttpRunning = false;
+static uint32_t otaHttpOffset = 0;
+#endif
+
+// Bảng giải mã Base64: giá trị 6 bit của mỗi ký tự, 0xFF cho ký tự không thuộc bảng chữ cái
+#define B64_INVALID 0xFF
+#define B64_ROW(c) B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, \
+                   B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID
+static const uint8_t B64_TABLE[256] = {
+    B64_ROW(0x00), B64_ROW(0x10),
+    B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID,
+    B64_INVALID, B64_INVALID, B64_INVALID, 62, B64_INVALID, B64_INVALID, B64_INVALID, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID,
+    B64_INVALID, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID,
+    B64_INVALID, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID, B64_INVALID,
+    B64_ROW(0x80), B64_ROW(0x90), B64_ROW(0xA0), B64_ROW(0xB0),
+    B64_ROW(0xC0), B64_ROW(0xD0), B64_ROW(0xE0), B64_ROW(0xF0)
+};
 
 // Hàm giải mã Base64
 int b64decode(char c) {
-    if (c >= 'A' && c <= 'Z') return c - 'A';
-    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
-    if (c >= '0' && c <= '9') return c - '0' + 52;
-    if (c == '+') return 62;
-    if (c == '/') return 63;
-    return -1;
+    uint8_t value = B64_TABLE[(uint8_t)c];
+    return value == B64_INVALID ? -1 : value;
 }
 
 size_t decode_base64(const char *input, uint8_t *output, size_t output_len) {
-    size_t i = 0;
-    int buffer = 0, bits = 0;
-    while (*input && output_len) {
-        int val = b64decode(*input++);
-        if (val < 0) continue;
-        buffer = (buffer << 6) | val;
-        bits += 6;
-        if (bits >= 8) {
-            bits -= 8;
-            *output++ = (buffer >> bits) & 0xFF;
-            output_len--;
-            i++;
+    const uint8_t* in = (const uint8_t*)input;
+    uint8_t* out = output;
+    uint8_t* end = output + output_len;
+    uint32_t buffer = 0;
+    int bits = 0;
+
+    for (;;) {
+        // Đường nhanh: 4 ký tự hợp lệ -> 3 byte
+        while (end - out >= 3) {
+            uint32_t a = B64_TABLE[in[0]];
+            if (a == B64_INVALID) break;
+            uint32_t b = B64_TABLE[in[1]];
+            if (b == B64_INVALID) break;
+            uint32_t c = B64_TABLE[in[2]];
+            if (c == B64_INVALID) break;
+            uint32_t d = B64_TABLE[in[3]];
+            if (d == B64_INVALID) break;
+            uint32_t value = (a << 18) | (b << 12) | (c << 6) | d;
+            out[0] = value >> 16;
+            out[1] = value >> 8;
+            out[2] = value;
+            out += 3;
+            in += 4;
+        }
+
+        // Hết chuỗi, padding hoặc ký tự lạ (xuống dòng...): từng ký tự, bỏ qua ký tự
+        // không thuộc bảng chữ cái, quay lại đường nhanh khi về ranh giới 4 ký tự
+        while (*in && out < end) {
+            uint8_t value = B64_TABLE[*in++];
+            if (value == B64_INVALID) continue;
+            buffer = (buffer << 6) | value;
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                *out++ = (buffer >> bits) & 0xFF;
+            }
+            if (bits == 0) break;
+        }
+        if (!*in || out >= end) {
+            return out - output;
         }
     }
-    return i;
 }
 
-// Hàm callback MQTT
-void deviceCallback(char* topic, byte* payload, unsigned int length) {
-    Serial.printf("MQTT callback -> Topic: %s, Length: %d\n", topic, length);
-    
-    // Log payload content for debugging (first 64 bytes max)
-    Serial.print("Payload: ");
-    for (unsigned int i = 0; i < min(length, (unsigned int)64); i++) {
-        Serial.print((char)payload[i]);
+// Đọc thông tin firmware từ shared attributes và bắt đầu OTA
+static void applyFirmwareAttributes(JsonObject attributes) {
+    // Kết nối lại trong lúc đang tải: tiếp tục lần tải hiện tại thay vì bắt đầu lại
+    if (otaInProgress && attributes["fw_title"].as<String>() == fw_title &&
+        attributes["fw_version"].as<String>() == fw_version &&
+        attributes["fw_checksum"].as<String>() == fw_checksum) {
+        Serial.println("OTA already in progress for this firmware, continuing");
+        return;
     }
-    Serial.println();
+#if OTA_USE_HTTP
+    // Firmware khác trong lúc đang tải qua HTTP: dừng lần tải, thông tin firmware
+    // được yêu cầu lại khi task OTA đã dừng hẳn
+    if (otaHttpRunning) {
+        Serial.println("New firmware announced, cancelling HTTP download");
+        otaHttp.cancel();
+        return;
+    }
+#endif
 
-    // Chuyển đổi payload thành JSON nếu định dạng phù hợp
-    char payloadStr[length + 1];
-    memcpy(payloadStr, payload, length);
-    payloadStr[length] = '\0';
+    fw_title = attributes["fw_title"].as<String>();
+    fw_version = attributes["fw_version"].as<String>();
+    fw_checksum = attributes["fw_checksum"].as<String>();
+    fw_algo = attributes.containsKey("fw_checksum_algorithm") ? 
+              attributes["fw_checksum_algorithm"].as<String>() : "sha256";
+    fw_size = attributes["fw_size"];
+    chunk_size = attributes.containsKey("fw_chunk_size") ? attributes["fw_chunk_size"].as<int>() : 0;
 
-    DynamicJsonDocument doc(2048);
-    DeserializationError error = deserializeJson(doc, payloadStr);
-    if (error && strncmp(topic, "v2/fw/response", 14) != 0) {  // Skip JSON parsing for binary chunk data
+    // Đặt kích thước chunk mặc định nếu không được cung cấp hoặc không hợp lệ,
+    // chunk phải vừa buffer của phiên MQTT dùng chung
+    if (chunk_size <= 0 || chunk_size > OTA_MAX_CHUNK_SIZE) {
+        chunk_size = OTA_MAX_CHUNK_SIZE;
+    }
+    // OtaChunkSizer chỉ chuyển giữa các kích thước OTA_MAX_CHUNK_SIZE / 2^n
+    chunk_size = OtaChunkSizer::roundSize(OTA_MAX_CHUNK_SIZE, chunk_size);
+
+    Serial.printf("Detected firmware: %s v%s (size: %d bytes, chunk_size: %d)\n", 
+                fw_title.c_str(), fw_version.c_str(), fw_size, chunk_size);
+
+    // Partition của image cũ là nơi image mới được ghi: chờ image đang chạy được xác nhận
+    if (bootValidator.getState() == BOOT_PENDING) {
+        Serial.println("Running firmware is not confirmed yet, postponing OTA");
+        return;
+    }
+    if (bootValidator.isInstalled(fw_title, fw_version)) {
+        Serial.println("Firmware already installed");
+        return;
+    }
+    if (bootValidator.isRejected(fw_title, fw_version)) {
+        Serial.println("Firmware was rolled back after a failed boot, ignoring");
+        return;
+    }
+
+    // Reset các biến trạng thái và bắt đầu OTA
+    startOtaProcess();
+}
+
+static bool parseAttributes(const MqttMessage& message, DynamicJsonDocument& doc) {
+    DeserializationError error = deserializeJson(doc, message.payload, message.length);
+    if (error) {
         Serial.print("deserializeJson() failed: ");
         Serial.println(error.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Handler cho thông báo v1/devices/me/attributes
+void otaAttributesHandler(const MqttMessage& message) {
+    DynamicJsonDocument doc(2048);
+    if (parseAttributes(message, doc) && doc.containsKey("fw_title")) {
+        applyFirmwareAttributes(doc.as<JsonObject>());
+    }
+}
+
+// Handler cho response của attributes request v1/devices/me/attributes/response/+
+static void otaAttributeResponseHandler(const MqttMessage& message) {
+    DynamicJsonDocument doc(2048);
+    if (!parseAttributes(message, doc)) {
         return;
     }
-    
-    String topicStr = String(topic);
-    // Kiểm tra nếu có thông tin firmware từ response của attributes request
-    if (topicStr.indexOf("attributes/response") >= 0) {
-        Serial.println("Received attribute response");
-        if (doc.containsKey("shared")) {
-            JsonObject shared = doc["shared"];
-            Serial.print("Shared attributes: ");
-            serializeJson(shared, Serial);
-            Serial.println();
-            
-            if (shared.containsKey("fw_title") && shared.containsKey("fw_version")) {
-                fw_title = shared["fw_title"].as<String>();
-                fw_version = shared["fw_version"].as<String>();
-                fw_checksum = shared["fw_checksum"].as<String>();
-                fw_algo = shared.containsKey("fw_checksum_algorithm") ? 
-                          shared["fw_checksum_algorithm"].as<String>() : "sha256";
-                fw_size = shared["fw_size"];
-                chunk_size = shared.containsKey("fw_chunk_size") ? shared["fw_chunk_size"].as<int>() : 0;
-                
-                // Đặt kích thước chunk mặc định nếu không được cung cấp hoặc không hợp lệ
-                if (chunk_size <= 0) {
-                    chunk_size = 8192;  // Kích thước chunk mặc định
-                }
-                
-                Serial.printf("Detected firmware from attributes response: %s v%s (size: %d bytes, chunk_size: %d)\n", 
-                            fw_title.c_str(), fw_version.c_str(), fw_size, chunk_size);
-                
-                // Reset các biến trạng thái và bắt đầu OTA
-                startOtaProcess();
-            } else {
-                Serial.println("No firmware info in shared attributes");
-            }
-        } else {
-            Serial.println("No shared attributes in response");
-        }
+    JsonObject shared = doc["shared"];
+    if (!shared.isNull() && shared.containsKey("fw_title") && shared.containsKey("fw_version")) {
+        Serial.println("Received firmware info in attribute response");
+        applyFirmwareAttributes(shared);
     }
-    // Xử lý thông tin firmware từ thông báo attributes
-    else if (topicStr.indexOf("attributes") >= 0) {
-        if (doc.containsKey("fw_title")) {
-            fw_title = doc["fw_title"].as<String>();
-            fw_version = doc["fw_version"].as<String>();
-            fw_checksum = doc["fw_checksum"].as<String>();
-            fw_algo = doc.containsKey("fw_checksum_algorithm") ? 
-                      doc["fw_checksum_algorithm"].as<String>() : "sha256";
-            fw_size = doc["fw_size"];
-            chunk_size = doc.containsKey("fw_chunk_size") ? doc["fw_chunk_size"].as<int>() : 0;
-            
-            // Đặt kích thước chunk mặc định nếu không được cung cấp hoặc không hợp lệ
-            if (chunk_size <= 0) {
-                chunk_size = 4096;  // Kích thước chunk mặc định
-            }
-            
-            // Bắt đầu quá trình OTA
-            startOtaProcess();
-        }
+}
+
+// Ghi tuần tự dữ liệu firmware vào flash, được gọi bởi otaWindow
+static bool writeFirmware(uint8_t* data, size_t length) {
+    uint32_t started = micros();
+    // fw_checksum là checksum của gói được tải (image hoặc patch), không phải image sau khi áp patch
+    if (!otaHash.update(data, length)) {
+        return false;
     }
-    // Xử lý dữ liệu chunk firmware
-    else if (topicStr.indexOf("v2/fw/response") >= 0 && otaInProgress) {
-        Serial.println("Received firmware chunk response");
-        Serial.printf("Topic: %s, Length: %d bytes\n", topic, length);
-        
-        // Kiểm tra xem Update đã được khởi tạo chưa
-        if (!Update.isRunning()) {
-            Serial.println("Update is not initialized! Initializing now...");            if (!Update.begin(fw_size, U_FLASH)) {
-                Serial.println("Failed to begin OTA: " + String(Update.errorString()));
-                mqttClient.publish("v1/devices/me/attributes", 
-                    "{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to initialize update\"}");
-                otaInProgress = false;
-                return;
-            }
-            Serial.println("OTA update initialized successfully");
-        }
-        
-        // Ghi dữ liệu firmware vào flash
-        if (Update.write(payload, length) != length) {
-            Serial.printf("Update write failed: %s\n", Update.errorString());
-            mqttClient.publish("v1/devices/me/attributes", 
-                "{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to write firmware chunk\"}");
-            otaInProgress = false;
-            Update.abort();
-            return;
-        }
+    if (!otaImage.write(data, length)) {
+        Serial.printf("Firmware write failed at offset %u\n", (unsigned)otaUpdater.get_offset());
+        return false;
+    }
+    otaMetrics.onWrite(micros() - started);
+    return true;
+}
 
-        offset += length;
-        chunks_received++;
-        Serial.printf("Chunk %d received. Total offset: %d/%d (%.1f%%)\n", 
-            chunks_received, offset, fw_size, (float)offset * 100 / fw_size);
-
-        waitingForChunk = false;
-        lastRequestTime = 0;
-        
-        // Kiểm tra nếu đã nhận đủ dữ liệu firmware
-        if (offset >= fw_size) {
-            Serial.println("All chunks received, finalizing update...");
-            mqttClient.publish("v1/devices/me/attributes", "{\"fw_state\":\"DOWNLOADED\"}");
-            
-            // Hoàn thành quá trình update
-            if (Update.end(true)) {
-                Serial.println("OTA Update Success! Rebooting...");
-                mqttClient.publish("v1/devices/me/attributes", "{\"fw_state\":\"UPDATED\"}");
-                vTaskDelay(pdMS_TO_TICKS(2000));
-                ESP.restart();
-            } else {
-                Serial.printf("Update end failed: %s\n", Update.errorString());
-                mqttClient.publish("v1/devices/me/attributes", 
-                    "{\"fw_state\":\"FAILED\",\"fw_error\":\"Firmware verification failed\"}");
-                otaInProgress = false;
-            }
+// Gửi telemetry tiến độ OTA, tối đa một lần mỗi OTA_METRICS_INTERVAL trừ khi force
+static void publishOtaMetrics(bool force = false) {
+    otaMetrics.onFlashStats(otaWriter.get_flash_bytes(), otaWriter.get_flash_time_ms(),
+                            otaWriter.get_stalls(), otaWriter.get_stall_time_ms());
+    char payload[448];
+    if (otaMetrics.report(millis(), payload, sizeof(payload), force)) {
+        mqttSession.publish("v1/devices/me/telemetry", payload);
+    }
+}
+
+// Thuật toán checksum ThingsBoard gửi trong fw_checksum_algorithm
+static bool checksumType(const String& algorithm, mbedtls_md_type_t& type) {
+    if (algorithm.equalsIgnoreCase("SHA256")) {
+        type = MBEDTLS_MD_SHA256;
+    } else if (algorithm.equalsIgnoreCase("MD5")) {
+        type = MBEDTLS_MD_MD5;
+    } else if (algorithm.equalsIgnoreCase("CRC32")) {
+        type = MD_TYPE_CRC32;
+    } else if (algorithm.equalsIgnoreCase("SHA384")) {
+        type = MBEDTLS_MD_SHA384;
+    } else if (algorithm.equalsIgnoreCase("SHA512")) {
+        type = MBEDTLS_MD_SHA512;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Tính lại hash của phần image đã ghi trước khi bị gián đoạn, đọc lại từ partition
+static bool rehashWritten(size_t length) {
+    uint8_t buffer[512];
+    for (size_t position = 0; position < length; position += sizeof(buffer)) {
+        size_t block = min(sizeof(buffer), length - position);
+        if (otaUpdater.read(position, buffer, block) != block || !otaHash.update(buffer, block)) {
+            return false;
         }
     }
+    return true;
+}
+
+// Lỗi không phải do mất kết nối: bỏ checkpoint, lần sau tải lại từ đầu
+static void failOta(const char* payload) {
+    mqttSession.publish("v1/devices/me/attributes", payload);
+    publishOtaMetrics(true);
+    otaMetrics.end();
+    otaInProgress = false;
+    waitingForChunk = false;
+    otaWindow.end();
+    otaWriter.reset();
+    otaCheckpoint.clear();
+}
+
+// Kiểm tra checksum và đánh dấu partition mới để boot
+static void finishOta() {
+    Serial.println("All chunks received, verifying checksum...");
+    otaWindow.end();
+    mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"DOWNLOADED\"}");
+
+    // Chờ task ghi flash ghi hết các buffer còn lại
+    bool flushed = otaWriter.flush();
+    uint32_t flashMs = max(otaWriter.get_flash_time_ms(), (uint32_t)1);
+    Serial.printf("Flash writer: %u bytes in %lu ms (%lu B/s), %lu stalls (%lu ms waiting)\n",
+                  (unsigned)otaWriter.get_flash_bytes(), (unsigned long)flashMs,
+                  (unsigned long)((uint64_t)otaWriter.get_flash_bytes() * 1000 / flashMs),
+                  (unsigned long)otaWriter.get_stalls(), (unsigned long)otaWriter.get_stall_time_ms());
+    publishOtaMetrics(true);
+    otaMetrics.end();
+
+    // Kiểm tra checksum trước khi kết thúc, image sai không bao giờ được đánh dấu để boot
+    if (!flushed || !otaImage.finished()) {
+        failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Incomplete firmware image\"}");
+        return;
+    }
+    String calculated = otaHash.get_hash_string().c_str();
+    Serial.printf("Checksum %s: expected %s, calculated %s\n", fw_algo.c_str(), fw_checksum.c_str(), calculated.c_str());
+    if (!fw_checksum.equalsIgnoreCase(calculated)) {
+        failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Checksum verification failed\"}");
+        return;
+    }
+    mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"VERIFIED\"}");
+
+    // Hoàn thành quá trình update, image mới chỉ được xác nhận (UPDATED) sau khi
+    // khởi động và vượt qua các health probe, nếu không sẽ quay lại image này
+    uint32_t target = otaUpdater.get_partition_address();
+    if (otaWriter.end()) {
+        Serial.println("OTA Update Success! Rebooting...");
+        otaCheckpoint.clear();
+        bootValidator.markPending(target, fw_title, fw_version);
+        mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"UPDATING\"}");
+        vTaskDelay(pdMS_TO_TICKS(2000));
+        ESP.restart();
+    } else {
+        Serial.println("Update end failed: image verification failed");
+        failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Firmware verification failed\"}");
+    }
+}
+
+// Handler cho chunk firmware v2/fw/response/{requestId}/chunk/{index}
+void otaChunkHandler(const MqttMessage& message) {
+    uint32_t requestId = message.route.value(0);
+    uint32_t index = message.route.value(1);
+    // Bỏ qua response của lần OTA trước và của kích thước chunk trước
+    if (!otaInProgress || requestId != (uint32_t)currentFirmwareRequestId) {
+        return;
+    }
+
+    OtaChunkResult result = otaWindow.onChunk(index, message.payload, message.length);
+    if (result == OTA_CHUNK_WRITE_FAILED) {
+        failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to write firmware chunk\"}");
+        return;
+    }
+    if (result == OTA_CHUNK_IGNORED) {
+        return;
+    }
+
+    if (result != OTA_CHUNK_RETRY) {
+        otaChunkSizer.onSuccess(message.length, millis());
+        otaMetrics.onResponse(index, millis());
+    }
+
+    offset = otaWindow.writtenBytes();
+    otaMetrics.onProgress(offset);
+    chunks_received = otaWindow.writtenChunks();
+    chunk_size = otaWindow.getChunkSize();
+    // Patch và image nén được giải mã theo luồng, không thể tiếp tục từ giữa.
+    // Checkpoint chỉ tính phần task ghi flash đã thực sự ghi xong
+    if (result == OTA_CHUNK_WRITTEN && otaImage.resumable()) {
+        otaCheckpoint.update(otaUpdater.get_offset() / chunk_size, chunk_size);
+    }
+    waitingForChunk = otaWindow.inFlight() > 0;
+    Serial.printf("Chunk %lu %s. Total offset: %d/%d (%.1f%%)\n", (unsigned long)index,
+        result == OTA_CHUNK_BUFFERED ? "buffered" : result == OTA_CHUNK_RETRY ? "invalid, retrying" : "written",
+        offset, fw_size, (float)offset * 100 / fw_size);
+
+    // Cửa sổ có chỗ trống: đánh thức task OTA để yêu cầu chunk kế tiếp
+    if (otaTaskHandle != nullptr) {
+        xTaskNotifyGive(otaTaskHandle);
+    }
+
+    // Kiểm tra nếu đã nhận đủ dữ liệu firmware
+    if (otaWindow.complete()) {
+        finishOta();
+    }
 }
 
 // Bắt đầu quá trình OTA
@@ -196,157 +395,300 @@ void startOtaProcess() {
     if (fw_size > 0 && ESP.getFreeSketchSpace() < fw_size) {
         Serial.printf("Not enough space for firmware update. Need %d bytes, available %d bytes\n", 
                     fw_size, ESP.getFreeSketchSpace());
-        mqttClient.publish("v1/devices/me/attributes", 
+        mqttSession.publish("v1/devices/me/attributes", 
                     "{\"fw_state\":\"FAILED\",\"fw_error\":\"Not enough space\"}");
         return;
     }
 
+    // Không hỗ trợ thuật toán hoặc thiếu checksum: từ chối ngay, không tải image
+    mbedtls_md_type_t hashType;
+    if (!checksumType(fw_algo, hashType) || fw_checksum.isEmpty()) {
+        Serial.printf("Unsupported checksum: %s\n", fw_algo.c_str());
+        mqttSession.publish("v1/devices/me/attributes", 
+                    "{\"fw_state\":\"FAILED\",\"fw_error\":\"Unsupported checksum algorithm\"}");
+        return;
+    }
+
     currentFirmwareRequestId++;  // Tăng ID cho OTA mới
-    Serial.printf("Starting OTA: %s v%s (size: %d bytes, chunk_size: %d)\n", 
-                fw_title.c_str(), fw_version.c_str(), fw_size, chunk_size);
-    
+    otaInProgress = false;
+    otaWindow.end();
+    otaWriter.reset();
+    mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"INITIATED\"}");
+
+    // Tiếp tục lần tải bị gián đoạn nếu checkpoint thuộc về đúng firmware này
+    uint32_t firstChunk = 0;
+    size_t resumeOffset = 0;
+    // Kích thước chunk được tăng/giảm trong giới hạn của buffer MQTT, không bị giới hạn bởi fw_chunk_size
+    uint16_t maxChunkSize = OTA_MAX_CHUNK_SIZE;
+    otaHash.start(hashType);
+    if (otaCheckpoint.load() && otaUpdater.begin(fw_size) &&
+        otaCheckpoint.matches(fw_title, fw_version, fw_algo, fw_checksum, fw_size, otaUpdater.get_partition_address())) {
+        uint16_t savedChunkSize = otaCheckpoint.getChunkSize();
+        resumeOffset = min((size_t)otaCheckpoint.getChunks() * savedChunkSize, (size_t)fw_size);
+        if (otaUpdater.resume(fw_size, resumeOffset) && rehashWritten(resumeOffset)) {
+            // Chỉ số chunk phụ thuộc kích thước chunk, giữ kích thước của lần tải trước
+            chunk_size = savedChunkSize;
+            maxChunkSize = max(maxChunkSize, savedChunkSize);
+            firstChunk = otaCheckpoint.getChunks();
+            Serial.printf("Resuming OTA at chunk %lu (%u bytes)\n", (unsigned long)firstChunk, (unsigned)resumeOffset);
+        } else {
+            resumeOffset = 0;
+            otaHash.start(hashType);
+        }
+    }
+
+    if (firstChunk == 0) {
+        Serial.printf("Starting OTA: %s v%s (size: %d bytes, chunk_size: %d)\n", 
+                    fw_title.c_str(), fw_version.c_str(), fw_size, chunk_size);
+        if (!otaUpdater.begin(fw_size) ||
+            !otaCheckpoint.begin(fw_title, fw_version, fw_algo, fw_checksum, fw_size, chunk_size, otaUpdater.get_partition_address())) {
+            Serial.println("Failed to begin OTA");
+            failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to initialize update\"}");
+            return;
+        }
+    }
+    otaImage.begin(fw_size, firstChunk > 0 ? OTA_IMAGE_RAW : OTA_IMAGE_UNKNOWN);
+    otaMetrics.begin(fw_size, resumeOffset, millis());
+#if OTA_USE_HTTP
     otaInProgress = true;
-    
-    // Đảm bảo Update không đang chạy từ lần OTA trước
-    if (Update.isRunning()) {
-        Update.abort();
+    otaHttpOffset = resumeOffset;
+    offset = resumeOffset;
+    Serial.println("OTA update initialized successfully, downloading over HTTP");
+    mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"DOWNLOADING\"}");
+    if (resumeOffset >= (size_t)fw_size) {
+        finishOta();
+        return;
     }
-    
-    mqttClient.publish("v1/devices/me/attributes", "{\"fw_state\":\"INITIATED\"}");
+    otaHttpPending = true;
+    if (otaTaskHandle != nullptr) {
+        xTaskNotifyGive(otaTaskHandle);
+    }
+#else
+    otaChunkSizer.begin(maxChunkSize, chunk_size);
+    if (!otaWindow.begin(fw_size, chunk_size, OTA_WINDOW_SIZE, writeFirmware, firstChunk, maxChunkSize)) {
+        failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Invalid firmware size\"}");
+        return;
+    }
+    otaInProgress = true;
+    requestGeneration = otaWindow.getGeneration();
+    offset = otaWindow.writtenBytes();
+    chunks_received = otaWindow.writtenChunks();
+    waitingForChunk = false;
+    Serial.println("OTA update initialized successfully");
+    mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"DOWNLOADING\"}");
+
+    // Toàn bộ image đã được ghi trước khi bị gián đoạn
+    if (otaWindow.complete()) {
+        finishOta();
+        return;
+    }
+    if (otaTaskHandle != nullptr) {
+        xTaskNotifyGive(otaTaskHandle);
+    }
+#endif
 }
 
-// Khởi tạo thiết bị duy nhất
-void initializeDevice() {
-    device.name = "DHT_Device";
-    device.token = DEVICE_TOKEN;
-    device.wifiClient = &wifiClient;
-    device.mqttClient = &mqttClient;
-    device.connected = false;
-    device.callback = deviceCallback;
-    
-    mqttClient.setServer("app.coreiot.io", 1883);
-    mqttClient.setBufferSize(16384); // Tăng kích thước buffer cho chunk lớn hơn
-    mqttClient.setCallback(deviceCallback);
+#if OTA_USE_HTTP
+// Ghi một khối nhận qua HTTP, vị trí khối chia hết cho OTA_HTTP_BLOCK_SIZE
+static bool writeHttpFirmware(uint8_t* data, size_t length) {
+    if (!writeFirmware(data, length)) {
+        return false;
+    }
+    offset += length;
+    if (otaImage.resumable()) {
+        otaCheckpoint.update(otaUpdater.get_offset() / OTA_HTTP_BLOCK_SIZE, OTA_HTTP_BLOCK_SIZE);
+    }
+    otaMetrics.onProgress(offset);
+    publishOtaMetrics();
+    return true;
 }
 
-// Kết nối thiết bị với ThingsBoard
-bool connectDeviceToThingsBoard() {
-    String clientId = String(device.name) + "_Client";
-    if (!mqttClient.connected()) {
-        if (mqttClient.connect(clientId.c_str(), DEVICE_TOKEN, nullptr)) {
-            deviceConnected = true;
-            Serial.printf("Connected to ThingsBoard! Client ID: %s\n", clientId.c_str());
-            
-            // Đăng ký topics
-            mqttClient.subscribe("v1/devices/me/attributes");
-            Serial.println("Subscribed to: v1/devices/me/attributes");
-            
-            mqttClient.subscribe("v1/devices/me/attributes/response/+");
-            Serial.println("Subscribed to: v1/devices/me/attributes/response/+");
-            
-            mqttClient.subscribe("v2/fw/response/#");
-            Serial.println("Subscribed to: v2/fw/response/#");
-            
-            // Gửi yêu cầu kiểm tra firmware mới ngay sau khi kết nối
-            Serial.println("Requesting firmware info after connection...");
+// Tải firmware qua HTTP, chạy trên task OTA và không giữ khóa của phiên MQTT
+static void runHttpDownload() {
+    String path = String("/api/v1/") + deviceManager.getAccessToken() + "/firmware?title=" +
+                  URLEncoder.encode(fw_title) + "&version=" + URLEncoder.encode(fw_version);
+    Serial.printf("Downloading firmware over HTTP from byte %lu\n", (unsigned long)otaHttpOffset);
+
+    unsigned long started = millis();
+    OtaHttpResult result = otaHttp.download(path.c_str(), otaHttpOffset, fw_size, writeHttpFirmware);
+    unsigned long elapsed = max(millis() - started, 1UL);
+    Serial.printf("HTTP download: %lu bytes in %lu ms (%lu B/s), %lu requests\n",
+                  (unsigned long)otaHttp.getBytesReceived(), elapsed,
+                  (unsigned long)((uint64_t)otaHttp.getBytesReceived() * 1000 / elapsed),
+                  (unsigned long)otaHttp.getRequests());
+
+    mqttSession.lock();
+    otaHttpRunning = false;
+    switch (result) {
+        case OTA_HTTP_OK:
+            finishOta();
+            break;
+        case OTA_HTTP_WRITE_FAILED:
+            failOta("{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to write firmware chunk\"}");
+            break;
+        case OTA_HTTP_CANCELLED:
+            // Firmware mới đã được thông báo trong lúc tải
+            otaInProgress = false;
+            otaMetrics.end();
+            otaWriter.reset();
             requestFirmwareAttributes();
-            
-            return true;
-        } else {
-            Serial.printf("Failed, rc=%d\n", mqttClient.state());
-            return false;
-        }
+            break;
+        default:
+            // Giữ checkpoint: lần kiểm tra firmware kế tiếp tiếp tục từ phần đã ghi
+            otaInProgress = false;
+            publishOtaMetrics(true);
+            otaMetrics.end();
+            otaWriter.reset();
+            mqttSession.publish("v1/devices/me/attributes", "{\"fw_state\":\"FAILED\",\"fw_error\":\"Download failed\"}");
+            break;
+    }
+    mqttSession.unlock();
+}
+#endif
+
+// Báo firmware đang chạy và kết quả của lần cập nhật trước
+static void reportFirmwareState() {
+    String payload;
+    if (bootValidator.getState() == BOOT_ROLLED_BACK) {
+        payload = "{\"fw_state\":\"FAILED\",\"fw_error\":\"Rolled back: firmware failed the boot health check\"}";
+    } else if (bootValidator.isInstalled(bootValidator.getTitle(), bootValidator.getVersion())) {
+        payload = String("{\"current_fw_title\":\"") + bootValidator.getTitle() +
+                  "\",\"current_fw_version\":\"" + bootValidator.getVersion() + "\"";
+        payload += bootValidator.getState() == BOOT_CONFIRMED ? ",\"fw_state\":\"UPDATED\"}" : "}";
+    } else {
+        // Chưa từng cập nhật qua OTA hoặc image đang chờ xác nhận
+        return;
+    }
+    if (mqttSession.publish("v1/devices/me/attributes", payload.c_str()) && bootValidator.getState() == BOOT_ROLLED_BACK) {
+        bootValidator.acknowledge();
     }
-    return true;
+}
+
+// Chạy sau mỗi lần kết nối: báo trạng thái firmware rồi kiểm tra firmware mới
+static void onOtaConnected() {
+    bootValidator.report(BOOT_PROBE_MQTT);
+    reportFirmwareState();
+}
+
+// Đăng ký các topic OTA với phiên MQTT dùng chung, gọi trước khi các task khởi động
+void otaInit() {
+    mqttSession.subscribe("v1/devices/me/attributes", otaAttributesHandler);
+    mqttSession.subscribe("v1/devices/me/attributes/response/+", otaAttributeResponseHandler);
+    mqttSession.subscribe("v2/fw/response/+/chunk/+", otaChunkHandler);
+    // Topic dài nhất + header MQTT
+    mqttSession.requireBufferSize(OTA_MAX_CHUNK_SIZE + 64);
+    // Báo trạng thái firmware sau mỗi lần kết nối, thông tin firmware mới nằm trong attributes request chung của phiên
+    mqttSession.onConnect(onOtaConnected);
+    mqttSession.requestAttributesOnConnect(OTA_FIRMWARE_ATTRIBUTE_KEYS);
+#if OTA_USE_HTTP && MQTT_USE_TLS
+    if (mqttRootCA != nullptr) {
+        otaHttpTls.setCACert(mqttRootCA);
+    } else {
+        otaHttpTls.setInsecure();
+    }
+#endif
 }
 
 // Yêu cầu thông tin về firmware
 void requestFirmwareAttributes() {
-    static int requestId = 0;
-    requestId++;
-    
     // Yêu cầu các thuộc tính chia sẻ liên quan đến firmware
-    String requestTopic = "v1/devices/me/attributes/request/" + String(requestId);
-    String requestPayload = "{\"sharedKeys\":\"fw_checksum,fw_checksum_algorithm,fw_size,fw_title,fw_version,fw_chunk_size\"}";
-    
-    Serial.printf("Requesting firmware attributes (ID: %d)...\n", requestId);
-    Serial.printf("Topic: %s\n", requestTopic.c_str());
-    Serial.printf("Payload: %s\n", requestPayload.c_str());
-    
-    bool published = mqttClient.publish(requestTopic.c_str(), requestPayload.c_str());
-    Serial.printf("Publish result: %s\n", published ? "Success" : "Failed");
+    uint32_t requestId = mqttSession.requestAttributes(OTA_FIRMWARE_ATTRIBUTE_KEYS);
+    Serial.printf("Requesting firmware attributes (ID: %u): %s\n", (unsigned)requestId, requestId != 0 ? "Success" : "Failed");
 }
 
 // Task OTA
 void otaTask(void *pvParameters) {
-    bool updateInitialized = false;
     unsigned long lastCheckTime = 0;
-    unsigned long lastConnectionCheckTime = 0;
     const unsigned long CHECK_INTERVAL = 100000; // Kiểm tra firmware mới mỗi 100 giây
-    const unsigned long CONNECTION_CHECK_INTERVAL = 10000; // Kiểm tra kết nối mỗi 10 giây
+    bool sourcePrepared = false; // Image đang chạy đã được đọc cho delta patch
     
     Serial.println("OTA Task started");
-    
-    // Khởi tạo thiết bị
-    initializeDevice();
+    otaTaskHandle = xTaskGetCurrentTaskHandle();
     
     for (;;) {
-        // Xử lý các thông điệp MQTT đến cho OTA
-        mqttClient.loop();
-        
-        // Kiểm tra kết nối MQTT định kỳ
-        if (millis() - lastConnectionCheckTime > CONNECTION_CHECK_INTERVAL) {
-            if (!mqttClient.connected()) {
-                Serial.println("MQTT disconnected, attempting to reconnect...");
-                connectDeviceToThingsBoard();
-            } else {
-                Serial.printf("MQTT State: %d\n", mqttClient.state());
-            }
-            lastConnectionCheckTime = millis();
+        // Image mới được xác nhận hoặc quay lại image cũ (khởi động lại) khi hết hạn
+        if (bootValidator.getState() == BOOT_PENDING && bootValidator.poll(millis()) == BOOT_CONFIRMED) {
+            mqttSession.lock();
+            reportFirmwareState();
+            mqttSession.unlock();
         }
-        
+
         // Kiểm tra firmware mới định kỳ
-        if (millis() - lastCheckTime > CHECK_INTERVAL) {
-            if (deviceConnected) {
+        if (!otaInProgress && millis() - lastCheckTime > CHECK_INTERVAL) {
+            if (mqttSession.connected()) {
                 Serial.println("Periodic firmware check...");
                 requestFirmwareAttributes();
                 lastCheckTime = millis();
             }
         }
-        
-        if (otaInProgress && !waitingForChunk && offset < fw_size) {      
-            if (!updateInitialized) {
-                Serial.println("Initializing update process...");
-                if (!Update.begin(fw_size, U_FLASH)) {
-                    Serial.println("Failed to begin OTA: " + String(Update.errorString()));
-                    mqttClient.publish("v1/devices/me/attributes", 
-                        "{\"fw_state\":\"FAILED\",\"fw_error\":\"Failed to initialize update\"}");
-                    otaInProgress = false;
-                    continue;
-                }
-                updateInitialized = true;
-                Serial.println("OTA update initialized successfully");
-                mqttClient.publish("v1/devices/me/attributes", "{\"fw_state\":\"DOWNLOADING\"}");
+
+        // CRC của image đang chạy cho delta patch, tính một lần trên task này trước request đầu tiên
+        // thay vì trong callback MQTT khi header của patch đến, không giữ khóa của phiên MQTT khi đọc flash
+        if (otaInProgress && !sourcePrepared) {
+            sourcePrepared = true;
+            if (!otaImage.prepareSource()) {
+                Serial.println("Failed to read the running image, delta patches will be rejected");
             }
+        }
 
-            int chunkIndex = chunks_received;
-            String payload = String(chunk_size);
-            
-            String reqTopic = "v2/fw/request/" + String(currentFirmwareRequestId) + "/chunk/" + String(chunkIndex);
-            Serial.printf("Requesting chunk %d (offset: %d) with topic: %s\n", chunkIndex, offset, reqTopic.c_str());
-            
-            mqttClient.publish(reqTopic.c_str(), payload.c_str(), 1);
-            
-            waitingForChunk = true;
-            lastRequestTime = millis();
-            Serial.printf("Requested chunk %d at offset %d\n", chunkIndex, offset);
+#if OTA_USE_HTTP
+        mqttSession.lock();
+        bool startHttp = otaHttpPending && otaInProgress;
+        otaHttpPending = false;
+        otaHttpRunning = startHttp;
+        mqttSession.unlock();
+        if (startHttp) {
+            runHttpDownload();
+            continue;
         }
-        
-        if (waitingForChunk && millis() - lastRequestTime > OTA_REQUEST_TIMEOUT) {
-            Serial.println("Timeout waiting for chunk. Retrying...");
-            waitingForChunk = false;
+#endif
+
+        // Trạng thái OTA được cập nhật trong handler chạy trên task ThingsBoard,
+        // giữ khóa của phiên MQTT để không đọc/ghi xen kẽ với handler
+        unsigned long waitMs = OTA_IDLE_WAIT;
+        mqttSession.lock();
+        if (otaInProgress && mqttSession.connected()) {
+            // Lấp đầy cửa sổ: yêu cầu lại các chunk quá hạn, sau đó các chunk mới.
+            // Kích thước mới được áp dụng bởi otaWindow khi vị trí tải cho phép
+            otaWindow.setChunkSize(otaChunkSizer.getChunkSize());
+            uint32_t retries = otaWindow.getRetries();
+            int32_t chunkIndex;
+            bool published = true;
+            while ((chunkIndex = otaWindow.nextRequest(millis(), OTA_REQUEST_TIMEOUT)) >= 0) {
+                // Kích thước chunk vừa đổi: chỉ số cũ trỏ tới vị trí khác, dùng request id mới để
+                // otaChunkHandler bỏ các response trễ của kích thước cũ thay vì ghi sai vị trí
+                if (otaWindow.getGeneration() != requestGeneration) {
+                    requestGeneration = otaWindow.getGeneration();
+                    currentFirmwareRequestId++;
+                }
+                String reqTopic = "v2/fw/request/" + String(currentFirmwareRequestId) + "/chunk/" + String(chunkIndex);
+                String payload = String(otaWindow.getChunkSize());
+                if (!mqttSession.publish(reqTopic.c_str(), payload.c_str())) {
+                    Serial.printf("Failed to request chunk %ld\n", (long)chunkIndex);
+                    published = false;
+                    break;
+                }
+                lastRequestTime = millis();
+                otaMetrics.onRequest(chunkIndex, lastRequestTime);
+                Serial.printf("Requested chunk %ld (%lu in flight)\n", (long)chunkIndex, (unsigned long)otaWindow.inFlight());
+            }
+            // Mỗi lần gửi lại là một request hết hạn hoặc chunk sai kích thước
+            for (; retries < otaWindow.getRetries(); retries++) {
+                otaChunkSizer.onFailure(millis());
+                otaMetrics.onRetry();
+            }
+            waitingForChunk = otaWindow.inFlight() > 0;
+            publishOtaMetrics();
+            if (published) {
+                waitMs = min(waitMs, (unsigned long)otaWindow.msUntilTimeout(millis(), OTA_REQUEST_TIMEOUT));
+            }
         }
+        mqttSession.unlock();
 
-        vTaskDelay(pdMS_TO_TICKS(500));
+        // Các thông điệp MQTT được xử lý bởi task ThingsBoard, task OTA ngủ đến khi
+        // có chunk được ghi (cửa sổ có chỗ trống) hoặc một request hết hạn
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
     }
-}
\ No newline at end of file
+}
+
+#endif // ARDUINO
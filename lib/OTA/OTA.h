@@ -3,9 +3,8 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <PubSubClient.h>
+#include <mqtt.hpp>
 #include <ArduinoJson.h>
-#include <Update.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,29 +19,23 @@ extern unsigned long lastRequestTime;
 extern const unsigned long OTA_REQUEST_TIMEOUT;
 extern byte* firmware_data;
 
-// Cấu trúc thiết bị
-struct Alldevice {
-    const char* name;
-    const char* token;
-    WiFiClient* wifiClient;
-    PubSubClient* mqttClient;
-    bool connected;
-    void (*callback)(char*, byte*, unsigned int);
-};
-
-// Thiết bị duy nhất
-extern Alldevice device;
-extern WiFiClient wifiClient;
-extern PubSubClient mqttClient;
-extern const char* DEVICE_TOKEN;
-extern bool deviceConnected;
+// Kích thước chunk tối đa, quyết định buffer của phiên MQTT dùng chung
+#ifndef OTA_MAX_CHUNK_SIZE
+#define OTA_MAX_CHUNK_SIZE 4096
+#endif
+// Kích thước mỗi buffer của task ghi flash, bằng một sector để mỗi lần ghi xóa nhiều nhất một sector
+#ifndef OTA_FLASH_BUFFER_SIZE
+#define OTA_FLASH_BUFFER_SIZE 4096
+#endif
+// Shared attributes mô tả firmware mới, được yêu cầu sau mỗi lần kết nối và định kỳ
+#define OTA_FIRMWARE_ATTRIBUTE_KEYS "fw_checksum,fw_checksum_algorithm,fw_size,fw_title,fw_version,fw_chunk_size"
 
 // Khai báo hàm
 int b64decode(char c);
 size_t decode_base64(const char *input, uint8_t *output, size_t output_len);
-void deviceCallback(char* topic, byte* payload, unsigned int length);
-void initializeDevice();
-bool connectDeviceToThingsBoard();
+void otaAttributesHandler(const MqttMessage& message);
+void otaChunkHandler(const MqttMessage& message);
+void otaInit();
 void requestFirmwareAttributes();
 void startOtaProcess();
 void otaTask(void *pvParameters);
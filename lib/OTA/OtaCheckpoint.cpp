@@ -0,0 +1,93 @@
+#include "OtaCheckpoint.h"
+
+static void copyString(char* destination, size_t size, const String& source) {
+    strncpy(destination, source.c_str(), size - 1);
+    destination[size - 1] = '\0';
+}
+
+OtaCheckpoint::OtaCheckpoint(const char* nvsNamespace)
+    : nvsNamespace(nvsNamespace), savedChunks(0) {
+    memset(&data, 0, sizeof(data));
+}
+
+bool OtaCheckpoint::load() {
+    memset(&data, 0, sizeof(data));
+    if (!prefs.begin(nvsNamespace, true)) {
+        return false;
+    }
+    size_t length = prefs.getBytes("progress", &data, sizeof(data));
+    prefs.end();
+
+    if (length != sizeof(data) || data.magic != OTA_CHECKPOINT_MAGIC || data.chunkSize == 0) {
+        memset(&data, 0, sizeof(data));
+        return false;
+    }
+    savedChunks = data.chunks;
+    return true;
+}
+
+bool OtaCheckpoint::matches(const String& title, const String& version, const String& algorithm,
+                            const String& checksum, uint32_t size, uint32_t partition) const {
+    return data.magic == OTA_CHECKPOINT_MAGIC && data.size == size && data.partition == partition &&
+           title == data.title && version == data.version &&
+           algorithm.equalsIgnoreCase(data.algorithm) && checksum.equalsIgnoreCase(data.checksum);
+}
+
+bool OtaCheckpoint::begin(const String& title, const String& version, const String& algorithm,
+                          const String& checksum, uint32_t size, uint16_t chunkSize, uint32_t partition) {
+    memset(&data, 0, sizeof(data));
+    data.magic = OTA_CHECKPOINT_MAGIC;
+    data.size = size;
+    data.partition = partition;
+    data.chunks = 0;
+    data.chunkSize = chunkSize;
+    copyString(data.title, sizeof(data.title), title);
+    copyString(data.version, sizeof(data.version), version);
+    copyString(data.algorithm, sizeof(data.algorithm), algorithm);
+    copyString(data.checksum, sizeof(data.checksum), checksum);
+    savedChunks = 0;
+    return save();
+}
+
+void OtaCheckpoint::update(uint32_t chunks, uint16_t chunkSize, bool force) {
+    if (data.magic != OTA_CHECKPOINT_MAGIC) {
+        return;
+    }
+    if (chunkSize != data.chunkSize) {
+        data.chunkSize = chunkSize;
+        force = true;
+    }
+    data.chunks = chunks;
+    if (force || chunks - savedChunks >= OTA_CHECKPOINT_INTERVAL) {
+        save();
+    }
+}
+
+bool OtaCheckpoint::save() {
+    if (!prefs.begin(nvsNamespace, false)) {
+        return false;
+    }
+    bool ok = prefs.putBytes("progress", &data, sizeof(data)) == sizeof(data);
+    prefs.end();
+    if (ok) {
+        savedChunks = data.chunks;
+    }
+    return ok;
+}
+
+void OtaCheckpoint::clear() {
+    memset(&data, 0, sizeof(data));
+    savedChunks = 0;
+    if (prefs.begin(nvsNamespace, false)) {
+        prefs.remove("progress");
+        prefs.end();
+    }
+}
+
+uint32_t OtaCheckpoint::getChunks() const {
+    return data.chunks;
+}
+
+uint16_t OtaCheckpoint::getChunkSize() const {
+    return data.chunkSize;
+}
@@ -0,0 +1,66 @@
+#ifndef OTA_CHECKPOINT_H
+#define OTA_CHECKPOINT_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Số chunk giữa hai lần ghi checkpoint, giới hạn số lần ghi NVS trong một lần OTA
+#ifndef OTA_CHECKPOINT_INTERVAL
+#define OTA_CHECKPOINT_INTERVAL 16
+#endif
+#define OTA_CHECKPOINT_MAGIC 0x4F544131 // "OTA1"
+
+// Firmware identity and write watermark of an interrupted download
+struct OtaCheckpointData {
+    uint32_t magic;
+    uint32_t size;
+    uint32_t partition;     // Địa chỉ partition đang được ghi
+    uint32_t chunks;        // Các chunk [0, chunks) đã được ghi và đưa vào hash
+    uint16_t chunkSize;
+    char title[32];
+    char version[32];
+    char algorithm[8];
+    char checksum[132];     // Đủ cho SHA512 dạng hex
+};
+
+// Persists OTA progress in NVS so a download interrupted by a disconnect
+// or a power cycle continues from the last written chunk. Chunks are written
+// strictly in order, so a watermark is enough to describe the progress.
+class OtaCheckpoint {
+private:
+    Preferences prefs;
+    const char* nvsNamespace;
+    OtaCheckpointData data;
+    uint32_t savedChunks;
+
+    bool save();
+
+public:
+    explicit OtaCheckpoint(const char* nvsNamespace = "ota");
+
+    // Đọc checkpoint từ NVS, false nếu không có hoặc không hợp lệ
+    bool load();
+    // Checkpoint thuộc về đúng firmware và partition này
+    bool matches(const String& title, const String& version, const String& algorithm,
+                 const String& checksum, uint32_t size, uint32_t partition) const;
+    // Bắt đầu checkpoint mới cho một lần tải từ đầu
+    bool begin(const String& title, const String& version, const String& algorithm,
+               const String& checksum, uint32_t size, uint16_t chunkSize, uint32_t partition);
+    // Cập nhật watermark, chỉ ghi NVS sau mỗi OTA_CHECKPOINT_INTERVAL chunk trừ khi force
+    // hoặc kích thước chunk đã thay đổi (watermark được tính theo kích thước chunk)
+    void update(uint32_t chunks, uint16_t chunkSize, bool force = false);
+    void clear();
+
+    uint32_t getChunks() const;
+    uint16_t getChunkSize() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_CHECKPOINT_H
@@ -0,0 +1,150 @@
+#include "OtaChunkSizer.h"
+
+// Số lần đo chờ trước khi thử lại kích thước lớn hơn, tăng gấp đôi sau mỗi lần thử thất bại
+#define OTA_CHUNK_SIZER_BACKOFF 4
+#define OTA_CHUNK_SIZER_MAX_BACKOFF 32
+// Số request thất bại liên tiếp ở kích thước chưa từng thành công trước khi giảm kích thước
+#define OTA_CHUNK_SIZER_FAILURES 3
+
+OtaChunkSizer::OtaChunkSizer()
+    : maxSize(0), maxLevel(0), level(0), measuring(false), chunks(0), failures(0), holdOff(0),
+      backoff(OTA_CHUNK_SIZER_BACKOFF), probing(false), epochStart(0), epochBytes(0) {
+    memset(goodput, 0, sizeof(goodput));
+}
+
+uint8_t OtaChunkSizer::levels(uint16_t maxSize) {
+    uint8_t level = 0;
+    while (level + 1 < OTA_CHUNK_LEVELS && (maxSize >> (level + 1)) >= OTA_MIN_CHUNK_SIZE) {
+        level++;
+    }
+    return level;
+}
+
+uint16_t OtaChunkSizer::roundSize(uint16_t maxSize, uint16_t size) {
+    uint8_t maxLevel = levels(maxSize);
+    uint8_t level = 0;
+    while (level < maxLevel && (maxSize >> level) > size) {
+        level++;
+    }
+    return maxSize >> level;
+}
+
+void OtaChunkSizer::begin(uint16_t maxSize, uint16_t initialSize) {
+    this->maxSize = maxSize;
+    maxLevel = levels(maxSize);
+
+    uint8_t initialLevel = 0;
+    while (initialLevel < maxLevel && (maxSize >> initialLevel) > initialSize) {
+        initialLevel++;
+    }
+    if ((maxSize >> initialLevel) != initialSize) {
+        // Kích thước không thuộc dãy maxSize / 2^n: giữ cố định
+        this->maxSize = initialSize;
+        maxLevel = 0;
+        initialLevel = 0;
+    }
+
+    memset(goodput, 0, sizeof(goodput));
+    holdOff = 0;
+    backoff = OTA_CHUNK_SIZER_BACKOFF;
+    probing = false;
+    setLevel(initialLevel);
+}
+
+void OtaChunkSizer::setLevel(uint8_t level) {
+    this->level = level;
+    // Lần đo bắt đầu từ chunk đầu tiên ở kích thước mới, các chunk cũ có thể vẫn đang tải
+    measuring = false;
+    chunks = 0;
+    failures = 0;
+    epochBytes = 0;
+}
+
+void OtaChunkSizer::shrink() {
+    if (probing) {
+        backoff = min(backoff * 2, OTA_CHUNK_SIZER_MAX_BACKOFF);
+    }
+    probing = false;
+    holdOff = backoff;
+    Serial.printf("OTA chunk size %u -> %u\n", getChunkSize(), getChunkSize() / 2);
+    setLevel(level + 1);
+}
+
+void OtaChunkSizer::onSuccess(size_t length, uint32_t now) {
+    if (!measuring) {
+        measuring = true;
+        epochStart = now;
+        failures = 0;
+        return;
+    }
+    epochBytes += length;
+    if (++chunks >= OTA_CHUNK_SIZER_SAMPLES) {
+        endEpoch(now);
+    }
+}
+
+void OtaChunkSizer::onFailure(uint32_t now) {
+    failures++;
+    if (!measuring) {
+        // Kích thước này chưa từng thành công
+        if (failures >= OTA_CHUNK_SIZER_FAILURES && level < maxLevel) {
+            goodput[level] = 1;
+            shrink();
+        }
+    } else if (failures >= (probing ? 2 : OTA_CHUNK_SIZER_SAMPLES / 2)) {
+        // Đang thử kích thước lớn hơn: mỗi request hết hạn tốn một timeout, kết thúc sớm
+        endEpoch(now);
+    }
+}
+
+void OtaChunkSizer::endEpoch(uint32_t now) {
+    // Thời gian chờ các request hết hạn được tính vào lần đo nên goodput đã phản ánh tỉ lệ lỗi
+    uint32_t elapsed = max(now - epochStart, (uint32_t)1);
+    uint32_t current = max((uint32_t)((uint64_t)epochBytes * 1000 / elapsed), (uint32_t)1);
+    uint32_t smaller = level < maxLevel ? goodput[level + 1] : 0;
+    uint32_t bigger = level > 0 ? goodput[level - 1] : 0;
+    bool lossy = failures * 4 >= chunks + failures;
+    goodput[level] = current;
+
+    if (level < maxLevel && (smaller > current + current / 8 || (lossy && smaller == 0))) {
+        shrink();
+        return;
+    }
+    if (probing) {
+        // Kích thước lớn hơn không tệ hơn nhiều: giữ lại, chỉ đặt lại backoff khi thực sự tốt hơn
+        probing = false;
+        if (current >= smaller) {
+            backoff = OTA_CHUNK_SIZER_BACKOFF;
+        }
+    }
+    epochStart = now;
+    epochBytes = 0;
+    chunks = 0;
+    failures = 0;
+
+    if (level == 0) {
+        return;
+    }
+    if (holdOff > 0) {
+        // Hết thời gian chờ: quên kết quả cũ của kích thước lớn hơn để đo lại
+        if (--holdOff == 0) {
+            goodput[level - 1] = 0;
+        }
+        return;
+    }
+    if (bigger == 0 || bigger > current) {
+        Serial.printf("OTA chunk size %u -> %u (%lu B/s)\n", getChunkSize(), getChunkSize() * 2, (unsigned long)current);
+        probing = true;
+        setLevel(level - 1);
+    } else {
+        holdOff = backoff;
+    }
+}
+
+uint16_t OtaChunkSizer::getChunkSize() const {
+    return maxSize >> level;
+}
+
+uint32_t OtaChunkSizer::getGoodput() const {
+    return goodput[level];
+}
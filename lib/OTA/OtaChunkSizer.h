@@ -0,0 +1,68 @@
+#ifndef OTA_CHUNK_SIZER_H
+#define OTA_CHUNK_SIZER_H
+
+#include <Arduino.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Kích thước chunk nhỏ nhất, các kích thước được thử là chunk_size / 2^n
+#ifndef OTA_MIN_CHUNK_SIZE
+#define OTA_MIN_CHUNK_SIZE 512
+#endif
+#define OTA_CHUNK_LEVELS 8
+// Số chunk thành công của mỗi lần đo ở một kích thước
+#ifndef OTA_CHUNK_SIZER_SAMPLES
+#define OTA_CHUNK_SIZER_SAMPLES 8
+#endif
+
+// Adaptive chunk size controller: measures the goodput (bytes written per
+// second, so timeouts and retries count against a size) and the failure
+// rate of each chunk size over a short epoch, then moves towards the
+// neighbouring size that did better. Sizes are chunk_size / 2^n, so the
+// chunk index can always be recomputed when the size changes.
+class OtaChunkSizer {
+private:
+    uint16_t maxSize;
+    uint8_t maxLevel;           // Kích thước = maxSize >> level
+    uint8_t level;
+    bool measuring;             // Đã có chunk đầu tiên ở kích thước hiện tại
+    uint8_t chunks;             // Số chunk thành công trong lần đo hiện tại
+    uint8_t failures;           // Số request thất bại trong lần đo hiện tại
+    uint8_t holdOff;            // Số lần đo còn lại trước khi thử lại kích thước lớn hơn
+    uint8_t backoff;            // holdOff sau lần thử thất bại, tăng gấp đôi mỗi lần thử thất bại
+    bool probing;               // Vừa tăng kích thước, chưa biết có tốt hơn không
+    uint32_t epochStart;
+    uint32_t epochBytes;
+    uint32_t goodput[OTA_CHUNK_LEVELS];     // Byte/giây đo được ở mỗi kích thước, 0 = chưa đo
+
+    static uint8_t levels(uint16_t maxSize);
+    void setLevel(uint8_t level);
+    void shrink();
+    void endEpoch(uint32_t now);
+
+public:
+    OtaChunkSizer();
+
+    // Kích thước maxSize / 2^n lớn nhất không vượt quá size (nhỏ nhất là kích thước nhỏ nhất được thử)
+    static uint16_t roundSize(uint16_t maxSize, uint16_t size);
+
+    // maxSize: giới hạn của buffer MQTT, initialSize = maxSize / 2^n (xem roundSize),
+    // kích thước khác (ví dụ của checkpoint cũ) được giữ cố định
+    void begin(uint16_t maxSize, uint16_t initialSize);
+    // Chunk hợp lệ đã được nhận (đã ghi hoặc đang đệm)
+    void onSuccess(size_t length, uint32_t now);
+    // Request hết hạn hoặc chunk sai kích thước
+    void onFailure(uint32_t now);
+
+    uint16_t getChunkSize() const;
+    // Byte/giây đo được ở kích thước hiện tại, 0 nếu chưa đo xong
+    uint32_t getGoodput() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_CHUNK_SIZER_H
@@ -0,0 +1,171 @@
+#include "OtaHttp.h"
+
+OtaHttpDownloader::OtaHttpDownloader(Client& client, const char* host, uint16_t port)
+    : http(client, host, port), cancelled(false), offset(0), received(0), requests(0) {
+    // Các request tiếp tục dùng lại kết nối nếu server còn giữ
+    http.connectionKeepAlive();
+}
+
+bool OtaHttpDownloader::sendRequest(const char* path, uint32_t from, uint32_t size) {
+    requests++;
+    http.beginRequest();
+    if (http.get(path) != HTTP_SUCCESS) {
+        Serial.println("OTA HTTP: connection failed");
+        return false;
+    }
+    if (from > 0) {
+        char range[32];
+        snprintf(range, sizeof(range), "bytes=%lu-", (unsigned long)from);
+        http.sendHeader("Range", range);
+    }
+    http.endRequest();
+
+    int status = http.responseStatusCode();
+    if (status == 206) {
+        // Content-Range: bytes <đầu>-<cuối>/<tổng>
+        long first = -1;
+        while (http.headerAvailable()) {
+            if (http.readHeaderName().equalsIgnoreCase("Content-Range")) {
+                String value = http.readHeaderValue();
+                first = value.substring(value.indexOf(' ') + 1).toInt();
+            }
+        }
+        if (first != (long)from) {
+            Serial.printf("OTA HTTP: unexpected range start %ld, requested %lu\n", first, (unsigned long)from);
+            return false;
+        }
+        return true;
+    }
+    if (status == 200) {
+        long length = http.contentLength();
+        if (length >= 0 && (uint32_t)length != size) {
+            Serial.printf("OTA HTTP: content length %ld, expected %lu\n", length, (unsigned long)size);
+            return false;
+        }
+        // Server bỏ qua Range: bỏ qua phần đã ghi
+        return from == 0 || skip(from);
+    }
+    Serial.printf("OTA HTTP: status %d\n", status);
+    return false;
+}
+
+bool OtaHttpDownloader::skip(uint32_t length) {
+    uint32_t last = millis();
+    while (length > 0 && !cancelled) {
+        int available = http.available();
+        if (available <= 0) {
+            if (!http.connected() || millis() - last > OTA_HTTP_TIMEOUT) {
+                return false;
+            }
+            delay(1);
+            continue;
+        }
+        int n = http.read(buffer, min((uint32_t)available, min(length, (uint32_t)sizeof(buffer))));
+        if (n > 0) {
+            length -= n;
+            received += n;
+            last = millis();
+        }
+    }
+    return length == 0;
+}
+
+OtaHttpResult OtaHttpDownloader::stream(uint32_t size, uint32_t& fill, OtaChunkWriter writer) {
+    uint32_t last = millis();
+    while (offset + fill < size) {
+        if (cancelled) {
+            return OTA_HTTP_CANCELLED;
+        }
+        int available = http.available();
+        if (available <= 0) {
+            if (!http.connected() || millis() - last > OTA_HTTP_TIMEOUT) {
+                return OTA_HTTP_NETWORK_ERROR;
+            }
+            delay(1);
+            continue;
+        }
+
+        // Khối kết thúc ở ranh giới OTA_HTTP_BLOCK_SIZE hoặc ở cuối image
+        uint32_t blockEnd = min((offset / OTA_HTTP_BLOCK_SIZE + 1) * OTA_HTTP_BLOCK_SIZE, size);
+        uint32_t space = min((uint32_t)available, blockEnd - offset - fill);
+        int n;
+        if (http.isResponseChunked()) {
+            // Chỉ read() từng byte mới xử lý được Transfer-Encoding: chunked
+            n = 0;
+            int c;
+            while ((uint32_t)n < space && (c = http.read()) >= 0) {
+                buffer[fill + n++] = (uint8_t)c;
+            }
+        } else {
+            n = http.read(buffer + fill, space);
+        }
+        if (n <= 0) {
+            continue;
+        }
+        fill += n;
+        received += n;
+        last = millis();
+
+        if (offset + fill == blockEnd) {
+            if (!writer(buffer, fill)) {
+                return OTA_HTTP_WRITE_FAILED;
+            }
+            offset += fill;
+            fill = 0;
+        }
+    }
+    return OTA_HTTP_OK;
+}
+
+OtaHttpResult OtaHttpDownloader::download(const char* path, uint32_t offset, uint32_t size, OtaChunkWriter writer) {
+    cancelled = false;
+    this->offset = offset;
+    received = 0;
+    requests = 0;
+
+    // Các byte đã nhận nhưng chưa đủ một khối vẫn được giữ khi kết nối lại
+    uint32_t fill = 0;
+    uint8_t failures = 0;
+    while (this->offset + fill < size) {
+        uint32_t before = this->offset + fill;
+        OtaHttpResult result = OTA_HTTP_NETWORK_ERROR;
+        if (sendRequest(path, before, size)) {
+            result = stream(size, fill, writer);
+        }
+        if (cancelled) {
+            result = OTA_HTTP_CANCELLED;
+        }
+        if (result != OTA_HTTP_OK) {
+            http.stop();
+        }
+        if (result == OTA_HTTP_WRITE_FAILED || result == OTA_HTTP_CANCELLED) {
+            return result;
+        }
+        if (result == OTA_HTTP_NETWORK_ERROR) {
+            // Đếm các lần thử liên tiếp không nhận thêm được byte nào
+            failures = this->offset + fill > before ? 0 : failures + 1;
+            if (failures > OTA_HTTP_MAX_RETRIES) {
+                return OTA_HTTP_NETWORK_ERROR;
+            }
+            Serial.printf("OTA HTTP: resuming at %lu/%lu\n", (unsigned long)(this->offset + fill), (unsigned long)size);
+            delay(500U << failures);
+        }
+    }
+    return OTA_HTTP_OK;
+}
+
+void OtaHttpDownloader::cancel() {
+    cancelled = true;
+}
+
+uint32_t OtaHttpDownloader::getOffset() const {
+    return offset;
+}
+
+uint32_t OtaHttpDownloader::getBytesReceived() const {
+    return received;
+}
+
+uint32_t OtaHttpDownloader::getRequests() const {
+    return requests;
+}
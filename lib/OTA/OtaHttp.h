@@ -0,0 +1,72 @@
+#ifndef OTA_HTTP_H
+#define OTA_HTTP_H
+
+#include <Arduino.h>
+#include <Client.h>
+#include <ArduinoHttpClient.h>
+#include "OtaWindow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tải firmware qua HTTP thay vì các chunk MQTT, bật bằng build flag -D OTA_USE_HTTP=1
+#ifndef OTA_USE_HTTP
+#define OTA_USE_HTTP 0
+#endif
+// Dữ liệu được ghi theo khối, vị trí các khối chia hết cho kích thước khối (trừ khối đầu khi tiếp tục)
+#ifndef OTA_HTTP_BLOCK_SIZE
+#define OTA_HTTP_BLOCK_SIZE 4096
+#endif
+// Thời gian tối đa không nhận được byte nào trước khi kết nối lại
+#ifndef OTA_HTTP_TIMEOUT
+#define OTA_HTTP_TIMEOUT 10000
+#endif
+// Số lần kết nối lại liên tiếp không nhận được dữ liệu trước khi bỏ cuộc
+#ifndef OTA_HTTP_MAX_RETRIES
+#define OTA_HTTP_MAX_RETRIES 5
+#endif
+
+enum OtaHttpResult : uint8_t {
+    OTA_HTTP_OK,
+    OTA_HTTP_NETWORK_ERROR,     // Hết số lần thử, phần đã ghi vẫn hợp lệ
+    OTA_HTTP_WRITE_FAILED,
+    OTA_HTTP_CANCELLED
+};
+
+// Firmware fetch engine over HTTP/1.1: the image is streamed in one
+// response per connection with an open-ended Range request, and after a
+// dropped connection or a stall the download continues from the last
+// received byte on a kept-alive or new connection. Servers that ignore
+// Range are handled by skipping the bytes already written.
+class OtaHttpDownloader {
+private:
+    HttpClient http;
+    volatile bool cancelled;
+    uint32_t offset;            // Số byte đã chuyển cho writer
+    uint32_t received;          // Số byte nhận được trong lần tải này (kể cả phần bị bỏ qua)
+    uint32_t requests;
+    uint8_t buffer[OTA_HTTP_BLOCK_SIZE];
+
+    bool sendRequest(const char* path, uint32_t from, uint32_t size);
+    bool skip(uint32_t length);
+    OtaHttpResult stream(uint32_t size, uint32_t& fill, OtaChunkWriter writer);
+
+public:
+    OtaHttpDownloader(Client& client, const char* host, uint16_t port);
+
+    // Tải byte [offset, size) của path, trả về khi xong, lỗi hoặc bị hủy
+    OtaHttpResult download(const char* path, uint32_t offset, uint32_t size, OtaChunkWriter writer);
+    // Gọi từ task khác, download() trả về OTA_HTTP_CANCELLED ở khối kế tiếp
+    void cancel();
+
+    uint32_t getOffset() const;
+    uint32_t getBytesReceived() const;
+    uint32_t getRequests() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_HTTP_H
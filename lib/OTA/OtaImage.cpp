@@ -0,0 +1,145 @@
+#ifdef ARDUINO
+
+#include "OtaImage.h"
+#include <HashGenerator.h>
+#include <esp_ota_ops.h>
+#include <esp_image_format.h>
+
+OtaImage::OtaImage(Partition_Updater& updater, IUpdater& writer)
+    : updater(updater), writer(writer), format(OTA_IMAGE_UNKNOWN), started(false), compressed(false),
+      transferSize(0), payloadSize(0), sourcePrepared(false), sourceImageSize(0), sourceImageCrc(0) {
+}
+
+void OtaImage::begin(uint32_t transferSize, OtaImageFormat format) {
+    this->transferSize = transferSize;
+    this->format = format;
+    started = format != OTA_IMAGE_UNKNOWN;
+    compressed = false;
+    payloadSize = transferSize;
+    delta.begin(this);
+}
+
+bool OtaImage::write(uint8_t* data, size_t length) {
+    if (!started) {
+        started = true;
+        if (HeatshrinkDecoder::isCompressed(data, length)) {
+            compressed = true;
+            decompressor.begin(onDecompressed, this);
+            Serial.println("OTA image is compressed");
+        }
+    }
+    if (compressed) {
+        return decompressor.feed(data, length);
+    }
+    return writePayload(data, length);
+}
+
+bool OtaImage::onDecompressed(void* context, uint8_t* data, size_t length) {
+    return static_cast<OtaImage*>(context)->writePayload(data, length);
+}
+
+bool OtaImage::writePayload(uint8_t* data, size_t length) {
+    if (format == OTA_IMAGE_UNKNOWN) {
+        if (compressed) {
+            payloadSize = decompressor.getOutputSize();
+        }
+        if (DeltaPatch::isPatch(data, length)) {
+            format = OTA_IMAGE_DELTA;
+            Serial.println("OTA image is a delta patch");
+        } else {
+            // Image đầy đủ, header (0xE9) được kiểm tra khi đánh dấu partition để boot
+            format = OTA_IMAGE_RAW;
+            if (!writer.begin(payloadSize)) {
+                return false;
+            }
+        }
+    }
+
+    if (format == OTA_IMAGE_DELTA) {
+        return delta.feed(data, length);
+    }
+    return writer.write(data, length) == length;
+}
+
+bool OtaImage::finished() const {
+    if (compressed && !decompressor.finished()) {
+        return false;
+    }
+    if (format == OTA_IMAGE_DELTA) {
+        return delta.finished();
+    }
+    return format == OTA_IMAGE_RAW && updater.get_offset() == payloadSize;
+}
+
+OtaImageFormat OtaImage::getFormat() const {
+    return format;
+}
+
+bool OtaImage::isCompressed() const {
+    return compressed;
+}
+
+bool OtaImage::resumable() const {
+    return format == OTA_IMAGE_RAW && !compressed;
+}
+
+bool OtaImage::readSource(size_t offset, uint8_t* buffer, size_t length) {
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    return running != nullptr && esp_partition_read(running, offset, buffer, length) == ESP_OK;
+}
+
+bool OtaImage::prepareSource() {
+    if (sourcePrepared) {
+        return true;
+    }
+    const esp_partition_t* running = esp_ota_get_running_partition();
+    if (running == nullptr) {
+        return false;
+    }
+    // Kích thước thật của image (kể cả checksum và SHA256 nối phía sau), bằng kích thước file .bin mà patch được tạo từ đó
+    const esp_partition_pos_t position = { running->address, running->size };
+    esp_image_metadata_t metadata;
+    if (esp_image_get_metadata(&position, &metadata) != ESP_OK) {
+        return false;
+    }
+
+    uint32_t started = millis();
+    uint8_t buffer[512];
+    uint32_t crc = 0;
+    for (uint32_t offset = 0; offset < metadata.image_len; offset += sizeof(buffer)) {
+        size_t block = min((uint32_t)sizeof(buffer), metadata.image_len - offset);
+        if (!readSource(offset, buffer, block)) {
+            return false;
+        }
+        crc = HashGenerator::crc32(crc, buffer, block);
+    }
+    sourceImageSize = metadata.image_len;
+    sourceImageCrc = crc;
+    sourcePrepared = true;
+    Serial.printf("Running image: %lu bytes, CRC %08lx (%lu ms)\n", (unsigned long)sourceImageSize,
+                  (unsigned long)sourceImageCrc, (unsigned long)(millis() - started));
+    return true;
+}
+
+bool OtaImage::beginTarget(uint32_t sourceSize, uint32_t sourceCrc, uint32_t targetSize) {
+    // Patch chỉ hợp lệ cho đúng image đang chạy, CRC đã được tính sẵn bởi prepareSource()
+    if (!sourcePrepared) {
+        Serial.println("Delta patch: running image was not prepared");
+        return false;
+    }
+    if (sourceSize != sourceImageSize || sourceCrc != sourceImageCrc) {
+        Serial.printf("Delta patch base mismatch: expected %lu bytes CRC %08lx, running image %lu bytes CRC %08lx\n",
+                      (unsigned long)sourceSize, (unsigned long)sourceCrc,
+                      (unsigned long)sourceImageSize, (unsigned long)sourceImageCrc);
+        return false;
+    }
+
+    Serial.printf("Applying delta patch: %lu -> %lu bytes\n", (unsigned long)sourceSize, (unsigned long)targetSize);
+    return writer.begin(targetSize);
+}
+
+bool OtaImage::writeTarget(uint8_t* data, size_t length) {
+    return writer.write(data, length) == length;
+}
+
+#endif // ARDUINO
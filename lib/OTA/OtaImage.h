@@ -0,0 +1,68 @@
+#ifndef OTA_IMAGE_H
+#define OTA_IMAGE_H
+
+#include <Arduino.h>
+#include <Partition_Updater.h>
+#include <IUpdater.h>
+#include "DeltaPatch.h"
+#include "HeatshrinkDecoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum OtaImageFormat : uint8_t {
+    OTA_IMAGE_UNKNOWN,  // Chưa nhận byte nào
+    OTA_IMAGE_RAW,      // Image ESP32 đầy đủ, ghi thẳng vào partition
+    OTA_IMAGE_DELTA     // Patch áp dụng lên image đang chạy
+};
+
+// Turns the downloaded byte stream into the new firmware image: the format
+// is detected from the first bytes, a compressed stream is inflated on the
+// fly, then a full image is written as is and a delta patch is applied
+// against the running partition while it streams in.
+class OtaImage : public DeltaTarget {
+private:
+    Partition_Updater& updater;
+    IUpdater& writer;           // Ghi vào updater, có thể qua buffer của task ghi flash
+    HeatshrinkDecoder decompressor;
+    DeltaPatch delta;
+    OtaImageFormat format;
+    bool started;
+    bool compressed;
+    uint32_t transferSize;
+    uint32_t payloadSize;       // Kích thước image/patch sau khi giải nén
+    bool sourcePrepared;
+    uint32_t sourceImageSize;   // Image đang chạy, không đổi cho đến lần khởi động kế tiếp
+    uint32_t sourceImageCrc;
+
+    bool writePayload(uint8_t* data, size_t length);
+    static bool onDecompressed(void* context, uint8_t* data, size_t length);
+
+public:
+    OtaImage(Partition_Updater& updater, IUpdater& writer);
+
+    // format = OTA_IMAGE_RAW khi tiếp tục một lần tải đã ghi một phần (updater đã được resume)
+    void begin(uint32_t transferSize, OtaImageFormat format = OTA_IMAGE_UNKNOWN);
+    bool write(uint8_t* data, size_t length);
+    // Toàn bộ image mới đã được ghi vào partition, writer phải được flush trước
+    bool finished() const;
+    OtaImageFormat getFormat() const;
+    bool isCompressed() const;
+    // Chỉ image đầy đủ, không nén mới tiếp tục được từ giữa (bộ giải mã không lưu được trạng thái),
+    // patch hoặc image nén bị gián đoạn được tải lại từ đầu
+    bool resumable() const;
+    // Tính kích thước và CRC của image đang chạy một lần, gọi trên task OTA trước request đầu tiên
+    // vì đọc toàn bộ image quá lâu để chạy trong callback MQTT khi header của patch đến
+    bool prepareSource();
+
+    bool readSource(size_t offset, uint8_t* buffer, size_t length) override;
+    bool beginTarget(uint32_t sourceSize, uint32_t sourceCrc, uint32_t targetSize) override;
+    bool writeTarget(uint8_t* data, size_t length) override;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_IMAGE_H
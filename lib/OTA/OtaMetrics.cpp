@@ -0,0 +1,118 @@
+#include "OtaMetrics.h"
+
+OtaMetrics::OtaMetrics()
+    : startedMs(0), lastReportMs(0), lastReportBytes(0), active(false) {
+    memset(&metrics, 0, sizeof(metrics));
+    memset(requests, 0, sizeof(requests));
+}
+
+void OtaMetrics::begin(uint32_t totalBytes, uint32_t startOffset, uint32_t now) {
+    memset(&metrics, 0, sizeof(metrics));
+    memset(requests, 0, sizeof(requests));
+    metrics.totalBytes = totalBytes;
+    metrics.startOffset = startOffset;
+    metrics.writtenBytes = startOffset;
+    startedMs = now;
+    lastReportMs = now;
+    lastReportBytes = startOffset;
+    active = true;
+}
+
+void OtaMetrics::end() {
+    active = false;
+}
+
+bool OtaMetrics::isActive() const {
+    return active;
+}
+
+void OtaMetrics::onRequest(uint32_t index, uint32_t now) {
+    Request& request = requests[index % OTA_WINDOW_MAX];
+    metrics.requests++;
+    request.retried = request.pending && request.index == index;
+    request.index = index;
+    request.sentAt = now;
+    request.pending = true;
+}
+
+void OtaMetrics::onResponse(uint32_t index, uint32_t now) {
+    Request& request = requests[index % OTA_WINDOW_MAX];
+    if (!request.pending || request.index != index) {
+        return;
+    }
+    request.pending = false;
+    if (request.retried) {
+        return;
+    }
+    uint32_t latency = now - request.sentAt;
+    metrics.latencyLastMs = latency;
+    // Trung bình trượt 1/8 như SRTT của TCP
+    metrics.latencyAvgMs = metrics.latencyAvgMs == 0 ? latency : (metrics.latencyAvgMs * 7 + latency) / 8;
+    metrics.latencyMaxMs = max(metrics.latencyMaxMs, latency);
+}
+
+void OtaMetrics::onRetry() {
+    metrics.retries++;
+}
+
+void OtaMetrics::onWrite(uint32_t durationUs) {
+    metrics.writeMaxUs = max(metrics.writeMaxUs, durationUs);
+}
+
+void OtaMetrics::onProgress(uint32_t writtenBytes) {
+    metrics.writtenBytes = writtenBytes;
+}
+
+void OtaMetrics::onFlashStats(uint32_t bytes, uint32_t ms, uint32_t stalls, uint32_t stallMs) {
+    metrics.flashBytes = bytes;
+    metrics.flashMs = ms;
+    metrics.flashStalls = stalls;
+    metrics.flashStallMs = stallMs;
+}
+
+void OtaMetrics::update(uint32_t now) {
+    metrics.elapsedMs = now - startedMs;
+    uint32_t downloaded = metrics.writtenBytes - metrics.startOffset;
+    metrics.throughput = metrics.elapsedMs > 0 ? (uint32_t)((uint64_t)downloaded * 1000 / metrics.elapsedMs) : 0;
+
+    uint32_t interval = now - lastReportMs;
+    if (interval > 0) {
+        uint32_t rate = (uint32_t)((uint64_t)(metrics.writtenBytes - lastReportBytes) * 1000 / interval);
+        metrics.recentThroughput = metrics.recentThroughput == 0 ? rate : (metrics.recentThroughput * 3 + rate) / 4;
+    }
+    lastReportMs = now;
+    lastReportBytes = metrics.writtenBytes;
+
+    uint32_t rate = metrics.recentThroughput > 0 ? metrics.recentThroughput : metrics.throughput;
+    uint32_t remaining = metrics.totalBytes > metrics.writtenBytes ? metrics.totalBytes - metrics.writtenBytes : 0;
+    metrics.etaSec = rate > 0 ? (remaining + rate - 1) / rate : 0;
+}
+
+bool OtaMetrics::report(uint32_t now, char* payload, size_t size, bool force) {
+    if (!active || (!force && now - lastReportMs < OTA_METRICS_INTERVAL)) {
+        return false;
+    }
+    update(now);
+
+    uint32_t permille = metrics.totalBytes > 0 ? (uint32_t)((uint64_t)metrics.writtenBytes * 1000 / metrics.totalBytes) : 0;
+    snprintf(payload, size,
+             "{\"otaProgress\":%lu.%lu,\"otaBytes\":%lu,\"otaThroughput\":%lu,\"otaThroughputRecent\":%lu,"
+             "\"otaEta\":%lu,\"otaLatency\":%lu,\"otaLatencyAvg\":%lu,\"otaLatencyMax\":%lu,"
+             "\"otaRequests\":%lu,\"otaRetries\":%lu,\"otaWriteMaxUs\":%lu,"
+             "\"otaFlashMs\":%lu,\"otaFlashStalls\":%lu,\"otaFlashStallMs\":%lu}",
+             (unsigned long)(permille / 10), (unsigned long)(permille % 10), (unsigned long)metrics.writtenBytes,
+             (unsigned long)metrics.throughput, (unsigned long)metrics.recentThroughput,
+             (unsigned long)metrics.etaSec, (unsigned long)metrics.latencyLastMs,
+             (unsigned long)metrics.latencyAvgMs, (unsigned long)metrics.latencyMaxMs,
+             (unsigned long)metrics.requests, (unsigned long)metrics.retries, (unsigned long)metrics.writeMaxUs,
+             (unsigned long)metrics.flashMs, (unsigned long)metrics.flashStalls, (unsigned long)metrics.flashStallMs);
+
+    // Giá trị lớn nhất được tính lại trong mỗi chu kỳ
+    metrics.latencyMaxMs = 0;
+    metrics.writeMaxUs = 0;
+    return true;
+}
+
+const OtaMetricsData& OtaMetrics::getMetrics() const {
+    return metrics;
+}
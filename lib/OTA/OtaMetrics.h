@@ -0,0 +1,87 @@
+#ifndef OTA_METRICS_H
+#define OTA_METRICS_H
+
+#include <Arduino.h>
+#include "OtaWindow.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Chu kỳ gửi telemetry tiến độ OTA (ms)
+#ifndef OTA_METRICS_INTERVAL
+#define OTA_METRICS_INTERVAL 10000
+#endif
+
+// Progress and timing of the running download, published as telemetry
+struct OtaMetricsData {
+    uint32_t totalBytes;
+    uint32_t writtenBytes;
+    uint32_t startOffset;         // Byte đã có sẵn khi tiếp tục từ checkpoint
+    uint32_t elapsedMs;
+    uint32_t throughput;          // B/s tính từ lúc bắt đầu (không tính phần tiếp tục)
+    uint32_t recentThroughput;    // B/s làm mượt theo các chu kỳ báo cáo
+    uint32_t etaSec;              // 0 = chưa ước lượng được
+    uint32_t requests;
+    uint32_t retries;
+    uint32_t latencyLastMs;       // Từ lúc gửi request đến khi nhận chunk, bỏ qua chunk được gửi lại
+    uint32_t latencyAvgMs;        // Trung bình trượt
+    uint32_t latencyMaxMs;        // Lớn nhất trong chu kỳ báo cáo
+    uint32_t writeMaxUs;          // Thời gian xử lý (hash, giải nén, sao chép) lớn nhất của một chunk trong chu kỳ
+    uint32_t flashBytes;
+    uint32_t flashMs;
+    uint32_t flashStalls;
+    uint32_t flashStallMs;
+};
+
+// Collects per-chunk latency, handler and flash timing, retries, throughput
+// and the ETA of an OTA download, and formats them as a telemetry payload at
+// most once per OTA_METRICS_INTERVAL so a slow rollout can be diagnosed from
+// the dashboard without a serial console.
+class OtaMetrics {
+private:
+    struct Request {
+        uint32_t index;
+        uint32_t sentAt;
+        bool retried;             // Không biết response thuộc request nào, không lấy mẫu độ trễ
+        bool pending;
+    };
+
+    OtaMetricsData metrics;
+    Request requests[OTA_WINDOW_MAX];
+    uint32_t startedMs;
+    uint32_t lastReportMs;
+    uint32_t lastReportBytes;
+    bool active;
+
+    void update(uint32_t now);
+
+public:
+    OtaMetrics();
+
+    void begin(uint32_t totalBytes, uint32_t startOffset, uint32_t now);
+    void end();
+    bool isActive() const;
+
+    // Request chunk index vừa được gửi (lần đầu hoặc gửi lại)
+    void onRequest(uint32_t index, uint32_t now);
+    // Nhận được chunk index
+    void onResponse(uint32_t index, uint32_t now);
+    // Request hết hạn hoặc chunk sai kích thước
+    void onRetry();
+    // Một khối dữ liệu đã được xử lý trong durationUs
+    void onWrite(uint32_t durationUs);
+    // Vị trí ghi hiện tại trong image
+    void onProgress(uint32_t writtenBytes);
+    void onFlashStats(uint32_t bytes, uint32_t ms, uint32_t stalls, uint32_t stallMs);
+
+    // Tạo payload telemetry nếu đã đến chu kỳ báo cáo (hoặc force), false nếu chưa đến hạn
+    bool report(uint32_t now, char* payload, size_t size, bool force = false);
+    const OtaMetricsData& getMetrics() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_METRICS_H
@@ -0,0 +1,210 @@
+#include "OtaWindow.h"
+
+OtaWindow::OtaWindow()
+    : writer(nullptr), buffers(nullptr), freeBuffers(0), totalSize(0), totalChunks(0),
+      chunkSize(0), pendingChunkSize(0), bufferSize(0), window(1), base(0), next(0), retries(0), generation(0) {
+}
+
+OtaWindow::~OtaWindow() {
+    end();
+}
+
+bool OtaWindow::begin(uint32_t totalSize, uint16_t chunkSize, uint8_t window, OtaChunkWriter writer,
+                      uint32_t firstChunk, uint16_t maxChunkSize) {
+    end();
+    if (totalSize == 0 || chunkSize == 0 || writer == nullptr) {
+        return false;
+    }
+    window = constrain(window, 1, OTA_WINDOW_MAX);
+    bufferSize = max(chunkSize, maxChunkSize);
+
+    // Chunk ở vị trí ghi luôn được ghi thẳng, chỉ các chunk đến sớm cần buffer
+    if (window > 1) {
+        buffers = (uint8_t*)malloc((size_t)(window - 1) * bufferSize);
+        if (buffers == nullptr) {
+            Serial.printf("OTA window: không đủ bộ nhớ cho %u chunk, tải tuần tự\n", window - 1);
+            window = 1;
+        }
+    }
+
+    this->writer = writer;
+    this->totalSize = totalSize;
+    this->chunkSize = chunkSize;
+    pendingChunkSize = chunkSize;
+    this->window = window;
+    totalChunks = (totalSize + chunkSize - 1) / chunkSize;
+    freeBuffers = (1U << (window - 1)) - 1;
+    base = min(firstChunk, totalChunks);
+    next = base;
+    retries = 0;
+    generation = 0;
+    return true;
+}
+
+void OtaWindow::end() {
+    free(buffers);
+    buffers = nullptr;
+    freeBuffers = 0;
+    totalChunks = 0;
+    base = 0;
+    next = 0;
+}
+
+uint16_t OtaWindow::expectedLength(uint32_t index) const {
+    uint32_t remaining = totalSize - index * chunkSize;
+    return remaining < chunkSize ? remaining : chunkSize;
+}
+
+void OtaWindow::setChunkSize(uint16_t chunkSize) {
+    if (chunkSize > 0 && chunkSize <= bufferSize) {
+        pendingChunkSize = chunkSize;
+    }
+}
+
+uint16_t OtaWindow::getChunkSize() const {
+    return chunkSize;
+}
+
+uint32_t OtaWindow::getGeneration() const {
+    return generation;
+}
+
+// false khi đang chờ các chunk cũ để đổi kích thước: không gửi request mới
+bool OtaWindow::applyChunkSize() {
+    if (pendingChunkSize == chunkSize) {
+        return true;
+    }
+    if (pendingChunkSize < chunkSize && base < next && (base * chunkSize) % pendingChunkSize == 0) {
+        // Giảm kích thước: chunk lớn đang tải có thể không bao giờ tới (ví dụ bị gateway bỏ),
+        // bỏ các chunk chưa ghi và yêu cầu lại từ vị trí ghi với kích thước mới
+        freeBuffers = (1U << (window - 1)) - 1;
+        next = base;
+    }
+    if (next >= totalChunks) {
+        return true;
+    }
+    uint32_t position = next * chunkSize;
+    if (position % pendingChunkSize != 0) {
+        // Tăng kích thước: tiếp tục với kích thước cũ đến vị trí chia hết
+        return true;
+    }
+    if (base < next) {
+        return false;
+    }
+    chunkSize = pendingChunkSize;
+    totalChunks = (totalSize + chunkSize - 1) / chunkSize;
+    base = next = position / chunkSize;
+    generation++;
+    return true;
+}
+
+int32_t OtaWindow::nextRequest(uint32_t now, uint32_t timeoutMs) {
+    // 0 được dùng làm đánh dấu "yêu cầu lại ngay"
+    now = max(now, (uint32_t)1);
+    for (uint32_t i = base; i < next; i++) {
+        Slot& slot = slots[i % window];
+        if (slot.state == SLOT_REQUESTED && (slot.requestedAt == 0 || now - slot.requestedAt >= timeoutMs)) {
+            slot.requestedAt = now;
+            retries++;
+            return i;
+        }
+    }
+    if (applyChunkSize() && next < totalChunks && next < base + window) {
+        Slot& slot = slots[next % window];
+        slot.state = SLOT_REQUESTED;
+        slot.length = 0;
+        slot.requestedAt = now;
+        return next++;
+    }
+    return -1;
+}
+
+uint32_t OtaWindow::msUntilTimeout(uint32_t now, uint32_t timeoutMs) const {
+    bool resizing = pendingChunkSize != chunkSize && base < next && (next * chunkSize) % pendingChunkSize == 0;
+    if (!resizing && next < totalChunks && next < base + window) {
+        return 0;
+    }
+    uint32_t waitMs = timeoutMs;
+    for (uint32_t i = base; i < next; i++) {
+        const Slot& slot = slots[i % window];
+        if (slot.state != SLOT_REQUESTED) {
+            continue;
+        }
+        uint32_t elapsed = now - slot.requestedAt;
+        if (slot.requestedAt == 0 || elapsed >= timeoutMs) {
+            return 0;
+        }
+        waitMs = min(waitMs, timeoutMs - elapsed);
+    }
+    return waitMs;
+}
+
+OtaChunkResult OtaWindow::onChunk(uint32_t index, uint8_t* data, size_t length) {
+    if (index < base || index >= next) {
+        return OTA_CHUNK_IGNORED;
+    }
+    Slot& slot = slots[index % window];
+    if (slot.state == SLOT_RECEIVED) {
+        return OTA_CHUNK_IGNORED;
+    }
+    if (length != expectedLength(index)) {
+        slot.requestedAt = 0;
+        return OTA_CHUNK_RETRY;
+    }
+
+    if (index != base) {
+        // Đến sớm: giữ lại cho đến khi các chunk phía trước tới
+        uint8_t buffer = 0;
+        while (buffer < window - 1 && !(freeBuffers & (1U << buffer))) {
+            buffer++;
+        }
+        if (buffer >= window - 1) {
+            return OTA_CHUNK_IGNORED;
+        }
+        freeBuffers &= ~(1U << buffer);
+        memcpy(buffers + (size_t)buffer * bufferSize, data, length);
+        slot.state = SLOT_RECEIVED;
+        slot.buffer = buffer;
+        slot.length = length;
+        return OTA_CHUNK_BUFFERED;
+    }
+
+    if (!writer(data, length)) {
+        return OTA_CHUNK_WRITE_FAILED;
+    }
+    base++;
+    return flush() ? OTA_CHUNK_WRITTEN : OTA_CHUNK_WRITE_FAILED;
+}
+
+bool OtaWindow::flush() {
+    while (base < next && slots[base % window].state == SLOT_RECEIVED) {
+        Slot& slot = slots[base % window];
+        if (!writer(buffers + (size_t)slot.buffer * bufferSize, slot.length)) {
+            return false;
+        }
+        freeBuffers |= 1U << slot.buffer;
+        slot.state = SLOT_REQUESTED;
+        base++;
+    }
+    return true;
+}
+
+bool OtaWindow::complete() const {
+    return totalChunks > 0 && base >= totalChunks;
+}
+
+uint32_t OtaWindow::inFlight() const {
+    return next - base;
+}
+
+uint32_t OtaWindow::writtenChunks() const {
+    return base;
+}
+
+uint32_t OtaWindow::writtenBytes() const {
+    return min(base * chunkSize, totalSize);
+}
+
+uint32_t OtaWindow::getRetries() const {
+    return retries;
+}
@@ -0,0 +1,100 @@
+#ifndef OTA_WINDOW_H
+#define OTA_WINDOW_H
+
+#include <Arduino.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Số chunk được yêu cầu đồng thời, 1 = tải tuần tự như trước
+#ifndef OTA_WINDOW_SIZE
+#define OTA_WINDOW_SIZE 4
+#endif
+#define OTA_WINDOW_MAX 8
+
+// Ghi dữ liệu firmware tuần tự, trả về false nếu ghi thất bại
+typedef bool (*OtaChunkWriter)(uint8_t* data, size_t length);
+
+enum OtaChunkResult : uint8_t {
+    OTA_CHUNK_WRITTEN,      // Chunk (và các chunk đã đệm phía sau) đã được ghi
+    OTA_CHUNK_BUFFERED,     // Chunk đến sớm, đang chờ các chunk trước
+    OTA_CHUNK_IGNORED,      // Chunk trùng lặp hoặc nằm ngoài cửa sổ
+    OTA_CHUNK_RETRY,        // Kích thước sai, chunk sẽ được yêu cầu lại
+    OTA_CHUNK_WRITE_FAILED
+};
+
+// Sliding-window chunk downloader: keeps up to `window` chunk requests in
+// flight, parks responses that arrive ahead of the write position in a small
+// reassembly buffer and hands the data to the writer strictly in order, so
+// throughput is bounded by the link instead of one round trip per chunk.
+class OtaWindow {
+private:
+    enum SlotState : uint8_t {
+        SLOT_REQUESTED,
+        SLOT_RECEIVED
+    };
+    struct Slot {
+        SlotState state;
+        uint8_t buffer;         // Index của buffer đệm khi state == SLOT_RECEIVED
+        uint16_t length;
+        uint32_t requestedAt;   // 0 = cần yêu cầu lại ngay
+    };
+
+    OtaChunkWriter writer;
+    uint8_t* buffers;           // (window - 1) buffer, chunk đúng thứ tự được ghi thẳng
+    uint8_t freeBuffers;        // Bitmask các buffer còn trống
+    Slot slots[OTA_WINDOW_MAX]; // Slot của chunk i là slots[i % window]
+    uint32_t totalSize;
+    uint32_t totalChunks;
+    uint16_t chunkSize;
+    uint16_t pendingChunkSize;  // Kích thước sẽ dùng khi cửa sổ được đổi kích thước
+    uint16_t bufferSize;        // Kích thước chunk lớn nhất, quyết định buffer đệm
+    uint8_t window;
+    uint32_t base;              // Chunk kế tiếp cần ghi
+    uint32_t next;              // Chunk kế tiếp chưa từng được yêu cầu
+    uint32_t retries;
+    uint32_t generation;        // Tăng mỗi lần đổi kích thước chunk
+
+    uint16_t expectedLength(uint32_t index) const;
+    bool flush();
+    bool applyChunkSize();
+
+public:
+    OtaWindow();
+    ~OtaWindow();
+
+    // Cấp phát buffer đệm, bắt đầu từ chunk firstChunk (các chunk trước đó đã được ghi).
+    // maxChunkSize: kích thước lớn nhất setChunkSize() có thể dùng, 0 = chunkSize
+    bool begin(uint32_t totalSize, uint16_t chunkSize, uint8_t window, OtaChunkWriter writer,
+               uint32_t firstChunk = 0, uint16_t maxChunkSize = 0);
+    void end();
+
+    // Đổi kích thước chunk cho các request sau. Chỉ số chunk phụ thuộc kích thước nên
+    // thay đổi được áp dụng khi vị trí yêu cầu chia hết cho kích thước mới và mọi
+    // chunk đang tải đã được ghi; cho đến lúc đó các chunk vẫn có kích thước cũ.
+    // Khi giảm kích thước, các chunk chưa ghi được bỏ và yêu cầu lại từ vị trí ghi.
+    void setChunkSize(uint16_t chunkSize);
+    uint16_t getChunkSize() const;
+    // Đổi mỗi khi kích thước mới được áp dụng: cùng chỉ số chunk giờ là vị trí khác trong image.
+    // Response của request gửi trước đó phải bị bỏ trước onChunk(), ví dụ bằng request id mới
+    uint32_t getGeneration() const;
+
+    // Chunk cần gửi request: chunk quá timeout trước, sau đó chunk mới nếu cửa sổ còn chỗ. -1 = không có
+    int32_t nextRequest(uint32_t now, uint32_t timeoutMs);
+    OtaChunkResult onChunk(uint32_t index, uint8_t* data, size_t length);
+    // Thời gian đến khi request cũ nhất hết hạn, 0 = có request cần gửi ngay
+    uint32_t msUntilTimeout(uint32_t now, uint32_t timeoutMs) const;
+
+    bool complete() const;
+    uint32_t inFlight() const;
+    uint32_t writtenChunks() const;
+    uint32_t writtenBytes() const;
+    uint32_t getRetries() const;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OTA_WINDOW_H
@@ -269,6 +269,7 @@ boolean PubSubClient::connect(const char *id, const char *user, const char *pass
                 if (buffer[3] == 0) {
                     lastInActivity = millis();
                     pingOutstanding = false;
+                    pingResponses = 0;
                     _state = MQTT_CONNECTED;
                     return true;
                 } else {
@@ -370,18 +371,20 @@ uint32_t PubSubClient::readPacket(uint8_t* lengthLength) {
 boolean PubSubClient::loop() {
     if (connected()) {
         unsigned long t = millis();
-        if ((t - lastInActivity > this->keepAlive*1000UL) || (t - lastOutActivity > this->keepAlive*1000UL)) {
+        unsigned long interval = (this->pingInterval ? this->pingInterval : this->keepAlive)*1000UL;
+        if (pingOutstanding && this->pingTimeout && (t - pingSentAt > this->pingTimeout)) {
+            // No PINGRESP within the expected round trip, the socket is half-open
+            this->_state = MQTT_CONNECTION_TIMEOUT;
+            _client->stop();
+            return false;
+        }
+        if ((t - lastInActivity > interval) || (t - lastOutActivity > interval)) {
             if (pingOutstanding) {
                 this->_state = MQTT_CONNECTION_TIMEOUT;
                 _client->stop();
                 return false;
             } else {
-                this->buffer[0] = MQTTPINGREQ;
-                this->buffer[1] = 0;
-                _client->write(this->buffer,2);
-                lastOutActivity = t;
-                lastInActivity = t;
-                pingOutstanding = true;
+                sendPing(t);
             }
         }
         if (_client->available()) {
@@ -421,6 +424,10 @@ boolean PubSubClient::loop() {
                     this->buffer[1] = 0;
                     _client->write(this->buffer,2);
                 } else if (type == MQTTPINGRESP) {
+                    if (pingOutstanding) {
+                        lastPingRtt = millis() - pingSentAt;
+                        pingResponses++;
+                    }
                     pingOutstanding = false;
                 }
             } else if (!connected()) {
@@ -767,3 +774,70 @@ PubSubClient& PubSubClient::setSocketTimeout(uint16_t timeout) {
     this->socketTimeout = timeout;
     return *this;
 }
+
+PubSubClient& PubSubClient::setPingInterval(uint16_t seconds) {
+    this->pingInterval = seconds;
+    return *this;
+}
+
+PubSubClient& PubSubClient::setPingTimeout(uint32_t timeoutMs) {
+    this->pingTimeout = timeoutMs;
+    return *this;
+}
+
+uint16_t PubSubClient::getKeepAlive() {
+    return this->keepAlive;
+}
+
+boolean PubSubClient::sendPing(unsigned long t) {
+    this->buffer[0] = MQTTPINGREQ;
+    this->buffer[1] = 0;
+    if (_client->write(this->buffer,2) != 2) {
+        return false;
+    }
+    lastOutActivity = t;
+    lastInActivity = t;
+    pingSentAt = t;
+    pingOutstanding = true;
+    return true;
+}
+
+boolean PubSubClient::ping() {
+    if (!connected()) {
+        return false;
+    }
+    if (pingOutstanding) {
+        return true;
+    }
+    return sendPing(millis());
+}
+
+boolean PubSubClient::isPingOutstanding() {
+    return pingOutstanding;
+}
+
+unsigned long PubSubClient::getLastPingRtt() {
+    return lastPingRtt;
+}
+
+uint32_t PubSubClient::getPingResponses() {
+    return pingResponses;
+}
+
+unsigned long PubSubClient::getLastInActivity() {
+    return lastInActivity;
+}
+
+unsigned long PubSubClient::msUntilKeepAlive() {
+    unsigned long t = millis();
+    unsigned long interval = (this->pingInterval ? this->pingInterval : this->keepAlive)*1000UL;
+    unsigned long due;
+    if (pingOutstanding && this->pingTimeout) {
+        due = pingSentAt + this->pingTimeout;
+    } else {
+        unsigned long last = (t - lastInActivity > t - lastOutActivity) ? lastInActivity : lastOutActivity;
+        due = last + interval + 1;
+    }
+    long remaining = (long)(due - t);
+    return remaining > 0 ? (unsigned long)remaining : 0;
+}
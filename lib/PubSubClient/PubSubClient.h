@@ -96,6 +96,13 @@ private:
    unsigned long lastOutActivity;
    unsigned long lastInActivity;
    bool pingOutstanding;
+   // Keepalive probing, see setPingInterval() / setPingTimeout()
+   uint16_t pingInterval = 0;
+   uint32_t pingTimeout = 0;
+   unsigned long pingSentAt = 0;
+   unsigned long lastPingRtt = 0;
+   uint32_t pingResponses = 0;
+   boolean sendPing(unsigned long t);
    MQTT_CALLBACK_SIGNATURE;
    uint32_t readPacket(uint8_t*);
    boolean readByte(uint8_t * result);
@@ -138,6 +145,13 @@ public:
    PubSubClient& setStream(Stream& stream);
    PubSubClient& setKeepAlive(uint16_t keepAlive);
    PubSubClient& setSocketTimeout(uint16_t timeout);
+   // Interval in seconds between PINGREQs while the link is idle, 0 uses keepAlive.
+   // Lets the client probe more often than the keepAlive advertised in CONNECT.
+   PubSubClient& setPingInterval(uint16_t seconds);
+   // Time in milliseconds to wait for PINGRESP before dropping the connection,
+   // 0 waits a full ping interval (original behaviour)
+   PubSubClient& setPingTimeout(uint32_t timeoutMs);
+   uint16_t getKeepAlive();
 
    boolean setBufferSize(uint16_t size);
    uint16_t getBufferSize();
@@ -177,6 +191,16 @@ public:
    boolean loop();
    boolean connected();
    int state();
+   // Send a PINGREQ now, unless one is already outstanding
+   boolean ping();
+   boolean isPingOutstanding();
+   // Round trip time of the last PINGREQ/PINGRESP exchange in milliseconds
+   unsigned long getLastPingRtt();
+   // Number of PINGRESPs received since the last connect, grows with each new RTT sample
+   uint32_t getPingResponses();
+   unsigned long getLastInActivity();
+   // Milliseconds until loop() has keepalive work to do (send a ping or time one out)
+   unsigned long msUntilKeepAlive();
 
 };
 
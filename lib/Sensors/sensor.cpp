@@ -628,6 +628,7 @@
 #include <config.hpp>
 #include <Wire.h>
 #include <ArduinoJson.h>
+#include <BootValidator.h>
 
 // Global sensor objects - will be initialized with dynamic pins
 DHT* dht = nullptr;
@@ -674,6 +675,7 @@ void readDHT11(void *pvParameters) {
                     humidity = hum;
                     xSemaphoreGive(sensorDataMutex);
                 }
+                bootValidator.report(BOOT_PROBE_SENSORS);
                 Serial.printf("[%s] Nhiệt độ: %.2f °C | Độ ẩm: %.2f %%\n", config->deviceType, temp, hum);
             } else {
                 Serial.println("Lỗi! Không thể đọc từ DHT11.");
@@ -722,6 +724,7 @@ void readDHT20(void *pvParameters) {
                         humidity = hum;
                         xSemaphoreGive(sensorDataMutex);
                     }
+                    bootValidator.report(BOOT_PROBE_SENSORS);
                     Serial.printf("[%s] Nhiệt độ: %.2f °C | Độ ẩm: %.2f %%\n", config->deviceType, temp, hum);
                 } else {
                     Serial.println("Lỗi! Không thể đọc từ DHT20.");
@@ -770,9 +773,9 @@ void readMQ135(void *pvParameters) {
 
         Serial.printf("[%s] Chất lượng không khí (MQ135): %d (%s)\n", config->deviceType, airQuality, category.c_str());
 
-        if (mqttClient.connected()) {
+        if (mqttSession.connected()) {
             String telemetryPayload = "{\"air_quality\":" + String(airQuality) + ",\"air_quality_category\":\"" + category + "\"}";
-            mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+            mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
             Serial.printf("→ Sent air quality to ThingsBoard: %d (%s)\n", airQuality, category.c_str());
         }
 
@@ -844,9 +847,9 @@ void peopleCountingTask(void *pvParameters) {
 
             Serial.printf("Mật độ dân số: %.2f người/m² (%s)\n", density, densityLevel.c_str());
 
-            if (mqttClient.connected()) {
+            if (mqttSession.connected()) {
                 String telemetryPayload = "{\"density\":" + String(density, 2) + ",\"densityLevel\":\"" + densityLevel + "\"}";
-                mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+                mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
                 Serial.println("→ Sent density data to ThingsBoard");
             }
         }
@@ -890,13 +893,13 @@ void carslotTask(void *pvParameters) {
                 Serial.printf("[Slot %s] Distance: %.2f cm, Occupied: %s\n",
                               SLOT_NAMES[slotIndex], distance, currentState ? "true" : "false");
 
-                if (currentState != CarDetected[slotIndex] && mqttClient.connected()) {
+                if (currentState != CarDetected[slotIndex] && mqttSession.connected()) {
                     String telemetryPayload = "{\"";
                     telemetryPayload += SLOT_NAMES[slotIndex];
                     telemetryPayload += "\":\"";
                     telemetryPayload += currentState ? "true" : "false";
                     telemetryPayload += "\"}";
-                    mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+                    mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
                     CarDetected[slotIndex] = currentState;
                     parkingStateChanged = true;
                     Serial.printf("→ Sent telemetry: %s = %s\n", SLOT_NAMES[slotIndex], currentState ? "occupied" : "free");
@@ -963,8 +966,8 @@ void pirTask(void *pvParameters) {
                 motionDetected = true;
                 continuousMotionReported = true;
 
-                if (mqttClient.connected()) {
-                    mqttClient.publish("v1/devices/me/telemetry", "{\"motion\":\"true\"}");
+                if (mqttSession.connected()) {
+                    mqttSession.publish("v1/devices/me/telemetry", "{\"motion\":\"true\"}");
                     Serial.println("→ Sent continuous motion to ThingsBoard");
                 }
             }
@@ -981,8 +984,8 @@ void pirTask(void *pvParameters) {
             if (previousMotionState) {
                 Serial.printf("[%s] Không phát hiện chuyển động\n", config->deviceType);
                 motionDetected = false;
-                if (mqttClient.connected()) {
-                    mqttClient.publish("v1/devices/me/telemetry", "{\"motion\":\"false\"}");
+                if (mqttSession.connected()) {
+                    mqttSession.publish("v1/devices/me/telemetry", "{\"motion\":\"false\"}");
                     Serial.println("→ Sent no motion to ThingsBoard");
                 }
             }
@@ -1072,10 +1075,10 @@ void rfidTask(void *pvParameters) {
 
         Serial.printf("RFID Card detected - UID: %s\n", cardUID.c_str());
 
-        if (mqttClient.connected()) {
+        if (mqttSession.connected()) {
             String telemetryPayload = "{\"rfid_card_uid\":\"" + cardUID + "\",\"rfid_access_time\":" +
                                      String(currentTime / 1000) + ",\"rfid_status\":\"card_detected\"}";
-            mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+            mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
             Serial.printf("→ Sent RFID data to ThingsBoard: UID=%s\n", cardUID.c_str());
         } else {
             Serial.println("ThingsBoard not connected - RFID data not sent");
@@ -1156,7 +1159,7 @@ void updateParkingStats() {
 void sendParkingDataToThingsBoard() {
     const DeviceConfig* config = getCurrentConfig();
 
-    if (!config->hasUltrasonic || !mqttClient.connected()) {
+    if (!config->hasUltrasonic || !mqttSession.connected()) {
         return;
     }
 
@@ -1178,7 +1181,7 @@ void sendParkingDataToThingsBoard() {
                              ",\"available_slots\":" + String(availableSlots) +
                              ",\"occupancy_rate\":" + String(currentOccupancyRate, 1) +
                              ",\"parking_status\":\"" + parkingStatus + "\"}";
-    mqttClient.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
+    mqttSession.publish("v1/devices/me/telemetry", telemetryPayload.c_str());
     Serial.printf("→ Sent parking stats to ThingsBoard: %d available, %.1f%% occupied (%s) - Slot A1 only\n",
                   availableSlots, currentOccupancyRate, parkingStatus.c_str());
 }
\ No newline at end of file
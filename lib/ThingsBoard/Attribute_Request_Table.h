@@ -0,0 +1,241 @@
+#ifndef Attribute_Request_Table_h
+#define Attribute_Request_Table_h
+
+// Local includes.
+#include "Attribute_Request_Callback.h"
+#if !THINGSBOARD_ENABLE_STL
+#include "Vector.h"
+#endif // !THINGSBOARD_ENABLE_STL
+
+// Library includes.
+#include <stddef.h>
+#include <utility>
+#if THINGSBOARD_ENABLE_STL
+#include <vector>
+#endif // THINGSBOARD_ENABLE_STL
+
+
+/// @brief Pending client-side or shared attribute requests, stored in a ring of slots indexed by their request id modulo the amount of slots.
+/// Request ids are handed out by the table itself and skip every id whose slot is still taken, therefore a response is matched to its callback
+/// by looking at a single slot, instead of comparing the id of every pending request.
+/// A request for multiple scopes stores one callback per scope in consecutive slots, all with the same request id, because the server answers them with one response.
+/// Slots are free if the request id of their callback is 0, which is never handed out
+/// @tparam InlineCapacity Amount of slots stored inside of the instance itself in non STL mode, more slots are allocated on the heap, default = 0
+template <size_t InlineCapacity = 0U>
+class Attribute_Request_Table {
+  public:
+    /// @brief Maximum amount of callbacks answered by the same response, one for the client-side and one for the shared scope
+    static constexpr size_t MAX_SCOPES = 2U;
+
+    /// @brief Constructs an empty table without any slots
+    inline Attribute_Request_Table() :
+        m_slots(),
+        m_size(0U)
+    {
+        // Nothing to do
+    }
+
+    /// @brief Whether any request is still waiting for its response
+    /// @return Whether no callback is stored
+    inline bool empty() const {
+        return m_size == 0U;
+    }
+
+    /// @brief Amount of stored callbacks over all pending requests
+    /// @return Amount of taken slots
+    inline const size_t& size() const {
+        return m_size;
+    }
+
+    /// @brief Amount of slots, which is the maximum amount of callbacks that can be pending at once, unless THINGSBOARD_ENABLE_DYNAMIC grows the table
+    /// @return Amount of slots
+    inline size_t capacity() const {
+        return m_slots.size();
+    }
+
+    /// @brief Creates the given amount of free slots, only has an effect while no request is pending and the table has less slots
+    /// @param capacity Amount of slots the table should have
+    inline void reserve(const size_t& capacity) {
+        if (m_size != 0U || capacity <= m_slots.size()) {
+            return;
+        }
+        m_slots.clear();
+        m_slots.reserve(capacity);
+        while (m_slots.size() < capacity) {
+            m_slots.push_back(Attribute_Request_Callback());
+        }
+    }
+
+    /// @brief Stores copies of the given callbacks under a new request id, in consecutive slots
+    /// @param callbacks Callbacks that are answered by the same response
+    /// @param response_keys Key of the scope each callback receives its attributes from, "client" or "shared"
+    /// @param count Amount of callbacks, at most MAX_SCOPES
+    /// @param request_id Last request id that was handed out, receives the request id the callbacks are stored under
+    /// @return Whether enough consecutive slots were free
+    inline bool insert(const Attribute_Request_Callback * const *callbacks, const char * const *response_keys, const size_t& count, size_t& request_id) {
+        if (count == 0U || count > MAX_SCOPES) {
+            return false;
+        }
+        size_t id = 0U;
+        if (!find_free(count, request_id, id)) {
+#if THINGSBOARD_ENABLE_DYNAMIC
+            grow(count);
+            if (!find_free(count, request_id, id)) {
+                return false;
+            }
+#else
+            return false;
+#endif // THINGSBOARD_ENABLE_DYNAMIC
+        }
+
+        const size_t slots = m_slots.size();
+        for (size_t i = 0U; i < count; i++) {
+            Attribute_Request_Callback& slot = m_slots[slot_index(id, i, slots)];
+            slot = *callbacks[i];
+            slot.Set_Request_ID(id);
+            slot.Set_Attribute_Key(response_keys[i]);
+        }
+        m_size += count;
+        request_id = id;
+        return true;
+    }
+
+    /// @brief Removes the first remaining callback stored under the given request id, call repeatedly to receive the callbacks of every requested scope
+    /// @param request_id Request id received with the response
+    /// @param callback Receives a copy of the removed callback
+    /// @return Whether a callback was stored under the given request id
+    inline bool take(const size_t& request_id, Attribute_Request_Callback& callback) {
+        const size_t slots = m_slots.size();
+        if (request_id == 0U || slots == 0U) {
+            return false;
+        }
+        for (size_t i = 0U; i < MAX_SCOPES && i < slots; i++) {
+            Attribute_Request_Callback& slot = m_slots[slot_index(request_id, i, slots)];
+            if (slot.Get_Request_ID() != request_id) {
+                continue;
+            }
+            callback = slot;
+            slot = Attribute_Request_Callback();
+            m_size--;
+            return true;
+        }
+        return false;
+    }
+
+    /// @brief Removes every callback stored under the given request id, used if the request could not be sent
+    /// @param request_id Request id the callbacks were stored under
+    inline void remove(const size_t& request_id) {
+        Attribute_Request_Callback callback;
+        while (take(request_id, callback)) {
+            // Nothing to do
+        }
+    }
+
+    /// @brief Frees all slots, but keeps the amount of slots
+    inline void clear() {
+        for (size_t i = 0U; i < m_slots.size(); i++) {
+            m_slots[i] = Attribute_Request_Callback();
+        }
+        m_size = 0U;
+    }
+
+  private:
+#if THINGSBOARD_ENABLE_STL
+    using Slots = std::vector<Attribute_Request_Callback>;
+#else
+    using Slots = Vector<Attribute_Request_Callback, InlineCapacity>;
+#endif // THINGSBOARD_ENABLE_STL
+
+    /// @brief Slot of the callback with the given position inside of its request.
+    /// The request id is reduced before adding the position, because request id + position wraps around to 0 for the last ids,
+    /// which would put both scopes of the request into the same slot if the amount of slots is not a power of two
+    /// @param request_id Request id the callback is stored under
+    /// @param position Position of the callback inside of its request, 0 for the first scope
+    /// @param slots Amount of slots in the ring
+    /// @return Index of the slot
+    static inline size_t slot_index(const size_t& request_id, const size_t& position, const size_t& slots) {
+        return (request_id % slots + position) % slots;
+    }
+
+    /// @brief Searches the next request id after the given one, whose slot and the slots following it are free
+    /// @param count Amount of consecutive slots that have to be free
+    /// @param request_id Last request id that was handed out
+    /// @param id Receives the found request id
+    /// @return Whether a request id with enough free consecutive slots was found
+    inline bool find_free(const size_t& count, const size_t& request_id, size_t& id) const {
+        const size_t slots = m_slots.size();
+        if (slots < count) {
+            return false;
+        }
+        size_t candidate = request_id;
+        for (size_t tries = 0U; tries < slots; tries++) {
+            candidate++;
+            // 0 marks free slots and is therefore never handed out
+            if (candidate == 0U) {
+                candidate++;
+            }
+            bool free = true;
+            for (size_t i = 0U; i < count && free; i++) {
+                free = m_slots[slot_index(candidate, i, slots)].Get_Request_ID() == 0U;
+            }
+            if (free) {
+                id = candidate;
+                return true;
+            }
+        }
+        return false;
+    }
+
+#if THINGSBOARD_ENABLE_DYNAMIC
+    /// @brief Increases the amount of slots and moves the pending callbacks to the slots of their request id in the bigger ring,
+    /// keeps doubling the amount of slots if two pending request ids would map onto the same slot
+    /// @param count Amount of consecutive slots the next request requires
+    inline void grow(const size_t& count) {
+        const size_t slots = m_slots.size();
+        size_t capacity = slots * 2U;
+        if (capacity < slots + count) {
+            capacity = slots + count;
+        }
+
+        Slots grown;
+        while (!rehash(grown, capacity)) {
+            capacity *= 2U;
+        }
+        m_slots = std::move(grown);
+    }
+
+    /// @brief Copies all pending callbacks into the given slots
+    /// @param grown Slots the pending callbacks are copied into, are cleared and filled with the given amount of free slots first
+    /// @param capacity Amount of slots
+    /// @return Whether every pending callback received its own slot
+    inline bool rehash(Slots& grown, const size_t& capacity) const {
+        grown.clear();
+        grown.reserve(capacity);
+        while (grown.size() < capacity) {
+            grown.push_back(Attribute_Request_Callback());
+        }
+
+        const size_t slots = m_slots.size();
+        for (size_t i = 0U; i < slots; i++) {
+            const Attribute_Request_Callback& slot = m_slots[i];
+            const size_t id = slot.Get_Request_ID();
+            if (id == 0U) {
+                continue;
+            }
+            // Keep the position of the callback inside of its request, so the scopes stay in consecutive slots
+            const size_t offset = (i + slots - (id % slots)) % slots;
+            Attribute_Request_Callback& target = grown[slot_index(id, offset, capacity)];
+            if (target.Get_Request_ID() != 0U) {
+                return false;
+            }
+            target = slot;
+        }
+        return true;
+    }
+#endif // THINGSBOARD_ENABLE_DYNAMIC
+
+    Slots m_slots; // Ring of callbacks, indexed by their request id modulo the amount of slots
+    size_t m_size; // Amount of slots that are taken
+};
+
+#endif // Attribute_Request_Table_h
@@ -0,0 +1,229 @@
+// Header include.
+#include "Buffered_Updater.h"
+
+#if THINGSBOARD_ENABLE_OTA
+
+#if THINGSBOARD_USE_FREERTOS
+
+// Library include.
+#include <string.h>
+#include <algorithm>
+#include <new>
+
+
+/// @brief Buffer handed from write() to the writer task
+struct Flash_Block {
+    uint8_t index;  // Index of the buffer in m_buffers or STOP_WRITER_TASK
+    size_t length;  // Amount of bytes in the buffer
+};
+
+/// @brief Index that makes the writer task stop after all previous buffers have been written
+constexpr uint8_t STOP_WRITER_TASK = 2U;
+
+Buffered_Updater::Buffered_Updater(IUpdater& updater, const size_t& buffer_size, const uint32_t& stack_size, const UBaseType_t& priority) :
+    m_updater(updater),
+    m_buffer_size(buffer_size),
+    m_stack_size(stack_size),
+    m_priority(priority),
+    m_buffers{nullptr, nullptr},
+    m_current(0U),
+    m_fill(0U),
+    m_blocks(nullptr),
+    m_free(nullptr),
+    m_task(nullptr),
+    m_failed(false),
+    m_flash_bytes(0U),
+    m_flash_time(0U),
+    m_stalls(0U),
+    m_stall_time(0U)
+{
+    // Nothing to do
+}
+
+Buffered_Updater::~Buffered_Updater() {
+    m_fill = 0U;
+    stop();
+}
+
+bool Buffered_Updater::begin(const size_t& firmware_size) {
+    if (m_task != nullptr) {
+        m_fill = 0U;
+        wait_idle();
+    }
+    clear_statistics();
+    return m_updater.begin(firmware_size);
+}
+
+size_t Buffered_Updater::write(uint8_t* payload, const size_t& total_bytes) {
+    if (m_failed || !start()) {
+        return 0U;
+    }
+
+    size_t copied = 0U;
+    while (copied < total_bytes) {
+        const size_t length = std::min(total_bytes - copied, m_buffer_size - m_fill);
+        memcpy(m_buffers[m_current] + m_fill, payload + copied, length);
+        m_fill += length;
+        copied += length;
+        if (m_fill == m_buffer_size) {
+            submit();
+        }
+    }
+    return m_failed ? 0U : total_bytes;
+}
+
+void Buffered_Updater::reset() {
+    // Data that has not been handed to the writer task yet is simply discarded
+    m_fill = 0U;
+    stop();
+    m_updater.reset();
+    clear_statistics();
+}
+
+bool Buffered_Updater::end() {
+    const bool flushed = flush();
+    stop();
+    if (!flushed) {
+        m_updater.reset();
+        return false;
+    }
+    return m_updater.end();
+}
+
+bool Buffered_Updater::flush() {
+    if (m_task != nullptr) {
+        submit();
+        wait_idle();
+    }
+    return !m_failed;
+}
+
+size_t Buffered_Updater::get_flash_bytes() const {
+    return m_flash_bytes;
+}
+
+uint32_t Buffered_Updater::get_flash_time_ms() const {
+    return m_flash_time * portTICK_PERIOD_MS;
+}
+
+uint32_t Buffered_Updater::get_stalls() const {
+    return m_stalls;
+}
+
+uint32_t Buffered_Updater::get_stall_time_ms() const {
+    return m_stall_time * portTICK_PERIOD_MS;
+}
+
+bool Buffered_Updater::start() {
+    if (m_task != nullptr) {
+        return true;
+    }
+
+    m_buffers[0] = new (std::nothrow) uint8_t[m_buffer_size];
+    m_buffers[1] = new (std::nothrow) uint8_t[m_buffer_size];
+    // Only the buffer that is not being filled can be owned by the writer task. The semaphore may briefly count both buffers,
+    // if the writer task finishes the previous and the just submitted buffer before submit() takes the semaphore
+    m_blocks = xQueueCreate(2U, sizeof(Flash_Block));
+    m_free = xSemaphoreCreateCounting(2U, 1U);
+    m_current = 0U;
+    m_fill = 0U;
+    if (m_buffers[0] != nullptr && m_buffers[1] != nullptr && m_blocks != nullptr && m_free != nullptr &&
+        xTaskCreate(writer_task, "OTA_Writer", m_stack_size, this, m_priority, &m_task) == pdPASS) {
+        return true;
+    }
+
+    m_task = nullptr;
+    stop();
+    return false;
+}
+
+void Buffered_Updater::stop() {
+    if (m_task != nullptr) {
+        submit();
+        // Waits for the last submitted buffer, afterwards the semaphore is free to be released once more by the writer task right before it deletes itself
+        (void)xSemaphoreTake(m_free, portMAX_DELAY);
+        const Flash_Block stop_block = { STOP_WRITER_TASK, 0U };
+        (void)xQueueSend(m_blocks, &stop_block, portMAX_DELAY);
+        (void)xSemaphoreTake(m_free, portMAX_DELAY);
+        m_task = nullptr;
+    }
+    if (m_blocks != nullptr) {
+        vQueueDelete(m_blocks);
+        m_blocks = nullptr;
+    }
+    if (m_free != nullptr) {
+        vSemaphoreDelete(m_free);
+        m_free = nullptr;
+    }
+    delete[] m_buffers[0];
+    delete[] m_buffers[1];
+    m_buffers[0] = nullptr;
+    m_buffers[1] = nullptr;
+    m_fill = 0U;
+}
+
+void Buffered_Updater::submit() {
+    if (m_fill == 0U) {
+        return;
+    }
+    const Flash_Block block = { m_current, m_fill };
+    (void)xQueueSend(m_blocks, &block, portMAX_DELAY);
+
+    // The other buffer may still be written by the writer task, if so we have to wait for it to finish
+    if (xSemaphoreTake(m_free, 0U) != pdTRUE) {
+        const TickType_t start = xTaskGetTickCount();
+        (void)xSemaphoreTake(m_free, portMAX_DELAY);
+        m_stall_time += xTaskGetTickCount() - start;
+        m_stalls++;
+    }
+    m_current ^= 1U;
+    m_fill = 0U;
+}
+
+void Buffered_Updater::wait_idle() {
+    // The semaphore can only be taken once the last submitted buffer has been written
+    (void)xSemaphoreTake(m_free, portMAX_DELAY);
+    (void)xSemaphoreGive(m_free);
+}
+
+void Buffered_Updater::clear_statistics() {
+    m_failed = false;
+    m_flash_bytes = 0U;
+    m_flash_time = 0U;
+    m_stalls = 0U;
+    m_stall_time = 0U;
+}
+
+void Buffered_Updater::writer_task(void *parameter) {
+    Buffered_Updater *updater = static_cast<Buffered_Updater*>(parameter);
+    Flash_Block block;
+
+    for (;;) {
+        if (xQueueReceive(updater->m_blocks, &block, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        if (block.index == STOP_WRITER_TASK) {
+            (void)xSemaphoreGive(updater->m_free);
+            vTaskDelete(nullptr);
+            return;
+        }
+
+        // Data after a failed write is discarded, because the written image has a gap anyway
+        if (!updater->m_failed) {
+            const TickType_t start = xTaskGetTickCount();
+            const size_t written = updater->m_updater.write(updater->m_buffers[block.index], block.length);
+            updater->m_flash_time += xTaskGetTickCount() - start;
+            if (written == block.length) {
+                updater->m_flash_bytes += written;
+            }
+            else {
+                updater->m_failed = true;
+            }
+        }
+        (void)xSemaphoreGive(updater->m_free);
+    }
+}
+
+#endif // THINGSBOARD_USE_FREERTOS
+
+#endif // THINGSBOARD_ENABLE_OTA
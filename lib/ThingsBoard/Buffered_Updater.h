@@ -0,0 +1,110 @@
+#ifndef Buffered_Updater_h
+#define Buffered_Updater_h
+
+// Local include.
+#include "Configuration.h"
+
+#if THINGSBOARD_ENABLE_OTA
+
+#if THINGSBOARD_USE_FREERTOS
+
+// Local include.
+#include "IUpdater.h"
+
+// Library includes.
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+
+/// @brief IUpdater decorator that moves the actual flash writes of another IUpdater onto a dedicated writer task.
+/// Received data is copied into one of two equally sized buffers, once a buffer is full it is handed to the writer task and the next one is filled,
+/// meaning the network task can already receive the next firmware packet while the previous one is being erased and programmed.
+/// The calling task only blocks if both buffers are still owned by the writer task, which is counted as a stall.
+/// Because writes complete asynchronously, a failed flash write is reported by the next call to write(), flush() or end() instead.
+/// The writer task and the buffers are only allocated while an update is in progress and released again in reset() and end()
+class Buffered_Updater : public IUpdater {
+  public:
+    /// @brief Constructor
+    /// @param updater Updater that writes the buffered data into flash memory, all calls to it are made from the writer task or while the writer task is idle
+    /// @param buffer_size Size of each of the two buffers, should be a multiple of the flash sector size, so each write erases at most one sector
+    /// @param stack_size Stack size of the writer task in bytes
+    /// @param priority Priority of the writer task, should be higher than the one of the network task so a full buffer is written as soon as possible
+    Buffered_Updater(IUpdater& updater, const size_t& buffer_size = 4096U, const uint32_t& stack_size = 3072U, const UBaseType_t& priority = 3U);
+
+    ~Buffered_Updater();
+
+    /// @brief Waits for all buffered data to be written and then initalizes the underlying updater
+    bool begin(const size_t& firmware_size) override;
+
+    /// @brief Copies the given data into the current buffer, the full buffer is written into flash memory by the writer task
+    /// @return Total amount of bytes that were accepted, 0 if a previous flash write has failed
+    size_t write(uint8_t* payload, const size_t& total_bytes) override;
+
+    /// @brief Waits for the ongoing flash write, discards all buffered data and then resets the underlying updater
+    void reset() override;
+
+    /// @brief Writes all buffered data and then ends the update of the underlying updater
+    bool end() override;
+
+    /// @brief Writes all buffered data and waits until it has been written into flash memory,
+    /// afterwards the state of the underlying updater (e.g. its write offset) is up to date
+    /// @return Whether all data written so far has been written into flash memory successfully
+    bool flush();
+
+    /// @brief Amount of bytes that have been written into flash memory by the writer task since the last call to begin() or reset()
+    size_t get_flash_bytes() const;
+
+    /// @brief Time the writer task spent writing into flash memory since the last call to begin() or reset()
+    uint32_t get_flash_time_ms() const;
+
+    /// @brief Amount of calls to write() that had to wait for the writer task, because both buffers were full
+    uint32_t get_stalls() const;
+
+    /// @brief Total time write() spent waiting for the writer task
+    uint32_t get_stall_time_ms() const;
+
+  private:
+    IUpdater& m_updater;                        // Updater that writes the data into flash memory
+    const size_t m_buffer_size;                 // Size of each of the two buffers
+    const uint32_t m_stack_size;                // Stack size of the writer task
+    const UBaseType_t m_priority;               // Priority of the writer task
+    uint8_t *m_buffers[2];                      // Buffers that are filled alternately, nullptr while no update is in progress
+    uint8_t m_current;                          // Index of the buffer that is currently being filled by write()
+    size_t m_fill;                              // Amount of bytes in the buffer that is currently being filled
+    QueueHandle_t m_blocks;                     // Filled buffers that still need to be written, in the order they were filled
+    SemaphoreHandle_t m_free;                   // Counts the buffers, except the one that is being filled, that may be filled again
+    TaskHandle_t m_task;                        // Writer task
+    volatile bool m_failed;                     // Whether a flash write has failed, all following data is discarded until begin() or reset()
+    volatile size_t m_flash_bytes;              // Amount of bytes written by the writer task
+    volatile uint32_t m_flash_time;             // Time spent by the writer task in the underlying updater in ticks
+    uint32_t m_stalls;                          // Amount of calls to write() that had to wait for a free buffer
+    uint32_t m_stall_time;                      // Time spent waiting for a free buffer in ticks
+
+    /// @brief Allocates the buffers and starts the writer task, if they do not exist yet
+    /// @return Whether the writer task is running
+    bool start();
+
+    /// @brief Waits for all buffered data to be written, then stops the writer task and releases the buffers
+    void stop();
+
+    /// @brief Hands the buffer that is currently being filled to the writer task and waits until the other buffer may be filled
+    void submit();
+
+    /// @brief Waits until the writer task has written all buffers it currently owns
+    void wait_idle();
+
+    /// @brief Clears the failure state and the statistics of the previous update
+    void clear_statistics();
+
+    /// @brief Main loop of the writer task
+    /// @param parameter Instance of the Buffered_Updater the task writes the buffers for
+    static void writer_task(void *parameter);
+};
+
+#endif // THINGSBOARD_USE_FREERTOS
+
+#endif // THINGSBOARD_ENABLE_OTA
+
+#endif // Buffered_Updater_h
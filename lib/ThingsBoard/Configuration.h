@@ -99,6 +99,22 @@
 #    define THINGSBOARD_USE_MBED_TLS 0
 #  endif
 
+// Use the esp_rom_crc header internally for calculating CRC32 checksums of binary data, as long as the header exists,
+// because the implementation in the ROM is faster and does not need the 1 KiB lookup table of the software implementation.
+#  ifdef __has_include
+#    if  __has_include(<esp_rom_crc.h>)
+#      ifndef THINGSBOARD_USE_ROM_CRC
+#        define THINGSBOARD_USE_ROM_CRC 1
+#      endif
+#    else
+#      ifndef THINGSBOARD_USE_ROM_CRC
+#        define THINGSBOARD_USE_ROM_CRC 0
+#      endif
+#    endif
+#  else
+#    define THINGSBOARD_USE_ROM_CRC 0
+#  endif
+
 // Use the esp_ota_ops header internally for handling the writing of ota update data, as long as the header exists,
 // to allow users that do have the needed component to use the Espressif_Updater instead of only the Arduino_ESP32_Updater.
 #  ifdef __has_include
@@ -115,6 +131,48 @@
 #    define THINGSBOARD_USE_ESP_PARTITION 0
 #  endif
 
+// Use FreeRTOS tasks and queues internally to move slow operations off the calling task, as long as the header exists,
+// allows the Buffered_Updater to write received firmware data into flash memory while the next firmware packet is already being received.
+#  ifdef __has_include
+#    if  __has_include(<freertos/FreeRTOS.h>)
+#      ifndef THINGSBOARD_USE_FREERTOS
+#        define THINGSBOARD_USE_FREERTOS 1
+#      endif
+#    else
+#      ifndef THINGSBOARD_USE_FREERTOS
+#        define THINGSBOARD_USE_FREERTOS 0
+#      endif
+#    endif
+#  else
+#    define THINGSBOARD_USE_FREERTOS 0
+#  endif
+
+// Use the esp_heap_caps header internally for measuring the free heap memory, as long as the header exists,
+// allows the MQTT_Client_Benchmark to report how much heap memory the MQTT client implementation allocated while running a workload.
+#  ifdef __has_include
+#    if  __has_include(<esp_heap_caps.h>)
+#      ifndef THINGSBOARD_USE_HEAP_CAPS
+#        define THINGSBOARD_USE_HEAP_CAPS 1
+#      endif
+#    else
+#      ifndef THINGSBOARD_USE_HEAP_CAPS
+#        define THINGSBOARD_USE_HEAP_CAPS 0
+#      endif
+#    endif
+#  else
+#    define THINGSBOARD_USE_HEAP_CAPS 0
+#  endif
+
+// Enables server-side RPC callbacks that are called on a worker task and send their response later, instead of blocking the MQTT callback until they return.
+// Requires FreeRTOS for the worker task and the C++ STL for the std::function used by the response timeouts, enabled by default if both exist.
+#  ifndef THINGSBOARD_ENABLE_RPC_ASYNC
+#    if THINGSBOARD_USE_FREERTOS && THINGSBOARD_ENABLE_STL
+#      define THINGSBOARD_ENABLE_RPC_ASYNC 1
+#    else
+#      define THINGSBOARD_ENABLE_RPC_ASYNC 0
+#    endif
+#  endif
+
 // Use the pgmspace header internally for enalbing the usage of the PROGMEm header for constant variables, as long as the header exists,
 // to allow variables to be placed into flash memory instead of sram, meaning the sram can be allocated for other things.
 #  ifdef __has_include
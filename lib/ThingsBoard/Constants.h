@@ -31,6 +31,12 @@ class ThingsBoardDefaultLogger;
 #ifndef strncmp_P
 #define strncmp_P   strncmp
 #endif // strncmp_P
+#ifndef strlen_P
+#define strlen_P    strlen
+#endif // strlen_P
+#ifndef memcpy_P
+#define memcpy_P    memcpy
+#endif // memcpy_P
 #endif // THINGSBOARD_ENABLE_PROGMEM
 
 
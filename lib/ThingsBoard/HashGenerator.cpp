@@ -6,9 +6,14 @@
 // Library includes.
 #include <sstream>
 #include <iomanip>
+#if THINGSBOARD_USE_ROM_CRC
+#include <esp_rom_crc.h>
+#endif // THINGSBOARD_USE_ROM_CRC
 
 HashGenerator::HashGenerator() :
-    m_ctx()
+    m_ctx(),
+    m_use_crc32(false),
+    m_crc32(0U)
 {
     // Nothing to do
 }
@@ -19,14 +24,14 @@ HashGenerator::~HashGenerator(void) {
 }
 
 void HashGenerator::start(const mbedtls_md_type_t& type) {
-    // MBEDTLS Version 3 is a major breaking changes were accessing the internal structures requires the MBEDTLS_PRIVATE macro
-#if MBEDTLS_VERSION_MAJOR < 3
-    if (m_ctx.hmac_ctx != nullptr && m_ctx.md_ctx != nullptr && m_ctx.md_info != nullptr) {
-#else
-    if (m_ctx.MBEDTLS_PRIVATE(hmac_ctx) != nullptr && m_ctx.MBEDTLS_PRIVATE(md_ctx) != nullptr && m_ctx.MBEDTLS_PRIVATE(md_info) != nullptr) {
-#endif
-        mbedtls_md_free(&m_ctx);
+    m_use_crc32 = type == MD_TYPE_CRC32;
+    m_crc32 = 0U;
+    if (m_use_crc32) {
+        return;
     }
+    // Frees the context of a previous hash, the hmac context is never allocated because the context is setup without hmac.
+    // Safe on a context that was never setup, because the value initialized context does not reference any hash type yet
+    mbedtls_md_free(&m_ctx);
     // Initialize the context
     mbedtls_md_init(&m_ctx);
     // Choose the hash function
@@ -36,10 +41,22 @@ void HashGenerator::start(const mbedtls_md_type_t& type) {
 }
 
 bool HashGenerator::update(const uint8_t* data, const size_t& len) {
+    if (m_use_crc32) {
+        m_crc32 = crc32(m_crc32, data, len);
+        return true;
+    }
     return mbedtls_md_update(&m_ctx, data, len) == 0;
 }
 
 std::string HashGenerator::get_hash_string() {
+    if (m_use_crc32) {
+        // ThingsBoard formats the checksum like Guava's HashCode, which writes the bytes of the value in little endian order
+        std::stringstream ss;
+        for (size_t i = 0; i < sizeof(m_crc32); i++)
+            ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>((m_crc32 >> (8U * i)) & 0xFFU);
+        return ss.str();
+    }
+
     // Calculate the current hash value
     uint8_t hash[MBEDTLS_MD_MAX_SIZE];
     finish(hash);
@@ -56,6 +73,29 @@ std::string HashGenerator::get_hash_string() {
     return ss.str();
 }
 
+uint32_t HashGenerator::crc32(const uint32_t& crc, const uint8_t* data, const size_t& len) {
+#if THINGSBOARD_USE_ROM_CRC
+    // The ROM implementation inverts the value before and after the calculation itself
+    return esp_rom_crc32_le(crc, data, len);
+#else
+    static uint32_t table[256U] = {};
+    if (table[1U] == 0U) {
+        for (uint32_t i = 0U; i < 256U; i++) {
+            uint32_t value = i;
+            for (uint8_t bit = 0U; bit < 8U; bit++) {
+                value = (value & 1U) ? (value >> 1U) ^ 0xEDB88320U : value >> 1U;
+            }
+            table[i] = value;
+        }
+    }
+    uint32_t value = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        value = table[(value ^ data[i]) & 0xFFU] ^ (value >> 8U);
+    }
+    return ~value;
+#endif // THINGSBOARD_USE_ROM_CRC
+}
+
 void HashGenerator::finish(unsigned char *hash) {
     mbedtls_md_finish(&m_ctx, hash);
 }
@@ -15,13 +15,20 @@
 #include <string>
 
 
+/// @brief Hash type that is not part of mbedtls, but supported by ThingsBoard as a firmware checksum algorithm.
+/// Uses a value inside of the range of mbedtls_md_type_t that is not assigned to any mbedtls hash type,
+/// so it can be passed everywhere a mbedtls_md_type_t is expected
+constexpr mbedtls_md_type_t MD_TYPE_CRC32 = static_cast<mbedtls_md_type_t>(15);
+
+
 /// @brief Wrapper class which allows generating a hash of the given type from any arbitrary byte payload, which is hashable in chunks.
 /// The class wraps around either the Arduino Seeed mbedtls library from Seed Studio (https://github.com/Seeed-Studio/Seeed_Arduino_mbedtls) or the offical ESP Mbed TLS implementation from Mbed TLS (https://github.com/Mbed-TLS/mbedtls), the latter takes precendence if it exists.
 /// This is done because it removes the need to include another library, because the component already exists on the system and we can therefore simply utilize that one.
 /// The ESP Mbed TLS implementationt works with both Espressif IDF v4.X and v5.X, meaning it is version idependent, this is the case
 /// because depending on the used version the implementation automatically adjusts to still initalize correctly.
 /// The class instance is meant to be started with start() which will then create the configuration for a hash of the given type
-/// and we then expect the complete binary payload to be called in multiple calls to update() and the final result to be read with get_hash_string()
+/// and we then expect the complete binary payload to be called in multiple calls to update() and the final result to be read with get_hash_string().
+/// Additionally supports the CRC32 checksum with MD_TYPE_CRC32, which is calculated without mbedtls, preferably with the implementation in the ESP ROM
 /// Documentation about the specific use and caviates of the ESP Mbedt TLS implementation can be found here https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/protocols/mbedtls.html
 class HashGenerator {
   public:
@@ -32,7 +39,7 @@ class HashGenerator {
     ~HashGenerator(void);
 
     /// @brief Starts the hashing process
-    /// @param type Supported type of hash that should be generated from this class
+    /// @param type Supported type of hash that should be generated from this class, either a mbedtls hash type or MD_TYPE_CRC32
     void start(const mbedtls_md_type_t& type);
 
     /// @brief Update the current hash value with new data
@@ -45,8 +52,17 @@ class HashGenerator {
     /// @return String containing the final hash value for the passed bytes
     std::string get_hash_string();
 
+    /// @brief Calculates the CRC32 checksum (IEEE 802.3, reflected, same as zlib) of the given data
+    /// @param crc Checksum of the previous data, 0 for the first call
+    /// @param data Data that should be added to the checksum
+    /// @param len Length of data entered
+    /// @return Checksum including the given data
+    static uint32_t crc32(const uint32_t& crc, const uint8_t* data, const size_t& len);
+
   private:
     mbedtls_md_context_t m_ctx; // Context used to access the already written bytes and update them latter
+    bool m_use_crc32;           // Whether the CRC32 checksum is calculated instead of a mbedtls hash
+    uint32_t m_crc32;           // CRC32 checksum of the already written bytes
 
     /// @brief Calculates the final hash value
     /// @param hash Output byte array that the hash value will be copied into
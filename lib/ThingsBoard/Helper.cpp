@@ -22,6 +22,28 @@ uint8_t Helper::detectSize(const char *msg, ...) {
       return result;
 }
 
+size_t Helper::formatTopic(char *buffer, const size_t& size, const char *topic, const uint32_t& id) {
+    // Digits are written from the least significant one, into the end of a temporary buffer
+    char digits[10U];
+    size_t count = 0U;
+    uint32_t remaining = id;
+    do {
+      digits[sizeof(digits) - ++count] = '0' + (remaining % 10U);
+      remaining /= 10U;
+    } while (remaining != 0U);
+
+    const size_t topicLength = strlen_P(topic);
+    const size_t length = topicLength + 1U + count;
+    if (buffer == nullptr || length >= size) {
+      return 0U;
+    }
+    memcpy_P(buffer, topic, topicLength);
+    buffer[topicLength] = '/';
+    memcpy(buffer + topicLength + 1U, digits + sizeof(digits) - count, count);
+    buffer[length] = '\0';
+    return length;
+}
+
 size_t Helper::getOccurences(const char *str, char symbol) {
     size_t count = 0;
     if (str == nullptr) {
@@ -35,3 +57,54 @@ size_t Helper::getOccurences(const char *str, char symbol) {
     }
     return count;
 }
+
+size_t Helper::getJsonFields(const char *json, const size_t& length) {
+    size_t fields = 0U;
+    // Every comma outside of a string seperates two values of the same object or array, meaning only the first value of each one has to be counted additionally,
+    // which is the case for every object or array that is not closed directly after it was opened
+    bool opened = false;
+    char quote = '\0';
+    for (size_t i = 0U; json != nullptr && i < length; i++) {
+      if (quote != '\0') {
+        // Content of strings is skipped in a tight loop, because it makes up most of the payload
+        while (i < length && json[i] != quote && json[i] != '\\') {
+          i++;
+        }
+        if (i < length && json[i] == '\\') {
+          // Escaped character can not end the string
+          i++;
+        }
+        else {
+          quote = '\0';
+        }
+        continue;
+      }
+      const char current = json[i];
+      if (current == ' ' || current == '\t' || current == '\r' || current == '\n') {
+        continue;
+      }
+      if (opened) {
+        opened = false;
+        if (current != '}' && current != ']') {
+          fields++;
+        }
+      }
+      switch (current) {
+        // Strings may be quoted with single quotes as well
+        case '"':
+        case '\'':
+          quote = current;
+          break;
+        case '{':
+        case '[':
+          opened = true;
+          break;
+        case ',':
+          fields++;
+          break;
+        default:
+          break;
+      }
+    }
+    return fields;
+}
@@ -12,6 +12,10 @@
 #endif // THINGSBOARD_ENABLE_STL
 
 
+/// @brief Size of a buffer that can hold a topic with the given length, followed by a slash, a request id with up to 10 digits and the null terminator
+#define TOPIC_ID_SIZE(TOPIC_LENGTH) ((TOPIC_LENGTH) + 12U)
+
+
 /// @brief Static helper class that includes some uniliterally used functionalities in multiple places, especially the ThingsBoardHttp and ThingsBoard implementations
 class Helper {
   public:
@@ -28,6 +32,24 @@ class Helper {
     /// @return Amount of occurences of the given symbol
     static size_t getOccurences(const char *str, char symbol);
 
+    /// @brief Returns the amount of members of all objects and elements of all arrays in the given json, in a single pass without allocating memory.
+    /// Deserializing a writeable input uses the zero copy mode, where strings are kept in the input and only the data structure needs memory,
+    /// meaning JSON_OBJECT_SIZE() of the returned amount is exactly the capacity the JsonDocument needs. Only objects containing the same key multiple times need less,
+    /// because the later value replaces the earlier one. Commas and brackets in strings are skipped, nested objects and arrays are counted as well
+    /// @param json Serialized json, does not need to be null terminated
+    /// @param length Length of the serialized json
+    /// @return Amount of slots needed to deserialize the given json
+    static size_t getJsonFields(const char *json, const size_t& length);
+
+    /// @brief Writes the given topic followed by a slash and the decimal representation of the given id into the given buffer,
+    /// converts the id directly instead of parsing a format string and does not require measuring the needed size beforehand
+    /// @param buffer Buffer the null terminated topic is written into
+    /// @param size Size of the buffer in bytes, TOPIC_ID_SIZE(strlen(topic)) is always enough
+    /// @param topic Topic without the trailing slash, may be placed in flash memory
+    /// @param id Request id appended to the topic
+    /// @return Length of the written topic without the null terminator, 0 if the buffer was too small
+    static size_t formatTopic(char *buffer, const size_t& size, const char *topic, const uint32_t& id);
+
     /// @brief Calculates the total size of the string the serializeJson method would produce including the null end terminator.
     /// See https://arduinojson.org/v6/api/json/measurejson/ for more information on the underlying method used
     /// @tparam TSource Source class that should be used to serialize the json that is sent to the server
@@ -0,0 +1,323 @@
+// Header include.
+#include "MQTT_Client_Benchmark.h"
+
+// Library includes.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if THINGSBOARD_USE_ESP_TIMER
+#include <esp_timer.h>
+#elif defined(ARDUINO)
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif // THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_USE_HEAP_CAPS
+#include <esp_heap_caps.h>
+#endif // THINGSBOARD_USE_HEAP_CAPS
+#if THINGSBOARD_ENABLE_STL
+#include <functional>
+#endif // THINGSBOARD_ENABLE_STL
+
+constexpr uint16_t MQTT_Client_Benchmark::HEADER_SIZE;
+constexpr size_t MQTT_Client_Benchmark::SUB_BUCKETS;
+constexpr size_t MQTT_Client_Benchmark::LINEAR_BUCKETS;
+constexpr size_t MQTT_Client_Benchmark::BUCKETS;
+constexpr size_t MQTT_Client_Benchmark::STREAM_CHUNK_SIZE;
+
+#if !THINGSBOARD_ENABLE_STL
+MQTT_Client_Benchmark *MQTT_Client_Benchmark::m_running_instance = nullptr;
+#endif // !THINGSBOARD_ENABLE_STL
+
+MQTT_Client_Benchmark::MQTT_Client_Benchmark(IMQTT_Client& client, const char *topic, const uint32_t& timeout_ms, clock_function clock, heap_function free_heap) :
+    m_client(client),
+    m_topic(topic),
+    m_timeout_ms(timeout_ms),
+    m_clock(clock != nullptr ? clock : Default_Clock),
+    m_free_heap(free_heap),
+    m_payload(nullptr),
+    m_payload_size(0U),
+    m_stream(false),
+    m_received(0U),
+    m_corrupted(0U),
+    m_reordered(0U),
+    m_duplicated(0U),
+    m_seen(nullptr),
+    m_message_count(0U),
+    m_next_sequence(0U),
+    m_max_latency_us(0U),
+    m_histogram()
+{
+    // Nothing to do
+}
+
+MQTT_Client_Benchmark::~MQTT_Client_Benchmark() {
+    delete[] m_payload;
+    delete[] m_seen;
+}
+
+bool MQTT_Client_Benchmark::run(const MQTT_Benchmark_Workload& workload, MQTT_Benchmark_Result& result) {
+    memset(&result, 0, sizeof(result));
+    result.name = workload.name;
+    if (m_topic == nullptr || workload.message_count == 0U || workload.in_flight == 0U || !m_client.connected()) {
+        return false;
+    }
+
+    m_payload_size = workload.payload_size < HEADER_SIZE ? HEADER_SIZE : workload.payload_size;
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    m_stream = workload.stream;
+#else
+    m_stream = false;
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+    m_received = 0U;
+    m_corrupted = 0U;
+    m_reordered = 0U;
+    m_duplicated = 0U;
+    m_message_count = workload.message_count;
+    m_next_sequence = 0U;
+    m_max_latency_us = 0U;
+    memset(m_histogram, 0, sizeof(m_histogram));
+
+    // Fixed header, topic length prefix and the topic itself, have to fit into the buffer together with the payload
+    const size_t required_size = m_payload_size + strlen(m_topic) + 7U;
+    const uint16_t previous_buffer_size = m_client.get_buffer_size();
+    const bool change_buffer_size = previous_buffer_size < required_size;
+    if (change_buffer_size && (required_size > UINT16_MAX || !m_client.set_buffer_size(required_size) || m_client.get_buffer_size() != required_size)) {
+        return false;
+    }
+
+    delete[] m_payload;
+    m_payload = new uint8_t[m_payload_size];
+    delete[] m_seen;
+    m_seen = new uint8_t[(m_message_count + 7U) / 8U]();
+
+#if THINGSBOARD_ENABLE_STL
+    m_client.set_callback(std::bind(&MQTT_Client_Benchmark::on_message, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+#else
+    m_running_instance = this;
+    m_client.set_callback(MQTT_Client_Benchmark::on_static_message);
+#endif // THINGSBOARD_ENABLE_STL
+    bool conformant = m_client.subscribe(m_topic);
+
+    const size_t heap_start = m_free_heap != nullptr ? m_free_heap() : 0U;
+    size_t heap_minimum = heap_start;
+    const uint64_t start = m_clock();
+    uint64_t last_progress = start;
+    size_t last_received = 0U;
+    size_t sent = 0U;
+    bool publish_failed = !conformant;
+
+    while (!publish_failed && m_received + m_corrupted < workload.message_count) {
+        while (sent < workload.message_count && sent - (m_received + m_corrupted) < workload.in_flight) {
+            if (!publish(sent)) {
+                publish_failed = true;
+                break;
+            }
+            sent++;
+        }
+        m_client.loop();
+
+        if (m_free_heap != nullptr) {
+            const size_t heap_free = m_free_heap();
+            if (heap_free < heap_minimum) {
+                heap_minimum = heap_free;
+            }
+        }
+        const uint64_t now = m_clock();
+        const size_t received = m_received + m_corrupted;
+        if (received != last_received) {
+            last_received = received;
+            last_progress = now;
+        }
+        else if (now - last_progress > static_cast<uint64_t>(m_timeout_ms) * 1000U) {
+            break;
+        }
+    }
+    const uint64_t end = m_clock();
+
+    conformant = m_client.unsubscribe(m_topic) && conformant;
+    if (change_buffer_size) {
+        m_client.set_buffer_size(previous_buffer_size);
+    }
+#if !THINGSBOARD_ENABLE_STL
+    m_running_instance = nullptr;
+#endif // !THINGSBOARD_ENABLE_STL
+    delete[] m_payload;
+    m_payload = nullptr;
+    delete[] m_seen;
+    m_seen = nullptr;
+    m_message_count = 0U;
+
+    result.sent = sent;
+    result.received = m_received;
+    result.corrupted = m_corrupted;
+    result.reordered = m_reordered;
+    result.duplicated = m_duplicated;
+    result.duration_us = end - start;
+    result.messages_per_second = result.duration_us != 0U ? (result.received * 1000000.0f) / result.duration_us : 0.0f;
+    result.p50_latency_us = percentile(500U);
+    result.p99_latency_us = percentile(990U);
+    result.max_latency_us = m_max_latency_us;
+    result.peak_heap = heap_start - heap_minimum;
+    result.conformant = conformant && !publish_failed && result.sent == workload.message_count && result.received == result.sent && result.corrupted == 0U && result.duplicated == 0U;
+    return result.conformant;
+}
+
+size_t MQTT_Client_Benchmark::Format_Result(const MQTT_Benchmark_Result& result, char *buffer, const size_t& buffer_size) {
+    const int length = snprintf(buffer, buffer_size, "%s: %u/%u received, %u corrupted, %u duplicated, %u reordered, %.1f msgs/s, p50 %lu us, p99 %lu us, max %lu us, peak heap %u B, %s",
+      result.name != nullptr ? result.name : "", static_cast<unsigned>(result.received), static_cast<unsigned>(result.sent), static_cast<unsigned>(result.corrupted),
+      static_cast<unsigned>(result.duplicated), static_cast<unsigned>(result.reordered), static_cast<double>(result.messages_per_second), static_cast<unsigned long>(result.p50_latency_us),
+      static_cast<unsigned long>(result.p99_latency_us), static_cast<unsigned long>(result.max_latency_us), static_cast<unsigned>(result.peak_heap),
+      result.conformant ? "conformant" : "NOT conformant");
+    return length < 0 ? 0U : static_cast<size_t>(length);
+}
+
+uint64_t MQTT_Client_Benchmark::Default_Clock() {
+#if THINGSBOARD_USE_ESP_TIMER
+    return static_cast<uint64_t>(esp_timer_get_time());
+#elif defined(ARDUINO)
+    // Overflows after roughly 71 minutes, which is much longer than any workload takes
+    return micros();
+#else
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif // THINGSBOARD_USE_ESP_TIMER
+}
+
+size_t MQTT_Client_Benchmark::Default_Free_Heap() {
+#if THINGSBOARD_USE_HEAP_CAPS
+    return heap_caps_get_free_size(MALLOC_CAP_8BIT);
+#else
+    return 0U;
+#endif // THINGSBOARD_USE_HEAP_CAPS
+}
+
+bool MQTT_Client_Benchmark::publish(const size_t& sequence) {
+    // Header is not null terminated, therefore it is formatted into a temporary buffer first
+    char header[HEADER_SIZE + 1U];
+    snprintf(header, sizeof(header), "%08lx%016llx", static_cast<unsigned long>(sequence & 0xFFFFFFFFU), static_cast<unsigned long long>(m_clock()));
+    memcpy(m_payload, header, HEADER_SIZE);
+    for (size_t i = HEADER_SIZE; i < m_payload_size; i++) {
+        m_payload[i] = Filler(sequence, i);
+    }
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    if (m_stream) {
+        if (!m_client.begin_publish(m_topic, m_payload_size)) {
+            return false;
+        }
+        for (size_t written = 0U; written < m_payload_size; written += STREAM_CHUNK_SIZE) {
+            const size_t remaining = m_payload_size - written;
+            const size_t chunk_size = remaining < STREAM_CHUNK_SIZE ? remaining : STREAM_CHUNK_SIZE;
+            if (m_client.write(m_payload + written, chunk_size) != chunk_size) {
+                m_client.end_publish();
+                return false;
+            }
+        }
+        return m_client.end_publish();
+    }
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+    return m_client.publish(m_topic, m_payload, m_payload_size);
+}
+
+void MQTT_Client_Benchmark::on_message(char *topic, uint8_t *payload, unsigned int length) {
+    const uint64_t now = m_clock();
+    if (topic == nullptr || strcmp(topic, m_topic) != 0 || payload == nullptr || length != m_payload_size) {
+        m_corrupted = m_corrupted + 1U;
+        return;
+    }
+
+    // Payload is not null terminated, therefore the header is copied into a temporary buffer first
+    char header[HEADER_SIZE + 1U];
+    memcpy(header, payload, HEADER_SIZE);
+    header[HEADER_SIZE] = '\0';
+    const unsigned long long published_at = strtoull(header + 8U, nullptr, 16);
+    header[8U] = '\0';
+    char *end = nullptr;
+    const size_t sequence = strtoul(header, &end, 16);
+    bool intact = end == header + 8U && sequence < m_message_count && published_at <= now;
+    for (size_t i = HEADER_SIZE; intact && i < length; i++) {
+        intact = payload[i] == Filler(sequence, i);
+    }
+    if (!intact) {
+        m_corrupted = m_corrupted + 1U;
+        return;
+    }
+
+    uint8_t& seen = m_seen[sequence / 8U];
+    const uint8_t mask = static_cast<uint8_t>(1U << (sequence % 8U));
+    if ((seen & mask) != 0U) {
+        m_duplicated = m_duplicated + 1U;
+        return;
+    }
+    seen |= mask;
+
+    if (sequence != m_next_sequence) {
+        m_reordered = m_reordered + 1U;
+    }
+    m_next_sequence = sequence + 1U;
+
+    const uint64_t latency = now - published_at;
+    const uint32_t latency_us = latency > UINT32_MAX ? UINT32_MAX : static_cast<uint32_t>(latency);
+    if (latency_us > m_max_latency_us) {
+        m_max_latency_us = latency_us;
+    }
+    m_histogram[Bucket(latency_us)]++;
+    m_received = m_received + 1U;
+}
+
+#if !THINGSBOARD_ENABLE_STL
+
+void MQTT_Client_Benchmark::on_static_message(char *topic, uint8_t *payload, unsigned int length) {
+    if (m_running_instance == nullptr) {
+        return;
+    }
+    m_running_instance->on_message(topic, payload, length);
+}
+
+#endif // !THINGSBOARD_ENABLE_STL
+
+uint8_t MQTT_Client_Benchmark::Filler(const size_t& sequence, const size_t& position) {
+    return static_cast<uint8_t>('a' + (sequence + position) % 26U);
+}
+
+size_t MQTT_Client_Benchmark::Bucket(const uint32_t& latency_us) {
+    if (latency_us < LINEAR_BUCKETS) {
+        return latency_us;
+    }
+    // Position of the highest set bit, at least 4 because the latency is at least 16
+    size_t exponent = 4U;
+    while (exponent < 31U && (latency_us >> (exponent + 1U)) != 0U) {
+        exponent++;
+    }
+    // The 3 bits below the highest set bit select one of the 8 sub buckets
+    const size_t sub_bucket = (latency_us >> (exponent - 3U)) & (SUB_BUCKETS - 1U);
+    return LINEAR_BUCKETS + (exponent - 4U) * SUB_BUCKETS + sub_bucket;
+}
+
+uint32_t MQTT_Client_Benchmark::Bucket_Limit(const size_t& bucket) {
+    if (bucket < LINEAR_BUCKETS) {
+        return bucket;
+    }
+    const size_t exponent = 4U + (bucket - LINEAR_BUCKETS) / SUB_BUCKETS;
+    const size_t sub_bucket = (bucket - LINEAR_BUCKETS) % SUB_BUCKETS;
+    const uint64_t lower = static_cast<uint64_t>(SUB_BUCKETS + sub_bucket) << (exponent - 3U);
+    return static_cast<uint32_t>(lower + (static_cast<uint64_t>(1U) << (exponent - 3U)) - 1U);
+}
+
+uint32_t MQTT_Client_Benchmark::percentile(const uint32_t& permille) const {
+    const size_t received = m_received;
+    if (received == 0U) {
+        return 0U;
+    }
+    // Rank of the message that is the given share of all messages, rounded up
+    const uint64_t rank = (static_cast<uint64_t>(received) * permille + 999U) / 1000U;
+    uint64_t counted = 0U;
+    for (size_t i = 0U; i < BUCKETS; i++) {
+        counted += m_histogram[i];
+        if (counted >= rank) {
+            const uint32_t limit = Bucket_Limit(i);
+            return limit < m_max_latency_us ? limit : m_max_latency_us;
+        }
+    }
+    return m_max_latency_us;
+}
@@ -0,0 +1,156 @@
+#ifndef MQTT_Client_Benchmark_h
+#define MQTT_Client_Benchmark_h
+
+// Local includes.
+#include "IMQTT_Client.h"
+
+// Library includes.
+#include <stddef.h>
+#include <stdint.h>
+
+
+/// @brief Scripted workload, that publishes the given amount of messages to a topic the client is subscribed to itself
+struct MQTT_Benchmark_Workload {
+    const char *name;      // Name of the workload, copied into the result
+    size_t message_count;  // Amount of messages that are published
+    uint16_t payload_size; // Size of every payload in bytes, increased to MQTT_Client_Benchmark::HEADER_SIZE if it is smaller
+    size_t in_flight;      // Maximum amount of messages that were published but not received back yet, 1 waits for every message like a request and its response
+    bool stream;           // Whether the payloads are written with begin_publish(), write() and end_publish(), ignored if THINGSBOARD_ENABLE_STREAM_UTILS is disabled
+};
+
+/// @brief Many mid sized messages sent back to back, like the telemetry of multiple sensors after a reconnect
+constexpr MQTT_Benchmark_Workload TELEMETRY_BURST = { "telemetry burst", 200U, 128U, 16U, true };
+/// @brief Many tiny messages with a lot of messages in flight, like attribute updates for many keys
+constexpr MQTT_Benchmark_Workload ATTRIBUTE_STORM = { "attribute storm", 500U, 32U, 64U, false };
+/// @brief Big messages where every message waits for the previous one, like the chunks of an OTA update
+constexpr MQTT_Benchmark_Workload OTA_CHUNK_STREAM = { "ota chunk stream", 32U, 4096U, 1U, false };
+
+
+/// @brief Measured values of a single workload run
+struct MQTT_Benchmark_Result {
+    const char *name;            // Name of the workload
+    size_t sent;                 // Amount of messages that were published successfully
+    size_t received;             // Amount of intact messages that were received back
+    size_t corrupted;            // Amount of received messages whose topic, length or payload did not match what was published
+    size_t duplicated;           // Amount of intact messages that were received more than once
+    size_t reordered;            // Amount of received messages that did not arrive in the order they were published in
+    uint64_t duration_us;        // Time from the first publish until the last message was received or the run timed out
+    float messages_per_second;   // Received messages per second
+    uint32_t p50_latency_us;     // Median time from publishing a message until receiving it back
+    uint32_t p99_latency_us;     // 99th percentile of the time from publishing a message until receiving it back
+    uint32_t max_latency_us;     // Longest time from publishing a message until receiving it back
+    size_t peak_heap;            // Maximum amount of bytes the free heap decreased by during the run, 0 if the free heap can not be measured
+    bool conformant;             // Whether every call to the client succeeded and every message was received back exactly once and intact
+};
+
+
+/// @brief Conformance check and benchmark for IMQTT_Client implementations, allows to compare the throughput, latency and memory usage of the Arduino_MQTT_Client,
+/// the Espressif_MQTT_Client or any other implementation with the same scripted workloads.
+/// Every workload subscribes to the given topic and publishes numbered messages to it, that contain the time they were published at, the broker sends them back
+/// and the latency of every message is recorded into a histogram with a resolution of 12.5%, therefore the benchmark only needs a single bit per message to detect duplicates.
+/// Meant to be run against a plain MQTT broker, like a local Mosquitto instance, because the ThingsBoard server does not allow devices to subscribe to the topics they publish to.
+/// Takes over the callback of the client, therefore it should be run before creating the ThingsBoard instance that uses the same client, or on a seperate client.
+/// The clock and the free heap measurement can be replaced, to run the benchmark on the host against a simulated client
+class MQTT_Client_Benchmark {
+  public:
+    /// @brief Monotonic clock in microseconds
+    using clock_function = uint64_t (*)();
+    /// @brief Amount of currently free heap memory in bytes
+    using heap_function = size_t (*)();
+
+    /// @brief Size of the header at the start of every payload, containing the sequence number and the publish time as hexadecimal characters
+    static constexpr uint16_t HEADER_SIZE = 24U;
+
+    /// @brief Constructor
+    /// @param client Connected MQTT client implementation that should be measured
+    /// @param topic Topic the messages are published to and received from, has to stay valid while the benchmark exists
+    /// @param timeout_ms Time the run is aborted after, if no message has been received during it, default = 5000
+    /// @param clock Clock used to measure the latency and throughput, default = Default_Clock
+    /// @param free_heap Method used to measure the free heap memory, nullptr if the heap usage should not be measured, default = Default_Free_Heap
+    MQTT_Client_Benchmark(IMQTT_Client& client, const char *topic, const uint32_t& timeout_ms = 5000U, clock_function clock = Default_Clock, heap_function free_heap = Default_Free_Heap);
+
+    /// @brief Destructor
+    ~MQTT_Client_Benchmark();
+
+    /// @brief Runs the given workload, calls the loop method of the client until every message has been received back or the run timed out.
+    /// Increases the buffer size of the client if the payloads do not fit into it and reverts it afterwards
+    /// @param workload Workload that should be run
+    /// @param result Measured values of the run
+    /// @return Whether the client behaved conformant, see MQTT_Benchmark_Result::conformant
+    bool run(const MQTT_Benchmark_Workload& workload, MQTT_Benchmark_Result& result);
+
+    /// @brief Formats the given result into a single line
+    /// @param result Measured values of a run
+    /// @param buffer Buffer the null terminated line is written into
+    /// @param buffer_size Size of the given buffer
+    /// @return Amount of characters the complete line requires without the null terminator, the line was cut off if it is bigger than or equal to the buffer size
+    static size_t Format_Result(const MQTT_Benchmark_Result& result, char *buffer, const size_t& buffer_size);
+
+    /// @brief Default clock, uses the ESP Timer if it exists, micros() on other Arduino boards and the steady clock of the C++ STL otherwise
+    /// @return Current time in microseconds
+    static uint64_t Default_Clock();
+
+    /// @brief Default free heap measurement, uses the esp_heap_caps header if it exists
+    /// @return Currently free heap memory in bytes, 0 if it can not be measured
+    static size_t Default_Free_Heap();
+
+  private:
+    static constexpr size_t SUB_BUCKETS = 8U;       // Buckets per power of two, determines the resolution of the latency histogram
+    static constexpr size_t LINEAR_BUCKETS = 16U;   // Latencies below this value are counted exactly
+    static constexpr size_t BUCKETS = LINEAR_BUCKETS + (32U - 4U) * SUB_BUCKETS; // Covers the complete 32 bit range
+    static constexpr size_t STREAM_CHUNK_SIZE = 64U; // Amount of bytes passed to every write() call when streaming a payload
+
+    MQTT_Client_Benchmark(const MQTT_Client_Benchmark&) = delete;
+    MQTT_Client_Benchmark& operator=(const MQTT_Client_Benchmark&) = delete;
+
+    /// @brief Creates the payload of the message with the given sequence number and publishes it
+    /// @param sequence Sequence number of the message
+    /// @return Whether publishing the message was successful
+    bool publish(const size_t& sequence);
+
+    /// @brief Checks the received message and records its latency
+    /// @param topic Topic the message was received over
+    /// @param payload Payload of the message
+    /// @param length Length of the payload
+    void on_message(char *topic, uint8_t *payload, unsigned int length);
+
+#if !THINGSBOARD_ENABLE_STL
+    /// @brief Forwards the received message to the benchmark that is currently running, because the callback of the client can not capture any state
+    static void on_static_message(char *topic, uint8_t *payload, unsigned int length);
+
+    static MQTT_Client_Benchmark *m_running_instance; // Benchmark that is currently running
+#endif // !THINGSBOARD_ENABLE_STL
+
+    /// @brief Filler byte at the given position of the payload of the given message, differs between messages to detect mixed up payloads
+    static uint8_t Filler(const size_t& sequence, const size_t& position);
+
+    /// @brief Bucket of the latency histogram the given latency is counted in
+    static size_t Bucket(const uint32_t& latency_us);
+
+    /// @brief Biggest latency that is counted in the given bucket
+    static uint32_t Bucket_Limit(const size_t& bucket);
+
+    /// @brief Smallest latency that at least the given share of all received messages did not exceed
+    /// @param permille Share of all received messages in permille
+    uint32_t percentile(const uint32_t& permille) const;
+
+    IMQTT_Client& m_client;            // Client that is measured
+    const char *m_topic;               // Topic the messages are published to and received from
+    uint32_t m_timeout_ms;             // Time the run is aborted after if no message has been received
+    clock_function m_clock;            // Clock used to measure the latency and throughput
+    heap_function m_free_heap;         // Method used to measure the free heap memory
+    uint8_t *m_payload;                // Payload of the message that is published next
+    uint16_t m_payload_size;           // Size of the payloads of the running workload
+    bool m_stream;                     // Whether the payloads of the running workload are streamed
+    volatile size_t m_received;        // Amount of intact messages that were received, written from the task of the client if it receives messages on its own task
+    volatile size_t m_corrupted;       // Amount of received messages that did not match what was published
+    volatile size_t m_reordered;       // Amount of received messages that did not arrive in order
+    volatile size_t m_duplicated;      // Amount of intact messages that were received more than once
+    uint8_t *m_seen;                   // One bit for every message of the running workload, set once it has been received
+    size_t m_message_count;            // Amount of messages of the running workload
+    size_t m_next_sequence;            // Sequence number of the message that should be received next
+    uint32_t m_max_latency_us;         // Longest measured latency
+    uint32_t m_histogram[BUCKETS];     // Amount of received messages for every latency bucket
+};
+
+#endif // MQTT_Client_Benchmark_h
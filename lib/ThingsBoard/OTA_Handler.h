@@ -251,8 +251,9 @@ class OTA_Handler {
         Logger::log(expected);
 
         // Check if the initally received checksum is the same as the one we calculated from the received binary data,
-        // if not we assume the binary data has been changed or not completly downloaded --> Firmware update failed
-        if (m_fw_checksum.compare(calculated_hash) != 0) {
+        // if not we assume the binary data has been changed or not completly downloaded --> Firmware update failed.
+        // Compared case insensitive, because the hexadecimal representation of the checksum is not normalized by the server
+        if (strcasecmp(m_fw_checksum.c_str(), calculated_hash.c_str()) != 0) {
             Logger::log(CHKS_VER_FAILED);
             (void)m_send_fw_state_callback(FW_STATE_FAILED, CHKS_VER_FAILED);
             return Handle_Failure(OTA_Failure_Response::RETRY_UPDATE);
@@ -128,7 +128,9 @@ class OTA_Update_Callback : public Callback<void, const bool&> {
     IUpdater* Get_Updater() const;
 
     /// @brief Sets the updater implementation, used to write the actual firmware data into the needed memory location,
-    /// so it can be used to reboot the given device with that new flashed firmware
+    /// so it can be used to reboot the given device with that new flashed firmware.
+    /// The updater is called from the task that receives the firmware packets, wrap it into a Buffered_Updater
+    /// if flash erase and write times should not delay the processing of the next packet
     /// @param updater Updater implementation that writes the given firmware data
     void Set_Updater(IUpdater *updater);
 
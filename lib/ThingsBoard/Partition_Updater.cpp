@@ -0,0 +1,116 @@
+// Header include.
+#include "Partition_Updater.h"
+
+#if THINGSBOARD_ENABLE_OTA
+
+#if THINGSBOARD_USE_ESP_PARTITION
+
+// Library include.
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <esp_spi_flash.h>
+
+
+/// @brief Rounds the given offset up to the start of the next flash sector
+/// @param offset Offset inside of the partition
+/// @return Offset aligned to the flash sector size
+static size_t align_to_sector(const size_t& offset) {
+    return (offset + SPI_FLASH_SEC_SIZE - 1U) & ~(static_cast<size_t>(SPI_FLASH_SEC_SIZE) - 1U);
+}
+
+Partition_Updater::Partition_Updater() :
+    m_partition(nullptr),
+    m_firmware_size(0U),
+    m_offset(0U),
+    m_erased(0U)
+{
+    // Nothing to do
+}
+
+bool Partition_Updater::begin(const size_t& firmware_size) {
+    return resume(firmware_size, 0U);
+}
+
+bool Partition_Updater::resume(const size_t& firmware_size, const size_t& offset) {
+    reset();
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    const esp_partition_t *configured = esp_ota_get_boot_partition();
+
+    if (configured != running) {
+        return false;
+    }
+
+    const esp_partition_t *update_partition = esp_ota_get_next_update_partition(nullptr);
+
+    if (update_partition == nullptr || firmware_size > update_partition->size || offset > firmware_size) {
+        return false;
+    }
+
+    m_partition = update_partition;
+    m_firmware_size = firmware_size;
+    m_offset = offset;
+    // The sector containing the offset has already been erased before the data in front of the offset was written
+    m_erased = align_to_sector(offset);
+    return true;
+}
+
+size_t Partition_Updater::write(uint8_t* payload, const size_t& total_bytes) {
+    const esp_partition_t *partition = static_cast<const esp_partition_t*>(m_partition);
+    if (partition == nullptr || m_offset + total_bytes > m_firmware_size) {
+        return 0U;
+    }
+
+    const size_t end = m_offset + total_bytes;
+    if (end > m_erased) {
+        const size_t erase_size = align_to_sector(end) - m_erased;
+        if (esp_partition_erase_range(partition, m_erased, erase_size) != ESP_OK) {
+            return 0U;
+        }
+        m_erased += erase_size;
+    }
+
+    if (esp_partition_write(partition, m_offset, payload, total_bytes) != ESP_OK) {
+        return 0U;
+    }
+    m_offset = end;
+    return total_bytes;
+}
+
+void Partition_Updater::reset() {
+    m_partition = nullptr;
+    m_firmware_size = 0U;
+    m_offset = 0U;
+    m_erased = 0U;
+}
+
+bool Partition_Updater::end() {
+    const esp_partition_t *partition = static_cast<const esp_partition_t*>(m_partition);
+    if (partition == nullptr || m_offset != m_firmware_size) {
+        return false;
+    }
+    // Validates the written image before it is marked as bootable
+    const esp_err_t error = esp_ota_set_boot_partition(partition);
+    reset();
+    return error == ESP_OK;
+}
+
+size_t Partition_Updater::read(const size_t& offset, uint8_t* buffer, const size_t& length) const {
+    const esp_partition_t *partition = static_cast<const esp_partition_t*>(m_partition);
+    if (partition == nullptr || esp_partition_read(partition, offset, buffer, length) != ESP_OK) {
+        return 0U;
+    }
+    return length;
+}
+
+size_t Partition_Updater::get_offset() const {
+    return m_offset;
+}
+
+uint32_t Partition_Updater::get_partition_address() const {
+    const esp_partition_t *partition = static_cast<const esp_partition_t*>(m_partition);
+    return partition != nullptr ? partition->address : 0U;
+}
+
+#endif // THINGSBOARD_USE_ESP_PARTITION
+
+#endif // THINGSBOARD_ENABLE_OTA
@@ -0,0 +1,65 @@
+#ifndef Partition_Updater_h
+#define Partition_Updater_h
+
+// Local include.
+#include "Configuration.h"
+
+#if THINGSBOARD_ENABLE_OTA
+
+#if THINGSBOARD_USE_ESP_PARTITION
+
+// Local include.
+#include "IUpdater.h"
+
+
+/// @brief IUpdater implementation that writes the given binary firmware data directly into the next ota partition with the partition API from Espressif
+/// (https://docs.espressif.com/projects/esp-idf/en/latest/esp32/api-reference/storage/spi_flash.html), instead of going through an ota handle.
+/// Because no state is kept outside of the flash memory itself, writing can be continued at a given offset with resume(),
+/// meaning an update that was interrupted by a disconnect or a power cycle does not need to download the already written data again.
+/// Flash sectors are erased lazily right before they are written the first time and the partition is only marked as bootable in end()
+class Partition_Updater : public IUpdater {
+  public:
+    Partition_Updater();
+
+    bool begin(const size_t& firmware_size) override;
+
+    /// @brief Continues writing the given data at the given offset, all data before the offset is expected to have already been written
+    /// into the same partition by a previous update, that was started with begin()
+    /// @param firmware_size Total size of the data that should be written, has to be the same as the one of the interrupted update
+    /// @param offset Amount of bytes that have already been written successfully
+    /// @return Whether continuing the update was successful or not
+    bool resume(const size_t& firmware_size, const size_t& offset);
+
+    size_t write(uint8_t* payload, const size_t& total_bytes) override;
+
+    void reset() override;
+
+    bool end() override;
+
+    /// @brief Reads already written data back from the partition, used to recalculate the hash of the written data after resuming
+    /// @param offset Offset inside of the partition the data should be read from
+    /// @param buffer Output buffer the data will be copied into
+    /// @param length Amount of bytes that should be read
+    /// @return Amount of bytes that were read successfully
+    size_t read(const size_t& offset, uint8_t* buffer, const size_t& length) const;
+
+    /// @brief Amount of bytes that have been written successfully
+    /// @return Current write offset inside of the partition
+    size_t get_offset() const;
+
+    /// @brief Flash address of the partition that is written, allows to check if a stored offset still refers to the same partition
+    /// @return Address of the partition or 0 if no update has been started
+    uint32_t get_partition_address() const;
+
+  private:
+    const void *m_partition; // Partition that is written, stored as void* so the esp_partition header only needs to be included in the definition (.cpp) file
+    size_t m_firmware_size;  // Total size of the firmware binary that will be written
+    size_t m_offset;         // Amount of bytes written so far
+    size_t m_erased;         // End of the already erased region, always aligned to the size of a flash sector
+};
+
+#endif // THINGSBOARD_USE_ESP_PARTITION
+
+#endif // THINGSBOARD_ENABLE_OTA
+
+#endif // Partition_Updater_h
@@ -0,0 +1,45 @@
+// Header include.
+#include "RPC_Async_Callback.h"
+
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+
+/// ---------------------------------
+/// Constant strings in flash memory.
+/// ---------------------------------
+#if THINGSBOARD_ENABLE_PROGMEM
+constexpr char RPC_ASYNC_CB_NULL[] PROGMEM = "Server-side async RPC callback is NULL";
+#else
+constexpr char RPC_ASYNC_CB_NULL[] = "Server-side async RPC callback is NULL";
+#endif // THINGSBOARD_ENABLE_PROGMEM
+
+RPC_Async_Callback::RPC_Async_Callback() :
+    RPC_Async_Callback(nullptr, nullptr)
+{
+    // Nothing to do
+}
+
+RPC_Async_Callback::RPC_Async_Callback(const char *methodName, function cb, const uint64_t& timeout_microseconds) :
+    Callback(cb, RPC_ASYNC_CB_NULL),
+    m_methodName(methodName),
+    m_timeout(timeout_microseconds)
+{
+    // Nothing to do
+}
+
+const char* RPC_Async_Callback::Get_Name() const {
+    return m_methodName;
+}
+
+void RPC_Async_Callback::Set_Name(const char *methodName) {
+    m_methodName = methodName;
+}
+
+const uint64_t& RPC_Async_Callback::Get_Timeout() const {
+    return m_timeout;
+}
+
+void RPC_Async_Callback::Set_Timeout(const uint64_t& timeout_microseconds) {
+    m_timeout = timeout_microseconds;
+}
+
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
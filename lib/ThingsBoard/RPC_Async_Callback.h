@@ -0,0 +1,62 @@
+#ifndef RPC_Async_Callback_h
+#define RPC_Async_Callback_h
+
+// Local includes.
+#include "Callback.h"
+#include "RPC_Callback.h"
+
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+
+
+/// @brief Identifies a received server-side RPC request that is handled by an RPC_Async_Callback,
+/// has to be passed to RPC_Async_Respond() to send the response for that request.
+/// Copying the token is cheap and it may be stored and used from any task,
+/// once the request has been answered or has timed out the token is no longer accepted
+struct RPC_Token {
+    uint32_t request_id = 0U; // Request id received in the topic of the request
+    uint16_t slot = 0U;       // Slot of the pending request in the RPC_Async_Dispatcher
+    uint16_t sequence = 0U;   // Distinguishes the request from earlier requests that used the same slot
+};
+
+
+/// @brief Server-side RPC callback wrapper, for methods that do not answer synchronously.
+/// The callback is called on the worker task of the RPC_Async_Dispatcher instead of inside the MQTT callback,
+/// with a token that is used to send the response later, either from the callback itself or from any other task once the result is known.
+/// If no response is sent in the configured timeout, the server is sent an error response instead and the token is rejected afterwards.
+/// Documentation about the specific use of Server-side RPC in ThingsBoard can be found here https://thingsboard.io/docs/user-guide/rpc/#server-side-rpc
+class RPC_Async_Callback : public Callback<void, const RPC_Token&, RPC_Data&> {
+  public:
+    /// @brief Constructs empty callback, will result in never being called
+    RPC_Async_Callback();
+
+    /// @brief Constructs callback, will be called upon server-side RPC request arrival with the given methodName
+    /// @param methodName Name we expect to be sent via. server-side RPC so that this method callback will be called
+    /// @param cb Callback method that will be called on the worker task with the token of the request and the received parameters,
+    /// the parameters are only valid until the callback returns
+    /// @param timeout_microseconds Time the response has to be sent in, after the request has been received
+    RPC_Async_Callback(const char *methodName, function cb, const uint64_t& timeout_microseconds = 5000000U);
+
+    /// @brief Gets the poiner to the underlying name we expect to be sent via. server-side RPC so that this method callback will be called
+    /// @return Pointer to the passed methodName
+    const char* Get_Name() const;
+
+    /// @brief Sets the poiner to the underlying name we expect to be sent via. server-side RPC so that this method callback will be called
+    /// @param methodName Pointer to the passed methodName
+    void Set_Name(const char *methodName);
+
+    /// @brief Gets the time the response has to be sent in, after the request has been received
+    /// @return Timeout in microseconds
+    const uint64_t& Get_Timeout() const;
+
+    /// @brief Sets the time the response has to be sent in, after the request has been received
+    /// @param timeout_microseconds Timeout in microseconds
+    void Set_Timeout(const uint64_t& timeout_microseconds);
+
+  private:
+    const char  *m_methodName;  // Method name
+    uint64_t    m_timeout;      // Timeout of the response in microseconds
+};
+
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
+
+#endif // RPC_Async_Callback_h
@@ -0,0 +1,438 @@
+#ifndef RPC_Async_Dispatcher_h
+#define RPC_Async_Dispatcher_h
+
+// Local includes.
+#include "RPC_Async_Callback.h"
+
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+
+// Local includes.
+#include "Callback_Watchdog.h"
+#include "Constants.h"
+#include "Helper.h"
+#include "RPC_Response.h"
+
+// Library includes.
+#include <ArduinoJson.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include <string.h>
+
+
+/// ---------------------------------
+/// Constant strings in flash memory.
+/// ---------------------------------
+#if THINGSBOARD_ENABLE_PROGMEM
+constexpr char RPC_ASYNC_TASK_NAME[] PROGMEM = "TB_RPC_Worker";
+constexpr char RPC_ASYNC_START_FAILED[] PROGMEM = "Unable to start the async server-side RPC worker task";
+constexpr char RPC_ASYNC_BUSY[] PROGMEM = "No free slot for async server-side RPC request (%u), increase the amount of slots or respond faster";
+constexpr char RPC_ASYNC_PARAMS_TOO_BIG[] PROGMEM = "Parameters of async server-side RPC request (%u) do not fit into the payload size (%u)";
+constexpr char RPC_ASYNC_TIMEOUT[] PROGMEM = "Async server-side RPC request (%u) was not answered in time";
+constexpr char RPC_ASYNC_TIMEOUT_RESPONSE[] PROGMEM = "{\"error\":\"timeout\"}";
+#else
+constexpr char RPC_ASYNC_TASK_NAME[] = "TB_RPC_Worker";
+constexpr char RPC_ASYNC_START_FAILED[] = "Unable to start the async server-side RPC worker task";
+constexpr char RPC_ASYNC_BUSY[] = "No free slot for async server-side RPC request (%u), increase the amount of slots or respond faster";
+constexpr char RPC_ASYNC_PARAMS_TOO_BIG[] = "Parameters of async server-side RPC request (%u) do not fit into the payload size (%u)";
+constexpr char RPC_ASYNC_TIMEOUT[] = "Async server-side RPC request (%u) was not answered in time";
+constexpr char RPC_ASYNC_TIMEOUT_RESPONSE[] = "{\"error\":\"timeout\"}";
+#endif // THINGSBOARD_ENABLE_PROGMEM
+
+
+/// @brief Runs RPC_Async_Callback methods on a dedicated worker task and keeps track of their pending responses.
+/// Each received request occupies one of a fixed amount of slots, holding a copy of its parameters and later its serialized response,
+/// until the response has been sent, meaning no memory is allocated per request. The MQTT callback only copies the parameters into a free slot and returns,
+/// a slow callback therefore only delays other async requests but never the remaining inbound traffic.
+/// Responses may be given from any task, but are only sent by process(), which has to be called from the task that owns the MQTT client.
+/// Every request is guarded by its own Callback_Watchdog, once it expires an error response is sent instead and the token of the request is rejected.
+/// The worker task and the slots are only allocated once the first request is received. stop() only ends the worker task, the slots are kept until destruction,
+/// so tasks that still hold a token can safely call respond() while or after the dispatcher is stopped and tokens of requests discarded by stop() stay invalid
+/// @tparam Logger Logging class that should be used to print messages generated by internal processes
+template <typename Logger>
+class RPC_Async_Dispatcher {
+  public:
+    /// @brief Constructor
+    /// @param slots Maximum amount of requests that can be pending at once, additional requests are dropped until a slot is free again
+    /// @param payload_size Size of the serialized parameters and of the serialized response of a single request
+    /// @param stack_size Stack size of the worker task in bytes, the callbacks are called on it
+    /// @param priority Priority of the worker task
+    inline RPC_Async_Dispatcher(const size_t& slots = 4U, const size_t& payload_size = 256U, const uint32_t& stack_size = 4096U, const UBaseType_t& priority = 1U)
+      : m_slot_count(slots)
+      , m_payload_size(payload_size)
+      , m_stack_size(stack_size)
+      , m_priority(priority)
+      , m_slots(nullptr)
+      , m_params(nullptr)
+      , m_wake_ups(nullptr)
+      , m_lock(nullptr)
+      , m_stopped(nullptr)
+      , m_task(nullptr)
+      , m_stopping(false)
+      , m_timeouts(0U)
+      , m_dropped(0U)
+      , m_rejected(0U)
+    {
+        // Nothing to do
+    }
+
+    /// @brief Destructor
+    inline ~RPC_Async_Dispatcher() {
+        stop();
+        release();
+    }
+
+    /// @brief Copies the given parameters into a free slot and queues the request for the worker task, called from the MQTT callback
+    /// @param callback Callback that should be called on the worker task, is copied into the slot
+    /// @param request_id Request id received in the topic of the request
+    /// @param params Received parameters, only have to be valid until this method returns
+    /// @return Whether the request has been queued, fails if all slots are in use, the parameters are too big or the worker task could not be started
+    inline bool submit(const RPC_Async_Callback& callback, const uint32_t& request_id, const JsonVariantConst& params) {
+        if (!start()) {
+            return false;
+        }
+
+        xSemaphoreTake(m_lock, portMAX_DELAY);
+        size_t index = 0U;
+        while (index < m_slot_count && m_slots[index].state != Slot_State::FREE) {
+            index++;
+        }
+        if (index == m_slot_count) {
+            m_dropped++;
+            xSemaphoreGive(m_lock);
+            char message[Helper::detectSize(RPC_ASYNC_BUSY, request_id)];
+            snprintf_P(message, sizeof(message), RPC_ASYNC_BUSY, request_id);
+            Logger::log(message);
+            return false;
+        }
+
+        Slot& slot = m_slots[index];
+        const size_t length = serializeJson(params, slot.payload, m_payload_size);
+        if (length + 1U >= m_payload_size) {
+            m_dropped++;
+            xSemaphoreGive(m_lock);
+            char message[Helper::detectSize(RPC_ASYNC_PARAMS_TOO_BIG, request_id, m_payload_size)];
+            snprintf_P(message, sizeof(message), RPC_ASYNC_PARAMS_TOO_BIG, request_id, m_payload_size);
+            Logger::log(message);
+            return false;
+        }
+        slot.length = length;
+        slot.callback = callback;
+        slot.request_id = request_id;
+        slot.sequence++;
+        slot.started = xTaskGetTickCount();
+        slot.timeout_ticks = callback.Get_Timeout() / 1000U / portTICK_PERIOD_MS;
+        slot.state = Slot_State::QUEUED;
+        slot.watchdog->once(callback.Get_Timeout());
+        xSemaphoreGive(m_lock);
+
+        // If the queue is full the worker task has not handled the previous wake ups yet and will find this request as well
+        const uint8_t wake_up = 0U;
+        xQueueSend(m_wake_ups, &wake_up, 0U);
+        return true;
+    }
+
+    /// @brief Stores the response for the request with the given token, it is sent with the next call to process()
+    /// @param token Token of the request the callback was called with
+    /// @param response Response that should be sent, an empty response releases the request without sending anything
+    /// @return Whether the response was accepted, fails if the request was already answered, has timed out or the response is too big
+    inline bool respond(const RPC_Token& token, const RPC_Response& response) {
+        // Lock is created together with the slots, before the first token is handed out, and never replaced afterwards
+        if (m_lock == nullptr || token.slot >= m_slot_count) {
+            return false;
+        }
+
+        // Key-value responses are serialized into this fixed size arena on the stack, the same way as synchronous responses
+        StaticJsonDocument<RPC_Response::ARENA_SIZE> responseArena;
+        const JsonVariantConst responseJson = response.Serialize(responseArena);
+
+        xSemaphoreTake(m_lock, portMAX_DELAY);
+        Slot& slot = m_slots[token.slot];
+        if (slot.sequence != token.sequence || (slot.state != Slot_State::QUEUED && slot.state != Slot_State::WAITING)) {
+            m_rejected++;
+            xSemaphoreGive(m_lock);
+            return false;
+        }
+        if (responseJson.isNull()) {
+            slot.watchdog->detach();
+            slot.state = Slot_State::FREE;
+            xSemaphoreGive(m_lock);
+            return true;
+        }
+        const size_t length = serializeJson(responseJson, slot.payload, m_payload_size);
+        if (length + 1U >= m_payload_size) {
+            xSemaphoreGive(m_lock);
+            Logger::log(UNABLE_TO_SERIALIZE);
+            return false;
+        }
+        slot.watchdog->detach();
+        slot.length = length;
+        slot.state = Slot_State::ANSWERED;
+        xSemaphoreGive(m_lock);
+        return true;
+    }
+
+    /// @brief Sends all stored responses and an error response for every expired request, has to be called from the task that owns the MQTT client
+    /// @tparam Sender Callable with the signature bool(const uint32_t& request_id, const char *json, const size_t& length)
+    /// @param sender Publishes the given response json for the request with the given id
+    /// @return Amount of responses that have been sent
+    template <typename Sender>
+    inline size_t process(Sender sender) {
+        if (m_lock == nullptr) {
+            return 0U;
+        }
+
+        size_t sent = 0U;
+        for (size_t i = 0U; i < m_slot_count; i++) {
+            Slot& slot = m_slots[i];
+            xSemaphoreTake(m_lock, portMAX_DELAY);
+            const Slot_State state = slot.state;
+            if (state != Slot_State::ANSWERED && state != Slot_State::EXPIRED) {
+                xSemaphoreGive(m_lock);
+                continue;
+            }
+            // Slot is neither accepted by submit() nor by respond() while its response is sent
+            slot.state = Slot_State::SENDING;
+            xSemaphoreGive(m_lock);
+
+            if (state == Slot_State::EXPIRED) {
+                char message[Helper::detectSize(RPC_ASYNC_TIMEOUT, slot.request_id)];
+                snprintf_P(message, sizeof(message), RPC_ASYNC_TIMEOUT, slot.request_id);
+                Logger::log(message);
+                char timeout_response[sizeof(RPC_ASYNC_TIMEOUT_RESPONSE)];
+                memcpy_P(timeout_response, RPC_ASYNC_TIMEOUT_RESPONSE, sizeof(timeout_response));
+                sent += sender(slot.request_id, timeout_response, sizeof(timeout_response) - 1U) ? 1U : 0U;
+            }
+            else {
+                sent += sender(slot.request_id, slot.payload, slot.length) ? 1U : 0U;
+            }
+
+            xSemaphoreTake(m_lock, portMAX_DELAY);
+            slot.state = Slot_State::FREE;
+            xSemaphoreGive(m_lock);
+        }
+        return sent;
+    }
+
+    /// @brief Stops the worker task after the callback it is currently calling returned, pending requests are discarded without a response and their tokens are rejected.
+    /// The worker task is started again with the next received request
+    inline void stop() {
+        if (m_slots != nullptr) {
+            // Queued requests are skipped by the worker task, because their slot is no longer in the QUEUED state
+            xSemaphoreTake(m_lock, portMAX_DELAY);
+            for (size_t i = 0U; i < m_slot_count; i++) {
+                m_slots[i].watchdog->detach();
+                m_slots[i].state = Slot_State::FREE;
+            }
+            xSemaphoreGive(m_lock);
+        }
+        if (m_task != nullptr) {
+            m_stopping = true;
+            const uint8_t wake_up = 0U;
+            xQueueSend(m_wake_ups, &wake_up, portMAX_DELAY);
+            xSemaphoreTake(m_stopped, portMAX_DELAY);
+            m_task = nullptr;
+            m_stopping = false;
+        }
+    }
+
+    /// @brief Amount of requests that are currently queued, waiting for their response or whose response has not been sent yet
+    inline size_t get_pending() const {
+        if (m_lock == nullptr) {
+            return 0U;
+        }
+        xSemaphoreTake(m_lock, portMAX_DELAY);
+        size_t pending = 0U;
+        for (size_t i = 0U; i < m_slot_count; i++) {
+            pending += m_slots[i].state != Slot_State::FREE ? 1U : 0U;
+        }
+        xSemaphoreGive(m_lock);
+        return pending;
+    }
+
+    /// @brief Amount of requests that were not answered in time
+    inline uint32_t get_timeouts() const {
+        return m_timeouts;
+    }
+
+    /// @brief Amount of requests that could not be queued, because all slots were in use or the parameters were too big
+    inline uint32_t get_dropped() const {
+        return m_dropped;
+    }
+
+    /// @brief Amount of responses that were rejected, because the request was already answered or had timed out
+    inline uint32_t get_rejected() const {
+        return m_rejected;
+    }
+
+  private:
+    /// @brief State of a slot, a slot is only reused once its response has been sent
+    enum class Slot_State : uint8_t {
+        FREE,       // Slot may be used for the next received request
+        QUEUED,     // Request waits for the worker task
+        WAITING,    // Callback has been called, waiting for its response
+        ANSWERED,   // Response has been stored and waits for process()
+        EXPIRED,    // Watchdog expired before a response has been stored, an error response waits for process()
+        SENDING     // Response is being sent by process()
+    };
+
+    /// @brief Pending request, the payload contains the serialized parameters until the worker task copied them and the serialized response afterwards
+    struct Slot {
+        Slot_State state = Slot_State::FREE;
+        uint16_t sequence = 0U;                 // Incremented for every request using this slot, so tokens of earlier requests are rejected
+        uint32_t request_id = 0U;               // Request id received in the topic of the request
+        TickType_t started = 0U;                // Tick count the request has been received at
+        TickType_t timeout_ticks = 0U;          // Timeout of the request in ticks
+        RPC_Async_Callback callback;            // Copy of the callback that handles the request
+        char *payload = nullptr;                // Serialized parameters or response
+        size_t length = 0U;                     // Length of the payload without the null terminator
+        Callback_Watchdog *watchdog = nullptr;  // Expires the request if no response is stored in time
+    };
+
+    const size_t m_slot_count;          // Amount of slots
+    const size_t m_payload_size;        // Size of the payload of each slot
+    const uint32_t m_stack_size;        // Stack size of the worker task
+    const UBaseType_t m_priority;       // Priority of the worker task
+    Slot *m_slots;                      // Slots of the pending requests, nullptr until the first request is received
+    char *m_params;                     // Copy of the parameters of the request the worker task is currently handling
+    QueueHandle_t m_wake_ups;           // Wakes the worker task up after a request has been queued or once it should stop
+    SemaphoreHandle_t m_lock;           // Guards the slots, taken by the MQTT task, the worker task, the watchdog timers and the tasks giving responses
+    SemaphoreHandle_t m_stopped;        // Given by the worker task once it has stopped
+    TaskHandle_t m_task;                // Worker task
+    volatile bool m_stopping;           // Whether the worker task should stop once it is woken up
+    volatile uint32_t m_timeouts;       // Amount of expired requests
+    uint32_t m_dropped;                 // Amount of requests that could not be queued
+    uint32_t m_rejected;                // Amount of rejected responses
+
+    /// @brief Allocates the slots and starts the worker task, if they do not exist yet
+    /// @return Whether the worker task is running
+    inline bool start() {
+        if (m_task != nullptr) {
+            return true;
+        }
+        if (m_slots == nullptr) {
+            m_lock = xSemaphoreCreateMutex();
+            m_stopped = xSemaphoreCreateBinary();
+            m_wake_ups = xQueueCreate(m_slot_count, sizeof(uint8_t));
+            if (m_lock == nullptr || m_stopped == nullptr || m_wake_ups == nullptr) {
+                release();
+                Logger::log(RPC_ASYNC_START_FAILED);
+                return false;
+            }
+            m_params = new char[m_payload_size];
+            m_slots = new Slot[m_slot_count];
+            for (size_t i = 0U; i < m_slot_count; i++) {
+                m_slots[i].payload = new char[m_payload_size];
+                m_slots[i].watchdog = new Callback_Watchdog(std::bind(&RPC_Async_Dispatcher::expire, this, i));
+            }
+        }
+        if (xTaskCreate(&RPC_Async_Dispatcher::worker_task, RPC_ASYNC_TASK_NAME, m_stack_size, this, m_priority, &m_task) != pdPASS) {
+            m_task = nullptr;
+            Logger::log(RPC_ASYNC_START_FAILED);
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief Releases the slots, the lock and the queues, only called once no other task can use the dispatcher anymore
+    inline void release() {
+        if (m_slots != nullptr) {
+            for (size_t i = 0U; i < m_slot_count; i++) {
+                delete m_slots[i].watchdog;
+                delete[] m_slots[i].payload;
+            }
+            delete[] m_slots;
+            m_slots = nullptr;
+        }
+        delete[] m_params;
+        m_params = nullptr;
+        if (m_wake_ups != nullptr) {
+            vQueueDelete(m_wake_ups);
+            m_wake_ups = nullptr;
+        }
+        if (m_stopped != nullptr) {
+            vSemaphoreDelete(m_stopped);
+            m_stopped = nullptr;
+        }
+        if (m_lock != nullptr) {
+            vSemaphoreDelete(m_lock);
+            m_lock = nullptr;
+        }
+    }
+
+    /// @brief Called by the watchdog of the given slot, expires the request if it has not been answered yet
+    /// @param index Index of the slot whose watchdog expired
+    inline void expire(const size_t index) {
+        xSemaphoreTake(m_lock, portMAX_DELAY);
+        Slot& slot = m_slots[index];
+        // A watchdog that already fired for an earlier request using the same slot must not expire the current request,
+        // therefore the time since the current request has been received is checked as well
+        const bool pending = slot.state == Slot_State::QUEUED || slot.state == Slot_State::WAITING;
+        if (pending && xTaskGetTickCount() - slot.started + 1U >= slot.timeout_ticks) {
+            slot.state = Slot_State::EXPIRED;
+            m_timeouts++;
+        }
+        xSemaphoreGive(m_lock);
+    }
+
+    /// @brief Calls the callback of the queued request that has been waiting the longest, on the worker task
+    /// @param params_document Document the parameters are deserialized into
+    /// @return Whether a queued request was found
+    inline bool call_next(JsonDocument& params_document) {
+        xSemaphoreTake(m_lock, portMAX_DELAY);
+        const TickType_t now = xTaskGetTickCount();
+        size_t index = m_slot_count;
+        for (size_t i = 0U; i < m_slot_count; i++) {
+            if (m_slots[i].state == Slot_State::QUEUED && (index == m_slot_count || now - m_slots[i].started > now - m_slots[index].started)) {
+                index = i;
+            }
+        }
+        if (index == m_slot_count) {
+            xSemaphoreGive(m_lock);
+            return false;
+        }
+        Slot& slot = m_slots[index];
+        slot.state = Slot_State::WAITING;
+        memcpy(m_params, slot.payload, slot.length + 1U);
+        const size_t length = slot.length;
+        const RPC_Async_Callback callback = slot.callback;
+        RPC_Token token;
+        token.request_id = slot.request_id;
+        token.slot = static_cast<uint16_t>(index);
+        token.sequence = slot.sequence;
+        xSemaphoreGive(m_lock);
+
+        params_document.clear();
+        if (deserializeJson(params_document, m_params, length)) {
+            params_document.clear();
+        }
+        const JsonVariantConst params = params_document.template as<JsonVariantConst>();
+        callback.template Call_Callback<Logger>(token, params);
+        return true;
+    }
+
+    /// @brief Main loop of the worker task, calls the callbacks of all queued requests each time it is woken up
+    /// @param parameter Instance of the RPC_Async_Dispatcher the task handles the requests for
+    static void worker_task(void *parameter) {
+        RPC_Async_Dispatcher *dispatcher = static_cast<RPC_Async_Dispatcher*>(parameter);
+        // Allocated once for the lifetime of the task, the parameters are deserialized with zero copy from m_params,
+        // so the document only has to hold the data structure of the parameters
+        DynamicJsonDocument params_document(dispatcher->m_payload_size * 2U);
+        uint8_t wake_up;
+
+        while (xQueueReceive(dispatcher->m_wake_ups, &wake_up, portMAX_DELAY) == pdTRUE && !dispatcher->m_stopping) {
+            // stop() frees every slot before it sets m_stopping, so no queued request is left once the task should stop
+            while (dispatcher->call_next(params_document)) {
+                // Nothing to do
+            }
+        }
+
+        xSemaphoreGive(dispatcher->m_stopped);
+        vTaskDelete(nullptr);
+    }
+};
+
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
+
+#endif // RPC_Async_Dispatcher_h
@@ -2,22 +2,43 @@
 #include "RPC_Response.h"
 
 RPC_Response::RPC_Response() :
-    JsonVariant()
+    m_telemetry(),
+    m_variant()
+{
+    // Nothing to do
+}
+
+RPC_Response::RPC_Response(JsonVariantConst variant) :
+    m_telemetry(),
+    m_variant(variant)
 {
     // Nothing to do
 }
 
 RPC_Response::RPC_Response(JsonVariant variant) :
-    JsonVariant(variant)
+    RPC_Response(variant.as<JsonVariantConst>())
 {
     // Nothing to do
 }
 
-RPC_Response::RPC_Response(Telemetry telemetry) {
-    StaticJsonDocument<JSON_OBJECT_SIZE(1)> jsonBuffer;
-    const JsonVariant object = jsonBuffer.to<JsonVariant>();
-    if (!telemetry.SerializeKeyValue(object)) {
-        return;
+RPC_Response::RPC_Response(Telemetry telemetry) :
+    m_telemetry(telemetry),
+    m_variant()
+{
+    // Nothing to do
+}
+
+bool RPC_Response::isNull() const {
+    return m_variant.isNull() && m_telemetry.IsEmpty();
+}
+
+JsonVariantConst RPC_Response::Serialize(JsonDocument& arena) const {
+    if (!m_variant.isNull()) {
+        return m_variant;
+    }
+    arena.clear();
+    if (m_telemetry.IsEmpty() || !m_telemetry.SerializeKeyValue(arena.to<JsonVariant>())) {
+        return JsonVariantConst();
     }
-    this->set(object);
+    return arena.as<JsonVariantConst>();
 }
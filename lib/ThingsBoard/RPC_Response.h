@@ -5,15 +5,26 @@
 #include "Telemetry.h"
 
 
-/// @brief RPC response expected to be sent by the user to the server once an RPC method has been called by the server,
-/// is a simple wrapper around the Telemetry and JsonVariant class, which allow to easily serialize the response into a json string
-class RPC_Response : public JsonVariant {
+/// @brief RPC response expected to be sent by the user to the server once an RPC method has been called by the server.
+/// A response created from a key-value pair is stored inline and only serialized into the arena passed by the caller when it is sent,
+/// meaning it does not reference any temporary memory and can be returned from the callback by value.
+/// A response created from a JsonVariant only references the variant, therefore the JsonDocument containing the variant has to outlive the callback,
+/// for example by declaring it static
+class RPC_Response {
   public:
+    /// @brief Size of the arena that is required to serialize any response created from a key-value pair,
+    /// the key and string values are stored as pointers, meaning only the object itself needs memory
+    static constexpr size_t ARENA_SIZE = JSON_OBJECT_SIZE(1);
+
     /// @brief Constructor
     RPC_Response();
 
     /// @brief Constructor
-    /// @param variant JsonVariant object the internal data should be copied from
+    /// @param variant JsonVariant object that should be sent, the underlying JsonDocument has to stay valid until the response has been sent
+    explicit RPC_Response(JsonVariantConst variant);
+
+    /// @brief Constructor, exact overload for JsonVariant, because it could otherwise be implicitly converted into both a JsonVariantConst and a Telemetry object
+    /// @param variant JsonVariant object that should be sent, the underlying JsonDocument has to stay valid until the response has been sent
     explicit RPC_Response(JsonVariant variant);
 
     /// @brief Constructor
@@ -30,6 +41,19 @@ class RPC_Response : public JsonVariant {
     {
         // Nothing to do
     }
+
+    /// @brief Whether the response is empty, empty responses are not sent to the server
+    /// @return Whether there is any data in this response or not
+    bool isNull() const;
+
+    /// @brief Returns the json that should be sent to the server
+    /// @param arena JsonDocument of atleast ARENA_SIZE bytes, a key-value pair is serialized into it, has to stay valid as long as the returned variant is used
+    /// @return Variant containing the response, null if the response is empty or could not be serialized
+    JsonVariantConst Serialize(JsonDocument& arena) const;
+
+  private:
+    Telemetry        m_telemetry; // Key-value pair or value, empty if the response was created from a variant
+    JsonVariantConst m_variant;   // Response created from a variant, null if the response was created from a key-value pair
 };
 
 #endif //RPC_RESPONSE_H
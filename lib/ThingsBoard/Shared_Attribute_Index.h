@@ -0,0 +1,198 @@
+#ifndef Shared_Attribute_Index_h
+#define Shared_Attribute_Index_h
+
+// Local includes.
+#include "Shared_Attribute_Callback.h"
+#if !THINGSBOARD_ENABLE_STL
+#include "Vector.h"
+#endif // !THINGSBOARD_ENABLE_STL
+
+// Library includes.
+#include <ArduinoJson.h>
+#include <string.h>
+#if THINGSBOARD_ENABLE_STL
+#include <vector>
+#endif // THINGSBOARD_ENABLE_STL
+
+
+/// @brief Sorted index from subscribed shared attribute keys to the position of the callback that subscribed them.
+/// Built at subscribe time, so a received shared attribute update is dispatched in a single pass over the keys of the payload,
+/// where each key is looked up with a binary search, instead of checking every key of every subscribed callback against the payload.
+/// Callbacks are identified by their position in the callback vector and are only ever appended, or all removed at once
+class Shared_Attribute_Index {
+  public:
+    /// @brief Constructs an empty index
+    inline Shared_Attribute_Index() :
+        m_keys(),
+        m_marks(),
+        m_generation(1U)
+    {
+        // Nothing to do
+    }
+
+    /// @brief Adds all keys of the given callback to the index, has to be called in the same order the callbacks are appended to the callback vector
+    /// @param callback Subscribed callback, the keys it points to have to stay valid until the index is cleared
+    inline void add(const Shared_Attribute_Callback& callback) {
+        const size_t position = m_marks.size();
+        m_marks.push_back(Mark());
+#if THINGSBOARD_ENABLE_STL
+        for (const char *att : callback.Get_Attributes()) {
+            if (att != nullptr) {
+                insert(att, strlen(att), position);
+            }
+        }
+#else
+        // Keys are stored as pointers into the comma seperated string, instead of copying them into temporary strings
+        const char *att = callback.Get_Attributes();
+        while (att != nullptr && *att != '\0') {
+            const char *end = strchr(att, COMMA_SEPARATOR);
+            if (end == nullptr) {
+                end = att + strlen(att);
+            }
+            const char *first = att;
+            const char *last = end;
+            while (first < last && *first == ' ') {
+                first++;
+            }
+            while (last > first && *(last - 1U) == ' ') {
+                last--;
+            }
+            if (last > first) {
+                insert(first, last - first, position);
+            }
+            att = *end == '\0' ? end : end + 1U;
+        }
+#endif // THINGSBOARD_ENABLE_STL
+    }
+
+    /// @brief Removes all keys and callbacks from the index
+    inline void clear() {
+        m_keys.clear();
+        m_marks.clear();
+        m_generation = 1U;
+    }
+
+    /// @brief Looks up every key of the given payload and marks the callbacks that subscribed to any of them,
+    /// the result is read with matched_key() until the next call to this method
+    /// @param data Received shared attribute update
+    inline void match(const JsonObjectConst& data) {
+        m_generation++;
+        if (m_generation == 0U) {
+            // Marks of older generations could be mistaken for the current one after the counter wraps
+            for (size_t i = 0; i < m_marks.size(); i++) {
+                m_marks[i] = Mark();
+            }
+            m_generation = 1U;
+        }
+
+        for (const JsonPairConst kvp : data) {
+            const char *key = kvp.key().c_str();
+            if (key == nullptr) {
+                continue;
+            }
+            const size_t length = strlen(key);
+            // Multiple callbacks can subscribe to the same key, they are stored next to each other
+            for (size_t i = lower_bound(key, length); i < m_keys.size() && compare(m_keys[i], key, length) == 0; i++) {
+                Mark& mark = m_marks[m_keys[i].callback];
+                if (mark.generation != m_generation) {
+                    mark.generation = m_generation;
+                    mark.key = key;
+                }
+            }
+        }
+    }
+
+    /// @brief Returns the first received key the callback at the given position subscribed to, during the last call to match()
+    /// @param position Position of the callback in the callback vector
+    /// @return Key of the received payload, or nullptr if the callback did not subscribe to any of the received keys
+    inline const char* matched_key(const size_t& position) const {
+        if (position >= m_marks.size() || m_marks[position].generation != m_generation) {
+            return nullptr;
+        }
+        return m_marks[position].key;
+    }
+
+    /// @brief Amount of keys over all added callbacks
+    /// @return Amount of indexed keys
+    inline size_t size() const {
+        return m_keys.size();
+    }
+
+  private:
+    static constexpr char COMMA_SEPARATOR = ',';
+
+    /// @brief Subscribed key, not null terminated in non STL mode because it points into the comma seperated string of the callback
+    struct Key {
+        const char *key = nullptr; // Start of the key
+        size_t length = 0U; // Length of the key in characters
+        size_t callback = 0U; // Position of the callback that subscribed the key
+    };
+
+    /// @brief Match state of a single callback, only valid if its generation is the generation of the last call to match()
+    struct Mark {
+        uint32_t generation = 0U; // Generation of the last match() call that found any subscribed key
+        const char *key = nullptr; // First found key, points into the received payload
+    };
+
+#if THINGSBOARD_ENABLE_STL
+    template<typename T>
+    using Vector = std::vector<T>;
+#endif // THINGSBOARD_ENABLE_STL
+
+    /// @brief Orders the given indexed key and the given key by their characters, shorter keys first if one is a prefix of the other
+    /// @param entry Indexed key
+    /// @param key Key that should be compared, does not need to be null terminated
+    /// @param length Length of the compared key
+    /// @return Negative, zero or positive if the indexed key is ordered before, equal or after the given key
+    static inline int compare(const Key& entry, const char *key, const size_t& length) {
+        const int result = memcmp(entry.key, key, entry.length < length ? entry.length : length);
+        if (result != 0) {
+            return result;
+        }
+        return entry.length < length ? -1 : (entry.length > length ? 1 : 0);
+    }
+
+    /// @brief Finds the first indexed key that is not ordered before the given key
+    /// @param key Key that should be found
+    /// @param length Length of the key
+    /// @return Position of the first equal or greater key, the amount of keys if there is none
+    inline size_t lower_bound(const char *key, const size_t& length) const {
+        size_t first = 0U;
+        size_t count = m_keys.size();
+        while (count > 0U) {
+            const size_t step = count / 2U;
+            if (compare(m_keys[first + step], key, length) < 0) {
+                first += step + 1U;
+                count -= step + 1U;
+            }
+            else {
+                count = step;
+            }
+        }
+        return first;
+    }
+
+    /// @brief Inserts the given key after all equal keys, so callbacks subscribed to the same key stay in the order they were added
+    /// @param key Start of the key
+    /// @param length Length of the key
+    /// @param callback Position of the callback that subscribed the key
+    inline void insert(const char *key, const size_t& length, const size_t& callback) {
+        Key entry;
+        entry.key = key;
+        entry.length = length;
+        entry.callback = callback;
+        m_keys.push_back(entry);
+        size_t i = m_keys.size() - 1U;
+        while (i > 0U && compare(m_keys[i - 1U], key, length) > 0) {
+            m_keys[i] = m_keys[i - 1U];
+            i--;
+        }
+        m_keys[i] = entry;
+    }
+
+    Vector<Key> m_keys; // Subscribed keys of all callbacks, sorted by their characters
+    Vector<Mark> m_marks; // Match state of each callback, indexed by the position of the callback
+    uint32_t m_generation; // Incremented on every call to match(), so the marks do not have to be cleared for every message
+};
+
+#endif // Shared_Attribute_Index_h
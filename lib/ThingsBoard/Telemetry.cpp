@@ -54,18 +54,26 @@ bool Telemetry::SerializeKeyValue(const JsonVariant &jsonObj) const {
         return false;
     }
 
+    return SerializeValue(jsonObj);
+}
+
+const char *Telemetry::GetKey() const {
+    return m_key;
+}
+
+bool Telemetry::SerializeValue(const JsonVariant &jsonVariant) const {
     switch (m_type) {
         case DataType::TYPE_BOOL:	
-            return jsonObj.set(m_value.boolean);	
+            return jsonVariant.set(m_value.boolean);	
             break;
         case DataType::TYPE_INT:
-            return jsonObj.set(m_value.integer);
+            return jsonVariant.set(m_value.integer);
             break;
         case DataType::TYPE_REAL:
-            return jsonObj.set(m_value.real);
+            return jsonVariant.set(m_value.real);
             break;
         case DataType::TYPE_STR:
-            return jsonObj.set(m_value.str);
+            return jsonVariant.set(m_value.str);
             break;
         default:
             // Nothing to do
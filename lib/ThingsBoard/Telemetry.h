@@ -79,6 +79,15 @@ class Telemetry {
     /// @return Whether serializing was successful or not
     bool SerializeKeyValue(const JsonVariant &jsonObj) const;
 
+    /// @brief Key of the key-value pair
+    /// @return Key passed to the constructor, nullptr if the record is empty
+    const char *GetKey() const;
+
+    /// @brief Serializes only the value depending on the constructor used, without its key
+    /// @param jsonVariant Variant the value will be copied into
+    /// @return Whether serializing was successful or not
+    bool SerializeValue(const JsonVariant &jsonVariant) const;
+
   private:
     // Data container
     union Data {
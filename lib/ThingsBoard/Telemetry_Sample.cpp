@@ -0,0 +1,77 @@
+// Header include.
+#include "Telemetry_Sample.h"
+
+constexpr char Telemetry_Sample::SERIES_BEGIN[];
+constexpr char Telemetry_Sample::SERIES_END[];
+constexpr char Telemetry_Sample::ENTRY_BEGIN[];
+constexpr char Telemetry_Sample::VALUES_BEGIN[];
+constexpr char Telemetry_Sample::ENTRY_END[];
+constexpr char Telemetry_Sample::VALUE_SEPARATOR[];
+constexpr char Telemetry_Sample::KEY_SEPARATOR[];
+
+Telemetry_Sample::Telemetry_Sample() :
+    m_timestamp(0U),
+    m_telemetry()
+{
+    // Nothing to do
+}
+
+const uint64_t& Telemetry_Sample::GetTimestamp() const {
+    return m_timestamp;
+}
+
+const Telemetry& Telemetry_Sample::GetTelemetry() const {
+    return m_telemetry;
+}
+
+size_t Telemetry_Sample::MeasureSeries(const Telemetry_Sample *samples, const size_t& sample_count) {
+    Counting_Writer writer;
+    return SerializeSeries(samples, sample_count, writer);
+}
+
+size_t Telemetry_Sample::SerializeSeries(const Telemetry_Sample *samples, const size_t& sample_count, char *buffer, const size_t& buffer_size) {
+    if (buffer == nullptr || buffer_size == 0U) {
+        return 0U;
+    }
+    // Last byte is reserved for the null terminator
+    Buffer_Writer writer(buffer, buffer_size - 1U);
+    const size_t bytes_written = SerializeSeries(samples, sample_count, writer);
+    buffer[bytes_written < buffer_size ? bytes_written : buffer_size - 1U] = '\0';
+    return bytes_written;
+}
+
+size_t Telemetry_Sample::Counting_Writer::write(uint8_t c) {
+    (void)c;
+    return 1U;
+}
+
+size_t Telemetry_Sample::Counting_Writer::write(const uint8_t *s, size_t n) {
+    (void)s;
+    return n;
+}
+
+Telemetry_Sample::Buffer_Writer::Buffer_Writer(char *buffer, const size_t& buffer_size) :
+    m_buffer(buffer),
+    m_capacity(buffer_size),
+    m_size(0U)
+{
+    // Nothing to do
+}
+
+size_t Telemetry_Sample::Buffer_Writer::write(uint8_t c) {
+    if (m_size >= m_capacity) {
+        return 0U;
+    }
+    m_buffer[m_size++] = static_cast<char>(c);
+    return 1U;
+}
+
+size_t Telemetry_Sample::Buffer_Writer::write(const uint8_t *s, size_t n) {
+    const size_t remaining = m_capacity - m_size;
+    if (n > remaining) {
+        n = remaining;
+    }
+    memcpy(m_buffer + m_size, s, n);
+    m_size += n;
+    return n;
+}
@@ -0,0 +1,154 @@
+#ifndef Telemetry_Sample_h
+#define Telemetry_Sample_h
+
+// Local includes.
+#include "Telemetry.h"
+
+// Library includes.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <ArduinoJson.h>
+
+
+/// @brief Telemetry record with the timestamp it has been measured at, allows to send a batch of samples measured at different times in a single message.
+/// The samples are serialized into the time series format expected by the server, [{"ts":1451649600512,"values":{"key1":"value1","key2":"value2"}}],
+/// where consecutive samples with the same timestamp are grouped into the values of a single entry.
+/// Sort the samples by their timestamp before sending them, to ensure every timestamp only creates one entry.
+/// See https://thingsboard.io/docs/reference/mqtt-api/#telemetry-upload-api for more information
+class Telemetry_Sample {
+  public:
+    /// @brief Creates an empty sample containing neither a timestamp, key nor value
+    Telemetry_Sample();
+
+    /// @brief Constructs a sample from the given value, supports every type the Telemetry constructors support
+    /// @tparam T Type of the passed value
+    /// @param timestamp Unix timestamp in milliseconds the value has been measured at
+    /// @param key Key of the key value pair we want to create, has to stay valid until the sample has been sent, because it is not copied
+    /// @param value Value of the key value pair we want to create, strings have to stay valid until the sample has been sent as well
+    template <typename T>
+    inline Telemetry_Sample(const uint64_t& timestamp, const char *key, T value)
+      : m_timestamp(timestamp),
+      m_telemetry(key, value)
+    {
+        // Nothing to do
+    }
+
+    /// @brief Timestamp the value has been measured at
+    /// @return Unix timestamp in milliseconds
+    const uint64_t& GetTimestamp() const;
+
+    /// @brief Key value pair of the sample
+    /// @return Telemetry record containing the key and value
+    const Telemetry& GetTelemetry() const;
+
+    /// @brief Calculates the amount of bytes the given samples require once serialized, without serializing them into any buffer
+    /// @param samples Array containing all the samples we want to measure
+    /// @param sample_count Amount of samples in the array
+    /// @return Amount of bytes without the null terminator, 0 if any sample is empty
+    static size_t MeasureSeries(const Telemetry_Sample *samples, const size_t& sample_count);
+
+    /// @brief Serializes the given samples into the given buffer, followed by a null terminator
+    /// @param samples Array containing all the samples we want to serialize
+    /// @param sample_count Amount of samples in the array
+    /// @param buffer Buffer the json is written into, should be at least MeasureSeries() + 1 bytes big
+    /// @param buffer_size Size of the given buffer
+    /// @return Amount of bytes written without the null terminator, less than MeasureSeries() if the buffer was too small, 0 if any sample is empty
+    static size_t SerializeSeries(const Telemetry_Sample *samples, const size_t& sample_count, char *buffer, const size_t& buffer_size);
+
+    /// @brief Serializes the given samples directly into the given destination, one value after another,
+    /// meaning neither a JsonDocument nor a buffer containing the complete json is ever created.
+    /// Allows to send thousands of samples in a single message, when streaming them into the client with a BufferingPrint
+    /// @tparam TDestination Class the json is written into, requires the size_t write(uint8_t) and size_t write(const uint8_t*, size_t) methods, which includes Print
+    /// @param samples Array containing all the samples we want to serialize
+    /// @param sample_count Amount of samples in the array
+    /// @param destination Destination the json is written into
+    /// @return Amount of bytes written, 0 if any sample is empty
+    template <typename TDestination>
+    inline static size_t SerializeSeries(const Telemetry_Sample *samples, const size_t& sample_count, TDestination& destination) {
+      // Only ever contains a single number or a zero copy string in its root, therefore the memory pool is never used
+      StaticJsonDocument<JSON_OBJECT_SIZE(1)> token;
+      const JsonVariant variant = token.template to<JsonVariant>();
+
+      size_t bytes_written = Write(destination, SERIES_BEGIN);
+      for (size_t i = 0; i < sample_count; i++) {
+        const Telemetry_Sample& sample = samples[i];
+        const char *key = sample.m_telemetry.GetKey();
+        if (key == nullptr) {
+          return 0U;
+        }
+
+        if (i == 0U || samples[i - 1U].m_timestamp != sample.m_timestamp) {
+          if (i != 0U) {
+            bytes_written += Write(destination, ENTRY_END);
+            bytes_written += Write(destination, VALUE_SEPARATOR);
+          }
+          bytes_written += Write(destination, ENTRY_BEGIN);
+          variant.set(sample.m_timestamp);
+          bytes_written += serializeJson(variant, destination);
+          bytes_written += Write(destination, VALUES_BEGIN);
+        }
+        else {
+          bytes_written += Write(destination, VALUE_SEPARATOR);
+        }
+
+        // Strings are set as a const char* and therefore stored as a pointer --> zero copy, the key is escaped by serializing it like a value
+        variant.set(key);
+        bytes_written += serializeJson(variant, destination);
+        bytes_written += Write(destination, KEY_SEPARATOR);
+        if (!sample.m_telemetry.SerializeValue(variant)) {
+          return 0U;
+        }
+        bytes_written += serializeJson(variant, destination);
+      }
+      if (sample_count != 0U) {
+        bytes_written += Write(destination, ENTRY_END);
+      }
+      bytes_written += Write(destination, SERIES_END);
+      return bytes_written;
+    }
+
+  private:
+    static constexpr char SERIES_BEGIN[] = "[";
+    static constexpr char SERIES_END[] = "]";
+    static constexpr char ENTRY_BEGIN[] = "{\"ts\":";
+    static constexpr char VALUES_BEGIN[] = ",\"values\":{";
+    static constexpr char ENTRY_END[] = "}}";
+    static constexpr char VALUE_SEPARATOR[] = ",";
+    static constexpr char KEY_SEPARATOR[] = ":";
+
+    /// @brief Destination that only counts the bytes written into it, used to measure the serialized size
+    class Counting_Writer {
+      public:
+        size_t write(uint8_t c);
+        size_t write(const uint8_t *s, size_t n);
+    };
+
+    /// @brief Destination that writes into a fixed size buffer and discards everything that does not fit anymore
+    class Buffer_Writer {
+      public:
+        Buffer_Writer(char *buffer, const size_t& buffer_size);
+        size_t write(uint8_t c);
+        size_t write(const uint8_t *s, size_t n);
+
+      private:
+        char *m_buffer;       // Buffer the bytes are written into
+        size_t m_capacity;    // Amount of bytes that can be written into the buffer
+        size_t m_size;        // Amount of bytes that have already been written into the buffer
+    };
+
+    /// @brief Writes the given null terminated text into the destination
+    /// @tparam TDestination Class the text is written into
+    /// @param destination Destination the text is written into
+    /// @param text Text that should be written
+    /// @return Amount of bytes written
+    template <typename TDestination>
+    inline static size_t Write(TDestination& destination, const char *text) {
+      return destination.write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+    }
+
+    uint64_t  m_timestamp; // Unix timestamp in milliseconds the value has been measured at
+    Telemetry m_telemetry; // Key-value pair of the sample
+};
+
+#endif // Telemetry_Sample_h
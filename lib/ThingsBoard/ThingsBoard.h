@@ -7,12 +7,17 @@
 #include "Helper.h"
 #include "ThingsBoardDefaultLogger.h"
 #include "Shared_Attribute_Callback.h"
+#include "Shared_Attribute_Index.h"
 #include "Attribute_Request_Callback.h"
+#include "Attribute_Request_Table.h"
 #include "RPC_Callback.h"
+#include "Telemetry_Sample.h"
+#include "RPC_Async_Dispatcher.h"
 #include "RPC_Request_Callback.h"
 #include "Provision_Callback.h"
 #include "OTA_Handler.h"
 #include "IMQTT_Client.h"
+#include "Topic_Router.h"
 
 // Library includes.
 #if THINGSBOARD_ENABLE_STREAM_UTILS
@@ -36,17 +41,13 @@ constexpr char TELEMETRY_TOPIC[] = "v1/devices/me/telemetry";
 #if THINGSBOARD_ENABLE_PROGMEM
 constexpr char RPC_SUBSCRIBE_TOPIC[] PROGMEM = "v1/devices/me/rpc/request/+";
 constexpr char RPC_RESPONSE_SUBSCRIBE_TOPIC[] PROGMEM = "v1/devices/me/rpc/response/+";
-constexpr char RPC_SEND_REQUEST_TOPIC[] PROGMEM = "v1/devices/me/rpc/request/%u";
 constexpr char RPC_REQUEST_TOPIC[] PROGMEM = "v1/devices/me/rpc/request";
 constexpr char RPC_RESPONSE_TOPIC[] PROGMEM = "v1/devices/me/rpc/response";
-constexpr char RPC_SEND_RESPONSE_TOPIC[] = "v1/devices/me/rpc/response/%u";
 #else
 constexpr char RPC_SUBSCRIBE_TOPIC[] = "v1/devices/me/rpc/request/+";
 constexpr char RPC_RESPONSE_SUBSCRIBE_TOPIC[] = "v1/devices/me/rpc/response/+";
-constexpr char RPC_SEND_REQUEST_TOPIC[] = "v1/devices/me/rpc/request/%u";
 constexpr char RPC_REQUEST_TOPIC[] = "v1/devices/me/rpc/request";
 constexpr char RPC_RESPONSE_TOPIC[] = "v1/devices/me/rpc/response";
-constexpr char RPC_SEND_RESPONSE_TOPIC[] = "v1/devices/me/rpc/response/%u";
 #endif // THINGSBOARD_ENABLE_PROGMEM
 
 // Firmware topics.
@@ -74,6 +75,77 @@ constexpr char PROV_RESPONSE_TOPIC[] PROGMEM = "/provision/response";
 constexpr char PROV_RESPONSE_TOPIC[] = "/provision/response";
 #endif // THINGSBOARD_ENABLE_PROGMEM
 
+// Inbound topic routes, the level following the topic of each route contains the request id or chunk index.
+enum Inbound_Route : uint8_t {
+  RPC_RESPONSE_ROUTE,
+  RPC_REQUEST_ROUTE,
+  ATTRIBUTE_RESPONSE_ROUTE,
+  ATTRIBUTE_ROUTE,
+  PROV_RESPONSE_ROUTE,
+  FIRMWARE_RESPONSE_ROUTE
+};
+// Topic of an inbound route, compared as a prefix of the received topic.
+struct Inbound_Topic {
+  const char *topic; // Topic without the id level, may be placed into flash memory
+  size_t length; // Length of the topic without the null terminator
+  Inbound_Route route; // Route of messages received on the topic
+  bool id; // Whether the topic has to be followed by exactly one id level, instead of ending there
+};
+// Checked in the order of how often messages arrive, firmware chunks during an update first, then server-side RPC and shared attribute updates,
+// the responses to our own requests last. Attributes is checked before its response topic, because it only matches if the received topic ends there.
+constexpr Inbound_Topic INBOUND_TOPICS[] = {
+  { FIRMWARE_RESPONSE_TOPIC, sizeof(FIRMWARE_RESPONSE_TOPIC) - 1U, FIRMWARE_RESPONSE_ROUTE, true },
+  { RPC_REQUEST_TOPIC, sizeof(RPC_REQUEST_TOPIC) - 1U, RPC_REQUEST_ROUTE, true },
+  { ATTRIBUTE_TOPIC, sizeof(ATTRIBUTE_TOPIC) - 1U, ATTRIBUTE_ROUTE, false },
+  { ATTRIBUTE_RESPONSE_TOPIC, sizeof(ATTRIBUTE_RESPONSE_TOPIC) - 1U, ATTRIBUTE_RESPONSE_ROUTE, true },
+  { RPC_RESPONSE_TOPIC, sizeof(RPC_RESPONSE_TOPIC) - 1U, RPC_RESPONSE_ROUTE, true },
+  { PROV_RESPONSE_TOPIC, sizeof(PROV_RESPONSE_TOPIC) - 1U, PROV_RESPONSE_ROUTE, false }
+};
+using Inbound_Match = Topic_Match<1U>;
+
+/// @brief Matches the received topic against the inbound routes and reads the request id or chunk index directly from the topic,
+/// without copying it into a String or std::string first
+/// @param topic Received topic
+/// @param match Matched route and its id, TOPIC_CAPTURE_INVALID if the id level is not a decimal number or does not fit into 32 bits
+/// @return Whether any inbound route matched the received topic
+inline bool Match_Inbound_Topic(const char *topic, Inbound_Match& match) {
+  for (const Inbound_Topic& inbound : INBOUND_TOPICS) {
+    if (strncmp_P(topic, inbound.topic, inbound.length) != 0) {
+      continue;
+    }
+    const char *level = topic + inbound.length;
+    if (!inbound.id) {
+      if (*level != '\0') {
+        continue;
+      }
+      match.route = inbound.route;
+      match.captures = 0U;
+      return true;
+    }
+    else if (*level != '/') {
+      continue;
+    }
+
+    uint32_t number = 0U;
+    bool numeric = *(++level) != '\0';
+    for (; *level != '\0'; level++) {
+      // Further topic levels do not belong to any route
+      if (*level == '/') {
+        return false;
+      }
+      const uint32_t digit = static_cast<uint32_t>(*level - '0');
+      // Values that do not fit into 32 bits are not numbers either, instead of silently wrapping around
+      numeric = numeric && *level >= '0' && *level <= '9' && number <= (UINT32_MAX - digit) / 10U;
+      number = number * 10U + digit;
+    }
+    match.route = inbound.route;
+    match.captures = 1U;
+    match.values[0] = numeric ? number : TOPIC_CAPTURE_INVALID;
+    return true;
+  }
+  return false;
+}
+
 // Default login data.
 #if THINGSBOARD_ENABLE_PROGMEM
 constexpr char PROV_ACCESS_TOKEN[] PROGMEM = "provision";
@@ -124,8 +196,6 @@ constexpr char MAX_RPC_EXCEEDED[] PROGMEM = "Too many server-side RPC subscripti
 constexpr char MAX_RPC_REQUEST_EXCEEDED[] PROGMEM = "Too many client-side RPC subscriptions, increase MaxFieldsAmt or unsubscribe";
 constexpr char MAX_SHARED_ATT_UPDATE_EXCEEDED[] PROGMEM = "Too many shared attribute update callback subscriptions, increase MaxFieldsAmt or unsubscribe";
 constexpr char MAX_SHARED_ATT_REQUEST_EXCEEDED[] PROGMEM = "Too many shared attribute request callback subscriptions, increase MaxFieldsAmt";
-#else
-constexpr char COLON PROGMEM = ':';
 #endif // !THINGSBOARD_ENABLE_DYNAMIC
 constexpr char COMMA PROGMEM = ',';
 constexpr char NO_KEYS_TO_REQUEST[] PROGMEM = "No keys to request were given";
@@ -156,8 +226,6 @@ constexpr char MAX_RPC_EXCEEDED[] = "Too many server-side RPC subscriptions, inc
 constexpr char MAX_RPC_REQUEST_EXCEEDED[] = "Too many client-side RPC subscriptions, increase MaxFieldsAmt or unsubscribe";
 constexpr char MAX_SHARED_ATT_UPDATE_EXCEEDED[] = "Too many shared attribute update callback subscriptions, increase MaxFieldsAmt or unsubscribe";
 constexpr char MAX_SHARED_ATT_REQUEST_EXCEEDED[] = "Too many shared attribute request callback subscriptions, increase MaxFieldsAmt";
-#else
-constexpr char COLON = ':';
 #endif // !THINGSBOARD_ENABLE_DYNAMIC
 constexpr char COMMA = ',';
 constexpr char NO_KEYS_TO_REQUEST[] = "No keys to request were given";
@@ -246,6 +314,7 @@ constexpr char CHECKSUM_AGORITM_MD5[] PROGMEM = "MD5";
 constexpr char CHECKSUM_AGORITM_SHA256[] PROGMEM = "SHA256";
 constexpr char CHECKSUM_AGORITM_SHA384[] PROGMEM = "SHA384";
 constexpr char CHECKSUM_AGORITM_SHA512[] PROGMEM = "SHA512";
+constexpr char CHECKSUM_AGORITM_CRC32[] PROGMEM = "CRC32";
 #else
 constexpr char CURR_FW_TITLE_KEY[] = "current_fw_title";
 constexpr char CURR_FW_VER_KEY[] = "current_fw_version";
@@ -260,6 +329,7 @@ constexpr char CHECKSUM_AGORITM_MD5[] = "MD5";
 constexpr char CHECKSUM_AGORITM_SHA256[] = "SHA256";
 constexpr char CHECKSUM_AGORITM_SHA384[] = "SHA384";
 constexpr char CHECKSUM_AGORITM_SHA512[] = "SHA512";
+constexpr char CHECKSUM_AGORITM_CRC32[] = "CRC32";
 #endif // THINGSBOARD_ENABLE_PROGMEM
 
 // Log messages.
@@ -337,7 +407,12 @@ class ThingsBoardSized {
       , m_buffering_size(bufferingSize)
       , m_rpc_callbacks()
       , m_rpc_request_callbacks()
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      , m_rpc_async_callbacks()
+      , m_rpc_async()
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
       , m_shared_attribute_update_callbacks()
+      , m_shared_attribute_index()
       , m_attribute_request_callbacks()
       , m_provision_callback()
       , m_request_id(0U)
@@ -467,6 +542,13 @@ class ThingsBoardSized {
     /// @brief Receives / sends any outstanding messages from and to the MQTT broker
     /// @return Whether sending or receiving the oustanding the messages was successful or not
     inline bool loop() {
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      // Responses of async server-side RPC callbacks may be given from any task, but are only sent from here,
+      // because the MQTT client does not support being used from multiple tasks at once
+      m_rpc_async.process([this](const uint32_t& request_id, const char *json, const size_t& length) {
+        return Send_RPC_Response(request_id, json, length);
+      });
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
       return m_client.loop();
     }
 
@@ -679,6 +761,63 @@ class ThingsBoardSized {
       return sendDataArray(data, data_count);
     }
 
+    /// @brief Attempts to send a batch of timestamped telemetry samples in a single message, consecutive samples with the same timestamp are grouped into one entry.
+    /// Serializes the samples one after another without creating a JsonDocument, therefore the amount of samples is not limited by MaxFieldsAmt.
+    /// If THINGSBOARD_ENABLE_STREAM_UTILS is set and the message is bigger than the internal buffer of the client, the samples are streamed directly into the client,
+    /// meaning the complete message does not have to fit into memory at all, which allows to upload thousands of buffered samples at once.
+    /// See https://thingsboard.io/docs/user-guide/telemetry/ for more information
+    /// @param samples Array containing all the samples we want to send, should be sorted by their timestamp
+    /// @param sample_count Amount of samples in the array that we want to send
+    /// @return Whether sending the data was successful or not
+    inline bool sendTelemetrySamples(const Telemetry_Sample *samples, size_t sample_count) {
+      if (samples == nullptr || sample_count == 0U) {
+        // Message is ignored and not sent at all.
+        return false;
+      }
+      const size_t jsonSize = Telemetry_Sample::MeasureSeries(samples, sample_count);
+      if (jsonSize == 0U) {
+        Logger::log(UNABLE_TO_SERIALIZE);
+        return false;
+      }
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+      if (m_client.get_buffer_size() < jsonSize) {
+#if THINGSBOARD_ENABLE_DEBUG
+        char message[JSON_STRING_SIZE(strlen(SEND_MESSAGE)) + JSON_STRING_SIZE(strlen(TELEMETRY_TOPIC)) + JSON_STRING_SIZE(strlen(SEND_SERIALIZED))];
+        snprintf_P(message, sizeof(message), SEND_MESSAGE, TELEMETRY_TOPIC, SEND_SERIALIZED);
+        Logger::log(message);
+#endif // THINGSBOARD_ENABLE_DEBUG
+        return Serialize_Telemetry_Samples(samples, sample_count, jsonSize);
+      }
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+      bool result = false;
+      // Check if the remaining stack size of the current task would overflow the stack,
+      // if it would allocate the memory on the heap instead to ensure no stack overflow occurs
+      if (getMaximumStackSize() < JSON_STRING_SIZE(jsonSize)) {
+        char* json = new char[JSON_STRING_SIZE(jsonSize)];
+        if (Telemetry_Sample::SerializeSeries(samples, sample_count, json, JSON_STRING_SIZE(jsonSize)) < jsonSize) {
+          Logger::log(UNABLE_TO_SERIALIZE_JSON);
+        }
+        else {
+          result = Send_Json_String(TELEMETRY_TOPIC, json);
+        }
+        // Ensure to actually delete the memory placed onto the heap, to make sure we do not create a memory leak
+        // and set the pointer to null so we do not have a dangling reference.
+        delete[] json;
+        json = nullptr;
+      }
+      else {
+        char json[JSON_STRING_SIZE(jsonSize)];
+        if (Telemetry_Sample::SerializeSeries(samples, sample_count, json, sizeof(json)) < jsonSize) {
+          Logger::log(UNABLE_TO_SERIALIZE_JSON);
+          return result;
+        }
+        result = Send_Json_String(TELEMETRY_TOPIC, json);
+      }
+      return result;
+    }
+
     /// @brief Attempts to send custom json telemetry string.
     /// See https://thingsboard.io/docs/user-guide/telemetry/ for more information
     /// @param json String containing our json key value pairs we want to attempt to send
@@ -749,6 +888,20 @@ class ThingsBoardSized {
       return Attributes_Request(callback, CLIENT_REQUEST_KEYS, CLIENT_RESPONSE_KEY);
     }
 
+    /// @brief Requests client-side and shared attributes with a single request, instead of one request and response round-trip per scope.
+    /// Meant to fetch the complete configuration of the device at once, for example directly after connecting.
+    /// Both callbacks are called with the attributes of their scope, once the response from the server is received.
+    /// See https://thingsboard.io/docs/reference/mqtt-api/#request-attribute-values-from-the-server for more information
+    /// @param client_callback Callback method that will be called with the requested client-side attributes
+    /// @param shared_callback Callback method that will be called with the requested shared attributes
+    /// @return Whether requesting the given callbacks was successful or not
+    inline bool Client_Shared_Attributes_Request(const Attribute_Request_Callback& client_callback, const Attribute_Request_Callback& shared_callback) {
+      const Attribute_Request_Callback *callbacks[] = { &client_callback, &shared_callback };
+      const char *attributeRequestKeys[] = { CLIENT_REQUEST_KEYS, SHARED_REQUEST_KEY };
+      const char *attributeResponseKeys[] = { CLIENT_RESPONSE_KEY, SHARED_RESPONSE_KEY };
+      return Attributes_Request(callbacks, attributeRequestKeys, attributeResponseKeys, 2U);
+    }
+
     //----------------------------------------------------------------------------
     // Server-side RPC API
 
@@ -832,6 +985,43 @@ class ThingsBoardSized {
       return true;
     }
 
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+
+    /// @brief Subscribe one asynchronous server-side RPC callback,
+    /// that will be called on the worker task if a request from the server for the method with the given name is received.
+    /// The callback receives a token, that has to be passed to RPC_Async_Respond() once the response is known, either from the callback itself or from any other task.
+    /// Synchronous callbacks subscribed with RPC_Subscribe() for the same method name take precedence.
+    /// See https://thingsboard.io/docs/user-guide/rpc/#server-side-rpc for more information
+    /// @param callback Callback method that will be called
+    /// @return Whether subscribing the given callback was successful or not
+    inline bool RPC_Async_Subscribe(const RPC_Async_Callback& callback) {
+#if !THINGSBOARD_ENABLE_DYNAMIC
+      if (m_rpc_async_callbacks.size() + 1 > m_rpc_async_callbacks.capacity()) {
+        Logger::log(MAX_RPC_EXCEEDED);
+        return false;
+      }
+#endif // !THINGSBOARD_ENABLE_DYNAMIC
+      if (!m_client.subscribe(RPC_SUBSCRIBE_TOPIC)) {
+        Logger::log(SUBSCRIBE_TOPIC_FAILED);
+        return false;
+      }
+
+      // Push back given callback into our local vector
+      m_rpc_async_callbacks.push_back(callback);
+      return true;
+    }
+
+    /// @brief Stores the response for an asynchronous server-side RPC request, it is sent to the server with the next call to loop().
+    /// Can be called from any task
+    /// @param token Token the RPC_Async_Callback was called with
+    /// @param response Response that should be sent, an empty response completes the request without sending anything
+    /// @return Whether the response was accepted, fails if the request was already answered or has timed out
+    inline bool RPC_Async_Respond(const RPC_Token& token, const RPC_Response& response) {
+      return m_rpc_async.respond(token, response);
+    }
+
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
+
     /// @brief Unsubcribes all server-side RPC callbacks.
     /// See https://thingsboard.io/docs/user-guide/rpc/#server-side-rpc for more information
     /// @return Whether unsubcribing all the previously subscribed callbacks
@@ -839,6 +1029,10 @@ class ThingsBoardSized {
     inline bool RPC_Unsubscribe() {
       // Empty all callbacks
       m_rpc_callbacks.clear();
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      // Requests that are already pending are still answered
+      m_rpc_async_callbacks.clear();
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
       return m_client.unsubscribe(RPC_SUBSCRIBE_TOPIC);
     }
 
@@ -898,8 +1092,8 @@ class ThingsBoardSized {
       m_request_id++;
       registeredCallback->Set_Request_ID(m_request_id);
 
-      char topic[Helper::detectSize(RPC_SEND_REQUEST_TOPIC, m_request_id)];
-      snprintf_P(topic, sizeof(topic), RPC_SEND_REQUEST_TOPIC, m_request_id);
+      char topic[TOPIC_ID_SIZE(sizeof(RPC_REQUEST_TOPIC) - 1U)];
+      Helper::formatTopic(topic, sizeof(topic), RPC_REQUEST_TOPIC, m_request_id);
 
       const size_t objectSize = Helper::Measure_Json(requestBuffer);
       return Send_Json(topic, requestBuffer, objectSize);
@@ -1022,7 +1216,11 @@ class ThingsBoardSized {
       }
 
       // Push back complete vector into our local m_shared_attribute_update_callbacks vector.
+      const size_t previous_size = m_shared_attribute_update_callbacks.size();
       m_shared_attribute_update_callbacks.insert(m_shared_attribute_update_callbacks.end(), first_itr, last_itr);
+      for (size_t i = previous_size; i < m_shared_attribute_update_callbacks.size(); i++) {
+        m_shared_attribute_index.add(m_shared_attribute_update_callbacks[i]);
+      }
       return true;
     }
 
@@ -1049,6 +1247,7 @@ class ThingsBoardSized {
 
       for (size_t i = 0; i < callbacksSize; i++) {
         m_shared_attribute_update_callbacks.push_back(callbacks[i]);
+        m_shared_attribute_index.add(callbacks[i]);
       }
       return true;
     }
@@ -1074,6 +1273,7 @@ class ThingsBoardSized {
 
       // Push back given callback into our local vector
       m_shared_attribute_update_callbacks.push_back(callback);
+      m_shared_attribute_index.add(callback);
       return true;
     }
 
@@ -1084,6 +1284,7 @@ class ThingsBoardSized {
     inline bool Shared_Attributes_Unsubscribe() {
       // Empty all callbacks
       m_shared_attribute_update_callbacks.clear();
+      m_shared_attribute_index.clear();
       return m_client.unsubscribe(ATTRIBUTE_TOPIC);
     }
   
@@ -1100,12 +1301,35 @@ class ThingsBoardSized {
     /// @return Whether sending the data was successful or not
     template <typename TSource>
     inline bool Serialize_Json(const char* topic, const TSource& source, const size_t& jsonSize) {
-      if (!m_client.begin_publish(topic, jsonSize)) {
+      // Measured size includes the null terminator, which is not part of the published payload
+      const size_t payloadSize = jsonSize - 1U;
+      if (!m_client.begin_publish(topic, payloadSize)) {
         Logger::log(UNABLE_TO_SERIALIZE_JSON);
         return false;
       }
       BufferingPrint buffered_print(m_client, getBufferingSize());
       const size_t bytes_serialized = serializeJson(source, buffered_print);
+      if (bytes_serialized < payloadSize) {
+        Logger::log(UNABLE_TO_SERIALIZE_JSON);
+        return false;
+      }
+      buffered_print.flush();
+      return m_client.end_publish();
+    }
+
+    /// @brief Serializes the given telemetry samples directly into the underlying client.
+    /// Sends the given bytes to the client without requiring any temporary buffer or JsonDocument at the cost of hugely increased send times
+    /// @param samples Array containing all the samples we want to send
+    /// @param sample_count Amount of samples in the array that we want to send
+    /// @param jsonSize Size of the serialized samples without the null terminator
+    /// @return Whether sending the data was successful or not
+    inline bool Serialize_Telemetry_Samples(const Telemetry_Sample *samples, const size_t& sample_count, const size_t& jsonSize) {
+      if (!m_client.begin_publish(TELEMETRY_TOPIC, jsonSize)) {
+        Logger::log(UNABLE_TO_SERIALIZE_JSON);
+        return false;
+      }
+      BufferingPrint buffered_print(m_client, getBufferingSize());
+      const size_t bytes_serialized = Telemetry_Sample::SerializeSeries(samples, sample_count, buffered_print);
       if (bytes_serialized < jsonSize) {
         Logger::log(UNABLE_TO_SERIALIZE_JSON);
         return false;
@@ -1164,42 +1388,26 @@ class ThingsBoardSized {
     /// @param attributeResponseKey Key of the key-value pair that will contain the attributes we got as a response
     /// @return Whether requesting the given callback was successful or not
     inline bool Attributes_Request(const Attribute_Request_Callback& callback, const char* attributeRequestKey, const char* attributeResponseKey) {
-#if THINGSBOARD_ENABLE_STL
-      const std::vector<const char *>& attributes = callback.Get_Attributes();
-
-      // Check if any sharedKeys were requested
-      if (attributes.empty()) {
-        Logger::log(NO_KEYS_TO_REQUEST);
-        return false;
-      }
-      else if (attributeRequestKey == nullptr || attributeResponseKey == nullptr) {
-#if THINGSBOARD_ENABLE_DEBUG
-        Logger::log(ATT_KEY_NOT_FOUND);
-#endif // THINGSBOARD_ENABLE_DEBUG
-        return false;
-      }
-#else
-      const char* request = callback.Get_Attributes();
-
-      if (request == nullptr) {
-        Logger::log(NO_KEYS_TO_REQUEST);
-        return false;
-      }
-#endif // THINGSBOARD_ENABLE_STL
-
-      // Ensure the response topic has been subscribed
-      Attribute_Request_Callback* registeredCallback = nullptr;
-      if (!Attributes_Request_Subscribe(callback, registeredCallback)) {
-        return false;
-      }
-      else if (registeredCallback == nullptr) {
+      const Attribute_Request_Callback *callbacks[] = { &callback };
+      return Attributes_Request(callbacks, &attributeRequestKey, &attributeResponseKey, 1U);
+    }
+
+    /// @brief Requests the attributes of multiple callbacks with a single request,
+    /// where each callback will be called with the attributes of its scope once the response from the server is received
+    /// @param callbacks Callback methods that will be called, at most one per scope
+    /// @param attributeRequestKeys Key of the key-value pair that will contain the attributes we want to request, for each callback
+    /// @param attributeResponseKeys Key of the key-value pair that will contain the attributes we got as a response, for each callback
+    /// @param count Amount of callbacks
+    /// @return Whether requesting the given callbacks was successful or not
+    inline bool Attributes_Request(const Attribute_Request_Callback * const *callbacks, const char * const *attributeRequestKeys, const char * const *attributeResponseKeys, const size_t& count) {
+      if (count == 0U || count > Attribute_Request_Table<>::MAX_SCOPES) {
         return false;
       }
 
       // String are const char* and therefore stored as a pointer --> zero copy, meaning the size for the strings is 0 bytes,
       // Data structure size depends on the amount of key value pairs passed + the default clientKeys or sharedKeys
       // See https://arduinojson.org/v6/assistant/ for more information on the needed size for the JsonDocument
-      constexpr size_t dataStructureMemoryUsage = JSON_OBJECT_SIZE(1U);
+      constexpr size_t dataStructureMemoryUsage = JSON_OBJECT_SIZE(Attribute_Request_Table<>::MAX_SCOPES);
       StaticJsonDocument<dataStructureMemoryUsage> requestBuffer;
       // The .template variant of createing the JsonVariant has to be used,
       // because we are passing a template to the StaticJsonDocument template list
@@ -1207,38 +1415,70 @@ class ThingsBoardSized {
       const JsonVariant requestVariant = requestBuffer.template as<JsonVariant>();
 
 #if THINGSBOARD_ENABLE_STL
-      std::string request;
+      std::string requests[Attribute_Request_Table<>::MAX_SCOPES];
+#endif // THINGSBOARD_ENABLE_STL
 
-      for (const char *att : attributes) {
-        // Check if the given attribute is null, if it is skip it
-        if (att == nullptr) {
+      for (size_t i = 0U; i < count; i++) {
+        const char *attributeRequestKey = attributeRequestKeys[i];
+        if (attributeRequestKey == nullptr || attributeResponseKeys[i] == nullptr) {
 #if THINGSBOARD_ENABLE_DEBUG
-          Logger::log(ATT_IS_NULL);
+          Logger::log(ATT_KEY_NOT_FOUND);
 #endif // THINGSBOARD_ENABLE_DEBUG
-          continue;
+          return false;
         }
 
-        request.append(att);
-        request.push_back(COMMA);
-      }
+#if THINGSBOARD_ENABLE_STL
+        std::string& request = requests[i];
+
+        for (const char *att : callbacks[i]->Get_Attributes()) {
+          // Check if the given attribute is null, if it is skip it
+          if (att == nullptr) {
+#if THINGSBOARD_ENABLE_DEBUG
+            Logger::log(ATT_IS_NULL);
+#endif // THINGSBOARD_ENABLE_DEBUG
+            continue;
+          }
 
-      // Remove latest not needed ,
-      request.pop_back();
+          if (!request.empty()) {
+            request.push_back(COMMA);
+          }
+          request.append(att);
+        }
 
-      requestVariant[attributeRequestKey] = request.c_str();
+        // Check if any sharedKeys were requested
+        if (request.empty()) {
+          Logger::log(NO_KEYS_TO_REQUEST);
+          return false;
+        }
+
+        requestVariant[attributeRequestKey] = request.c_str();
 #else
-      requestVariant[attributeRequestKey] = request;
+        const char* request = callbacks[i]->Get_Attributes();
+
+        if (request == nullptr) {
+          Logger::log(NO_KEYS_TO_REQUEST);
+          return false;
+        }
+
+        requestVariant[attributeRequestKey] = request;
 #endif // THINGSBOARD_ENABLE_STL
+      }
 
-      m_request_id++;
-      registeredCallback->Set_Request_ID(m_request_id);
-      registeredCallback->Set_Attribute_Key(attributeResponseKey);
+      // Ensure the response topic has been subscribed and reserve a request id, that is answered by a single response for all callbacks
+      if (!Attributes_Request_Subscribe(callbacks, attributeResponseKeys, count)) {
+        return false;
+      }
 
       char topic[Helper::detectSize(ATTRIBUTE_REQUEST_TOPIC, m_request_id)];
       snprintf_P(topic, sizeof(topic), ATTRIBUTE_REQUEST_TOPIC, m_request_id);
 
       const size_t objectSize = Helper::Measure_Json(requestBuffer);
-      return Send_Json(topic, requestBuffer, objectSize);
+      if (!Send_Json(topic, requestBuffer, objectSize)) {
+        // The server never answers a request that was not sent, therefore the slots would never be freed again
+        m_attribute_request_callbacks.remove(m_request_id);
+        return false;
+      }
+      return true;
     }
 
     /// @brief Subscribes one provision callback,
@@ -1370,6 +1610,9 @@ class ThingsBoardSized {
       else if (fw_algorithm.compare(CHECKSUM_AGORITM_SHA512) == 0) {
         fw_checksum_algorithm = mbedtls_md_type_t::MBEDTLS_MD_SHA512;
       }
+      else if (fw_algorithm.compare(CHECKSUM_AGORITM_CRC32) == 0) {
+        fw_checksum_algorithm = MD_TYPE_CRC32;
+      }
       else {
         char message[JSON_STRING_SIZE(strlen(FW_CHKS_ALGO_NOT_SUPPORTED)) + JSON_STRING_SIZE(fw_algorithm.size())];
         snprintf_P(message, sizeof(message), FW_CHKS_ALGO_NOT_SUPPORTED, fw_algorithm.c_str());
@@ -1435,7 +1678,11 @@ class ThingsBoardSized {
     /// This is done, because the chance of disconnecting the moment when a request event (provisioning, attribute request, client-side rpc) was sent
     /// and then reconnecting and resubscribing to that topic fast enough to still receive the message is not feasible
     inline void Resubscribe_Topics() {
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      if (!m_rpc_callbacks.empty() || !m_rpc_async_callbacks.empty()) {
+#else
       if (!m_rpc_callbacks.empty()) {
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
         m_client.subscribe(RPC_SUBSCRIBE_TOPIC);
       }
       if (!m_shared_attribute_update_callbacks.empty()) {
@@ -1452,6 +1699,9 @@ class ThingsBoardSized {
     inline void reserve_callback_size(const size_t& reservedSize) {
       m_rpc_callbacks.reserve(reservedSize);
       m_rpc_request_callbacks.reserve(reservedSize);
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      m_rpc_async_callbacks.reserve(reservedSize);
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
       m_shared_attribute_update_callbacks.reserve(reservedSize);
       m_attribute_request_callbacks.reserve(reservedSize);
     }
@@ -1488,25 +1738,24 @@ class ThingsBoardSized {
       return m_client.unsubscribe(RPC_RESPONSE_SUBSCRIBE_TOPIC);
     }
 
-    /// @brief Subscribes to attribute response topic
-    /// @param callback Callback method that will be called
-    /// @param registeredCallback Editable pointer to a reference of the local version that was copied from the passed callback
-    /// @return Whether requesting the given callback was successful or not
-    inline bool Attributes_Request_Subscribe(const Attribute_Request_Callback& callback, Attribute_Request_Callback*& registeredCallback = nullptr) {
+    /// @brief Subscribes to attribute response topic and stores the given callbacks under the next free request id
+    /// @param callbacks Callback methods that will be called, with the response to the same request
+    /// @param attributeResponseKeys Key of the key-value pair that will contain the attributes of each callback in the response
+    /// @param count Amount of callbacks
+    /// @return Whether requesting the given callbacks was successful or not, if it was m_request_id contains the request id to send
+    inline bool Attributes_Request_Subscribe(const Attribute_Request_Callback * const *callbacks, const char * const *attributeResponseKeys, const size_t& count) {
+      // Copy given callbacks into the slots of the request id, THINGSBOARD_ENABLE_DYNAMIC adds slots if all of them are taken
+      if (!m_attribute_request_callbacks.insert(callbacks, attributeResponseKeys, count, m_request_id)) {
 #if !THINGSBOARD_ENABLE_DYNAMIC
-      if (m_attribute_request_callbacks.size() + 1 > m_attribute_request_callbacks.capacity()) {
         Logger::log(MAX_SHARED_ATT_REQUEST_EXCEEDED);
+#endif // !THINGSBOARD_ENABLE_DYNAMIC
         return false;
       }
-#endif // !THINGSBOARD_ENABLE_DYNAMIC
       if (!m_client.subscribe(ATTRIBUTE_RESPONSE_SUBSCRIBE_TOPIC)) {
         Logger::log(SUBSCRIBE_TOPIC_FAILED);
+        m_attribute_request_callbacks.remove(m_request_id);
         return false;
       }
-
-      // Push back given callback into our local vector
-      m_attribute_request_callbacks.push_back(callback);
-      registeredCallback = &m_attribute_request_callbacks.back();
       return true;
     }
 
@@ -1546,24 +1795,9 @@ class ThingsBoardSized {
 
     /// @brief Process callback that will be called upon client-side RPC response arrival
     /// and is responsible for handling the payload and calling the appropriate previously subscribed callbacks
-    /// @param topic Previously subscribed topic, we got the response over
+    /// @param response_id Response id captured from the topic we got the response over
     /// @param data Payload sent by the server over our given topic, that contains our key value pairs
-    inline void process_rpc_request_message(char *topic, const JsonObjectConst& data) {
-      // Remove the not needed part of the received topic string, which is everything before the response id,
-      // therefore we remove the section before that which is the topic + an additional "/" character, that seperates the topic from the response id.
-      // Meaning the index we want to get the substring from is the length of the topic + 1 for the additonal "/" character
-      const size_t index = strlen(RPC_RESPONSE_TOPIC) + 1U;
-#if THINGSBOARD_ENABLE_STL
-      std::string response = topic;
-      response = response.substr(index, response.length() - index);
-#else
-      String response = topic;
-      response = response.substring(index);
-#endif // THINGSBOARD_ENABLE_STL
-
-      // Convert the remaining text after the topic to an integer, because it should now contain only the response id
-      const size_t response_id = atoi(response.c_str());
-
+    inline void process_rpc_request_message(const uint32_t& response_id, const JsonObjectConst& data) {
       for (size_t i = 0; i < m_rpc_request_callbacks.size(); i++) {
         const RPC_Request_Callback& rpc_request = m_rpc_request_callbacks.at(i);
 
@@ -1594,11 +1828,26 @@ class ThingsBoardSized {
       }
     }
 
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+
+    /// @brief Publishes the given already serialized response of an asynchronous server-side RPC request
+    /// @param request_id Request id received in the topic of the request
+    /// @param json Serialized response
+    /// @param length Length of the serialized response
+    /// @return Whether publishing the response was successful or not
+    inline bool Send_RPC_Response(const uint32_t& request_id, const char *json, const size_t& length) {
+      char responseTopic[TOPIC_ID_SIZE(sizeof(RPC_RESPONSE_TOPIC) - 1U)];
+      Helper::formatTopic(responseTopic, sizeof(responseTopic), RPC_RESPONSE_TOPIC, request_id);
+      return m_client.publish(responseTopic, reinterpret_cast<const uint8_t*>(json), length);
+    }
+
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
+
     /// @brief Process callback that will be called upon server-side RPC request arrival
     /// and is responsible for handling the payload and calling the appropriate previously subscribed callbacks
-    /// @param topic Previously subscribed topic, we got the response over
+    /// @param request_id Request id captured from the topic we got the request over
     /// @param data Payload sent by the server over our given topic, that contains our key value pairs
-    inline void process_rpc_message(char *topic, const JsonObjectConst& data) {
+    inline void process_rpc_message(const uint32_t& request_id, const JsonObjectConst& data) {
       const char *methodName = data[RPC_METHOD_KEY].as<const char *>();
 
       if (methodName == nullptr) {
@@ -1607,6 +1856,9 @@ class ThingsBoardSized {
       }
  
       RPC_Response response;
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      bool handled = false;
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
 
       for (const RPC_Callback& rpc : m_rpc_callbacks) {
         const char *subscribedMethodName = rpc.Get_Name();
@@ -1635,59 +1887,60 @@ class ThingsBoardSized {
 
         const JsonVariantConst param = data[RPC_PARAMS_KEY].as<JsonVariantConst>();
         response = rpc.Call_Callback<Logger>(param);
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+        handled = true;
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
         break;
       }
 
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+      for (size_t i = 0; !handled && i < m_rpc_async_callbacks.size(); i++) {
+        const RPC_Async_Callback& rpc = m_rpc_async_callbacks[i];
+        const char *subscribedMethodName = rpc.Get_Name();
+        if (subscribedMethodName == nullptr || strncmp(subscribedMethodName, methodName, strlen(subscribedMethodName)) != 0) {
+          continue;
+        }
+
+#if THINGSBOARD_ENABLE_DEBUG
+        char message[JSON_STRING_SIZE(strlen(CALLING_RPC_CB)) + JSON_STRING_SIZE(strlen(methodName))];
+        snprintf_P(message, sizeof(message), CALLING_RPC_CB, methodName);
+        Logger::log(message);
+#endif // THINGSBOARD_ENABLE_DEBUG
+
+        // Only the parameters are copied, the callback is called and the response is sent later, once it is known
+        m_rpc_async.submit(rpc, request_id, data[RPC_PARAMS_KEY].as<JsonVariantConst>());
+        return;
+      }
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
+
       if (response.isNull()) {
         // Message is ignored and not sent at all.
         return;
       }
 
-      // Remove the not needed part of the received topic string, which is everything before the request id,
-      // therefore we remove the section before that which is the topic + an additional "/" character, that seperates the topic from the request id.
-      // Meaning the index we want to get the substring from is the length of the topic + 1 for the additonal "/" character
-      const size_t index = strlen(RPC_REQUEST_TOPIC) + 1U;
-#if THINGSBOARD_ENABLE_STL
-      std::string request = topic;
-      request = request.substr(index, request.length() - index);
-#else
-      String request = topic;
-      request = request.substring(index);
-#endif // THINGSBOARD_ENABLE_STL
-
-      // Convert the remaining text after the topic to an integer, because it should now contain only the request id
-      const size_t request_id = atoi(request.c_str());
+      // Key-value responses are serialized into this fixed size arena on the stack, instead of into a temporary JsonDocument created by the response itself
+      StaticJsonDocument<RPC_Response::ARENA_SIZE> responseArena;
+      const JsonVariantConst responseJson = response.Serialize(responseArena);
+      if (responseJson.isNull()) {
+        Logger::log(UNABLE_TO_SERIALIZE);
+        return;
+      }
 
-      char responseTopic[Helper::detectSize(RPC_SEND_RESPONSE_TOPIC, request_id)];
-      snprintf_P(responseTopic, sizeof(responseTopic), RPC_SEND_RESPONSE_TOPIC, request_id);
+      char responseTopic[TOPIC_ID_SIZE(sizeof(RPC_RESPONSE_TOPIC) - 1U)];
+      Helper::formatTopic(responseTopic, sizeof(responseTopic), RPC_RESPONSE_TOPIC, request_id);
 
-      const size_t jsonSize = Helper::Measure_Json(response);
-      Send_Json(responseTopic, response, jsonSize);
+      const size_t jsonSize = Helper::Measure_Json(responseJson);
+      Send_Json(responseTopic, responseJson, jsonSize);
     }
 
 #if THINGSBOARD_ENABLE_OTA
 
     /// @brief Process callback that will be called upon firmware response arrival
     /// and is responsible for handling the payload and calling the appropriate previously subscribed callback
-    /// @param topic Previously subscribed topic, we got the response over
+    /// @param request_id Chunk index captured from the topic we got the response over
     /// @param payload Payload that was sent over the cloud and received over the given topic
     /// @param length Total length of the received payload
-    inline void process_firmware_response(char *topic, uint8_t *payload, const size_t& length) {
-      // Remove the not needed part of the received topic string, which is everything before the request id,
-      // therefore we remove the section before that which is the topic + an additional "/" character, that seperates the topic from the request id.
-      // Meaning the index we want to get the substring from is the length of the topic + 1 for the additonal "/" character
-      const size_t index = strlen(FIRMWARE_RESPONSE_TOPIC) + 1U;
-#if THINGSBOARD_ENABLE_STL
-      std::string request = topic;
-      request = request.substr(index, request.length() - index);
-#else
-      String request = topic;
-      request = request.substring(index);
-#endif // THINGSBOARD_ENABLE_STL
-
-      // Convert the remaining text after the topic to an integer, because it should now contain only the request id
-      const size_t request_id = atoi(request.c_str());
-
+    inline void process_firmware_response(const uint32_t& request_id, uint8_t *payload, const size_t& length) {
       // Check if the remaining stack size of the current task would overflow the stack,
       // if it would allocate the memory on the heap instead to ensure no stack overflow occurs.
       if (getMaximumStackSize() < length) {
@@ -1724,7 +1977,11 @@ class ThingsBoardSized {
         data = data[SHARED_RESPONSE_KEY];
       }
 
-      for (const Shared_Attribute_Callback& shared_attribute : m_shared_attribute_update_callbacks) {
+      // Look up each received key once, instead of checking every subscribed key of every callback against the payload
+      m_shared_attribute_index.match(data);
+
+      for (size_t i = 0; i < m_shared_attribute_update_callbacks.size(); i++) {
+        const Shared_Attribute_Callback& shared_attribute = m_shared_attribute_update_callbacks[i];
 #if THINGSBOARD_ENABLE_STL
         if (shared_attribute.Get_Attributes().empty()) {
 #else
@@ -1738,51 +1995,11 @@ class ThingsBoardSized {
           continue;
         }
 
-        bool containsKey = false;
-        const char *requested_att = nullptr;
-
-#if THINGSBOARD_ENABLE_STL
-        for (const char *att : shared_attribute.Get_Attributes()) {
-#else
-        String stringToSplit = shared_attribute.Get_Attributes();
-        int32_t previousIndex = 0;
-        int32_t currentIndex = 0;
-
-        do {
-          // Find the index of the next comma in the string
-          currentIndex = stringToSplit.indexOf(COMMA, previousIndex);
-        
-          // If no more commas are found, set the currentIndex to the end of the string
-          if (currentIndex == -1) {
-            currentIndex = stringToSplit.length();
-          }
-
-          // Extract the attribute from the original string
-          const char *att = stringToSplit.substring(previousIndex, currentIndex).c_str();
-#endif // THINGSBOARD_ENABLE_STL
-          if (att == nullptr) {
-#if THINGSBOARD_ENABLE_DEBUG
-            Logger::log(ATT_IS_NULL);
-#endif // THINGSBOARD_ENABLE_DEBUG
-            continue;
-          }
-          // Check if the request contained any of our requested keys.
-          containsKey = containsKey || data.containsKey(att);
-          // Break early if the key was requested from this callback.
-          if (containsKey) {
-            requested_att = att;
-            break;
-          }
-#if THINGSBOARD_ENABLE_STL
-        }
-#else
-          previousIndex = currentIndex + 1;
-        } while (currentIndex != stringToSplit.length());
-#endif // THINGSBOARD_ENABLE_STL
+        const char *requested_att = m_shared_attribute_index.matched_key(i);
 
         // This callback did not request any keys that were in this response,
         // therefore we continue with the next element in the loop.
-        if (!containsKey || requested_att == nullptr) {
+        if (requested_att == nullptr) {
 #if THINGSBOARD_ENABLE_DEBUG
           Logger::log(ATT_NO_CHANGE);
 #endif // THINGSBOARD_ENABLE_DEBUG
@@ -1803,49 +2020,35 @@ class ThingsBoardSized {
 
     /// @brief Process callback that will be called upon client-side or shared attribute request arrival
     /// and is responsible for handling the payload and calling the appropriate previously subscribed callbacks
-    /// @param topic Previously subscribed topic, we got the response over
+    /// @param response_id Response id captured from the topic we got the response over
     /// @param data Payload sent by the server over our given topic, that contains our key value pairs
-    inline void process_attribute_request_message(char *topic, JsonObjectConst& data) {
-      // Remove the not needed part of the received topic string, which is everything before the response id,
-      // therefore we remove the section before that which is the topic + an additional "/" character, that seperates the topic from the response id.
-      // Meaning the index we want to get the substring from is the length of the topic + 1 for the additonal "/" character
-      const size_t index = strlen(ATTRIBUTE_RESPONSE_TOPIC) + 1U;
-#if THINGSBOARD_ENABLE_STL
-      std::string response = topic;
-      response = response.substr(index, response.length() - index);
-#else
-      String response = topic;
-      response = response.substring(index);
-#endif // THINGSBOARD_ENABLE_STL
-
-      // Convert the remaining text after the topic to an integer, because it should now contain only the response id
-      const size_t response_id = atoi(response.c_str());
-
+    inline void process_attribute_request_message(const uint32_t& response_id, JsonObjectConst& data) {
 #if THINGSBOARD_ENABLE_DEBUG
       char message[Helper::detectSize(CALLING_REQUEST_CB, response_id)];
 #endif // THINGSBOARD_ENABLE_DEBUG
-      for (size_t i = 0; i < m_attribute_request_callbacks.size(); i++) {
-        const Attribute_Request_Callback& attribute_request = m_attribute_request_callbacks.at(i);
+      // Remove all callbacks of the request before calling any of them, because the changes have been requested and the callbacks are no longer needed.
+      // Additionally a callback that sends another request from inside of the callback can then reuse the freed slots
+      Attribute_Request_Callback attribute_requests[Attribute_Request_Table<>::MAX_SCOPES];
+      size_t count = 0U;
+      while (count < Attribute_Request_Table<>::MAX_SCOPES && m_attribute_request_callbacks.take(response_id, attribute_requests[count])) {
+        count++;
+      }
 
-        if (attribute_request.Get_Request_ID() != response_id) {
-          continue;
-        }
+      for (size_t i = 0; i < count; i++) {
+        const Attribute_Request_Callback& attribute_request = attribute_requests[i];
         const char *attributeResponseKey = attribute_request.Get_Attribute_Key();
-        if (attributeResponseKey == nullptr) {
+        if (attributeResponseKey == nullptr || !data) {
 #if THINGSBOARD_ENABLE_DEBUG
           Logger::log(ATT_KEY_NOT_FOUND);
 #endif // THINGSBOARD_ENABLE_DEBUG
-          goto delete_callback;
-        }
-        else if (!data) {
-#if THINGSBOARD_ENABLE_DEBUG
-          Logger::log(ATT_KEY_NOT_FOUND);
-#endif // THINGSBOARD_ENABLE_DEBUG
-          goto delete_callback;
+          continue;
         }
 
+        // A request for a single scope receives the complete payload if it does not contain the scope key,
+        // but if multiple scopes were requested the payload contains the attributes of another scope instead
+        JsonObjectConst attributes = count == 1U ? data : JsonObjectConst();
         if (data.containsKey(attributeResponseKey)) {
-          data = data[attributeResponseKey];
+          attributes = data[attributeResponseKey];
         }
 
 #if THINGSBOARD_ENABLE_DEBUG
@@ -1855,12 +2058,7 @@ class ThingsBoardSized {
 
         // Getting non-existing field from JSON should automatically
         // set JSONVariant to null
-        attribute_request.Call_Callback<Logger>(data);
-
-        delete_callback:
-        // Delete callback because the changes have been requested and the callback is no longer needed
-        Helper::remove(m_attribute_request_callbacks, i);
-        break;
+        attribute_request.Call_Callback<Logger>(attributes);
       }
 
       // Unsubscribe from the shared attribute request topic,
@@ -1914,6 +2112,10 @@ class ThingsBoardSized {
 #if THINGSBOARD_ENABLE_STL
     template<typename T>
     using Vector = std::vector<T>;
+#elif !THINGSBOARD_ENABLE_DYNAMIC
+    // Amount of callbacks is limited to MaxFieldsAmt anyway, therefore they are stored inside of the instance itself and never allocate any heap memory
+    template<typename T>
+    using Vector = ::Vector<T, MaxFieldsAmt>;
 #endif // THINGSBOARD_ENABLE_STL
 
     IMQTT_Client& m_client; // MQTT client instance.
@@ -1930,8 +2132,17 @@ class ThingsBoardSized {
     // especially because at most we copy a vector, that will only ever contain a few pointers
     Vector<RPC_Callback> m_rpc_callbacks; // Server side RPC callbacks vector, replacement for non C++ STL boards
     Vector<RPC_Request_Callback> m_rpc_request_callbacks; // Client side RPC callbacks vector, replacement for non C++ STL boards
+#if THINGSBOARD_ENABLE_RPC_ASYNC
+    Vector<RPC_Async_Callback> m_rpc_async_callbacks; // Server side RPC callbacks that are called on the worker task and respond later
+    RPC_Async_Dispatcher<Logger> m_rpc_async; // Worker task and pending requests of the asynchronous server side RPC callbacks
+#endif // THINGSBOARD_ENABLE_RPC_ASYNC
     Vector<Shared_Attribute_Callback> m_shared_attribute_update_callbacks; // Shared attribute update callbacks vector, replacement for non C++ STL boards
-    Vector<Attribute_Request_Callback> m_attribute_request_callbacks; // Client-side or shared attribute request callback vector, replacement for non C++ STL boards
+    Shared_Attribute_Index m_shared_attribute_index; // Subscribed keys of the shared attribute update callbacks, used to find the callbacks interested in a received update
+#if THINGSBOARD_ENABLE_DYNAMIC
+    Attribute_Request_Table<> m_attribute_request_callbacks; // Client-side or shared attribute request callbacks, indexed by their request id
+#else
+    Attribute_Request_Table<MaxFieldsAmt> m_attribute_request_callbacks; // Client-side or shared attribute request callbacks, indexed by their request id
+#endif // THINGSBOARD_ENABLE_DYNAMIC
 
     Provision_Callback m_provision_callback; // Provision response callback
     size_t m_request_id; // Allows nearly 4.3 million requests before wrapping back to 0
@@ -1954,24 +2165,44 @@ class ThingsBoardSized {
       Logger::log(message);
 #endif // THINGSBOARD_ENABLE_DEBUG
 
+      // Matches the topic against the inbound routes and reads the request id contained in the topic,
+      // messages received on topics we do not handle are discarded before deserializing them
+      Inbound_Match route;
+      if (!Match_Inbound_Topic(topic, route)) {
+        return;
+      }
+      // Ids that are not a decimal number or do not fit into 32 bits can not be answered, the response would be sent for a different id
+      for (size_t i = 0; i < route.captures; i++) {
+        if (route.values[i] == TOPIC_CAPTURE_INVALID) {
+          return;
+        }
+      }
+
 #if THINGSBOARD_ENABLE_OTA
       // When receiving the ota binary payload we do not want to deserialize it into json, because it only contains
       // firmware bytes that should be directly writtin into flash, therefore we can skip that step and directly process those bytes
-      if (strncmp_P(FIRMWARE_RESPONSE_TOPIC, topic, strlen(FIRMWARE_RESPONSE_TOPIC)) == 0) {
-        process_firmware_response(topic, payload, length);
+      if (route.route == FIRMWARE_RESPONSE_ROUTE) {
+        process_firmware_response(route.value(0U), payload, length);
         return;
       }
 #endif // THINGSBOARD_ENABLE_OTA
 
-#if THINGSBOARD_ENABLE_DYNAMIC
       // Buffer that we deserialize is writeable and not read only --> zero copy, meaning the size for the data is 0 bytes,
-      // Data structure size depends on the amount of key value pairs received.
+      // Data structure size depends on the amount of values in all objects and arrays received, including nested ones, which is counted in one pass beforehand.
       // See https://arduinojson.org/v6/assistant/ for more information on the needed size for the JsonDocument
-      const size_t dataStructureMemoryUsage = JSON_OBJECT_SIZE(Helper::getOccurences(reinterpret_cast<char*>(payload), COLON));
-      TBJsonDocument jsonBuffer(dataStructureMemoryUsage);
+      const size_t fields = Helper::getJsonFields(reinterpret_cast<const char*>(payload), length);
+#if THINGSBOARD_ENABLE_DYNAMIC
+      TBJsonDocument jsonBuffer(JSON_OBJECT_SIZE(fields));
 #else
+      // Message would not fit, inform the user which size is needed instead of failing with a memory error while deserializing
+      if (fields > MaxFieldsAmt) {
+        char message[Helper::detectSize(TOO_MANY_JSON_FIELDS, fields, MaxFieldsAmt)];
+        snprintf_P(message, sizeof(message), TOO_MANY_JSON_FIELDS, fields, MaxFieldsAmt);
+        Logger::log(message);
+        return;
+      }
       StaticJsonDocument<JSON_OBJECT_SIZE(MaxFieldsAmt)> jsonBuffer;
-#endif // !THINGSBOARD_ENABLE_DYNAMIC
+#endif // THINGSBOARD_ENABLE_DYNAMIC
 
       // The deserializeJson method we use, can use the zero copy mode because a writeable input was passed,
       // if that were not the case the needed allocated memory would drastically increase, because the keys would need to be copied as well.
@@ -1988,26 +2219,25 @@ class ThingsBoardSized {
       // and would result in the data simply being "null", instead .as() allows accessing the data over a JsonObjectConst instead.
       JsonObjectConst data = jsonBuffer.template as<JsonObjectConst>();
 
-      // Checks to ensure we forward the already json serialized data to the correct process function,
-      // especially important is the order of ATTRIBUTE_RESPONSE_TOPIC and ATTRIBUTE_TOPIC,
-      // that is the case because the more specific one that is longer but contains the same text has to be checked first,
-      // because if we do not do that then even if we receive a message from the ATTRIBUTE_RESPONSE_TOPIC
-      // we would call the process method for the ATTRIBUTE_TOPIC because we only compare until the end of the ATTRIBUTE_TOPIC string,
-      // therefore the received topic is exactly the same. Therefore the ordering needs to stay the same for thoose two specific checks
-      if (strncmp_P(RPC_RESPONSE_TOPIC, topic, strlen(RPC_RESPONSE_TOPIC)) == 0) {
-        process_rpc_request_message(topic, data);
-      }
-      else if (strncmp_P(RPC_REQUEST_TOPIC, topic, strlen(RPC_REQUEST_TOPIC)) == 0) {
-        process_rpc_message(topic, data);
-      }
-      else if (strncmp_P(ATTRIBUTE_RESPONSE_TOPIC, topic, strlen(ATTRIBUTE_RESPONSE_TOPIC)) == 0) {
-        process_attribute_request_message(topic, data);
-      }
-      else if (strncmp_P(ATTRIBUTE_TOPIC, topic, strlen(ATTRIBUTE_TOPIC)) == 0) {
-        process_shared_attribute_update_message(topic, data);
-      }
-      else if (strncmp_P(PROV_RESPONSE_TOPIC, topic, strlen(PROV_RESPONSE_TOPIC)) == 0) {
-        process_provisioning_response(topic, data);
+      // Forward the already json serialized data to the process function of the matched route
+      switch (route.route) {
+        case RPC_RESPONSE_ROUTE:
+          process_rpc_request_message(route.value(0U), data);
+          break;
+        case RPC_REQUEST_ROUTE:
+          process_rpc_message(route.value(0U), data);
+          break;
+        case ATTRIBUTE_RESPONSE_ROUTE:
+          process_attribute_request_message(route.value(0U), data);
+          break;
+        case ATTRIBUTE_ROUTE:
+          process_shared_attribute_update_message(topic, data);
+          break;
+        case PROV_RESPONSE_ROUTE:
+          process_provisioning_response(topic, data);
+          break;
+        default:
+          break;
       }
     }
 
@@ -0,0 +1,339 @@
+// Header include.
+#include "Timer_Service.h"
+
+#if THINGSBOARD_ENABLE_OTA || THINGSBOARD_ENABLE_RPC_ASYNC
+
+// Library includes.
+#include <string.h>
+#if THINGSBOARD_USE_ESP_TIMER
+#include <esp_timer.h>
+#else
+#include <Arduino.h>
+#endif // THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_ENABLE_PROGMEM
+#include <pgmspace.h>
+#endif // THINGSBOARD_ENABLE_PROGMEM
+
+#if THINGSBOARD_ENABLE_PROGMEM
+constexpr char TIMER_SERVICE_NAME[] PROGMEM = "timer_service";
+#else
+constexpr char TIMER_SERVICE_NAME[] = "timer_service";
+#endif // THINGSBOARD_ENABLE_PROGMEM
+
+constexpr uint32_t Timer_Service::DEFAULT_RESOLUTION;
+constexpr uint8_t Timer_Service::LEVEL_BITS;
+constexpr size_t Timer_Service::LEVEL_SLOTS;
+constexpr size_t Timer_Service::LEVELS;
+constexpr uint64_t Timer_Service::LEVEL_MASK;
+
+Timer_Service::Timer::Timer(void (*callback)(void *arg), void *arg) :
+    m_callback(callback),
+    m_arg(arg),
+    m_service(nullptr),
+    m_next(nullptr),
+    m_pprev(nullptr),
+    m_expiry(0U)
+{
+    // Nothing to do
+}
+
+Timer_Service::Timer::~Timer() {
+    if (m_service == nullptr) {
+        return;
+    }
+    m_service->cancel(*this);
+    m_service->wait_for_callback(*this);
+}
+
+bool Timer_Service::Timer::is_armed() const {
+    return m_pprev != nullptr;
+}
+
+Timer_Service::Timer_Service(const uint32_t& resolution_microseconds, const bool& use_hardware_timer) :
+    m_resolution(resolution_microseconds > 0U ? resolution_microseconds : 1U),
+    m_use_hardware_timer(use_hardware_timer),
+    m_slots(),
+    m_current(0U),
+    m_now(0U),
+    m_armed(0U),
+    m_running(nullptr),
+    m_hardware_running(false),
+#if THINGSBOARD_USE_ESP_TIMER
+    m_hardware_timer(nullptr)
+#else
+    m_hardware_timer(),
+    m_last_micros(0U),
+    m_micros_high(0U)
+#endif // THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_USE_FREERTOS
+    , m_lock(xSemaphoreCreateMutex())
+    , m_running_task(nullptr)
+#endif // THINGSBOARD_USE_FREERTOS
+{
+    memset(m_slots, 0, sizeof(m_slots));
+}
+
+Timer_Service::~Timer_Service() {
+    lock();
+    for (size_t level = 0U; level < LEVELS; level++) {
+        for (size_t slot = 0U; slot < LEVEL_SLOTS; slot++) {
+            while (m_slots[level][slot] != nullptr) {
+                unlink(*m_slots[level][slot]);
+            }
+        }
+    }
+    stop_hardware_timer();
+    unlock();
+#if THINGSBOARD_USE_ESP_TIMER
+    if (m_hardware_timer != nullptr) {
+        (void)esp_timer_delete(static_cast<esp_timer_handle_t>(m_hardware_timer));
+        m_hardware_timer = nullptr;
+    }
+#endif // THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_USE_FREERTOS
+    vSemaphoreDelete(m_lock);
+#endif // THINGSBOARD_USE_FREERTOS
+}
+
+Timer_Service& Timer_Service::get_default() {
+    static Timer_Service instance;
+    return instance;
+}
+
+void Timer_Service::arm(Timer& timer, const uint64_t& timeout_microseconds) {
+    if (timer.m_service != nullptr && timer.m_service != this) {
+        // Timer is still linked into the wheel of another service, which is guarded by its own lock
+        timer.m_service->cancel(timer);
+    }
+    lock();
+    if (timer.m_pprev != nullptr) {
+        unlink(timer);
+    }
+    const uint64_t now = current_time();
+    if (m_armed == 0U) {
+        // Wheel has not been advanced while no timers were armed, jump directly to the current time instead of processing every empty tick
+        const uint64_t tick = now / m_resolution;
+        m_current = tick > m_current ? tick : m_current;
+    }
+    // Rounded up, so the timer does never expire before its timeout has passed
+    uint64_t expiry = (now + timeout_microseconds + m_resolution - 1U) / m_resolution;
+    if (expiry <= m_current) {
+        expiry = m_current + 1U;
+    }
+    timer.m_expiry = expiry;
+    timer.m_service = this;
+    link(timer);
+    start_hardware_timer();
+    unlock();
+}
+
+bool Timer_Service::cancel(Timer& timer) {
+    lock();
+    const bool armed = timer.m_pprev != nullptr;
+    if (armed) {
+        unlink(timer);
+    }
+    if (m_armed == 0U) {
+        stop_hardware_timer();
+    }
+    unlock();
+    return armed;
+}
+
+void Timer_Service::advance(const uint64_t& now_microseconds) {
+    lock();
+    m_now = now_microseconds;
+    const uint64_t target = now_microseconds / m_resolution;
+    while (m_current < target) {
+        if (m_armed == 0U) {
+            m_current = target;
+            break;
+        }
+        m_current++;
+        // Slots of the finer levels are refilled from the coarser levels, each time all of the slots below them have been passed
+        for (size_t level = 1U; level < LEVELS; level++) {
+            if ((m_current & ((static_cast<uint64_t>(1U) << (level * LEVEL_BITS)) - 1U)) != 0U) {
+                break;
+            }
+            cascade(level);
+        }
+        // Callbacks are called one after another without the lock, because they may arm or cancel other timers or themselves.
+        // Every timer in the current slot of the first level expires on this tick, timers that are linked into it while the lock is given expire later
+        Timer **slot = &m_slots[0U][m_current & LEVEL_MASK];
+        while (*slot != nullptr && (*slot)->m_expiry <= m_current) {
+            Timer *timer = *slot;
+            unlink(*timer);
+            m_running = timer;
+#if THINGSBOARD_USE_FREERTOS
+            m_running_task = xTaskGetCurrentTaskHandle();
+#endif // THINGSBOARD_USE_FREERTOS
+            void (*callback)(void *arg) = timer->m_callback;
+            void *arg = timer->m_arg;
+            unlock();
+            if (callback != nullptr) {
+                callback(arg);
+            }
+            lock();
+            m_running = nullptr;
+        }
+    }
+    if (m_armed == 0U) {
+        stop_hardware_timer();
+    }
+    unlock();
+}
+
+size_t Timer_Service::get_armed() const {
+    return m_armed;
+}
+
+const uint32_t& Timer_Service::get_resolution() const {
+    return m_resolution;
+}
+
+uint64_t Timer_Service::current_time() {
+    if (!m_use_hardware_timer) {
+        return m_now;
+    }
+#if THINGSBOARD_USE_ESP_TIMER
+    return static_cast<uint64_t>(esp_timer_get_time());
+#else
+    // Ticker has no 64 bit clock, micros() overflows after roughly 71 minutes and is therefore extended with the amount of previous overflows
+    const uint32_t micros_now = micros();
+    if (micros_now < m_last_micros) {
+        m_micros_high += static_cast<uint64_t>(1U) << 32U;
+    }
+    m_last_micros = micros_now;
+    return m_micros_high + micros_now;
+#endif // THINGSBOARD_USE_ESP_TIMER
+}
+
+void Timer_Service::link(Timer& timer) {
+    const uint64_t delta = timer.m_expiry - m_current;
+    size_t level = 0U;
+    while (level < LEVELS - 1U && delta >= (static_cast<uint64_t>(1U) << ((level + 1U) * LEVEL_BITS))) {
+        level++;
+    }
+    // Timers further in the future than the last level covers are put into its current slot,
+    // which is moved down again after a full wrap around and therefore before they expire
+    const uint64_t position = delta >> (LEVELS * LEVEL_BITS) == 0U ? timer.m_expiry : m_current;
+    Timer **slot = &m_slots[level][(position >> (level * LEVEL_BITS)) & LEVEL_MASK];
+    timer.m_next = *slot;
+    if (*slot != nullptr) {
+        (*slot)->m_pprev = &timer.m_next;
+    }
+    *slot = &timer;
+    timer.m_pprev = slot;
+    m_armed++;
+}
+
+void Timer_Service::unlink(Timer& timer) {
+    *timer.m_pprev = timer.m_next;
+    if (timer.m_next != nullptr) {
+        timer.m_next->m_pprev = timer.m_pprev;
+    }
+    timer.m_next = nullptr;
+    timer.m_pprev = nullptr;
+    m_armed--;
+}
+
+void Timer_Service::cascade(const size_t& level) {
+    Timer **slot = &m_slots[level][(m_current >> (level * LEVEL_BITS)) & LEVEL_MASK];
+    Timer *timer = *slot;
+    *slot = nullptr;
+    while (timer != nullptr) {
+        Timer *next = timer->m_next;
+        // Slot has been detached as a whole, therefore the timer is linked again without unlinking it first
+        timer->m_pprev = nullptr;
+        m_armed--;
+        link(*timer);
+        timer = next;
+    }
+}
+
+void Timer_Service::wait_for_callback(const Timer& timer) {
+#if THINGSBOARD_USE_FREERTOS
+    // Checked with the lock taken, so everything the callback did happens before the timer is destroyed.
+    // Callback destroying its own timer would wait for itself
+    for (;;) {
+        lock();
+        const bool running = m_running == &timer && m_running_task != xTaskGetCurrentTaskHandle();
+        unlock();
+        if (!running) {
+            break;
+        }
+        vTaskDelay(1U);
+    }
+#else
+    (void)timer;
+#endif // THINGSBOARD_USE_FREERTOS
+}
+
+void Timer_Service::start_hardware_timer() {
+    if (!m_use_hardware_timer || m_hardware_running) {
+        return;
+    }
+#if THINGSBOARD_USE_ESP_TIMER
+    if (m_hardware_timer == nullptr) {
+        const esp_timer_create_args_t periodic_timer_args = {
+            .callback = &hardware_timer_callback,
+            .arg = this,
+            .dispatch_method = esp_timer_dispatch_t::ESP_TIMER_TASK,
+            .name = TIMER_SERVICE_NAME,
+            // Missed ticks are caught up by the next call to advance(), because it processes every tick until the current time
+            .skip_unhandled_events = true
+        };
+
+        // Temporary handle is used, because it allows using a void* as the actual timer,
+        // allowing us to only include the esp_timer header in the defintion (.cpp) file
+        esp_timer_handle_t temp_handle;
+        if (esp_timer_create(&periodic_timer_args, &temp_handle) != ESP_OK) {
+            return;
+        }
+        m_hardware_timer = temp_handle;
+    }
+    m_hardware_running = esp_timer_start_periodic(static_cast<esp_timer_handle_t>(m_hardware_timer), m_resolution) == ESP_OK;
+#else
+    const uint32_t resolution_millis = m_resolution >= 1000U ? m_resolution / 1000U : 1U;
+    m_hardware_timer.attach_ms(resolution_millis, &Timer_Service::hardware_timer_callback, static_cast<void*>(this));
+    m_hardware_running = true;
+#endif // THINGSBOARD_USE_ESP_TIMER
+}
+
+void Timer_Service::stop_hardware_timer() {
+    if (!m_hardware_running) {
+        return;
+    }
+#if THINGSBOARD_USE_ESP_TIMER
+    (void)esp_timer_stop(static_cast<esp_timer_handle_t>(m_hardware_timer));
+#else
+    m_hardware_timer.detach();
+#endif // THINGSBOARD_USE_ESP_TIMER
+    m_hardware_running = false;
+}
+
+void Timer_Service::lock() const {
+#if THINGSBOARD_USE_FREERTOS
+    xSemaphoreTake(m_lock, portMAX_DELAY);
+#endif // THINGSBOARD_USE_FREERTOS
+}
+
+void Timer_Service::unlock() const {
+#if THINGSBOARD_USE_FREERTOS
+    xSemaphoreGive(m_lock);
+#endif // THINGSBOARD_USE_FREERTOS
+}
+
+void Timer_Service::hardware_timer_callback(void *arg) {
+    Timer_Service *instance = static_cast<Timer_Service*>(arg);
+    if (instance == nullptr) {
+        return;
+    }
+
+    instance->lock();
+    const uint64_t now = instance->current_time();
+    instance->unlock();
+    instance->advance(now);
+}
+
+#endif // THINGSBOARD_ENABLE_OTA || THINGSBOARD_ENABLE_RPC_ASYNC
@@ -0,0 +1,169 @@
+#ifndef Timer_Service_h
+#define Timer_Service_h
+
+// Local include.
+#include "Configuration.h"
+
+#if THINGSBOARD_ENABLE_OTA || THINGSBOARD_ENABLE_RPC_ASYNC
+
+// Library includes.
+#include <stddef.h>
+#include <stdint.h>
+#if !THINGSBOARD_USE_ESP_TIMER
+#include <Ticker.h>
+#endif // !THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_USE_FREERTOS
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#endif // THINGSBOARD_USE_FREERTOS
+
+
+/// @brief Multiplexes any amount of cancellable oneshot timeouts over a single periodic hardware timer, using a hierarchical timing wheel.
+/// The wheel consists of 4 levels with 64 slots each, where a slot of the first level covers one tick and a slot of every further level covers all slots of the level below it.
+/// Arming a timer computes its slot from the ticks until it expires and links it into that slot, cancelling unlinks it again, both in constant time and without allocating memory,
+/// because the timers are intrusive list nodes owned by the caller. Once a level wraps around, the timers of the next slot of the level above are moved down into the finer levels.
+/// The hardware timer, either the ESP Timer or the Ticker as a fallback, only runs while at least one timer is armed.
+/// Alternatively the wheel can be driven by calling advance() with an external clock, which allows to simulate the time on the host.
+/// Expired timers are called one after another from the context that advances the wheel, without holding the internal lock,
+/// so their callbacks may arm or cancel timers themselves
+class Timer_Service {
+  public:
+    /// @brief Oneshot timeout, that is armed and cancelled through the Timer_Service. Has to stay valid while it is armed,
+    /// destroying it cancels it and waits for its callback to return if it is currently being called from another task
+    class Timer {
+      public:
+        /// @brief Constructor
+        /// @param callback Callback method that will be called with the given argument once the timer expires
+        /// @param arg Argument passed to the callback method
+        Timer(void (*callback)(void *arg), void *arg);
+
+        /// @brief Destructor
+        ~Timer();
+
+        /// @brief Whether the timer is currently armed and has not expired yet
+        /// @return Whether the timer is armed
+        bool is_armed() const;
+
+      private:
+        friend class Timer_Service;
+
+        Timer(const Timer&) = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        void (*m_callback)(void *arg); // Callback method called once the timer expires
+        void *m_arg;                   // Argument passed to the callback method
+        Timer_Service *m_service;      // Service the timer has last been armed with, nullptr if it was never armed
+        Timer *m_next;                 // Next timer in the same slot
+        Timer **m_pprev;               // Pointer that points to this timer, either the slot itself or the m_next member of the previous timer, nullptr if the timer is not armed
+        uint64_t m_expiry;             // Tick the timer expires at
+    };
+
+    /// @brief Constructor
+    /// @param resolution_microseconds Length of a single tick, timers never expire before their timeout, but on the first tick after it,
+    /// which is only processed by the next call to advance(). With the hardware timer a timer therefore expires up to two ticks late
+    /// @param use_hardware_timer Whether the service starts its own hardware timer while timers are armed,
+    /// or whether the wheel is only advanced with the time passed to advance()
+    Timer_Service(const uint32_t& resolution_microseconds = DEFAULT_RESOLUTION, const bool& use_hardware_timer = true);
+
+    /// @brief Destructor, all timers that are still armed are cancelled without calling their callbacks
+    ~Timer_Service();
+
+    /// @brief Instance shared by all Callback_Watchdog instances, which is driven by the hardware timer. Created on first use,
+    /// because the ESP Timer base is not initalized yet when global objects are constructed
+    /// @return Shared instance
+    static Timer_Service& get_default();
+
+    /// @brief Arms the given timer, if it is already armed its timeout is restarted instead
+    /// @param timer Timer that should be armed
+    /// @param timeout_microseconds Amount of microseconds until the callback of the timer is called, if it is not cancelled before
+    void arm(Timer& timer, const uint64_t& timeout_microseconds);
+
+    /// @brief Cancels the given timer, its callback is not called anymore unless it is already being called
+    /// @param timer Timer that should be cancelled
+    /// @return Whether the timer was armed
+    bool cancel(Timer& timer);
+
+    /// @brief Advances the wheel to the given time and calls the callbacks of all timers that expired until then,
+    /// called by the hardware timer or directly when the service does not use one
+    /// @param now_microseconds Current time, has to increase monotonically
+    void advance(const uint64_t& now_microseconds);
+
+    /// @brief Amount of timers that are currently armed
+    /// @return Amount of armed timers
+    size_t get_armed() const;
+
+    /// @brief Length of a single tick
+    /// @return Resolution in microseconds
+    const uint32_t& get_resolution() const;
+
+  private:
+    static constexpr uint32_t DEFAULT_RESOLUTION = 10000U; // Default length of a single tick in microseconds
+    static constexpr uint8_t LEVEL_BITS = 6U;              // Amount of bits of the tick used to index the slots of a single level
+    static constexpr size_t LEVEL_SLOTS = 1U << LEVEL_BITS; // Amount of slots per level
+    static constexpr size_t LEVELS = 4U;                   // Amount of levels, timers further in the future than all levels cover are moved down on every wrap of the last level
+    static constexpr uint64_t LEVEL_MASK = LEVEL_SLOTS - 1U;
+
+    Timer_Service(const Timer_Service&) = delete;
+    Timer_Service& operator=(const Timer_Service&) = delete;
+
+    const uint32_t m_resolution;       // Length of a single tick in microseconds
+    const bool m_use_hardware_timer;   // Whether the hardware timer advances the wheel
+    Timer *m_slots[LEVELS][LEVEL_SLOTS]; // First timer of each slot of each level
+    uint64_t m_current;                // Last tick that has been processed
+    uint64_t m_now;                    // Time passed to the last call of advance(), used as the clock without hardware timer
+    size_t m_armed;                    // Amount of timers linked into the wheel
+    Timer *m_running;                  // Timer whose callback is currently being called, nullptr if there is none
+    bool m_hardware_running;           // Whether the hardware timer is currently started
+#if THINGSBOARD_USE_ESP_TIMER
+    void *m_hardware_timer;            // ESP Timer handle of the periodic timer, created once it is started for the first time
+#else
+    Ticker m_hardware_timer;           // Ticker instance of the periodic timer
+    uint32_t m_last_micros;            // Last value of micros(), used to extend its 32 bit value to 64 bit
+    uint64_t m_micros_high;            // Upper part of the extended micros() value
+#endif // THINGSBOARD_USE_ESP_TIMER
+#if THINGSBOARD_USE_FREERTOS
+    SemaphoreHandle_t m_lock;          // Guards the wheel, because timers are armed and cancelled from any task
+    TaskHandle_t m_running_task;       // Task that calls the callback of m_running
+#endif // THINGSBOARD_USE_FREERTOS
+
+    /// @brief Current time, either of the clock used by the hardware timer or the time passed to the last call of advance()
+    /// @return Current time in microseconds
+    uint64_t current_time();
+
+    /// @brief Links the given timer into the slot matching the ticks until it expires
+    /// @param timer Timer that should be linked, it must not be linked already
+    void link(Timer& timer);
+
+    /// @brief Unlinks the given timer from its slot
+    /// @param timer Timer that should be unlinked, it has to be linked
+    void unlink(Timer& timer);
+
+    /// @brief Moves all timers of the slot of the given level the current tick points to, into the finer levels
+    /// @param level Level whose slot should be moved
+    void cascade(const size_t& level);
+
+    /// @brief Waits until the callback of the given timer returns, if it is currently being called from another task
+    /// @param timer Timer that is being destroyed
+    void wait_for_callback(const Timer& timer);
+
+    /// @brief Starts the hardware timer, if it has not been started yet and the service uses it
+    void start_hardware_timer();
+
+    /// @brief Stops the hardware timer, if it is running
+    void stop_hardware_timer();
+
+    /// @brief Takes the internal lock, if FreeRTOS is available
+    void lock() const;
+
+    /// @brief Gives the internal lock, if FreeRTOS is available
+    void unlock() const;
+
+    /// @brief Static callback of the periodic hardware timer
+    /// @param arg Instance of the service that started the timer
+    static void hardware_timer_callback(void *arg);
+};
+
+#endif // THINGSBOARD_ENABLE_OTA || THINGSBOARD_ENABLE_RPC_ASYNC
+
+#endif // Timer_Service_h
@@ -0,0 +1,385 @@
+#ifndef Topic_Router_h
+#define Topic_Router_h
+
+// Local includes.
+#include "Configuration.h"
+
+// Library includes.
+#include <stddef.h>
+#include <stdint.h>
+#if THINGSBOARD_ENABLE_PROGMEM
+#include <pgmspace.h>
+#endif // THINGSBOARD_ENABLE_PROGMEM
+
+
+/// @brief Value stored for a single-level wildcard capture, whose topic level was not a decimal number or did not fit into 32 bits
+constexpr uint32_t TOPIC_CAPTURE_INVALID = UINT32_MAX;
+/// @brief Route identifier returned if no route matched the received topic
+constexpr uint8_t TOPIC_NO_ROUTE = UINT8_MAX;
+
+
+/// @brief Entry of a constant routing table, that maps an MQTT topic filter to an identifier.
+/// Expected to be declared as a constexpr array, so the whole table is placed into flash memory
+struct Topic_Route {
+    const char *filter; // MQTT topic filter, may contain the single-level (+) and multi-level (#) wildcard, has to stay valid for the lifetime of the router
+    uint8_t id; // Identifier returned when a received topic matches the filter
+};
+
+
+/// @brief Result of matching a received topic against the routing table.
+/// Contains the identifier of the matched route and the decimal values of the topic levels matched by a single-level (+) wildcard,
+/// meaning request ids can be read directly from the topic without any intermediate string copies
+/// @tparam MaxCaptures Maximum amount of single-level wildcard values that are stored, additional wildcards still match but their value is discarded
+template<size_t MaxCaptures>
+struct Topic_Match {
+    uint8_t route; // Identifier of the matched route or TOPIC_NO_ROUTE
+    uint8_t captures; // Amount of values that have been written into values
+    uint32_t values[MaxCaptures]; // Values of the single-level wildcard levels, TOPIC_CAPTURE_INVALID if the level was not a decimal number
+
+    /// @brief Returns the value of the single-level wildcard capture with the given index
+    /// @param index Index of the single-level wildcard in the topic filter, counted from the left
+    /// @return Captured value or TOPIC_CAPTURE_INVALID if the capture does not exist
+    inline uint32_t value(const size_t& index) const {
+        return index < captures ? values[index] : TOPIC_CAPTURE_INVALID;
+    }
+};
+
+
+/// @brief Trie of MQTT topic filters, where each node represents one topic level.
+/// The trie is built once from a constant routing table into a fixed size node array, meaning no heap memory is ever allocated,
+/// and a received topic is matched in a single pass over its characters, instead of comparing it against every filter one after another.
+/// Literal levels take precedence over the single-level wildcard (+), which takes precedence over the multi-level wildcard (#),
+/// the multi-level wildcard also matches the parent level itself, as defined in the MQTT specification
+/// @tparam MaxNodes Maximum amount of topic levels over all added filters, levels that are shared between filters are only stored once
+/// @tparam MaxCaptures Maximum amount of single-level wildcard values stored in the match result
+template<size_t MaxNodes, size_t MaxCaptures = 2U>
+class Topic_Router {
+  static_assert(MaxNodes < UINT8_MAX, "Topic_Router node indices are stored as uint8_t");
+
+  public:
+    using Match = Topic_Match<MaxCaptures>;
+
+    /// @brief Constructs an empty router
+    inline Topic_Router() :
+        m_nodes(),
+        m_count(1U)
+    {
+        m_nodes[ROOT_NODE] = Node();
+    }
+
+    /// @brief Constructs a router containing all filters of the given routing table
+    /// @tparam RouteCount Amount of entries in the routing table
+    /// @param routes Constant routing table that should be added to the trie
+    template<size_t RouteCount>
+    inline Topic_Router(const Topic_Route (&routes)[RouteCount]) :
+        Topic_Router()
+    {
+        for (const Topic_Route& route : routes) {
+            add(route.filter, route.id);
+        }
+    }
+
+    /// @brief Adds the given topic filter to the trie
+    /// @param filter MQTT topic filter, has to stay valid for the lifetime of the router, because the levels are not copied
+    /// @param id Identifier returned if a received topic matches the given filter
+    /// @return Whether the filter was added, fails if the trie is full, a level is longer than 255 characters or the multi-level wildcard is not the last level
+    inline bool add(const char *filter, const uint8_t& id) {
+        if (filter == nullptr || id == TOPIC_NO_ROUTE) {
+            return false;
+        }
+        uint8_t current = ROOT_NODE;
+        const char *level = filter;
+
+        while (true) {
+            const char *end = level;
+            while (read_char(end) != '\0' && read_char(end) != LEVEL_SEPARATOR) {
+                end++;
+            }
+            if (static_cast<size_t>(end - level) > UINT8_MAX) {
+                return false;
+            }
+            const uint8_t length = end - level;
+            const Node_Kind kind = classify(level, length);
+            if (kind == Node_Kind::MULTI_LEVEL && read_char(end) != '\0') {
+                return false;
+            }
+
+            const uint8_t child = find_or_insert_child(current, level, length, kind);
+            if (child == NO_NODE) {
+                return false;
+            }
+            current = child;
+
+            if (read_char(end) == '\0') {
+                break;
+            }
+            level = end + 1U;
+        }
+
+        m_nodes[current].route = id;
+        return true;
+    }
+
+    /// @brief Matches the given received topic against all added filters
+    /// @param topic Received topic, must not contain any wildcards
+    /// @param result Result that will contain the route identifier and all single-level wildcard values
+    /// @return Whether any route matched the given topic
+    inline bool match(const char *topic, Match& result) const {
+        result.route = TOPIC_NO_ROUTE;
+        result.captures = 0U;
+        if (topic == nullptr) {
+            return false;
+        }
+        return match_level(ROOT_NODE, topic, result, First_Match());
+    }
+
+    /// @brief Matches the given received topic against all added filters and calls the given callback for every filter that matches,
+    /// instead of only for the one with the highest precedence. Filters are visited in the same precedence order match() uses
+    /// @tparam Callback Callable with the signature void(const Match& match), the match contains the route and the single-level wildcard values of that filter
+    /// @param topic Received topic, must not contain any wildcards
+    /// @param callback Called once for every matching filter
+    /// @return Amount of filters that matched the given topic
+    template<typename Callback>
+    inline size_t match_all(const char *topic, Callback callback) const {
+        if (topic == nullptr) {
+            return 0U;
+        }
+        Match result;
+        result.route = TOPIC_NO_ROUTE;
+        result.captures = 0U;
+        const Every_Match<Callback> every(callback);
+        match_level(ROOT_NODE, topic, result, every);
+        return every.count;
+    }
+
+    /// @brief Matches the given received topic against all added filters
+    /// @param topic Received topic, must not contain any wildcards
+    /// @return Identifier of the matched route or TOPIC_NO_ROUTE
+    inline uint8_t route(const char *topic) const {
+        Match result;
+        match(topic, result);
+        return result.route;
+    }
+
+    /// @brief Amount of nodes currently used by the trie, including the root node
+    /// @return Amount of used nodes
+    inline size_t size() const {
+        return m_count;
+    }
+
+  private:
+    static constexpr char LEVEL_SEPARATOR = '/';
+    static constexpr char SINGLE_LEVEL_WILDCARD = '+';
+    static constexpr char MULTI_LEVEL_WILDCARD = '#';
+    static constexpr uint8_t ROOT_NODE = 0U;
+    static constexpr uint8_t NO_NODE = UINT8_MAX;
+
+    /// @brief Kind of topic level, the order of the values is the order the children of a node are compared in
+    enum class Node_Kind : uint8_t {
+        LITERAL,
+        SINGLE_LEVEL,
+        MULTI_LEVEL
+    };
+
+    /// @brief Stops matching at the first filter that matched the received topic
+    struct First_Match {
+        inline bool operator()(const Match& match) const {
+            (void)match;
+            return true;
+        }
+    };
+
+    /// @brief Passes every filter that matched the received topic to the given callback and continues matching
+    template<typename Callback>
+    struct Every_Match {
+        explicit Every_Match(Callback& callback) : callback(callback), count(0U) {}
+
+        inline bool operator()(const Match& match) const {
+            callback(match);
+            count++;
+            return false;
+        }
+
+        Callback& callback;
+        mutable size_t count;
+    };
+
+    /// @brief Topic level of a filter, siblings are stored as a singly linked list sorted by their kind
+    struct Node {
+        const char *level = nullptr; // Start of the level inside of the filter, not null terminated
+        uint8_t length = 0U; // Length of the level in characters
+        Node_Kind kind = Node_Kind::LITERAL; // Kind of level
+        uint8_t route = TOPIC_NO_ROUTE; // Identifier of the filter ending at this level
+        uint8_t child = NO_NODE; // Index of the first child level
+        uint8_t sibling = NO_NODE; // Index of the next level with the same parent
+    };
+
+    /// @brief Reads the character at the given position, which might be placed in flash memory
+    /// @param position Pointer to the character that should be read
+    /// @return Character at the given position
+    static inline char read_char(const char *position) {
+#if THINGSBOARD_ENABLE_PROGMEM
+        return static_cast<char>(pgm_read_byte(position));
+#else
+        return *position;
+#endif // THINGSBOARD_ENABLE_PROGMEM
+    }
+
+    /// @brief Decides which kind of topic level the given filter level is
+    /// @param level Start of the level
+    /// @param length Length of the level
+    /// @return Kind of topic level
+    static inline Node_Kind classify(const char *level, const uint8_t& length) {
+        if (length == 1U && read_char(level) == SINGLE_LEVEL_WILDCARD) {
+            return Node_Kind::SINGLE_LEVEL;
+        }
+        else if (length == 1U && read_char(level) == MULTI_LEVEL_WILDCARD) {
+            return Node_Kind::MULTI_LEVEL;
+        }
+        return Node_Kind::LITERAL;
+    }
+
+    /// @brief Compares the given literal filter level with the given received topic level
+    /// @param node Literal filter level
+    /// @param level Start of the received topic level
+    /// @param length Length of the received topic level
+    /// @return Whether both levels are equal
+    static inline bool equals(const Node& node, const char *level, const size_t& length) {
+        if (node.length != length) {
+            return false;
+        }
+        for (size_t i = 0; i < length; i++) {
+            if (read_char(node.level + i) != level[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Searches the children of the given parent for the given level and inserts it, if it does not exist yet
+    /// @param parent Index of the parent node
+    /// @param level Start of the filter level
+    /// @param length Length of the filter level
+    /// @param kind Kind of the filter level
+    /// @return Index of the found or inserted node or NO_NODE if the trie is full
+    inline uint8_t find_or_insert_child(const uint8_t parent, const char *level, const uint8_t& length, const Node_Kind& kind) {
+        uint8_t previous = NO_NODE;
+        uint8_t current = m_nodes[parent].child;
+
+        while (current != NO_NODE && m_nodes[current].kind <= kind) {
+            const Node& node = m_nodes[current];
+            if (node.kind == kind && (kind != Node_Kind::LITERAL || node.length == length)) {
+                bool same = true;
+                for (uint8_t i = 0; kind == Node_Kind::LITERAL && i < length && same; i++) {
+                    same = read_char(node.level + i) == read_char(level + i);
+                }
+                if (same) {
+                    return current;
+                }
+            }
+            previous = current;
+            current = node.sibling;
+        }
+
+        if (m_count >= MaxNodes) {
+            return NO_NODE;
+        }
+        const uint8_t inserted = m_count++;
+        Node& node = m_nodes[inserted];
+        node = Node();
+        node.level = level;
+        node.length = length;
+        node.kind = kind;
+        node.sibling = current;
+        if (previous == NO_NODE) {
+            m_nodes[parent].child = inserted;
+        }
+        else {
+            m_nodes[previous].sibling = inserted;
+        }
+        return inserted;
+    }
+
+    /// @brief Matches the received topic, starting at the given level, against the children of the given node.
+    /// Only recurses deeper if a level matched, meaning backtracking only happens if a literal and a wildcard level both match the same topic level
+    /// @tparam On_Match First_Match or Every_Match
+    /// @param parent Index of the node whose children should be compared
+    /// @param level Start of the current received topic level
+    /// @param result Result that will contain the route identifier and all single-level wildcard values
+    /// @param on_match Called with every matching filter, returns whether matching should stop
+    /// @return Whether matching was stopped by on_match
+    template<typename On_Match>
+    inline bool match_level(const uint8_t parent, const char *level, Match& result, const On_Match& on_match) const {
+        const char *end = level;
+        uint32_t number = 0U;
+        bool numeric = *end != '\0' && *end != LEVEL_SEPARATOR;
+        while (*end != '\0' && *end != LEVEL_SEPARATOR) {
+            const uint32_t digit = static_cast<uint32_t>(*end - '0');
+            // Values that do not fit into 32 bits are not numbers either, instead of silently wrapping around
+            numeric = numeric && *end >= '0' && *end <= '9' && number <= (UINT32_MAX - digit) / 10U;
+            number = number * 10U + digit;
+            end++;
+        }
+        const size_t length = end - level;
+        const bool last = *end == '\0';
+
+        for (uint8_t current = m_nodes[parent].child; current != NO_NODE; current = m_nodes[current].sibling) {
+            const Node& node = m_nodes[current];
+
+            if (node.kind == Node_Kind::MULTI_LEVEL) {
+                if (report(node.route, result, on_match)) {
+                    return true;
+                }
+                continue;
+            }
+            else if (node.kind == Node_Kind::LITERAL && !equals(node, level, length)) {
+                continue;
+            }
+
+            const uint8_t captures = result.captures;
+            if (node.kind == Node_Kind::SINGLE_LEVEL && result.captures < MaxCaptures) {
+                result.values[result.captures++] = numeric ? number : TOPIC_CAPTURE_INVALID;
+            }
+
+            if (last) {
+                if (node.route != TOPIC_NO_ROUTE && report(node.route, result, on_match)) {
+                    return true;
+                }
+                // The multi-level wildcard also matches its parent level, therefore "a/#" matches "a" as well
+                const uint8_t child = m_nodes[current].child;
+                for (uint8_t wildcard = child; wildcard != NO_NODE; wildcard = m_nodes[wildcard].sibling) {
+                    if (m_nodes[wildcard].kind == Node_Kind::MULTI_LEVEL && report(m_nodes[wildcard].route, result, on_match)) {
+                        return true;
+                    }
+                }
+            }
+            else if (match_level(current, end + 1U, result, on_match)) {
+                return true;
+            }
+            // Revert the captured values of the failed branch
+            result.captures = captures;
+        }
+        return false;
+    }
+
+    /// @brief Stores the given route in the result and passes it to the given callback
+    /// @tparam On_Match First_Match or Every_Match
+    /// @param route Identifier of the matched filter
+    /// @param result Result that will contain the route identifier
+    /// @param on_match Called with the result
+    /// @return Whether matching should stop
+    template<typename On_Match>
+    static inline bool report(const uint8_t& route, Match& result, const On_Match& on_match) {
+        result.route = route;
+        if (on_match(result)) {
+            return true;
+        }
+        result.route = TOPIC_NO_ROUTE;
+        return false;
+    }
+
+    Node m_nodes[MaxNodes]; // Fixed size storage for all topic levels, the first node is the root and does not represent a level itself
+    uint8_t m_count; // Amount of nodes currently in use
+};
+
+#endif // Topic_Router_h
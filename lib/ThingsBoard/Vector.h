@@ -8,26 +8,108 @@
 
 // Library includes.
 #include <assert.h>
+#include <stddef.h>
+#include <new>
 
 
+/// @brief Growth policy that doubles the capacity of the Vector each time it is full, results in amortized constant time insertion at the cost of up to half of the allocated memory being unused
+struct Vector_Double_Growth {
+    /// @brief Calculates the capacity the data container should grow to
+    /// @param capacity Current capacity of the data container
+    /// @param required Minimum capacity that is required to hold all elements
+    /// @return Capacity the data container should grow to, at least the required capacity
+    static inline size_t next_capacity(const size_t& capacity, const size_t& required) {
+        const size_t doubled = (capacity == 0U) ? 1U : 2U * capacity;
+        return doubled < required ? required : doubled;
+    }
+};
+
+/// @brief Growth policy that only grows the capacity of the Vector to the required capacity, results in no unused memory at the cost of moving all elements on every insertion,
+/// should only be used if the amount of elements is known beforehand and reserved or if the elements are rarely inserted
+struct Vector_Exact_Growth {
+    /// @brief Calculates the capacity the data container should grow to
+    /// @param capacity Current capacity of the data container
+    /// @param required Minimum capacity that is required to hold all elements
+    /// @return Capacity the data container should grow to, always the required capacity
+    static inline size_t next_capacity(const size_t& capacity, const size_t& required) {
+        (void)capacity;
+        return required;
+    }
+};
+
 /// @brief Replacement data container for boards that do not support the C++ STL.
+/// Stores up to InlineCapacity elements directly inside of the instance itself and only allocates memory on the heap once more elements are inserted.
+/// Elements are constructed and destroyed the same way as with std::vector, meaning elements with non trivial members, like callbacks holding a std::function, are moved instead of copied bytewise
 /// @tparam T Type of the underlying data the list should point too.
-template <typename T>
+/// @tparam InlineCapacity Amount of elements stored inside of the instance itself without any heap allocation, default = 0
+/// @tparam Growth Policy that calculates the new capacity once the data container is full, default = Vector_Double_Growth
+template <typename T, size_t InlineCapacity = 0U, typename Growth = Vector_Double_Growth>
 class Vector {
   public:
     /// @brief Constructor
     inline Vector(void) :
-        m_elements(nullptr),
-        m_capacity(0U),
+        m_elements(inline_elements()),
+        m_capacity(InlineCapacity),
         m_size(0U)
     {
         // Nothing to do
     }
 
+    /// @brief Copy constructor, copies all elements of the given data container
+    /// @param other Data container that should be copied
+    inline Vector(const Vector& other) :
+        m_elements(inline_elements()),
+        m_capacity(InlineCapacity),
+        m_size(0U)
+    {
+        reserve(other.m_size);
+        for (size_t i = 0U; i < other.m_size; i++) {
+            new (m_elements + i) T(other.m_elements[i]);
+        }
+        m_size = other.m_size;
+    }
+
+    /// @brief Move constructor, takes over the heap memory of the given data container or moves its elements if they are stored inline
+    /// @param other Data container that should be moved, is empty afterwards
+    inline Vector(Vector&& other) :
+        m_elements(inline_elements()),
+        m_capacity(InlineCapacity),
+        m_size(0U)
+    {
+        take(other);
+    }
+
     /// @brief Destructor
     inline ~Vector() {
-        delete[] m_elements;
-        m_elements = nullptr;
+        clear();
+        deallocate();
+    }
+
+    /// @brief Copy assignment operator, replaces all elements with copies of the elements of the given data container
+    /// @param other Data container that should be copied
+    /// @return Reference to this data container
+    inline Vector& operator=(const Vector& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.m_size);
+            for (size_t i = 0U; i < other.m_size; i++) {
+                new (m_elements + i) T(other.m_elements[i]);
+            }
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator, replaces all elements with the elements of the given data container
+    /// @param other Data container that should be moved, is empty afterwards
+    /// @return Reference to this data container
+    inline Vector& operator=(Vector&& other) {
+        if (this != &other) {
+            clear();
+            deallocate();
+            take(other);
+        }
+        return *this;
     }
 
     /// @brief Returns whether there are still any element in the underlying data container
@@ -47,13 +129,38 @@ class Vector {
     inline const size_t& capacity() const {
         return m_capacity;
     }
-    
+
+    /// @brief Returns a pointer to the underlying memory of the vector
+    /// @return Pointer to the underlying memory of the vector
+    inline T* data() {
+        return m_elements;
+    }
+
+    /// @brief Returns a constant pointer to the underlying memory of the vector
+    /// @return Constant pointer to the underlying memory of the vector
+    inline const T* data() const {
+        return m_elements;
+    }
+
     /// @brief Returns a pointer to the first element of the vector
     /// @return Pointer to the first element of the vector
     inline T* begin() {
         return m_elements;
     }
 
+    /// @brief Returns a constant pointer to the first element of the vector
+    /// @return Constant pointer to the first element of the vector
+    inline const T* begin() const {
+        return m_elements;
+    }
+
+    /// @brief Returns the first element of the vector
+    /// @return Reference to the first element of the vector
+    inline T& front() {
+        assert(m_size != 0U);
+        return m_elements[0U];
+    }
+
     /// @brief Returns the last element of the vector
     /// @return Reference to the last element of the vector
     inline T& back() {
@@ -67,6 +174,12 @@ class Vector {
         return m_elements + m_size;
     }
 
+    /// @brief Returns a constant pointer to one-past-the-end element of the vector
+    /// @return Constant pointer to one-past-the-end element of the vector
+    inline const T* end() const {
+        return m_elements + m_size;
+    }
+
     /// @brief Returns a constant pointer to the first element of the vector
     /// @return Constant pointer to the first element of the vector
     inline const T* cbegin() const {
@@ -79,46 +192,79 @@ class Vector {
         return m_elements + m_size;
     }
 
-    /// @brief Reserves the given capacity for the underlying data container
+    /// @brief Reserves the given capacity for the underlying data container,
+    /// moves the already inserted elements into the newly allocated memory if the current capacity is too small
     /// @param capacity Capacity that should be reserved in the underlying data container
     inline void reserve(const size_t& capacity) {
         if (capacity > m_capacity) {
-            T* newElements = new T[m_capacity];
-            if (m_elements != nullptr) {
-                memcpy(newElements, m_elements, m_size * sizeof(T));
-                delete[] m_elements;
-            }
-            m_elements = newElements;
+            reallocate(capacity);
         }
     }
 
-    /// @brief Inserts the given element at the end of the underlying data container
+    /// @brief Inserts a copy of the given element at the end of the underlying data container
     /// @param element Element that should be inserted at the end
     inline void push_back(const T& element) {
         if (m_size == m_capacity) {
-            m_capacity = (m_capacity == 0) ? 1 : 2 * m_capacity;
-            T* newElements = new T[m_capacity];
-            if (m_elements != nullptr) {
-                memcpy(newElements, m_elements, m_size * sizeof(T));
-                delete[] m_elements;
-            }
-            m_elements = newElements;
+            // Element might be part of this data container, therefore it is copied before the memory it is stored in is released
+            T copy(element);
+            grow();
+            new (m_elements + m_size) T(static_cast<T&&>(copy));
+        }
+        else {
+            new (m_elements + m_size) T(element);
+        }
+        m_size++;
+    }
+
+    /// @brief Moves the given element to the end of the underlying data container
+    /// @param element Element that should be moved to the end
+    inline void push_back(T&& element) {
+        if (m_size == m_capacity) {
+            T moved(static_cast<T&&>(element));
+            grow();
+            new (m_elements + m_size) T(static_cast<T&&>(moved));
+        }
+        else {
+            new (m_elements + m_size) T(static_cast<T&&>(element));
         }
-        m_elements[m_size] = element;
         m_size++;
     }
 
+    /// @brief Constructs a new element at the end of the underlying data container from the given arguments
+    /// @tparam Args Types of the arguments passed to the constructor of the element
+    /// @param args Arguments passed to the constructor of the element
+    /// @return Reference to the newly constructed element
+    template <typename... Args>
+    inline T& emplace_back(Args&&... args) {
+        if (m_size == m_capacity) {
+            T constructed(static_cast<Args&&>(args)...);
+            grow();
+            new (m_elements + m_size) T(static_cast<T&&>(constructed));
+        }
+        else {
+            new (m_elements + m_size) T(static_cast<Args&&>(args)...);
+        }
+        return m_elements[m_size++];
+    }
+
+    /// @brief Removes the last element of the underlying data container
+    inline void pop_back() {
+        assert(m_size != 0U);
+        m_size--;
+        m_elements[m_size].~T();
+    }
+
     /// @brief Removes the element at the given index, has to move all element one to the left if the index is not at the end of the array
     /// @param index Index the element should be removed at from the underlying data container
     inline void erase(const size_t& index) {
         // Check if the given index is bigger or equal than the actual amount of elements if it is we can not erase that element because it does not exist
         if (index < m_size) {
             // Move all elements after the index one position to the left
-            for (size_t i = index; i < m_size - 1; i++) {
-                m_elements[i] = m_elements[i + 1];
+            for (size_t i = index; i < m_size - 1U; i++) {
+                m_elements[i] = static_cast<T&&>(m_elements[i + 1U]);
             }
-            // Decrease the size of the vector to remove the last element, because either it was moved one index to the left or was the element we wanted to delete
-            m_size--;
+            // Destroy the last element, because either it was moved one index to the left or was the element we wanted to delete
+            pop_back();
         }
     }
 
@@ -143,17 +289,84 @@ class Vector {
     }
 
     /// @brief Clears the given underlying data container.
-    /// Simply sets the underlying size to 0, data will only be cleared in the destructor
+    /// Destroys all elements, but keeps the allocated capacity so inserting the same amount of elements again does not allocate
     inline void clear() {
-        m_size = 0;
+        while (m_size > 0U) {
+            pop_back();
+        }
     }
 
   private:
-    T* m_elements;      // Pointer to the start of our elements
+    // Inline storage has at least one element, because zero sized arrays are not allowed
+    static constexpr size_t INLINE_STORAGE = InlineCapacity > 0U ? InlineCapacity : 1U;
+
+    /// @brief Returns the inline storage of the vector, which is used as long as the elements fit into it
+    /// @return Pointer to the first element of the inline storage
+    inline T* inline_elements() {
+        return reinterpret_cast<T*>(m_inline);
+    }
+
+    /// @brief Whether the elements are currently stored in memory allocated on the heap
+    /// @return Whether the elements are stored on the heap
+    inline bool is_allocated() const {
+        return m_elements != reinterpret_cast<const T*>(m_inline);
+    }
+
+    /// @brief Grows the capacity according to the growth policy, so that at least one more element fits
+    inline void grow() {
+        reallocate(Growth::next_capacity(m_capacity, m_size + 1U));
+    }
+
+    /// @brief Allocates memory for the given amount of elements on the heap and moves all elements into it
+    /// @param capacity Amount of elements the new memory should be able to hold, has to be bigger than the current size
+    inline void reallocate(const size_t& capacity) {
+        T* newElements = static_cast<T*>(::operator new(capacity * sizeof(T)));
+        for (size_t i = 0U; i < m_size; i++) {
+            new (newElements + i) T(static_cast<T&&>(m_elements[i]));
+            m_elements[i].~T();
+        }
+        deallocate();
+        m_elements = newElements;
+        m_capacity = capacity;
+    }
+
+    /// @brief Releases the heap memory if there is any and switches back to the inline storage, expects all elements to be destroyed already
+    inline void deallocate() {
+        if (is_allocated()) {
+            ::operator delete(m_elements);
+        }
+        m_elements = inline_elements();
+        m_capacity = InlineCapacity;
+    }
+
+    /// @brief Takes over the elements of the given data container, expects this data container to be empty and to use its inline storage
+    /// @param other Data container whose elements should be taken over, is empty afterwards
+    inline void take(Vector& other) {
+        if (other.is_allocated()) {
+            m_elements = other.m_elements;
+            m_capacity = other.m_capacity;
+            m_size = other.m_size;
+            other.m_elements = other.inline_elements();
+            other.m_capacity = InlineCapacity;
+            other.m_size = 0U;
+            return;
+        }
+        for (size_t i = 0U; i < other.m_size; i++) {
+            new (m_elements + i) T(static_cast<T&&>(other.m_elements[i]));
+        }
+        m_size = other.m_size;
+        other.clear();
+    }
+
+    alignas(T) unsigned char m_inline[INLINE_STORAGE * sizeof(T)]; // Uninitialized memory the first InlineCapacity elements are stored in
+    T* m_elements;      // Pointer to the start of our elements, either the inline storage or memory allocated on the heap
     size_t m_capacity;  // Allocated capacity that shows how many elements we could hold
     size_t m_size;      // Used size that shows how many elements we entered
 };
 
+template <typename T, size_t InlineCapacity, typename Growth>
+constexpr size_t Vector<T, InlineCapacity, Growth>::INLINE_STORAGE;
+
 #endif // !THINGSBOARD_ENABLE_STL
 
 #endif // Vector_h
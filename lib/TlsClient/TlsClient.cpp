@@ -0,0 +1,457 @@
+#include "TlsClient.hpp"
+
+#include <mbedtls/error.h>
+#include <mbedtls/md.h>
+#include <mbedtls/net_sockets.h>
+
+// MBEDTLS Version 3 hides the internal structures behind the MBEDTLS_PRIVATE macro
+#ifndef MBEDTLS_PRIVATE
+#define MBEDTLS_PRIVATE(member) member
+#endif
+
+// ---------------------------------------------------------------------------
+// TlsClient
+// ---------------------------------------------------------------------------
+
+TlsClient::TlsClient(Client& transport) : transport(transport) {
+    sessionCache = nullptr;
+    contextReady = false;
+    drbgSeeded = false;
+    caLoaded = false;
+    insecure = false;
+    fingerprintSet = false;
+    established = false;
+    peeked = -1;
+    handshakeTimeoutMs = TLS_HANDSHAKE_TIMEOUT_MS;
+    ioSent = 0;
+    ioReceived = 0;
+    memset(fingerprint, 0, sizeof(fingerprint));
+    memset(&stats, 0, sizeof(stats));
+
+    mbedtls_ssl_init(&ssl);
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_entropy_init(&entropy);
+    mbedtls_ctr_drbg_init(&drbg);
+    mbedtls_x509_crt_init(&caCert);
+}
+
+TlsClient::~TlsClient() {
+    stop();
+    mbedtls_ssl_free(&ssl);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_ctr_drbg_free(&drbg);
+    mbedtls_entropy_free(&entropy);
+    mbedtls_x509_crt_free(&caCert);
+}
+
+bool TlsClient::setCACert(const char* rootCaPem) {
+    mbedtls_x509_crt_free(&caCert);
+    mbedtls_x509_crt_init(&caCert);
+    caLoaded = false;
+
+    // PEM parsing requires the terminating NUL to be part of the length
+    int ret = mbedtls_x509_crt_parse(&caCert, reinterpret_cast<const unsigned char*>(rootCaPem), strlen(rootCaPem) + 1);
+    if (ret != 0) {
+        logError("CA parse", ret);
+        return false;
+    }
+    caLoaded = true;
+    contextReady = false; // Trust anchors changed, rebuild the configuration
+    return true;
+}
+
+void TlsClient::setFingerprint(const uint8_t sha256[32]) {
+    memcpy(fingerprint, sha256, sizeof(fingerprint));
+    fingerprintSet = true;
+    contextReady = false;
+}
+
+void TlsClient::setInsecure() {
+    insecure = true;
+    contextReady = false;
+}
+
+void TlsClient::setSessionCache(TlsSessionCache* cache) {
+    sessionCache = cache;
+}
+
+void TlsClient::setHandshakeTimeout(uint32_t timeoutMs) {
+    handshakeTimeoutMs = timeoutMs;
+}
+
+const TlsHandshakeStats& TlsClient::getStats() const {
+    return stats;
+}
+
+void TlsClient::logError(const char* what, int ret) {
+    char message[96];
+    mbedtls_strerror(ret, message, sizeof(message));
+    Serial.printf("[TLS] %s failed: -0x%04X %s\n", what, -ret, message);
+}
+
+bool TlsClient::setupContext() {
+    if (contextReady) {
+        // Configuration, DRBG and parsed CA are reused, only the per-connection state is reset
+        return mbedtls_ssl_session_reset(&ssl) == 0;
+    }
+
+    if (!fingerprintSet && !caLoaded && !insecure) {
+        Serial.println("[TLS] No trust anchor configured (setCACert/setFingerprint/setInsecure)");
+        return false;
+    }
+
+    mbedtls_ssl_free(&ssl);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_ssl_init(&ssl);
+    mbedtls_ssl_config_init(&conf);
+
+    // Seeded only once, the DRBG reseeds itself from the entropy source and
+    // seeding a seeded context again re-initializes its mutex without freeing it
+    int ret;
+    if (!drbgSeeded) {
+        static const char personalization[] = "TlsClient";
+        ret = mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy,
+                                    reinterpret_cast<const unsigned char*>(personalization), sizeof(personalization) - 1);
+        if (ret != 0) {
+            logError("DRBG seed", ret);
+            return false;
+        }
+        drbgSeeded = true;
+    }
+
+    ret = mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+    if (ret != 0) {
+        logError("SSL config", ret);
+        return false;
+    }
+
+    if (fingerprintSet) {
+        // The leaf certificate is compared against the pin after the handshake,
+        // which is much cheaper than verifying the chain signatures
+        mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
+    } else if (caLoaded) {
+        mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_ca_chain(&conf, &caCert, nullptr);
+    } else {
+        mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_NONE);
+    }
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    ret = mbedtls_ssl_setup(&ssl, &conf);
+    if (ret != 0) {
+        logError("SSL setup", ret);
+        return false;
+    }
+    contextReady = true;
+    return true;
+}
+
+// Identifies the trust anchors a session is authenticated with, in the same
+// precedence as setupContext() applies them
+uint32_t TlsClient::trustKey() const {
+    uint8_t mode = fingerprintSet ? 'F' : (caLoaded ? 'C' : 'I');
+    uint32_t key = TlsSessionCache::crc32(0, &mode, sizeof(mode));
+    if (fingerprintSet) {
+        key = TlsSessionCache::crc32(key, fingerprint, sizeof(fingerprint));
+    } else if (caLoaded) {
+        for (const mbedtls_x509_crt* crt = &caCert; crt != nullptr && crt->raw.p != nullptr; crt = crt->next) {
+            key = TlsSessionCache::crc32(key, crt->raw.p, crt->raw.len);
+        }
+    }
+    return key;
+}
+
+void TlsClient::offerCachedSession(const char* cacheKey, uint16_t port, uint32_t trust) {
+    stats.sessionOffered = false;
+    if (sessionCache == nullptr) {
+        return;
+    }
+
+    uint8_t* blob = static_cast<uint8_t*>(malloc(TLS_SESSION_MAX_SIZE));
+    if (blob == nullptr) {
+        return;
+    }
+    size_t length = 0;
+    if (sessionCache->load(cacheKey, port, trust, blob, TLS_SESSION_MAX_SIZE, length)) {
+        mbedtls_ssl_session session;
+        mbedtls_ssl_session_init(&session);
+        if (mbedtls_ssl_session_load(&session, blob, length) == 0 && mbedtls_ssl_set_session(&ssl, &session) == 0) {
+            stats.sessionOffered = true;
+        } else {
+            // Saved by a different mbedtls build or corrupted, start over
+            sessionCache->clear();
+        }
+        mbedtls_ssl_session_free(&session);
+    }
+    free(blob);
+}
+
+void TlsClient::storeSession(const char* cacheKey, uint16_t port, uint32_t trust) {
+    if (sessionCache == nullptr) {
+        return;
+    }
+
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    if (mbedtls_ssl_get_session(&ssl, &session) == 0) {
+        uint8_t* blob = static_cast<uint8_t*>(malloc(TLS_SESSION_MAX_SIZE));
+        size_t length = 0;
+        if (blob != nullptr) {
+            int ret = mbedtls_ssl_session_save(&session, blob, TLS_SESSION_MAX_SIZE, &length);
+            if (ret == 0) {
+                sessionCache->store(cacheKey, port, trust, blob, length);
+            } else {
+                logError("Session save", ret);
+            }
+            free(blob);
+        }
+    }
+    mbedtls_ssl_session_free(&session);
+}
+
+bool TlsClient::verifyFingerprint() {
+    const mbedtls_x509_crt* peer = mbedtls_ssl_get_peer_cert(&ssl);
+    if (peer == nullptr) {
+        Serial.println("[TLS] Peer certificate unavailable, enable MBEDTLS_SSL_KEEP_PEER_CERTIFICATE");
+        return false;
+    }
+
+    uint8_t digest[32];
+    if (mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), peer->raw.p, peer->raw.len, digest) != 0) {
+        return false;
+    }
+    return memcmp(digest, fingerprint, sizeof(digest)) == 0;
+}
+
+int TlsClient::handshake(const char* serverName, const char* cacheKey, uint16_t port) {
+    if (!setupContext()) {
+        return 0;
+    }
+
+    // Also called with nullptr, the hostname of a previous connection survives
+    // mbedtls_ssl_session_reset() and has to be cleared explicitly
+    int ret = mbedtls_ssl_set_hostname(&ssl, serverName);
+    if (ret != 0) {
+        logError("Set hostname", ret);
+        return 0;
+    }
+    mbedtls_ssl_set_bio(&ssl, this, bioSend, bioRecv, nullptr);
+    uint32_t trust = trustKey();
+    offerCachedSession(cacheKey, port, trust);
+
+    ioSent = 0;
+    ioReceived = 0;
+    bool sawCertificate = false;
+    uint32_t start = millis();
+
+    // Step through the handshake to learn whether the server sent its certificate:
+    // an abbreviated (resumed) handshake goes from ServerHello straight to ChangeCipherSpec
+    while (ssl.MBEDTLS_PRIVATE(state) != MBEDTLS_SSL_HANDSHAKE_OVER) {
+        if (ssl.MBEDTLS_PRIVATE(state) == MBEDTLS_SSL_SERVER_CERTIFICATE) {
+            sawCertificate = true;
+        }
+        ret = mbedtls_ssl_handshake_step(&ssl);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if (millis() - start > handshakeTimeoutMs) {
+                Serial.println("[TLS] Handshake timeout");
+                return 0;
+            }
+            delay(1);
+            continue;
+        }
+        if (ret != 0) {
+            logError("Handshake", ret);
+            if (stats.sessionOffered && sessionCache != nullptr) {
+                sessionCache->clear();
+            }
+            return 0;
+        }
+    }
+
+    stats.handshakeMs = millis() - start;
+    stats.bytesSent = ioSent;
+    stats.bytesReceived = ioReceived;
+    stats.resumed = stats.sessionOffered && !sawCertificate;
+    if (stats.resumed) {
+        stats.resumedHandshakes++;
+    } else {
+        stats.fullHandshakes++;
+    }
+
+    // A resumed session was authenticated when it was first established
+    if (fingerprintSet && !stats.resumed && !verifyFingerprint()) {
+        Serial.println("[TLS] Server certificate does not match the pinned fingerprint");
+        return 0;
+    }
+
+    storeSession(cacheKey, port, trust);
+    return 1;
+}
+
+int TlsClient::connect(IPAddress ip, uint16_t port) {
+    stop();
+    if (!transport.connect(ip, port)) {
+        return 0;
+    }
+    // No SNI and no certificate name check without a hostname (mbedtls 2.x,
+    // 3.6 refuses to verify a CA chain without one), the address string is
+    // only used as the session cache key
+    String address = ip.toString();
+    established = handshake(nullptr, address.c_str(), port) == 1;
+    if (!established) {
+        transport.stop();
+    }
+    return established ? 1 : 0;
+}
+
+int TlsClient::connect(const char* host, uint16_t port) {
+    stop();
+    if (!transport.connect(host, port)) {
+        return 0;
+    }
+    established = handshake(host, host, port) == 1;
+    if (!established) {
+        transport.stop();
+    }
+    return established ? 1 : 0;
+}
+
+int TlsClient::bioSend(void* ctx, const unsigned char* buf, size_t len) {
+    TlsClient* self = static_cast<TlsClient*>(ctx);
+    if (!self->transport.connected()) {
+        return MBEDTLS_ERR_NET_CONN_RESET;
+    }
+    size_t written = self->transport.write(buf, len);
+    if (written == 0) {
+        return MBEDTLS_ERR_SSL_WANT_WRITE;
+    }
+    self->ioSent += written;
+    return static_cast<int>(written);
+}
+
+int TlsClient::bioRecv(void* ctx, unsigned char* buf, size_t len) {
+    TlsClient* self = static_cast<TlsClient*>(ctx);
+    int pending = self->transport.available();
+    if (pending <= 0) {
+        return self->transport.connected() ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_CONN_RESET;
+    }
+    int received = self->transport.read(buf, min(len, static_cast<size_t>(pending)));
+    if (received <= 0) {
+        return MBEDTLS_ERR_SSL_WANT_READ;
+    }
+    self->ioReceived += received;
+    return received;
+}
+
+size_t TlsClient::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t TlsClient::write(const uint8_t* buf, size_t size) {
+    if (!established) {
+        return 0;
+    }
+    size_t total = 0;
+    uint32_t start = millis();
+    while (total < size) {
+        int ret = mbedtls_ssl_write(&ssl, buf + total, size - total);
+        if (ret > 0) {
+            total += ret;
+            continue;
+        }
+        if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            logError("Write", ret);
+            stop();
+            break;
+        }
+        if (millis() - start > handshakeTimeoutMs) {
+            break;
+        }
+        delay(1);
+    }
+    return total;
+}
+
+int TlsClient::available() {
+    if (!established) {
+        return 0;
+    }
+    int pending = mbedtls_ssl_get_bytes_avail(&ssl) + (peeked >= 0 ? 1 : 0);
+    if (pending == 0 && transport.available() > 0) {
+        // Let mbedtls decrypt the next record without consuming application data
+        int ret = mbedtls_ssl_read(&ssl, nullptr, 0);
+        if (ret < 0 && ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if (ret != MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) {
+                logError("Read", ret);
+            }
+            stop();
+            return 0;
+        }
+        pending = mbedtls_ssl_get_bytes_avail(&ssl);
+    }
+    return pending;
+}
+
+int TlsClient::read() {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+int TlsClient::read(uint8_t* buf, size_t size) {
+    if (!established || size == 0) {
+        return -1;
+    }
+    size_t offset = 0;
+    if (peeked >= 0) {
+        buf[offset++] = static_cast<uint8_t>(peeked);
+        peeked = -1;
+        if (offset == size) {
+            return offset;
+        }
+    }
+    int ret = mbedtls_ssl_read(&ssl, buf + offset, size - offset);
+    if (ret > 0) {
+        return offset + ret;
+    }
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+        stop();
+    }
+    return offset > 0 ? static_cast<int>(offset) : -1;
+}
+
+int TlsClient::peek() {
+    if (peeked < 0 && available() > 0) {
+        uint8_t b;
+        if (mbedtls_ssl_read(&ssl, &b, 1) == 1) {
+            peeked = b;
+        }
+    }
+    return peeked;
+}
+
+void TlsClient::flush() {
+    transport.flush();
+}
+
+void TlsClient::stop() {
+    if (established) {
+        mbedtls_ssl_close_notify(&ssl);
+        established = false;
+    }
+    peeked = -1;
+    transport.stop();
+}
+
+uint8_t TlsClient::connected() {
+    if (!established) {
+        return 0;
+    }
+    return (peeked >= 0 || mbedtls_ssl_get_bytes_avail(&ssl) > 0 || transport.connected()) ? 1 : 0;
+}
+
+TlsClient::operator bool() {
+    return connected();
+}
@@ -0,0 +1,106 @@
+#ifndef TLS_CLIENT_HPP
+#define TLS_CLIENT_HPP
+
+#include <Arduino.h>
+#include <Client.h>
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/x509_crt.h>
+#include "TlsSessionCache.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TLS_HANDSHAKE_TIMEOUT_MS
+#define TLS_HANDSHAKE_TIMEOUT_MS 10000
+#endif
+
+// Measurements of the most recent handshake plus running totals
+struct TlsHandshakeStats {
+    uint32_t handshakeMs;        // TCP connect excluded, TLS handshake only
+    uint32_t bytesSent;          // Bytes written to the transport during the handshake
+    uint32_t bytesReceived;      // Bytes read from the transport during the handshake
+    bool sessionOffered;         // A cached session was offered to the server
+    bool resumed;                // Server accepted the cached session (abbreviated handshake)
+    uint32_t fullHandshakes;
+    uint32_t resumedHandshakes;
+};
+
+// TLS wrapper around any Arduino Client (WiFiClient, EthernetClient, ...),
+// usable by PubSubClient and HttpClient like a plain Client.
+// Trust is configured with either:
+//   - setFingerprint(): pinned SHA-256 of the server leaf certificate, chain
+//     verification is skipped entirely (fast path, no signature checks)
+//   - setCACert(): single pinned root CA, parsed once and kept across reconnects
+//   - setInsecure(): no server authentication (encryption only)
+class TlsClient : public Client {
+private:
+    Client& transport;
+    TlsSessionCache* sessionCache;
+
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_config conf;
+    mbedtls_entropy_context entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_x509_crt caCert;
+
+    bool contextReady;
+    bool drbgSeeded;
+    bool caLoaded;
+    bool insecure;
+    bool fingerprintSet;
+    bool established;
+    uint8_t fingerprint[32];
+    int peeked;
+    uint32_t handshakeTimeoutMs;
+
+    TlsHandshakeStats stats;
+    uint32_t ioSent;
+    uint32_t ioReceived;
+
+    bool setupContext();
+    int handshake(const char* serverName, const char* cacheKey, uint16_t port);
+    uint32_t trustKey() const;
+    void offerCachedSession(const char* cacheKey, uint16_t port, uint32_t trust);
+    void storeSession(const char* cacheKey, uint16_t port, uint32_t trust);
+    bool verifyFingerprint();
+    void logError(const char* what, int ret);
+
+    static int bioSend(void* ctx, const unsigned char* buf, size_t len);
+    static int bioRecv(void* ctx, unsigned char* buf, size_t len);
+
+public:
+    explicit TlsClient(Client& transport);
+    ~TlsClient();
+
+    // Trust configuration, must be called before connect()
+    bool setCACert(const char* rootCaPem);
+    void setFingerprint(const uint8_t sha256[32]);
+    void setInsecure();
+    void setSessionCache(TlsSessionCache* cache);
+    void setHandshakeTimeout(uint32_t timeoutMs);
+
+    const TlsHandshakeStats& getStats() const;
+
+    // Client interface
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char* host, uint16_t port) override;
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t* buf, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t* buf, size_t size) override;
+    int peek() override;
+    void flush() override;
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override;
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TLS_CLIENT_HPP
@@ -0,0 +1,120 @@
+#include "TlsSessionCache.hpp"
+
+#ifdef ARDUINO
+#include <esp_attr.h>
+#include <esp_rom_crc.h>
+#else
+// Host builds have no RTC memory, the slot simply lives as long as the process
+#define RTC_NOINIT_ATTR
+#endif
+
+#define TLS_SESSION_MAGIC 0x544C5332UL // "TLS2", slots without a trust key are ignored
+#define TLS_SESSION_NVS_KEY "session"
+
+// Serialized session, kept in RTC memory so a soft reset or deep sleep does not
+// force a full handshake. The same layout is persisted to NVS.
+struct TlsSessionSlot {
+    uint32_t magic;
+    uint32_t crc;       // CRC over port, length, host, trust key and data
+    uint32_t nvsCrc;    // CRC of the copy currently persisted in NVS
+    uint16_t port;
+    uint16_t length;
+    char host[64];
+    uint32_t trustKey;  // Trust configuration the session was authenticated with
+    uint8_t data[TLS_SESSION_MAX_SIZE];
+};
+
+RTC_NOINIT_ATTR static TlsSessionSlot rtcSession;
+
+static uint32_t slotCrc(const TlsSessionSlot& slot) {
+    uint32_t crc = TlsSessionCache::crc32(0, reinterpret_cast<const uint8_t*>(&slot.port),
+                                          offsetof(TlsSessionSlot, data) - offsetof(TlsSessionSlot, port));
+    return TlsSessionCache::crc32(crc, slot.data, slot.length);
+}
+
+static bool slotValid(const TlsSessionSlot& slot) {
+    return slot.magic == TLS_SESSION_MAGIC && slot.length <= sizeof(slot.data) && slot.crc == slotCrc(slot);
+}
+
+static bool slotMatches(const TlsSessionSlot& slot, const char* host, uint16_t port, uint32_t trustKey) {
+    return slot.port == port && slot.trustKey == trustKey && strncmp(slot.host, host, sizeof(slot.host)) == 0;
+}
+
+TlsSessionCache::TlsSessionCache(const char* nvsNamespace) : nvsNamespace(nvsNamespace) {
+}
+
+bool TlsSessionCache::load(const char* host, uint16_t port, uint32_t trustKey, uint8_t* buf, size_t capacity, size_t& length) {
+    if (!slotValid(rtcSession)) {
+        // RTC memory lost (power cycle), fall back to the copy in NVS
+        prefs.begin(nvsNamespace, true);
+        size_t stored = prefs.getBytesLength(TLS_SESSION_NVS_KEY);
+        if (stored >= offsetof(TlsSessionSlot, data) && stored <= sizeof(rtcSession)) {
+            prefs.getBytes(TLS_SESSION_NVS_KEY, &rtcSession, stored);
+        } else {
+            rtcSession.magic = 0;
+        }
+        prefs.end();
+
+        if (!slotValid(rtcSession)) {
+            rtcSession.magic = 0;
+            return false;
+        }
+    }
+
+    if (!slotMatches(rtcSession, host, port, trustKey) || rtcSession.length > capacity) {
+        return false;
+    }
+    memcpy(buf, rtcSession.data, rtcSession.length);
+    length = rtcSession.length;
+    return true;
+}
+
+void TlsSessionCache::store(const char* host, uint16_t port, uint32_t trustKey, const uint8_t* data, size_t length) {
+    if (length > sizeof(rtcSession.data) || strlen(host) >= sizeof(rtcSession.host)) {
+        return;
+    }
+
+    uint32_t previousNvsCrc = slotValid(rtcSession) ? rtcSession.nvsCrc : 0;
+
+    memset(rtcSession.host, 0, sizeof(rtcSession.host));
+    strncpy(rtcSession.host, host, sizeof(rtcSession.host) - 1);
+    rtcSession.port = port;
+    rtcSession.length = length;
+    rtcSession.trustKey = trustKey;
+    memcpy(rtcSession.data, data, length);
+    rtcSession.crc = slotCrc(rtcSession);
+    rtcSession.nvsCrc = previousNvsCrc;
+    rtcSession.magic = TLS_SESSION_MAGIC;
+
+    // Only touch flash when the session actually changed, most servers keep
+    // the same ticket for its whole lifetime
+    if (rtcSession.crc != previousNvsCrc) {
+        rtcSession.nvsCrc = rtcSession.crc;
+        prefs.begin(nvsNamespace, false);
+        prefs.putBytes(TLS_SESSION_NVS_KEY, &rtcSession, offsetof(TlsSessionSlot, data) + length);
+        prefs.end();
+    }
+}
+
+void TlsSessionCache::clear() {
+    rtcSession.magic = 0;
+    prefs.begin(nvsNamespace, false);
+    prefs.remove(TLS_SESSION_NVS_KEY);
+    prefs.end();
+}
+
+uint32_t TlsSessionCache::crc32(uint32_t crc, const uint8_t* data, size_t length) {
+#ifdef ARDUINO
+    return esp_rom_crc32_le(crc, data, length);
+#else
+    // Same result as the ROM implementation, which inverts the value before and after the calculation
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
+        }
+    }
+    return ~crc;
+#endif
+}
@@ -0,0 +1,38 @@
+#ifndef TLS_SESSION_CACHE_HPP
+#define TLS_SESSION_CACHE_HPP
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Maximum size of a serialized TLS session (ticket + master secret, plus the
+// peer certificate when MBEDTLS_SSL_KEEP_PEER_CERTIFICATE is enabled)
+#ifndef TLS_SESSION_MAX_SIZE
+#define TLS_SESSION_MAX_SIZE 2048
+#endif
+
+// Caches one serialized TLS session per host:port and trust configuration.
+// RTC memory survives soft resets and deep sleep, NVS survives power loss.
+// The trust key identifies the pinned fingerprint or CA the session was
+// authenticated with, a session established under different trust anchors is
+// never offered again, because resumption skips the certificate check.
+class TlsSessionCache {
+private:
+    Preferences prefs;
+    const char* nvsNamespace;
+
+public:
+    explicit TlsSessionCache(const char* nvsNamespace = "tls");
+
+    // Copies the cached session for host:port into buf, returns false if none
+    // or if it was established with a different trust configuration
+    bool load(const char* host, uint16_t port, uint32_t trustKey, uint8_t* buf, size_t capacity, size_t& length);
+    // Stores the session in RTC memory, NVS is only written when the session changed
+    void store(const char* host, uint16_t port, uint32_t trustKey, const uint8_t* data, size_t length);
+    // Drops the cached session, e.g. after the server rejected it with an error
+    void clear();
+
+    // CRC32 used for the integrity check of the cached session and for the trust key
+    static uint32_t crc32(uint32_t crc, const uint8_t* data, size_t length);
+};
+
+#endif // TLS_SESSION_CACHE_HPP
@@ -6,6 +6,8 @@
 #include <sensor.hpp>
 #include <config.hpp>
 #include <DeviceManager.hpp>
+#include <OTA.h>
+#include <BootValidator.h>
 
 // Cài đặt và khởi tạo hệ thống
 void setup()
@@ -36,6 +38,15 @@ void setup()
   DeviceProfile profile = deviceManager.getDeviceProfile();
   initConfigFromDeviceId(profile.deviceId);  const DeviceConfig* config = getCurrentConfig();
     Serial.printf("Starting %s with Device ID: %s\n", config->deviceName, profile.deviceId);
+
+  // Image vừa cập nhật qua OTA phải kết nối được và gửi dữ liệu trước thời hạn,
+  // nếu không thiết bị quay lại image cũ. Cảm biến và telemetry môi trường chỉ
+  // được kiểm tra khi loại thiết bị có chúng
+  uint8_t bootProbes = BOOT_PROBE_MQTT;
+  if (config->enableTempHumidity) {
+    bootProbes |= BOOT_PROBE_SENSORS | BOOT_PROBE_TELEMETRY;
+  }
+  bootValidator.begin(bootProbes, millis());
   InitWiFi();
   sensorDataMutex = xSemaphoreCreateMutex();
   if (config->enableTempHumidity) {
@@ -59,8 +70,13 @@ void setup()
     xTaskCreate(rfidTask, "RFID_Task", 2048, NULL, 1, NULL);
   }
   
+  // OTA dùng chung phiên MQTT của task ThingsBoard, đăng ký topic trước khi kết nối
+  otaInit();
+
   // Always create ThingsBoard task
-  xTaskCreate(TaskThingsBoard, "ThingsBoard_Task", 4096, NULL, 2, NULL);
+  // Stack lớn hơn vì các handler của OTA (parse JSON, ghi flash) chạy trên task này
+  xTaskCreate(TaskThingsBoard, "ThingsBoard_Task", 8192, NULL, 2, NULL);
+  xTaskCreate(otaTask, "OTA_Task", 4096, NULL, 1, NULL);
   xTaskCreate(ledControlTask, "LED Control Task", 2048, NULL, 1, NULL);
   
   
@@ -0,0 +1,98 @@
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+// Host stand-in for the subset of the Arduino core for ESP32 used by the libraries, so their hardware independent parts can be tested with "pio test -e native".
+// Deliberately does not define ARDUINO, so the libraries compile their host code paths and skip the translation units that need real hardware.
+
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "IPAddress.h"
+#include "Print.h"
+#include "Stream.h"
+#include "WString.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PROGMEM
+#define F(string) (string)
+#define pgm_read_byte_near(address) (*reinterpret_cast<const uint8_t *>(address))
+
+using std::max;
+using std::min;
+
+#ifndef constrain
+#define constrain(value, low, high) ((value) < (low) ? (low) : ((value) > (high) ? (high) : (value)))
+#endif // constrain
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>(static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - host_freertos::start_time()).count()));
+}
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>(xTaskGetTickCount());
+}
+
+inline void delay(unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline bool isAlphaNumeric(int c) {
+    return isalnum(c) != 0;
+}
+
+inline bool isHexadecimalDigit(int c) {
+    return isxdigit(c) != 0;
+}
+
+inline bool isSpace(int c) {
+    return isspace(c) != 0;
+}
+
+inline long random(long howbig) {
+    return howbig <= 0L ? 0L : ::random() % howbig;
+}
+
+inline long random(long howsmall, long howbig) {
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+inline void yield() {
+    std::this_thread::yield();
+}
+
+/// @brief Serial port, writes to stderr when the environment variable SERIAL_LOG is set and discards the output otherwise,
+/// so the log messages of the libraries do not clutter the test results
+class HardwareSerial : public Stream {
+  public:
+    void begin(unsigned long baud) { (void)baud; }
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1U); }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        static const bool enabled = getenv("SERIAL_LOG") != nullptr;
+        if (enabled) {
+            fwrite(buffer, 1U, size, stderr);
+        }
+        return size;
+    }
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+};
+
+// Internal linkage, so the header can be included from any amount of translation units
+static HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
@@ -0,0 +1,28 @@
+#ifndef HOST_IPADDRESS_H
+#define HOST_IPADDRESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include "WString.h"
+
+class IPAddress {
+  public:
+    IPAddress() : m_address(0U) {}
+    IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth)
+      : m_address(static_cast<uint32_t>(first) | static_cast<uint32_t>(second) << 8U | static_cast<uint32_t>(third) << 16U | static_cast<uint32_t>(fourth) << 24U) {}
+    IPAddress(uint32_t address) : m_address(address) {}
+
+    operator uint32_t() const { return m_address; }
+    uint8_t operator[](int index) const { return static_cast<uint8_t>(m_address >> (index * 8)); }
+
+    String toString() const {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+        return String(buffer);
+    }
+
+  private:
+    uint32_t m_address; // Network byte order, like the ESP32 core stores it
+};
+
+#endif // HOST_IPADDRESS_H
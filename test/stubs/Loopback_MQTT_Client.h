@@ -0,0 +1,280 @@
+#ifndef Loopback_MQTT_Client_h
+#define Loopback_MQTT_Client_h
+
+// Local stand-in for an MQTT broker, implements IMQTT_Client without any network connection.
+// Messages published to a topic the client subscribed to are sent back to it from loop() once their simulated latency has passed,
+// messages of the server are injected with inject(). Every published message is recorded, so tests can check what the library sent.
+// Publishing is thread safe, because the libraries publish from their worker tasks as well
+
+#include <IMQTT_Client.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Loopback_MQTT_Client : public IMQTT_Client {
+  public:
+    using clock_function = uint64_t (*)();
+
+    /// @brief Single message, either published by the client or waiting to be delivered to it
+    struct Message {
+        std::string topic;
+        std::string payload;
+        uint64_t deliver_at;
+    };
+
+    uint64_t latency_us = 0U;         // Time between publishing or injecting a message and it being delivered from loop()
+    size_t slow_every = 0U;           // Every n-th published message is delayed by slow_latency_us instead, 0 disables it
+    uint64_t slow_latency_us = 0U;    // Latency of the delayed messages, they do not hold back the messages published after them
+    size_t drop_message = 0U;         // Number of the published message that is lost on the way back, counted from 1, 0 disables it
+    size_t corrupt_message = 0U;      // Number of the published message that has one payload bit flipped on the way back
+    size_t duplicate_message = 0U;    // Number of the published message that is delivered twice
+    std::function<void()> on_loop;    // Called at the start of every loop(), allows tests to advance a simulated clock
+
+    explicit Loopback_MQTT_Client(clock_function clock = Steady_Clock)
+      : m_clock(clock)
+    {
+        // Nothing to do
+    }
+
+    void set_callback(function callback) override { m_callback = callback; }
+
+    bool set_buffer_size(const uint16_t& buffer_size) override {
+        m_buffer_size = buffer_size;
+        return true;
+    }
+
+    uint16_t get_buffer_size() override { return m_buffer_size; }
+
+    void set_server(const char *domain, const uint16_t& port) override {
+        (void)domain;
+        (void)port;
+    }
+
+    bool connect(const char *client_id, const char *user_name, const char *password) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_client_id = client_id != nullptr ? client_id : "";
+        m_user_name = user_name != nullptr ? user_name : "";
+        m_password = password != nullptr ? password : "";
+        m_connected = true;
+        return true;
+    }
+
+    void disconnect() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connected = false;
+        m_subscriptions.clear();
+        m_pending.clear();
+    }
+
+    /// @brief Delivers every message whose latency has passed, messages that are still delayed do not hold back later ones
+    bool loop() override {
+        if (on_loop) {
+            on_loop();
+        }
+        for (;;) {
+            Message message;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                const uint64_t now = m_clock();
+                std::deque<Message>::iterator due = m_pending.begin();
+                while (due != m_pending.end() && due->deliver_at > now) {
+                    ++due;
+                }
+                if (due == m_pending.end()) {
+                    return m_connected;
+                }
+                message = *due;
+                m_pending.erase(due);
+            }
+            deliver(message);
+        }
+    }
+
+    bool publish(const char *topic, const uint8_t *payload, const size_t& length) override {
+        return send(topic, std::string(reinterpret_cast<const char*>(payload), length));
+    }
+
+    bool subscribe(const char *topic) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_subscriptions.push_back(topic);
+        return m_connected;
+    }
+
+    bool unsubscribe(const char *topic) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (std::vector<std::string>::iterator it = m_subscriptions.begin(); it != m_subscriptions.end(); ++it) {
+            if (*it == topic) {
+                m_subscriptions.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool connected() override { return m_connected; }
+
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    bool begin_publish(const char *topic, const size_t& length) override {
+        m_stream_topic = topic;
+        m_stream_length = length;
+        m_stream_payload.clear();
+        return m_connected;
+    }
+
+    bool end_publish() override {
+        return m_stream_payload.size() == m_stream_length && send(m_stream_topic.c_str(), m_stream_payload);
+    }
+
+    size_t write(uint8_t payload_byte) override {
+        m_stream_payload.push_back(static_cast<char>(payload_byte));
+        return 1U;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        m_stream_payload.append(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+
+    /// @brief Queues a message from the server, delivered by the next loop() once the latency has passed
+    void inject(const char *topic, const std::string& payload) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(Message{ topic, payload, m_clock() + latency_us });
+    }
+
+    /// @brief Calls the callback directly from the calling thread, like a client that receives on its own task
+    void deliver_now(const char *topic, const std::string& payload) {
+        deliver(Message{ topic, payload, 0U });
+    }
+
+    /// @brief Every message that has been published successfully so far, optionally only the ones whose topic starts with the given prefix
+    std::vector<Message> published(const char *prefix = "") {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<Message> result;
+        for (const Message& message : m_published) {
+            if (message.topic.compare(0U, strlen(prefix), prefix) == 0) {
+                result.push_back(message);
+            }
+        }
+        return result;
+    }
+
+    void clear_published() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_published.clear();
+    }
+
+    /// @brief Amount of payload bytes waiting to be delivered
+    size_t queued_bytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t bytes = 0U;
+        for (const Message& message : m_pending) {
+            bytes += message.payload.size();
+        }
+        return bytes;
+    }
+
+    std::string client_id() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_client_id;
+    }
+
+    std::string user_name() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_user_name;
+    }
+
+    /// @brief Whether the given topic matches the given filter, including the + and # wildcards
+    static bool Matches(const char *filter, const char *topic) {
+        while (*filter != '\0') {
+            if (*filter == '#') {
+                return true;
+            }
+            if (*filter == '+') {
+                while (*topic != '\0' && *topic != '/') {
+                    topic++;
+                }
+                filter++;
+                continue;
+            }
+            if (*filter != *topic) {
+                return false;
+            }
+            filter++;
+            topic++;
+        }
+        return *topic == '\0';
+    }
+
+    static uint64_t Steady_Clock() {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+  private:
+    // Same limit as PubSubClient, the fixed header, the topic length and the topic have to fit into the buffer together with the payload
+    static constexpr size_t OVERHEAD = 7U;
+
+    bool send(const char *topic, std::string payload) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_connected || strlen(topic) + payload.size() + OVERHEAD > m_buffer_size) {
+            return false;
+        }
+        m_published.push_back(Message{ topic, payload, 0U });
+        const size_t number = m_published.size();
+        if (number == drop_message || !subscribed(topic)) {
+            return true;
+        }
+        if (number == corrupt_message && !payload.empty()) {
+            payload[payload.size() / 2U] ^= 0x01;
+        }
+        const bool slow = slow_every != 0U && number % slow_every == 0U;
+        m_pending.push_back(Message{ topic, payload, m_clock() + (slow ? slow_latency_us : latency_us) });
+        if (number == duplicate_message) {
+            m_pending.push_back(m_pending.back());
+        }
+        return true;
+    }
+
+    bool subscribed(const char *topic) const {
+        for (const std::string& filter : m_subscriptions) {
+            if (Matches(filter.c_str(), topic)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void deliver(Message message) {
+        if (!m_callback) {
+            return;
+        }
+        std::vector<char> topic(message.topic.begin(), message.topic.end());
+        topic.push_back('\0');
+        message.payload.push_back('\0');
+        m_callback(topic.data(), reinterpret_cast<uint8_t*>(&message.payload[0]), message.payload.size() - 1U);
+    }
+
+    clock_function m_clock;
+    function m_callback;
+    uint16_t m_buffer_size = 256U;
+    std::atomic<bool> m_connected{false};
+    std::mutex m_mutex;
+    std::vector<std::string> m_subscriptions;
+    std::deque<Message> m_pending;
+    std::vector<Message> m_published;
+    std::string m_client_id;
+    std::string m_user_name;
+    std::string m_password;
+#if THINGSBOARD_ENABLE_STREAM_UTILS
+    std::string m_stream_topic;
+    std::string m_stream_payload;
+    size_t m_stream_length = 0U;
+#endif // THINGSBOARD_ENABLE_STREAM_UTILS
+};
+
+#endif // Loopback_MQTT_Client_h
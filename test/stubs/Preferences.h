@@ -0,0 +1,125 @@
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+// Host stand-in for the NVS backed Preferences of the Arduino core for ESP32, keeps every namespace in memory for the lifetime of the process.
+// Tests can inspect or wipe the stored values through Preferences::storage()
+
+#include <stdint.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "WString.h"
+
+class Preferences {
+  public:
+    typedef std::map<std::string, std::map<std::string, std::vector<uint8_t>>> Storage;
+
+    /// @brief Every namespace with its keys and their raw values, shared by all instances
+    static Storage& storage() {
+        static Storage instance;
+        return instance;
+    }
+
+    bool begin(const char *name, bool read_only = false) {
+        m_namespace = name;
+        m_read_only = read_only;
+        m_open = true;
+        return true;
+    }
+
+    void end() { m_open = false; }
+
+    bool clear() {
+        if (!writable()) {
+            return false;
+        }
+        storage()[m_namespace].clear();
+        return true;
+    }
+
+    bool remove(const char *key) { return writable() && storage()[m_namespace].erase(key) > 0U; }
+
+    bool isKey(const char *key) { return find(key) != nullptr; }
+
+    size_t putBytes(const char *key, const void *value, size_t length) {
+        if (!writable()) {
+            return 0U;
+        }
+        const uint8_t *bytes = static_cast<const uint8_t *>(value);
+        storage()[m_namespace][key].assign(bytes, bytes + length);
+        return length;
+    }
+
+    size_t getBytesLength(const char *key) {
+        const std::vector<uint8_t> *value = find(key);
+        return value != nullptr ? value->size() : 0U;
+    }
+
+    size_t getBytes(const char *key, void *buffer, size_t length) {
+        const std::vector<uint8_t> *value = find(key);
+        if (value == nullptr || value->size() > length) {
+            return 0U;
+        }
+        memcpy(buffer, value->data(), value->size());
+        return value->size();
+    }
+
+    size_t putString(const char *key, const char *value) { return putBytes(key, value, strlen(value) + 1U) > 0U ? strlen(value) : 0U; }
+    size_t putString(const char *key, const String& value) { return putString(key, value.c_str()); }
+
+    String getString(const char *key, const String& default_value = String()) {
+        const std::vector<uint8_t> *value = find(key);
+        return value != nullptr && !value->empty() ? String(reinterpret_cast<const char *>(value->data())) : default_value;
+    }
+
+    size_t getString(const char *key, char *buffer, size_t length) {
+        const std::vector<uint8_t> *value = find(key);
+        if (value == nullptr || value->empty() || value->size() > length) {
+            return 0U;
+        }
+        memcpy(buffer, value->data(), value->size());
+        return value->size();
+    }
+
+    size_t putBool(const char *key, bool value) { return putValue(key, static_cast<uint8_t>(value)); }
+    bool getBool(const char *key, bool default_value = false) { return getValue<uint8_t>(key, default_value) != 0U; }
+    size_t putUChar(const char *key, uint8_t value) { return putValue(key, value); }
+    uint8_t getUChar(const char *key, uint8_t default_value = 0U) { return getValue(key, default_value); }
+    size_t putUShort(const char *key, uint16_t value) { return putValue(key, value); }
+    uint16_t getUShort(const char *key, uint16_t default_value = 0U) { return getValue(key, default_value); }
+    size_t putUInt(const char *key, uint32_t value) { return putValue(key, value); }
+    uint32_t getUInt(const char *key, uint32_t default_value = 0U) { return getValue(key, default_value); }
+    size_t putULong(const char *key, uint32_t value) { return putValue(key, value); }
+    uint32_t getULong(const char *key, uint32_t default_value = 0U) { return getValue(key, default_value); }
+
+  private:
+    bool writable() const { return m_open && !m_read_only; }
+
+    const std::vector<uint8_t> *find(const char *key) const {
+        if (!m_open) {
+            return nullptr;
+        }
+        const Storage::const_iterator name = storage().find(m_namespace);
+        if (name == storage().end()) {
+            return nullptr;
+        }
+        const std::map<std::string, std::vector<uint8_t>>::const_iterator value = name->second.find(key);
+        return value != name->second.end() ? &value->second : nullptr;
+    }
+
+    template <typename T>
+    size_t putValue(const char *key, const T& value) { return putBytes(key, &value, sizeof(value)); }
+
+    template <typename T>
+    T getValue(const char *key, const T& default_value) {
+        T value;
+        return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : default_value;
+    }
+
+    std::string m_namespace;
+    bool m_read_only = false;
+    bool m_open = false;
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,46 @@
+#ifndef HOST_STREAM_H
+#define HOST_STREAM_H
+
+#include <chrono>
+#include <thread>
+#include "Print.h"
+
+class Stream : public Print {
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { m_timeout = timeout; }
+
+    size_t readBytes(uint8_t *buffer, size_t length) {
+        size_t count = 0U;
+        while (count < length) {
+            const int c = read();
+            if (c < 0) {
+                break;
+            }
+            buffer[count++] = static_cast<uint8_t>(c);
+        }
+        return count;
+    }
+    size_t readBytes(char *buffer, size_t length) { return readBytes(reinterpret_cast<uint8_t *>(buffer), length); }
+
+  protected:
+    /// @brief Waits up to the timeout for the next byte, -1 if none arrived
+    int timedRead() {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        do {
+            const int c = read();
+            if (c >= 0) {
+                return c;
+            }
+            std::this_thread::yield();
+        } while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(m_timeout));
+        return -1;
+    }
+
+    unsigned long m_timeout = 1000UL;
+};
+
+#endif // HOST_STREAM_H
@@ -0,0 +1,66 @@
+#ifndef HOST_STREAM_UTILS_H
+#define HOST_STREAM_UTILS_H
+
+// Host stand-in for the BufferingPrint of ArduinoStreamUtils, which THINGSBOARD_ENABLE_STREAM_UTILS uses to stream big messages into the MQTT client.
+// Collects the written bytes and forwards them to the target once the buffer is full or flush() is called, writes bigger than the buffer bypass it
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "Print.h"
+
+class BufferingPrint : public Print {
+  public:
+    BufferingPrint(Print& target, size_t capacity)
+      : m_target(target)
+      , m_buffer()
+      , m_capacity(capacity)
+    {
+        m_buffer.reserve(capacity);
+    }
+
+    ~BufferingPrint() override { flush(); }
+
+    size_t write(uint8_t c) override {
+        if (m_capacity == 0U) {
+            return m_target.write(c);
+        }
+        m_buffer.push_back(c);
+        if (m_buffer.size() >= m_capacity) {
+            flush();
+        }
+        return 1U;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        if (m_buffer.empty() && size >= m_capacity) {
+            return m_target.write(buffer, size);
+        }
+        size_t written = 0U;
+        while (written < size) {
+            const size_t chunk = m_capacity - m_buffer.size() < size - written ? m_capacity - m_buffer.size() : size - written;
+            m_buffer.insert(m_buffer.end(), buffer + written, buffer + written + chunk);
+            written += chunk;
+            if (m_buffer.size() >= m_capacity) {
+                flush();
+            }
+        }
+        return written;
+    }
+
+    void flush() override {
+        if (!m_buffer.empty()) {
+            m_target.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+        m_target.flush();
+    }
+
+  private:
+    Print& m_target;
+    std::vector<uint8_t> m_buffer;
+    size_t m_capacity;
+};
+
+#endif // HOST_STREAM_UTILS_H
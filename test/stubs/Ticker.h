@@ -0,0 +1,66 @@
+#ifndef HOST_TICKER_H
+#define HOST_TICKER_H
+
+// Host stand-in for the Ticker of the Arduino core for ESP32, every attach starts a thread that calls the callback until it is detached
+
+#include <stdint.h>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+class Ticker {
+  public:
+    ~Ticker() { detach(); }
+
+    template <typename TArg>
+    void attach_ms(uint32_t milliseconds, void (*callback)(TArg), TArg arg) { start(milliseconds, true, callback, arg); }
+
+    template <typename TArg>
+    void once_ms(uint32_t milliseconds, void (*callback)(TArg), TArg arg) { start(milliseconds, false, callback, arg); }
+
+    /// @brief Stops the timer, a callback that is already being called still returns normally, which allows it to detach its own Ticker
+    void detach() {
+        std::shared_ptr<State> state;
+        state.swap(m_state);
+        if (state == nullptr) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cancelled = true;
+        state->changed.notify_all();
+    }
+
+    bool active() const { return m_state != nullptr; }
+
+  private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable changed;
+        bool cancelled = false;
+    };
+
+    template <typename TArg>
+    void start(uint32_t milliseconds, bool periodic, void (*callback)(TArg), TArg arg) {
+        detach();
+        std::shared_ptr<State> state = std::make_shared<State>();
+        m_state = state;
+        std::thread([state, milliseconds, periodic, callback, arg] {
+            std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+            do {
+                next += std::chrono::milliseconds(milliseconds);
+                std::unique_lock<std::mutex> lock(state->mutex);
+                if (state->changed.wait_until(lock, next, [&state] { return state->cancelled; })) {
+                    return;
+                }
+                lock.unlock();
+                callback(arg);
+            } while (periodic);
+        }).detach();
+    }
+
+    std::shared_ptr<State> m_state;
+};
+
+#endif // HOST_TICKER_H
@@ -0,0 +1,68 @@
+#ifndef HOST_WSTRING_H
+#define HOST_WSTRING_H
+
+// Host stand-in for the Arduino String class, backed by std::string and limited to the members the libraries use
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+class String {
+  public:
+    String(const char *value = "") : m_value(value != nullptr ? value : "") {}
+    String(const std::string& value) : m_value(value) {}
+    explicit String(char value) : m_value(1U, value) {}
+    String(int value) : m_value(std::to_string(value)) {}
+    String(unsigned int value) : m_value(std::to_string(value)) {}
+    String(long value) : m_value(std::to_string(value)) {}
+    String(unsigned long value) : m_value(std::to_string(value)) {}
+
+    const char *c_str() const { return m_value.c_str(); }
+    unsigned int length() const { return m_value.size(); }
+    bool isEmpty() const { return m_value.empty(); }
+    bool reserve(unsigned int size) { m_value.reserve(size); return true; }
+    char charAt(unsigned int index) const { return index < m_value.size() ? m_value[index] : '\0'; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    long toInt() const { return atol(m_value.c_str()); }
+
+    bool concat(const String& value) { m_value += value.m_value; return true; }
+    bool concat(const char *value) { m_value += value; return true; }
+    bool concat(const char *value, unsigned int length) { m_value.append(value, length); return true; }
+    bool concat(char value) { m_value += value; return true; }
+    String& operator+=(const String& value) { concat(value); return *this; }
+    String& operator+=(const char *value) { concat(value); return *this; }
+    String& operator+=(char value) { concat(value); return *this; }
+    friend String operator+(String left, const String& right) { left += right; return left; }
+    friend String operator+(String left, const char *right) { left += right; return left; }
+
+    bool equals(const String& value) const { return m_value == value.m_value; }
+    bool equalsIgnoreCase(const String& value) const { return strcasecmp(c_str(), value.c_str()) == 0; }
+    bool startsWith(const String& prefix) const { return m_value.compare(0U, prefix.m_value.size(), prefix.m_value) == 0; }
+    bool operator==(const String& value) const { return equals(value); }
+    bool operator==(const char *value) const { return m_value == value; }
+    bool operator!=(const String& value) const { return !equals(value); }
+    bool operator!=(const char *value) const { return m_value != value; }
+    bool operator<(const String& value) const { return m_value < value.m_value; }
+
+    int indexOf(char value, unsigned int from = 0U) const {
+        const size_t position = m_value.find(value, from);
+        return position == std::string::npos ? -1 : static_cast<int>(position);
+    }
+    String substring(unsigned int from) const { return from < m_value.size() ? String(m_value.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const { return from < m_value.size() && to > from ? String(m_value.substr(from, to - from)) : String(); }
+    void remove(unsigned int index) { if (index < m_value.size()) m_value.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < m_value.size()) m_value.erase(index, count); }
+    void toLowerCase() { for (char& c : m_value) c = static_cast<char>(tolower(c)); }
+    void toUpperCase() { for (char& c : m_value) c = static_cast<char>(toupper(c)); }
+    void trim() {
+        const size_t first = m_value.find_first_not_of(" \t\r\n");
+        const size_t last = m_value.find_last_not_of(" \t\r\n");
+        m_value = first == std::string::npos ? std::string() : m_value.substr(first, last - first + 1U);
+    }
+
+  private:
+    std::string m_value;
+};
+
+#endif // HOST_WSTRING_H
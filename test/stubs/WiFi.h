@@ -0,0 +1,18 @@
+#ifndef HOST_WIFI_H
+#define HOST_WIFI_H
+
+// Host stand-in for the WiFi library of the Arduino core for ESP32, the station is always connected
+
+#include "WiFiClient.h"
+
+class WiFiClass {
+  public:
+    WiFiClass() {}
+    bool isConnected() { return true; }
+    int8_t RSSI() { return -50; }
+};
+
+// Internal linkage, so the header can be included from any amount of translation units
+static WiFiClass WiFi;
+
+#endif // HOST_WIFI_H
@@ -0,0 +1,137 @@
+#ifndef HOST_WIFICLIENT_H
+#define HOST_WIFICLIENT_H
+
+// Host stand-in for the WiFiClient of the Arduino core for ESP32, a plain non-blocking TCP socket,
+// so receive paths built on select() can be tested against a server on the loopback interface
+
+#include <errno.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "Client.h"
+
+class WiFiClient : public Client {
+  public:
+    WiFiClient() : m_fd(-1) {}
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+    ~WiFiClient() { stop(); }
+
+    int connect(IPAddress ip, uint16_t port) override {
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = static_cast<uint32_t>(ip);
+        return connect(reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+    }
+
+    int connect(const char *host, uint16_t port) override {
+        addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo *result = nullptr;
+        if (getaddrinfo(host, nullptr, &hints, &result) != 0 || result == nullptr) {
+            return 0;
+        }
+        sockaddr_in address = *reinterpret_cast<const sockaddr_in *>(result->ai_addr);
+        freeaddrinfo(result);
+        address.sin_port = htons(port);
+        return connect(reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+    }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1U); }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        size_t written = 0U;
+        while (m_fd >= 0 && written < size) {
+            const ssize_t sent = send(m_fd, buffer + written, size - written, MSG_NOSIGNAL);
+            if (sent > 0) {
+                written += sent;
+            }
+            else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK) {
+                stop();
+            }
+        }
+        return written;
+    }
+
+    int available() override {
+        int pending = 0;
+        if (m_fd < 0 || ioctl(m_fd, FIONREAD, &pending) != 0) {
+            return 0;
+        }
+        return pending;
+    }
+
+    int read() override {
+        uint8_t c;
+        return read(&c, 1U) == 1 ? c : -1;
+    }
+
+    int read(uint8_t *buffer, size_t size) override {
+        if (m_fd < 0) {
+            return -1;
+        }
+        const ssize_t received = recv(m_fd, buffer, size, 0);
+        return received > 0 ? static_cast<int>(received) : -1;
+    }
+
+    int peek() override {
+        uint8_t c;
+        return m_fd >= 0 && recv(m_fd, &c, 1U, MSG_PEEK) == 1 ? c : -1;
+    }
+
+    void flush() override {}
+
+    void stop() override {
+        if (m_fd >= 0) {
+            close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    /// @brief Like the ESP32 core, a socket closed by the peer counts as connected until its remaining data has been read
+    uint8_t connected() override {
+        if (m_fd < 0) {
+            return 0U;
+        }
+        uint8_t c;
+        const ssize_t result = recv(m_fd, &c, 1U, MSG_PEEK);
+        if (result == 0 || (result < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+            stop();
+            return 0U;
+        }
+        return 1U;
+    }
+
+    operator bool() override { return connected() != 0U; }
+
+    int fd() const { return m_fd; }
+
+  private:
+    int connect(const sockaddr *address, const socklen_t& length) {
+        stop();
+        m_fd = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_fd < 0) {
+            return 0;
+        }
+        if (::connect(m_fd, address, length) != 0) {
+            stop();
+            return 0;
+        }
+        const int enable = 1;
+        setsockopt(m_fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        fcntl(m_fd, F_SETFL, fcntl(m_fd, F_GETFL) | O_NONBLOCK);
+        return 1;
+    }
+
+    int m_fd;
+};
+
+#endif // HOST_WIFICLIENT_H
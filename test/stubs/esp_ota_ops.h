@@ -0,0 +1,95 @@
+#ifndef HOST_ESP_OTA_OPS_H
+#define HOST_ESP_OTA_OPS_H
+
+// Host stand-in for the OTA API of the ESP-IDF on top of the simulated flash of esp_partition.h.
+// The application runs from host_flash::flash().running, updates go into the other partition and
+// esp_ota_set_boot_partition() only accepts images that start with the ESP image magic byte, like the real image validation
+
+#include "esp_partition.h"
+
+typedef uint32_t esp_ota_handle_t;
+
+#define ESP_IMAGE_HEADER_MAGIC 0xE9
+
+inline const esp_partition_t *esp_ota_get_running_partition() {
+    return &host_flash::flash().partitions[host_flash::flash().running];
+}
+
+inline const esp_partition_t *esp_ota_get_boot_partition() {
+    return &host_flash::flash().partitions[host_flash::flash().boot];
+}
+
+inline const esp_partition_t *esp_ota_get_next_update_partition(const esp_partition_t *start) {
+    (void)start;
+    return &host_flash::flash().partitions[host_flash::flash().running == 0U ? 1U : 0U];
+}
+
+inline esp_err_t esp_ota_set_boot_partition(const esp_partition_t *partition) {
+    std::vector<uint8_t> *data = host_flash::content(partition);
+    if (data == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if ((*data)[0U] != ESP_IMAGE_HEADER_MAGIC) {
+        return ESP_ERR_OTA_VALIDATE_FAILED;
+    }
+    host_flash::flash().boot = partition == &host_flash::flash().partitions[0U] ? 0U : 1U;
+    return ESP_OK;
+}
+
+namespace host_flash {
+
+/// @brief State of the single OTA handle, writes continue sequentially after the previous one
+struct Ota_Handle {
+    const esp_partition_t *partition;
+    size_t offset;
+};
+
+inline Ota_Handle& ota_handle() {
+    static Ota_Handle instance = { nullptr, 0U };
+    return instance;
+}
+
+} // namespace host_flash
+
+inline esp_err_t esp_ota_begin(const esp_partition_t *partition, size_t image_size, esp_ota_handle_t *handle) {
+    if (host_flash::content(partition) == nullptr || image_size > partition->size || handle == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const size_t erase = (image_size + host_flash::SECTOR_SIZE - 1U) / host_flash::SECTOR_SIZE * host_flash::SECTOR_SIZE;
+    const esp_err_t error = esp_partition_erase_range(partition, 0U, erase);
+    if (error != ESP_OK) {
+        return error;
+    }
+    host_flash::ota_handle() = { partition, 0U };
+    *handle = 1U;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ota_write(esp_ota_handle_t handle, const void *data, size_t size) {
+    host_flash::Ota_Handle& state = host_flash::ota_handle();
+    if (handle != 1U || state.partition == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const esp_err_t error = esp_partition_write(state.partition, state.offset, data, size);
+    if (error == ESP_OK) {
+        state.offset += size;
+    }
+    return error;
+}
+
+inline esp_err_t esp_ota_end(esp_ota_handle_t handle) {
+    host_flash::Ota_Handle& state = host_flash::ota_handle();
+    if (handle != 1U || state.partition == nullptr) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    state.partition = nullptr;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_ota_abort(esp_ota_handle_t handle) {
+    (void)handle;
+    host_flash::ota_handle().partition = nullptr;
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_OTA_OPS_H
@@ -0,0 +1,114 @@
+#ifndef HOST_ESP_PARTITION_H
+#define HOST_ESP_PARTITION_H
+
+// Host stand-in for the partition API of the ESP-IDF. Two OTA app partitions are kept in memory with the semantics of NOR flash:
+// erasing sets whole sectors to 0xFF and writing can only clear bits. Every write that would have to set a bit again, because the
+// sector was not erased, and every unaligned erase is counted as a violation, tests inspect the content and the counters through host_flash
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_OTA_VALIDATE_FAILED 0x1503
+
+typedef struct {
+    uint32_t address;
+    uint32_t size;
+    const char *label;
+} esp_partition_t;
+
+namespace host_flash {
+
+constexpr uint32_t SECTOR_SIZE = 4096U;
+constexpr uint32_t PARTITION_SIZE = 1024U * 1024U;
+
+struct Flash {
+    esp_partition_t partitions[2U];
+    std::vector<uint8_t> data[2U];
+    uint8_t running; // Index of the partition the application runs from
+    uint8_t boot;    // Index of the partition that will be booted next
+    uint32_t violations;
+    uint32_t erased_sectors;
+    uint32_t written_bytes;
+};
+
+inline Flash& flash() {
+    static Flash instance = { { { 0x10000U, PARTITION_SIZE, "app0" }, { 0x110000U, PARTITION_SIZE, "app1" } }, {}, 0U, 0U, 0U, 0U, 0U };
+    return instance;
+}
+
+/// @brief Fills both partitions with the given value, like data left behind by previous images, and clears the counters
+inline void reset(const uint8_t& fill = 0xFFU) {
+    Flash& state = flash();
+    for (std::vector<uint8_t>& partition : state.data) {
+        partition.assign(PARTITION_SIZE, fill);
+    }
+    state.running = 0U;
+    state.boot = 0U;
+    state.violations = 0U;
+    state.erased_sectors = 0U;
+    state.written_bytes = 0U;
+}
+
+inline std::vector<uint8_t> *content(const esp_partition_t *partition) {
+    Flash& state = flash();
+    for (uint8_t i = 0U; i < 2U; i++) {
+        if (partition == &state.partitions[i]) {
+            if (state.data[i].empty()) {
+                state.data[i].assign(PARTITION_SIZE, 0xFFU);
+            }
+            return &state.data[i];
+        }
+    }
+    return nullptr;
+}
+
+} // namespace host_flash
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size) {
+    std::vector<uint8_t> *data = host_flash::content(partition);
+    if (data == nullptr || offset + size > data->size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (offset % host_flash::SECTOR_SIZE != 0U || size % host_flash::SECTOR_SIZE != 0U) {
+        host_flash::flash().violations++;
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(data->data() + offset, 0xFF, size);
+    host_flash::flash().erased_sectors += size / host_flash::SECTOR_SIZE;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t *partition, size_t offset, const void *source, size_t size) {
+    std::vector<uint8_t> *data = host_flash::content(partition);
+    if (data == nullptr || offset + size > data->size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(source);
+    for (size_t i = 0U; i < size; i++) {
+        uint8_t& cell = (*data)[offset + i];
+        if ((cell & bytes[i]) != bytes[i]) {
+            host_flash::flash().violations++;
+        }
+        cell &= bytes[i];
+    }
+    host_flash::flash().written_bytes += size;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t *partition, size_t offset, void *destination, size_t size) {
+    std::vector<uint8_t> *data = host_flash::content(partition);
+    if (data == nullptr || offset + size > data->size()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(destination, data->data() + offset, size);
+    return ESP_OK;
+}
+
+#endif // HOST_ESP_PARTITION_H
@@ -0,0 +1,9 @@
+#ifndef HOST_ESP_SPI_FLASH_H
+#define HOST_ESP_SPI_FLASH_H
+
+// Host stand-in for the flash geometry of the ESP-IDF, see esp_partition.h for the simulated flash itself
+#include "esp_partition.h"
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+#endif // HOST_ESP_SPI_FLASH_H
@@ -0,0 +1,187 @@
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+// Host stand-in for the subset of the FreeRTOS API used by the libraries, built on pthreads.
+// Semaphores are queues without item data, like in FreeRTOS itself, and one tick is one millisecond.
+
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define errQUEUE_FULL 0
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFUL)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms) / portTICK_PERIOD_MS)
+
+struct QueueDefinition {
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t length;
+    UBaseType_t item_size;
+    // Recursive mutexes only
+    std::thread::id owner;
+    UBaseType_t depth = 0U;
+};
+typedef QueueDefinition *QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+
+struct tskTaskControlBlock {
+    TaskFunction_t function = nullptr;
+    void *parameter = nullptr;
+};
+typedef tskTaskControlBlock *TaskHandle_t;
+
+namespace host_freertos {
+
+inline std::chrono::steady_clock::time_point start_time() {
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return start;
+}
+
+// Waits until the predicate holds or the given amount of ticks passed, portMAX_DELAY waits forever
+template <typename Predicate>
+inline bool wait(QueueHandle_t queue, std::unique_lock<std::mutex>& lock, const TickType_t& ticks, Predicate predicate) {
+    if (ticks == portMAX_DELAY) {
+        queue->changed.wait(lock, predicate);
+        return true;
+    }
+    return queue->changed.wait_for(lock, std::chrono::milliseconds(ticks), predicate);
+}
+
+// Task control block of the calling thread, threads not created with xTaskCreate receive their own block as well
+inline TaskHandle_t& current_task() {
+    static thread_local tskTaskControlBlock own_block;
+    static thread_local TaskHandle_t current = &own_block;
+    return current;
+}
+
+// Tasks created with xTaskCreate that have not been deleted yet
+inline std::atomic<UBaseType_t>& created_tasks() {
+    static std::atomic<UBaseType_t> count(0U);
+    return count;
+}
+
+inline void *task_entry(void *arg) {
+    // Freed once the thread exits, either by returning or by calling vTaskDelete(nullptr)
+    static thread_local std::unique_ptr<tskTaskControlBlock> block;
+    block.reset(static_cast<TaskHandle_t>(arg));
+    current_task() = block.get();
+    block->function(block->parameter);
+    created_tasks()--;
+    return nullptr;
+}
+
+} // namespace host_freertos
+
+inline TickType_t xTaskGetTickCount() {
+    return static_cast<TickType_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - host_freertos::start_time()).count());
+}
+
+inline QueueHandle_t xQueueCreate(const UBaseType_t& length, const UBaseType_t& item_size) {
+    QueueHandle_t queue = new QueueDefinition();
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+inline void vQueueDelete(QueueHandle_t queue) {
+    delete queue;
+}
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void *item, const TickType_t& ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!host_freertos::wait(queue, lock, ticks, [queue] { return queue->items.size() < queue->length; })) {
+        return errQUEUE_FULL;
+    }
+    const uint8_t *bytes = static_cast<const uint8_t *>(item);
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void *item, const TickType_t& ticks) {
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!host_freertos::wait(queue, lock, ticks, [queue] { return !queue->items.empty(); })) {
+        return pdFALSE;
+    }
+    if (queue->item_size > 0U) {
+        memcpy(item, queue->items.front().data(), queue->item_size);
+    }
+    queue->items.pop_front();
+    queue->changed.notify_all();
+    return pdTRUE;
+}
+
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->items.size();
+}
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char *name, const uint32_t& stack_depth, void *parameter, const UBaseType_t& priority, TaskHandle_t *created_task) {
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    TaskHandle_t block = new tskTaskControlBlock();
+    block->function = function;
+    block->parameter = parameter;
+    pthread_t thread;
+    host_freertos::created_tasks()++;
+    if (pthread_create(&thread, nullptr, &host_freertos::task_entry, block) != 0) {
+        host_freertos::created_tasks()--;
+        delete block;
+        return pdFAIL;
+    }
+    pthread_detach(thread);
+    if (created_task != nullptr) {
+        *created_task = block;
+    }
+    return pdPASS;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, const uint32_t& stack_depth, void *parameter, const UBaseType_t& priority, TaskHandle_t *created_task, const BaseType_t& core) {
+    (void)core;
+    return xTaskCreate(function, name, stack_depth, parameter, priority, created_task);
+}
+
+// Only deleting the calling task is supported, like every task of the libraries does before returning
+inline void vTaskDelete(TaskHandle_t task) {
+    (void)task;
+    host_freertos::created_tasks()--;
+    pthread_exit(nullptr);
+}
+
+// Only counts the tasks created with xTaskCreate, there are no idle or timer tasks on the host
+inline UBaseType_t uxTaskGetNumberOfTasks() {
+    return host_freertos::created_tasks();
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return host_freertos::current_task();
+}
+
+inline void vTaskDelay(const TickType_t& ticks) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks * portTICK_PERIOD_MS));
+}
+
+#define taskYIELD() std::this_thread::yield()
+
+#endif // HOST_FREERTOS_H
@@ -0,0 +1,69 @@
+#ifndef HOST_FREERTOS_SEMPHR_H
+#define HOST_FREERTOS_SEMPHR_H
+
+#include "FreeRTOS.h"
+
+inline SemaphoreHandle_t xSemaphoreCreateCounting(const UBaseType_t& max_count, const UBaseType_t& initial_count) {
+    SemaphoreHandle_t semaphore = xQueueCreate(max_count, 0U);
+    for (UBaseType_t i = 0U; i < initial_count; i++) {
+        semaphore->items.emplace_back();
+    }
+    return semaphore;
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xSemaphoreCreateCounting(1U, 0U);
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return xSemaphoreCreateCounting(1U, 1U);
+}
+
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+    return xSemaphoreCreateMutex();
+}
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, const TickType_t& ticks) {
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0U);
+}
+
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, const TickType_t& ticks) {
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->depth > 0U && semaphore->owner == std::this_thread::get_id()) {
+            semaphore->depth++;
+            return pdTRUE;
+        }
+    }
+    if (xSemaphoreTake(semaphore, ticks) != pdTRUE) {
+        return pdFALSE;
+    }
+    std::lock_guard<std::mutex> lock(semaphore->mutex);
+    semaphore->owner = std::this_thread::get_id();
+    semaphore->depth = 1U;
+    return pdTRUE;
+}
+
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore) {
+    {
+        std::lock_guard<std::mutex> lock(semaphore->mutex);
+        if (semaphore->depth == 0U || semaphore->owner != std::this_thread::get_id()) {
+            return pdFALSE;
+        }
+        if (--semaphore->depth > 0U) {
+            return pdTRUE;
+        }
+        semaphore->owner = std::thread::id();
+    }
+    return xSemaphoreGive(semaphore);
+}
+
+inline void vSemaphoreDelete(SemaphoreHandle_t semaphore) {
+    vQueueDelete(semaphore);
+}
+
+#endif // HOST_FREERTOS_SEMPHR_H
@@ -0,0 +1,10 @@
+#ifndef HOST_LWIP_SOCKETS_H
+#define HOST_LWIP_SOCKETS_H
+
+// lwIP offers the BSD socket API, on the host the system sockets are used directly
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#endif // HOST_LWIP_SOCKETS_H
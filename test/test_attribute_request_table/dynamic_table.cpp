@@ -0,0 +1,93 @@
+// Growth of Attribute_Request_Table with THINGSBOARD_ENABLE_DYNAMIC, which has to be set before the library is included.
+// Only the table itself is used here and with another inline capacity than in test_main.cpp, so both files never instantiate the same class
+#define THINGSBOARD_ENABLE_DYNAMIC 1
+#include <unity.h>
+#include <Attribute_Request_Table.h>
+#include <stdint.h>
+
+namespace {
+
+using Table = Attribute_Request_Table<1U>;
+
+const char *const RESPONSE_KEYS[] = { "client", "shared" };
+
+/// @brief Callback whose only attribute names it, so a taken callback can be told apart from the others
+Attribute_Request_Callback tagged(const char *const *tag) {
+    return Attribute_Request_Callback([](const Attribute_Data& data) { (void)data; }, tag, tag + 1U);
+}
+
+/// @brief Takes the next callback stored under the given request id and checks that it is the expected one
+void expect_taken(Table& table, const size_t& request_id, const char *tag, const char *response_key) {
+    Attribute_Request_Callback taken;
+    TEST_ASSERT_TRUE(table.take(request_id, taken));
+    TEST_ASSERT_EQUAL_STRING(tag, taken.Get_Attributes().front());
+    TEST_ASSERT_EQUAL_STRING(response_key, taken.Get_Attribute_Key());
+}
+
+} // namespace
+
+// A table without reserved slots grows with every request that does not fit, pending requests keep their callbacks and their scopes
+void test_growth_keeps_pending_requests(void) {
+    const char *const TAGS[] = { "r0", "r1", "r2", "r3", "r4", "r5", "r6", "r7", "r8", "r9" };
+    constexpr size_t REQUESTS = sizeof(TAGS) / sizeof(TAGS[0]) / 2U;
+
+    Table table;
+    TEST_ASSERT_EQUAL_UINT32(0U, table.capacity());
+    size_t id = 0U;
+    size_t ids[REQUESTS];
+    for (size_t i = 0U; i < REQUESTS; i++) {
+        const Attribute_Request_Callback client = tagged(&TAGS[2U * i]);
+        const Attribute_Request_Callback shared = tagged(&TAGS[2U * i + 1U]);
+        const Attribute_Request_Callback *both[] = { &client, &shared };
+        TEST_ASSERT_TRUE(table.insert(both, RESPONSE_KEYS, 2U, id));
+        ids[i] = id;
+    }
+    TEST_ASSERT_EQUAL_UINT32(2U * REQUESTS, table.size());
+    TEST_ASSERT_TRUE(table.capacity() >= 2U * REQUESTS);
+
+    for (size_t i = REQUESTS; i-- > 0U;) {
+        expect_taken(table, ids[i], TAGS[2U * i], "client");
+        expect_taken(table, ids[i], TAGS[2U * i + 1U], "shared");
+    }
+    TEST_ASSERT_TRUE(table.empty());
+}
+
+// Growing while pending request ids wrap around from the largest id to 1, with amounts of slots that are not a power of two
+void test_growth_across_wrapped_ids(void) {
+    const char *const BEFORE[] = { "before" };
+    const char *const CLIENT[] = { "client" };
+    const char *const SHARED[] = { "shared" };
+    const char *const AFTER[] = { "after" };
+    const Attribute_Request_Callback before = tagged(BEFORE);
+    const Attribute_Request_Callback client = tagged(CLIENT);
+    const Attribute_Request_Callback shared = tagged(SHARED);
+    const Attribute_Request_Callback after = tagged(AFTER);
+    const Attribute_Request_Callback *single[] = { &before };
+    const Attribute_Request_Callback *both[] = { &client, &shared };
+    const Attribute_Request_Callback *wrapped[] = { &after };
+
+    Table table;
+    size_t id = SIZE_MAX - 2U;
+    TEST_ASSERT_TRUE(table.insert(single, RESPONSE_KEYS + 1U, 1U, id));
+    TEST_ASSERT_TRUE(id == SIZE_MAX - 1U);
+    TEST_ASSERT_EQUAL_UINT32(1U, table.capacity());
+
+    // Grows to 3 slots, the second scope of the largest id lies behind the wrap
+    TEST_ASSERT_TRUE(table.insert(both, RESPONSE_KEYS, 2U, id));
+    TEST_ASSERT_TRUE(id == SIZE_MAX);
+    TEST_ASSERT_EQUAL_UINT32(3U, table.capacity());
+
+    // Every slot is taken, so the first id after the wrap grows the table again
+    TEST_ASSERT_TRUE(table.insert(wrapped, RESPONSE_KEYS + 1U, 1U, id));
+    TEST_ASSERT_TRUE(id == 1U);
+    TEST_ASSERT_TRUE(table.capacity() > 3U);
+    TEST_ASSERT_EQUAL_UINT32(4U, table.size());
+
+    expect_taken(table, 1U, "after", "shared");
+    expect_taken(table, SIZE_MAX, "client", "client");
+    expect_taken(table, SIZE_MAX, "shared", "shared");
+    expect_taken(table, SIZE_MAX - 1U, "before", "shared");
+    Attribute_Request_Callback taken;
+    TEST_ASSERT_FALSE(table.take(SIZE_MAX, taken));
+    TEST_ASSERT_TRUE(table.empty());
+}
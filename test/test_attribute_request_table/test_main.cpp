@@ -0,0 +1,261 @@
+// Client-side and shared attribute requests correlated through Attribute_Request_Table: every response has to reach the callbacks of its own request,
+// split into the requested scopes, and slots have to be freed again once their request is answered or could not be sent.
+// The growth of the table with THINGSBOARD_ENABLE_DYNAMIC is tested in dynamic_table.cpp, because the option has to be set before the library is included
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <Loopback_MQTT_Client.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t SLOTS = 4U;
+constexpr uint16_t BUFFER_SIZE = 256U;
+constexpr char REQUEST_TOPIC[] = "v1/devices/me/attributes/request/";
+constexpr char RESPONSE_TOPIC[] = "v1/devices/me/attributes/response/";
+constexpr const char *KEYS[] = { "fw_version" };
+
+/// @brief Records the log messages instead of printing them, a full table is only reported over the log
+struct Recording_Logger {
+    static std::vector<std::string> messages;
+    static void log(const char *message) {
+        messages.push_back(message);
+    }
+};
+std::vector<std::string> Recording_Logger::messages;
+
+using Thingsboard = ThingsBoardSized<SLOTS, Recording_Logger>;
+using Table = Attribute_Request_Table<3U>;
+
+/// @brief Broker that loses every published message while publish_fails is set, like a connection that broke down after subscribing
+class Failing_MQTT_Client : public Loopback_MQTT_Client {
+  public:
+    bool publish_fails = false;
+
+    bool publish(const char *topic, const uint8_t *payload, const size_t& length) override {
+        return !publish_fails && Loopback_MQTT_Client::publish(topic, payload, length);
+    }
+};
+
+std::vector<std::string> received;
+
+/// @brief Callback that records its name together with the attributes it received, "null" if its scope was missing
+Attribute_Request_Callback record(const std::string& name) {
+    return Attribute_Request_Callback([name](const Attribute_Data& data) {
+        std::string json;
+        serializeJson(data, json);
+        received.push_back(name + "=" + json);
+    }, std::begin(KEYS), std::end(KEYS));
+}
+
+/// @brief Request id of the n-th attribute request, counted from 0
+std::string request_id(Loopback_MQTT_Client& client, const size_t& number) {
+    const std::vector<Loopback_MQTT_Client::Message> requests = client.published(REQUEST_TOPIC);
+    TEST_ASSERT_TRUE(number < requests.size());
+    return requests[number].topic.substr(strlen(REQUEST_TOPIC));
+}
+
+/// @brief Answers the request with the given id, like the server does once it read the requested attributes
+void respond(Thingsboard& tb, Loopback_MQTT_Client& client, const std::string& id, const std::string& payload) {
+    client.inject((RESPONSE_TOPIC + id).c_str(), payload);
+    tb.loop();
+}
+
+/// @brief Table callback whose only attribute names it, so a taken callback can be told apart from the others
+Attribute_Request_Callback tagged(const char *const *tag) {
+    return Attribute_Request_Callback([](const Attribute_Data& data) { (void)data; }, tag, tag + 1U);
+}
+
+} // namespace
+
+// Growth of the table with THINGSBOARD_ENABLE_DYNAMIC, see dynamic_table.cpp
+void test_growth_keeps_pending_requests(void);
+void test_growth_across_wrapped_ids(void);
+
+void setUp(void) {
+    Recording_Logger::messages.clear();
+    received.clear();
+}
+
+void tearDown(void) {}
+
+// A full static table refuses further requests without sending them, a response frees its slot for the next request
+void test_full_static_table(void) {
+    Loopback_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE);
+    TEST_ASSERT_TRUE(tb.connect("localhost", "token"));
+
+    for (size_t i = 0U; i < SLOTS; i++) {
+        TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request" + std::to_string(i))));
+    }
+    TEST_ASSERT_FALSE(tb.Shared_Attributes_Request(record("refused")));
+    TEST_ASSERT_EQUAL_UINT32(SLOTS, client.published(REQUEST_TOPIC).size());
+    TEST_ASSERT_EQUAL_UINT32(1U, Recording_Logger::messages.size());
+    TEST_ASSERT_EQUAL_STRING(MAX_SHARED_ATT_REQUEST_EXCEEDED, Recording_Logger::messages.front().c_str());
+
+    // A request for two scopes needs two free slots next to each other
+    respond(tb, client, request_id(client, 0U), "{\"shared\":{\"fw_version\":\"1.0\"}}");
+    TEST_ASSERT_FALSE(tb.Client_Shared_Attributes_Request(record("client"), record("shared")));
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request4")));
+    TEST_ASSERT_EQUAL_UINT32(SLOTS + 1U, client.published(REQUEST_TOPIC).size());
+}
+
+// Responses arriving in a different order than their requests still reach their own callback,
+// the id of the next request skips ids whose slot is still taken by an unanswered request
+void test_out_of_order_responses(void) {
+    Loopback_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE);
+    TEST_ASSERT_TRUE(tb.connect("localhost", "token"));
+
+    for (size_t i = 0U; i < SLOTS; i++) {
+        TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request" + std::to_string(i))));
+    }
+    respond(tb, client, request_id(client, 2U), "{\"shared\":{\"fw_version\":\"2\"}}");
+    respond(tb, client, request_id(client, 0U), "{\"shared\":{\"fw_version\":\"0\"}}");
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request4")));
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request5")));
+    TEST_ASSERT_FALSE(tb.Shared_Attributes_Request(record("refused")));
+    respond(tb, client, request_id(client, 5U), "{\"shared\":{\"fw_version\":\"5\"}}");
+    respond(tb, client, request_id(client, 3U), "{\"shared\":{\"fw_version\":\"3\"}}");
+    respond(tb, client, request_id(client, 1U), "{\"shared\":{\"fw_version\":\"1\"}}");
+    respond(tb, client, request_id(client, 4U), "{\"shared\":{\"fw_version\":\"4\"}}");
+
+    const std::vector<std::string> expected = {
+        "request2={\"fw_version\":\"2\"}", "request0={\"fw_version\":\"0\"}", "request5={\"fw_version\":\"5\"}",
+        "request3={\"fw_version\":\"3\"}", "request1={\"fw_version\":\"1\"}", "request4={\"fw_version\":\"4\"}"
+    };
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), received.size());
+    for (size_t i = 0U; i < expected.size(); i++) {
+        TEST_ASSERT_EQUAL_STRING(expected[i].c_str(), received[i].c_str());
+    }
+
+    // Every request id was only handed out once, a second response to an answered request is ignored
+    for (size_t i = 0U; i < 6U; i++) {
+        for (size_t j = 0U; j < i; j++) {
+            TEST_ASSERT_TRUE(request_id(client, i) != request_id(client, j));
+        }
+    }
+    respond(tb, client, request_id(client, 4U), "{\"shared\":{\"fw_version\":\"4\"}}");
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), received.size());
+}
+
+// A request for both scopes is sent once with both key lists, its response is split into the client and the shared scope
+void test_two_scope_response(void) {
+    Loopback_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE);
+    TEST_ASSERT_TRUE(tb.connect("localhost", "token"));
+
+    TEST_ASSERT_TRUE(tb.Client_Shared_Attributes_Request(record("client"), record("shared")));
+    const std::vector<Loopback_MQTT_Client::Message> requests = client.published(REQUEST_TOPIC);
+    TEST_ASSERT_EQUAL_UINT32(1U, requests.size());
+    TEST_ASSERT_EQUAL_STRING("{\"clientKeys\":\"fw_version\",\"sharedKeys\":\"fw_version\"}", requests.front().payload.c_str());
+
+    respond(tb, client, request_id(client, 0U), "{\"client\":{\"fw_version\":\"1.0\"},\"shared\":{\"fw_version\":\"1.1\"}}");
+    TEST_ASSERT_EQUAL_UINT32(2U, received.size());
+    TEST_ASSERT_EQUAL_STRING("client={\"fw_version\":\"1.0\"}", received[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("shared={\"fw_version\":\"1.1\"}", received[1].c_str());
+
+    // Both slots are free again
+    for (size_t i = 0U; i < SLOTS / 2U; i++) {
+        TEST_ASSERT_TRUE(tb.Client_Shared_Attributes_Request(record("client"), record("shared")));
+    }
+}
+
+// The server leaves out a scope without any of the requested attributes, its callback receives a null object instead of the other scope,
+// while a request for a single scope receives the whole payload if it does not contain the scope key
+void test_missing_scope(void) {
+    Loopback_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE);
+    TEST_ASSERT_TRUE(tb.connect("localhost", "token"));
+
+    TEST_ASSERT_TRUE(tb.Client_Shared_Attributes_Request(record("client"), record("shared")));
+    respond(tb, client, request_id(client, 0U), "{\"shared\":{\"fw_version\":\"1.1\"}}");
+    TEST_ASSERT_EQUAL_UINT32(2U, received.size());
+    TEST_ASSERT_EQUAL_STRING("client=null", received[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("shared={\"fw_version\":\"1.1\"}", received[1].c_str());
+
+    TEST_ASSERT_TRUE(tb.Client_Attributes_Request(record("single")));
+    respond(tb, client, request_id(client, 1U), "{\"fw_version\":\"1.0\"}");
+    TEST_ASSERT_EQUAL_UINT32(3U, received.size());
+    TEST_ASSERT_EQUAL_STRING("single={\"fw_version\":\"1.0\"}", received[2].c_str());
+}
+
+// A request that could not be published is never answered, so its slots are freed immediately instead of filling up the table
+void test_publish_failure_frees_slots(void) {
+    Failing_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE);
+    TEST_ASSERT_TRUE(tb.connect("localhost", "token"));
+
+    client.publish_fails = true;
+    for (size_t i = 0U; i < 2U * SLOTS; i++) {
+        TEST_ASSERT_FALSE(tb.Shared_Attributes_Request(record("lost")));
+        TEST_ASSERT_FALSE(tb.Client_Shared_Attributes_Request(record("client"), record("shared")));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, client.published(REQUEST_TOPIC).size());
+
+    client.publish_fails = false;
+    for (size_t i = 0U; i < SLOTS; i++) {
+        TEST_ASSERT_TRUE(tb.Shared_Attributes_Request(record("request" + std::to_string(i))));
+    }
+    for (size_t i = 0U; i < SLOTS; i++) {
+        respond(tb, client, request_id(client, i), "{\"shared\":{\"fw_version\":\"1.0\"}}");
+    }
+    TEST_ASSERT_EQUAL_UINT32(SLOTS, received.size());
+    TEST_ASSERT_TRUE(Recording_Logger::messages.empty());
+}
+
+// Request ids wrap around to 1 after the largest id, 0 is skipped because it marks free slots.
+// A request for two scopes that straddles the wrap has to keep both of its slots, even if the amount of slots is not a power of two
+void test_wrapped_ids(void) {
+    const char *const FIRST[] = { "first" };
+    const char *const SECOND[] = { "second" };
+    const char *const THIRD[] = { "third" };
+    const Attribute_Request_Callback first = tagged(FIRST);
+    const Attribute_Request_Callback second = tagged(SECOND);
+    const Attribute_Request_Callback third = tagged(THIRD);
+    const Attribute_Request_Callback *both[] = { &first, &second };
+    const Attribute_Request_Callback *single[] = { &third };
+    const char *const response_keys[] = { "client", "shared" };
+
+    Table table;
+    table.reserve(3U);
+    TEST_ASSERT_EQUAL_UINT32(3U, table.capacity());
+    size_t id = SIZE_MAX - 1U;
+    TEST_ASSERT_TRUE(table.insert(both, response_keys, 2U, id));
+    TEST_ASSERT_TRUE(id == SIZE_MAX);
+    // Slot 1 still holds the second scope of the previous request
+    TEST_ASSERT_TRUE(table.insert(single, response_keys + 1U, 1U, id));
+    TEST_ASSERT_TRUE(id == 2U);
+    const size_t wrapped = id;
+    TEST_ASSERT_EQUAL_UINT32(3U, table.size());
+    TEST_ASSERT_FALSE(table.insert(single, response_keys, 1U, id));
+    TEST_ASSERT_TRUE(id == wrapped);
+
+    Attribute_Request_Callback taken;
+    TEST_ASSERT_TRUE(table.take(SIZE_MAX, taken));
+    TEST_ASSERT_EQUAL_STRING("first", taken.Get_Attributes().front());
+    TEST_ASSERT_EQUAL_STRING("client", taken.Get_Attribute_Key());
+    TEST_ASSERT_TRUE(table.take(SIZE_MAX, taken));
+    TEST_ASSERT_EQUAL_STRING("second", taken.Get_Attributes().front());
+    TEST_ASSERT_EQUAL_STRING("shared", taken.Get_Attribute_Key());
+    TEST_ASSERT_FALSE(table.take(SIZE_MAX, taken));
+    TEST_ASSERT_FALSE(table.take(0U, taken));
+    TEST_ASSERT_TRUE(table.take(wrapped, taken));
+    TEST_ASSERT_EQUAL_STRING("third", taken.Get_Attributes().front());
+    TEST_ASSERT_TRUE(table.empty());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_full_static_table);
+    RUN_TEST(test_out_of_order_responses);
+    RUN_TEST(test_two_scope_response);
+    RUN_TEST(test_missing_scope);
+    RUN_TEST(test_publish_failure_frees_slots);
+    RUN_TEST(test_wrapped_ids);
+    RUN_TEST(test_growth_keeps_pending_requests);
+    RUN_TEST(test_growth_across_wrapped_ids);
+    return UNITY_END();
+}
@@ -0,0 +1,230 @@
+// BootValidator across simulated boots with a fake partition table: two app slots, the boot selection that survives restarts
+// and a bootloader that falls back to the other slot when an image does not start. NVS survives every boot, RTC memory only resets
+#include <unity.h>
+#include <BootValidator.h>
+
+namespace {
+
+constexpr uint32_t SLOT_0 = 0x10000U;
+constexpr uint32_t SLOT_1 = 0x110000U;
+constexpr uint8_t PROBES = BOOT_PROBE_MQTT | BOOT_PROBE_TELEMETRY;
+
+/// @brief Partition table, otadata and NVS of the device
+class Fake_Partition_Table : public BootPlatform {
+  public:
+    uint32_t boot = SLOT_0;
+    uint32_t running = SLOT_0;
+    bool broken[2U] = { false, false }; // Slot does not hold a bootable image
+    bool valid_marked = false;
+    uint32_t restarts = 0U;
+    uint32_t saves = 0U;
+    bool save_fails = false;
+    BootRecord nvs = {};
+    bool has_record = false;
+
+    uint32_t runningPartition() override { return running; }
+
+    bool setBootPartition(uint32_t address) override {
+        if (broken[slot(address)]) {
+            return false;
+        }
+        boot = address;
+        return true;
+    }
+
+    void markValid() override { valid_marked = true; }
+
+    // The device never returns from here, the test starts the next boot itself
+    void restart() override { restarts++; }
+
+    bool loadRecord(BootRecord& record) override {
+        if (has_record) {
+            record = nvs;
+        }
+        return has_record;
+    }
+
+    bool saveRecord(const BootRecord& record) override {
+        if (save_fails) {
+            return false;
+        }
+        saves++;
+        nvs = record;
+        has_record = true;
+        return true;
+    }
+
+    /// @brief Starts the selected slot, the bootloader falls back to the other one when it holds no valid image
+    void power_on() {
+        running = broken[slot(boot)] ? other(boot) : boot;
+    }
+
+    static uint8_t slot(const uint32_t& address) { return address == SLOT_0 ? 0U : 1U; }
+    static uint32_t other(const uint32_t& address) { return address == SLOT_0 ? SLOT_1 : SLOT_0; }
+};
+
+Fake_Partition_Table table;
+BootAttempts rtc;
+BootValidator *validator = nullptr;
+
+/// @brief Restart of the device: only NVS, otadata and RTC memory keep their content
+BootState boot_up(const uint32_t& now = 0U) {
+    delete validator;
+    validator = new BootValidator(table, rtc);
+    table.power_on();
+    return validator->begin(PROBES, now);
+}
+
+/// @brief OTA wrote the given version into the other slot and selected it, like finishOta()
+void install(const char *version) {
+    const uint32_t target = Fake_Partition_Table::other(table.running);
+    TEST_ASSERT_TRUE(table.setBootPartition(target));
+    TEST_ASSERT_TRUE(validator->markPending(target, "fw", version));
+}
+
+} // namespace
+
+void setUp(void) {
+    table = Fake_Partition_Table();
+    // RTC memory is not initialised on power on
+    memset(&rtc, 0xA5, sizeof(rtc));
+    TEST_ASSERT_EQUAL(BOOT_NORMAL, boot_up());
+}
+
+void tearDown(void) {
+    delete validator;
+    validator = nullptr;
+}
+
+// The new image is confirmed once every required probe reported in time, the bootloader rollback is cancelled
+void test_confirms_healthy_image(void) {
+    install("2");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up(1000U));
+    TEST_ASSERT_EQUAL_HEX32(SLOT_1, table.running);
+    validator->report(BOOT_PROBE_MQTT);
+    validator->report(BOOT_PROBE_SENSORS);
+    TEST_ASSERT_EQUAL(BOOT_PENDING, validator->poll(2000U));
+    TEST_ASSERT_EQUAL_UINT8(BOOT_PROBE_TELEMETRY, validator->getMissingProbes());
+    validator->report(BOOT_PROBE_TELEMETRY);
+    TEST_ASSERT_EQUAL(BOOT_CONFIRMED, validator->poll(3000U));
+    TEST_ASSERT_TRUE(table.valid_marked);
+    TEST_ASSERT_TRUE(validator->isInstalled("fw", "2"));
+    TEST_ASSERT_FALSE(validator->isInstalled("fw", "1"));
+
+    TEST_ASSERT_EQUAL(BOOT_NORMAL, boot_up());
+    TEST_ASSERT_TRUE(validator->isInstalled("fw", "2"));
+    TEST_ASSERT_EQUAL_STRING("2", validator->getVersion());
+    TEST_ASSERT_EQUAL_UINT32(0U, table.restarts);
+}
+
+// Missing probes at the deadline roll back to the previous slot, also when the deadline wraps around the millisecond counter
+void test_deadline_rolls_back(void) {
+    constexpr uint32_t BOOTED_AT = 0xFFFFF000U;
+    install("3");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up(BOOTED_AT));
+    validator->report(BOOT_PROBE_MQTT);
+    TEST_ASSERT_EQUAL(BOOT_PENDING, validator->poll(BOOTED_AT + OTA_BOOT_DEADLINE - 1U));
+    TEST_ASSERT_EQUAL(BOOT_ROLLED_BACK, validator->poll(BOOTED_AT + OTA_BOOT_DEADLINE));
+    TEST_ASSERT_EQUAL_UINT32(1U, table.restarts);
+    TEST_ASSERT_EQUAL_HEX32(SLOT_0, table.boot);
+    TEST_ASSERT_FALSE(table.valid_marked);
+
+    // The rejected firmware is remembered until and after the rollback was reported
+    TEST_ASSERT_EQUAL(BOOT_ROLLED_BACK, boot_up());
+    TEST_ASSERT_EQUAL_HEX32(SLOT_0, table.running);
+    TEST_ASSERT_TRUE(validator->isRejected("fw", "3"));
+    validator->acknowledge();
+    TEST_ASSERT_EQUAL(BOOT_NORMAL, boot_up());
+    TEST_ASSERT_TRUE(validator->isRejected("fw", "3"));
+    TEST_ASSERT_FALSE(validator->isRejected("fw", "4"));
+}
+
+// An image that keeps crashing before the deadline is rolled back by the boot counter in RTC memory
+void test_crash_loop_rolls_back(void) {
+    install("4");
+    for (uint8_t attempt = 1U; attempt <= OTA_BOOT_MAX_ATTEMPTS; attempt++) {
+        TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+        TEST_ASSERT_EQUAL_UINT32(attempt, rtc.count);
+    }
+    TEST_ASSERT_EQUAL(BOOT_ROLLED_BACK, boot_up());
+    TEST_ASSERT_EQUAL_UINT32(1U, table.restarts);
+    TEST_ASSERT_EQUAL(BOOT_ROLLED_BACK, boot_up());
+    TEST_ASSERT_EQUAL_HEX32(SLOT_0, table.running);
+    TEST_ASSERT_TRUE(validator->isRejected("fw", "4"));
+}
+
+// A power cycle clears RTC memory: the garbage is detected and counting starts over instead of rolling back
+void test_power_cycle_restarts_count(void) {
+    install("5");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    TEST_ASSERT_EQUAL_UINT32(2U, rtc.count);
+    memset(&rtc, 0xA5, sizeof(rtc));
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    TEST_ASSERT_EQUAL_UINT32(1U, rtc.count);
+
+    // A count left behind for another image does not count either
+    rtc.target = SLOT_0;
+    rtc.check = ~(rtc.target ^ rtc.count);
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    TEST_ASSERT_EQUAL_UINT32(1U, rtc.count);
+}
+
+// The bootloader could not start the new image and fell back to the old slot by itself
+void test_bootloader_fallback(void) {
+    install("6");
+    table.broken[Fake_Partition_Table::slot(table.boot)] = true;
+    TEST_ASSERT_EQUAL(BOOT_ROLLED_BACK, boot_up());
+    TEST_ASSERT_EQUAL_HEX32(SLOT_0, table.running);
+    TEST_ASSERT_TRUE(validator->isRejected("fw", "6"));
+    TEST_ASSERT_EQUAL_UINT32(0U, table.restarts);
+}
+
+// Without a bootable previous image the new one is kept instead of restarting forever
+void test_keeps_image_without_fallback(void) {
+    install("7");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    table.broken[Fake_Partition_Table::slot(SLOT_0)] = true;
+    TEST_ASSERT_EQUAL(BOOT_CONFIRMED, validator->poll(OTA_BOOT_DEADLINE));
+    TEST_ASSERT_TRUE(validator->isInstalled("fw", "7"));
+    TEST_ASSERT_EQUAL_UINT32(0U, table.restarts);
+    TEST_ASSERT_EQUAL(BOOT_NORMAL, boot_up());
+}
+
+// Confirming is retried while NVS cannot be written, a later poll still confirms before the deadline
+void test_confirm_retried_when_nvs_fails(void) {
+    install("8");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    validator->report(PROBES);
+    table.save_fails = true;
+    TEST_ASSERT_EQUAL(BOOT_PENDING, validator->poll(1000U));
+    TEST_ASSERT_FALSE(table.valid_marked);
+    table.save_fails = false;
+    TEST_ASSERT_EQUAL(BOOT_CONFIRMED, validator->poll(2000U));
+    TEST_ASSERT_TRUE(table.valid_marked);
+}
+
+// Firmware written to the running slot another way (serial flashing) invalidates the stored record
+void test_record_of_other_image_is_dropped(void) {
+    install("9");
+    TEST_ASSERT_EQUAL(BOOT_PENDING, boot_up());
+    validator->report(PROBES);
+    TEST_ASSERT_EQUAL(BOOT_CONFIRMED, validator->poll(1000U));
+    table.boot = SLOT_0;
+    TEST_ASSERT_EQUAL(BOOT_NORMAL, boot_up());
+    TEST_ASSERT_FALSE(validator->isInstalled("fw", "9"));
+    TEST_ASSERT_EQUAL_STRING("", validator->getTitle());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_confirms_healthy_image);
+    RUN_TEST(test_deadline_rolls_back);
+    RUN_TEST(test_crash_loop_rolls_back);
+    RUN_TEST(test_power_cycle_restarts_count);
+    RUN_TEST(test_bootloader_fallback);
+    RUN_TEST(test_keeps_image_without_fallback);
+    RUN_TEST(test_confirm_retried_when_nvs_fails);
+    RUN_TEST(test_record_of_other_image_is_dropped);
+    return UNITY_END();
+}
@@ -0,0 +1,204 @@
+// Buffered_Updater in front of a simulated slow flash: the network handler only copies into the ping-pong buffers while the writer task
+// erases and programs, so receiving the next chunk overlaps the flash write. Compared against writing the same flash directly
+#include <unity.h>
+#include <Buffered_Updater.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t IMAGE_SIZE = 64U * 1024U + 123U;
+constexpr size_t SECTOR_SIZE = 4096U;
+constexpr uint32_t ERASE_MS = 20U;
+
+typedef std::chrono::steady_clock Clock;
+
+std::vector<uint8_t> image;
+
+/// @brief Flash that takes ERASE_MS to erase every new sector and 1 ms per KiB to program, close to the SPI flash of the ESP32
+class Slow_Flash : public IUpdater {
+  public:
+    std::vector<uint8_t> data;
+    std::vector<size_t> write_sizes;
+    uint32_t fail_at = UINT32_MAX;  // Index of the write that fails
+
+    bool begin(const size_t& firmware_size) override {
+        m_size = firmware_size;
+        m_erased = 0U;
+        data.clear();
+        write_sizes.clear();
+        return true;
+    }
+
+    size_t write(uint8_t* payload, const size_t& total_bytes) override {
+        if (write_sizes.size() == fail_at) {
+            return 0U;
+        }
+        write_sizes.push_back(total_bytes);
+        for (; m_erased < data.size() + total_bytes; m_erased += SECTOR_SIZE) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ERASE_MS));
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(total_bytes * 1000U / 1024U));
+        data.insert(data.end(), payload, payload + total_bytes);
+        return total_bytes;
+    }
+
+    void reset() override { data.clear(); }
+
+    bool end() override { return data.size() == m_size; }
+
+  private:
+    size_t m_size = 0U;
+    size_t m_erased = 0U;
+};
+
+struct Download {
+    uint32_t elapsed_ms;
+    uint32_t longest_write_ms;  // Longest time the network handler was blocked in write()
+};
+
+/// @brief Receives the image like the MQTT path: the next chunk is only requested once the handler returned, and arrives after gap_ms
+Download download(IUpdater& updater, const size_t& chunk_size, const uint32_t& gap_ms) {
+    Download result = {};
+    const Clock::time_point start = Clock::now();
+    TEST_ASSERT_TRUE(updater.begin(IMAGE_SIZE));
+    for (size_t position = 0U; position < IMAGE_SIZE; position += chunk_size) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(gap_ms));
+        const size_t length = std::min(chunk_size, IMAGE_SIZE - position);
+        const Clock::time_point before = Clock::now();
+        TEST_ASSERT_EQUAL_UINT32(length, updater.write(image.data() + position, length));
+        const uint32_t blocked = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - before).count();
+        result.longest_write_ms = std::max(result.longest_write_ms, blocked);
+    }
+    TEST_ASSERT_TRUE(updater.end());
+    result.elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start).count();
+    return result;
+}
+
+/// @brief The writer task deletes itself once it was stopped, wait for its thread to get there
+bool writer_task_stopped() {
+    for (uint8_t i = 0U; i < 100U && uxTaskGetNumberOfTasks() != 0U; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return uxTaskGetNumberOfTasks() == 0U;
+}
+
+} // namespace
+
+void setUp(void) {
+    image.resize(IMAGE_SIZE);
+    for (size_t i = 0U; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>((i * 2654435761U) >> 13U);
+    }
+}
+
+void tearDown(void) {}
+
+// Receiving overlaps erasing and programming: the download takes about as long as the slower of both instead of their sum,
+// and the handler is never blocked for a whole sector erase
+void test_overlaps_network_and_flash(void) {
+    constexpr uint32_t GAP_MS = 25U;
+    Slow_Flash direct;
+    const Download unbuffered = download(direct, 4096U, GAP_MS);
+    TEST_ASSERT_TRUE(direct.data == image);
+
+    Slow_Flash flash;
+    Buffered_Updater updater(flash, 4096U);
+    const Download buffered = download(updater, 4096U, GAP_MS);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_TRUE(writer_task_stopped());
+
+    char message[160];
+    snprintf(message, sizeof(message), "%u KiB, %u ms between chunks: direct %u ms (handler blocked up to %u ms), buffered %u ms (up to %u ms, %u stalls)",
+             static_cast<unsigned>(IMAGE_SIZE / 1024U), GAP_MS, unbuffered.elapsed_ms, unbuffered.longest_write_ms,
+             buffered.elapsed_ms, buffered.longest_write_ms, updater.get_stalls());
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(unbuffered.longest_write_ms >= ERASE_MS);
+    TEST_ASSERT_TRUE(buffered.longest_write_ms < ERASE_MS);
+    TEST_ASSERT_TRUE(buffered.elapsed_ms * 10U < unbuffered.elapsed_ms * 8U);
+}
+
+// Stalls are only counted while the network delivers faster than the flash can write
+void test_reports_stalls(void) {
+    Slow_Flash flash;
+    Buffered_Updater updater(flash, 4096U);
+    download(updater, 4096U, 0U);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, updater.get_stalls());
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, updater.get_stall_time_ms());
+    // Statistics are kept after end() until the next update starts
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, updater.get_flash_bytes());
+    TEST_ASSERT_TRUE(updater.get_flash_time_ms() >= (IMAGE_SIZE / SECTOR_SIZE) * ERASE_MS);
+
+    download(updater, 4096U, 2U * ERASE_MS);
+    TEST_ASSERT_EQUAL_UINT32(0U, updater.get_stalls());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, updater.get_flash_bytes());
+}
+
+// Chunks of any size reach the flash in whole buffers, only the last one is shorter
+void test_writes_whole_buffers(void) {
+    Slow_Flash flash;
+    Buffered_Updater updater(flash, 4096U);
+    download(updater, 1000U, 0U);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_EQUAL_UINT32((IMAGE_SIZE + 4095U) / 4096U, flash.write_sizes.size());
+    for (size_t i = 0U; i + 1U < flash.write_sizes.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32(4096U, flash.write_sizes[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE % 4096U, flash.write_sizes.back());
+}
+
+// A failed flash write is reported by one of the following calls, the data after it is discarded
+void test_write_failure(void) {
+    Slow_Flash flash;
+    flash.fail_at = 3U;
+    Buffered_Updater updater(flash, 4096U);
+    TEST_ASSERT_TRUE(updater.begin(IMAGE_SIZE));
+    size_t position = 0U;
+    for (; position < IMAGE_SIZE; position += 4096U) {
+        const size_t length = std::min<size_t>(4096U, IMAGE_SIZE - position);
+        if (updater.write(image.data() + position, length) != length) {
+            break;
+        }
+    }
+    TEST_ASSERT_TRUE(position < IMAGE_SIZE);
+    TEST_ASSERT_FALSE(updater.flush());
+    TEST_ASSERT_FALSE(updater.end());
+    // Nothing is written after the failed block and the partial image is reset
+    TEST_ASSERT_EQUAL_UINT32(3U, flash.write_sizes.size());
+    TEST_ASSERT_EQUAL_UINT32(0U, flash.data.size());
+    TEST_ASSERT_TRUE(writer_task_stopped());
+
+    // The next update starts over without the failure
+    flash.fail_at = UINT32_MAX;
+    download(updater, 4096U, 0U);
+    TEST_ASSERT_TRUE(flash.data == image);
+}
+
+// reset() in the middle of an update discards the buffered data and stops the writer task
+void test_reset_midway(void) {
+    Slow_Flash flash;
+    Buffered_Updater updater(flash, 4096U);
+    TEST_ASSERT_TRUE(updater.begin(IMAGE_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(10000U, updater.write(image.data(), 10000U));
+    TEST_ASSERT_EQUAL_UINT32(1U, uxTaskGetNumberOfTasks());
+    updater.reset();
+    TEST_ASSERT_TRUE(writer_task_stopped());
+    TEST_ASSERT_EQUAL_UINT32(0U, flash.data.size());
+
+    download(updater, 4096U, 0U);
+    TEST_ASSERT_TRUE(flash.data == image);
+    TEST_ASSERT_TRUE(writer_task_stopped());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_overlaps_network_and_flash);
+    RUN_TEST(test_reports_stalls);
+    RUN_TEST(test_writes_whole_buffers);
+    RUN_TEST(test_write_failure);
+    RUN_TEST(test_reset_midway);
+    return UNITY_END();
+}
@@ -0,0 +1,519 @@
+// Tạo bởi make_fixture.py từ tools/ota_delta.py, không sửa trực tiếp
+#ifndef DELTA_PATCH_FIXTURE_H
+#define DELTA_PATCH_FIXTURE_H
+
+#include <stdint.h>
+
+constexpr uint32_t FIXTURE_SOURCE_SIZE = 49152U;
+constexpr uint32_t FIXTURE_TARGET_SIZE = 50352U;
+constexpr uint32_t FIXTURE_TARGET_CRC = 0xCEA869C6U;
+constexpr uint8_t FIXTURE_PATCH[] = {
+    0x54, 0x42, 0x44, 0x31, 0x00, 0xC0, 0x00, 0x00, 0x7F, 0xB3, 0xF3, 0xAC, 0xB0, 0xC4, 0x00, 0x00,
+    0xA0, 0x9C, 0x01, 0x00, 0xE8, 0x07, 0x25, 0x01, 0xF0, 0x83, 0x01, 0x01, 0x71, 0x7E, 0x01, 0x14,
+    0x83, 0x0C, 0x01, 0xCC, 0x30, 0x01, 0x49, 0xB8, 0x01, 0x01, 0x65, 0x1A, 0x01, 0x2F, 0x81, 0x13,
+    0x01, 0xD7, 0x81, 0x0B, 0x01, 0x9B, 0x89, 0x07, 0x01, 0x43, 0xD0, 0x01, 0x01, 0x3F, 0xC0, 0x02,
+    0x01, 0xA3, 0xAE, 0x06, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0xB2, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x09, 0x04, 0x00, 0x37,
+    0x00, 0x04, 0x00, 0xEF, 0x00, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x04, 0x30, 0x00, 0x00, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05,
+    0x04, 0x00, 0x00, 0xF2, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x62, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x04, 0x00, 0x00, 0x92, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x43, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x04, 0x00, 0x00, 0x9C, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x05, 0x04, 0x5D, 0x00, 0x00, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x04, 0x00, 0x00, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x04, 0x00, 0x89,
+    0x00, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03,
+    0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01,
+    0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04,
+    0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x03, 0x01, 0x04, 0x9F, 0x05, 0x01, 0x5D,
+    0xC6, 0x11, 0x01, 0xD4, 0xBC, 0x05, 0x90, 0x4E, 0xBC, 0x05, 0x00, 0xD1, 0x07, 0x01, 0x75, 0xAC,
+    0x01, 0x01, 0x75, 0x24, 0x01, 0xEE, 0xC8, 0x11, 0x01, 0x6C, 0x80, 0x02, 0x01, 0x50, 0xEA, 0x0C,
+    0x01, 0x97, 0xC0, 0x0C, 0x01, 0xAD, 0x32, 0x01, 0x14, 0xA8, 0x02, 0x01, 0x16, 0xD8, 0x02, 0x01,
+    0x43, 0x83, 0x06, 0x01, 0xB5, 0xA0, 0x02, 0x01, 0x74, 0xB8, 0x04, 0x01, 0x1C, 0x8A, 0x04, 0x01,
+    0xF9, 0xD8, 0x01, 0x19, 0x3E, 0x3A, 0xB5, 0x1F, 0x37, 0xD0, 0xBF, 0x39, 0xB8, 0xEE, 0xB4, 0xD3,
+    0x3C, 0xB8, 0x5F, 0x8A, 0xDE, 0x7D, 0x3F, 0xBF, 0xDE, 0xD8, 0xA2, 0x1C, 0x49, 0xEA, 0x8E, 0xE1,
+    0x74, 0xA6, 0x9A, 0x6B, 0x41, 0xC7, 0x7A, 0x7E, 0x7E, 0xAE, 0xDF, 0x9D, 0x73, 0x29, 0xB4, 0x76,
+    0x65, 0x3D, 0xA6, 0xDB, 0x74, 0xCE, 0xFD, 0x7D, 0x44, 0x0F, 0x68, 0x77, 0xE5, 0x29, 0xB8, 0x94,
+    0x98, 0x2E, 0xC0, 0x53, 0xCF, 0xE2, 0xEC, 0xB0, 0xAB, 0x2C, 0xBD, 0xCB, 0xB7, 0xC7, 0xC0, 0x87,
+    0x2B, 0x76, 0x01, 0x05, 0x9F, 0xFB, 0xE0, 0x84, 0xA4, 0x86, 0xD8, 0x1B, 0x6C, 0xF1, 0x69, 0x1C,
+    0x09, 0x0F, 0xF8, 0x1B, 0x0C, 0xED, 0xDD, 0xCA, 0xA1, 0xBD, 0x42, 0x9D, 0x0C, 0xDE, 0xBF, 0xA9,
+    0x35, 0xE0, 0x55, 0x4F, 0xB3, 0xD7, 0x78, 0x83, 0x65, 0xBB, 0x8F, 0x16, 0xBB, 0x30, 0x1B, 0x4D,
+    0xE1, 0x1D, 0xC1, 0xE5, 0x78, 0x99, 0xD8, 0x72, 0xAC, 0xAE, 0x2D, 0xC6, 0x8D, 0x2F, 0x91, 0x90,
+    0x78, 0x5D, 0x74, 0x74, 0x19, 0xC2, 0xF4, 0x77, 0x2E, 0x31, 0xEC, 0x2B, 0x03, 0x16, 0x06, 0xFA,
+    0x10, 0x85, 0xA2, 0x99, 0x24, 0xD3, 0xB1, 0xC8, 0x00, 0xC7, 0xFC, 0xA6, 0x83, 0x4C, 0xBE, 0xE6,
+    0x08, 0x51, 0xF3, 0xEF, 0xB5, 0x10, 0xAF, 0x0D, 0x86, 0x8A, 0x93, 0x2E, 0x65, 0xE9, 0x86, 0x2B,
+    0xD6, 0x49, 0xB5, 0xFE, 0x36, 0xAC, 0xCD, 0xE7, 0xF6, 0xEE, 0x18, 0xAC, 0x06, 0xC0, 0x75, 0xFD,
+    0x18, 0x2E, 0x8A, 0xBA, 0x1A, 0x5A, 0x30, 0xF9, 0xFF, 0x02, 0x41, 0xF1, 0xB6, 0x44, 0x6A, 0xD8,
+    0x23, 0x13, 0xEA, 0xC4, 0xB0, 0xA0, 0xC2, 0xAE, 0x24, 0xB7, 0xF6, 0xB8, 0xA0, 0x65, 0xA2, 0xD8,
+    0xB5, 0x91, 0x0C, 0xAF, 0x6E, 0xBC, 0x3D, 0x81, 0xD6, 0x93, 0x32, 0x19, 0x89, 0x08, 0xEE, 0x72,
+    0xCC, 0x6A, 0x93, 0xF6, 0xC5, 0xB0, 0x87, 0x18, 0x92, 0x70, 0xAD, 0x37, 0x09, 0xCE, 0x7D, 0x52,
+    0xFD, 0x0B, 0x79, 0x34, 0xFC, 0xA8, 0xD3, 0x03, 0xE0, 0xD8, 0x35, 0x7E, 0x27, 0xE7, 0x1D, 0xA4,
+    0x06, 0xBA, 0x70, 0x99, 0xAB, 0xEF, 0xF8, 0x04, 0x67, 0x2E, 0x5B, 0x52, 0x71, 0x05, 0xB3, 0x1E,
+    0x58, 0xCA, 0x7A, 0xDE, 0x9D, 0x17, 0x50, 0xC4, 0xE8, 0xA1, 0x68, 0x9B, 0x8B, 0xE0, 0xEE, 0x31,
+    0x99, 0xDD, 0x17, 0x80, 0x9B, 0xF8, 0x63, 0x2F, 0xB3, 0x10, 0xBB, 0xE1, 0x94, 0x17, 0x63, 0xA7,
+    0x5F, 0x59, 0xE2, 0xA2, 0x95, 0x2D, 0x5F, 0x4B, 0x5E, 0xA1, 0x74, 0x6E, 0xEB, 0x56, 0x38, 0xDD,
+    0x8F, 0x16, 0x4D, 0x4D, 0xB1, 0xD2, 0x46, 0x1B, 0x9B, 0xDF, 0x8F, 0x2F, 0x6B, 0x5E, 0x44, 0x92,
+    0x31, 0x11, 0x38, 0x16, 0x7C, 0x11, 0xF5, 0x89, 0x67, 0x60, 0x3E, 0x4B, 0x7C, 0xD7, 0x3B, 0xFC,
+    0x92, 0x97, 0xDE, 0xA6, 0x24, 0x96, 0x29, 0x9E, 0x0C, 0x7E, 0x88, 0xE2, 0x22, 0x96, 0x9B, 0x51,
+    0x3E, 0x2B, 0xB2, 0x4A, 0xBE, 0xAE, 0x41, 0x49, 0xDC, 0x95, 0xE4, 0x4E, 0x17, 0xF5, 0x89, 0x38,
+    0xCC, 0x47, 0x77, 0xA7, 0x2D, 0xBE, 0xE0, 0x2D, 0x69, 0xC9, 0xA8, 0x99, 0x5B, 0x89, 0xED, 0x29,
+    0x5F, 0xD1, 0x52, 0xCF, 0xAC, 0x26, 0x41, 0xE4, 0xF5, 0x90, 0xA0, 0x0C, 0x2C, 0x68, 0x61, 0x34,
+    0xE7, 0xE2, 0xE9, 0x6C, 0x77, 0xC9, 0x35, 0x79, 0x88, 0x2A, 0x40, 0x22, 0xBB, 0x9E, 0x55, 0x04,
+    0x02, 0x48, 0x30, 0x02, 0xC6, 0xFE, 0x5E, 0xEC, 0x57, 0xAE, 0xDF, 0x85, 0xEB, 0x83, 0x36, 0x00,
+    0xEB, 0x89, 0x81, 0x58, 0x2E, 0xEE, 0xFD, 0x0D, 0xBB, 0xA1, 0x62, 0x68, 0xF8, 0x79, 0xAC, 0x8D,
+    0x54, 0x74, 0xE8, 0xC4, 0x47, 0xB3, 0x68, 0x7F, 0x32, 0xBE, 0xBE, 0x15, 0xF6, 0x5F, 0x15, 0xCB,
+    0x3A, 0x8F, 0x55, 0x4C, 0x31, 0x8C, 0x24, 0x2A, 0xC8, 0x9E, 0x1C, 0x16, 0x3C, 0x08, 0x5A, 0xDB,
+    0x77, 0xC4, 0x85, 0x2D, 0x6B, 0x8A, 0x9E, 0xD2, 0x06, 0xA6, 0x3D, 0xEB, 0x1F, 0xAA, 0xFA, 0xAD,
+    0x8C, 0xC2, 0xB8, 0x04, 0xEB, 0x57, 0x86, 0x28, 0xDF, 0x8D, 0xEF, 0x4C, 0x56, 0xEE, 0x09, 0x1E,
+    0xDA, 0x8C, 0x30, 0x23, 0xEB, 0x67, 0x49, 0x82, 0x06, 0x56, 0x04, 0xD5, 0xFC, 0x43, 0xDA, 0x6C,
+    0x83, 0x17, 0x19, 0x22, 0x05, 0x45, 0x41, 0x4F, 0xA9, 0x93, 0x9A, 0xF3, 0xB1, 0x96, 0x1C, 0x4C,
+    0x1F, 0xDF, 0x1B, 0x60, 0xE6, 0xE1, 0x85, 0xA4, 0x18, 0x97, 0x1B, 0xA6, 0xCF, 0xE9, 0x40, 0x57,
+    0xA2, 0x68, 0xC5, 0xFA, 0x3D, 0x99, 0x2D, 0x5F, 0x47, 0xA3, 0xFD, 0xD5, 0xC2, 0x02, 0xDA, 0xD4,
+    0xE9, 0x23, 0x43, 0x04, 0x24, 0xAB, 0x2A, 0x55, 0x09, 0x2F, 0xBC, 0x8A, 0x7D, 0xAE, 0xBB, 0xF8,
+    0xC9, 0x15, 0x69, 0x02, 0x77, 0x53, 0xF1, 0x58, 0x0B, 0x36, 0x2C, 0x18, 0x2D, 0x2D, 0x37, 0xA3,
+    0xF5, 0x45, 0x93, 0xAC, 0x9A, 0x57, 0xDA, 0xB4, 0x0C, 0xEE, 0xC6, 0x93, 0x7A, 0xDF, 0xB8, 0xAF,
+    0x2D, 0x1F, 0xC5, 0x60, 0x92, 0x00, 0xB1, 0xC0, 0x09, 0xF6, 0xB6, 0x70, 0x46, 0x52, 0x84, 0x9A,
+    0xFE, 0x33, 0xBD, 0x08, 0xA8, 0xB6, 0x64, 0x88, 0xFE, 0x1B, 0x0E, 0xAA, 0xF8, 0x56, 0x1C, 0xDC,
+    0x91, 0x01, 0xE8, 0x07, 0x00, 0x85, 0x09, 0x01, 0xA5, 0x54, 0x01, 0x5B, 0xE3, 0x06, 0x01, 0xC8,
+    0x95, 0x06, 0x01, 0xF8, 0xDB, 0x01, 0x01, 0xD7, 0xA5, 0x0B, 0x01, 0xC8, 0x40, 0x01, 0xEB, 0xF5,
+    0x04, 0x01, 0xF4, 0xDE, 0x0B, 0x01, 0x72, 0xDF, 0x01, 0x01, 0xA3, 0xAA, 0x02, 0x01, 0x64, 0xE8,
+    0x03, 0x01, 0x2E, 0xDA, 0x05, 0x01, 0xCB, 0xC4, 0x05, 0x01, 0x9B, 0xB5, 0x04, 0x01, 0xB9, 0xE8,
+    0x11, 0x01, 0xC1, 0xFE, 0x0B, 0x01, 0xEE, 0xEB, 0x05, 0x01, 0x2F, 0x8A, 0x05, 0x01, 0xD5, 0x48,
+    0x01, 0x19, 0xDD, 0x06, 0x01, 0x26, 0xF3, 0x0E, 0x01, 0xA8, 0xA8, 0x02, 0x01, 0x05, 0x96, 0x01,
+    0x01, 0xCD, 0xEB, 0x02, 0x2A, 0x69, 0x58, 0xBF, 0x32, 0x62, 0x5F, 0xBB, 0x06, 0x05, 0x6F, 0x97,
+    0x16, 0xA9, 0x07, 0xC5, 0x8B, 0xE8, 0x9E, 0xA1, 0x04, 0x9F, 0xF1, 0x76, 0x49, 0xFF, 0xF7, 0x35,
+    0x88, 0xDC, 0x9E, 0x59, 0xFE, 0xA6, 0x17, 0x8F, 0x65, 0x91, 0x15, 0x0B, 0x07, 0x69, 0x55, 0x1E,
+    0x96, 0xCC, 0xB8, 0xF4, 0x88, 0xB7, 0xDF, 0x8A, 0x56, 0xFB, 0xFA, 0x63, 0x17, 0x14, 0xE0, 0x54,
+    0xFA, 0x62, 0x34, 0x87, 0x81, 0x86, 0x8F, 0x3B, 0xC8, 0x91, 0x0E, 0x03, 0xA9, 0x2E, 0x2B, 0xA1,
+    0xD0, 0x29, 0x21, 0x35, 0xBE, 0xD1, 0xF4, 0x90, 0x7B, 0xC9, 0xD0, 0xC2, 0xF5, 0xE4, 0x91, 0x4C,
+    0x3C, 0xA9, 0x38, 0xC7, 0xB2, 0x23, 0xD8, 0xB5, 0x64, 0x68, 0x57, 0x7D, 0xE7, 0xA8, 0x32, 0xA6,
+    0xF7, 0xAF, 0x36, 0x00, 0x37, 0xC1, 0x4F, 0x72, 0x23, 0x3B, 0x81, 0xCA, 0xA0, 0x9B, 0x11, 0xC8,
+    0x77, 0x95, 0xB2, 0x39, 0x9F, 0xFF, 0x4E, 0x97, 0x8F, 0xC8, 0x90, 0xCA, 0xFB, 0x04, 0xED, 0x38,
+    0x24, 0x46, 0xBD, 0x8A, 0xC7, 0xB2, 0xCD, 0xC9, 0x13, 0x11, 0x68, 0x96, 0x04, 0xD7, 0x8B, 0xC3,
+    0x20, 0x01, 0x6E, 0x93, 0x88, 0xFB, 0xCD, 0x30, 0x1C, 0x31, 0x31, 0x89, 0xB4, 0xD6, 0x2F, 0x91,
+    0x3F, 0x47, 0x04, 0x62, 0xAE, 0x55, 0xDC, 0x29, 0x8F, 0x65, 0xA3, 0xFC, 0x39, 0x76, 0xDE, 0x6D,
+    0xB8, 0xEF, 0xEF, 0xD4, 0x43, 0x2D, 0x8F, 0xDC, 0xF4, 0xCC, 0x86, 0xE2, 0x28, 0xA6, 0xE6, 0xCC,
+    0x8F, 0xC2, 0xC9, 0xF7, 0x06, 0x0D, 0x66, 0x31, 0xCB, 0xC3, 0xB1, 0x31, 0x5E, 0x49, 0x70, 0x81,
+    0x26, 0xA5, 0x1F, 0xAC, 0x0F, 0x36, 0xD9, 0x48, 0xD3, 0xD4, 0x21, 0x94, 0x57, 0x35, 0x77, 0x0C,
+    0xF4, 0xB6, 0xB4, 0xAB, 0xED, 0x58, 0x7A, 0x54, 0x8C, 0x66, 0xB1, 0x83, 0xCE, 0x72, 0x04, 0x96,
+    0x4C, 0xE4, 0x2A, 0x3A, 0x98, 0xE6, 0xBB, 0xBD, 0xD4, 0x3E, 0x39, 0x7A, 0xC1, 0xB9, 0x5C, 0x8E,
+    0xF0, 0x5C, 0x51, 0x61, 0x34, 0xA8, 0x48, 0x5F, 0x6F, 0xD4, 0xFD, 0xA2, 0x86, 0x67, 0x4B, 0xE9,
+    0xEB, 0xFA, 0xC2, 0x2C, 0x2C, 0xC4, 0xD3, 0x76, 0xA9, 0x24, 0xF2, 0x93, 0xB3, 0xC5, 0xC0, 0xB6,
+    0x32, 0x29, 0xEC, 0xEF, 0xAC, 0x9B, 0x55, 0x9B, 0x48, 0xF7, 0x24, 0x90, 0x49, 0x39, 0xC9, 0x35,
+    0x77, 0x9B, 0xF5, 0xCF, 0xF2, 0x81, 0x71, 0x0D, 0xBD, 0xA0, 0x8C, 0x3E, 0x59, 0x43, 0x64, 0xB1,
+    0xBE, 0xEC, 0x18, 0x8D, 0x6B, 0x12, 0xF8, 0xD3, 0x6E, 0x4B, 0x70, 0xA4, 0x4B, 0x7F, 0x5A, 0x82,
+    0x73, 0x01, 0xFB, 0xFE, 0xB4, 0x43, 0xC2, 0xA0, 0xB5, 0x0E, 0xD2, 0x1D, 0x52, 0x88, 0x1D, 0x2B,
+    0x26, 0x8E, 0xCB, 0x57, 0xFB, 0xAD, 0x12, 0x78, 0x4C, 0x2F, 0xB7, 0x07, 0x2A, 0x59, 0x8B, 0x2E,
+    0xCD, 0xA6, 0x90, 0x97, 0xD6, 0x51, 0x46, 0x48, 0xA0, 0x92, 0x11, 0xEB, 0x13, 0xBE, 0xAF, 0xA2,
+    0x98, 0x64, 0xF5, 0x4D, 0x7F, 0x4D, 0x11, 0x20, 0xAA, 0x81, 0x94, 0xCC, 0x5E, 0x74, 0x5E, 0xF5,
+    0xFA, 0x5E, 0x69, 0x2E, 0x96, 0xA9, 0x96, 0x1F, 0xA9, 0x63, 0xA2, 0x9E, 0x88, 0x16, 0xCC, 0x1A,
+    0x85, 0x31, 0xAF, 0xBA, 0x32, 0x86, 0x6C, 0xEF, 0xE2, 0xC5, 0x5C, 0x08, 0xD6, 0x17, 0xF2, 0xBC,
+    0x49, 0xB1, 0x67, 0x8E, 0x15, 0x8B, 0x2C, 0xC3, 0x87, 0xBC, 0x3D, 0xC2, 0x54, 0xCF, 0x7D, 0x9F,
+    0xA4, 0x2C, 0x42, 0x89, 0xCF, 0x0E, 0x9F, 0x86, 0x96, 0x43, 0x1B, 0xF0, 0x60, 0x0B, 0x63, 0x8E,
+    0x1D, 0xE1, 0xFB, 0x46, 0xEE, 0xA5, 0x9E, 0x67, 0x0C, 0x92, 0xB3, 0xE2, 0xE9, 0xA3, 0x90, 0xC0,
+    0x82, 0x4A, 0x2C, 0x0E, 0xA0, 0xE1, 0x92, 0x8D, 0x64, 0xD6, 0x26, 0x46, 0x54, 0x6C, 0x8A, 0x5E,
+    0x68, 0x86, 0x8D, 0x61, 0x90, 0xF2, 0xA9, 0xB3, 0x47, 0x45, 0x27, 0x7C, 0x12, 0x9A, 0xD9, 0x31,
+    0x1A, 0xF0, 0xF9, 0xB8, 0xEC, 0xE3, 0x10, 0x99, 0xE4, 0xFB, 0x31, 0x48, 0xE8, 0x31, 0xBB, 0xEF,
+    0xD2, 0x67, 0x62, 0x5D, 0x19, 0xA4, 0x7A, 0x4E, 0xBC, 0xEB, 0x5F, 0xF5, 0xA1, 0x11, 0x10, 0x2F,
+    0x40, 0x9D, 0x34, 0x9B, 0x14, 0x68, 0x19, 0xF8, 0xFD, 0x8E, 0x93, 0x4D, 0x77, 0x94, 0x01, 0x90,
+    0x32, 0xD3, 0xF0, 0xDE, 0x02, 0xCF, 0xDD, 0xB4, 0x63, 0xC9, 0xC8, 0x21, 0xC7, 0x29, 0x40, 0xE2,
+    0x76, 0x6A, 0x1F, 0x86, 0x31, 0xF3, 0xC4, 0xC8, 0x88, 0x7E, 0xB8, 0xA7, 0x36, 0xD0, 0x3E, 0xE1,
+    0xB5, 0xA4, 0xE6, 0xE3, 0x73, 0x5B, 0x1B, 0x03, 0xC2, 0xB3, 0x50, 0x30, 0x2A, 0xD2, 0xAA, 0x10,
+    0x9A, 0x78, 0xF2, 0x7E, 0x6E, 0xC3, 0x29, 0xD6, 0x21, 0x8A, 0xED, 0x4B, 0x61, 0x98, 0xC8, 0x00,
+    0xFE, 0x75, 0xDA, 0x83, 0xEA, 0x68, 0x57, 0xCD, 0x3A, 0x31, 0x65, 0x8E, 0x66, 0x36, 0x39, 0x9A,
+    0x5F, 0x31, 0x88, 0x18, 0xBB, 0xDD, 0xE7, 0x09, 0x8C, 0x25, 0xE6, 0x2C, 0xC3, 0xE1, 0xDB, 0x18,
+    0xFC, 0x09, 0x90, 0x69, 0xB3, 0xDD, 0xA7, 0x3E, 0x11, 0x95, 0x46, 0xDA, 0x2E, 0x80, 0xBD, 0x4E,
+    0xC0, 0x0A, 0x43, 0x81, 0x85, 0xAB, 0x74, 0x58, 0x60, 0x0D, 0x70, 0xD8, 0xAB, 0xA1, 0xBE, 0x64,
+    0xDB, 0x67, 0x12, 0xF9, 0x5D, 0x8F, 0x74, 0xCF, 0x25, 0xBC, 0x62, 0x23, 0xA9, 0x72, 0x59, 0x90,
+    0x3D, 0xD0, 0xD7, 0x1E, 0x12, 0x29, 0x7E, 0xA8, 0x24, 0x52, 0xFA, 0x13, 0x21, 0x55, 0x43, 0xD3,
+    0xF8, 0xEB, 0x0A, 0x22, 0x0D, 0xA3, 0x41, 0x69, 0xB5, 0xA9, 0xC0, 0x55, 0x68, 0xA9, 0x7F, 0xBD,
+    0xEC, 0x6E, 0x57, 0xBF, 0x02, 0xA2, 0xC2, 0x06, 0x59, 0x7C, 0x6A, 0x73, 0xF4, 0x1C, 0x31, 0x7B,
+    0xF4, 0x99, 0xB3, 0xE7, 0xCF, 0xBF, 0x0E, 0x84, 0xED, 0xDC, 0x67, 0x79, 0xBF, 0xC7, 0xD1, 0x9D,
+    0xA5, 0xA7, 0x0D, 0x0A, 0x24, 0x14, 0x96, 0xCF, 0xC1, 0x6A, 0x05, 0x0F, 0x6F, 0x70, 0x9A, 0x1E,
+    0xFA, 0xE3, 0x46, 0x86, 0x8E, 0xCE, 0x72, 0xAA, 0xBD, 0xCD, 0xF7, 0xF4, 0x41, 0xE0, 0xE2, 0xF5,
+    0xBE, 0x7B, 0xC4, 0x8F, 0xF7, 0xD6, 0x7E, 0xCB, 0x0F, 0x65, 0x4B, 0x50, 0xD6, 0x27, 0x64, 0x16,
+    0x43, 0xE1, 0xD1, 0x2E, 0xDB, 0x34, 0x5D, 0xFB, 0x1E, 0xB6, 0x7F, 0x96, 0xBF, 0x96, 0x64, 0xE9,
+    0x26, 0xE3, 0x5E, 0x5B, 0x5E, 0x66, 0xEB, 0x38, 0x5A, 0xE3, 0xBC, 0x21, 0x04, 0x6B, 0x44, 0x50,
+    0xFB, 0x7C, 0x2C, 0x2B, 0x3B, 0x15, 0x2F, 0xE6, 0x5B, 0xD5, 0xE1, 0xF4, 0xE2, 0xBC, 0xBD, 0x41,
+    0x6F, 0xCA, 0x6E, 0x50, 0xDC, 0xB5, 0xEC, 0xEB, 0x35, 0xD4, 0xB4, 0x9F, 0xCD, 0x4E, 0x1D, 0x58,
+    0x60, 0xEE, 0x18, 0xE3, 0x0B, 0x82, 0xC4, 0x6B, 0x57, 0x91, 0x66, 0x24, 0x97, 0x81, 0x24, 0xEC,
+    0x8E, 0x1B, 0x8F, 0xCE, 0x36, 0xD0, 0x1F, 0x90, 0xAC, 0xD8, 0x0B, 0xDD, 0xC9, 0x08, 0x53, 0xCA,
+    0x41, 0x39, 0x59, 0xB4, 0x86, 0x8A, 0x6B, 0xC0, 0x28, 0x8A, 0xD7, 0xC3, 0xF7, 0xFC, 0x1C, 0xD8,
+    0x08, 0x81, 0x95, 0x30, 0x5B, 0xB2, 0x66, 0x79, 0xF8, 0xA0, 0x50, 0xF8, 0xBF, 0x3B, 0xEA, 0xFF,
+    0xA9, 0xD4, 0xFD, 0xD3, 0xFD, 0x29, 0x24, 0xAF, 0x26, 0x80, 0xDE, 0xD1, 0x2B, 0x78, 0x16, 0xED,
+    0xF5, 0x20, 0x64, 0x7F, 0x1A, 0x7D, 0xF4, 0x64, 0x91, 0x61, 0xF5, 0xD2, 0x32, 0x7C, 0xC8, 0x4A,
+    0xAA, 0x35, 0x57, 0x5A, 0x5D, 0x1E, 0x36, 0x4E, 0x88, 0x5D, 0xBA, 0x19,
+};
+
+#endif // DELTA_PATCH_FIXTURE_H
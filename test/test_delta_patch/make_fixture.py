@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Tạo fixture.h cho test_delta_patch bằng chính tools/ota_delta.py.
+
+    python test/test_delta_patch/make_fixture.py
+
+Image cũ và mới được sinh bằng cùng một bộ sinh số giả ngẫu nhiên như trong
+test_main.cpp, nên fixture chỉ cần chứa patch.
+"""
+
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.join(HERE, "..", "..", "tools"))
+
+import ota_delta  # noqa: E402
+
+SOURCE_SIZE = 48 * 1024
+
+
+class XorShift32:
+    def __init__(self, seed):
+        self.state = seed
+
+    def next(self):
+        x = self.state
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        self.state = x
+        return x
+
+
+def source_image():
+    """Giống mã máy: các word lặp lại từ một tập nhỏ, xen kẽ địa chỉ ngẫu nhiên."""
+    rng = XorShift32(0x12345678)
+    words = [rng.next() for _ in range(32)]
+    out = bytearray()
+    while len(out) < SOURCE_SIZE:
+        value = rng.next()
+        word = value if value % 8 == 0 else words[value % 32]
+        out += word.to_bytes(4, "little")
+    return bytes(out[:SOURCE_SIZE])
+
+
+def target_image(source):
+    """Phiên bản mới: chèn, xóa, sửa byte và dịch các địa chỉ trong một vùng."""
+    target = bytearray(source)
+    rng = XorShift32(0x9E3779B9)
+    for i in range(8192, 16384, 4):
+        target[i] = (target[i] + 4) & 0xFF
+    del target[20000:20500]
+    target[30000:30000] = bytes(rng.next() & 0xFF for _ in range(700))
+    for _ in range(64):
+        target[rng.next() % len(target)] = rng.next() & 0xFF
+    target += bytes(rng.next() & 0xFF for _ in range(1000))
+    return bytes(target)
+
+
+def main():
+    source = source_image()
+    target = target_image(source)
+    patch = ota_delta.make_patch(source, target)
+    assert ota_delta.apply_patch(source, patch) == target
+    lines = [
+        "// Tạo bởi make_fixture.py từ tools/ota_delta.py, không sửa trực tiếp",
+        "#ifndef DELTA_PATCH_FIXTURE_H",
+        "#define DELTA_PATCH_FIXTURE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "constexpr uint32_t FIXTURE_SOURCE_SIZE = %dU;" % len(source),
+        "constexpr uint32_t FIXTURE_TARGET_SIZE = %dU;" % len(target),
+        "constexpr uint32_t FIXTURE_TARGET_CRC = 0x%08XU;" % ota_delta.zlib.crc32(target),
+        "constexpr uint8_t FIXTURE_PATCH[] = {",
+    ]
+    for start in range(0, len(patch), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in patch[start:start + 16]) + ",")
+    lines += ["};", "", "#endif // DELTA_PATCH_FIXTURE_H", ""]
+    with open(os.path.join(HERE, "fixture.h"), "w") as f:
+        f.write("\n".join(lines))
+    print("source %d, target %d, patch %d bytes" % (len(source), len(target), len(patch)))
+
+
+if __name__ == "__main__":
+    main()
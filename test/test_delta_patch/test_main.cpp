@@ -0,0 +1,220 @@
+// DeltaPatch applies a patch made by tools/ota_delta.py (fixture.h, regenerated with make_fixture.py) while it streams in,
+// in chunks of any size, and rejects patches for another source image or with corrupted records
+#include <unity.h>
+#include <DeltaPatch.h>
+#include <HashGenerator.h>
+#include <random>
+#include <vector>
+#include "fixture.h"
+
+namespace {
+
+/// @brief Same generator as make_fixture.py
+class XorShift32 {
+  public:
+    explicit XorShift32(const uint32_t& seed) : m_state(seed) {}
+
+    uint32_t next() {
+        m_state ^= m_state << 13U;
+        m_state ^= m_state >> 17U;
+        m_state ^= m_state << 5U;
+        return m_state;
+    }
+
+  private:
+    uint32_t m_state;
+};
+
+std::vector<uint8_t> source_image() {
+    XorShift32 random(0x12345678U);
+    uint32_t words[32];
+    for (uint32_t& word : words) {
+        word = random.next();
+    }
+    std::vector<uint8_t> image;
+    while (image.size() < FIXTURE_SOURCE_SIZE) {
+        const uint32_t value = random.next();
+        const uint32_t word = value % 8U == 0U ? value : words[value % 32U];
+        for (uint8_t i = 0U; i < 4U; i++) {
+            image.push_back(static_cast<uint8_t>(word >> (8U * i)));
+        }
+    }
+    image.resize(FIXTURE_SOURCE_SIZE);
+    return image;
+}
+
+/// @brief Running image and new partition, checks the base of the patch like OtaImage does
+class Fake_Target : public DeltaTarget {
+  public:
+    explicit Fake_Target(const std::vector<uint8_t>& source) : source(source), begun(0U), reads(0U) {}
+
+    bool readSource(size_t offset, uint8_t* buffer, size_t length) override {
+        reads++;
+        if (offset + length > source.size()) {
+            return false;
+        }
+        memcpy(buffer, source.data() + offset, length);
+        return true;
+    }
+
+    bool beginTarget(uint32_t sourceSize, uint32_t sourceCrc, uint32_t targetSize) override {
+        begun++;
+        expected_size = targetSize;
+        return sourceSize == source.size() && sourceCrc == HashGenerator::crc32(0U, source.data(), source.size());
+    }
+
+    bool writeTarget(uint8_t* data, size_t length) override {
+        target.insert(target.end(), data, data + length);
+        return target.size() <= expected_size;
+    }
+
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> target;
+    uint32_t expected_size = 0U;
+    uint32_t begun;
+    uint32_t reads;
+};
+
+std::vector<uint8_t> source;
+
+/// @brief Feeds the given patch in chunks of random size up to the given maximum
+bool feed(DeltaPatch& patch, const std::vector<uint8_t>& data, const uint32_t& max_chunk, const uint32_t& seed) {
+    std::mt19937 random(seed);
+    size_t position = 0U;
+    while (position < data.size()) {
+        const size_t length = std::min<size_t>(1U + random() % max_chunk, data.size() - position);
+        if (!patch.feed(data.data() + position, length)) {
+            return false;
+        }
+        position += length;
+    }
+    return true;
+}
+
+std::vector<uint8_t> fixture_patch() {
+    return std::vector<uint8_t>(FIXTURE_PATCH, FIXTURE_PATCH + sizeof(FIXTURE_PATCH));
+}
+
+} // namespace
+
+void setUp(void) {
+    if (source.empty()) {
+        source = source_image();
+    }
+}
+
+void tearDown(void) {}
+
+void test_detects_patch(void) {
+    TEST_ASSERT_TRUE(DeltaPatch::isPatch(FIXTURE_PATCH, sizeof(FIXTURE_PATCH)));
+    TEST_ASSERT_FALSE(DeltaPatch::isPatch(FIXTURE_PATCH, 3U));
+    const uint8_t image[] = { 0xE9, 0x05, 0x02, 0x20 };
+    TEST_ASSERT_FALSE(DeltaPatch::isPatch(image, sizeof(image)));
+}
+
+// The reconstructed image matches the one the tool made the patch from, no matter how the patch is split into chunks
+void test_round_trip(void) {
+    const std::vector<uint8_t> patch_data = fixture_patch();
+    const uint32_t max_chunks[] = { 1U, 7U, 256U, 1024U, 4096U, sizeof(FIXTURE_PATCH) };
+    for (const uint32_t& max_chunk : max_chunks) {
+        Fake_Target target(source);
+        DeltaPatch patch;
+        patch.begin(&target);
+        TEST_ASSERT_TRUE(feed(patch, patch_data, max_chunk, max_chunk));
+        TEST_ASSERT_TRUE(patch.finished());
+        TEST_ASSERT_EQUAL_UINT32(1U, target.begun);
+        TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, patch.getTargetSize());
+        TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, target.target.size());
+        TEST_ASSERT_EQUAL_HEX32(FIXTURE_TARGET_CRC, HashGenerator::crc32(0U, target.target.data(), target.target.size()));
+    }
+}
+
+// A patch only applies to the exact image it was made for
+void test_rejects_other_source(void) {
+    std::vector<uint8_t> other = source;
+    other[100U] ^= 0x01U;
+    Fake_Target target(other);
+    DeltaPatch patch;
+    patch.begin(&target);
+    TEST_ASSERT_FALSE(patch.feed(FIXTURE_PATCH, sizeof(FIXTURE_PATCH)));
+    TEST_ASSERT_FALSE(patch.finished());
+    TEST_ASSERT_EQUAL_UINT32(0U, target.target.size());
+    TEST_ASSERT_EQUAL_UINT32(0U, target.reads);
+
+    Fake_Target shorter(std::vector<uint8_t>(source.begin(), source.end() - 1));
+    patch.begin(&shorter);
+    TEST_ASSERT_FALSE(patch.feed(FIXTURE_PATCH, sizeof(FIXTURE_PATCH)));
+}
+
+void test_truncated_and_trailing_data(void) {
+    const std::vector<uint8_t> patch_data = fixture_patch();
+    Fake_Target truncated(source);
+    DeltaPatch patch;
+    patch.begin(&truncated);
+    TEST_ASSERT_TRUE(patch.feed(patch_data.data(), patch_data.size() - 1U));
+    TEST_ASSERT_FALSE(patch.finished());
+
+    Fake_Target trailing(source);
+    patch.begin(&trailing);
+    std::vector<uint8_t> longer = patch_data;
+    longer.push_back(0U);
+    TEST_ASSERT_FALSE(patch.feed(longer.data(), longer.size()));
+    TEST_ASSERT_FALSE(patch.finished());
+}
+
+// Randomly corrupted patches never write past the announced target size or read outside of the source
+void test_corrupted_records(void) {
+    const std::vector<uint8_t> patch_data = fixture_patch();
+    std::mt19937 random(42U);
+    uint32_t rejected = 0U;
+    for (uint32_t trial = 0U; trial < 300U; trial++) {
+        std::vector<uint8_t> corrupted = patch_data;
+        const uint8_t flips = 1U + random() % 4U;
+        for (uint8_t i = 0U; i < flips; i++) {
+            // Header stays intact, otherwise the patch is simply rejected by the base check
+            corrupted[DELTA_PATCH_HEADER_SIZE + random() % (corrupted.size() - DELTA_PATCH_HEADER_SIZE)] = static_cast<uint8_t>(random());
+        }
+        Fake_Target target(source);
+        DeltaPatch patch;
+        patch.begin(&target);
+        const bool accepted = feed(patch, corrupted, 512U, trial);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(FIXTURE_TARGET_SIZE, target.target.size());
+        if (accepted && patch.finished()) {
+            TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, target.target.size());
+        }
+        else {
+            rejected++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, rejected);
+}
+
+// Empty target and a patch without a target
+void test_edge_cases(void) {
+    uint8_t header[DELTA_PATCH_HEADER_SIZE] = { 'T', 'B', 'D', '1' };
+    const uint32_t crc = HashGenerator::crc32(0U, source.data(), source.size());
+    const uint32_t size = source.size();
+    memcpy(header + 4U, &size, sizeof(size));
+    memcpy(header + 8U, &crc, sizeof(crc));
+    Fake_Target target(source);
+    DeltaPatch patch;
+    patch.begin(&target);
+    TEST_ASSERT_TRUE(patch.feed(header, sizeof(header)));
+    TEST_ASSERT_TRUE(patch.finished());
+    TEST_ASSERT_EQUAL_UINT32(0U, target.target.size());
+
+    DeltaPatch detached;
+    detached.begin(nullptr);
+    TEST_ASSERT_FALSE(detached.feed(FIXTURE_PATCH, sizeof(FIXTURE_PATCH)));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_detects_patch);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_rejects_other_source);
+    RUN_TEST(test_truncated_and_trailing_data);
+    RUN_TEST(test_corrupted_records);
+    RUN_TEST(test_edge_cases);
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+// HashGenerator against known vectors of every firmware checksum algorithm ThingsBoard offers, fed in arbitrary chunks like the OTA chunks arrive
+#include <unity.h>
+#include <HashGenerator.h>
+#include <chrono>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Vector {
+    mbedtls_md_type_t type;
+    const char *name;
+    const char *input;
+    const char *expected;
+};
+
+// FIPS 180 / RFC 1321 test vectors, the CRC32 check value 0xCBF43926 in the little endian byte order ThingsBoard uses
+const Vector VECTORS[] = {
+    { MBEDTLS_MD_MD5, "MD5", "abc", "900150983cd24fb0d6963f7d28e17f72" },
+    { MBEDTLS_MD_SHA256, "SHA256", "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+    { MBEDTLS_MD_SHA256, "SHA256", "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+    { MBEDTLS_MD_SHA384, "SHA384", "abc", "cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed8086072ba1e7cc2358baeca134c825a7" },
+    { MBEDTLS_MD_SHA512, "SHA512", "abc", "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f" },
+    { MD_TYPE_CRC32, "CRC32", "123456789", "2639f4cb" },
+    { MD_TYPE_CRC32, "CRC32", "", "00000000" },
+};
+
+std::vector<uint8_t> firmware(const size_t& size) {
+    std::mt19937 random(size);
+    std::vector<uint8_t> data(size);
+    for (uint8_t& byte : data) {
+        byte = static_cast<uint8_t>(random());
+    }
+    return data;
+}
+
+std::string hash_in_chunks(HashGenerator& generator, const mbedtls_md_type_t& type, const std::vector<uint8_t>& data, const uint32_t& seed) {
+    std::mt19937 random(seed);
+    generator.start(type);
+    size_t position = 0U;
+    while (position < data.size()) {
+        const size_t length = std::min<size_t>(random() % 4097U, data.size() - position);
+        TEST_ASSERT_TRUE(generator.update(data.data() + position, length));
+        position += length;
+    }
+    return generator.get_hash_string();
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_known_vectors(void) {
+    for (const Vector& vector : VECTORS) {
+        HashGenerator generator;
+        generator.start(vector.type);
+        TEST_ASSERT_TRUE(generator.update(reinterpret_cast<const uint8_t *>(vector.input), strlen(vector.input)));
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(vector.expected, generator.get_hash_string().c_str(), vector.name);
+    }
+}
+
+// Splitting the data at arbitrary positions, including empty updates, does not change the result
+void test_chunked_updates(void) {
+    const std::vector<uint8_t> data = firmware(65537U);
+    for (const mbedtls_md_type_t type : { MBEDTLS_MD_MD5, MBEDTLS_MD_SHA256, MBEDTLS_MD_SHA512, MD_TYPE_CRC32 }) {
+        HashGenerator whole;
+        whole.start(type);
+        TEST_ASSERT_TRUE(whole.update(data.data(), data.size()));
+        const std::string expected = whole.get_hash_string();
+        HashGenerator chunked;
+        for (uint32_t seed = 1U; seed <= 3U; seed++) {
+            TEST_ASSERT_EQUAL_STRING(expected.c_str(), hash_in_chunks(chunked, type, data, seed).c_str());
+        }
+    }
+}
+
+// The same generator is started again for every update attempt, switching between the algorithms
+void test_restart(void) {
+    HashGenerator generator;
+    generator.start(MBEDTLS_MD_SHA256);
+    TEST_ASSERT_TRUE(generator.update(reinterpret_cast<const uint8_t *>("partial"), 7U));
+    generator.start(MD_TYPE_CRC32);
+    TEST_ASSERT_TRUE(generator.update(reinterpret_cast<const uint8_t *>("123456789"), 9U));
+    TEST_ASSERT_EQUAL_STRING("2639f4cb", generator.get_hash_string().c_str());
+    generator.start(MBEDTLS_MD_SHA256);
+    TEST_ASSERT_TRUE(generator.update(reinterpret_cast<const uint8_t *>("abc"), 3U));
+    TEST_ASSERT_EQUAL_STRING("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", generator.get_hash_string().c_str());
+    generator.start(MBEDTLS_MD_MD5);
+    TEST_ASSERT_TRUE(generator.update(reinterpret_cast<const uint8_t *>("abc"), 3U));
+    TEST_ASSERT_EQUAL_STRING("900150983cd24fb0d6963f7d28e17f72", generator.get_hash_string().c_str());
+}
+
+// The static CRC32 continues a previous value, the delta patch base check relies on that
+void test_crc32_continuation(void) {
+    const uint8_t *check = reinterpret_cast<const uint8_t *>("123456789");
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926U, HashGenerator::crc32(0U, check, 9U));
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926U, HashGenerator::crc32(HashGenerator::crc32(0U, check, 3U), check + 3U, 6U));
+    TEST_ASSERT_EQUAL_HEX32(0U, HashGenerator::crc32(0U, check, 0U));
+}
+
+// Throughput of the algorithms over a firmware sized buffer in OTA chunk sized updates
+void test_benchmark(void) {
+    const std::vector<uint8_t> data = firmware(1024U * 1024U);
+    constexpr size_t CHUNK_SIZE = 4096U;
+    const mbedtls_md_type_t types[] = { MD_TYPE_CRC32, MBEDTLS_MD_MD5, MBEDTLS_MD_SHA256 };
+    const char *names[] = { "CRC32", "MD5", "SHA256" };
+    char message[160] = "MB/s:";
+    for (size_t i = 0U; i < sizeof(types) / sizeof(types[0U]); i++) {
+        HashGenerator generator;
+        const auto start = std::chrono::steady_clock::now();
+        generator.start(types[i]);
+        for (size_t position = 0U; position < data.size(); position += CHUNK_SIZE) {
+            generator.update(data.data() + position, CHUNK_SIZE);
+        }
+        TEST_ASSERT_FALSE(generator.get_hash_string().empty());
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        const size_t used = strlen(message);
+        snprintf(message + used, sizeof(message) - used, " %s %.0f", names[i], data.size() / seconds / (1024.0 * 1024.0));
+    }
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_known_vectors);
+    RUN_TEST(test_chunked_updates);
+    RUN_TEST(test_restart);
+    RUN_TEST(test_crc32_continuation);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
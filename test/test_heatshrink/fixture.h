@@ -0,0 +1,2053 @@
+// Tạo bởi make_fixture.py từ tools/ota_compress.py, không sửa trực tiếp
+#ifndef HEATSHRINK_FIXTURE_H
+#define HEATSHRINK_FIXTURE_H
+
+#include <stdint.h>
+
+constexpr uint32_t FIXTURE_SOURCE_SIZE = 49152U;
+constexpr uint32_t FIXTURE_TARGET_SIZE = 50352U;
+constexpr uint32_t FIXTURE_TARGET_CRC = 0xCEA869C6U;
+constexpr uint32_t FIXTURE_SMALL_WINDOW_SIZE = 8192U;
+constexpr uint32_t FIXTURE_SMALL_WINDOW_CRC = 0x05B12AFAU;
+constexpr uint32_t FIXTURE_PATCH_SIZE = 8092U;
+
+constexpr uint8_t FIXTURE_IMAGE[] = {
+    0x54, 0x42, 0x5A, 0x31, 0x0B, 0x04, 0x00, 0x00, 0xB0, 0xC4, 0x00, 0x00, 0x94, 0xDB, 0xA3, 0x1C,
+    0x5A, 0x8E, 0xDB, 0x71, 0xF4, 0xD0, 0x59, 0x37, 0xDF, 0xC0, 0x0B, 0x30, 0x07, 0x3B, 0x44, 0x2A,
+    0x5D, 0xAC, 0xE2, 0x7D, 0x24, 0x14, 0x8E, 0x37, 0x3B, 0x8D, 0x8C, 0x00, 0x33, 0xE4, 0xDC, 0xF8,
+    0x5E, 0x78, 0x8D, 0x2F, 0x63, 0x3A, 0x8A, 0xFA, 0xAC, 0xB3, 0x59, 0xF5, 0xF3, 0xC7, 0xEA, 0xDF,
+    0xEF, 0xAA, 0x92, 0xDF, 0xD4, 0x4F, 0xA5, 0x0F, 0x03, 0x73, 0xBD, 0xE6, 0xFD, 0xB4, 0xCE, 0x06,
+    0x7A, 0xA7, 0x14, 0xA6, 0xF8, 0xB5, 0x12, 0x98, 0x05, 0x1A, 0x35, 0xBE, 0x02, 0x33, 0xB4, 0xEB,
+    0x7B, 0x5F, 0x6C, 0x44, 0x1E, 0x75, 0x70, 0x84, 0x41, 0x21, 0x9C, 0x90, 0x3F, 0x3F, 0xC4, 0xF7,
+    0x7F, 0x69, 0xD6, 0x74, 0x20, 0x7F, 0x80, 0x5B, 0x3D, 0xC5, 0x4B, 0x2B, 0xFD, 0x03, 0x73, 0xCC,
+    0x58, 0xF1, 0x9B, 0xD0, 0x6F, 0x39, 0x0E, 0xA6, 0x97, 0xCF, 0x00, 0xF3, 0xC2, 0x43, 0x71, 0xDE,
+    0xA0, 0x43, 0x3C, 0xA7, 0xEB, 0x89, 0x40, 0x00, 0x37, 0xCC, 0x6B, 0x36, 0x78, 0x10, 0x47, 0x30,
+    0x8B, 0x3E, 0x25, 0x96, 0x41, 0x48, 0x02, 0x33, 0x00, 0xF3, 0x08, 0xB3, 0x05, 0x33, 0x07, 0xB3,
+    0x05, 0x33, 0x07, 0x33, 0x01, 0xB3, 0x02, 0xF3, 0x04, 0xF7, 0xA0, 0x6D, 0xA7, 0xBE, 0x60, 0xC7,
+    0x30, 0x7F, 0x30, 0x8F, 0x30, 0x23, 0x3B, 0x87, 0x1B, 0x85, 0x09, 0x86, 0x4B, 0xFF, 0x72, 0x90,
+    0x37, 0x38, 0xED, 0x3F, 0x95, 0x89, 0x01, 0xF3, 0x01, 0x73, 0x8C, 0x72, 0xA2, 0xDA, 0x0E, 0x4E,
+    0x0F, 0x85, 0xE7, 0x84, 0x46, 0xAB, 0x5C, 0x90, 0x83, 0x30, 0x97, 0x30, 0x73, 0x30, 0xEB, 0x3B,
+    0x07, 0x87, 0x47, 0x51, 0x00, 0xF3, 0x86, 0x49, 0x61, 0xF4, 0xE0, 0xF3, 0x38, 0x44, 0x57, 0xBF,
+    0x4F, 0x06, 0x37, 0xFC, 0xE9, 0xE0, 0x9C, 0x10, 0xD7, 0x30, 0x0F, 0x30, 0x8F, 0x30, 0x3B, 0x30,
+    0x07, 0x30, 0x1B, 0x30, 0xA3, 0x30, 0x3F, 0x30, 0x0F, 0x3D, 0x1C, 0x92, 0xB7, 0x15, 0x0A, 0x73,
+    0x09, 0xF3, 0xFC, 0x02, 0x39, 0x00, 0x79, 0x80, 0xD9, 0x82, 0x79, 0x80, 0x59, 0x81, 0xF9, 0x85,
+    0x39, 0x82, 0x59, 0xDE, 0x35, 0x95, 0x6E, 0x50, 0xAF, 0x98, 0x7F, 0x98, 0x41, 0x98, 0x57, 0x98,
+    0x97, 0xA7, 0xEF, 0x3F, 0x44, 0x02, 0x33, 0x94, 0x42, 0xF6, 0x9A, 0xAE, 0x07, 0x1B, 0xE5, 0x51,
+    0x03, 0xF3, 0x04, 0xF3, 0x01, 0xF3, 0x08, 0x37, 0x0D, 0x73, 0x10, 0x73, 0x17, 0x34, 0x06, 0x72,
+    0x01, 0xF3, 0x06, 0x33, 0x00, 0xF3, 0x0E, 0x73, 0x09, 0xF3, 0xEC, 0x7A, 0x69, 0xB8, 0xC0, 0x17,
+    0x30, 0xD3, 0x40, 0x3B, 0x21, 0x03, 0x30, 0x2B, 0x3A, 0xC5, 0x1E, 0x3D, 0x18, 0x06, 0xF3, 0x03,
+    0xF3, 0x0D, 0x73, 0xCE, 0xE8, 0xF3, 0x5E, 0xE0, 0x03, 0x30, 0xC7, 0x31, 0x73, 0x30, 0xBF, 0x30,
+    0x4B, 0x30, 0x2F, 0x30, 0x9B, 0x30, 0x0F, 0x3A, 0x07, 0xA6, 0x01, 0x55, 0x0A, 0xB3, 0x02, 0x73,
+    0xAC, 0x79, 0x7E, 0xDA, 0xC0, 0x4F, 0x30, 0x23, 0x30, 0x1F, 0x70, 0xA3, 0x32, 0x0F, 0x70, 0xFB,
+    0x70, 0x1B, 0x30, 0x87, 0x3F, 0x44, 0x9B, 0x23, 0x5D, 0x09, 0x73, 0x03, 0xB3, 0x02, 0x33, 0xF4,
+    0x40, 0xBA, 0xB4, 0xB0, 0x33, 0x30, 0x1B, 0x30, 0xEF, 0x30, 0x03, 0x38, 0x87, 0x3B, 0xB7, 0x91,
+    0x08, 0xF3, 0x19, 0xB3, 0x0D, 0xF3, 0x00, 0xB3, 0x1B, 0x73, 0x0B, 0xF7, 0x03, 0xF3, 0x09, 0xB3,
+    0x18, 0xB7, 0x01, 0xB3, 0x0C, 0x33, 0x0B, 0x33, 0xBC, 0x58, 0xA7, 0x71, 0xC0, 0x0B, 0x32, 0x23,
+    0x7D, 0x06, 0xF6, 0x51, 0xED, 0x02, 0xF3, 0x09, 0xF3, 0x06, 0x33, 0x0A, 0xB3, 0x23, 0x77, 0x01,
+    0x73, 0x16, 0xB7, 0x12, 0xB7, 0x05, 0xF3, 0x00, 0x33, 0x19, 0xF3, 0x05, 0xB3, 0x1C, 0x73, 0x08,
+    0x33, 0x02, 0x33, 0x06, 0x73, 0x00, 0xB3, 0x01, 0xB3, 0x09, 0xB3, 0x11, 0x33, 0x0E, 0x33, 0x00,
+    0x73, 0x08, 0xF7, 0xF4, 0x5B, 0x75, 0x9F, 0xFF, 0x07, 0x22, 0x77, 0x30, 0x0E, 0xF3, 0x19, 0xF3,
+    0x02, 0xB3, 0x0F, 0xF3, 0x12, 0xF3, 0x02, 0x33, 0x01, 0x73, 0x15, 0xB7, 0xD8, 0x75, 0xB2, 0x37,
+    0xB0, 0x0F, 0x3F, 0x44, 0x3B, 0xB3, 0xA9, 0x06, 0x73, 0x06, 0x33, 0x02, 0xB3, 0xB8, 0x6F, 0x61,
+    0xB2, 0x50, 0x37, 0x30, 0x5B, 0x30, 0x03, 0x30, 0x57, 0x3B, 0x04, 0xC6, 0x81, 0xE5, 0x01, 0xF3,
+    0x12, 0x77, 0xB4, 0x6C, 0xAD, 0x3A, 0xD0, 0x77, 0x30, 0xE3, 0x30, 0x5B, 0x31, 0x3B, 0x70, 0x37,
+    0x30, 0x23, 0x30, 0x5F, 0x31, 0x63, 0x3A, 0x86, 0xD2, 0x1B, 0xD4, 0x08, 0xB7, 0x0F, 0x33, 0x1C,
+    0xF7, 0x00, 0x33, 0x0E, 0x73, 0x08, 0xB3, 0x02, 0x73, 0x15, 0xB3, 0x0D, 0xF3, 0x03, 0xF3, 0x02,
+    0xB3, 0x08, 0x73, 0x0E, 0xB3, 0x04, 0x73, 0x05, 0xF3, 0x01, 0x73, 0x24, 0xB7, 0x08, 0x73, 0xC8,
+    0x74, 0xBA, 0x94, 0x90, 0x57, 0x3C, 0x45, 0x33, 0x11, 0xB7, 0x39, 0xB7, 0x11, 0x33, 0x15, 0xF7,
+    0x25, 0xF7, 0xB4, 0x70, 0x29, 0x70, 0x10, 0x07, 0x31, 0x8F, 0x30, 0x9B, 0x70, 0x0B, 0x30, 0x63,
+    0x32, 0x6F, 0x70, 0x77, 0x30, 0x8F, 0x3B, 0xC6, 0x7B, 0x35, 0x6A, 0x04, 0x33, 0x04, 0xB7, 0x05,
+    0x73, 0x19, 0x73, 0x0F, 0x77, 0x13, 0xF7, 0x09, 0x73, 0x2F, 0xB7, 0x19, 0x37, 0x1C, 0x73, 0x45,
+    0x77, 0x03, 0xB3, 0x1D, 0x77, 0x4B, 0x37, 0x2C, 0xB7, 0x07, 0xB3, 0x07, 0x73, 0x05, 0x73, 0x3B,
+    0xF7, 0x37, 0x77, 0x0B, 0x73, 0x07, 0xB3, 0xCC, 0x79, 0xF9, 0xBE, 0x30, 0x4B, 0x35, 0x0F, 0x70,
+    0xB7, 0x30, 0x37, 0x31, 0x13, 0x70, 0x03, 0x34, 0x5B, 0x7B, 0xC6, 0xBE, 0x7D, 0x07, 0x88, 0x41,
+    0x3D, 0x38, 0x80, 0x9F, 0x30, 0x0F, 0x3C, 0x84, 0x2F, 0x7B, 0x59, 0x22, 0xF7, 0x21, 0x77, 0x06,
+    0xF3, 0x05, 0x73, 0x3A, 0xB7, 0x05, 0x33, 0xA8, 0x61, 0xF0, 0x1A, 0x60, 0x33, 0x30, 0xFF, 0x30,
+    0xCB, 0x31, 0x63, 0x70, 0x57, 0x30, 0x2F, 0x30, 0x0B, 0x3E, 0x47, 0xF7, 0xFF, 0xDE, 0x07, 0x33,
+    0x0E, 0x33, 0x0A, 0x73, 0x50, 0xF4, 0x2E, 0x76, 0x05, 0x73, 0xEC, 0x61, 0x32, 0xD0, 0x40, 0xDB,
+    0x31, 0xA7, 0x70, 0x73, 0x30, 0x4F, 0x39, 0x86, 0x42, 0x11, 0x1E, 0x01, 0x33, 0x05, 0x33, 0x32,
+    0xF7, 0x04, 0xF3, 0x03, 0xB3, 0x04, 0xB3, 0x20, 0xF7, 0x12, 0x73, 0x47, 0xF7, 0xB0, 0x42, 0x79,
+    0x70, 0x51, 0xCF, 0x42, 0x37, 0x61, 0xF7, 0x72, 0x17, 0x3B, 0x05, 0x13, 0xDD, 0x0B, 0x01, 0x33,
+    0x0B, 0xB3, 0x0D, 0x33, 0xE8, 0x7B, 0x2E, 0x75, 0xC0, 0x1F, 0x35, 0xB7, 0x73, 0x9F, 0x70, 0x6B,
+    0x30, 0x53, 0x3D, 0xC4, 0xD2, 0x7B, 0x6E, 0x14, 0xB7, 0x44, 0xB7, 0x00, 0x33, 0xE8, 0x42, 0xB6,
+    0x17, 0xA5, 0x2B, 0x40, 0xD3, 0x20, 0x77, 0x38, 0x45, 0xAE, 0x93, 0x90, 0x03, 0xB3, 0x0D, 0xB3,
+    0xBC, 0x7E, 0x24, 0xDE, 0x41, 0x9F, 0x3F, 0x07, 0xFA, 0x19, 0x56, 0x84, 0x76, 0xF8, 0x7F, 0x32,
+    0xCB, 0x32, 0x8F, 0x70, 0xB7, 0x35, 0x9F, 0x70, 0x67, 0x73, 0x9B, 0x40, 0x47, 0x20, 0x0B, 0x30,
+    0x6B, 0x30, 0x43, 0x31, 0x3B, 0x38, 0x84, 0xF7, 0x4B, 0xC0, 0x09, 0x33, 0x00, 0xB3, 0x94, 0x6A,
+    0xFC, 0x5C, 0xB1, 0x3F, 0x70, 0x5B, 0x30, 0x0B, 0x30, 0x27, 0x70, 0x33, 0x34, 0xF7, 0x70, 0x1B,
+    0x31, 0x03, 0x3F, 0x04, 0xAB, 0x41, 0x56, 0x14, 0xF3, 0x6E, 0xF7, 0x0E, 0xB3, 0x10, 0x33, 0x9A,
+    0x81, 0x79, 0x04, 0x39, 0x82, 0x39, 0xE2, 0x3A, 0x76, 0xDF, 0xA8, 0xC7, 0xA0, 0x25, 0x97, 0x02,
+    0x27, 0x3A, 0x9A, 0x00, 0xB9, 0x86, 0x59, 0x80, 0x99, 0xEE, 0x32, 0xFA, 0xC8, 0x1A, 0xEF, 0xA5,
+    0x73, 0xA5, 0x0F, 0x4B, 0xB7, 0x69, 0xB7, 0x84, 0x4A, 0xAE, 0xFF, 0xF0, 0x97, 0x31, 0x43, 0x31,
+    0xA7, 0x30, 0x03, 0x33, 0x2F, 0x71, 0x23, 0x30, 0x67, 0x30, 0x8F, 0x39, 0x44, 0x9A, 0xFB, 0xDD,
+    0x00, 0xB3, 0x05, 0x33, 0x03, 0xB3, 0x03, 0x33, 0x0E, 0xB3, 0xE8, 0x6A, 0x75, 0xBD, 0xA0, 0x07,
+    0x30, 0x9F, 0x30, 0x63, 0x30, 0x77, 0x32, 0x5B, 0x70, 0x3F, 0x36, 0xB7, 0x70, 0xCB, 0x30, 0x17,
+    0x30, 0x1F, 0x3D, 0x84, 0xEE, 0x67, 0xB8, 0x06, 0x33, 0xE0, 0x7A, 0x33, 0x6D, 0x16, 0x80, 0xAE,
+    0x60, 0x3E, 0x60, 0x26, 0x62, 0x56, 0x90, 0x98, 0x94, 0xCE, 0x11, 0x31, 0x9B, 0x4D, 0x01, 0x9C,
+    0xC3, 0xAC, 0xF5, 0x9D, 0x0B, 0x47, 0xE0, 0x27, 0xCD, 0xAF, 0xD1, 0x91, 0xD9, 0x58, 0xDE, 0xA3,
+    0xE5, 0xDC, 0x7D, 0x19, 0x7D, 0xD9, 0xCE, 0xC0, 0x3C, 0xC2, 0x4C, 0xE6, 0x16, 0x79, 0xAC, 0x80,
+    0x0A, 0xCC, 0x69, 0xCC, 0x2E, 0xDC, 0x5A, 0xCC, 0x45, 0xCC, 0x6C, 0xDC, 0xAA, 0xDC, 0x6C, 0xDC,
+    0x20, 0xCC, 0x0B, 0xCD, 0x89, 0xDD, 0x06, 0xDD, 0x4A, 0xDC, 0x17, 0xCC, 0x00, 0xCC, 0x66, 0xCC,
+    0x0C, 0xCC, 0x08, 0xCC, 0x00, 0xCC, 0x0B, 0xCC, 0xCA, 0xDC, 0x33, 0xDC, 0x51, 0xCC, 0x98, 0xCC,
+    0x03, 0xCD, 0xE1, 0xDC, 0x27, 0xDC, 0x16, 0xDC, 0x38, 0xCC, 0x32, 0xCF, 0x41, 0xE4, 0xC4, 0xEC,
+    0x59, 0x0D, 0xE9, 0x1E, 0xC9, 0x8E, 0x94, 0x1B, 0xCC, 0x09, 0xCD, 0x81, 0xDC, 0x02, 0xDC, 0x0D,
+    0xCD, 0x0B, 0xDC, 0xA1, 0xEC, 0x97, 0xDC, 0x17, 0xCE, 0x81, 0xBD, 0xDD, 0x52, 0x41, 0xAC, 0xC0,
+    0x9C, 0xC0, 0xBC, 0xC1, 0xFC, 0xC2, 0xAC, 0xC5, 0x0C, 0xC0, 0x5C, 0xC4, 0x0C, 0xF9, 0x15, 0x5C,
+    0xEF, 0x04, 0x57, 0xD6, 0x07, 0xF8, 0x1A, 0xB3, 0xD0, 0x60, 0xAD, 0x15, 0x11, 0xC7, 0x70, 0x1F,
+    0x30, 0x03, 0x30, 0x2B, 0x36, 0x73, 0x72, 0xCF, 0x70, 0x97, 0x30, 0x0F, 0x37, 0x3B, 0x74, 0x2F,
+    0x70, 0x2B, 0x31, 0x53, 0x30, 0x7F, 0x30, 0x93, 0x30, 0x13, 0x36, 0x67, 0x40, 0x33, 0x21, 0x4F,
+    0x70, 0x37, 0x34, 0xB3, 0x70, 0x13, 0x30, 0x6F, 0x3A, 0xC5, 0xBE, 0xE3, 0x63, 0x07, 0x33, 0x18,
+    0x33, 0x06, 0x33, 0x03, 0x73, 0x12, 0xB3, 0x09, 0x73, 0x04, 0x73, 0x06, 0xF7, 0x51, 0x74, 0xA9,
+    0x40, 0xF3, 0x8D, 0x1E, 0xE0, 0x4E, 0x69, 0xBE, 0xE0, 0x46, 0x60, 0x0E, 0x60, 0xB6, 0x61, 0x0E,
+    0x67, 0x9E, 0x97, 0x8B, 0x55, 0xE8, 0x0F, 0xCC, 0x4E, 0xCC, 0x13, 0xCC, 0x55, 0xCC, 0x10, 0xCC,
+    0x3C, 0xCC, 0x7B, 0xDC, 0x0A, 0xCF, 0x81, 0x25, 0xD0, 0x7B, 0x44, 0x7C, 0xC3, 0xAD, 0xC2, 0x2C,
+    0xC1, 0x2C, 0xC8, 0x7D, 0xC0, 0x6C, 0xCD, 0x8D, 0x0B, 0x5D, 0xBB, 0x1D, 0xAF, 0xDE, 0x27, 0x11,
+    0xD2, 0xDA, 0x69, 0x9D, 0x9D, 0xCE, 0x6D, 0xEC, 0x15, 0x4E, 0x89, 0xB9, 0xA1, 0x93, 0xB8, 0x25,
+    0x9A, 0xDF, 0xB8, 0x23, 0x98, 0x57, 0x9A, 0xD1, 0xB8, 0x77, 0xB8, 0x0F, 0x9A, 0x01, 0xC1, 0x61,
+    0xB3, 0x75, 0xB8, 0x23, 0x98, 0x67, 0x99, 0x23, 0x98, 0xA9, 0x9B, 0x2B, 0xBB, 0x2D, 0xB8, 0x23,
+    0x98, 0x11, 0x98, 0x25, 0x98, 0x09, 0x98, 0xF5, 0xB8, 0x09, 0x9E, 0xA2, 0x57, 0xA7, 0xB6, 0x02,
+    0x39, 0xF6, 0x2B, 0xB0, 0x32, 0xB3, 0x40, 0x4F, 0x39, 0x46, 0x8A, 0x0F, 0x44, 0x0E, 0x33, 0x02,
+    0xF3, 0x2B, 0x37, 0x6E, 0xF7, 0x31, 0x77, 0x05, 0x73, 0x36, 0x77, 0xEC, 0x5B, 0xEF, 0x1F, 0x81,
+    0x37, 0x30, 0x17, 0x30, 0x5B, 0x30, 0x0B, 0x30, 0x8B, 0x30, 0x1F, 0x30, 0xCF, 0x34, 0xCB, 0x49,
+    0x0F, 0x6A, 0x8A, 0x06, 0x66, 0x0A, 0xE7, 0x80, 0x9D, 0xC6, 0xFA, 0x80, 0x36, 0x60, 0xA6, 0x67,
+    0x8E, 0x9C, 0xE8, 0xB4, 0x70, 0x48, 0xCC, 0xC4, 0xDC, 0x25, 0xCC, 0x10, 0xCC, 0x03, 0xCC, 0x11,
+    0xCC, 0x4D, 0xCD, 0x07, 0xDD, 0xB7, 0xD0, 0x20, 0xC9, 0x38, 0xDC, 0x44, 0xCC, 0x00, 0xCC, 0x0C,
+    0xCC, 0x17, 0xCC, 0xEE, 0xDC, 0x9B, 0xDC, 0xD2, 0xDC, 0xA4, 0xDD, 0xF4, 0xD3, 0xCF, 0x72, 0x57,
+    0x74, 0x07, 0x33, 0x05, 0xF3, 0x06, 0x73, 0x00, 0xF7, 0x06, 0xB3, 0xA4, 0x42, 0x79, 0xBC, 0x65,
+    0x3B, 0x70, 0x0F, 0x3E, 0x05, 0xB2, 0xC5, 0x5C, 0x7F, 0x37, 0x00, 0x33, 0x05, 0x33, 0x1A, 0x33,
+    0xB8, 0x47, 0xA8, 0x12, 0x34, 0x4B, 0x72, 0x6B, 0x30, 0x8F, 0x30, 0x7F, 0x30, 0x4B, 0x30, 0x6B,
+    0x30, 0x0B, 0x34, 0x8B, 0xBB, 0xC7, 0x06, 0xEF, 0x67, 0x18, 0x77, 0x07, 0x73, 0x01, 0x33, 0x05,
+    0xF3, 0x0F, 0x37, 0x04, 0x33, 0x18, 0x33, 0x27, 0xF7, 0x25, 0x77, 0x38, 0xBB, 0x90, 0x41, 0xF3,
+    0x1A, 0xD0, 0x33, 0x38, 0x05, 0x96, 0x0B, 0x19, 0x04, 0x33, 0x01, 0x33, 0xEC, 0x55, 0x26, 0x32,
+    0xB2, 0x3B, 0x74, 0xFF, 0x80, 0x17, 0x22, 0x4B, 0x7D, 0x04, 0x5A, 0xD5, 0x65, 0x0B, 0x73, 0x04,
+    0x33, 0x0B, 0xB3, 0x72, 0x77, 0x1C, 0xF3, 0x07, 0x73, 0xD8, 0x7C, 0xAC, 0xB1, 0x00, 0x1B, 0x31,
+    0x63, 0x3D, 0x85, 0x6E, 0x73, 0xCC, 0x35, 0xF7, 0x02, 0x73, 0x46, 0x77, 0x70, 0xB7, 0x09, 0x33,
+    0x75, 0xF7, 0x08, 0x73, 0x0C, 0x33, 0x47, 0x34, 0x06, 0xF2, 0x98, 0x53, 0x3A, 0x99, 0xB0, 0x5F,
+    0x31, 0x87, 0x70, 0x03, 0x3F, 0x84, 0x32, 0xED, 0x38, 0x25, 0x77, 0x02, 0x33, 0x01, 0xF3, 0x0E,
+    0x73, 0x00, 0x73, 0x00, 0x33, 0x0A, 0xF3, 0x06, 0xB3, 0x4D, 0xF7, 0x05, 0xB3, 0xA0, 0x77, 0xA4,
+    0x1D, 0x30, 0x97, 0x3C, 0x05, 0x66, 0x89, 0x67, 0x01, 0x33, 0x1B, 0xB4, 0x14, 0x32, 0x12, 0x73,
+    0xE4, 0x7C, 0xF7, 0x41, 0x8E, 0x80, 0x96, 0x7A, 0x8F, 0xFD, 0xC0, 0x1D, 0xD0, 0xC1, 0xDC, 0x0A,
+    0xCD, 0x2F, 0xDC, 0xCA, 0xD1, 0xE5, 0xCF, 0x17, 0xC5, 0xE3, 0x01, 0xF9, 0xB0, 0x5B, 0xE6, 0x39,
+    0x31, 0x18, 0x58, 0x1F, 0x98, 0x25, 0x98, 0x77, 0x9A, 0x45, 0xB9, 0x21, 0xB8, 0x09, 0x9B, 0x27,
+    0xCA, 0x77, 0xB1, 0xBB, 0xB1, 0x49, 0xBC, 0xC2, 0x07, 0x17, 0xB6, 0x42, 0x3C, 0x95, 0x98, 0x10,
+    0x6B, 0x98, 0x09, 0x9D, 0x03, 0x15, 0x4B, 0xD2, 0x00, 0xB9, 0xF4, 0x24, 0xF1, 0x0E, 0x30, 0x63,
+    0x98, 0x23, 0x98, 0xC5, 0xB8, 0xB1, 0x9B, 0x1F, 0xDC, 0x83, 0x75, 0x92, 0xCE, 0x86, 0x5B, 0xAC,
+    0x5B, 0xFA, 0x35, 0xBE, 0x0A, 0xC0, 0x11, 0x9F, 0x23, 0x8F, 0x1F, 0x94, 0x81, 0x79, 0x81, 0x59,
+    0x9E, 0xFB, 0x80, 0x39, 0xB8, 0x1A, 0x69, 0x6C, 0xFD, 0xD0, 0x33, 0x31, 0x5B, 0x70, 0x43, 0x30,
+    0x1F, 0x39, 0x45, 0xAE, 0xCD, 0xBD, 0x5B, 0xF7, 0x04, 0xF7, 0x00, 0x73, 0x20, 0x33, 0xC4, 0x7B,
+    0xEF, 0xBA, 0x41, 0x87, 0x70, 0x13, 0x30, 0xAF, 0x32, 0xFF, 0x42, 0xDB, 0x66, 0x4F, 0x77, 0x83,
+    0x74, 0x3B, 0x34, 0xD3, 0x70, 0xAB, 0x32, 0xD7, 0x70, 0xFF, 0x30, 0x07, 0x30, 0x2F, 0x30, 0x03,
+    0x30, 0x4F, 0x30, 0x0F, 0x30, 0x2F, 0x32, 0x23, 0x79, 0x84, 0xAB, 0xD3, 0xDA, 0x2A, 0xB7, 0x01,
+    0x33, 0x0A, 0x73, 0x02, 0x33, 0x00, 0x33, 0xF0, 0x6C, 0xE8, 0x9A, 0x80, 0x2B, 0x30, 0x4F, 0x31,
+    0x5F, 0x31, 0x57, 0x30, 0x5F, 0x36, 0x03, 0x71, 0x43, 0x3F, 0x06, 0x46, 0x6F, 0x88, 0x5E, 0x77,
+    0xFC, 0x65, 0x22, 0x38, 0x41, 0x7B, 0x70, 0x4B, 0x30, 0x33, 0x30, 0x83, 0x30, 0xBF, 0x30, 0x7F,
+    0x30, 0x33, 0x30, 0x73, 0x34, 0xE3, 0x70, 0x1F, 0x30, 0x27, 0x30, 0x7F, 0x30, 0xD7, 0x3A, 0xC6,
+    0x82, 0x03, 0xAF, 0x06, 0xB3, 0x03, 0xF7, 0x2A, 0xB7, 0x66, 0xF7, 0x00, 0xF3, 0x6A, 0xB7, 0x01,
+    0xF3, 0x00, 0xB3, 0x03, 0x73, 0x3D, 0xB7, 0x12, 0x77, 0x32, 0xB7, 0x88, 0x7A, 0x7E, 0xD9, 0xE0,
+    0x77, 0x30, 0x5F, 0x30, 0x23, 0x30, 0x1F, 0x32, 0x8B, 0x4F, 0x34, 0xB3, 0x48, 0x33, 0x67, 0x18,
+    0xBB, 0x53, 0xA1, 0x20, 0xBE, 0x7E, 0x8F, 0x95, 0xB7, 0x7D, 0xF0, 0xD6, 0x4B, 0xA0, 0xD2, 0x8B,
+    0x06, 0xA3, 0x4A, 0x01, 0xE7, 0x88, 0xF7, 0x7B, 0xF8, 0x82, 0x0E, 0x78, 0x8E, 0x2C, 0xD2, 0x2E,
+    0x77, 0x69, 0xEC, 0xE4, 0xC3, 0x02, 0xBC, 0xC1, 0xDC, 0xC7, 0x0D, 0xC1, 0xBD, 0x34, 0x51, 0x9E,
+    0x38, 0x6F, 0x98, 0x29, 0x9D, 0xC2, 0x23, 0x21, 0x85, 0x01, 0x99, 0xAA, 0x7B, 0x8C, 0x59, 0xE0,
+    0x32, 0xBB, 0xFC, 0x91, 0x69, 0xB8, 0x01, 0xBB, 0x07, 0xA7, 0xC7, 0x5D, 0x05, 0x50, 0x77, 0x2B,
+    0x33, 0x05, 0x73, 0x05, 0x33, 0x80, 0x7F, 0xBE, 0x10, 0x58, 0xC6, 0x42, 0x5D, 0x5C, 0x06, 0x33,
+    0x21, 0xB3, 0xE8, 0x47, 0xE8, 0xF7, 0x76, 0x67, 0x77, 0x0B, 0x70, 0xEF, 0x32, 0x27, 0x70, 0x3B,
+    0x31, 0x07, 0x70, 0x5B, 0x30, 0x7B, 0x30, 0xA7, 0x34, 0x93, 0x70, 0x53, 0x30, 0x17, 0x31, 0x3F,
+    0x74, 0xCF, 0x7D, 0x85, 0x63, 0x2D, 0x00, 0xB8, 0x64, 0xF0, 0xFB, 0xB4, 0x4B, 0x70, 0x03, 0x30,
+    0x0B, 0x7A, 0x06, 0x73, 0xAB, 0x10, 0x07, 0x33, 0x10, 0x73, 0x00, 0x33, 0x05, 0xB2, 0xF6, 0x01,
+    0x99, 0x86, 0x39, 0xF0, 0x37, 0x1D, 0xAB, 0x0A, 0xED, 0xBC, 0x42, 0x61, 0x6B, 0xD5, 0x81, 0x99,
+    0x80, 0xB9, 0xD6, 0x31, 0x3E, 0x6F, 0xF0, 0x15, 0x98, 0x39, 0x9A, 0x5D, 0xB8, 0x0D, 0x98, 0x43,
+    0x9C, 0xC3, 0xD3, 0xC9, 0xA7, 0x80, 0x99, 0x8F, 0x1B, 0x98, 0xFB, 0xBD, 0x9B, 0xBF, 0xDB, 0x89,
+    0x99, 0xA0, 0xFA, 0x1B, 0x1B, 0x22, 0xFB, 0x80, 0xD9, 0x82, 0xB9, 0x81, 0x39, 0x81, 0x19, 0x82,
+    0xB9, 0xA3, 0x5A, 0x5B, 0xF6, 0x5E, 0x10, 0x1F, 0x30, 0x2B, 0x30, 0xDF, 0x3E, 0x46, 0x47, 0x31,
+    0x1F, 0x8C, 0x5D, 0x32, 0x7B, 0x9C, 0x87, 0xB6, 0x27, 0x35, 0xE0, 0x7C, 0x73, 0x15, 0xCC, 0x87,
+    0x0B, 0x75, 0x16, 0x02, 0xB3, 0x84, 0x5D, 0x38, 0x50, 0x30, 0x57, 0x31, 0x33, 0x30, 0x37, 0x36,
+    0x83, 0x71, 0x37, 0x30, 0x3B, 0x30, 0x87, 0x3C, 0x87, 0x17, 0xF5, 0xD1, 0x05, 0xF3, 0x72, 0x34,
+    0x07, 0xF2, 0x58, 0xB7, 0x00, 0x33, 0xE0, 0x72, 0x62, 0xB2, 0xC0, 0x7F, 0x30, 0xB3, 0x30, 0x07,
+    0x36, 0x37, 0x72, 0xFF, 0x70, 0x9F, 0x3D, 0x45, 0x2A, 0xE3, 0x47, 0x26, 0x73, 0x80, 0x60, 0xED,
+    0x1A, 0xD0, 0x73, 0x30, 0x1F, 0x31, 0x0F, 0x30, 0x1F, 0x3E, 0x07, 0x3F, 0x69, 0xA6, 0x44, 0x77,
+    0x08, 0x73, 0x35, 0xB7, 0x04, 0x73, 0x58, 0x77, 0x04, 0x33, 0x08, 0xB7, 0x0A, 0x33, 0x38, 0xB7,
+    0x00, 0xF3, 0x01, 0xB3, 0x00, 0xF3, 0x06, 0xF3, 0x01, 0xB3, 0x05, 0x33, 0x1C, 0xB3, 0x05, 0x33,
+    0x0C, 0x73, 0x0B, 0x73, 0x08, 0xF7, 0x01, 0x33, 0x19, 0xB3, 0x03, 0xB3, 0x2E, 0xF3, 0xC8, 0x6F,
+    0x6E, 0xD8, 0x10, 0x0F, 0x30, 0x03, 0x30, 0xFF, 0x32, 0x4B, 0x71, 0x5B, 0x74, 0x6B, 0x49, 0x25,
+    0xA2, 0x7E, 0x08, 0x66, 0xBD, 0x6E, 0x14, 0x66, 0x7E, 0x6E, 0x7A, 0x68, 0x2E, 0x64, 0x01, 0xE6,
+    0x03, 0xE6, 0x91, 0x6E, 0x31, 0x6E, 0x0A, 0xE6, 0xA4, 0xEE, 0x09, 0x66, 0x13, 0x67, 0x78, 0x89,
+    0xFC, 0x2F, 0xC1, 0xB6, 0x60, 0x06, 0xE0, 0x66, 0x65, 0x06, 0x60, 0xAE, 0x7D, 0x8E, 0x1D, 0x63,
+    0x30, 0x00, 0xE6, 0x5B, 0xEE, 0x08, 0xE6, 0x00, 0x66, 0x15, 0xE7, 0x60, 0xFB, 0x6C, 0x72, 0x60,
+    0xDE, 0x82, 0xFE, 0x4E, 0x3E, 0x80, 0x0E, 0x56, 0x0E, 0xD6, 0xD7, 0xC2, 0x0F, 0x66, 0x25, 0xE6,
+    0x15, 0xE7, 0x50, 0x8B, 0xE3, 0x31, 0x02, 0x5E, 0x62, 0x0E, 0x62, 0x5E, 0x6E, 0xBE, 0xE3, 0x76,
+    0xE5, 0x36, 0xE7, 0xD6, 0xF6, 0x0C, 0xBF, 0xDB, 0xDC, 0x06, 0xE6, 0x46, 0x6E, 0x34, 0x67, 0x50,
+    0xDB, 0x4C, 0xA4, 0xA1, 0x1E, 0x60, 0x16, 0x60, 0x76, 0x74, 0x8A, 0x4D, 0xAE, 0xAE, 0xEB, 0xEF,
+    0x18, 0xAF, 0x7F, 0x34, 0xE3, 0x4E, 0x62, 0xBE, 0x60, 0x8E, 0x60, 0x66, 0x71, 0x0F, 0x2E, 0x0B,
+    0x4D, 0x00, 0xCC, 0x4C, 0xF7, 0xC8, 0xBF, 0x01, 0xEE, 0x40, 0xEE, 0x7C, 0x8E, 0x46, 0x92, 0xA2,
+    0x38, 0xEE, 0x15, 0xEE, 0x2E, 0xEE, 0x54, 0xEE, 0x01, 0xEE, 0x00, 0x66, 0x5C, 0xEF, 0xD8, 0xD8,
+    0xDE, 0xBA, 0x9F, 0x8F, 0x7D, 0xFF, 0x95, 0x38, 0xB9, 0xE7, 0xB8, 0xE6, 0xE6, 0xE0, 0xFE, 0xE0,
+    0x9E, 0x63, 0x46, 0xE1, 0x0E, 0x68, 0x8E, 0xE2, 0xBE, 0x61, 0x5E, 0x62, 0x96, 0x60, 0xD6, 0x60,
+    0x4E, 0x63, 0x3E, 0x7D, 0x09, 0x3C, 0xA3, 0xA4, 0x06, 0xE6, 0x04, 0x66, 0x67, 0x6E, 0x09, 0xE6,
+    0x01, 0xEF, 0x10, 0xE7, 0xCF, 0xEE, 0x24, 0xC6, 0xE0, 0x0E, 0x79, 0x09, 0x06, 0x4A, 0xFD, 0xD0,
+    0xC3, 0xE1, 0xED, 0x47, 0xBE, 0xEC, 0xC6, 0xE0, 0x5E, 0x6D, 0x66, 0xE0, 0x6E, 0x61, 0x6E, 0x79,
+    0x0F, 0xCE, 0x5F, 0xFE, 0x20, 0xE6, 0x02, 0x66, 0x1A, 0x68, 0x0B, 0x64, 0xD1, 0xEE, 0x11, 0xE6,
+    0x67, 0xEE, 0xC2, 0xEE, 0x98, 0x6E, 0x1C, 0xE6, 0x2B, 0xE6, 0x02, 0xE6, 0x43, 0x6E, 0x01, 0xE6,
+    0xD2, 0xEF, 0xE0, 0x84, 0xE3, 0x68, 0x93, 0x88, 0xE6, 0x7A, 0xA6, 0x04, 0xE6, 0x03, 0x66, 0x1C,
+    0x66, 0x13, 0xE6, 0x5F, 0xEE, 0x08, 0x66, 0x3E, 0x67, 0x50, 0xC1, 0x5A, 0x2D, 0xA1, 0x26, 0x64,
+    0xAE, 0xE0, 0xC6, 0x62, 0xD6, 0xE0, 0x6E, 0xE0, 0x06, 0x80, 0x5E, 0x51, 0x0C, 0xDD, 0x02, 0xEA,
+    0x05, 0x67, 0x98, 0xE8, 0x41, 0xF7, 0x20, 0x3E, 0x60, 0xF6, 0x62, 0x46, 0x6E, 0xA6, 0xED, 0xBE,
+    0xE1, 0x0E, 0x60, 0x76, 0x66, 0x86, 0xE0, 0x3E, 0x62, 0xAE, 0x67, 0x06, 0xE3, 0x1E, 0x69, 0x2E,
+    0xF1, 0x0D, 0x8C, 0x22, 0xAE, 0x07, 0x66, 0xB2, 0xE9, 0xF4, 0x8C, 0x40, 0x96, 0xED, 0xC0, 0x6C,
+    0xC8, 0x5C, 0xC1, 0xBC, 0xC3, 0x4C, 0xE8, 0x1D, 0x08, 0x37, 0x31, 0xFD, 0xDF, 0x11, 0x66, 0xE6,
+    0xDC, 0xD5, 0xFD, 0xD6, 0xAD, 0xC0, 0x3C, 0xC0, 0x6D, 0x1C, 0x0D, 0x82, 0x7C, 0xF5, 0x1E, 0x59,
+    0x55, 0xC4, 0x0C, 0xCC, 0x3C, 0xCC, 0x35, 0xCC, 0x3B, 0xCC, 0x02, 0xCE, 0x11, 0xBF, 0xC0, 0xC7,
+    0xE7, 0x1C, 0xCB, 0xAC, 0x90, 0x16, 0xDF, 0x31, 0x74, 0x9E, 0xC5, 0x00, 0x5C, 0xF3, 0x10, 0x0D,
+    0xC4, 0x80, 0x4E, 0xCC, 0x20, 0xCC, 0x0D, 0xCE, 0xA1, 0x61, 0xA7, 0x6E, 0xC5, 0xDD, 0xE7, 0x1D,
+    0x49, 0xCD, 0x99, 0xB7, 0xDC, 0x2E, 0xCD, 0x2E, 0xDC, 0x03, 0xCC, 0x02, 0xCC, 0xEC, 0xDC, 0x0B,
+    0xCC, 0x76, 0xCC, 0xC6, 0xD3, 0x7F, 0xE3, 0xAE, 0x03, 0x19, 0xC8, 0x32, 0x97, 0x19, 0xA0, 0x49,
+    0x9F, 0xE3, 0xB1, 0x40, 0x3A, 0xB4, 0xB0, 0x45, 0x69, 0x13, 0x70, 0x9F, 0x30, 0x37, 0x30, 0xE7,
+    0x30, 0x7B, 0x39, 0x87, 0x62, 0xB9, 0xFD, 0x05, 0x37, 0x0A, 0x73, 0x22, 0xB3, 0x12, 0xF3, 0xE0,
+    0x4D, 0xBB, 0x79, 0x10, 0x43, 0x30, 0x57, 0x30, 0x0F, 0x3B, 0x47, 0x86, 0xB7, 0x16, 0x11, 0xF3,
+    0x0E, 0xF3, 0x01, 0x73, 0x07, 0x37, 0xD8, 0x5D, 0x24, 0x13, 0xF1, 0x43, 0x37, 0xF3, 0x70, 0x7F,
+    0x3F, 0x47, 0xDA, 0xBD, 0x61, 0x08, 0xB3, 0x06, 0xB3, 0xB0, 0x5E, 0x73, 0xF2, 0x40, 0x6B, 0x3E,
+    0x45, 0x13, 0xB9, 0x38, 0x20, 0xBB, 0x60, 0x77, 0x02, 0x73, 0xBC, 0x44, 0xAA, 0x90, 0xD0, 0x7F,
+    0x3E, 0xC4, 0x62, 0xEF, 0x72, 0x0E, 0x33, 0x0E, 0xF3, 0x3B, 0xF7, 0x06, 0xB3, 0xE8, 0x53, 0x26,
+    0x12, 0x10, 0xE7, 0x30, 0xC3, 0x38, 0x87, 0x53, 0x5B, 0x14, 0x01, 0xF3, 0x1F, 0xF3, 0x0A, 0xF3,
+    0xBC, 0x78, 0x61, 0xB1, 0x50, 0xF7, 0x70, 0x5F, 0x3E, 0x86, 0x82, 0x95, 0x2C, 0xFC, 0x40, 0xE8,
+    0x77, 0x23, 0x53, 0x70, 0x57, 0x4F, 0xCC, 0x3B, 0x4A, 0x15, 0x66, 0x2B, 0xE6, 0x28, 0xEE, 0x10,
+    0xE6, 0x01, 0xE6, 0x1F, 0x66, 0xE8, 0xEE, 0x11, 0xE7, 0xF0, 0xE3, 0xF0, 0x2E, 0x60, 0x0E, 0x6D,
+    0x9E, 0xE0, 0xEE, 0x72, 0x0C, 0xFF, 0xD2, 0x11, 0xA8, 0xC3, 0xC2, 0xBF, 0x20, 0xFE, 0x66, 0x9E,
+    0xE0, 0x36, 0x61, 0xAE, 0x63, 0x8E, 0x64, 0xB6, 0x62, 0x36, 0x60, 0xA6, 0x60, 0xEE, 0x61, 0x36,
+    0x62, 0x3E, 0x60, 0xF6, 0x62, 0x06, 0x6F, 0x7E, 0xE0, 0xAE, 0x60, 0x3E, 0x64, 0x56, 0x98, 0x6A,
+    0x2D, 0xE8, 0x04, 0xCC, 0x00, 0xCC, 0x12, 0xDC, 0x2B, 0xCC, 0x9E, 0xCC, 0x1E, 0xCC, 0x1D, 0xCC,
+    0xAD, 0xEC, 0x0E, 0xCC, 0x1D, 0xCF, 0xE1, 0xB1, 0xC9, 0x6C, 0x58, 0x1D, 0xC0, 0x6C, 0xC1, 0xFC,
+    0xC0, 0x2C, 0xC4, 0x2C, 0xCB, 0xCD, 0xCC, 0x1D, 0xC0, 0x5C, 0xF7, 0x1A, 0x38, 0x95, 0xAC, 0x45,
+    0xCC, 0x2E, 0xCF, 0x01, 0x59, 0xE1, 0x69, 0x4D, 0xAD, 0xC1, 0x7C, 0xC5, 0x4D, 0xC8, 0x8D, 0x00,
+    0x8C, 0x80, 0xED, 0xFB, 0x1E, 0xF8, 0x3D, 0x71, 0x9F, 0xFC, 0x24, 0xCE, 0x01, 0x09, 0xD5, 0x47,
+    0x40, 0xCC, 0xD8, 0xBD, 0xC0, 0x7C, 0xD9, 0xDD, 0xCD, 0x2D, 0x0E, 0xBC, 0xE6, 0xB6, 0x98, 0x18,
+    0x23, 0x9B, 0xDD, 0xB8, 0x79, 0xB8, 0x0D, 0x98, 0x3D, 0x98, 0x49, 0x9C, 0x22, 0xD3, 0x58, 0x88,
+    0x02, 0xB9, 0x81, 0x1B, 0x87, 0x99, 0x89, 0x99, 0x81, 0x39, 0xF8, 0x34, 0x5C, 0x3D, 0x98, 0x09,
+    0x9E, 0xC2, 0xED, 0x32, 0xEB, 0x86, 0x7B, 0xC2, 0x31, 0x30, 0x6F, 0x28, 0x75, 0x98, 0x11, 0x98,
+    0x0D, 0x98, 0xA7, 0x99, 0x25, 0xB8, 0x29, 0x98, 0xB9, 0xB8, 0x65, 0x98, 0x5F, 0x98, 0x0D, 0x9B,
+    0x43, 0xBA, 0x11, 0xB8, 0x07, 0x98, 0x03, 0x98, 0xAF, 0xDC, 0xA3, 0xCD, 0x2B, 0xA8, 0x1C, 0xFB,
+    0xA1, 0x3B, 0x71, 0x30, 0x12, 0x4F, 0x8F, 0x3B, 0x61, 0x67, 0xA5, 0xE9, 0x80, 0xEC, 0xC2, 0xAC,
+    0xCD, 0xED, 0xC4, 0x0C, 0xC2, 0xCC, 0xC1, 0x9C, 0xC0, 0x3C, 0xD4, 0x0D, 0xC3, 0x0C, 0xC1, 0x4C,
+    0xC0, 0x3C, 0xC0, 0xCC, 0xC2, 0xED, 0x24, 0x93, 0x0D, 0x91, 0x73, 0xB8, 0x43, 0xB8, 0xD3, 0x98,
+    0x13, 0x98, 0x1D, 0x98, 0x21, 0x98, 0x1D, 0x99, 0xF9, 0xB8, 0x05, 0x9C, 0x22, 0x6F, 0xAB, 0xBC,
+    0x82, 0x59, 0x87, 0x39, 0x8E, 0x5B, 0x8B, 0x19, 0x81, 0xB9, 0x86, 0x19, 0x80, 0x39, 0xE8, 0x2A,
+    0xBB, 0x0E, 0xC8, 0x0B, 0x98, 0x5D, 0x9B, 0x3D, 0xD8, 0x9F, 0xBB, 0x5D, 0xBF, 0x82, 0x33, 0x9F,
+    0xDC, 0xB8, 0x7B, 0xE3, 0x13, 0x8D, 0x93, 0x5D, 0xC3, 0x4C, 0xC2, 0x5C, 0xCB, 0x2D, 0xC2, 0x7C,
+    0xFC, 0x10, 0x1F, 0x26, 0x00, 0x21, 0xCF, 0xC1, 0x62, 0xF7, 0x69, 0x80, 0x9C, 0xC0, 0x2C, 0xC1,
+    0x3C, 0xDA, 0xED, 0xD2, 0x4D, 0x3A, 0x1D, 0xC2, 0x6F, 0x47, 0x87, 0x70, 0x6B, 0x30, 0x93, 0x30,
+    0x8B, 0x30, 0x67, 0x30, 0x8F, 0x30, 0x4F, 0x3D, 0x05, 0x4B, 0x19, 0x60, 0x27, 0xF7, 0xF0, 0x4A,
+    0x6B, 0xD7, 0x50, 0x73, 0x3A, 0xC5, 0x6A, 0x39, 0x9F, 0x25, 0xB7, 0x56, 0x37, 0x09, 0x33, 0x0C,
+    0xB3, 0x05, 0xB3, 0x18, 0xF7, 0x07, 0x33, 0x1E, 0x37, 0x79, 0xB4, 0xF2, 0x71, 0xA8, 0xE1, 0x5E,
+    0x60, 0x36, 0x62, 0x56, 0x63, 0x9E, 0xE6, 0x4E, 0xE3, 0x1E, 0x6C, 0x6E, 0xF2, 0x0E, 0x34, 0x7F,
+    0x60, 0x27, 0xE7, 0x80, 0xA4, 0x64, 0x6F, 0xBC, 0x09, 0xD6, 0xB7, 0x88, 0x04, 0x66, 0x02, 0xE6,
+    0x15, 0xE6, 0x43, 0x6E, 0xEA, 0xEE, 0x08, 0xE6, 0x24, 0xE6, 0x36, 0xEE, 0x02, 0xE6, 0x01, 0x66,
+    0x12, 0xE6, 0x2E, 0x66, 0x0E, 0x66, 0x03, 0xE6, 0x18, 0x67, 0x7B, 0x9F, 0x7B, 0x69, 0x8D, 0xD6,
+    0xE0, 0x96, 0x6A, 0xCE, 0xE0, 0x66, 0x60, 0xC6, 0x60, 0xFE, 0x62, 0x1E, 0x61, 0xAE, 0xE3, 0xE6,
+    0xEE, 0xDE, 0xE0, 0x5E, 0x72, 0x8E, 0xFD, 0x1E, 0xAE, 0x03, 0x66, 0x18, 0xEE, 0x02, 0x66, 0x0C,
+    0x66, 0x07, 0xE6, 0xD3, 0xEF, 0x58, 0xC8, 0x72, 0x25, 0x20, 0x46, 0x60, 0x76, 0x61, 0xAE, 0x67,
+    0x1E, 0xE0, 0x86, 0x60, 0xA6, 0x65, 0x76, 0xE0, 0x1E, 0x7E, 0x08, 0x8F, 0x6B, 0x2E, 0x03, 0x67,
+    0x70, 0xE9, 0x7B, 0x21, 0x40, 0xCE, 0x6D, 0x9E, 0x92, 0x58, 0x56, 0x04, 0x2E, 0xCF, 0xC1, 0x90,
+    0xA4, 0xE3, 0x80, 0xEC, 0xC0, 0x2C, 0xC0, 0x1C, 0xC3, 0x0C, 0xC6, 0x9C, 0xC5, 0x8C, 0xF6, 0x17,
+    0xCE, 0x56, 0x50, 0x02, 0xCC, 0x97, 0xCD, 0x2A, 0xDD, 0x10, 0xDC, 0xE8, 0xDC, 0x0D, 0xCC, 0x39,
+    0xDC, 0x53, 0xCE, 0x31, 0x5D, 0xFC, 0xD1, 0x84, 0x2C, 0xD1, 0xFD, 0xD2, 0xFD, 0x3F, 0x7C, 0x9D,
+    0xA0, 0x51, 0x9B, 0xE7, 0xBD, 0x83, 0xCB, 0xEE, 0xA3, 0x27, 0x1B, 0x88, 0xBB, 0x87, 0x7B, 0x81,
+    0x99, 0x85, 0x59, 0x82, 0x79, 0x82, 0x19, 0xF0, 0x2F, 0xBE, 0x7C, 0x00, 0x03, 0x98, 0x15, 0x98,
+    0x67, 0xBB, 0x27, 0xB9, 0x01, 0xBC, 0x83, 0x57, 0xC4, 0xF6, 0xDC, 0x2F, 0x3B, 0x2B, 0x60, 0x4B,
+    0x98, 0x0D, 0x98, 0x57, 0x9B, 0x17, 0xBA, 0x47, 0xB8, 0x3D, 0x98, 0x5D, 0x98, 0x71, 0xBC, 0xA2,
+    0x2D, 0x52, 0xAC, 0x05, 0xB9, 0xB3, 0xBB, 0x83, 0xF9, 0xC8, 0x30, 0x53, 0xAF, 0x88, 0xCF, 0x98,
+    0x47, 0x98, 0x25, 0x98, 0xEF, 0xBC, 0x43, 0x9D, 0x40, 0xEF, 0x83, 0xD9, 0x84, 0xD9, 0xD6, 0x39,
+    0xF4, 0x38, 0x73, 0xBB, 0xB9, 0x67, 0xB8, 0x21, 0x9A, 0xD3, 0xBA, 0x59, 0xB8, 0x4B, 0x98, 0x3D,
+    0x98, 0x1B, 0x98, 0x87, 0x99, 0xBF, 0xB8, 0x1D, 0x98, 0x1B, 0x98, 0x43, 0x9B, 0xEB, 0xB9, 0xF5,
+    0xD8, 0x19, 0x9C, 0x63, 0x81, 0xAD, 0xB1, 0x85, 0xD9, 0xD4, 0x3B, 0x12, 0xCA, 0x9A, 0x59, 0xBA,
+    0xD9, 0xB8, 0x25, 0x98, 0x81, 0x98, 0x01, 0x98, 0x29, 0x98, 0x1B, 0x9A, 0xAF, 0xB9, 0x8F, 0xBB,
+    0x2F, 0xB8, 0xA1, 0xB8, 0x5B, 0x98, 0x1F, 0x98, 0x53, 0x98, 0x1F, 0x98, 0x3D, 0x9A, 0x4D, 0xBA,
+    0xF5, 0xB8, 0x4B, 0x9B, 0x8B, 0xB9, 0xF5, 0xB8, 0x19, 0x9E, 0xC2, 0x75, 0x51, 0x8C, 0x12, 0xBD,
+    0x83, 0x39, 0x81, 0x39, 0x84, 0xB9, 0x85, 0xB9, 0x84, 0x3B, 0xA3, 0x3B, 0x81, 0x99, 0xDE, 0x39,
+    0x7F, 0xDC, 0x88, 0x4B, 0x98, 0x15, 0x98, 0x31, 0x98, 0x15, 0x98, 0x41, 0x98, 0x11, 0x99, 0x91,
+    0xA0, 0xC7, 0x90, 0x21, 0x98, 0x3D, 0x9F, 0x0C, 0x21, 0xCA, 0x5A, 0x16, 0x65, 0x19, 0x01, 0xF2,
+    0x90, 0x80, 0xD9, 0x7F, 0x81, 0x4C, 0xB4, 0xE2, 0x2E, 0x54, 0x4A, 0x64, 0xEF, 0xB3, 0x55, 0x0F,
+    0x72, 0xE4, 0x01, 0x99, 0x61, 0x36, 0xB6, 0x58, 0x0F, 0xF0, 0x0A, 0xCB, 0x48, 0x14, 0x65, 0x88,
+    0x0E, 0xB2, 0xC6, 0x02, 0xB9, 0x00, 0x39, 0x80, 0xD9, 0xD0, 0x83, 0x3C, 0xAA, 0x97, 0xBE, 0x05,
+    0x9E, 0xA2, 0x0F, 0x65, 0xCA, 0x7A, 0x73, 0x08, 0xB2, 0xB6, 0x0D, 0xF9, 0x6C, 0x03, 0x1C, 0x81,
+    0x6C, 0xC0, 0x1C, 0xEF, 0xE0, 0xDE, 0x52, 0x50, 0xA7, 0x20, 0x2F, 0x30, 0x1F, 0x30, 0x33, 0x30,
+    0x23, 0x30, 0x4F, 0x3D, 0xE7, 0x17, 0xF5, 0x31, 0x07, 0x33, 0x05, 0xF3, 0xE6, 0x8D, 0xB9, 0xD8,
+    0xBE, 0x9F, 0x90, 0x07, 0x30, 0x3B, 0x38, 0xA8, 0x51, 0x97, 0xF1, 0x42, 0xCC, 0x16, 0xC8, 0x24,
+    0xCC, 0x28, 0xCC, 0x0F, 0xCC, 0x0B, 0xCE, 0xDA, 0x21, 0x64, 0x00, 0xE6, 0x0B, 0x67, 0xA1, 0x0E,
+    0xB2, 0x02, 0x73, 0xEE, 0x74, 0xA7, 0x74, 0x6F, 0x65, 0x46, 0xF3, 0xB0, 0x04, 0xB3, 0x01, 0x33,
+    0x08, 0xF3, 0x07, 0x33, 0x07, 0xB7, 0x01, 0x33, 0x0B, 0xB3, 0xFE, 0x8C, 0xF9, 0x00, 0x99, 0x82,
+    0x59, 0xE7, 0x25, 0xB2, 0x88, 0xF0, 0x47, 0x98, 0x31, 0xB8, 0x0F, 0x9F, 0xB3, 0x9F, 0x8A, 0xE9,
+    0x00, 0xD9, 0x80, 0x19, 0x81, 0x99, 0x88, 0xF9, 0x81, 0x99, 0x85, 0xFB, 0x82, 0xB9, 0x85, 0xD9,
+    0x82, 0xBB, 0x84, 0xB9, 0xC7, 0x3D, 0x35, 0xED, 0x98, 0x9F, 0x98, 0x43, 0x98, 0x21, 0x9C, 0x40,
+    0x5D, 0xC8, 0x21, 0xCF, 0x38, 0x2F, 0x64, 0x02, 0x66, 0x19, 0x67, 0x5C, 0xF7, 0xE3, 0xFD, 0x20,
+    0x26, 0x61, 0xB6, 0x60, 0x9E, 0x61, 0xCE, 0x60, 0x36, 0x61, 0x96, 0x60, 0x9E, 0x7F, 0x4C, 0xE6,
+    0x07, 0xCC, 0x25, 0xE6, 0x07, 0x68, 0x02, 0xE4, 0x1B, 0xE7, 0xAC, 0xD0, 0x5B, 0xBE, 0x21, 0x3E,
+    0x7B, 0xC8, 0xED, 0xCB, 0x6E, 0x26, 0x66, 0x35, 0x6E, 0x33, 0x67, 0xDC, 0xE8, 0xC4, 0xEC, 0x20,
+    0x6E, 0x62, 0x4E, 0xF3, 0x4D, 0x2C, 0xBA, 0xDE, 0x0B, 0x67, 0x5C, 0xEB, 0x5D, 0xBF, 0xA1, 0x16,
+    0x71, 0x4E, 0x44, 0x73, 0x56, 0x09, 0xE6, 0x0C, 0xE6, 0x09, 0x66, 0x15, 0x66, 0x0E, 0xE6, 0x26,
+    0x66, 0x0C, 0x66, 0x0F, 0xE8, 0x3A, 0xEC, 0x1C, 0xE6, 0x20, 0x66, 0x2F, 0x6E, 0x0B, 0xE6, 0x0A,
+    0x66, 0x08, 0xE6, 0x02, 0xE6, 0x0C, 0x66, 0x19, 0x66, 0x1E, 0x66, 0x05, 0x66, 0x08, 0xE6, 0x04,
+    0xE6, 0x0A, 0x66, 0x00, 0xE6, 0x27, 0x66, 0x0A, 0x66, 0x05, 0xE6, 0x1E, 0x6E, 0x02, 0xE6, 0x3B,
+    0x68, 0x01, 0x65, 0xFC, 0xE7, 0x56, 0x71, 0xE0, 0x66, 0x64, 0x6E, 0x61, 0x7E, 0x60, 0x0E, 0xE1,
+    0x3E, 0x60, 0x76, 0x62, 0xA6, 0x60, 0x76, 0x60, 0x66, 0x60, 0x16, 0x61, 0x46, 0x61, 0xDE, 0x62,
+    0x36, 0x60, 0x26, 0x62, 0xEE, 0x60, 0x26, 0x60, 0x16, 0x62, 0xAE, 0xE0, 0x3E, 0x70, 0x4A, 0xEC,
+    0xAE, 0x4C, 0x37, 0x6E, 0x0A, 0x66, 0x14, 0xE6, 0x17, 0x66, 0x06, 0xEF, 0x24, 0xF7, 0xCE, 0x7E,
+    0xE0, 0x9E, 0x70, 0x4F, 0x3E, 0xF6, 0x54, 0x00, 0xE6, 0x33, 0x66, 0x16, 0x66, 0x01, 0x66, 0x5F,
+    0x6F, 0x94, 0xDF, 0xE3, 0xA8, 0xA0, 0x1E, 0x60, 0x76, 0x60, 0x86, 0x73, 0x49, 0x5D, 0xA3, 0x40,
+    0x3B, 0x6E, 0x04, 0x66, 0x0E, 0xE6, 0x0F, 0xE6, 0x07, 0x66, 0x16, 0x67, 0xD4, 0xBB, 0xD8, 0xFA,
+    0x40, 0x4E, 0x61, 0x06, 0x78, 0x4F, 0x6F, 0x37, 0x36, 0x1C, 0x67, 0x0C, 0xAF, 0x56, 0xA6, 0x21,
+    0x0E, 0x7A, 0x49, 0xDF, 0xCB, 0xB2, 0x02, 0xE6, 0x0F, 0xE6, 0x01, 0xE6, 0x04, 0xE6, 0x23, 0xEE,
+    0x0C, 0x66, 0x01, 0xE6, 0x00, 0x66, 0x0A, 0x66, 0x04, 0x66, 0x0C, 0x66, 0x05, 0xE6, 0x30, 0x66,
+    0x19, 0xE6, 0x4B, 0xEF, 0xFC, 0xD8, 0x49, 0x76, 0x80, 0x7E, 0x61, 0x3E, 0x60, 0x56, 0x60, 0x4E,
+    0x62, 0x56, 0x62, 0x46, 0x61, 0x36, 0x60, 0x9E, 0x61, 0xCE, 0x65, 0x66, 0xE0, 0x0E, 0x60, 0x5E,
+    0x60, 0x4E, 0x61, 0x36, 0xE0, 0xA6, 0x60, 0x96, 0x75, 0xC8, 0x66, 0x47, 0xE4, 0x48, 0x66, 0x1B,
+    0xE6, 0x00, 0x66, 0x59, 0x76, 0x06, 0xEE, 0x00, 0x66, 0x02, 0xE6, 0x5D, 0x6E, 0x0D, 0x66, 0x13,
+    0xE7, 0xAB, 0x00, 0xB2, 0x1B, 0xF3, 0x09, 0xB3, 0x1D, 0xF3, 0x03, 0xF3, 0x03, 0x33, 0x0D, 0x33,
+    0x2B, 0x77, 0x23, 0x33, 0x05, 0xF3, 0x07, 0x33, 0x01, 0xF3, 0x21, 0xF3, 0x02, 0xB3, 0x04, 0xB3,
+    0x30, 0x77, 0x03, 0xF3, 0x06, 0x33, 0x05, 0x73, 0x9A, 0x4C, 0xF1, 0x9C, 0xB0, 0xDB, 0x73, 0x03,
+    0x70, 0xB3, 0x32, 0x43, 0x70, 0xCF, 0x30, 0x1F, 0x30, 0xDF, 0x30, 0x0F, 0x30, 0x5B, 0x30, 0x1B,
+    0x30, 0xB3, 0x30, 0x13, 0x30, 0x63, 0x30, 0x17, 0x30, 0x7F, 0x30, 0x07, 0x38, 0xA4, 0xE3, 0x07,
+    0x98, 0xEA, 0x6F, 0x75, 0x30, 0xF0, 0x1B, 0x30, 0x37, 0x3F, 0xE5, 0xAE, 0x0B, 0x03, 0x00, 0x73,
+    0x13, 0x77, 0x0C, 0xF3, 0x03, 0xF3, 0x0E, 0xF3, 0x06, 0xF3, 0xF2, 0x6C, 0xAD, 0x33, 0xA0, 0x8F,
+    0x3A, 0x26, 0x52, 0xEF, 0x11, 0x08, 0xF3, 0x38, 0xB8, 0x0A, 0x72, 0x3D, 0xB7, 0xEE, 0x79, 0x69,
+    0xDB, 0xD1, 0x23, 0x5F, 0xDD, 0x02, 0xDB, 0xAD, 0xE4, 0x87, 0x3A, 0x01, 0x99, 0x82, 0x99, 0xF7,
+    0x27, 0x5E, 0xBD, 0x94, 0x12, 0xA1, 0xBA, 0xB1, 0x90, 0xBB, 0x87, 0x79, 0x8C, 0x99, 0x82, 0x19,
+    0x84, 0x79, 0xA7, 0x9B, 0x8A, 0xDB, 0x97, 0xFA, 0x02, 0xDB, 0x00, 0xB9, 0x80, 0x19, 0x86, 0x1B,
+    0xF3, 0x2F, 0x55, 0xDC, 0x70, 0x0D, 0x99, 0x21, 0x98, 0x0F, 0x98, 0x43, 0xB8, 0x35, 0x98, 0x89,
+    0x98, 0x2D, 0x98, 0xB1, 0xB8, 0x23, 0x9A, 0x47, 0xBA, 0x4F, 0xBC, 0xF2, 0xCF, 0xBB, 0xEA, 0x82,
+    0x39, 0x81, 0xD9, 0x83, 0xB9, 0xF1, 0x26, 0xD8, 0x2B, 0xF1, 0x51, 0x98, 0x09, 0x98, 0x15, 0x98,
+    0xC9, 0x98, 0x1D, 0x98, 0x21, 0x99, 0x1D, 0x98, 0x91, 0x99, 0xA5, 0xB9, 0xB7, 0xB8, 0xCB, 0xBA,
+    0x65, 0xB8, 0x65, 0x98, 0x07, 0x98, 0x41, 0x98, 0x61, 0x98, 0x4D, 0x98, 0x19, 0x98, 0x17, 0x99,
+    0x37, 0xB8, 0x15, 0x98, 0x2B, 0x99, 0xBD, 0xB8, 0x49, 0x9D, 0x53, 0xE7, 0x94, 0xF9, 0x0C, 0x99,
+    0xD5, 0x2E, 0xBC, 0xCE, 0xC0, 0x3B, 0x98, 0xDB, 0x9F, 0xD3, 0x3D, 0x3B, 0x8C, 0x81, 0x59, 0x84,
+    0x79, 0x82, 0x19, 0x83, 0x79, 0x82, 0xB9, 0x97, 0x1A, 0x23, 0xDB, 0x4D, 0x38, 0xB4, 0xDD, 0x51,
+    0x5D, 0xB8, 0x4F, 0x98, 0x37, 0x9A, 0xE9, 0xB8, 0x53, 0x98, 0x03, 0x98, 0x4B, 0x98, 0x1B, 0x98,
+    0x0B, 0x98, 0x05, 0x98, 0x37, 0x98, 0x43, 0x9D, 0x52, 0xD7, 0x60, 0xEA, 0x03, 0x39, 0x88, 0x9B,
+    0x83, 0x39, 0x85, 0xF9, 0xE5, 0x3F, 0x94, 0xBF, 0xF1, 0xBD, 0xB8, 0x07, 0x98, 0x21, 0x98, 0x99,
+    0xB8, 0x4D, 0xB8, 0x1F, 0x98, 0x1D, 0xB8, 0x8B, 0xB8, 0x07, 0x98, 0x43, 0x98, 0x45, 0xB9, 0xD5,
+    0xB8, 0x87, 0x98, 0x3D, 0x98, 0x09, 0x99, 0xE7, 0xB9, 0xE5, 0xB8, 0x61, 0x9A, 0xC9, 0xB8, 0xD5,
+    0xB8, 0x95, 0x99, 0xC3, 0xB8, 0x0D, 0x98, 0x01, 0x98, 0x8D, 0x98, 0xAB, 0xB8, 0x13, 0x98, 0x3B,
+    0x98, 0x67, 0xB8, 0x1D, 0x98, 0xF5, 0xB8, 0x7F, 0x99, 0x0F, 0xB8, 0x33, 0x9D, 0x72, 0x75, 0x91,
+    0xD2, 0x04, 0xB9, 0xA5, 0x1B, 0x85, 0x9B, 0xAB, 0x3B, 0xC7, 0x3A, 0x1F, 0x02, 0x6B, 0x40, 0xBF,
+    0x30, 0x0F, 0x30, 0x63, 0x3D, 0xE4, 0xA6, 0x23, 0xB7, 0x00, 0xB3, 0x0C, 0x73, 0x1A, 0xF7, 0xEA,
+    0x47, 0x73, 0x3A, 0xE0, 0x27, 0x7F, 0x64, 0x2E, 0x59, 0x46, 0xA2, 0x58, 0x2F, 0x83, 0x16, 0x9B,
+    0xCA, 0xEE, 0x93, 0x14, 0x0F, 0x66, 0x25, 0xEF, 0x5C, 0xEC, 0xC2, 0xA5, 0x9C, 0xCD, 0xDC, 0x77,
+    0x26, 0x03, 0x66, 0x85, 0xEE, 0x06, 0xE6, 0xB7, 0xEE, 0x38, 0x6E, 0x14, 0xE6, 0x1C, 0xE6, 0x89,
+    0x6F, 0xCC, 0x9C, 0x75, 0xFA, 0x21, 0xC6, 0x61, 0x4E, 0x72, 0xDC, 0xF4, 0x63, 0x8A, 0x03, 0x66,
+    0x07, 0xE6, 0x01, 0xE6, 0x07, 0xE6, 0x50, 0x6E, 0x05, 0x66, 0x04, 0xE6, 0x00, 0x66, 0x19, 0x66,
+    0x02, 0x66, 0x01, 0x66, 0x55, 0x6E, 0x21, 0x66, 0xDC, 0xEE, 0x03, 0x66, 0x07, 0xE6, 0x2F, 0x6E,
+    0x2D, 0x6E, 0x67, 0x69, 0xB6, 0x8A, 0x73, 0x4B, 0xDD, 0xC0, 0xBC, 0xC9, 0x4D, 0xC1, 0x2C, 0xFD,
+    0x98, 0x8F, 0x4C, 0xF4, 0x12, 0xCC, 0x8D, 0xDD, 0x12, 0xDC, 0x02, 0xCC, 0x08, 0xCD, 0x4F, 0xDC,
+    0x15, 0xCE, 0x39, 0xCD, 0xB9, 0x51, 0xBE, 0x99, 0xCF, 0x4F, 0x94, 0x4B, 0xCC, 0xA1, 0xCC, 0x1C,
+    0xCC, 0x19, 0xCC, 0x03, 0xCF, 0x29, 0xDD, 0xA9, 0x4C, 0x2C, 0x9E, 0x4F, 0xEC, 0x5F, 0xB9, 0x8A,
+    0xA3, 0xA6, 0x5A, 0x5D, 0x2A, 0xF4, 0x3D, 0xF8, 0x0F, 0x98, 0x5B, 0x9A, 0x55, 0xBC, 0xB2, 0xD1,
+    0xA0, 0xF3, 0x02, 0xB9, 0x83, 0x79, 0x86, 0xD9, 0x82, 0xB9, 0x91, 0x99, 0x83, 0xD9, 0x82, 0x9B,
+    0xD5, 0x24, 0x56, 0xFE, 0xE8, 0x93, 0x9B, 0xEB, 0xBA, 0x09, 0xA3, 0x91, 0xB0, 0x27, 0x98, 0x1D,
+    0x9C, 0x72, 0xA5, 0xDA, 0x8B, 0xB6, 0xFB, 0x84, 0xB9, 0x82, 0x99, 0xAF, 0x9D, 0x82, 0xB9, 0x82,
+    0x99, 0xD9, 0x34, 0x55, 0x7C, 0x78, 0x03, 0x98, 0x31, 0x98, 0x79, 0x9A, 0xC3, 0xB8, 0x2F, 0x98,
+    0x05, 0x98, 0x13, 0x9B, 0xA7, 0xBC, 0x33, 0xED, 0xFF, 0xEB, 0xB1, 0x7B, 0xA0, 0x3B, 0x83, 0xF9,
+    0xB3, 0x5B, 0x85, 0xF9, 0x92, 0xBB, 0xBD, 0xDB, 0xA9, 0xDB, 0x80, 0x59, 0x80, 0x19, 0xA0, 0xBB,
+    0xFD, 0x2A, 0xDD, 0x2C, 0xB8, 0x79, 0x9E, 0x73, 0x11, 0xE2, 0xA8, 0xF9, 0x32, 0x9C, 0x08, 0xF0,
+    0x1B, 0x98, 0x35, 0x99, 0x33, 0xBB, 0x23, 0xB8, 0x23, 0x9F, 0xB3, 0x25, 0x91, 0xF1, 0x00, 0xF9,
+    0x83, 0x19, 0x83, 0x79, 0x83, 0xD9, 0xBC, 0xDB, 0xB7, 0xDB, 0xBF, 0x1B, 0x92, 0xB9, 0xE3, 0x3F,
+    0x37, 0xB8, 0x60, 0x31, 0x99, 0xA7, 0xB8, 0x19, 0x9B, 0xA3, 0xB8, 0x43, 0xB8, 0x09, 0x98, 0xF3,
+    0x98, 0x03, 0x9A, 0x6F, 0xB8, 0x2F, 0x98, 0x1F, 0x99, 0xDF, 0xB8, 0x33, 0x98, 0x15, 0x98, 0x3D,
+    0x98, 0x91, 0xBB, 0x7D, 0xB8, 0x0B, 0x98, 0x19, 0x98, 0x85, 0x98, 0x3B, 0x98, 0x53, 0x9D, 0x93,
+    0x0D, 0x95, 0x9D, 0x03, 0x79, 0xF5, 0x29, 0x53, 0x2B, 0x98, 0x85, 0x98, 0x11, 0x9B, 0x5B, 0xBC,
+    0xD3, 0x7D, 0xBA, 0xE2, 0x02, 0x39, 0x84, 0xFA, 0x00, 0xD9, 0x00, 0xB9, 0x81, 0x99, 0xAC, 0x1B,
+    0x84, 0xD9, 0xC3, 0x20, 0x3C, 0xEA, 0xF8, 0xD1, 0x9A, 0x49, 0xB9, 0x2F, 0xB8, 0x19, 0x98, 0x09,
+    0x98, 0x8B, 0x98, 0x21, 0x9E, 0x12, 0xE5, 0xD8, 0x83, 0x82, 0x19, 0x89, 0x59, 0xC1, 0x2E, 0x1D,
+    0x80, 0xE3, 0x8E, 0x25, 0x72, 0xC9, 0x20, 0x00, 0x73, 0x30, 0xF7, 0x01, 0x73, 0x92, 0x68, 0xE6,
+    0x38, 0x80, 0x43, 0x70, 0xAB, 0x28, 0x38, 0x5F, 0x98, 0x2B, 0x98, 0x63, 0xB9, 0xC5, 0xB8, 0xA5,
+    0xB8, 0x15, 0x98, 0x47, 0xB8, 0x45, 0x98, 0x27, 0x98, 0x3B, 0x98, 0x17, 0x99, 0x47, 0xB8, 0xF3,
+    0xB8, 0x0F, 0x98, 0x41, 0x98, 0x0D, 0x98, 0xD5, 0x98, 0x15, 0x9E, 0xD2, 0x6F, 0xBD, 0xEF, 0x80,
+    0x79, 0x9E, 0xFB, 0x9A, 0x5B, 0x81, 0x99, 0xF9, 0x22, 0x5D, 0x1E, 0x08, 0x79, 0x9E, 0x32, 0x9F,
+    0x6E, 0xF4, 0x83, 0x1B, 0x88, 0xD9, 0xF9, 0x3E, 0x97, 0x11, 0x83, 0x41, 0x7F, 0x70, 0x47, 0x31,
+    0x6B, 0x73, 0xB3, 0x70, 0xCF, 0x70, 0x1F, 0x30, 0x0B, 0x3C, 0xA4, 0xF7, 0x8D, 0xBA, 0x0A, 0xB3,
+    0x03, 0x73, 0x0C, 0x73, 0x00, 0xB3, 0x08, 0xB3, 0x05, 0x73, 0x0D, 0xB7, 0x15, 0xB3, 0x6B, 0x77,
+    0x25, 0x77, 0x1F, 0x37, 0x01, 0xF7, 0x0B, 0x73, 0x0A, 0x73, 0x01, 0xB3, 0x01, 0x73, 0x00, 0xF3,
+    0x05, 0xF3, 0x33, 0xB3, 0x06, 0xF3, 0x5F, 0x37, 0x20, 0x77, 0x73, 0xB7, 0x00, 0x33, 0x31, 0xB7,
+    0x03, 0x33, 0x02, 0xB3, 0x02, 0x73, 0x7D, 0x77, 0x00, 0xB3, 0x1B, 0x33, 0x12, 0x33, 0x00, 0xB3,
+    0x0A, 0x73, 0x0A, 0x33, 0x09, 0xB3, 0x01, 0xF3, 0xDA, 0x64, 0x6A, 0xD4, 0xF8, 0x24, 0xFE, 0xF7,
+    0x31, 0x5C, 0xB7, 0x04, 0xB3, 0x8A, 0x5E, 0x6E, 0x1A, 0xD0, 0x07, 0x30, 0x6B, 0x31, 0x97, 0x30,
+    0x93, 0x30, 0x0B, 0x30, 0x83, 0x3E, 0x24, 0x3B, 0x27, 0xE1, 0x06, 0x73, 0xFA, 0x68, 0x64, 0x3B,
+    0x68, 0x70, 0x29, 0x90, 0x2B, 0x9A, 0xC5, 0xB9, 0xC7, 0xB8, 0x1D, 0x98, 0x25, 0x98, 0x41, 0x9D,
+    0x33, 0x39, 0x62, 0xF2, 0x83, 0x39, 0x98, 0xBB, 0x83, 0x39, 0x86, 0xF9, 0x80, 0x39, 0xAD, 0x9A,
+    0x4E, 0x74, 0x44, 0xC6, 0x8D, 0x26, 0xE0, 0xB6, 0x60, 0x4E, 0x60, 0x0E, 0x71, 0x48, 0xE6, 0xC7,
+    0x9E, 0x23, 0xE6, 0x0E, 0xE6, 0xA1, 0xEE, 0x06, 0x66, 0x25, 0xE6, 0x18, 0xE6, 0x19, 0x6E, 0x13,
+    0x67, 0xAC, 0x8E, 0xFD, 0xBC, 0x20, 0x56, 0x61, 0x0E, 0xE3, 0x3E, 0x60, 0x86, 0x6A, 0xEE, 0xF7,
+    0x4E, 0xED, 0xE2, 0x72, 0x02, 0x66, 0xE6, 0x6E, 0x16, 0x66, 0x10, 0x67, 0x5C, 0xA9, 0xC0, 0x39,
+    0x61, 0xF6, 0xE2, 0x26, 0x60, 0x3E, 0x77, 0x4E, 0xBC, 0xA4, 0xF8, 0xD0, 0x85, 0xDC, 0x13, 0xCE,
+    0x59, 0x94, 0x92, 0xEF, 0xFF, 0x9C, 0xDD, 0x96, 0xE4, 0xB7, 0xD3, 0x95, 0x4F, 0xCF, 0x3E, 0x3B,
+    0x84, 0x7B, 0xAD, 0xFB, 0xD9, 0x3F, 0x5C, 0xBE, 0xA8, 0xD1, 0xB8, 0x5B, 0x98, 0x05, 0x98, 0x41,
+    0x98, 0x69, 0x98, 0x27, 0x9D, 0xD2, 0xC9, 0xBB, 0xD8, 0x85, 0x99, 0xAD, 0xFB, 0x83, 0x99, 0xA6,
+    0x1B, 0x92, 0xBD, 0xE3, 0x34, 0x15, 0xC8, 0x40, 0x21, 0x9C, 0x93, 0x6D, 0x23, 0xA0, 0x83, 0x19,
+    0x84, 0x19, 0x94, 0x19, 0x83, 0xB9, 0x80, 0xF9, 0x81, 0x39, 0x9F, 0xBB, 0x80, 0x79, 0xDF, 0x36,
+    0xF7, 0x9D, 0x5B, 0x95, 0xA0, 0xED, 0xAD, 0xF0, 0x42, 0xCC, 0x03, 0xCC, 0x5D, 0xDF, 0x79, 0x12,
+    0xC8, 0x6A, 0xC0, 0xCC, 0xC5, 0x1C, 0xC0, 0x0D, 0xC8, 0x5D, 0xEE, 0x9A, 0x6A, 0x5E, 0xC8, 0x20,
+    0xCC, 0x07, 0xCC, 0x30, 0xCC, 0x1D, 0xCC, 0x0C, 0xCC, 0x4D, 0xCC, 0x8C, 0xCE, 0x99, 0x0E, 0xF1,
+    0x48, 0x01, 0x1C, 0xDF, 0x7D, 0xCA, 0xDD, 0xCE, 0xDD, 0xD3, 0xED, 0xC2, 0x7C, 0xED, 0x9B, 0x1F,
+    0xD6, 0xAC, 0xB9, 0xD0, 0x21, 0xC8, 0xCB, 0xDC, 0x41, 0xCC, 0x15, 0xCF, 0x29, 0x2C, 0xE9, 0xE3,
+    0x26, 0x95, 0xEB, 0x51, 0xBD, 0xA3, 0x19, 0xB9, 0x63, 0xA0, 0x15, 0x90, 0xFF, 0x98, 0x0B, 0x9C,
+    0x13, 0x51, 0x19, 0xF8, 0x08, 0x5B, 0x80, 0x99, 0x93, 0xBB, 0x81, 0x3B, 0xAE, 0x7D, 0x9B, 0xBB,
+    0xA9, 0x1B, 0x82, 0x99, 0x9C, 0x1A, 0x00, 0x39, 0x06, 0x59, 0x80, 0xB9, 0x85, 0xF9, 0x89, 0x39,
+    0x8B, 0x39, 0xC1, 0x3D, 0xBC, 0x2D, 0x68, 0x05, 0x9C, 0xF3, 0x53, 0x1F, 0xD8, 0x15, 0x9B, 0x88,
+    0x19, 0xC7, 0x3F, 0x55, 0x0C, 0x70, 0x0B, 0x9C, 0x32, 0x4D, 0x0B, 0xF0, 0xBA, 0xDB, 0x80, 0xD9,
+    0x82, 0x19, 0xD5, 0x35, 0x1C, 0xAD, 0x36, 0xD3, 0xCF, 0xDA, 0xC5, 0x83, 0xB9, 0x90, 0x5B, 0xD1,
+    0x2F, 0xB1, 0x8D, 0x76, 0x73, 0x3D, 0xB5, 0xCB, 0x83, 0x39, 0x85, 0x39, 0x94, 0x5B, 0x85, 0x79,
+    0x86, 0x99, 0x83, 0x59, 0x85, 0x99, 0x87, 0xD9, 0x84, 0x19, 0xE9, 0x25, 0x75, 0xC8, 0x00, 0x07,
+    0x9B, 0x3F, 0xB8, 0x2F, 0x9F, 0xB2, 0xB5, 0x30, 0xF0, 0x81, 0x59, 0x83, 0x19, 0xB6, 0x5B, 0x80,
+    0xB9, 0x82, 0x19, 0x86, 0xBB, 0x94, 0x9B, 0x86, 0x99, 0x81, 0x19, 0xBB, 0x1B, 0x85, 0x19, 0x91,
+    0xD9, 0x82, 0x99, 0x80, 0x19, 0x90, 0xFB, 0x96, 0xBB, 0x80, 0x99, 0xA0, 0x5B, 0x80, 0x99, 0x80,
+    0x19, 0x82, 0xB9, 0x82, 0x19, 0xB6, 0x3A, 0x45, 0xEA, 0xB6, 0x70, 0x0F, 0x30, 0x2B, 0x3E, 0xE5,
+    0x06, 0x35, 0xAC, 0xE6, 0x52, 0xA0, 0xF6, 0x01, 0xD7, 0x3F, 0x27, 0xCE, 0x5D, 0x03, 0x06, 0xB3,
+    0x07, 0x73, 0x06, 0xB4, 0x08, 0x72, 0xD2, 0x44, 0x60, 0x1F, 0x50, 0x97, 0x31, 0x1F, 0x3D, 0x66,
+    0x7B, 0x5F, 0x1B, 0x56, 0x37, 0x05, 0xB3, 0x69, 0xF7, 0xF2, 0x54, 0xEE, 0x7B, 0xD0, 0x3F, 0x32,
+    0x3F, 0x70, 0x43, 0x3E, 0x65, 0x73, 0x7F, 0x31, 0x00, 0xF3, 0xB2, 0x62, 0x6A, 0x76, 0x92, 0x63,
+    0x32, 0x9B, 0x40, 0xBB, 0x20, 0x9B, 0x30, 0x57, 0x30, 0x3B, 0x30, 0x1F, 0x39, 0xD8, 0x05, 0x90,
+    0xDD, 0xB8, 0x47, 0x98, 0x01, 0x98, 0x0D, 0x98, 0x37, 0x9B, 0xF7, 0xBC, 0x12, 0x75, 0x62, 0xE1,
+    0x80, 0x79, 0x80, 0xD9, 0x82, 0x3A, 0x73, 0xB9, 0x1A, 0xA0, 0x07, 0x3B, 0xA7, 0xA2, 0x47, 0xA6,
+    0x27, 0x34, 0x09, 0xF2, 0x04, 0x33, 0x11, 0x73, 0xA2, 0x5B, 0xA5, 0xF6, 0x70, 0x1B, 0x34, 0x2B,
+    0x75, 0x8F, 0x40, 0x03, 0x20, 0xFB, 0x31, 0xD3, 0x31, 0x1B, 0x71, 0xBB, 0x70, 0x63, 0x3E, 0xA5,
+    0x5A, 0x89, 0x90, 0x0A, 0x33, 0x04, 0x33, 0x0D, 0xF3, 0xF2, 0x67, 0xAA, 0x77, 0x40, 0x3F, 0x30,
+    0x27, 0x31, 0xCB, 0x77, 0x33, 0x70, 0x03, 0x36, 0xFF, 0x71, 0x73, 0x37, 0x5F, 0x70, 0x0B, 0x31,
+    0x33, 0x31, 0x57, 0x3A, 0xA4, 0x8A, 0x3B, 0xCC, 0x02, 0x73, 0xEA, 0x5B, 0xE9, 0x9E, 0xB5, 0xA3,
+    0x76, 0x67, 0x70, 0x4B, 0x30, 0xFB, 0x70, 0xD3, 0x30, 0x4B, 0x31, 0xEB, 0x73, 0xAF, 0x6F, 0x40,
+    0x0D, 0x9A, 0x7B, 0xB9, 0x19, 0x98, 0x13, 0x98, 0x2B, 0x98, 0x6F, 0x98, 0x49, 0x9A, 0x35, 0xB8,
+    0x03, 0x98, 0x59, 0x98, 0x29, 0xB8, 0x3F, 0x98, 0x05, 0x98, 0x35, 0x9A, 0x0D, 0xB8, 0xFF, 0xB8,
+    0x53, 0x9D, 0xB3, 0x73, 0x7F, 0xD6, 0x21, 0x7B, 0x81, 0xF9, 0x81, 0x99, 0x86, 0x1B, 0x80, 0xFA,
+    0x13, 0xFB, 0x02, 0x39, 0x88, 0x79, 0xED, 0x3E, 0x9C, 0xAB, 0x18, 0x05, 0x9A, 0x61, 0xD8, 0x37,
+    0x9B, 0x4D, 0xB8, 0x33, 0x98, 0x01, 0x98, 0xAF, 0x9E, 0xD3, 0xED, 0xC9, 0xEE, 0x22, 0x9B, 0x8B,
+    0x1B, 0x86, 0xD9, 0x87, 0x5B, 0x81, 0x39, 0x81, 0xD9, 0xEF, 0x33, 0x98, 0x9D, 0x80, 0xC5, 0x9C,
+    0x32, 0x7B, 0x48, 0xDC, 0x03, 0x59, 0x87, 0x39, 0x83, 0x19, 0x9A, 0x3B, 0x98, 0x9B, 0x8E, 0xB9,
+    0x80, 0x99, 0xB1, 0xDB, 0x83, 0x19, 0x9E, 0x7B, 0x84, 0x39, 0x81, 0x39, 0x81, 0x1B, 0x84, 0xF9,
+    0x8D, 0x39, 0x82, 0x79, 0x82, 0x19, 0x80, 0xB9, 0x87, 0xF9, 0xBD, 0x5B, 0xFD, 0x3C, 0xF6, 0x3E,
+    0xB0, 0xCD, 0xB8, 0x2D, 0x98, 0x79, 0x98, 0x23, 0x98, 0xE1, 0x9D, 0x52, 0xA1, 0x5E, 0xF6, 0x82,
+    0x79, 0x85, 0xD9, 0xD3, 0x24, 0x99, 0xEE, 0x18, 0x25, 0x9E, 0x93, 0xC9, 0xF9, 0xAF, 0x02, 0x39,
+    0xF3, 0x23, 0xF8, 0x5D, 0x20, 0x03, 0x98, 0x63, 0xD8, 0x6D, 0x98, 0x23, 0x98, 0x1D, 0x98, 0x99,
+    0xBA, 0x97, 0xB9, 0xC9, 0xB8, 0x45, 0x98, 0x05, 0x99, 0x3B, 0xBB, 0x3B, 0xB8, 0x4B, 0x99, 0xCF,
+    0xB8, 0x87, 0x9B, 0x57, 0xB8, 0x1F, 0x9B, 0x41, 0xB8, 0x59, 0xBA, 0xB5, 0xB8, 0x47, 0x98, 0x1F,
+    0x98, 0x11, 0xBF, 0x92, 0xAF, 0x9F, 0xA7, 0x86, 0xD9, 0x80, 0xD9, 0x8F, 0xBB, 0x82, 0x39, 0xC9,
+    0x3B, 0x1D, 0x9A, 0x48, 0x11, 0x99, 0xBF, 0xB9, 0x39, 0xB8, 0x55, 0xB8, 0x19, 0x99, 0x29, 0xBD,
+    0x56, 0x26, 0x14, 0xEB, 0x1C, 0x8B, 0x53, 0x84, 0x5D, 0x2E, 0x9F, 0x2B, 0x90, 0x61, 0xA0, 0xCF,
+    0x98, 0x11, 0x98, 0x15, 0x98, 0xB7, 0xB8, 0x6B, 0x98, 0x67, 0x98, 0x43, 0x9A, 0xC1, 0xB8, 0xED,
+    0x98, 0x11, 0x98, 0x6D, 0x98, 0x67, 0x98, 0x03, 0x9E, 0xB2, 0xB3, 0x86, 0xBF, 0x80, 0x99, 0xBD,
+    0xFB, 0x81, 0x59, 0x86, 0x59, 0x81, 0x79, 0xB1, 0x7B, 0x98, 0x5A, 0x00, 0x79, 0x01, 0x99, 0x84,
+    0xB9, 0xD3, 0x29, 0x9F, 0x4C, 0x18, 0x57, 0x98, 0x53, 0x99, 0xE3, 0xB8, 0x1F, 0x98, 0xDF, 0xB8,
+    0x03, 0x98, 0x41, 0x9A, 0x1F, 0xB9, 0xBF, 0xB8, 0x1F, 0x9E, 0xD2, 0xF3, 0xB9, 0xB2, 0x83, 0xFB,
+    0x8E, 0x79, 0x82, 0x39, 0x85, 0x19, 0x83, 0x39, 0xA5, 0x7B, 0x85, 0xB9, 0x86, 0xB9, 0x8B, 0x19,
+    0xA3, 0x9B, 0x81, 0x79, 0x94, 0x7B, 0xED, 0x3F, 0x7A, 0x7B, 0x8F, 0x72, 0x4F, 0xE6, 0xAA, 0x01,
+    0xD9, 0x97, 0x7A, 0x6A, 0xEF, 0x94, 0x44, 0xDF, 0x70, 0x27, 0x30, 0x17, 0x3A, 0x67, 0x07, 0xCB,
+    0xC4, 0x04, 0x33, 0x0B, 0xF7, 0x09, 0x33, 0x18, 0x73, 0x05, 0x34, 0x66, 0xF6, 0x00, 0xF3, 0x2A,
+    0x33, 0x01, 0xB3, 0x00, 0x33, 0x0D, 0xB3, 0x05, 0xF3, 0x04, 0xB3, 0x47, 0xF4, 0xDB, 0x7D, 0x72,
+    0x07, 0x66, 0xE0, 0x36, 0x6E, 0xD6, 0xE0, 0x7E, 0x61, 0x86, 0x60, 0x36, 0xEB, 0xEE, 0xE7, 0x46,
+    0xEC, 0x16, 0x91, 0xAF, 0xEC, 0x40, 0x18, 0xCC, 0x02, 0xCD, 0x6C, 0xDC, 0x57, 0xDC, 0x02, 0xCF,
+    0x49, 0xE2, 0x87, 0x7C, 0x40, 0xFC, 0xC2, 0xDD, 0xC4, 0xCD, 0xC1, 0xDD, 0x01, 0x7C, 0xA3, 0x9D,
+    0xEB, 0x4F, 0xD0, 0x07, 0xDF, 0x69, 0x77, 0xA1, 0x73, 0x40, 0x5C, 0xC4, 0xBD, 0xC1, 0x9D, 0xC0,
+    0xCC, 0xC3, 0x8C, 0xD4, 0xDD, 0xC0, 0xBC, 0xC0, 0x6C, 0xC1, 0x3C, 0xC0, 0x0C, 0xDB, 0x0D, 0x29,
+    0x96, 0xDC, 0xD0, 0x3F, 0x9D, 0x73, 0x19, 0x04, 0xA9, 0x09, 0x59, 0x80, 0xF9, 0x82, 0xF9, 0x80,
+    0x3B, 0x85, 0x19, 0x80, 0x59, 0xED, 0x21, 0x51, 0x0B, 0x12, 0x37, 0xB8, 0xD5, 0xBF, 0x73, 0x9D,
+    0x76, 0x83, 0x02, 0xF9, 0x80, 0x19, 0x90, 0x7B, 0x8F, 0x5B, 0xB4, 0x9B, 0xC9, 0x31, 0x72, 0x0C,
+    0x10, 0xA9, 0x9C, 0x12, 0x4D, 0x18, 0xAC, 0xA0, 0x5B, 0xA4, 0x7B, 0xD1, 0x26, 0x3D, 0xAD, 0x18,
+    0xDD, 0x9A, 0x77, 0xBC, 0x53, 0xE1, 0x33, 0xFA, 0x43, 0x22, 0x90, 0x7E, 0x61, 0x27, 0xB9, 0x65,
+    0x9D, 0x53, 0x05, 0xF8, 0xCB, 0x22, 0x5D, 0x87, 0x79, 0x81, 0x59, 0x82, 0x99, 0xAF, 0x7B, 0x9F,
+    0x3B, 0xDF, 0x2D, 0xF0, 0x2C, 0x58, 0x45, 0x9A, 0xAF, 0xB8, 0x0B, 0x98, 0x59, 0x99, 0x1F, 0x98,
+    0x37, 0x99, 0xDF, 0xBF, 0xD2, 0x7D, 0xD6, 0x93, 0xBA, 0xFB, 0x81, 0x19, 0x92, 0xDB, 0x89, 0x19,
+    0xE1, 0x29, 0x30, 0x1F, 0xF4, 0x72, 0xC3, 0x15, 0x98, 0x81, 0x99, 0x8C, 0x3A, 0x32, 0x5B, 0x0B,
+    0xFB, 0x80, 0x19, 0x82, 0x39, 0x83, 0xF9, 0xE3, 0x36, 0xD7, 0xDC, 0x70, 0x4B, 0x98, 0x09, 0x98,
+    0x49, 0xB8, 0x01, 0x99, 0x51, 0x97, 0xBC, 0x1B, 0xCD, 0x85, 0xDD, 0xE9, 0xDE, 0x43, 0x4F, 0xA9,
+    0x92, 0x1A, 0x0A, 0x79, 0x82, 0xF9, 0x80, 0xF9, 0x93, 0x9C, 0x07, 0x79, 0x0D, 0x9B, 0x80, 0xF9,
+    0x85, 0x39, 0x81, 0x19, 0x84, 0xB9, 0x88, 0x7B, 0xB9, 0x5A, 0x40, 0x62, 0x3F, 0x2C, 0xE5, 0xEE,
+    0x5B, 0x96, 0x15, 0xF3, 0x01, 0xF3, 0x0E, 0x73, 0x02, 0xB3, 0x00, 0x73, 0x04, 0x73, 0xCA, 0x73,
+    0xE5, 0x73, 0x80, 0x63, 0x70, 0x17, 0x36, 0x7F, 0x70, 0x47, 0x30, 0x03, 0x36, 0xD7, 0x70, 0xD3,
+    0x3C, 0xA6, 0x56, 0x23, 0x20, 0x02, 0x73, 0x75, 0x37, 0x00, 0x37, 0x06, 0xF3, 0x1E, 0x33, 0x02,
+    0x73, 0x9E, 0x69, 0xE8, 0x72, 0x37, 0x6B, 0x71, 0x27, 0x30, 0xE7, 0x30, 0x3B, 0x30, 0x57, 0x3A,
+    0x67, 0xD2, 0x0B, 0xD4, 0x00, 0xB3, 0xA6, 0x46, 0xB4, 0x74, 0x60, 0x87, 0x7F, 0x65, 0x23, 0x3B,
+    0x9C, 0x96, 0x45, 0xF1, 0x58, 0x55, 0x77, 0x4C, 0x2E, 0xBF, 0xB6, 0x09, 0x6F, 0x2C, 0xC4, 0x78,
+    0xE0, 0x20, 0x0E, 0x79, 0x49, 0xA6, 0xAE, 0x22, 0x2A, 0x67, 0x6C, 0x92, 0xFB, 0x26, 0x94, 0xCE,
+    0xA5, 0xBB, 0x70, 0x02, 0x66, 0x5A, 0xEE, 0x17, 0xE6, 0x17, 0x66, 0x01, 0xEE, 0x9C, 0xEE, 0x6A,
+    0x68, 0x01, 0xE4, 0x0C, 0x67, 0xD4, 0xF2, 0xD6, 0x44, 0x7D, 0x00, 0xDD, 0xC5, 0xFC, 0xC9, 0x4C,
+    0xDF, 0x4D, 0xC0, 0x8C, 0xC0, 0x2C, 0xC1, 0xFC, 0xC5, 0x2C, 0xEC, 0x95, 0x1C, 0x9C, 0xAC, 0x02,
+    0xCC, 0x67, 0xDC, 0x02, 0xCC, 0x1F, 0xCC, 0x32, 0xCF, 0x39, 0x99, 0xBD, 0xEC, 0x4D, 0xED, 0xD7,
+    0x3D, 0xC0, 0x2C, 0xC0, 0x6C, 0xE3, 0x9E, 0x9D, 0xBE, 0x0D, 0xE0, 0xDC, 0x1B, 0xCC, 0x19, 0xCC,
+    0xCD, 0xDF, 0xD9, 0x9B, 0xA9, 0x49, 0x41, 0x1C, 0xC4, 0x7C, 0xC2, 0x5C, 0xC0, 0x2D, 0xC9, 0x7D,
+    0xE2, 0x9F, 0x58, 0x86, 0xD0, 0x10, 0xCC, 0x19, 0xCF, 0x29, 0x74, 0x86, 0xEC, 0x80, 0x7C, 0xC1,
+    0x1C, 0xC2, 0x3C, 0xC1, 0x8C, 0xC1, 0x0C, 0xC1, 0x6C, 0xE5, 0x95, 0xB8, 0x37, 0xC8, 0x0B, 0xCC,
+    0x1E, 0xCC, 0x11, 0xDC, 0x19, 0xCC, 0x1B, 0xCC, 0x0A, 0xCC, 0x58, 0xCC, 0x2C, 0xCD, 0xAE, 0xD0,
+    0xBE, 0xD8, 0x00, 0xCC, 0x0B, 0xCC, 0x46, 0xCC, 0x83, 0xCC, 0x13, 0xCD, 0x0D, 0xDE, 0xB9, 0xFD,
+    0xB9, 0xF6, 0x82, 0xBD, 0xC0, 0x3C, 0xC7, 0xBD, 0xC0, 0xEC, 0xD6, 0xDD, 0xC2, 0x5C, 0xDB, 0xCD,
+    0xC0, 0x6C, 0xC8, 0x7D, 0xC0, 0x4C, 0xFB, 0x9B, 0x38, 0xBD, 0xF5, 0xA3, 0xDE, 0x39, 0x41, 0xE5,
+    0xB5, 0x5A, 0x39, 0x7A, 0x51, 0x6C, 0xF5, 0x30, 0x6F, 0x30, 0xB7, 0x30, 0x5B, 0x30, 0x03, 0x3B,
+    0x25, 0xBA, 0x0D, 0x3D, 0x37, 0xF7, 0x10, 0x77, 0x02, 0xB3, 0x04, 0x73, 0x04, 0x33, 0x03, 0xB3,
+    0x05, 0xF3, 0x67, 0xB7, 0x1A, 0xF7, 0x28, 0xB7, 0xF6, 0x60, 0xAD, 0x71, 0xF3, 0x37, 0x76, 0x97,
+    0x40, 0x47, 0x20, 0xDB, 0x30, 0x2B, 0x35, 0x23, 0x70, 0x3F, 0x30, 0x13, 0x3A, 0xE6, 0x1F, 0x37,
+    0x05, 0xF2, 0x40, 0x6C, 0xFD, 0xB7, 0x4B, 0x7A, 0x64, 0x67, 0x99, 0xA3, 0x3F, 0x37, 0x02, 0x73,
+    0x32, 0xB7, 0x1F, 0xB3, 0x54, 0xF7, 0x08, 0x33, 0x9A, 0x48, 0x60, 0xBF, 0x40, 0xAB, 0x3F, 0xA6,
+    0xEF, 0x45, 0x2D, 0x15, 0x73, 0x46, 0x77, 0x00, 0x33, 0x5C, 0xF7, 0x19, 0x77, 0x06, 0x73, 0x0E,
+    0x33, 0x0B, 0x73, 0xD6, 0x5C, 0xBF, 0x3E, 0x30, 0x2F, 0x37, 0x17, 0x40, 0x97, 0x2A, 0x26, 0x87,
+    0xCD, 0x1B, 0x01, 0xB3, 0xB6, 0x61, 0x71, 0xF7, 0xF0, 0x6B, 0x30, 0x03, 0x30, 0xEF, 0x33, 0x53,
+    0x4B, 0x9D, 0x4B, 0xB8, 0x31, 0xE6, 0x2B, 0xEE, 0x0C, 0x66, 0xC1, 0x6E, 0x72, 0x6E, 0x24, 0xE6,
+    0x09, 0xE7, 0x5C, 0xAF, 0xED, 0xF8, 0xEE, 0x2E, 0xF0, 0x4D, 0x7D, 0x9B, 0xC4, 0x16, 0x66, 0x13,
+    0xE6, 0x18, 0xE7, 0xFC, 0xF5, 0xF0, 0x25, 0x80, 0x2E, 0x62, 0x4E, 0x60, 0x56, 0x71, 0x4C, 0xE6,
+    0x5E, 0x1A, 0x7F, 0x6F, 0x64, 0xB3, 0xFD, 0xBB, 0x40, 0xAE, 0x60, 0x1E, 0xE3, 0x8F, 0x60, 0x06,
+    0x60, 0xDE, 0x60, 0x66, 0x64, 0xCE, 0xE0, 0x06, 0x62, 0x76, 0x69, 0x46, 0x82, 0x86, 0xC2, 0x36,
+    0xE0, 0x0E, 0x61, 0x76, 0x77, 0xCD, 0xA4, 0xFE, 0x9F, 0xA4, 0xFE, 0x6B, 0x71, 0xE0, 0x26, 0x6C,
+    0x8E, 0xE1, 0xF6, 0x60, 0xFE, 0x60, 0x0E, 0x73, 0x4C, 0x2C, 0x92, 0x9C, 0x4B, 0xEE, 0x0D, 0xEE,
+    0x66, 0x68, 0xF1, 0x6D, 0xC4, 0xC5, 0x62, 0x26, 0xBA, 0xCC, 0x6F, 0x0F, 0x7C, 0x38, 0x66, 0x18,
+    0x66, 0x98, 0xEE, 0x03, 0xE6, 0xE0, 0x6E, 0x11, 0xE6, 0x0A, 0xE7, 0xC4, 0xA7, 0xD7, 0x66, 0x62,
+    0x1E, 0xE5, 0xD6, 0x80, 0x36, 0x40, 0x5E, 0x76, 0x49, 0x77, 0xDE, 0xBC, 0x02, 0x66, 0xE6, 0xEE,
+    0xFA, 0xEE, 0xC7, 0x6E, 0x25, 0x66, 0x03, 0xE6, 0x62, 0x6E, 0x03, 0xE6, 0x48, 0x6E, 0xDC, 0x6F,
+    0x54, 0x83, 0xE2, 0xAB, 0x56, 0x4A, 0x35, 0x86, 0xAC, 0x05, 0x67, 0x8C, 0x8F, 0x58, 0x7F, 0xFD,
+    0x4B, 0x56, 0xFA, 0x94, 0x1E, 0xEE, 0x1B, 0x67, 0x14, 0xD1, 0xD2, 0x05, 0xFD, 0x00, 0x4C, 0xF4,
+    0x9D, 0x7F, 0x8E, 0x60, 0x01, 0xCC, 0x0A, 0xCC, 0x7D, 0xDC, 0x5C, 0xCC, 0x1F, 0xCC, 0x13, 0xCC,
+    0x04, 0xCC, 0x25, 0xCC, 0x01, 0xCC, 0x31, 0xCC, 0x07, 0xCC, 0x22, 0xCC, 0x3B, 0xCC, 0x4C, 0xCC,
+    0x04, 0xCC, 0x06, 0xCC, 0x2A, 0xCD, 0x14, 0xDC, 0x27, 0xCF, 0x69, 0xAD, 0xF0, 0x56, 0x40, 0x4C,
+    0xC0, 0xAC, 0xC2, 0xAC, 0xC0, 0x0C, 0xE9, 0x9B, 0xDE, 0x5C, 0xE0, 0x66, 0xDC, 0x0E, 0xCC, 0x35,
+    0xCC, 0x0F, 0xCC, 0x22, 0xCC, 0x18, 0xCC, 0x02, 0xCC, 0x09, 0xCD, 0xA5, 0xDC, 0x02, 0xCC, 0x59,
+    0xDF, 0x99, 0xBD, 0x93, 0xD7, 0x02, 0x5C, 0xE9, 0x91, 0x3D, 0xA4, 0x38, 0x20, 0xCC, 0x0A, 0xCF,
+    0xC9, 0xAF, 0xBE, 0xC3, 0x74, 0x98, 0x7D, 0xFE, 0xA0, 0x0F, 0xCE, 0x19, 0xFF, 0x8E, 0xF0, 0x43,
+    0x0C, 0xC0, 0xBC, 0xC2, 0xFD, 0xC6, 0xED, 0xC1, 0x9C, 0xC0, 0x3C, 0xC2, 0x7C, 0xC0, 0x6C, 0xC6,
+    0x1D, 0xC0, 0x7C, 0xC0, 0xBC, 0xC2, 0x8C, 0xEC, 0x93, 0xCA, 0x4E, 0x45, 0xAA, 0xDF, 0x39, 0x92,
+    0x90, 0x59, 0x50, 0xBD, 0xE3, 0x95, 0x4D, 0x1E, 0xAA, 0x19, 0xB5, 0x93, 0x71, 0x1F, 0xFE, 0x19,
+    0xCD, 0x89, 0xDC, 0xE2, 0x97, 0x4F, 0x1F, 0xDA, 0x49, 0x3C, 0xA3, 0x65, 0x0A, 0xBD, 0xD9, 0x6D,
+    0xC0, 0x0C, 0xC0, 0xBD, 0xCE, 0x1D, 0xC0, 0x7C, 0xEB, 0x91, 0x9A, 0x25, 0x34, 0x1B, 0xDD, 0xBA,
+    0xDC, 0x09, 0xCD, 0x97, 0xDC, 0x40, 0xCC, 0x0C, 0xCD, 0xDD, 0xDD, 0x36, 0xDD, 0xDD, 0xEC, 0x44,
+    0xCC, 0x0A, 0xCC, 0x58, 0xCC, 0x0B, 0xCF, 0xF0, 0x11, 0xE5, 0xA3, 0x03, 0x32, 0xE2, 0x05, 0xB9,
+    0x67, 0x42, 0x5C, 0xB5, 0x80, 0xCE, 0x5F, 0x8A, 0x46, 0x62, 0x77, 0xF9, 0x0F, 0x72, 0xC0, 0x54,
+    0x6F, 0x51, 0x8A, 0x68, 0x8D, 0x94, 0xA4, 0x12, 0xCA, 0x3A, 0x26, 0x64, 0x04, 0x66, 0x00, 0xE7,
+    0x0C, 0x12, 0x72, 0x90, 0x84, 0x19, 0x01, 0x79, 0x81, 0xF9, 0x80, 0x19, 0xEF, 0xC7, 0x0C, 0x80,
+    0x1C, 0xF0, 0x82, 0xF6, 0x56, 0x80, 0x7F, 0x29, 0xF0, 0x3B, 0x90, 0x11, 0x98, 0x2D, 0x98, 0x0B,
+    0x9C, 0x44, 0x60, 0xCA, 0xD2, 0x15, 0xE5, 0xF0, 0xD0, 0x44, 0x3B, 0x80, 0x2E, 0x77, 0xB0, 0x7F,
+    0x2C, 0xA0, 0x5B, 0x90, 0x3B, 0xBF, 0xE0, 0x24, 0xC8, 0x00, 0xCC, 0x03, 0xCC, 0x1E, 0xCF, 0xE1,
+    0x32, 0xF1, 0x77, 0x38, 0xC2, 0xEE, 0x40, 0x36, 0x74, 0x89, 0x3C, 0xBF, 0x5C, 0x03, 0x66, 0x0B,
+    0x67, 0x88, 0x0C, 0x72, 0x80, 0x57, 0x7A, 0xFC, 0x70, 0x23, 0x30, 0x1B, 0x30, 0x43, 0x3D, 0x00,
+    0x6B, 0x90, 0x53, 0x98, 0x0F, 0x9F, 0xE8, 0x37, 0xCA, 0x2A, 0x1A, 0xE4, 0x0D, 0x67, 0x98, 0x0F,
+    0x72, 0xD4, 0x56, 0x7D, 0xDD, 0x70, 0x1B, 0x30, 0x5B, 0x70, 0x03, 0x30, 0x43, 0x30, 0x07, 0x30,
+    0xA7, 0x30, 0xCB, 0x30, 0x43, 0x30, 0x0B, 0x3A, 0x88, 0xB5, 0x90, 0x21, 0x98, 0x65, 0x98, 0x2D,
+    0x98, 0x07, 0x9D, 0x02, 0x75, 0x7C, 0xB9, 0x86, 0x7B, 0xF2, 0x21, 0x75, 0x18, 0x90, 0x0F, 0xB8,
+    0x73, 0xA4, 0x53, 0xDF, 0x6B, 0x02, 0x33, 0xE4, 0x8F, 0x39, 0x02, 0x19, 0x80, 0x39, 0x80, 0xD9,
+    0x83, 0xD9, 0x87, 0xB9, 0x80, 0x39, 0x84, 0x79, 0x81, 0xD9, 0x88, 0x19, 0x8A, 0x39, 0x82, 0x59,
+    0x81, 0x19, 0x85, 0x19, 0xFE, 0x2C, 0xB8, 0xCB, 0x20, 0x13, 0x98, 0x0F, 0x98, 0x13, 0xB8, 0x47,
+    0x98, 0x95, 0x98, 0x91, 0x98, 0xB5, 0xB8, 0x0D, 0x98, 0x09, 0x98, 0x91, 0xA6, 0x2F, 0x8B, 0x74,
+    0x0C, 0xF3, 0x11, 0xB3, 0x01, 0x33, 0x07, 0xF3, 0x04, 0xB3, 0x01, 0x37, 0x0B, 0x73, 0x03, 0x33,
+    0x88, 0x54, 0x29, 0xD4, 0xB0, 0x07, 0x30, 0x03, 0x30, 0x97, 0x30, 0x7B, 0x3E, 0x84, 0xAB, 0x93,
+    0x70, 0x02, 0xF3, 0x0A, 0xB3, 0x01, 0x73, 0x10, 0x33, 0x03, 0x33, 0x00, 0xB3, 0xAC, 0x4D, 0x70,
+    0x73, 0x01, 0x47, 0x70, 0x0F, 0x31, 0x23, 0x30, 0x07, 0x30, 0xE7, 0x30, 0x33, 0x30, 0xB3, 0x30,
+    0x47, 0x31, 0x53, 0x30, 0x97, 0x30, 0x73, 0x70, 0x9B, 0x30, 0x4F, 0x70, 0x03, 0x3F, 0x87, 0xA2,
+    0x14, 0x2A, 0xE8, 0x03, 0xE6, 0x06, 0xE6, 0x03, 0xE6, 0x0A, 0xE6, 0x4A, 0xE6, 0x3E, 0x66, 0x08,
+    0x66, 0x02, 0xE7, 0xE8, 0xA1, 0xE4, 0x2D, 0x60, 0x36, 0x61, 0x06, 0x70, 0x8D, 0xE7, 0xDA, 0xE6,
+    0x08, 0x66, 0x00, 0x66, 0x1C, 0x66, 0x08, 0xE6, 0x22, 0xE7, 0x56, 0x1E, 0x32, 0x1D, 0xF7, 0x0A,
+    0x73, 0x03, 0xF3, 0xA4, 0x40, 0xF0, 0x50, 0x10, 0x07, 0x31, 0xFF, 0x70, 0x9F, 0x31, 0x5F, 0x40,
+    0x37, 0x20, 0xE3, 0x32, 0x07, 0x70, 0x0F, 0x30, 0x1F, 0x30, 0x37, 0x30, 0xBB, 0x30, 0x47, 0x30,
+    0x83, 0x31, 0xF3, 0x70, 0x83, 0x30, 0x47, 0x31, 0x37, 0x7E, 0x86, 0xB3, 0xE5, 0xCB, 0x0F, 0x33,
+    0x94, 0x66, 0xB2, 0xFD, 0x30, 0x7B, 0x30, 0xE3, 0x30, 0x07, 0x30, 0x37, 0x3B, 0x86, 0x97, 0xFD,
+    0xD7, 0xEC, 0x4F, 0xE8, 0x83, 0x7E, 0x85, 0xDE, 0x80, 0xB6, 0x40, 0x36, 0x61, 0x06, 0x60, 0xB6,
+    0x60, 0x06, 0x60, 0x16, 0x60, 0x36, 0x66, 0x26, 0xFD, 0x88, 0xCD, 0xB3, 0x16, 0x07, 0x67, 0xF0,
+    0xCB, 0x45, 0xE9, 0xC3, 0xDE, 0xE1, 0xDE, 0x60, 0xDE, 0x79, 0x88, 0x04, 0x57, 0xE0, 0x05, 0xE6,
+    0x01, 0x66, 0x3C, 0xE6, 0x05, 0xE6, 0x03, 0x66, 0x07, 0x66, 0x46, 0x6F, 0x28, 0xF1, 0xE2, 0x65,
+    0xE0, 0x0E, 0x64, 0x0E, 0xE1, 0x76, 0x60, 0x36, 0x61, 0x8E, 0xE3, 0xF6, 0x60, 0x0E, 0x62, 0x9E,
+    0x61, 0x7E, 0x60, 0x56, 0x60, 0x1E, 0xE0, 0x36, 0x61, 0xC6, 0x79, 0x8F, 0xAD, 0x62, 0x20, 0x0E,
+    0xE6, 0x06, 0x66, 0x07, 0x66, 0x0C, 0xE7, 0x80, 0xD4, 0x50, 0xF4, 0x20, 0x3E, 0x61, 0xD6, 0x62,
+    0x6E, 0x61, 0x6E, 0xF1, 0x0D, 0xA6, 0xEB, 0xA8, 0x2C, 0xE6, 0x11, 0xEE, 0x28, 0x66, 0x77, 0xEE,
+    0x26, 0x66, 0x38, 0xEF, 0xE8, 0x9D, 0xDD, 0x68, 0x80, 0x0E, 0x60, 0xCE, 0x60, 0x0E, 0x65, 0x8E,
+    0x80, 0x5E, 0x40, 0x1E, 0x60, 0x56, 0x60, 0x0E, 0x60, 0x06, 0x72, 0x0D, 0xFE, 0x7A, 0x9E, 0x2B,
+    0xE6, 0x0C, 0xE6, 0x0D, 0x6E, 0x00, 0xE6, 0x02, 0x66, 0x13, 0x67, 0xB8, 0xE2, 0x6A, 0xEC, 0x21,
+    0xAE, 0x60, 0xB6, 0x61, 0xEE, 0x61, 0xC6, 0xE3, 0x2E, 0x61, 0x56, 0x62, 0x66, 0x70, 0x8A, 0x65,
+    0x97, 0x72, 0x03, 0xE6, 0x02, 0xE6, 0x4E, 0xE6, 0x0C, 0xE6, 0x01, 0xE6, 0x30, 0xE6, 0x46, 0xE6,
+    0x20, 0xEE, 0x28, 0xE6, 0x4C, 0x6E, 0x14, 0xE6, 0x20, 0x6E, 0x91, 0x6F, 0x60, 0xAF, 0xE4, 0xF1,
+    0xE0, 0xB6, 0xE3, 0x76, 0x79, 0x0E, 0xFE, 0xEE, 0x8C, 0x0B, 0xE6, 0x1B, 0xE6, 0x11, 0x66, 0x04,
+    0x66, 0x05, 0x67, 0x90, 0x9C, 0x75, 0x66, 0x85, 0x96, 0xE1, 0x4E, 0x60, 0xDE, 0x61, 0x6E, 0x60,
+    0xF6, 0x62, 0xC6, 0x7C, 0x0F, 0x47, 0x8F, 0x04, 0x02, 0xE7, 0xD0, 0x9E, 0xF0, 0xBF, 0xA0, 0xDE,
+    0x70, 0x0E, 0x07, 0x86, 0x43, 0xF0, 0xA9, 0x76, 0x24, 0xA0, 0x66, 0x67, 0x8E, 0xE0, 0x66, 0x69,
+    0xAE, 0xE0, 0xC6, 0x60, 0x76, 0x62, 0xC6, 0x60, 0x7E, 0x60, 0x66, 0x7D, 0x0D, 0x45, 0x9A, 0x7C,
+    0x01, 0x66, 0x0F, 0x66, 0x05, 0xE6, 0x0F, 0x66, 0x07, 0x67, 0x70, 0xD4, 0x73, 0xE0, 0x99, 0x0E,
+    0x17, 0xEF, 0x92, 0x24, 0x66, 0x42, 0xEE, 0x22, 0xE6, 0x07, 0x66, 0x1A, 0x66, 0x1F, 0xF6, 0x1B,
+    0xE6, 0x0B, 0xE6, 0x14, 0xE6, 0x19, 0xE7, 0x30, 0xB4, 0x68, 0xF3, 0x60, 0x1E, 0x66, 0x56, 0xE1,
+    0x96, 0x60, 0x6E, 0x60, 0x96, 0x63, 0xA6, 0xE0, 0x06, 0x60, 0x86, 0x60, 0xA6, 0x61, 0x2E, 0x61,
+    0xC6, 0xE0, 0x0E, 0x60, 0x1E, 0x62, 0xFE, 0x66, 0x76, 0xE1, 0x1E, 0x78, 0x09, 0xED, 0x4F, 0x78,
+    0x05, 0x67, 0x70, 0x9B, 0x49, 0x20, 0x80, 0x2E, 0x63, 0xCE, 0x61, 0x6E, 0x60, 0x0E, 0x62, 0xFE,
+    0x60, 0xD6, 0x62, 0x9E, 0x69, 0x46, 0xE0, 0x0E, 0x60, 0xE6, 0x69, 0x27, 0x60, 0x96, 0x60, 0x4E,
+    0x60, 0xF6, 0x62, 0xFE, 0x60, 0x8E, 0x7A, 0x8A, 0x3E, 0xE7, 0x22, 0x08, 0xE6, 0x0D, 0x6E, 0x16,
+    0xE6, 0x03, 0xE6, 0x1A, 0x66, 0x3E, 0xE6, 0x0B, 0x66, 0x16, 0xE6, 0x09, 0xE6, 0x02, 0x6E, 0x7F,
+    0xEE, 0x02, 0xE6, 0x20, 0x66, 0x2B, 0x6E, 0x06, 0xE6, 0x03, 0x66, 0x0C, 0x66, 0x19, 0x66, 0x0E,
+    0xE6, 0x11, 0x67, 0xC8, 0x82, 0x62, 0xB7, 0x81, 0x86, 0x62, 0x7E, 0xE0, 0x8E, 0x62, 0x86, 0x7D,
+    0x09, 0x7C, 0x3A, 0x8E, 0x28, 0x69, 0x43, 0xCA, 0xE2, 0xC0, 0xFC, 0xC0, 0xEC, 0xC1, 0x2C, 0xD0,
+    0xAD, 0xC0, 0x9D, 0xC2, 0xDD, 0xEB, 0x1A, 0xEB, 0xBE, 0xC0, 0x21, 0xCD, 0xB6, 0xD3, 0x7B, 0xE5,
+    0x99, 0x0D, 0x79, 0xEA, 0x30, 0xDC, 0x58, 0xDC, 0x83, 0x6F, 0x0A, 0xE4, 0x83, 0xDB, 0x87, 0x39,
+    0xF0, 0x25, 0x7B, 0x1D, 0x38, 0x4D, 0x98, 0xA3, 0xBB, 0xA7, 0xB8, 0xB7, 0x98, 0xDD, 0xB8, 0xDB,
+    0x98, 0x19, 0x98, 0x2D, 0x98, 0x11, 0x98, 0x39, 0x98, 0x09, 0x99, 0xE3, 0xBA, 0x8D, 0xBA, 0xF1,
+    0xA0, 0x51, 0x90, 0x19, 0xB9, 0x99, 0xBE, 0x83, 0x1F, 0xE5, 0xED, 0xEA, 0x3D, 0xF2, 0x69, 0x40,
+    0x2D, 0x9A, 0x43, 0xA0, 0x13, 0x90, 0x3F, 0x98, 0x01, 0x98, 0x07, 0x98, 0x5F, 0x98, 0x4F, 0x98,
+    0x25, 0x98, 0x19, 0x98, 0x97, 0x98, 0x07, 0x9D, 0x03, 0x55, 0xB6, 0x8A, 0x80, 0x99, 0xB9, 0x5B,
+    0xEA, 0x3A, 0xD0, 0x3B, 0xE0, 0x2D, 0x9A, 0x85, 0xA4, 0xF2, 0x1B, 0x0A, 0xD4, 0x4F, 0xF1, 0xB1,
+    0xD6, 0xB3, 0x7A, 0xC4, 0x0B, 0xD7, 0xAF, 0xC4, 0x75, 0x35, 0x93, 0xB2, 0x1B, 0x71, 0xA7, 0x70,
+    0x2F, 0x36, 0x7F, 0x44, 0xA7, 0x60, 0x0F, 0x72, 0x57, 0x74, 0x33, 0x41, 0x43, 0x61, 0x83, 0x30,
+    0x7F, 0x32, 0xF3, 0x70, 0x3F, 0x30, 0x8F, 0x74, 0xDF, 0x70, 0xAF, 0x30, 0x3F, 0x30, 0xEF, 0x38,
+    0xC5, 0x9A, 0x5B, 0x4B, 0x01, 0x33, 0x66, 0x37, 0xC4, 0x43, 0x29, 0xDF, 0x50, 0x1F, 0x30, 0x0F,
+    0x73, 0x87, 0x76, 0x9B, 0x70, 0x03, 0x31, 0x5B, 0x30, 0x87, 0x30, 0x8F, 0x71, 0x4F, 0x36, 0x87,
+    0x7A, 0x04, 0x43, 0xCB, 0x0D, 0x4F, 0xB4, 0x0A, 0x32, 0x1B, 0x74, 0x02, 0x32, 0x00, 0xF7, 0x2E,
+    0xF7, 0xFC, 0x5D, 0xA6, 0x90, 0xD1, 0xB7, 0x31, 0xA7, 0x75, 0x03, 0x40, 0xBF, 0x2E, 0x47, 0x1E,
+    0x8B, 0x6A, 0x01, 0xF3, 0x07, 0xF3, 0x78, 0x77, 0x08, 0x37, 0x36, 0xF7, 0x06, 0x73, 0x01, 0xF3,
+    0x58, 0xF7, 0x73, 0xF7, 0x65, 0x37, 0x03, 0x33, 0x0A, 0xB3, 0x69, 0xB7, 0x6D, 0x77, 0x02, 0xF3,
+    0xD4, 0x76, 0x7C, 0xF9, 0xE0, 0x73, 0x3C, 0x84, 0x9B, 0x2B, 0xD3, 0x01, 0x33, 0x05, 0xB3, 0x0C,
+    0xF3, 0x0A, 0x33, 0xB0, 0x69, 0xE9, 0xB3, 0x69, 0x84, 0x83, 0x3B, 0xD6, 0x1E, 0xB4, 0x03, 0xF2,
+    0x7E, 0xF7, 0x76, 0x37, 0x71, 0x77, 0x00, 0x73, 0x07, 0x33, 0x88, 0x78, 0xA0, 0x3D, 0xD0, 0x63,
+    0x3A, 0x04, 0x53, 0xA1, 0xC5, 0x02, 0xF3, 0x05, 0x73, 0x3E, 0x37, 0xF4, 0x6A, 0xBF, 0xBB, 0xE9,
+    0xC5, 0x23, 0x6B, 0x7F, 0x01, 0x33, 0x02, 0xB3, 0x00, 0x73, 0x4C, 0x37, 0x07, 0x73, 0x8C, 0x66,
+    0xF0, 0xBD, 0x22, 0x7F, 0x71, 0x4B, 0x70, 0x0B, 0x30, 0x8F, 0x3A, 0x84, 0xBA, 0xFA, 0x61, 0xE8,
+    0x87, 0xEE, 0x1D, 0x66, 0x4C, 0x6E, 0x52, 0x6E, 0x3D, 0x6E, 0x2E, 0xE6, 0x02, 0x67, 0x98, 0xE3,
+    0x4E, 0x2A, 0xC2, 0x9E, 0x60, 0x96, 0x61, 0x6E, 0x69, 0xA6, 0xE0, 0xAE, 0x61, 0x9E, 0x68, 0x36,
+    0xE1, 0x16, 0xE2, 0x6E, 0x62, 0x36, 0x60, 0x86, 0xE2, 0x06, 0x80, 0xA6, 0x40, 0x16, 0x60, 0x8E,
+    0x60, 0x06, 0x60, 0xF6, 0x75, 0x88, 0xEE, 0x0F, 0x5A, 0x0F, 0x66, 0x0C, 0x67, 0xD0, 0xEB, 0x5B,
+    0xFF, 0xE2, 0x4E, 0x62, 0xC6, 0x68, 0x66, 0xE0, 0x7E, 0x61, 0xB6, 0xE1, 0x3E, 0x60, 0xC6, 0xF6,
+    0x08, 0x75, 0xD7, 0x2C, 0x0B, 0xE6, 0x4B, 0xE6, 0xD7, 0x6E, 0x56, 0x6E, 0x04, 0x66, 0x12, 0x66,
+    0x00, 0x66, 0x63, 0xE6, 0x2A, 0x66, 0x31, 0x6E, 0x17, 0xEE, 0x0E, 0x66, 0xC8, 0xEE, 0xA8, 0x6E,
+    0x02, 0xE6, 0x03, 0xE6, 0x59, 0x6E, 0x20, 0x6E, 0x00, 0xE6, 0xCC, 0xEE, 0x08, 0x66, 0x03, 0x66,
+    0x06, 0xE6, 0x19, 0x66, 0x06, 0xE6, 0x0C, 0x65, 0xBE, 0x07, 0xB3, 0x0D, 0x77, 0x5A, 0xF4, 0xE3,
+    0x7B, 0xBF, 0x60, 0x8E, 0x62, 0x0E, 0x79, 0x09, 0xDC, 0x7B, 0x16, 0x05, 0x66, 0x17, 0xE6, 0x49,
+    0xEE, 0xAC, 0xEE, 0x10, 0x66, 0x1B, 0xE6, 0x00, 0x66, 0x15, 0xE6, 0x01, 0xEF, 0x40, 0xF6, 0x43,
+    0xB3, 0x40, 0xA6, 0x68, 0x5E, 0xE0, 0x76, 0x7A, 0x8D, 0xCD, 0xE8, 0xF0, 0xD1, 0x2B, 0xDC, 0x9B,
+    0xCD, 0x6A, 0xDC, 0x39, 0xCD, 0x5A, 0xDC, 0x01, 0xCE, 0x31, 0x51, 0xA5, 0x5C, 0xD5, 0x4D, 0xC0,
+    0x9C, 0xC4, 0x0C, 0xC4, 0x5C, 0xC0, 0xAC, 0xF0, 0x16, 0x7F, 0xED, 0x04, 0x61, 0xDC, 0x07, 0xCF,
+    0x71, 0x1E, 0xF4, 0xDE, 0x42, 0x6D, 0xC0, 0x0C, 0xFE, 0x19, 0xD9, 0x15, 0xF8, 0x21, 0xCC, 0x5F,
+    0xCF, 0x01, 0x5A, 0xA7, 0x6D, 0xC0, 0x4C, 0xFA, 0x1F, 0xFC, 0xBE, 0x39, 0x81, 0xDC, 0x47, 0xDC,
+    0x43, 0xCD, 0xB9, 0xDC, 0x08, 0xCC, 0x3E, 0xD0, 0x6F, 0xC8, 0xA8, 0xDC, 0x2F, 0xDF, 0xD1, 0xD1,
+    0xEE, 0x59, 0xB3, 0x15, 0xCE, 0xA5, 0x80, 0x1F, 0xCC, 0x09, 0xCC, 0x4A, 0xDC, 0x96, 0xDC, 0x0B,
+    0xCE, 0x51, 0x26, 0xEB, 0xCC, 0xC3, 0xDC, 0xCE, 0x2D, 0xD3, 0x9D, 0xC2, 0x1C, 0xC6, 0x5C, 0xC0,
+    0x3C, 0xC0, 0xEC, 0xC6, 0x3C, 0xC0, 0x3C, 0xFA, 0x1B, 0x1D, 0x5C, 0x56, 0x31, 0x83, 0xD0, 0xC4,
+    0x48, 0xAC, 0xC3, 0xBC, 0xF6, 0x12, 0x0F, 0x3C, 0xF3, 0x91, 0xD5, 0xEC, 0x71, 0xBF, 0x1C, 0x4A,
+    0xB5, 0x40, 0x9D, 0xDC, 0x15, 0xCC, 0x0E, 0xDC, 0x21, 0xCC, 0x9C, 0xDC, 0x18, 0xCC, 0x22, 0xCC,
+    0x0E, 0xCC, 0x98, 0xDC, 0xFD, 0xDC, 0x01, 0xCC, 0x35, 0xCD, 0x22, 0xDC, 0x81, 0xDD, 0x33, 0xEC,
+    0x03, 0xCE, 0x31, 0x49, 0xF3, 0xD3, 0xCC, 0x9D, 0x03, 0xBC, 0x82, 0x9C, 0xC1, 0x9D, 0xE8, 0x1E,
+    0x39, 0xD8, 0x4F, 0xA0, 0x1B, 0x98, 0x31, 0x98, 0x2B, 0xBB, 0xD1, 0xB8, 0x19, 0x98, 0x79, 0x99,
+    0x6F, 0xBE, 0x62, 0x21, 0x12, 0xF2, 0xC6, 0x24, 0x12, 0x9A, 0x38, 0x4D, 0x9B, 0x63, 0xB8, 0x73,
+    0x9A, 0x19, 0xBC, 0x02, 0xBB, 0x0B, 0xA7, 0x82, 0xB9, 0x83, 0x99, 0xEC, 0x34, 0x9C, 0x99, 0xFB,
+    0xB1, 0xB8, 0x15, 0x9C, 0x02, 0x37, 0x58, 0x99, 0x87, 0x59, 0x83, 0x79, 0x89, 0xD9, 0x83, 0x59,
+    0x83, 0x39, 0x87, 0x19, 0x83, 0x39, 0x81, 0x19, 0x83, 0x19, 0xA9, 0x1A, 0x01, 0xF9, 0x04, 0x39,
+    0xFA, 0x25, 0x53, 0x69, 0x02, 0x75, 0xBF, 0xA2, 0x13, 0x67, 0x93, 0x03, 0x3B, 0xE0, 0x39, 0xF3,
+    0x2B, 0xB0, 0x21, 0x98, 0x25, 0x98, 0x75, 0x98, 0x1B, 0x98, 0x5B, 0xB8, 0x39, 0x99, 0x21, 0xBA,
+    0xFB, 0xB8, 0x49, 0x98, 0x31, 0x99, 0x1B, 0xB8, 0x0F, 0x9A, 0x65, 0xD8, 0x1F, 0x9E, 0x43, 0xF1,
+    0x9B, 0x96, 0x83, 0xD9, 0xCE, 0x3A, 0x7F, 0x3D, 0x2B, 0x03, 0xA6, 0x17, 0xFB, 0x63, 0x01, 0x73,
+    0x38, 0xB3, 0x03, 0xF3, 0xE4, 0x68, 0x65, 0xB3, 0x20, 0x87, 0x36, 0x43, 0x70, 0x0B, 0x37, 0xEB,
+    0x70, 0xC3, 0x70, 0x5F, 0x30, 0x53, 0x73, 0x5F, 0x70, 0xF3, 0x37, 0x0F, 0x71, 0x4B, 0x30, 0x8F,
+    0x31, 0x07, 0x70, 0xAF, 0x70, 0x0F, 0x36, 0x17, 0x70, 0x33, 0x30, 0x4B, 0x30, 0x47, 0x39, 0x06,
+    0x86, 0x56, 0x5D, 0x68, 0x0E, 0x66, 0x4F, 0xE7, 0x28, 0xE0, 0x44, 0x27, 0xAC, 0x3E, 0xE4, 0xD6,
+    0xE1, 0x8E, 0xE0, 0x2E, 0x7F, 0x8F, 0x3E, 0x2A, 0x7E, 0x00, 0xE6, 0x24, 0xEE, 0x19, 0xE6, 0x51,
+    0x6E, 0x19, 0x66, 0x0D, 0x66, 0x09, 0xE6, 0x07, 0x67, 0x40, 0xE1, 0x73, 0x3F, 0xC0, 0x96, 0xE0,
+    0x3E, 0x60, 0x5E, 0x68, 0x7E, 0xE0, 0x7E, 0x60, 0x26, 0xE1, 0x36, 0x63, 0xA6, 0xE0, 0x86, 0x60,
+    0x36, 0x61, 0xAE, 0xE1, 0x9E, 0x61, 0x66, 0x60, 0x26, 0x61, 0x3E, 0x60, 0x9E, 0x65, 0x4E, 0x60,
+    0xC6, 0xE3, 0x8E, 0xEE, 0x97, 0x02, 0x4E, 0x40, 0x96, 0x77, 0x8B, 0xDD, 0x96, 0xCA, 0x3A, 0xE6,
+    0x01, 0xE6, 0x38, 0xE6, 0x12, 0xE6, 0x3F, 0xEE, 0xD4, 0x6E, 0x07, 0x66, 0x18, 0x6E, 0x0B, 0xE7,
+    0x28, 0xD1, 0x5C, 0xFD, 0xA0, 0x2E, 0xE1, 0x26, 0xE1, 0x5E, 0x60, 0x3E, 0x60, 0x6E, 0x60, 0x7E,
+    0x7D, 0x0A, 0xF5, 0x3A, 0xF6, 0x27, 0x66, 0x13, 0xE7, 0x00, 0xE2, 0xCD, 0xF6, 0x20, 0x56, 0x60,
+    0x3E, 0x60, 0xC6, 0x60, 0x76, 0x60, 0x2E, 0x6D, 0x9E, 0x95, 0xF9, 0xFE, 0x10, 0x14, 0xCF, 0x71,
+    0x5A, 0xF3, 0xC3, 0x7C, 0x11, 0x5D, 0xAC, 0xC0, 0x21, 0xCC, 0x07, 0xCC, 0x06, 0xCE, 0x61, 0xAD,
+    0xF1, 0x5F, 0x14, 0xBD, 0xC2, 0xDC, 0xC9, 0x2D, 0xC1, 0x1C, 0xC6, 0xBC, 0xC1, 0x7C, 0xDB, 0xDD,
+    0xC1, 0xDC, 0xF4, 0x13, 0xD8, 0x77, 0x6D, 0x94, 0xDC, 0x0B, 0xCC, 0x44, 0xCC, 0x2D, 0xCC, 0x4F,
+    0xCC, 0x0C, 0xCF, 0xD1, 0xA4, 0xF5, 0xCF, 0x81, 0x6C, 0xDF, 0x4D, 0xC3, 0x0D, 0x00, 0x7C, 0x82,
+    0xFC, 0xCA, 0xFD, 0xDF, 0x7D, 0xFA, 0x13, 0x58, 0xAE, 0x28, 0x02, 0xCD, 0x15, 0xDD, 0x23, 0xD3,
+    0x09, 0x82, 0xA8, 0x80, 0x99, 0xDE, 0x34, 0xD0, 0xED, 0xE4, 0x63, 0xA3, 0xF3, 0xB8, 0x5C, 0x2B,
+    0x5C, 0xAA, 0x81, 0xEB, 0xA0, 0x21, 0x90, 0x27, 0x98, 0x05, 0x98, 0x17, 0x98, 0x25, 0x98, 0x8B,
+    0x9F, 0x02, 0x49, 0xAF, 0xD9, 0x03, 0x59, 0x8E, 0xBB, 0xFC, 0x3A, 0xF6, 0x39, 0x40, 0xC1, 0x9D,
+    0xE3, 0x49, 0xB4, 0x29, 0xB4, 0x17, 0x37, 0x68, 0x77, 0x0B, 0x73, 0x11, 0xF7, 0x01, 0xF3, 0x0C,
+    0x33, 0xDC, 0x70, 0x24, 0xB9, 0x70, 0x13, 0x30, 0x2F, 0x7C, 0xC4, 0xAB, 0xB5, 0x0F, 0x05, 0xB3,
+    0x13, 0xF7, 0x62, 0xB7, 0x03, 0x37, 0x40, 0xF7, 0x26, 0xB7, 0x02, 0xB3, 0xC4, 0x61, 0xEC, 0x56,
+    0x21, 0xDB, 0x70, 0x17, 0x70, 0x5B, 0x35, 0x8B, 0x70, 0xBF, 0x3E, 0x04, 0x0B, 0x7D, 0x02, 0xCA,
+    0x5B, 0xC4, 0x6D, 0x41, 0x5C, 0xC1, 0x3C, 0xF2, 0x15, 0xBE, 0x5D, 0x9C, 0x59, 0xCC, 0x0E, 0xCC,
+    0x93, 0xCF, 0x71, 0xEF, 0x85, 0x6A, 0xC2, 0x8D, 0xF3, 0x11, 0x5F, 0x54, 0xCC, 0x3A, 0xCC, 0x7D,
+    0xCC, 0x0A, 0xCD, 0x89, 0xDC, 0x5C, 0xCC, 0x16, 0xCD, 0x22, 0xDF, 0xE1, 0x67, 0xF0, 0xC5, 0x86,
+    0xDD, 0xC6, 0x8C, 0xC1, 0x6C, 0xD3, 0x9D, 0xC1, 0xDC, 0xEC, 0x19, 0x4C, 0x3F, 0x9C, 0x09, 0xCC,
+    0x05, 0xCD, 0x68, 0xDC, 0x0A, 0xCE, 0x61, 0x4C, 0xB6, 0x4D, 0x80, 0x5C, 0xC5, 0xBC, 0xC3, 0x4C,
+    0xF0, 0x1F, 0xD8, 0x9D, 0xCC, 0x07, 0xCF, 0x01, 0x15, 0xDB, 0x45, 0x1E, 0xBD, 0x64, 0xD3, 0xA0,
+    0xBB, 0x30, 0x7B, 0x30, 0x33, 0x30, 0x6F, 0x30, 0xAB, 0x32, 0xF3, 0x70, 0x07, 0x30, 0x2F, 0x2E,
+    0xE0, 0x19, 0x98, 0x01, 0x9B, 0xB7, 0xB0, 0x9B, 0xA0, 0x47, 0x98, 0x67, 0x98, 0x0B, 0x99, 0x51,
+    0xB8, 0xDF, 0x99, 0x1D, 0xBA, 0x03, 0xB8, 0x97, 0xB9, 0xC5, 0xB8, 0x2B, 0x98, 0x59, 0x98, 0x7F,
+    0xA1, 0xB7, 0xB0, 0x07, 0x98, 0x2D, 0x9B, 0x0B, 0xB8, 0xC7, 0x98, 0x13, 0xA0, 0x17, 0x91, 0xD5,
+    0xB8, 0x63, 0x98, 0x15, 0x9F, 0xC3, 0x3B, 0x10, 0x74, 0x74, 0x02, 0xB3, 0x39, 0xF7, 0x73, 0xB7,
+    0x76, 0x37, 0x01, 0x33, 0xF0, 0x58, 0xF0, 0x19, 0xE5, 0x0B, 0x70, 0x17, 0x30, 0xA3, 0x36, 0xE3,
+    0x7A, 0x86, 0x52, 0xC5, 0x45, 0x06, 0x33, 0x05, 0x73, 0x0A, 0xB3, 0x06, 0x33, 0x61, 0x37, 0x01,
+    0x73, 0x5A, 0x37, 0x05, 0x37, 0x37, 0x37, 0x29, 0xB3, 0x6D, 0xB7, 0x03, 0xB3, 0x05, 0x33, 0x01,
+    0xB3, 0xD4, 0x43, 0xBA, 0xD5, 0x44, 0xFF, 0x70, 0x7F, 0x31, 0x27, 0x72, 0x17, 0x7B, 0xC4, 0x06,
+    0xB9, 0x87, 0x03, 0xF3, 0x45, 0x37, 0x4D, 0xB4, 0x35, 0x36, 0x50, 0xF7, 0x12, 0x73, 0x13, 0xB7,
+    0x3D, 0xB7, 0x02, 0x73, 0xA4, 0x53, 0x79, 0x96, 0xF0, 0x47, 0x3A, 0x47, 0x8A, 0xA9, 0xE8, 0x01,
+    0xB3, 0x02, 0x33, 0x0D, 0xF3, 0x08, 0xB3, 0x00, 0x73, 0x11, 0x73, 0x05, 0xB3, 0x12, 0xB7, 0xD4,
+    0x6A, 0x23, 0x1F, 0xB0, 0x4F, 0x30, 0x43, 0x3B, 0x05, 0x33, 0xDD, 0xFE, 0x19, 0xF7, 0x80, 0x72,
+    0x2D, 0xAD, 0x46, 0x8B, 0x26, 0xE1, 0x5E, 0x60, 0xC6, 0xEC, 0x26, 0xE1, 0x96, 0x63, 0xAE, 0xE0,
+    0xBE, 0x74, 0x8F, 0x94, 0x9F, 0x0C, 0x12, 0xEE, 0x10, 0x69, 0x2C, 0xBA, 0x75, 0x00, 0xFC, 0xC7,
+    0x6D, 0xC0, 0xFC, 0xC2, 0xFC, 0xFC, 0x10, 0xFF, 0x0E, 0x7C, 0x1C, 0xCD, 0x49, 0xDE, 0x71, 0x07,
+    0xE6, 0x6A, 0xC0, 0x6C, 0xDF, 0x8D, 0xC1, 0x2C, 0xC5, 0x5C, 0xC1, 0x5C, 0xC8, 0xAD, 0xC1, 0xAC,
+    0xC7, 0xFC, 0xC9, 0xED, 0xFE, 0x15, 0xDF, 0xB6, 0x30, 0x04, 0xCC, 0x07, 0xCC, 0x00, 0xCC, 0x23,
+    0xCC, 0x18, 0xCD, 0x7C, 0xDC, 0xD3, 0xDC, 0x40, 0xCF, 0x21, 0x57, 0xB8, 0x6B, 0x03, 0x5C, 0xC2,
+    0xAD, 0xC0, 0x9C, 0xD9, 0xCD, 0x04, 0x0C, 0x84, 0x2C, 0xC0, 0xBC, 0xC2, 0x2C, 0xC0, 0x2C, 0xC2,
+    0x5C, 0xEC, 0x13, 0xD9, 0xFF, 0x94, 0x18, 0xCC, 0x1B, 0xCC, 0x27, 0xCC, 0x07, 0xCC, 0x24, 0xEC,
+    0x12, 0xCE, 0x61, 0xDC, 0xC8, 0xE5, 0xCE, 0xDE, 0xC6, 0x2D, 0xD7, 0xDD, 0x06, 0xAC, 0x80, 0xAC,
+    0xFB, 0x11, 0xD9, 0x07, 0x28, 0x49, 0xDC, 0x06, 0xCC, 0x00, 0xCC, 0xB3, 0xDD, 0xBE, 0xDC, 0x02,
+    0xCC, 0x1A, 0xCC, 0x0F, 0xCC, 0x66, 0xDC, 0xEC, 0xDD, 0x3D, 0xD2, 0xB5, 0x01, 0xFC, 0x81, 0x39,
+    0xFC, 0x3D, 0xD6, 0x1C, 0x19, 0x5B, 0xBB, 0xF1, 0xBC, 0x62, 0x31, 0x81, 0xC9, 0x89, 0x99, 0x86,
+    0x39, 0xB2, 0xDB, 0xE8, 0x3E, 0x1C, 0x7B, 0xA0, 0x27, 0x98, 0x05, 0x98, 0x27, 0x98, 0x8D, 0x98,
+    0x11, 0x98, 0xC3, 0x9B, 0x69, 0xA6, 0x2A, 0xD1, 0x28, 0x0D, 0x73, 0x4F, 0x37, 0x10, 0x73, 0x54,
+    0x37, 0x21, 0xF7, 0x68, 0x77, 0x72, 0xF7, 0x00, 0x73, 0x01, 0xB3, 0x0D, 0xB3, 0x06, 0x73, 0x90,
+    0x57, 0x60, 0xF0, 0x61, 0x03, 0x37, 0x23, 0x76, 0x83, 0x70, 0x1B, 0x30, 0x47, 0x70, 0xDF, 0x37,
+    0xD3, 0x70, 0x13, 0x30, 0x2B, 0x31, 0x5B, 0x31, 0x77, 0x70, 0xDF, 0x36, 0xE3, 0x40, 0x03, 0x20,
+    0x8F, 0x31, 0x93, 0x70, 0x8B, 0x31, 0xE7, 0x70, 0x77, 0x31, 0x33, 0x3A, 0x86, 0xEF, 0xFD, 0xF9,
+    0x0C, 0x73, 0x04, 0x33, 0x5C, 0xB4, 0xC5, 0x42, 0x3C, 0x42, 0xF6, 0x60, 0xC6, 0x60, 0xBE, 0x63,
+    0xCE, 0xF4, 0x8A, 0xF5, 0x2A, 0x54, 0x1F, 0x66, 0x10, 0xE6, 0x02, 0xE6, 0xCB, 0x6E, 0x0A, 0x67,
+    0xD0, 0x96, 0xEF, 0xE2, 0x20, 0x0E, 0x60, 0xC6, 0x61, 0xF6, 0x61, 0x7E, 0xE0, 0x06, 0x60, 0x66,
+    0xE0, 0x36, 0x60, 0xBE, 0x64, 0x46, 0xFC, 0x89, 0xCE, 0x37, 0xD6, 0x23, 0x6F, 0x40, 0xDC, 0x6F,
+    0xB5, 0x88, 0x5E, 0xE1, 0xC6, 0xE1, 0x3E, 0x60, 0x96, 0x60, 0xA7, 0x71, 0x0B, 0xD5, 0x36, 0x66,
+    0xE2, 0xE8, 0x13, 0x64, 0x56, 0xE6, 0x59, 0xEE, 0x92, 0x6E, 0x5E, 0xEE, 0x15, 0xE6, 0x27, 0xEE,
+    0x97, 0xEE, 0xAC, 0x6A, 0xB4, 0xEA, 0x05, 0x66, 0x01, 0xE6, 0x00, 0x66, 0x0A, 0xE7, 0x70, 0x83,
+    0xE1, 0xF0, 0x00, 0x4E, 0x65, 0x86, 0xF2, 0x89, 0x94, 0xBF, 0x94, 0xB7, 0xEE, 0x11, 0x6E, 0x0E,
+    0x66, 0x66, 0x6E, 0x0B, 0x66, 0x0E, 0xEE, 0x16, 0xE6, 0x14, 0x67, 0x50, 0xFB, 0xC4, 0xFB, 0xA0,
+    0x46, 0x77, 0x8C, 0x2E, 0xC6, 0x4E, 0x12, 0xE6, 0x07, 0x76, 0xDD, 0xEE, 0x77, 0xEE, 0x03, 0x66,
+    0x49, 0xE8, 0x05, 0xE4, 0x02, 0xEE, 0x2C, 0xE6, 0x38, 0x6E, 0x01, 0xE6, 0x25, 0x66, 0x0D, 0x67,
+    0x28, 0xBD, 0x65, 0xA0, 0xA0, 0x7E, 0x60, 0xE6, 0xE0, 0x6E, 0x7C, 0x0C, 0x14, 0xC6, 0xB0, 0x24,
+    0xE6, 0x05, 0x66, 0x76, 0x6E, 0x3A, 0xEE, 0x00, 0xE6, 0x23, 0x66, 0x00, 0x6F, 0x18, 0x86, 0xFC,
+    0xE2, 0xB3, 0x0E, 0x8D, 0x5B, 0xFD, 0x08, 0xD1, 0x5A, 0x35, 0x43, 0x06, 0xE1, 0x3E, 0x75, 0x0C,
+    0x66, 0x9E, 0xA2, 0x24, 0xE6, 0xB9, 0x6E, 0x0F, 0x66, 0x68, 0xEE, 0x09, 0xE7, 0xE8, 0xA8, 0xCE,
+    0xBF, 0x61, 0xBE, 0x7B, 0x8D, 0xCE, 0x2B, 0xF2, 0x02, 0x66, 0x23, 0xE6, 0x11, 0xE6, 0x17, 0xE6,
+    0x07, 0xE6, 0x9A, 0xEE, 0x05, 0x67, 0x00, 0xAC, 0xE7, 0x61, 0x40, 0xAE, 0x61, 0xAE, 0x70, 0x0E,
+    0xD5, 0xC7, 0x11, 0x98, 0xF8, 0x40, 0x7A, 0xA0, 0x16, 0x61, 0x16, 0x61, 0x6E, 0x6C, 0xDE, 0x93,
+    0x9D, 0x7D, 0xCF, 0x61, 0x05, 0xCF, 0x41, 0x8B, 0x1D, 0xC5, 0x2C, 0xF1, 0x1A, 0x19, 0x1F, 0x4C,
+    0x46, 0xDC, 0x0F, 0xCC, 0x19, 0xCD, 0xD1, 0xD3, 0xA9, 0xF9, 0x89, 0x03, 0xD9, 0x80, 0x59, 0x86,
+    0x19, 0x83, 0x99, 0xC2, 0x22, 0x7E, 0x0C, 0xE5, 0x23, 0xAB, 0xAA, 0xA7, 0x03, 0x79, 0x83, 0xBB,
+    0xE8, 0x29, 0x7E, 0x49, 0xF5, 0xA2, 0x3B, 0x92, 0xA2, 0x84, 0x79, 0xDC, 0x36, 0x70, 0xD9, 0x10,
+    0x25, 0x98, 0xB9, 0xBA, 0x59, 0xB9, 0x01, 0x98, 0x0F, 0x9A, 0x5D, 0xBA, 0x8B, 0xB8, 0x79, 0x9E,
+    0xC2, 0xC9, 0x4A, 0xCA, 0x80, 0x59, 0x82, 0x59, 0x81, 0x39, 0xFC, 0x3A, 0xB0, 0x08, 0x68, 0x57,
+    0x98, 0x23, 0x98, 0x53, 0x99, 0xFB, 0xB8, 0x01, 0x98, 0x17, 0x98, 0x09, 0xA7, 0xDF, 0x7B, 0x83,
+    0x09, 0x73, 0xA4, 0x44, 0xF8, 0xF0, 0x40, 0x67, 0x30, 0xDB, 0x36, 0x4F, 0x72, 0xEB, 0x4C, 0xFD,
+    0x2F, 0xEC, 0xCD, 0xEE, 0x1F, 0xE6, 0x0E, 0xE7, 0xC0, 0xD7, 0x41, 0xE6, 0xC0, 0xAE, 0x77, 0x0B,
+    0xD6, 0x07, 0xA4, 0x11, 0x66, 0xE6, 0x6E, 0xE9, 0xEE, 0x9B, 0xEE, 0x06, 0x67, 0x80, 0x8B, 0x73,
+    0x7B, 0x43, 0x16, 0xFC, 0x88, 0x8F, 0xF3, 0x22, 0xD3, 0x6E, 0x80, 0xEE, 0x06, 0xE6, 0x10, 0xE6,
+    0x47, 0x67, 0xE8, 0xCA, 0xCE, 0x21, 0x20, 0x3E, 0x6D, 0x6E, 0xE0, 0x4E, 0x61, 0xFE, 0x60, 0x46,
+    0x7D, 0x8F, 0xD5, 0x7B, 0xC2, 0x55, 0x6E, 0x9E, 0xEE, 0x04, 0xE6, 0x15, 0xE7, 0xD0, 0xCA, 0x6A,
+    0xAE, 0xF4, 0x8A, 0x7C, 0x83, 0x06, 0x5A, 0x6F, 0x58, 0xA7, 0x72, 0x69, 0x20, 0x6E, 0x70, 0x89,
+    0xFE, 0xF6, 0x14, 0x0E, 0xE7, 0xD8, 0xF8, 0x73, 0x30, 0x42, 0xC6, 0x60, 0xB6, 0x60, 0x0E, 0x63,
+    0x3E, 0x61, 0x46, 0x77, 0x8C, 0x75, 0x7B, 0xD3, 0x30, 0xEA, 0x68, 0xE5, 0x40, 0x66, 0x61, 0xD6,
+    0x60, 0x06, 0x72, 0x09, 0xA4, 0xD6, 0xB1, 0x78, 0x92, 0x66, 0x25, 0x00, 0x5E, 0xFF, 0x8C, 0x6E,
+    0x7E, 0xE5, 0x68, 0xA0, 0xCE, 0x7C, 0xE0, 0x46, 0x7C, 0x0E, 0xDD, 0x42, 0xD4, 0x16, 0xE6, 0x03,
+    0x66, 0xA2, 0x6E, 0x11, 0xE7, 0x88, 0x96, 0x6F, 0x3B, 0xD6, 0x65, 0xFB, 0x60, 0x5B, 0x31, 0xE3,
+    0x32, 0xDB, 0x3F, 0x87, 0xC6, 0x8B, 0x74, 0x00, 0xB3, 0x15, 0x73, 0x02, 0x73, 0xDC, 0x6E, 0xF9,
+    0x56, 0xD0, 0x8F, 0x38, 0x07, 0xEF, 0xFD, 0x0B, 0x00, 0xF3, 0x14, 0xF3, 0x02, 0x73, 0x0C, 0x73,
+    0x45, 0x77, 0x00, 0xB3, 0x19, 0xB3, 0x1C, 0x37, 0x14, 0xB7, 0xFC, 0x5C, 0xA4, 0xBB, 0x40, 0x5B,
+    0x30, 0x17, 0x31, 0x07, 0x33, 0x23, 0x70, 0x73, 0x30, 0x87, 0x38, 0x47, 0xA7, 0x57, 0x45, 0x77,
+    0xB7, 0x5E, 0x74, 0x03, 0xB2, 0x05, 0xB3, 0x41, 0xF7, 0x66, 0xB7, 0x01, 0x33, 0x00, 0xF3, 0x13,
+    0x73, 0x00, 0x37, 0x54, 0xB7, 0x07, 0x73, 0x12, 0x37, 0x02, 0xF3, 0x17, 0x73, 0x04, 0xB3, 0x06,
+    0x73, 0x01, 0xB3, 0x2E, 0x34, 0x33, 0x7A, 0x01, 0x73, 0x42, 0xF7, 0xFC, 0x5D, 0x61, 0xF4, 0xE0,
+    0x4B, 0x30, 0x1B, 0x31, 0x9B, 0x36, 0x9F, 0x70, 0xE7, 0x31, 0x2F, 0x77, 0x17, 0x75, 0xF3, 0x4F,
+    0xBD, 0x0F, 0x3E, 0x0B, 0xEE, 0x00, 0xE6, 0x0B, 0xE7, 0xA0, 0xE6, 0xD4, 0xAE, 0x00, 0xF6, 0xE4,
+    0xDE, 0xE0, 0x6E, 0x64, 0xA6, 0x62, 0xEE, 0x62, 0x26, 0x80, 0x16, 0x45, 0xFE, 0xE7, 0xD6, 0xE2,
+    0xBE, 0x78, 0x0C, 0x04, 0xB2, 0x18, 0x06, 0xE6, 0x09, 0xE6, 0x75, 0x6E, 0x01, 0x66, 0x2B, 0x6E,
+    0x04, 0xE6, 0x03, 0xE6, 0x04, 0x6E, 0x64, 0xEF, 0xF0, 0x9C, 0xF2, 0xFF, 0x21, 0xE6, 0x61, 0x06,
+    0x63, 0xDE, 0x80, 0xBE, 0x42, 0xDE, 0x60, 0x7E, 0x70, 0x8C, 0xBF, 0x72, 0x6E, 0x06, 0xE6, 0xB6,
+    0xEF, 0xD0, 0x80, 0xC5, 0xEC, 0x20, 0x36, 0x60, 0x16, 0x60, 0xC6, 0x61, 0x06, 0x62, 0x0E, 0x6E,
+    0x5E, 0xFE, 0x8B, 0x84, 0xDB, 0x32, 0x01, 0xE7, 0xB0, 0x8C, 0x68, 0xA5, 0xEB, 0x56, 0x9E, 0x0E,
+    0xF5, 0x30, 0x05, 0xCC, 0x4D, 0xCD, 0x85, 0xD3, 0xB1, 0x32, 0xFA, 0xBD, 0x5B, 0x85, 0x99, 0x85,
+    0xF9, 0x86, 0x7B, 0x82, 0x7B, 0xA0, 0x5B, 0xB0, 0x7B, 0xAD, 0x5B, 0x89, 0xB9, 0x83, 0xD9, 0x80,
+    0x59, 0xA3, 0x7B, 0x86, 0xFB, 0x83, 0xF9, 0xDA, 0x3D, 0xBA, 0x01, 0xEB, 0x46, 0x3B, 0xB7, 0x37,
+    0x70, 0x37, 0x30, 0x0B, 0x3F, 0x45, 0x4B, 0x7F, 0xF2, 0x7D, 0xF7, 0x05, 0xF3, 0x00, 0xB3, 0x09,
+    0xF3, 0x45, 0x77, 0x54, 0xF7, 0x03, 0x33, 0x5B, 0xF7, 0x6E, 0xB7, 0x00, 0xF3, 0x17, 0x37, 0x94,
+    0x59, 0xBB, 0x5F, 0xC0, 0x77, 0x37, 0xC7, 0x7F, 0x87, 0x8A, 0xCF, 0x9A, 0x7C, 0x34, 0x79, 0xF3,
+    0xEB, 0x52, 0xE6, 0x20, 0x4E, 0x60, 0x9E, 0x60, 0xEE, 0x61, 0xAE, 0x63, 0xEE, 0x61, 0x8E, 0x60,
+    0x8E, 0xFC, 0x0E, 0x1D, 0x42, 0xDA, 0x04, 0x66, 0xCE, 0x6E, 0x72, 0x6F, 0x08, 0xF4, 0x78, 0xA9,
+    0xC4, 0x1E, 0xE0, 0x2E, 0x61, 0x36, 0x61, 0x6E, 0x60, 0x56, 0x62, 0xC6, 0xFC, 0x0E, 0x8F, 0x0E,
+    0xB0, 0x02, 0x66, 0x17, 0xE6, 0x0C, 0x6E, 0x89, 0x6E, 0x12, 0x66, 0x0C, 0x66, 0x05, 0x66, 0x1C,
+    0x6E, 0x24, 0xE6, 0x1A, 0x67, 0x80, 0xE8, 0xC8, 0x25, 0x30, 0x8E, 0x4C, 0x26, 0xA2, 0x03, 0xE6,
+    0x1A, 0xE6, 0x05, 0xE6, 0x58, 0xEE, 0x5E, 0x6E, 0x18, 0x66, 0x11, 0x6E, 0xFF, 0xEE, 0x11, 0x6E,
+    0x01, 0x6E, 0xDD, 0xEE, 0x01, 0xE6, 0x00, 0x67, 0x40, 0xAA, 0x40, 0xAD, 0x86, 0xBE, 0xE1, 0xC6,
+    0x60, 0xEE, 0x61, 0x1E, 0x60, 0xF6, 0x6F, 0x1E, 0xE3, 0x46, 0xE0, 0xCE, 0x61, 0xBE, 0x60, 0x36,
+    0x60, 0xD6, 0x60, 0x9E, 0x61, 0x3E, 0x7F, 0x8A, 0xCF, 0x17, 0x9A, 0x08, 0x66, 0x23, 0xEE, 0x01,
+    0x67, 0xD8, 0xF5, 0xC1, 0x63, 0x2F, 0xCE, 0xE2, 0x76, 0xFB, 0x8E, 0xFF, 0x46, 0x26, 0x11, 0x67,
+    0x58, 0xEC, 0x7C, 0x37, 0xE0, 0x46, 0x7A, 0x8D, 0x54, 0x44, 0x14, 0xD0, 0xF6, 0xDC, 0x18, 0xCC,
+    0x2D, 0xCC, 0x14, 0xCC, 0x45, 0xCC, 0x01, 0xCC, 0x03, 0xCD, 0xDA, 0xDC, 0x07, 0xCC, 0x11, 0xCC,
+    0xD1, 0xDC, 0x3F, 0xCC, 0x00, 0xCC, 0x02, 0xCE, 0x11, 0x19, 0xE2, 0xFB, 0x00, 0x2C, 0xE2, 0x10,
+    0x4E, 0x64, 0x94, 0x46, 0xCE, 0x21, 0xEC, 0xA5, 0xC3, 0x49, 0x9D, 0xC0, 0x3C, 0xC1, 0x0C, 0xDC,
+    0x9D, 0xC3, 0x1D, 0xDA, 0xCD, 0x07, 0xDD, 0x81, 0xBC, 0xC2, 0xBC, 0xC9, 0xCD, 0xC2, 0x4C, 0xD2,
+    0x6C, 0xC0, 0x3C, 0xC9, 0x1D, 0xC3, 0xDC, 0xD3, 0x2D, 0x00, 0x7C, 0x93, 0xAD, 0xC5, 0x2D, 0xF8,
+    0x1F, 0x08, 0x23, 0x95, 0xA1, 0x8D, 0xB8, 0x05, 0x98, 0x8F, 0x98, 0x0F, 0x9F, 0xC3, 0xE9, 0x17,
+    0xF0, 0x84, 0x59, 0x80, 0x19, 0x84, 0x39, 0x86, 0x39, 0xCE, 0x3F, 0x11, 0xFE, 0x33, 0x81, 0xB8,
+    0x03, 0x9F, 0x63, 0x7B, 0x94, 0xA2, 0x85, 0x1B, 0xB4, 0x1B, 0xCC, 0x36, 0x19, 0x48, 0x58, 0x53,
+    0x98, 0x61, 0x98, 0x25, 0x98, 0x8D, 0xB8, 0x9D, 0x98, 0xAB, 0x99, 0xE5, 0xBA, 0x69, 0xB8, 0x25,
+    0x98, 0x21, 0x98, 0x51, 0xB8, 0x61, 0x98, 0x0F, 0x9C, 0xE3, 0x4F, 0x5C, 0xAE, 0x81, 0x99, 0xF4,
+    0x24, 0x34, 0x0D, 0x60, 0x61, 0x99, 0xD1, 0xBE, 0x63, 0x87, 0x59, 0xFF, 0x80, 0x79, 0xE2, 0x25,
+    0x72, 0x49, 0xF8, 0x2B, 0x9A, 0xA7, 0xB8, 0x47, 0x98, 0x61, 0x9E, 0xE2, 0xA7, 0x37, 0xD7, 0xC6,
+    0x2A, 0x54, 0xEF, 0x6A, 0x35, 0xB9, 0xDF, 0xBD, 0x42, 0x7D, 0xEE, 0x19, 0xB4, 0x45, 0x73, 0xD0,
+    0x7F, 0xFE, 0x53, 0x90, 0x8B, 0x39, 0x07, 0x6A, 0x49, 0xF5, 0x88, 0x53, 0xEF, 0xBA, 0x20, 0x37,
+    0x30, 0xC3, 0x41, 0x63, 0x22, 0xA7, 0x70, 0x6F, 0x30, 0x3B, 0x37, 0xC7, 0x71, 0x87, 0xB3, 0x6B,
+    0x75, 0x8B, 0x77, 0x33, 0x70, 0x23, 0x30, 0xEF, 0x30, 0xD7, 0x33, 0xDF, 0x40, 0xCF, 0x20, 0x7B,
+    0x30, 0x9F, 0x35, 0x6B, 0x40, 0x0B, 0x65, 0x8B, 0x40, 0x0B, 0x2D, 0x07, 0x0B, 0x35, 0x14, 0x17,
+    0xB3, 0x46, 0xB7, 0x6D, 0xF7, 0x25, 0xF7, 0x02, 0x73, 0xF8, 0x72, 0x26, 0x36, 0x57, 0x9B, 0x70,
+    0x5F, 0x30, 0xFB, 0x30, 0x27, 0x31, 0xE7, 0x70, 0x2B, 0x30, 0x17, 0x70, 0x5B, 0x30, 0xE3, 0x30,
+    0x6B, 0x30, 0x9B, 0x34, 0xAF, 0x70, 0x8B, 0x31, 0xCB, 0x76, 0x0F, 0x73, 0xAB, 0x71, 0x23, 0x30,
+    0x5F, 0x33, 0x97, 0x74, 0x1F, 0x75, 0x53, 0x4E, 0x7D, 0x92, 0x7C, 0x15, 0x6F, 0xA8, 0x02, 0x72,
+    0x22, 0xB7, 0x02, 0xB3, 0x00, 0x73, 0x0F, 0xB3, 0x07, 0xB3, 0x28, 0x77, 0x1C, 0x78, 0x09, 0x32,
+    0x0D, 0x77, 0x0C, 0xF3, 0x15, 0xF3, 0x03, 0x33, 0x05, 0xB3, 0x00, 0xF3, 0x01, 0xB3, 0x06, 0x37,
+    0x4A, 0xF7, 0x09, 0xB3, 0x0B, 0x33, 0x09, 0xB7, 0x1F, 0xB3, 0x02, 0x73, 0xF8, 0x4F, 0xED, 0xD6,
+    0x1D, 0xC7, 0xEF, 0x3A, 0xFA, 0x68, 0xFE, 0xE8, 0xB2, 0x6C, 0x00, 0xE6, 0x0C, 0xE6, 0x92, 0x68,
+    0x09, 0x64, 0x6F, 0xEF, 0x30, 0xF5, 0x70, 0x24, 0x80, 0xC6, 0x60, 0x86, 0x77, 0x0A, 0x6E, 0xA6,
+    0x6E, 0x7B, 0x6E, 0xBC, 0xEE, 0x0E, 0x67, 0xE0, 0xF5, 0xEE, 0x24, 0x48, 0x06, 0x80, 0x6E, 0x48,
+    0x36, 0xE1, 0xB6, 0x70, 0x0A, 0x0C, 0xC6, 0x8F, 0x88, 0xD3, 0xCF, 0xF1, 0xA0, 0xCE, 0x62, 0x2E,
+    0x60, 0x6E, 0x65, 0x2E, 0xE1, 0xCE, 0x70, 0x89, 0x64, 0x3B, 0x78, 0x03, 0x66, 0x77, 0x69, 0xDF,
+    0x82, 0xC7, 0x43, 0x4C, 0xC1, 0x4D, 0xC0, 0x0C, 0xFA, 0x19, 0xCB, 0x98, 0x4B, 0xA0, 0xB7, 0x9C,
+    0xC3, 0x6B, 0x63, 0x9E, 0x87, 0x79, 0xE0, 0x3B, 0x79, 0x0C, 0x35, 0xC2, 0x77, 0xF2, 0x90, 0x8E,
+    0x79, 0x81, 0xD9, 0x9A, 0x7B, 0x80, 0xD9, 0x92, 0xFB, 0x82, 0x19, 0x81, 0xB9, 0x81, 0x19, 0x83,
+    0x39, 0x80, 0x1B, 0x87, 0x1A, 0x1F, 0x3B, 0x00, 0x59, 0x92, 0x3B, 0x8D, 0x1B, 0x80, 0x99, 0x9D,
+    0x9B, 0x86, 0x19, 0x80, 0x39, 0x81, 0x59, 0x80, 0xF9, 0x82, 0x59, 0x80, 0x39, 0x8A, 0x3B, 0x93,
+    0xFB, 0x85, 0x99, 0x80, 0x59, 0x89, 0x7B, 0x80, 0x19, 0xB2, 0xFA, 0x60, 0x3B, 0xD7, 0x67, 0x1B,
+    0x7D, 0x46, 0x72, 0xE5, 0xDC, 0x04, 0xB3, 0x02, 0x73, 0x33, 0xF7, 0x31, 0x37, 0x03, 0x73, 0x07,
+    0x37, 0x00, 0xB3, 0xDC, 0x72, 0x3E, 0x76, 0x51, 0x87, 0x30, 0x23, 0x31, 0xBF, 0x72, 0x77, 0x74,
+    0x97, 0x74, 0xBB, 0x70, 0xFB, 0x30, 0x37, 0x30, 0x9B, 0x32, 0xF3, 0x70, 0x1F, 0x30, 0x4F, 0x34,
+    0xAF, 0x70, 0x9F, 0x30, 0x23, 0x33, 0x1F, 0x43, 0x2F, 0x68, 0x85, 0x0A, 0x15, 0xA2, 0x03, 0xB3,
+    0x84, 0x73, 0x2E, 0xB5, 0x60, 0xD3, 0x3A, 0xC6, 0x6A, 0xC7, 0x53, 0x01, 0xF7, 0x0C, 0x37, 0x09,
+    0xB7, 0x00, 0x73, 0x12, 0x77, 0xA8, 0x6A, 0x72, 0x9E, 0x31, 0x6B, 0x30, 0xFF, 0x33, 0x2F, 0x38,
+    0x45, 0xD6, 0xC9, 0xC2, 0x08, 0xB3, 0x28, 0xF3, 0x12, 0xF3, 0x8C, 0x53, 0xBE, 0xFD, 0x10, 0xAB,
+    0x70, 0x33, 0x3A, 0xC7, 0xAB, 0x95, 0x1D, 0x8C, 0x62, 0x77, 0x15, 0x00, 0x2B, 0x30, 0x03, 0x30,
+    0x2B, 0x30, 0x6F, 0x30, 0x0B, 0x39, 0x87, 0xF2, 0xF9, 0x2C, 0x03, 0x33, 0x1D, 0xB3, 0x09, 0x34,
+    0xA2, 0xC5, 0xB7, 0x20, 0x96, 0xFC, 0x89, 0x9C, 0x8E, 0xD2, 0x2C, 0xEE, 0x1E, 0x66, 0x04, 0x66,
+    0x0A, 0x66, 0x1B, 0x66, 0x3B, 0xE6, 0x36, 0x6E, 0x1B, 0xE6, 0x47, 0xEE, 0x09, 0x66, 0x02, 0xE6,
+    0xE0, 0x6E, 0x50, 0x6E, 0xA5, 0x6F, 0x28, 0xA1, 0xDA, 0xFE, 0xE0, 0x56, 0x60, 0x96, 0x65, 0xEE,
+    0xF5, 0x0D, 0xCF, 0xC8, 0xF2, 0xD0, 0x0A, 0xCE, 0x51, 0xA0, 0x85, 0x7C, 0x40, 0x5C, 0xC5, 0xCC,
+    0xFB, 0x14, 0xE8, 0x4F, 0xEC, 0x24, 0xCC, 0x02, 0xCC, 0x14, 0xCC, 0xAE, 0xCC, 0x06, 0xCC, 0x11,
+    0xCD, 0x4E, 0xDC, 0x55, 0xCD, 0x96, 0xDC, 0x73, 0xDC, 0x35, 0xCC, 0x4E, 0xCD, 0x94, 0xDC, 0x64,
+    0xDC, 0xE4, 0xDC, 0x41, 0xDC, 0x25, 0xDC, 0x73, 0xDC, 0x18, 0xCC, 0x17, 0xCC, 0x88, 0xDC, 0x3D,
+    0xCD, 0x64, 0xD0, 0x0E, 0xC8, 0x3D, 0xCC, 0x44, 0xCC, 0xCC, 0xDC, 0x08, 0xCD, 0x97, 0xDC, 0x4B,
+    0xCC, 0x40, 0xDF, 0xB1, 0xB8, 0xAB, 0xD6, 0xC8, 0x1C, 0xC2, 0x8C, 0xD8, 0xFD, 0xCA, 0x4D, 0xC1,
+    0x4C, 0xD1, 0xDD, 0xFF, 0x12, 0x68, 0x57, 0x64, 0xBB, 0xDC, 0x31, 0xCC, 0x0A, 0xCF, 0x91, 0x32,
+    0xAB, 0x55, 0x41, 0x0C, 0xC2, 0x6C, 0xC0, 0x6C, 0xC3, 0x5C, 0xD7, 0xAD, 0xC0, 0x1C, 0xC2, 0x9C,
+    0xD7, 0x4D, 0xC0, 0x6C, 0xC9, 0x6D, 0xC3, 0x3D, 0xC1, 0xCC, 0xC3, 0x7C, 0xC2, 0x7D, 0xC1, 0x5C,
+    0xC5, 0x5C, 0xCC, 0xBD, 0xC0, 0x3C, 0xD6, 0x1D, 0xC0, 0xDC, 0xD2, 0x9D, 0xC1, 0x6C, 0xC2, 0x5C,
+    0xC5, 0x9C, 0xF6, 0x1E, 0x8D, 0x0B, 0xE7, 0xA0, 0x2D, 0x9E, 0x03, 0x03, 0x8A, 0xCF, 0x01, 0x19,
+    0x80, 0xD9, 0x82, 0xF9, 0xDA, 0x20, 0xF5, 0x29, 0xA2, 0x8B, 0xD8, 0x11, 0x98, 0x2F, 0x98, 0x09,
+    0x98, 0x1D, 0x98, 0x05, 0x98, 0x33, 0x98, 0xC3, 0xBB, 0x27, 0xBE, 0x03, 0xBB, 0x19, 0xBB, 0x0D,
+    0x1B, 0xC6, 0x3C, 0x32, 0x0A, 0xD8, 0xA5, 0xB8, 0x51, 0x98, 0x05, 0x98, 0x79, 0x9B, 0x1F, 0xB8,
+    0x01, 0x9E, 0x02, 0x17, 0x5C, 0xCB, 0xA9, 0x5B, 0xBB, 0x9B, 0xCE, 0x32, 0x59, 0x3E, 0x20, 0x63,
+    0xBA, 0xF7, 0xB8, 0x5B, 0x98, 0x1B, 0x98, 0x05, 0x98, 0x45, 0x98, 0x07, 0x9E, 0x23, 0x2B, 0xA3,
+    0x9D, 0x14, 0xD9, 0x81, 0xB9, 0xA9, 0x5A, 0x69, 0x22, 0x33, 0x81, 0x33, 0x77, 0x93, 0x70, 0x0B,
+    0x30, 0x13, 0x3F, 0x44, 0xA7, 0xF1, 0x60, 0x09, 0xF3, 0x0E, 0x33, 0x02, 0xB3, 0x54, 0xB7, 0x00,
+    0xB3, 0xA4, 0x43, 0x61, 0xB6, 0xE5, 0x07, 0x70, 0xEF, 0x31, 0x5F, 0x70, 0x37, 0x38, 0x47, 0xB7,
+    0x47, 0x23, 0x06, 0xB3, 0x02, 0x73, 0xB4, 0x6D, 0xE5, 0xDA, 0xC1, 0xEF, 0x30, 0x17, 0x30, 0x0F,
+    0x34, 0x07, 0x72, 0x0F, 0x70, 0x8B, 0x32, 0x77, 0x70, 0x4F, 0x31, 0x1B, 0x3A, 0x90, 0xA5, 0x98,
+    0x05, 0x90, 0x01, 0x98, 0x23, 0xB8, 0x9D, 0x98, 0xA1, 0x99, 0xCF, 0xB8, 0xAF, 0x98, 0x6B, 0x98,
+    0x27, 0x98, 0xFD, 0xB9, 0x37, 0xB8, 0x2B, 0x98, 0x31, 0x98, 0x4D, 0x98, 0x7B, 0x98, 0x87, 0xB9,
+    0x57, 0xB8, 0x05, 0x98, 0x71, 0x98, 0x1B, 0x98, 0x1F, 0x98, 0x1D, 0x98, 0x15, 0x98, 0x19, 0x9D,
+    0xE3, 0xB7, 0x46, 0xCE, 0x23, 0xFB, 0xCE, 0x29, 0xD1, 0xFF, 0x00, 0x1D, 0x9B, 0xA5, 0xB8, 0x17,
+    0x9F, 0xE2, 0xFD, 0x0B, 0xFB, 0x81, 0xF9, 0x8B, 0xFB, 0x90, 0x59, 0x80, 0x79, 0x8C, 0xFB, 0x85,
+    0x99, 0x86, 0x99, 0xB9, 0x9B, 0xA8, 0x3A, 0x28, 0x5B, 0x05, 0xD9, 0x8B, 0x5B, 0x82, 0x59, 0x83,
+    0x79, 0x81, 0x59, 0x80, 0xD9, 0x90, 0xDB, 0xA0, 0xDB, 0x86, 0x19, 0x82, 0x19, 0x8A, 0x9B, 0xB1,
+    0x3B, 0xA0, 0xBB, 0x98, 0x3A, 0x64, 0x86, 0xBD, 0x5B, 0xAD, 0xD7, 0x8D, 0xC2, 0x2C, 0xD8, 0xDD,
+    0xC0, 0xED, 0xC4, 0xEC, 0xDD, 0xAD, 0xC1, 0x0C, 0xC0, 0x2C, 0xC3, 0xDC, 0xF8, 0x16, 0x8A, 0xAD,
+    0x75, 0x51, 0xDD, 0xB3, 0xDC, 0x08, 0xEF, 0x41, 0x2C, 0xB7, 0x9F, 0xFA, 0x6A, 0x35, 0xDD, 0x08,
+    0x0A, 0xF7, 0xB8, 0x33, 0x99, 0xD9, 0xBE, 0x43, 0xC5, 0x13, 0xD8, 0x6C, 0x22, 0x57, 0x1A, 0x20,
+    0x19, 0x98, 0x4F, 0x98, 0x39, 0x98, 0x11, 0x98, 0xED, 0xBA, 0x2D, 0xA6, 0x0B, 0x6E, 0xCA, 0xE9,
+    0x38, 0x8A, 0x6A, 0x63, 0x29, 0xB6, 0xF5, 0x0D, 0xB5, 0xFB, 0x1A, 0x22, 0x6E, 0x13, 0x6F, 0xE0,
+    0xCF, 0xD5, 0x6B, 0x80, 0x0E, 0x60, 0x26, 0x63, 0x4E, 0x60, 0x0E, 0x67, 0x7E, 0xEE, 0x56, 0xFF,
+    0x0C, 0x6F, 0x5E, 0x86, 0x00, 0xE6, 0x27, 0xE6, 0x08, 0xE6, 0xE0, 0x6F, 0x78, 0xA8, 0xEE, 0x7E,
+    0x03, 0x86, 0xE0, 0xAE, 0x77, 0x89, 0xDD, 0x4E, 0xC2, 0x4A, 0xEE, 0x03, 0xE6, 0x55, 0x6E, 0x03,
+    0xE6, 0x4F, 0xEE, 0x49, 0x6E, 0x27, 0x66, 0x08, 0xE6, 0x34, 0xE7, 0x00, 0xD7, 0x66, 0xFE, 0x31,
+    0x5F, 0x56, 0xA2, 0x6A, 0x22, 0x6E, 0x06, 0xE6, 0x02, 0xE6, 0x04, 0x76, 0x3A, 0xE6, 0xE0, 0xEE,
+    0xCC, 0x6E, 0x05, 0xE6, 0x54, 0x6E, 0x3B, 0xE6, 0xA6, 0xEE, 0x02, 0x6E, 0xDE, 0x68, 0x0D, 0x64,
+    0x09, 0xE6, 0x3A, 0xE6, 0xAC, 0xEE, 0x36, 0xEE, 0x56, 0xEE, 0x00, 0x66, 0x38, 0x66, 0x08, 0x66,
+    0x55, 0x6E, 0x0F, 0x6E, 0x04, 0x66, 0x2A, 0x66, 0x02, 0xE6, 0xB1, 0xEE, 0x08, 0xE6, 0x0D, 0x66,
+    0x0C, 0x66, 0x01, 0x6E, 0x16, 0x68, 0x1A, 0xED, 0x40, 0xE6, 0x68, 0xFC, 0x20, 0xCE, 0x60, 0x9E,
+    0x60, 0x76, 0x62, 0xBE, 0x6C, 0xCE, 0x9D, 0xAD, 0xE7, 0x51, 0x1C, 0xDC, 0x34, 0xDD, 0x79, 0xDC,
+    0x2C, 0xCC, 0x48, 0xCC, 0x17, 0xCC, 0x35, 0xCC, 0x7B, 0xDC, 0x22, 0xCC, 0x78, 0xDC, 0x04, 0xCD,
+    0xF6, 0xDC, 0x17, 0xCC, 0x63, 0xCC, 0x15, 0xCD, 0xE2, 0xDC, 0xE7, 0xDC, 0x3A, 0xCD, 0x54, 0xDC,
+    0x83, 0xDC, 0xC7, 0xDC, 0x04, 0xCC, 0x32, 0xCE, 0x11, 0x2F, 0x8B, 0xDC, 0xCB, 0xCD, 0xD3, 0xAD,
+    0xC0, 0x9C, 0xC2, 0x3C, 0xCC, 0x9D, 0xC2, 0x1C, 0xEB, 0x18, 0x9A, 0x2C, 0xCC, 0x07, 0xCC, 0x06,
+    0xCC, 0xAF, 0xDD, 0x78, 0xDC, 0x3F, 0xCC, 0x1C, 0xCC, 0x1F, 0xCC, 0x2F, 0xCC, 0x6C, 0xDC, 0x29,
+    0xCC, 0x52, 0xDC, 0x59, 0xDC, 0x2B, 0xCC, 0x10, 0xCC, 0x14, 0xCE, 0x91, 0x5A, 0x9D, 0xE6, 0x4C,
+    0x9D, 0xC8, 0x7D, 0xC3, 0xDC, 0xC0, 0x3C, 0xC0, 0xCC, 0xC1, 0x8D, 0xF3, 0x16, 0x5E, 0xDF, 0x1C,
+    0x2E, 0xDD, 0x01, 0xD0, 0x2E, 0xC8, 0x01, 0xCC, 0x08, 0xCC, 0x41, 0xCD, 0x41, 0xDC, 0x07, 0xCC,
+    0x10, 0xCF, 0xA1, 0x7B, 0x9A, 0xE5, 0x41, 0xDC, 0xC2, 0x4C, 0xF9, 0x1E, 0x28, 0x6E, 0x25, 0xF7,
+    0xDC, 0x26, 0xCF, 0x61, 0x12, 0x84, 0x28, 0x7A, 0x2C, 0x9B, 0x84, 0xB9, 0x96, 0x9B, 0x87, 0xBB,
+    0x81, 0xD9, 0x89, 0xBB, 0xEC, 0x21, 0x97, 0xF9, 0x21, 0x1F, 0xB8, 0x35, 0x9F, 0x02, 0x81, 0x18,
+    0xDE, 0x70, 0x28, 0x50, 0x39, 0xA0, 0x3D, 0x98, 0x2B, 0x9C, 0x82, 0x45, 0xF9, 0xBF, 0xA7, 0x7B,
+    0x81, 0xD9, 0x91, 0x59, 0xB8, 0xDB, 0x8B, 0x9B, 0x98, 0x5B, 0x82, 0x39, 0x80, 0x79, 0x96, 0x5B,
+    0xDA, 0x3C, 0x5E, 0x6F, 0xC0, 0xA3, 0xD8, 0x03, 0x99, 0x41, 0xAE, 0xC2, 0x53, 0xC0, 0xBA, 0x74,
+    0x3B, 0x6B, 0x4E, 0xE6, 0x8E, 0xE0, 0xDE, 0x61, 0x06, 0x72, 0x8D, 0x6C, 0x5B, 0x44, 0x02, 0x66,
+    0x19, 0xE6, 0x0A, 0xE9, 0xDE, 0xDB, 0xC1, 0x41, 0x4C, 0xD8, 0xFD, 0xC0, 0xAC, 0xD9, 0x9D, 0xC0,
+    0xCC, 0xC1, 0x5C, 0xC0, 0x1C, 0xC2, 0x5C, 0xC0, 0x6D, 0xFC, 0x18, 0xEF, 0xCE, 0xDD, 0x65, 0xDC,
+    0x46, 0xCC, 0x21, 0xCC, 0x66, 0xCD, 0x4D, 0xDC, 0x16, 0xCC, 0x9F, 0xDD, 0xA7, 0xDE, 0xD1, 0xB5,
+    0xD6, 0xD1, 0x2D, 0x14, 0x18, 0xCE, 0xC8, 0x0D, 0xCC, 0x08, 0xCC, 0x69, 0xDC, 0x3F, 0xCC, 0x35,
+    0xCF, 0x31, 0xCF, 0xA1, 0x5A, 0xF8, 0x10, 0xEC, 0x5D, 0x91, 0xBA, 0xD0, 0x2E, 0xCA, 0x21, 0x8A,
+    0xDC, 0xE2, 0x40, 0x7C, 0xC2, 0x8C, 0xC2, 0x7C, 0xC5, 0x5D, 0xC8, 0xBC, 0xC0, 0x0C, 0xC4, 0xBD,
+    0xDF, 0x1D, 0xF1, 0x15, 0x9C, 0x55, 0xC9, 0x24, 0xDC, 0x2B, 0xCC, 0x0B, 0xCC, 0xC1, 0xDC, 0x28,
+    0xCC, 0x6B, 0xDC, 0x1E, 0xCB, 0x84, 0x1B, 0xEE, 0x14, 0xE6, 0xDB, 0x6E, 0x12, 0x66, 0x20, 0x67,
+    0xC0, 0xCB, 0x4D, 0xB6, 0x40, 0x76, 0x60, 0x16, 0x6A, 0x7E, 0x9E, 0x58, 0xAE, 0x83, 0xF1, 0x94,
+    0xDE, 0xE2, 0x12, 0xDD, 0xC2, 0x0C, 0xC0, 0x0C, 0xC0, 0x8C, 0xC4, 0x6D, 0xFA, 0x1F, 0x3F, 0xED,
+    0xE0, 0x91, 0xDC, 0x18, 0xCC, 0x1B, 0xCC, 0xC4, 0xDC, 0x16, 0xCC, 0x03, 0xCD, 0x9C, 0xDD, 0x7A,
+    0xDC, 0xB5, 0xDD, 0x63, 0xDD, 0x78, 0xDC, 0x01, 0xCC, 0x0C, 0xCC, 0x49, 0xCC, 0x45, 0xCE, 0x91,
+    0x0A, 0xD2, 0xC9, 0xC4, 0x8C, 0xC0, 0x6C, 0xD9, 0x6D, 0xC0, 0x5C, 0xC5, 0xAC, 0xCB, 0x5D, 0xF1,
+    0x13, 0x6D, 0x5D, 0xF4, 0x3E, 0xCC, 0x0C, 0xCC, 0x15, 0xCD, 0xEC, 0xDC, 0x15, 0xCC, 0xE0, 0xDD,
+    0x84, 0xD0, 0x0B, 0xC8, 0x2D, 0xCD, 0x30, 0xDC, 0x0E, 0xCE, 0x31, 0xB5, 0xEE, 0xC7, 0x86, 0xDD,
+    0x0A, 0x8C, 0x86, 0x6D, 0xF6, 0x1B, 0x18, 0xFC, 0x98, 0x60, 0xCD, 0x36, 0xDC, 0x0E, 0xCC, 0x13,
+    0xCC, 0x07, 0xCC, 0x12, 0xCC, 0x26, 0xDC, 0x34, 0xCC, 0x1F, 0xD0, 0xB8, 0xD8, 0x02, 0xCE, 0x41,
+    0x85, 0xDB, 0xE1, 0x1E, 0x7D, 0xD1, 0x4D, 0xDC, 0xAD, 0xC2, 0x2C, 0xC8, 0x3D, 0xC0, 0x2C, 0xDD,
+    0xAD, 0xC7, 0x5D, 0xC2, 0xEC, 0xC1, 0x7C, 0xD1, 0x8D, 0xC1, 0xEC, 0xC1, 0x2C, 0xC1, 0x1C, 0xF1,
+    0x13, 0x1D, 0x8F, 0x2B, 0x91, 0xBE, 0xC4, 0x5F, 0x2C, 0x1E, 0x7B, 0x04, 0x04, 0x08, 0xCF, 0x71,
+    0x81, 0x8B, 0xD8, 0x35, 0x1F, 0xC9, 0xCE, 0x50, 0x11, 0xCC, 0x08, 0xCC, 0x10, 0xDC, 0xCA, 0xDC,
+    0x10, 0xCC, 0x2F, 0xCC, 0x00, 0xCD, 0x3A, 0xEC, 0x25, 0xCC, 0x06, 0xCD, 0xF0, 0xDC, 0x0D, 0xCC,
+    0x05, 0xCD, 0x3C, 0xDC, 0x16, 0xCC, 0x11, 0xCC, 0x0D, 0xCC, 0x12, 0xCC, 0x0E, 0xCC, 0x05, 0xCC,
+    0x82, 0xCE, 0xC9, 0x5F, 0xFC, 0x7C, 0xE8, 0x14, 0xB9, 0xAF, 0xE9, 0x2E, 0xEC, 0x4B, 0xCC, 0x34,
+    0xCD, 0x02, 0xD2, 0x95, 0x82, 0x84, 0x82, 0x99, 0x82, 0x59, 0x9B, 0xDB, 0x9E, 0xDB, 0x91, 0x9B,
+    0x86, 0xB9, 0x8A, 0x59, 0x80, 0x39, 0x92, 0x5B, 0xB3, 0xDB, 0x80, 0x59, 0x91, 0x5B, 0xA0, 0x3B,
+    0x93, 0x99, 0xA8, 0xFB, 0xB6, 0xDB, 0x88, 0xDB, 0x80, 0x19, 0x9C, 0x1B, 0xE8, 0x39, 0x1C, 0x1E,
+    0xC8, 0x0B, 0x99, 0x8D, 0xBC, 0x82, 0x8B, 0xB6, 0xF7, 0x81, 0xF9, 0x80, 0x59, 0x8B, 0xBB, 0x80,
+    0xF9, 0x82, 0xB9, 0x82, 0x39, 0xF6, 0x2C, 0xF4, 0x2D, 0xC8, 0x61, 0x98, 0x71, 0xB8, 0x59, 0x9F,
+    0xA3, 0xAB, 0x8C, 0xE0, 0x7C, 0x3C, 0xD0, 0xE8, 0xE6, 0x62, 0xAB, 0xC0, 0xED, 0x08, 0xDB, 0x8C,
+    0x5A, 0x07, 0x19, 0x72, 0x25, 0x1A, 0x5E, 0xE8, 0x5B, 0x98, 0xFB, 0x9A, 0xC3, 0xB9, 0x4B, 0xB8,
+    0x31, 0x9C, 0x03, 0x27, 0x05, 0xCF, 0xA0, 0x9B, 0xFA, 0x3C, 0xDA, 0xCF, 0xAD, 0x43, 0x31, 0x4B,
+    0xA3, 0xDC, 0x39, 0x97, 0x1D, 0xE0, 0x51, 0x9A, 0xCD, 0xB8, 0x53, 0x99, 0xBB, 0x98, 0x01, 0x9D,
+    0xC2, 0x03, 0x0F, 0x83, 0xF8, 0x25, 0xD0, 0xF8, 0x18, 0x51, 0x98, 0xB5, 0x98, 0xC1, 0xB8, 0x4D,
+    0x9E, 0x43, 0x4F, 0x0F, 0x9C, 0x8C, 0x5B, 0x80, 0x99, 0x86, 0x3B, 0x80, 0x19, 0xDA, 0x2E, 0x33,
+    0x5A, 0xB0, 0x5B, 0x99, 0xDB, 0xB8, 0xB3, 0xBC, 0x43, 0x23, 0x5C, 0x9F, 0x00, 0x59, 0xCC, 0x32,
+    0xF0, 0x98, 0xC0, 0x97, 0xB9, 0x27, 0x9A, 0xF3, 0xB8, 0x7D, 0x98, 0x27, 0x98, 0xB3, 0xBA, 0xF9,
+    0xB8, 0xDB, 0x98, 0x01, 0x98, 0xA5, 0xB8, 0xB7, 0x98, 0x6F, 0x98, 0x49, 0x9A, 0x67, 0xB8, 0x75,
+    0x98, 0x01, 0x98, 0x39, 0x98, 0x09, 0x9C, 0xC3, 0x83, 0x8B, 0xDA, 0x81, 0xF9, 0xF4, 0x28, 0x34,
+    0xAB, 0xAD, 0xA3, 0x65, 0x7B, 0xC9, 0x82, 0x79, 0x83, 0x39, 0x89, 0x5B, 0x82, 0x5B, 0x8A, 0xB9,
+    0xFA, 0x22, 0x16, 0xDE, 0xF7, 0x43, 0xE9, 0x75, 0xF9, 0x00, 0x79, 0xB3, 0xFB, 0x9F, 0xBB, 0xA4,
+    0x7B, 0x53, 0x80, 0x5C, 0xF6, 0x10, 0x98, 0x65, 0xEC, 0x10, 0xCC, 0xF5, 0xDC, 0x12, 0xDC, 0xB4,
+    0xDC, 0x18, 0xCC, 0x0B, 0xDE, 0xA1, 0xE4, 0xB9, 0xC6, 0x0F, 0x2D, 0xE7, 0x17, 0x2D, 0x2C, 0x89,
+    0xB3, 0xDE, 0xC1, 0xBC, 0x96, 0xFB, 0x66, 0x1B, 0x7C, 0x9C, 0x38, 0x18, 0xCC, 0x07, 0xDC, 0x86,
+    0xD0, 0x02, 0xC8, 0x50, 0xDD, 0x26, 0xDC, 0x64, 0xCC, 0x02, 0xCC, 0x16, 0xCC, 0x65, 0xDC, 0x0B,
+    0xCE, 0x33, 0x3E, 0x9D, 0x6D, 0x63, 0xF3, 0x7E, 0x86, 0xFE, 0x73, 0xB8, 0xF7, 0x6D, 0x3A, 0x73,
+    0xCD, 0xC5, 0x7F, 0x15, 0xDE, 0xBE, 0xCF, 0xF7, 0xFD, 0xEE, 0xC6, 0x8A, 0x39, 0x49, 0xF5, 0x63,
+    0xBC, 0x37, 0x4D, 0x36, 0x6A, 0xD7, 0x41, 0xE3, 0xDE, 0xAF, 0xD7, 0xED, 0x77, 0x7F, 0x3B, 0x73,
+    0x94, 0xED, 0x2E, 0xD6, 0x59, 0xEE, 0x9B, 0xB7, 0x74, 0xE7, 0x7F, 0x6F, 0xB4, 0x48, 0x7D, 0xA2,
+    0xEF, 0xE5, 0x94, 0xEE, 0x32, 0x99, 0x89, 0x77, 0x02, 0xA7, 0xCF, 0xF1, 0x7B, 0x36, 0x1A, 0xB9,
+    0x66, 0xF7, 0x97, 0xB7, 0xE3, 0xF0, 0x30, 0xF2, 0xBB, 0xB4, 0x06, 0x0B, 0x9F, 0xFD, 0xF8, 0x30,
+    0x9A, 0x4C, 0x37, 0x62, 0x37, 0x6C, 0xF8, 0xDA, 0x63, 0x90, 0x98, 0x7F, 0xE2, 0x37, 0x0C, 0xF6,
+    0xF7, 0x79, 0x5A, 0x1D, 0xED, 0x0B, 0x3B, 0x0C, 0xEF, 0x6F, 0xF5, 0x33, 0x5F, 0x05, 0x56, 0x9F,
+    0xB3, 0xEB, 0xDE, 0x30, 0x76, 0x5D, 0xDE, 0x3E, 0x2D, 0xBB, 0x98, 0x46, 0xE9, 0xBE, 0x18, 0xEF,
+    0x07, 0xCB, 0x78, 0xCC, 0xF6, 0x2E, 0x5A, 0xCD, 0x74, 0xB7, 0x8D, 0x8D, 0x97, 0xE4, 0x72, 0x17,
+    0x8A, 0xED, 0xD2, 0xE9, 0x19, 0xE1, 0x7D, 0x2E, 0xF2, 0xE9, 0x8F, 0xB2, 0x57, 0x03, 0x8B, 0x41,
+    0xBF, 0x51, 0x0C, 0x2E, 0x8B, 0x33, 0x24, 0xE9, 0xEC, 0x79, 0x10, 0x0E, 0x3F, 0xF3, 0x4D, 0x83,
+    0xA6, 0x6F, 0xBC, 0xD0, 0x8A, 0x8F, 0xCF, 0xDF, 0xB5, 0x88, 0x6B, 0xE1, 0xB8, 0x6C, 0x56, 0x4E,
+    0x5D, 0x65, 0xF4, 0xE1, 0xA5, 0x7D, 0x6A, 0x4E, 0xD7, 0xFD, 0x36, 0xD6, 0x73, 0x7C, 0xFF, 0x6F,
+    0x74, 0x63, 0x59, 0x06, 0xE0, 0x5D, 0x7F, 0xB1, 0x89, 0x76, 0x2B, 0x75, 0x1A, 0xAD, 0x4C, 0x3F,
+    0x3F, 0xF8, 0x15, 0x07, 0xE3, 0xB6, 0xA2, 0x5A, 0xBB, 0x12, 0x38, 0x9F, 0xAB, 0x89, 0xB0, 0xD0,
+    0x70, 0xB5, 0xD2, 0x4D, 0xBF, 0xDB, 0x71, 0xA0, 0xB2, 0xE8, 0xBB, 0x1B, 0x5C, 0x8C, 0x33, 0x5F,
+    0x6E, 0xDE, 0x4F, 0x70, 0x3D, 0x6C, 0x9C, 0xCA, 0x33, 0x89, 0x84, 0x7B, 0xAE, 0x5C, 0xCB, 0x56,
+    0x4F, 0xED, 0xC5, 0xD8, 0x61, 0xE3, 0x19, 0x2B, 0x86, 0xB6, 0x6F, 0x09, 0xE7, 0x5F, 0x6A, 0x5F,
+    0xD8, 0x5D, 0xE6, 0x69, 0xFC, 0xD4, 0x74, 0xE0, 0x7E, 0x0E, 0xC4, 0xD6, 0xFD, 0x27, 0xF3, 0xC7,
+    0x74, 0x90, 0x6D, 0xD5, 0xC3, 0x33, 0xAB, 0xF7, 0xFE, 0x20, 0x96, 0x79, 0x75, 0x6E, 0xA5, 0x71,
+    0x82, 0xEC, 0xE3, 0xD5, 0x8E, 0x55, 0xEB, 0xBD, 0x9D, 0x8B, 0xD4, 0x38, 0x9E, 0x8D, 0x0D, 0xA3,
+    0x37, 0x8B, 0xF0, 0x7B, 0xA6, 0x39, 0x9E, 0xEC, 0x5F, 0x01, 0x9B, 0xFC, 0x58, 0xE5, 0xFB, 0x38,
+    0x86, 0xEF, 0xC3, 0x94, 0x8B, 0xD8, 0xF4, 0xF5, 0xFA, 0xCF, 0x8B, 0x45, 0x95, 0x96, 0xD7, 0xE9,
+    0x75, 0xED, 0x0D, 0xD2, 0xDD, 0xEB, 0xAB, 0x4E, 0x3B, 0xB8, 0xF8, 0xB5, 0x36, 0x9B, 0xB1, 0xE9,
+    0x51, 0xA3, 0x79, 0xBE, 0xFE, 0x3E, 0x5F, 0x6B, 0xAF, 0x51, 0x32, 0x53, 0x18, 0x8C, 0xE2, 0x2D,
+    0x7C, 0x88, 0xFD, 0x71, 0x36, 0x7B, 0x04, 0xFA, 0x97, 0x7C, 0xEB, 0xCE, 0xFF, 0x99, 0x2C, 0xBF,
+    0x7B, 0x4D, 0x24, 0xCB, 0x4A, 0x73, 0xD0, 0xCB, 0xF6, 0x23, 0xC5, 0x22, 0xCB, 0x66, 0xEA, 0x33,
+    0xE9, 0x5E, 0xCA, 0x95, 0xBE, 0xD7, 0x50, 0x69, 0x3D, 0xCC, 0xAF, 0x92, 0x9D, 0x17, 0xFA, 0xE2,
+    0x67, 0x1C, 0xCA, 0x3D, 0xDF, 0x4F, 0x2D, 0xDF, 0x78, 0x25, 0xB6, 0x9E, 0x4E, 0xA3, 0x33, 0x5B,
+    0xC4, 0xFB, 0x65, 0x35, 0xFE, 0x8D, 0x4B, 0x9F, 0xAC, 0x93, 0x50, 0x7C, 0x9F, 0x5C, 0x86, 0x82,
+    0x19, 0x2C, 0xB4, 0x58, 0x66, 0x9E, 0x7F, 0x17, 0xA6, 0xD9, 0x77, 0xE4, 0xCD, 0x6F, 0x38, 0x89,
+    0x55, 0x02, 0x45, 0xBB, 0xCF, 0x55, 0x60, 0x90, 0x2A, 0x44, 0xC2, 0x05, 0xC6, 0xFF, 0x57, 0xBD,
+    0x95, 0x7D, 0x77, 0x7F, 0x0B, 0xEB, 0xC1, 0xCD, 0xA0, 0x1E, 0xBC, 0x4E, 0x06, 0xB1, 0x2E, 0xF7,
+    0x7F, 0x61, 0xBB, 0xBD, 0x0D, 0x8A, 0xD1, 0xF8, 0xBC, 0xEB, 0x31, 0xB5, 0x4B, 0xA7, 0xA3, 0x89,
+    0x47, 0xD9, 0xDA, 0x2F, 0xF3, 0x2D, 0xF6, 0xFA, 0x2B, 0xF6, 0xAF, 0xC5, 0x79, 0x73, 0xAC, 0x7D,
+    0x56, 0x99, 0x31, 0xC6, 0x49, 0x25, 0x5C, 0x8C, 0xF4, 0x72, 0x2D, 0x3C, 0x84, 0x56, 0xBB, 0x77,
+    0x7E, 0x26, 0x16, 0x5B, 0x6B, 0xC5, 0x67, 0xBA, 0x50, 0x6D, 0x34, 0xF7, 0xD7, 0x1F, 0xD5, 0x7E,
+    0xB5, 0xB8, 0xCE, 0x16, 0xE2, 0x09, 0xEB, 0xAB, 0xE1, 0xA5, 0x1D, 0xFC, 0x6F, 0xBE, 0x99, 0x56,
+    0xF7, 0x42, 0x63, 0xDD, 0xAC, 0x64, 0xC2, 0x47, 0xEB, 0xB3, 0xD2, 0x70, 0x50, 0x6A, 0xB4, 0x13,
+    0xAB, 0xFC, 0xA1, 0xF6, 0xAD, 0x98, 0x38, 0xBC, 0x66, 0x45, 0x05, 0xA2, 0xD0, 0x69, 0xFA, 0x9C,
+    0x9E, 0x6B, 0xE7, 0xB1, 0xCB, 0x47, 0x29, 0x91, 0xFE, 0xFC, 0x6E, 0xC1, 0xE6, 0xF0, 0xE1, 0x74,
+    0x91, 0x8C, 0xBC, 0x6F, 0x4D, 0xCF, 0xF4, 0xD0, 0x2A, 0xFA, 0x2B, 0x47, 0x17, 0xF5, 0x3D, 0xCC,
+    0xCB, 0x6B, 0xF4, 0x7D, 0x1F, 0xF7, 0xAB, 0xC2, 0x81, 0x76, 0xBA, 0x9E, 0x99, 0x1D, 0x0E, 0x09,
+    0x24, 0xD5, 0xCA, 0xAA, 0xB0, 0x99, 0x7E, 0xF3, 0x15, 0x7D, 0xD7, 0x6E, 0xFF, 0x1C, 0x98, 0xAD,
+    0xA6, 0x05, 0x77, 0xA9, 0xFC, 0x6B, 0x10, 0xB9, 0xB4, 0xB2, 0x31, 0x2D, 0x96, 0xCD, 0xF4, 0x7F,
+    0x5A, 0x2E, 0x4F, 0x59, 0x9A, 0xAB, 0xF6, 0xB6, 0x90, 0xCF, 0x77, 0x1B, 0x27, 0x7A, 0xEF, 0xEE,
+    0x35, 0xF2, 0xD8, 0xFF, 0x16, 0xC1, 0x92, 0x80, 0x6C, 0x78, 0x10, 0x9F, 0xB6, 0xDA, 0xE1, 0x46,
+    0xA9, 0x61, 0x33, 0x5F, 0xE9, 0x9E, 0xF6, 0x11, 0xA8, 0xDB, 0x59, 0x31, 0x1F, 0xE8, 0xDC, 0x3B,
+    0x55, 0xF8, 0xAB, 0x47, 0x0B, 0x2C, 0xC0, 0x0C, 0xCD, 0x6C, 0xCB, 0xAC, 0xCB, 0x9C, 0xCB, 0x5C,
+    0xD1, 0x2D, 0xEB, 0x13, 0x2E, 0xF7, 0x51, 0x13, 0xCC, 0xBE, 0xCC, 0x08, 0xCF, 0x51, 0xA3, 0xDD,
+    0xD0, 0x59, 0x8D, 0xCC, 0x0C, 0xFC, 0x1C, 0xB9, 0x6D, 0x3A, 0x91, 0xB9, 0xB3, 0xC7, 0x40, 0x4C,
+    0xD0, 0x1C, 0xCD, 0xBC, 0xD9, 0x7D, 0xF4, 0x18, 0xFF, 0x64, 0x79, 0x00, 0xDC, 0x18, 0xCC, 0x07,
+    0xCC, 0x18, 0xCC, 0xCC, 0xCC, 0x07, 0xCC, 0x04, 0xCC, 0x0A, 0xCC, 0x17, 0xCD, 0x15, 0xCC, 0x00,
+    0xCF, 0x81, 0x89, 0xEA, 0x5A, 0x00, 0xBC, 0xFE, 0x14, 0xAC, 0xB5, 0x3D, 0x02, 0xCD, 0x1B, 0xDD,
+    0x2E, 0xDC, 0x0E, 0xCD, 0x92, 0xDC, 0x1F, 0xCC, 0xFA, 0xCE, 0x21, 0x60, 0xF1, 0x6A, 0x2C, 0x15,
+    0xEF, 0x15, 0xE1, 0xC9, 0xDC, 0xFF, 0xDD, 0xA0, 0xDC, 0x03, 0xCC, 0x0F, 0xCC, 0x35, 0xCC, 0x10,
+    0xCF, 0x71, 0x0D, 0x86, 0xE0, 0xC0, 0xEC, 0xC0, 0x6C, 0xC1, 0x1C, 0xC3, 0x9C, 0xC0, 0x7C, 0xF9,
+    0x1A, 0xFF, 0x95, 0x71, 0x04, 0xCC, 0x29, 0xCD, 0x0C, 0xCC, 0x1E, 0xCD, 0x96, 0xDC, 0x29, 0xCC,
+    0x23, 0xCC, 0x10, 0xCC, 0x0B, 0xCC, 0x31, 0xDF, 0xC1, 0x79, 0xAB, 0xD6, 0x41, 0xCC, 0xC0, 0x0C,
+    0xD7, 0xFE, 0xC1, 0x1C, 0xC1, 0x4C, 0xC1, 0x7C, 0xC0, 0x0C, 0xC1, 0xDC, 0xC1, 0x5C, 0xC5, 0x0C,
+    0xC0, 0x1C, 0xE0, 0x13, 0x1D, 0xD5, 0xC0, 0x1A, 0xE1, 0x1E, 0xC8, 0x0F, 0xCC, 0x0B, 0xCC, 0x18,
+    0xCD, 0x3D, 0xDC, 0x13, 0xCD, 0x52, 0xDE, 0x61, 0xBD, 0xA1, 0x5E, 0x80, 0xEC, 0xD4, 0x0D, 0xC2,
+    0x3C, 0xF4, 0x13, 0x8F, 0x4D, 0xD4, 0x01, 0xCE, 0x21, 0x5C, 0xC7, 0xFA, 0xC0, 0xEC, 0xFD, 0x10,
+    0xEF, 0x96, 0x55, 0x60, 0xCC, 0x62, 0xCD, 0x2C, 0xDF, 0x41, 0xC9, 0xB8, 0x52, 0x40, 0xCC, 0xD8,
+    0x9D, 0xE9, 0x19, 0xEA, 0x96, 0x2C, 0x3E, 0xDC, 0x1D, 0xCC, 0x7A, 0xDF, 0x41, 0x98, 0xCE, 0xEC,
+    0x02, 0x9C, 0xC1, 0xEC, 0xC1, 0x2C, 0xC0, 0xCC, 0xDB, 0x9D, 0xC0, 0x1C, 0xFB, 0x15, 0x8A, 0xB5,
+    0x54, 0x1A, 0xCC, 0x0C, 0xDC, 0x20, 0xCC, 0x55, 0xCC, 0x2D, 0xCC, 0x2A, 0xDC, 0x04, 0xCC, 0x2A,
+    0xCC, 0x07, 0xCC, 0x12, 0xCC, 0x69, 0xDC, 0x12, 0xCC, 0x0E, 0xCC, 0x05, 0xDC, 0x48, 0xCC, 0x3D,
+    0xCF, 0xC1, 0xB2, 0x9A, 0xC3, 0x81, 0x7C, 0xC4, 0x6C, 0xC0, 0x4C, 0xC0, 0xEC, 0xF5, 0x13, 0xC9,
+    0x44, 0xA8, 0x8B, 0xDC, 0x29, 0xCC, 0x33, 0xCC, 0x74, 0xDF, 0x31, 0x0C, 0x84, 0x69, 0xC0, 0x2C,
+    0xC1, 0x9C, 0xDB, 0xFD, 0xC0, 0x3C, 0xC3, 0x2C, 0xC5, 0xFD, 0xDC, 0xCD, 0xC2, 0x9C, 0xC0, 0x0C,
+    0xC0, 0x3C, 0xEC, 0x11, 0x2A, 0xB5, 0xFC, 0x5A, 0xCE, 0xE1, 0x2D, 0x99, 0x7A, 0xC2, 0x1C, 0xF5,
+    0x1E, 0x59, 0x95, 0x3C, 0x55, 0xCC, 0x43, 0xCC, 0x21, 0xCD, 0x8E, 0xDC, 0x0F, 0xDC, 0x13, 0xCC,
+    0x17, 0xCF, 0x61, 0xF8, 0xED, 0xC3, 0x00, 0x3C, 0xC1, 0x6C, 0xC3, 0xDD, 0xC1, 0x1C, 0xDB, 0x6D,
+    0xEE, 0x1B, 0x3F, 0xDE, 0x30, 0x22, 0xCC, 0x2F, 0xCC, 0x12, 0xCC, 0x5B, 0xCC, 0x07, 0xCC, 0xD0,
+    0xDC, 0x13, 0xCC, 0x01, 0xCF, 0xE1, 0x82, 0xE8, 0xF2, 0xC8, 0xAC, 0xC6, 0x0C, 0xC0, 0x6D, 0xC3,
+    0xDC, 0xE1, 0x18, 0x2F, 0x25, 0xC4, 0x0F, 0xCC, 0x1E, 0xCC, 0x18, 0xCC, 0x5E, 0xCD, 0xB2, 0xDC,
+    0x11, 0xCD, 0xAF, 0xDC, 0x28, 0xCC, 0x08, 0xCE, 0x71, 0x53, 0xBB, 0x57, 0xA6, 0x13, 0xF9, 0x94,
+    0x59, 0xB4, 0xD2, 0x11, 0x7B, 0xB7, 0x04, 0x99, 0xE6, 0x37, 0x5B, 0x5D, 0xD8, 0x65, 0x98, 0x01,
+    0x99, 0x89, 0xB8, 0x5D, 0x98, 0x5B, 0x98, 0x99, 0x98, 0x65, 0x9F, 0x02, 0x89, 0x80, 0x97, 0xB6,
+    0x7B, 0x85, 0x59, 0x9C, 0x5B, 0x81, 0x59, 0xBF, 0xBB, 0x84, 0xBB, 0xBA, 0xDB, 0x9B, 0x7B, 0x84,
+    0x19, 0xDC, 0x27, 0xFA, 0x5F, 0x28, 0x4F, 0x99, 0x13, 0xA0, 0x23, 0xB2, 0x17, 0xB8, 0x71, 0x98,
+    0x3B, 0x98, 0xA1, 0xB8, 0x0D, 0x98, 0x3B, 0x98, 0x03, 0x98, 0xB5, 0x9C, 0x82, 0xDD, 0x39, 0xB0,
+    0x39, 0xBB, 0x80, 0x39, 0x8A, 0x5B, 0x86, 0xDB, 0x88, 0x99, 0xE7, 0x69, 0x19, 0xAF, 0x70, 0x21,
+    0x9D, 0x42, 0x59, 0xD5, 0x8D, 0x85, 0xD9, 0x82, 0x39, 0x83, 0xF9, 0x82, 0x19, 0xCE, 0x20, 0xDA,
+    0x6A, 0xD4, 0x22, 0x55, 0x48, 0xEB, 0x02, 0xF9, 0x85, 0x99, 0xDE, 0x30, 0x78, 0x98, 0xB0, 0x51,
+    0x98, 0x5B, 0x98, 0x59, 0x98, 0x7B, 0xB8, 0x05, 0x98, 0xC1, 0x98, 0x2B, 0x99, 0x37, 0xAC, 0xB6,
+    0x1E, 0x7A, 0xEE, 0x0E, 0x67, 0x70, 0xB7, 0x49, 0xE8, 0x00, 0x4E, 0x61, 0x36, 0x76, 0x0C, 0x6C,
+    0x4A, 0x8E, 0x4A, 0xF1, 0xF9, 0xF7, 0x54, 0x40, 0x8C, 0xF0, 0x13, 0xCF, 0xCC, 0xD0, 0x64, 0xCF,
+    0x51, 0xE0, 0x89, 0xC2, 0xCF, 0xED, 0xC0, 0x0D, 0xE6, 0x13, 0x98, 0xC4, 0x7C, 0x17, 0xCC, 0x0C,
+    0xCC, 0x31, 0xCE, 0xA1, 0xC3, 0xFB, 0xC2, 0x83, 0x2C, 0xC0, 0xDC, 0xC4, 0xBD, 0xCF, 0x9D, 0xC6,
+    0xDC, 0xC4, 0xDC, 0xC0, 0x5C, 0xEA, 0x10, 0x8F, 0xF5, 0xC8, 0x3A, 0xCC, 0x03, 0xCC, 0x0F, 0xCC,
+    0x26, 0xDC, 0x14, 0xCC, 0x83, 0xCC, 0x10, 0xCC, 0x00, 0xCE, 0x71, 0xE4, 0xEE, 0x54, 0x04, 0x5D,
+    0x0A, 0x4D, 0x80, 0x0C, 0xC6, 0x2C, 0xC1, 0xAC, 0xC1, 0x6C, 0xEA, 0x1C, 0xED, 0xD5, 0xFE, 0xD1,
+    0x70, 0xB5, 0xFA, 0x01, 0x1C, 0xFD, 0x10, 0x5A, 0x25, 0xD4, 0x29, 0xCC, 0x9B, 0xDC, 0xE7, 0xDC,
+    0x47, 0xCC, 0x58, 0xDC, 0x29, 0xCF, 0xB1, 0xDD, 0xF7, 0xFE, 0x8F, 0xCD, 0xC1, 0x6C, 0xC2, 0x5C,
+    0xC0, 0xAC, 0xC5, 0xCC, 0xEC, 0x13, 0x6C, 0xD5, 0x28, 0x1A, 0xCC, 0x0D, 0xCC, 0x51, 0xCD, 0x12,
+    0xD0, 0x0F, 0xC8, 0xF3, 0xDD, 0x20, 0xDC, 0x0F, 0xCC, 0x86, 0xDC, 0xFE, 0xD0, 0x45, 0xDA, 0x51,
+    0xE8, 0xBD, 0x69, 0x42, 0xFD, 0xC3, 0x4C, 0xC1, 0x1C, 0xF2, 0x19, 0x5E, 0x74, 0x8C, 0x6D, 0xCE,
+    0x21, 0x91, 0xB1, 0x42, 0x26, 0x13, 0xAA, 0xBC, 0x4B, 0x71, 0x57, 0x9C, 0xD5, 0xC5, 0x8D, 0xC0,
+    0x8C, 0xC1, 0x0C, 0xC8, 0xBC, 0xC1, 0x6C, 0xCB, 0xAD, 0xC0, 0x2C, 0xC3, 0x7C, 0xD2, 0x0D, 0xC2,
+    0x1D, 0xF7, 0x1F, 0x2E, 0x0F, 0x44, 0x0C, 0xCC, 0x1A, 0xCC, 0x24, 0xCC, 0x11, 0xCC, 0x51, 0xCC,
+    0x30, 0xCC, 0x38, 0xCC, 0x30, 0xCC, 0x02, 0xDC, 0x60, 0xDF, 0xE1, 0xC7, 0xD4, 0xD2, 0x44, 0x7C,
+    0xC8, 0x9D, 0xC0, 0x5C, 0xC0, 0x0C, 0xC5, 0x8D, 0xC0, 0x0C, 0xD5, 0xAE, 0xC4, 0x5C, 0xCB, 0x0D,
+    0xDA, 0x8E, 0xC4, 0x5D, 0xC3, 0x7C, 0xC9, 0x4D, 0xC2, 0x7C, 0xE0, 0x11, 0xAE, 0xC0, 0x2D, 0xA0,
+    0x0F, 0x9A, 0xE1, 0xB8, 0x5D, 0x98, 0x07, 0x98, 0x1D, 0x9E, 0xC3, 0xFF, 0xB4, 0xEC, 0x81, 0xB9,
+    0x99, 0xBB, 0xEE, 0x26, 0xDA, 0x7C, 0xB6, 0x03, 0xBD, 0x71, 0xBF, 0x54, 0x2E, 0xD9, 0xEF, 0x88,
+    0x57, 0x9A, 0x51, 0xBA, 0xE7, 0xB8, 0x47, 0x98, 0x6F, 0x98, 0x23, 0x98, 0x0B, 0x98, 0x65, 0x9F,
+    0x02, 0x7B, 0x3B, 0xBD, 0x80, 0x99, 0x82, 0xB9, 0xAA, 0x5B, 0x94, 0x1B, 0xBC, 0xDB, 0x8E, 0x9B,
+    0xF8, 0x38, 0x1A, 0x6D, 0x70, 0x09, 0x9A, 0x5B, 0xB8, 0xD3, 0xB8, 0x09, 0x98, 0x1D, 0x99, 0x75,
+    0xB8, 0x77, 0xB8, 0xB7, 0x98, 0x0B, 0x98, 0x15, 0x98, 0x4F, 0x9C, 0xE2, 0xC1, 0x96, 0xEB, 0xFC,
+    0x3A, 0x7B, 0xCB, 0x48, 0x59, 0x99, 0xFB, 0xB8, 0x0F, 0x98, 0x51, 0xB8, 0xBF, 0x98, 0x0B, 0x98,
+    0x07, 0x9C, 0x22, 0x0D, 0x87, 0x99, 0x87, 0xBB, 0x84, 0x99, 0x83, 0x19, 0x8B, 0xF9, 0xF1, 0x3E,
+    0x9E, 0x82, 0xCB, 0x49, 0xC4, 0xB7, 0x7F, 0xD8, 0x25, 0xB4, 0x91, 0xE9, 0x70, 0x22, 0x46, 0xE1,
+    0x46, 0x6F, 0xC6, 0xE2, 0x96, 0x60, 0x5E, 0x69, 0x5E, 0x81, 0x26, 0x41, 0xF6, 0x60, 0x96, 0x60,
+    0x2E, 0x65, 0x3E, 0xEB, 0x66, 0x80, 0x6E, 0x4F, 0x26, 0xE1, 0xCE, 0x60, 0x5E, 0x6C, 0x76, 0xE3,
+    0x5E, 0xEC, 0xBE, 0xE4, 0x26, 0x6D, 0x5E, 0xF0, 0x8A, 0xDE, 0x77, 0x28, 0x2E, 0xE6, 0x1F, 0xE6,
+    0x0D, 0xEE, 0x04, 0x66, 0x53, 0x6E, 0x0E, 0x67, 0xB0, 0xE6, 0xDC, 0x74, 0x40, 0x1E, 0x6A, 0x56,
+    0xE0, 0xBE, 0x7B, 0x0C, 0x2D, 0x6B, 0x8C, 0xC0, 0x6E, 0x2E, 0x6E, 0x18, 0xE6, 0x5D, 0xEF, 0x80,
+    0xB3, 0xC3, 0xFF, 0xA0, 0xCE, 0x60, 0x06, 0x6B, 0xEE, 0xE1, 0x3E, 0x60, 0x66, 0x60, 0xF6, 0x60,
+    0x0E, 0x60, 0x9E, 0xE0, 0xCE, 0x70, 0x89, 0xA4, 0x07, 0x71, 0x48, 0x89, 0x63, 0xC0, 0x3D, 0x2B,
+    0x13, 0xCE, 0xED, 0xA0, 0x1B, 0xCD, 0xFE, 0xDC, 0x23, 0xCC, 0x01, 0xCF, 0x11, 0x75, 0xBD, 0x5E,
+    0x44, 0xED, 0x64, 0x14, 0x80, 0x1F, 0x30, 0x6F, 0x30, 0x6B, 0x36, 0x07, 0x71, 0x8B, 0x40, 0xF7,
+    0x2E, 0x45, 0x16, 0x7D, 0x7E, 0x4E, 0x77, 0x7E, 0xF7, 0x61, 0x37, 0x05, 0x33, 0x0E, 0x33, 0x17,
+    0xB3, 0xB0, 0x52, 0x7F, 0xF6, 0x00, 0xBB, 0x78, 0x44, 0xAE, 0x91, 0xDB, 0x5D, 0x77, 0x15, 0x33,
+    0x15, 0x77, 0x03, 0x73, 0x0E, 0xF3, 0x68, 0xB4, 0xBB, 0x47, 0xF1, 0x99, 0x0D, 0xAF, 0xA6, 0x74,
+    0xFF, 0xEE, 0x02, 0xE6, 0x10, 0x67, 0x48, 0xF1, 0x62, 0x23, 0x7A, 0x8E, 0xA7, 0xF7, 0xFE, 0x07,
+    0xE6, 0xB4, 0xEE, 0x1D, 0xE6, 0x1F, 0x66, 0x10, 0x67, 0x50, 0x91, 0xC3, 0xA2, 0x81, 0x66, 0x63,
+    0xAE, 0xE0, 0x6E, 0x62, 0xE6, 0x6D, 0xCE, 0xE1, 0x2E, 0x60, 0xCE, 0x6C, 0x1E, 0xE1, 0x76, 0x73,
+    0x0E, 0x9F, 0x67, 0xD0, 0x9E, 0xEE, 0xDE, 0x6E, 0x03, 0xE6, 0x08, 0x66, 0x07, 0xE6, 0x88, 0x6E,
+    0x00, 0xEE, 0x11, 0xE7, 0x78, 0xD9, 0x51, 0xAD, 0xA1, 0x06, 0x67, 0xF6, 0xE2, 0x26, 0x61, 0x86,
+    0x60, 0x0E, 0x60, 0x7E, 0x60, 0xE6, 0x72, 0x89, 0x0C, 0xA2, 0x16, 0xD1, 0x6E, 0x04, 0x67, 0xD0,
+    0xA0, 0xE0, 0x20, 0x20, 0xF6, 0x69, 0xF6, 0xE0, 0x9E, 0x63, 0xC6, 0xE1, 0x56, 0x66, 0x4E, 0xE1,
+    0x16, 0x78, 0x0D, 0xFD, 0x5F, 0x28, 0x11, 0xE6, 0x31, 0x66, 0x0C, 0xE6, 0x01, 0x66, 0x0B, 0xE7,
+    0xB8, 0xD9, 0xCF, 0xAF, 0x80, 0x1E, 0x60, 0x76, 0x61, 0x7E, 0x61, 0x57, 0x60, 0xE6, 0x60, 0x36,
+    0x60, 0x7E, 0x60, 0x06, 0x60, 0x76, 0x60, 0xD6, 0xF4, 0x0A, 0xBD, 0xA6, 0xCD, 0x00, 0xA8, 0xEB,
+    0xFB, 0x8A, 0x8E, 0xE0, 0x0E, 0x79, 0x52, 0x0B, 0x20, 0x37, 0x30, 0x73, 0x30, 0x5F, 0x30, 0x13,
+    0x33, 0x3F, 0x71, 0x57, 0x30, 0x8F, 0x36, 0x4B, 0x76, 0xEF, 0x72, 0x3F, 0x30, 0x5B, 0x32, 0x2F,
+    0x70, 0x7B, 0x34, 0xDF, 0x70, 0xDB, 0x31, 0x77, 0x70, 0x57, 0x75, 0xA7, 0x70, 0x03, 0x30, 0x43,
+    0x30, 0x67, 0x35, 0xA3, 0x70, 0x07, 0x3C, 0xC4, 0xAE, 0x17, 0xE5, 0x79, 0x77, 0x10, 0x73, 0xC0,
+    0x7F, 0x79, 0x90, 0x80, 0x17, 0x30, 0x2F, 0x30, 0x57, 0x30, 0x1B, 0x31, 0xE7, 0x72, 0x1F, 0x70,
+    0x07, 0x30, 0x9B, 0x3E, 0x87, 0xD2, 0x7D, 0x0D, 0x0A, 0xB3, 0x00, 0xF7, 0x07, 0x73, 0x0C, 0x33,
+    0x66, 0x74, 0x02, 0x72, 0x02, 0xB3, 0x00, 0x33, 0x01, 0xB3, 0x0A, 0xB3, 0x80, 0x6C, 0xE1, 0xB2,
+    0x15, 0x87, 0x4C, 0x16, 0x6F, 0x88, 0x50, 0xE7, 0x48, 0xE4, 0x6E, 0x2E, 0x31, 0x0B, 0xF6, 0x3A,
+    0xFC, 0xEF, 0x6E, 0x4C, 0xF6, 0x66, 0x6E, 0x29, 0xE6, 0x00, 0x66, 0x0C, 0x66, 0x00, 0x66, 0x0C,
+    0x66, 0xE2, 0xEE, 0x08, 0x67, 0x10, 0xD1, 0xE1, 0x39, 0x03, 0xB6, 0x70, 0x89, 0x97, 0xF7, 0x4C,
+    0x08, 0xE6, 0x65, 0xEE, 0xA1, 0xEE, 0x11, 0xE7, 0xC8, 0x8C, 0x56, 0xBE, 0x60, 0x6E, 0x70, 0x0C,
+    0xA7, 0x43, 0x43, 0xA8, 0xBC, 0x52, 0x7B, 0x27, 0x96, 0xE9, 0x9E, 0xE0, 0xDE, 0x75, 0x0A, 0x8F,
+    0x3E, 0x26, 0xB5, 0xEE, 0x00, 0x66, 0x0A, 0x66, 0x04, 0xE6, 0x07, 0xE6, 0xD2, 0xEE, 0x0F, 0xE6,
+    0xD1, 0xEE, 0x4D, 0xEE, 0x10, 0x67, 0xE8, 0xB7, 0xC0, 0xE9, 0x81, 0x1E, 0x73, 0x08, 0x6D, 0x8B,
+    0x38, 0x17, 0xE6, 0x05, 0x67, 0x20, 0xFE, 0x40, 0x72, 0xA0, 0x9E, 0x76, 0x8D, 0xEC, 0x0B, 0x70,
+    0x2E, 0xE6, 0x11, 0x66, 0xD0, 0x6E, 0x0B, 0x66, 0x3A, 0x6E, 0x04, 0x67, 0xB8, 0xFB, 0xC2, 0x6A,
+    0xA4, 0x2E, 0xE0, 0x9E, 0x61, 0x56, 0x6E, 0xD7, 0x6C, 0x5E, 0xE1, 0x5E, 0xE6, 0x06, 0xEA, 0xBF,
+    0x29, 0xDF, 0x30, 0x0E, 0xED, 0xF7, 0x2E, 0x13, 0x66, 0x21, 0x6E, 0x02, 0xE7, 0x58, 0xAF, 0xEC,
+    0xB1, 0x41, 0x66, 0x61, 0xAE, 0x6F, 0xFE, 0xEB, 0xBE, 0xEE, 0x6E, 0xE0, 0xC6, 0x69, 0xBE, 0xE1,
+    0x96, 0x7D, 0x8D, 0x47, 0x13, 0x62, 0xAE, 0xEE, 0x8D, 0xEE, 0x14, 0x66, 0x0A, 0x66, 0x18, 0xF6,
+    0xC6, 0x6E, 0x10, 0xE6, 0x0C, 0x66, 0x0B, 0xE7, 0xD8, 0xE5, 0x55, 0xF7, 0x45, 0xEE, 0xE0, 0x6E,
+    0x60, 0x66, 0x7F, 0x8D, 0x34, 0x1B, 0x6E, 0x03, 0xE7, 0xB8, 0x8C, 0xD8, 0x37, 0xA2, 0x9E, 0x60,
+    0x76, 0x73, 0x0D, 0xC6, 0x23, 0x8E, 0x0C, 0x66, 0x02, 0xE6, 0x01, 0xE6, 0x0A, 0xE6, 0x1A, 0x66,
+    0x5A, 0x6E, 0x71, 0xEE, 0xD6, 0x6E, 0x09, 0x67, 0xB8, 0xC5, 0xC0, 0x68, 0x40, 0xEE, 0xE1, 0x26,
+    0xEA, 0xAE, 0xE6, 0x86, 0xEB, 0x0E, 0xE0, 0x7E, 0x60, 0x46, 0x62, 0xA6, 0x61, 0xD6, 0x7E, 0x08,
+    0x8E, 0x8F, 0x84, 0x08, 0xE7, 0xB0, 0xF6, 0x4A, 0x7C, 0x40, 0x0E, 0x74, 0x0F, 0x65, 0x4A, 0xCC,
+    0x04, 0xE6, 0x01, 0x66, 0x0A, 0x66, 0x07, 0x6E, 0xDD, 0x6E, 0x9C, 0x6E, 0x11, 0x67, 0xC8, 0xEF,
+    0xFE, 0xE1, 0x02, 0x36, 0x73, 0x0F, 0x17, 0x7E, 0x00, 0x02, 0xE6, 0x31, 0xEE, 0x0B, 0x66, 0x0E,
+    0xE6, 0x24, 0xE6, 0xA0, 0x6E, 0x33, 0xEE, 0x16, 0xE6, 0x22, 0x69, 0x97, 0x9A, 0x6E, 0x38, 0x1D,
+    0xAE, 0x85, 0xC9, 0x82, 0xDC, 0x3C, 0xCD, 0x46, 0xDC, 0xD4, 0xDC, 0x10, 0xCC, 0x0B, 0xCE, 0x61,
+    0xB6, 0xD9, 0x75, 0x00, 0xEC, 0xC2, 0xBC, 0xF7, 0x1F, 0xBE, 0x5F, 0x34, 0x0B, 0xCE, 0xA1, 0x29,
+    0xB2, 0x69, 0xCB, 0xBD, 0xC1, 0x8C, 0xC2, 0x5D, 0xC0, 0xCC, 0xC0, 0xEC, 0xC0, 0x2C, 0xC0, 0x1C,
+    0xC1, 0xED, 0xC3, 0x2D, 0xC1, 0x6D, 0xCA, 0xED, 0xC4, 0x3C, 0xC3, 0xAD, 0x2E, 0xFD, 0x3F, 0x5C,
+    0x23, 0x29, 0x26, 0x90, 0x83, 0x19, 0x80, 0x99, 0x82, 0x39, 0xB1, 0x7B, 0x83, 0x19, 0xBC, 0x1B,
+    0xD4, 0x2A, 0xB0, 0x2E, 0x98, 0x09, 0x9A, 0x6F, 0xB9, 0x19, 0xBE, 0x82, 0xD7, 0xC4, 0xCD, 0x5E,
+    0x2D, 0xFB, 0xCF, 0x08, 0x93, 0x98, 0x17, 0x98, 0x31, 0x9B, 0x4B, 0xBA, 0x51, 0xB8, 0x8F, 0x98,
+    0x01, 0x98, 0x07, 0x98, 0x5D, 0x98, 0x6D, 0x98, 0x1D, 0x98, 0x05, 0x98, 0xF9, 0xBC, 0xE2, 0x2F,
+    0x5A, 0xA3, 0x02, 0xB9, 0x9A, 0xFB, 0x85, 0x99, 0xC0, 0x2C, 0xF3, 0xF8, 0x10, 0x05, 0x9B, 0x55,
+    0xBD, 0x02, 0xF7, 0x97, 0x99, 0x87, 0x9B, 0x82, 0x19, 0x94, 0x1B, 0x8C, 0x99, 0xD4, 0x33, 0xF4,
+    0xDC, 0xB1, 0x1B, 0xB8, 0x4D, 0x98, 0x35, 0x9D, 0xC3, 0xD3, 0x9D, 0xEE, 0x81, 0xD9, 0x9D, 0x5B,
+    0x88, 0x79, 0x86, 0x19, 0x80, 0xD9, 0xEE, 0x32, 0x97, 0x0E, 0x91, 0x15, 0x99, 0x31, 0xB8, 0x2F,
+    0x99, 0x33, 0xB8, 0x03, 0x98, 0x01, 0x9D, 0x23, 0x71, 0x48, 0x95, 0x7A, 0x2F, 0x77, 0x5C, 0xA9,
+    0x9B, 0xA7, 0x9A, 0x81, 0x61, 0x01, 0xB3, 0x05, 0xF3, 0x04, 0x73, 0x40, 0xF7, 0x49, 0xFB, 0x02,
+    0x73, 0x00, 0x33, 0x05, 0xF3, 0x88, 0x7E, 0x31, 0x59, 0x63, 0x67, 0x70, 0xE3, 0x30, 0xC7, 0x30,
+    0x23, 0x30, 0xDF, 0x30, 0x47, 0x30, 0x13, 0x30, 0x3F, 0x30, 0x4F, 0x31, 0x07, 0x78, 0x44, 0xB6,
+    0x15, 0x34, 0x01, 0xB3, 0x7B, 0x77, 0xC0, 0x54, 0x36, 0x79, 0x71, 0x3F, 0x32, 0xDF, 0x36, 0x27,
+    0x76, 0x83, 0x70, 0xD7, 0x30, 0x07, 0x3E, 0x45, 0x92, 0x67, 0xAC, 0x55, 0x37, 0x04, 0x33, 0x04,
+    0xF3, 0x88, 0x74, 0xAA, 0xD8, 0xE0, 0xCF, 0x31, 0xB7, 0x30, 0x07, 0x30, 0xDF, 0x39, 0x06, 0xE3,
+    0xC9, 0xB9, 0xA8, 0x51, 0x7E, 0xBF, 0x21, 0x3F, 0x30, 0x03, 0x3C, 0x47, 0x36, 0x89, 0xF1, 0x1A,
+    0xB3, 0x0A, 0xF3, 0x06, 0xB3, 0x9F, 0x5F, 0x35, 0x68, 0x1E, 0x9C, 0x8F, 0xDD, 0x73, 0xE2, 0x3E,
+    0xF6, 0x40, 0xEF, 0x70, 0xD4, 0x76, 0x26, 0x00, 0xC6, 0x60, 0x1E, 0x7D, 0x09, 0x85, 0x13, 0xE0,
+    0x63, 0x6E, 0xDB, 0xEE, 0x11, 0xE5, 0x25, 0xC0, 0x46, 0x6A, 0xFD, 0xE7, 0x1B, 0x72, 0x9F, 0x70,
+    0x9B, 0x38, 0x45, 0x0A, 0x5D, 0xB1, 0x00, 0xB3, 0x04, 0xF3, 0x01, 0xB3, 0x12, 0xF3, 0x00, 0x33,
+    0x33, 0x33, 0x00, 0xF3, 0x4A, 0xF7, 0x03, 0x33, 0x13, 0x33, 0x1D, 0x33, 0x05, 0xBB, 0x88, 0x61,
+    0xFF, 0x54, 0x30, 0xF3, 0x70, 0x97, 0x71, 0xEB, 0x30, 0xEF, 0x30, 0xF7, 0x75, 0x43, 0x70, 0xF3,
+    0x71, 0x33, 0x39, 0x44, 0x2F, 0x47, 0x0B, 0x17, 0x33, 0x06, 0x77, 0x3A, 0x77, 0x06, 0x33, 0x72,
+    0xF7, 0x04, 0xF3, 0x07, 0xF3, 0x00, 0xB3, 0x0B, 0xB3, 0x00, 0xF3, 0x04, 0xF3, 0x11, 0xB3, 0x65,
+    0xF7, 0x0F, 0x33, 0x04, 0x73, 0x01, 0x33, 0x74, 0x77, 0x18, 0xF3, 0x3B, 0xB7, 0x03, 0xF3, 0x01,
+    0xF7, 0x80, 0x5B, 0x37, 0x38, 0xC2, 0x9F, 0x73, 0x27, 0x70, 0x53, 0x33, 0x8B, 0x70, 0xCF, 0x30,
+    0x43, 0x30, 0x07, 0x3D, 0x06, 0x7F, 0x07, 0x43, 0x0B, 0xF7, 0x12, 0x73, 0x2A, 0x37, 0x0C, 0x73,
+    0xF0, 0x6E, 0xF2, 0xF2, 0xE0, 0x67, 0x30, 0x43, 0x30, 0x5F, 0x31, 0x0F, 0x3B, 0xC4, 0x42, 0x59,
+    0xDB, 0x59, 0x37, 0x4A, 0x77, 0x0D, 0x73, 0x0C, 0xF3, 0x0D, 0xB3, 0xF4, 0x76, 0xBB, 0x3A, 0x00,
+    0xFF, 0x30, 0x47, 0x31, 0x03, 0x34, 0x5F, 0x70, 0x63, 0x30, 0x8F, 0x3B, 0x06, 0xB3, 0xA1, 0x35,
+    0x07, 0xB3, 0x0E, 0x73, 0x02, 0xF3, 0x0D, 0x73, 0x6E, 0x37, 0x0B, 0xF3, 0x02, 0xF3, 0x06, 0x73,
+    0xAC, 0x6C, 0xF8, 0xB5, 0xE0, 0x5F, 0x33, 0x13, 0x70, 0xC3, 0x30, 0x93, 0x30, 0x87, 0x30, 0x4B,
+    0x30, 0xE7, 0x30, 0x57, 0x30, 0x6B, 0x30, 0x4F, 0x30, 0x87, 0x30, 0x17, 0x30, 0x57, 0x30, 0x27,
+    0x39, 0x45, 0x6E, 0xB9, 0x11, 0x09, 0x33, 0x4C, 0xB7, 0x05, 0x73, 0x06, 0xB3, 0x12, 0xB7, 0x00,
+    0xF3, 0x02, 0xF3, 0x3E, 0xF7, 0x08, 0xB3, 0x12, 0x33, 0x00, 0xF3, 0x07, 0x73, 0xEC, 0x52, 0x71,
+    0xB3, 0xC0, 0x53, 0x36, 0xBB, 0x77, 0xEB, 0x70, 0x0B, 0x30, 0x37, 0x30, 0x93, 0x3E, 0xC5, 0x2E,
+    0x23, 0x4F, 0x20, 0xB4, 0x8C, 0xC3, 0xE9, 0xC0, 0xE6, 0x77, 0x8E, 0x57, 0x8E, 0x6E, 0x05, 0xE7,
+    0xF8, 0xF7, 0x6D, 0xBE, 0xEE, 0x56, 0xED, 0x9E, 0xE0, 0x1E, 0x68, 0xCE, 0xE2, 0x0E, 0x61, 0x76,
+    0x81, 0xDE, 0x40, 0xD6, 0x62, 0xC6, 0x60, 0xAE, 0x60, 0x56, 0x62, 0x0E, 0x85, 0xE6, 0xC1, 0x76,
+    0x63, 0x26, 0x64, 0x7E, 0xE9, 0xA6, 0xE0, 0x46, 0x62, 0x2E, 0xE0, 0x9E, 0x62, 0xD6, 0x6B, 0x76,
+    0xE0, 0xD6, 0x63, 0x7E, 0x69, 0xBE, 0xE1, 0xA6, 0xE2, 0x7E, 0x60, 0xCE, 0x60, 0x26, 0x60, 0xE6,
+    0x60, 0x3E, 0x61, 0x9E, 0x61, 0xFE, 0xEE, 0xB6, 0xE0, 0xF6, 0x60, 0xDE, 0x6C, 0x5E, 0xE0, 0x9E,
+    0x7A, 0x8A, 0xAC, 0x9A, 0xDA, 0x07, 0xE6, 0x0E, 0xE6, 0x8D, 0xEE, 0x00, 0xE6, 0x09, 0xE7, 0x58,
+    0xE0, 0xD2, 0xE5, 0x16, 0x8E, 0x25, 0xF6, 0xB9, 0x10, 0xBA, 0x79, 0xAF, 0x4C, 0xBE, 0xE0, 0xC6,
+    0x61, 0x5E, 0x6C, 0x0E, 0xE5, 0x36, 0xEF, 0xDE, 0xE3, 0x66, 0xFB, 0x8B, 0xFD, 0x03, 0x8C, 0x1E,
+    0x66, 0x05, 0x66, 0x26, 0xE8, 0x21, 0xEC, 0xF6, 0xEB, 0x07, 0xFC, 0x04, 0xF9, 0x81, 0x59, 0x82,
+    0x39, 0x80, 0x59, 0x80, 0xB9, 0x88, 0x79, 0x80, 0x19, 0x82, 0x39, 0xE2, 0x2B, 0xFD, 0x9D, 0x88,
+    0x29, 0x9E, 0x63, 0xB3, 0x38, 0xBB, 0x00, 0x99, 0x87, 0x59, 0x82, 0x59, 0x80, 0x19, 0xA6, 0x9B,
+    0x82, 0x79, 0xE2, 0x27, 0x1C, 0xF9, 0x50, 0x57, 0x99, 0xBF, 0xB8, 0x5B, 0x98, 0x25, 0x98, 0xA1,
+    0x99, 0x35, 0x98, 0x3B, 0x9E, 0xE3, 0x91, 0x21, 0xD4, 0x04, 0x59, 0x80, 0xB9, 0xBE, 0x3B, 0x96,
+    0x9B, 0x96, 0x1B, 0x80, 0x39, 0x81, 0x99, 0x8C, 0x5B, 0x84, 0xD9, 0x81, 0xF9, 0x87, 0x19, 0xDC,
+    0x27, 0x35, 0xEB, 0xE7, 0x23, 0xFB, 0x7C, 0xEA, 0x89, 0xFB, 0x88, 0x59, 0x84, 0x1B, 0xD8, 0x2B,
+    0xD2, 0xC9, 0x16, 0x42, 0xB1, 0xE1, 0xCA, 0x93, 0xDB, 0x87, 0x59, 0xAD, 0xDB, 0x81, 0x59, 0xCA,
+    0x37, 0xFD, 0x9A, 0x78, 0x15, 0x9A, 0x1D, 0xB8, 0x3B, 0x9B, 0x53, 0xB8, 0x2F, 0x9C, 0x03, 0x0B,
+    0x87, 0xEC, 0x96, 0x1B, 0x91, 0xFB, 0x82, 0x59, 0xAD, 0x1B, 0x8E, 0xDB, 0xA2, 0x1B, 0x91, 0xFB,
+    0x85, 0x39, 0x86, 0x99, 0x88, 0xD9, 0x85, 0x19, 0x81, 0xDB, 0x80, 0x99, 0x82, 0x59, 0xB3, 0xBB,
+    0x9E, 0x7B, 0x85, 0xDB, 0x84, 0xB9, 0x83, 0xF9, 0x82, 0x79, 0x83, 0x19, 0xF4, 0x20, 0x5B, 0xEA,
+    0xC8, 0x1B, 0x99, 0x47, 0xBD, 0xE2, 0x5F, 0x6F, 0xA1, 0xCE, 0x3F, 0x78, 0xFB, 0xB1, 0x69, 0xB8,
+    0x1F, 0x98, 0x17, 0x98, 0x0D, 0x98, 0x95, 0xB8, 0xB5, 0x98, 0xAD, 0xBC, 0x23, 0xB1, 0x38, 0xE4,
+    0x03, 0xDB, 0xF4, 0x21, 0x7C, 0x3E, 0x28, 0x1B, 0x98, 0x0F, 0x98, 0xCD, 0x9C, 0x82, 0x5D, 0xB2,
+    0xA8, 0x3F, 0xBB, 0x82, 0x19, 0x81, 0x19, 0x86, 0x59, 0x88, 0x3B, 0x8C, 0x5B, 0x88, 0xD9, 0x8E,
+    0x7B, 0x84, 0x99, 0x80, 0xD9, 0xBD, 0x3B, 0x88, 0x19, 0x9F, 0xDB, 0xCE, 0x27, 0xF5, 0x1D, 0x7A,
+    0x71, 0xB8, 0x09, 0x98, 0x25, 0x99, 0x95, 0xB8, 0xD9, 0xA0, 0x47, 0x90, 0x33, 0x98, 0x0D, 0x98,
+    0x01, 0x98, 0x23, 0x9D, 0x42, 0xCF, 0x11, 0xDE, 0x2E, 0x9B, 0x82, 0x19, 0x88, 0xFB, 0x89, 0x9B,
+    0xC0, 0x27, 0x56, 0x7F, 0x20, 0x0B, 0x98, 0x5B, 0x98, 0x4F, 0x98, 0xFD, 0xBF, 0x82, 0x01, 0x66,
+    0xC1, 0x93, 0xBB, 0x84, 0x99, 0x83, 0x99, 0x85, 0x19, 0xDA, 0x37, 0x79, 0x1A, 0x0A, 0x19, 0xBB,
+    0xFB, 0xB8, 0x85, 0x98, 0x41, 0xBD, 0x23, 0xB3, 0x7E, 0x93, 0x03, 0x19, 0x82, 0x19, 0x84, 0x1B,
+    0x84, 0x99, 0x83, 0x79, 0x8B, 0x1B, 0xE2, 0x22, 0x9D, 0xFB, 0x43, 0x69, 0xB4, 0xE8, 0x31, 0xDE,
+    0x41, 0xFF, 0xDC, 0xF3, 0xC0, 0x9C, 0xCD, 0x8D, 0xCF, 0x1D, 0xC0, 0x2C, 0xC1, 0x3C, 0xC0, 0xAC,
+    0xD0, 0x8D, 0xC7, 0x5C, 0xC8, 0x9D, 0xC1, 0xEC, 0xC8, 0x3C, 0xC0, 0x4C, 0xC2, 0x0C, 0xC1, 0x8C,
+    0xF7, 0x10, 0xFF, 0xB6, 0x3A, 0x71, 0x2F, 0x92, 0x6B, 0xC5, 0x7C, 0xCD, 0x0C, 0xF8, 0x14, 0xAE,
+    0xDC, 0xAC, 0x07, 0xCC, 0xE7, 0xDC, 0x0E, 0xCC, 0x11, 0xCD, 0x3C, 0xDF, 0xE1, 0x8B, 0xB5, 0xCA,
+    0xCC, 0xBD, 0xC2, 0x7D, 0x24, 0xF7, 0x4F, 0xB8, 0x13, 0x98, 0x0F, 0x9B, 0x6D, 0xB9, 0xFF, 0xB8,
+    0x07, 0x98, 0x35, 0xB8, 0x17, 0x9D, 0x02, 0x13, 0xC7, 0xA7, 0x08, 0xB9, 0xF4, 0x26, 0x7C, 0xFD,
+    0x10, 0x19, 0x98, 0xB5, 0xA0, 0xC3, 0x90, 0x03, 0x9A, 0x77, 0xBD, 0xA2, 0x91, 0x18, 0xC1, 0x81,
+    0xF9, 0x80, 0x59, 0x84, 0x19, 0xB4, 0x3B, 0x80, 0xF9, 0xAD, 0x5B, 0x83, 0xB9, 0x82, 0x39, 0x80,
+    0x99, 0x87, 0xD9, 0x86, 0x39, 0xEA, 0x24, 0x16, 0x68, 0x7B, 0xD3, 0xBA, 0x17, 0xA3, 0x81, 0xB0,
+    0x45, 0xB8, 0x03, 0x98, 0x43, 0x9E, 0xE3, 0x0B, 0x20, 0x92, 0x8E, 0x19, 0xEC, 0x34, 0x78, 0x49,
+    0x08, 0x59, 0xB8, 0x95, 0xBD, 0xA3, 0x89, 0xB0, 0xF5, 0x87, 0x19, 0xD0, 0x30, 0x37, 0x9A, 0x4F,
+    0xA2, 0x01, 0x66, 0xA9, 0x8B, 0x59, 0x90, 0x1B, 0x80, 0x39, 0xE3, 0xCD, 0xDD, 0x80, 0xAC, 0xC7,
+    0x3D, 0xC6, 0xFD, 0xC1, 0xDC, 0xC3, 0xAC, 0xFC, 0x19, 0x3C, 0x7E, 0x1D, 0x1E, 0xDC, 0x5A, 0xCC,
+    0xC6, 0xDF, 0x41, 0xFA, 0xF5, 0xD9, 0x56, 0x4D, 0xD9, 0x0D, 0xC1, 0x1C, 0xE0, 0x10, 0xCE, 0x6E,
+    0x69, 0x00, 0xDC, 0xDE, 0xDC, 0x97, 0xDC, 0x00, 0xDC, 0x18, 0xCC, 0x36, 0xDC, 0x01, 0xCC, 0x00,
+    0xCC, 0x48, 0xDC, 0x2E, 0xCC, 0x24, 0xCC, 0x51, 0xDF, 0xE1, 0x5C, 0x9D, 0x5C, 0x8E, 0x8D, 0xD0,
+    0x6D, 0xC0, 0x3C, 0xC0, 0xCC, 0xC3, 0xDC, 0xDD, 0x7D, 0xC2, 0xDD, 0x00, 0x1C, 0x80, 0x8C, 0xC0,
+    0x2C, 0xFC, 0x11, 0xC8, 0x37, 0x03, 0x70, 0x12, 0xEC, 0x0A, 0xE6, 0x04, 0xE6, 0x2D, 0x67, 0xB8,
+    0xC1, 0x58, 0x6D, 0x20, 0x3E, 0x62, 0x2E, 0x6F, 0x5E, 0xE0, 0x1E, 0x76, 0x0E, 0xC7, 0xB7, 0x8B,
+    0x10, 0x82, 0xF7, 0x74, 0x41, 0x26, 0x60, 0x56, 0x62, 0xB6, 0x61, 0x6E, 0x60, 0xCE, 0x60, 0x1E,
+    0x61, 0xCE, 0xE3, 0x06, 0xFE, 0x0A, 0x0E, 0xEB, 0x2C, 0xE8, 0xEE, 0x93, 0x68, 0x0F, 0x64, 0x05,
+    0x66, 0x04, 0xE6, 0x01, 0x66, 0x1F, 0x67, 0x28, 0xBC, 0xD8, 0x63, 0xA1, 0xA6, 0xE0, 0x96, 0x76,
+    0x8E, 0x95, 0xBA, 0x3E, 0xC2, 0x6E, 0x0E, 0xE6, 0x03, 0x66, 0x24, 0xE6, 0x2A, 0xE7, 0x28, 0xA7,
+    0x4F, 0x22, 0x41, 0xEE, 0x60, 0xC6, 0x6C, 0x16, 0xE0, 0x9E, 0x62, 0x96, 0x6A, 0xDE, 0xE0, 0x36,
+    0x60, 0xF6, 0x6B, 0x86, 0xE1, 0x1E, 0xE0, 0xA6, 0x60, 0x2E, 0x66, 0x16, 0xE0, 0x16, 0x64, 0x6E,
+    0xF5, 0x8E, 0x4D, 0x4F, 0xF6, 0x02, 0xE6, 0x12, 0xE6, 0x0E, 0xE6, 0xF7, 0x69, 0x32, 0xFB, 0x5A,
+    0x5A, 0xAD, 0xD4, 0x8D, 0xA6, 0x6E, 0x66, 0xE0, 0x3E, 0x6E, 0xFE, 0xE0, 0x1E, 0x66, 0xD6, 0xE1,
+    0x7E, 0x60, 0xCE, 0x75, 0x0D, 0x44, 0x3B, 0x42, 0x0E, 0x67, 0xD8, 0xBA, 0x41, 0x7B, 0xA1, 0x26,
+    0x6C, 0xB6, 0xFD, 0x8A, 0xC4, 0xF7, 0xB2, 0x1E, 0xE6, 0xCB, 0x6E, 0xEA, 0x6E, 0x07, 0x67, 0xC8,
+    0x86, 0x55, 0x2D, 0xC0, 0xD6, 0x61, 0x9E, 0x71, 0x0D, 0xB5, 0x96, 0x98, 0x06, 0x66, 0x11, 0xE6,
+    0x20, 0x66, 0x00, 0xE6, 0x13, 0xE6, 0x09, 0x6E, 0x17, 0x6F, 0xC8, 0x9C, 0x7B, 0xE2, 0x20, 0x3E,
+    0x60, 0x66, 0x69, 0x2E, 0xE4, 0xDE, 0x65, 0x86, 0x60, 0x5E, 0x61, 0x46, 0x6A, 0x86, 0xE1, 0xE6,
+    0x60, 0x66, 0x60, 0x16, 0x63, 0x3E, 0xE0, 0x56, 0x61, 0x0E, 0x60, 0x06, 0x60, 0x36, 0x67, 0x3E,
+    0xE0, 0xC6, 0x6B, 0xB6, 0xF7, 0x0B, 0xB5, 0xF7, 0x80, 0x00, 0xE6, 0x26, 0xEE, 0x03, 0xE6, 0x05,
+    0xE6, 0x0D, 0xE6, 0x17, 0xE7, 0xB0, 0x96, 0x5D, 0xB9, 0x14, 0x0B, 0x17, 0x97, 0x62, 0x02, 0x66,
+    0x11, 0x66, 0x7A, 0xEE, 0x36, 0x6E, 0x00, 0x66, 0x0A, 0xE7, 0x38, 0xFB, 0x67, 0xFF, 0x86, 0x8E,
+    0xE2, 0x1E, 0xFB, 0x88, 0x6F, 0xCA, 0xC2, 0x08, 0xE6, 0x04, 0x66, 0x0F, 0xE6, 0x03, 0x66, 0x23,
+    0xE6, 0x1A, 0x6F, 0x78, 0xB3, 0x4E, 0xB8, 0xEE, 0x96, 0xE4, 0xDE, 0xEB, 0x9E, 0xE1, 0xAE, 0xE2,
+    0xE6, 0x60, 0x3E, 0x60, 0x16, 0x60, 0x86, 0x60, 0x2E, 0x7D, 0x8D, 0x96, 0x4E, 0xCE, 0x05, 0xE7,
+    0x08, 0xEB, 0xDA, 0xA7, 0x48, 0xDE, 0x93, 0x9B, 0xB6, 0x54, 0x03, 0xCD, 0x1B, 0xDE, 0x41, 0x54,
+    0xAF, 0x5D, 0x96, 0xDD, 0xCA, 0xDD, 0xF5, 0x1E, 0xDF, 0x9C, 0x30, 0xC8, 0xDF, 0x6C, 0x11, 0xE5,
+    0xB0, 0xA7, 0x48, 0xF3, 0xEE, 0x26, 0xE1, 0x56, 0x62, 0x3E, 0x80, 0x16, 0xC0, 0xC6, 0x64, 0xFE,
+    0xE2, 0x26, 0x68, 0xD6, 0xE0, 0x1E, 0x6F, 0xAE, 0xEC, 0x26, 0xE0, 0x56, 0x66, 0xA6, 0x62, 0xE6,
+    0x66, 0x9F, 0x60, 0x3E, 0x73, 0x8E, 0x06, 0x23, 0xD4, 0xFE, 0xEE, 0x07, 0x66, 0x05, 0x66, 0x78,
+    0x6E, 0x9C, 0xEE, 0x3B, 0x6E, 0x01, 0xE6, 0x3A, 0xE6, 0x04, 0x66, 0xFD, 0x6E, 0x00, 0x66, 0x5E,
+    0x6E, 0x53, 0x6E, 0xD5, 0x6E, 0x71, 0x6F, 0x58, 0x9C, 0x70, 0x5E, 0x6D, 0x01, 0x9D, 0xC4, 0xEC,
+    0xC0, 0xAC, 0xD1, 0x2D, 0x02, 0x9C, 0x87, 0x5D, 0xD0, 0x0D, 0xC1, 0x3C, 0xC0, 0x3C, 0xC1, 0x2D,
+    0xD0, 0x5D, 0xC3, 0x5C, 0xED, 0x1B, 0x6C, 0x2E, 0x78, 0x16, 0xDC, 0x37, 0xDD, 0x12, 0xDC, 0x0D,
+    0xCC, 0x18, 0xCC, 0x13, 0xCC, 0x1B, 0xCC, 0x09, 0xCC, 0x32, 0xCC, 0x08, 0xCD, 0x09, 0xDD, 0x4F,
+    0xDC, 0x01, 0xCC, 0x31, 0xCC, 0x18, 0xCD, 0xFE, 0xDC, 0x03, 0xDC, 0x0B, 0xCC, 0x53, 0xCC, 0x78,
+    0xEC, 0x65, 0xDC, 0x09, 0xCD, 0xE6, 0xDE, 0x91, 0x26, 0xA6, 0x34, 0x1A, 0x08, 0x99, 0x81, 0x19,
+    0x81, 0x3A, 0x00, 0x79, 0x19, 0x9B, 0xB9, 0x5B, 0x8B, 0x99, 0xAE, 0x9B, 0x81, 0x19, 0xB4, 0xBB,
+    0x80, 0xF9, 0x80, 0x19, 0x80, 0xF9, 0x80, 0x99, 0x88, 0xFB, 0xB8, 0x9B, 0x88, 0x3B, 0xBE, 0x9A,
+    0x24, 0xDB, 0x15, 0xBB, 0xC6, 0x36, 0x7A, 0xF8, 0x80, 0x7F, 0xBB, 0xC5, 0xB8, 0x19, 0x9A, 0x21,
+    0xB8, 0x01, 0x98, 0x57, 0xB8, 0x81, 0xBB, 0xAD, 0xA1, 0x1F, 0xB0, 0xBD, 0x98, 0x33, 0x9B, 0xA7,
+    0xB8, 0x4B, 0x98, 0x43, 0x9C, 0xA2, 0xE3, 0xC3, 0x87, 0x82, 0x79, 0x86, 0x5A, 0x58, 0x39, 0x99,
+    0xE0, 0x1F, 0x30, 0xBB, 0x30, 0x23, 0x32, 0x43, 0x70, 0x93, 0x30, 0x67, 0x31, 0x4B, 0x70, 0x9B,
+    0x30, 0x1B, 0x37, 0xB3, 0x7F, 0x44, 0x3E, 0xCF, 0xB3, 0x0C, 0xF3, 0x4B, 0xB7, 0x50, 0x37, 0x07,
+    0xF3, 0x03, 0x72, 0x9D, 0x84, 0xB9, 0xE2, 0x21, 0x5F, 0x8A, 0xA9, 0x2F, 0xBC, 0x22, 0x93, 0x47,
+    0x9D, 0x01, 0xF9, 0x87, 0x39, 0xFC, 0x32, 0xD1, 0xF8, 0x1C, 0x42, 0x59, 0xFC, 0xE4, 0x85, 0x7B,
+    0x94, 0x5B, 0x83, 0xF9, 0x82, 0x79, 0xDC, 0x2B, 0x30, 0x3C, 0x90, 0xBF, 0x9F, 0xC3, 0xE1, 0x08,
+    0x8D, 0x01, 0x99, 0x80, 0x59, 0x9A, 0xFA, 0x00, 0xD9, 0xEF, 0xF8, 0xF9, 0xC0, 0x97, 0x30, 0x73,
+    0x30, 0x2F, 0x30, 0x83, 0x30, 0x03, 0x30, 0x67, 0x33, 0x03, 0x75, 0xF7, 0x7A, 0x45, 0x0A, 0xC5,
+    0xC7, 0x29, 0x37, 0x27, 0x77, 0x13, 0x77, 0x05, 0xF4, 0xB2, 0x62, 0xAF, 0xC5, 0xE6, 0xEA, 0x3E,
+    0xE0, 0x86, 0x60, 0x3E, 0x60, 0x1E, 0x62, 0xE6, 0xE1, 0x66, 0x68, 0x6E, 0xE9, 0xEE, 0xE0, 0xE6,
+    0x60, 0x2E, 0x61, 0x76, 0x7C, 0x0C, 0x65, 0x9B, 0x28, 0x02, 0xE6, 0x01, 0xE7, 0xB8, 0x86, 0xF5,
+    0x43, 0x2D, 0x28, 0x14, 0xDC, 0x77, 0x3C, 0x87, 0xCD, 0x41, 0xDC, 0x47, 0xCC, 0x22, 0xCC, 0xE4,
+    0xDC, 0x47, 0xCC, 0x02, 0xCC, 0xF5, 0xDC, 0x01, 0xCC, 0x1B, 0xCC, 0x36, 0xCE, 0x91, 0x38, 0xFD,
+    0xDF, 0x4E, 0x3D, 0xC4, 0x8D, 0xC1, 0x7C, 0xC0, 0x1C, 0xC0, 0x8C, 0xE5, 0x1C, 0x89, 0x5E, 0xDC,
+    0x03, 0xCC, 0x06, 0xCC, 0x16, 0xCC, 0x00, 0xCC, 0x7D, 0xDE, 0x51, 0x44, 0x95, 0xC5, 0x80, 0x6C,
+    0xC3, 0x7C, 0xC1, 0x9C, 0xDF, 0xDD, 0xD7, 0x2D, 0xC1, 0x5C, 0xC0, 0x7D, 0xC0, 0xCC, 0xC3, 0x4C,
+    0xC1, 0x9C, 0xC0, 0x3C, 0xC7, 0x2D, 0xC0, 0x7C, 0xD3, 0x0D, 0x2B, 0xBE, 0x9C, 0x7B, 0xC9, 0xBD,
+    0x43, 0x9B, 0xE2, 0xDC, 0x85, 0x39, 0x84, 0xF9, 0x85, 0xDB, 0xE2, 0x3B, 0x7C, 0x6D, 0xDA, 0xC5,
+    0xB9, 0x6B, 0xBA, 0x3F, 0xB8, 0x27, 0x98, 0xFD, 0xB8, 0xC9, 0xB9, 0x9D, 0xB9, 0x6F, 0xB8, 0x93,
+    0x98, 0x15, 0x98, 0xD7, 0xB8, 0x3D, 0x9F, 0x43, 0x1F, 0xBA, 0x82, 0xFC, 0x23, 0x75, 0x4E, 0xE1,
+    0x95, 0xB8, 0x21, 0x99, 0x71, 0xB8, 0x57, 0x98, 0x63, 0x98, 0x09, 0x9F, 0xC2, 0x77, 0x29, 0x9D,
+    0x82, 0xB9, 0xC2, 0x23, 0x9B, 0x1A, 0x5C, 0x42, 0x55, 0x35, 0xB7, 0x01, 0xF9, 0xEA, 0x32, 0xD3,
+    0xB9, 0x50, 0x19, 0x9E, 0xC3, 0x17, 0xD9, 0xAD, 0x03, 0x59, 0x81, 0xB9, 0xF0, 0x28, 0xDB, 0x4B,
+    0x00, 0x31, 0x9C, 0x03, 0xF1, 0xF3, 0xD2, 0x9B, 0x9B, 0x83, 0x79, 0x82, 0xF9, 0x96, 0xDB, 0x89,
+    0x19, 0xE8, 0x22, 0xB4, 0xBA, 0xE0, 0x1D, 0x98, 0x19, 0x98, 0x4B, 0x98, 0x05, 0x9C, 0x10, 0x2E,
+    0xC8, 0x7A, 0xCD, 0x8B, 0xDE, 0x71, 0x84, 0xBD, 0x62, 0x03, 0x5C, 0xC2, 0x2D, 0xC1, 0x2C, 0xC3,
+    0xFC, 0xC7, 0x9D, 0xC9, 0x2D, 0xE2, 0x18, 0x59, 0xAE, 0x34, 0xCA, 0xDC, 0x16, 0xCC, 0x1F, 0xCD,
+    0xFA, 0xD0, 0x00, 0xCB, 0x71, 0xA5, 0xF4, 0x6A, 0x80, 0x4C, 0xE4, 0x17, 0xCB, 0x0D, 0xD4, 0x4A,
+    0xCC, 0x53, 0xCC, 0x07, 0xCC, 0x0A, 0xCC, 0x80, 0xCD, 0x55, 0xD3, 0x03, 0xA0, 0x50, 0xF4, 0xF0,
+    0x5C, 0x21, 0x36, 0x20, 0x07, 0x31, 0x43, 0x33, 0x9B, 0x70, 0x7F, 0x31, 0x33, 0x70, 0x97, 0x42,
+    0xD3, 0x60, 0xDB, 0x31, 0x93, 0x40, 0x4F, 0x22, 0x57, 0x70, 0x17, 0x30, 0x63, 0x7C, 0xC6, 0x9E,
+    0xFD, 0x75, 0x03, 0x37, 0x0B, 0x77, 0x1A, 0xF7, 0x00, 0xB3, 0x5F, 0x77, 0xF4, 0x75, 0xE5, 0x77,
+    0x20, 0xA7, 0x30, 0x6B, 0x39, 0x84, 0x43, 0xDB, 0x39, 0x12, 0x73, 0x0D, 0xF7, 0x37, 0x77, 0x98,
+    0x5C, 0x6D, 0xD0, 0x71, 0xBF, 0x3A, 0x07, 0x57, 0x4F, 0x21, 0x01, 0x73, 0x07, 0xB3, 0x0B, 0xB7,
+    0x0D, 0xB3, 0x00, 0xF3, 0x75, 0xF7, 0x00, 0xF3, 0x03, 0x33, 0x02, 0x73, 0x06, 0x33, 0x94, 0x75,
+    0x62, 0x7D, 0x30, 0x17, 0x30, 0xAF, 0x74, 0xAB, 0x70, 0xD7, 0x34, 0x87, 0x70, 0x07, 0x30, 0x9B,
+    0x31, 0x83, 0x34, 0xFF, 0x70, 0x67, 0x70, 0x2F, 0x30, 0x0F, 0x38, 0x86, 0x57, 0x61, 0xBC, 0x00,
+    0xF3, 0x31, 0xF7, 0x03, 0x73, 0xC4, 0x6C, 0xB8, 0x7B, 0xC3, 0x47, 0xB0, 0x57, 0x31, 0x93, 0x3C,
+    0x84, 0xBB, 0x87, 0xEC, 0x8C, 0x4A, 0x67, 0x9A, 0xB0, 0x8B, 0x30, 0x17, 0x30, 0xD3, 0x3D, 0x84,
+    0xFB, 0x9D, 0x4A, 0x08, 0xF3, 0x03, 0xB3, 0x04, 0x73, 0x80, 0x46, 0xB7, 0x3C, 0x20, 0x0F, 0x30,
+    0xC7, 0x71, 0x43, 0x70, 0x1F, 0x30, 0x0B, 0x3B, 0x85, 0x63, 0x29, 0xDC, 0x18, 0x33, 0x17, 0xB3,
+    0x21, 0xF3, 0x0A, 0x33, 0x04, 0x73, 0x90, 0x61, 0x7F, 0xF9, 0x82, 0x47, 0x30, 0x0F, 0x30, 0x17,
+    0x3F, 0xD4, 0x4F, 0x16, 0xFD, 0x68, 0xEC, 0xEF, 0x00, 0xF9, 0x61, 0x64, 0xA3, 0xB6, 0xE5, 0xFE,
+    0xE4, 0xBE, 0xFB, 0x09, 0x15, 0xA7, 0x56, 0xFD, 0xE8, 0x02, 0x64, 0x6C, 0xEE, 0x7E, 0x6E, 0x03,
+    0xE6, 0x05, 0xE6, 0x3A, 0x6F, 0x50, 0xAB, 0xE5, 0x91, 0xFD, 0x04, 0x3C, 0xC0, 0xFC, 0xE2, 0x1C,
+    0x8F, 0x1F, 0x0E, 0xC1, 0x39, 0xE9, 0xF9, 0x80, 0x9C, 0xFA, 0x1C, 0xBD, 0x0D, 0x70, 0x1B, 0xCC,
+    0x50, 0xCC, 0x00, 0xCC, 0xC8, 0xDF, 0x71, 0x67, 0xA3, 0x54, 0xEC, 0x12, 0x4C, 0xA5, 0xA4, 0x30,
+    0xDC, 0xE1, 0xEC, 0x23, 0xE0, 0x53, 0xC8, 0x02, 0xDC, 0x4B, 0xCC, 0x83, 0xCD, 0xA7, 0xDC, 0x54,
+    0xCC, 0x02, 0xCC, 0x36, 0xCC, 0x45, 0xDC, 0x16, 0xCC, 0x1A, 0xCC, 0x20, 0xCC, 0x29, 0xCC, 0x2C,
+    0xCD, 0xDD, 0xDC, 0xC4, 0xDF, 0xD1, 0xC2, 0xC7, 0x62, 0x84, 0xED, 0xEE, 0x10, 0x0A, 0x07, 0x30,
+    0x5D, 0xCC, 0x0C, 0xCC, 0x25, 0xDC, 0x03, 0xCF, 0x61, 0xE3, 0xA2, 0x73, 0x01, 0x0C, 0xC1, 0xCC,
+    0xDE, 0xCE, 0xC0, 0x2C, 0xC0, 0x7C, 0xC8, 0x4D, 0xED, 0x12, 0x19, 0x44, 0x80, 0x23, 0xDD, 0xED,
+    0xDC, 0x11, 0xCC, 0x0E, 0xCC, 0x43, 0xCC, 0x26, 0xCC, 0x0C, 0xCE, 0x91, 0xF9, 0xFB, 0xFE, 0xD6,
+    0xCD, 0xFB, 0x1F, 0xDF, 0x1E, 0xC0, 0x0F, 0xCD, 0x79, 0xDC, 0x00, 0xCF, 0xC1, 0xD3, 0x94, 0x63,
+    0x81, 0x1C, 0xC2, 0x5C, 0xD2, 0xAD, 0x09, 0xDD, 0x81, 0xDC, 0xC0, 0x1C, 0xFA, 0x15, 0x89, 0x4C,
+    0x75, 0x88, 0xDC, 0x15, 0xCC, 0x18, 0xCC, 0x42, 0xCC, 0x40, 0xD0, 0x0A, 0xC8, 0x60, 0xCC, 0x16,
+    0xCC, 0x39, 0xDD, 0x01, 0xDC, 0x07, 0xCC, 0x0F, 0xCF, 0xC1, 0x60, 0xCB, 0x6F, 0xC4, 0x1C, 0xC3,
+    0x9C, 0xFE, 0x1B, 0x9D, 0x9D, 0x34, 0x89, 0xCC, 0x16, 0xCC, 0x03, 0xCC, 0x3C, 0xCC, 0x16, 0xCC,
+    0x0C, 0xCD, 0xCC, 0xDD, 0x22, 0xDE, 0x61, 0xED, 0xA4, 0xCF, 0x83, 0xDD, 0xC3, 0x2C, 0xC0, 0xCC,
+    0xEF, 0x1C, 0x3A, 0x15, 0x24, 0x16, 0xCC, 0x0B, 0xCF, 0x01, 0xDF, 0x94, 0x50, 0x4A, 0x8D, 0xDC,
+    0x7D, 0x02, 0x2C, 0x97, 0x2D, 0xC4, 0x9C, 0xC1, 0xFC, 0xC8, 0xCC, 0xFC, 0x15, 0x19, 0x4C, 0x88,
+    0xCC, 0xDD, 0xE3, 0xDC, 0x09, 0xCC, 0x04, 0xCF, 0xD1, 0x59, 0xDE, 0xFA, 0x25, 0x17, 0xDC, 0x7C,
+    0xCC, 0x0F, 0xCE, 0xC1, 0x13, 0xC2, 0x6A, 0x15, 0xED, 0xCD, 0xFD, 0xC1, 0x0C, 0xCB, 0xBD, 0xC1,
+    0xCC, 0xC7, 0x4C, 0xC2, 0xFC, 0xD8, 0x0D, 0x00, 0xFC, 0x9E, 0xDD, 0xC0, 0xFC, 0xF4, 0x10, 0xCB,
+    0xCC, 0xA0, 0x06, 0xCC, 0x23, 0xCC, 0x44, 0xCC, 0xBD, 0xDC, 0x94, 0xDC, 0xC6, 0xEC, 0x9C, 0xDC,
+    0x00, 0xCC, 0x03, 0xCE, 0xF1, 0x58, 0xF6, 0x7A, 0xC0, 0x7C, 0xC1, 0x5C, 0xC2, 0x9C, 0xC2, 0x7C,
+    0xC3, 0x6C, 0xE6, 0x1E, 0xFB, 0x0F, 0x98, 0x1F, 0xEC, 0x07, 0xCC, 0x5B, 0xDC, 0xC1, 0xDC, 0x1F,
+    0xCC, 0x01, 0xCC, 0x1E, 0xCD, 0xC6, 0xDC, 0x52, 0xDC, 0x58, 0xDC, 0x55, 0xDC, 0xB3, 0xDC, 0x07,
+    0xCC, 0x10, 0xCC, 0x33, 0xCD, 0x09, 0xDC, 0x01, 0xCC, 0xF9, 0xDC, 0x77, 0xCC, 0xDC, 0xDC, 0x21,
+    0xD3, 0x93, 0x9C, 0xB1, 0x94, 0x3B, 0x83, 0x19, 0x80, 0xF9, 0x86, 0x7B, 0x81, 0x39, 0x81, 0x19,
+    0xAB, 0x5B, 0x8A, 0xDB, 0x98, 0xDB, 0x8A, 0x39, 0xFC, 0x32, 0xB4, 0xAE, 0x69, 0xEF, 0xB8, 0xA9,
+    0x98, 0x3F, 0x98, 0x2D, 0xB8, 0x61, 0xB8, 0x0F, 0x9B, 0x69, 0xA7, 0x32, 0x5C, 0x53, 0x68, 0x0C,
+    0x66, 0x17, 0xE6, 0xC7, 0x6E, 0x0C, 0xE6, 0x02, 0x66, 0x1B, 0x6F, 0x70, 0xB1, 0xCB, 0x7C, 0x6A,
+    0x1E, 0x80, 0xBE, 0x41, 0xF6, 0x60, 0xD6, 0x80, 0x2E, 0x43, 0x86, 0x60, 0x9E, 0x60, 0x66, 0x60,
+    0x56, 0x80, 0x3E, 0x45, 0xAE, 0xED, 0xC6, 0xE0, 0x56, 0x60, 0x46, 0x74, 0x89, 0x94, 0xD6, 0x8C,
+    0x07, 0x66, 0x10, 0x66, 0x76, 0x6F, 0xC0, 0xC2, 0xF0, 0x77, 0x60, 0xDE, 0xEC, 0x0E, 0xE4, 0xBE,
+    0x80, 0x16, 0xC0, 0x9F, 0x61, 0x4E, 0x72, 0x0B, 0xBD, 0x3B, 0x7E, 0xB3, 0x6E, 0x33, 0x67, 0x88,
+    0xC5, 0x49, 0xA0, 0x64, 0x7E, 0xE2, 0x3E, 0xEE, 0x06, 0xE0, 0x4E, 0x60, 0x86, 0x60, 0x2E, 0x60,
+    0xDE, 0x60, 0x26, 0x61, 0x1E, 0x60, 0x6E, 0x60, 0xA6, 0x60, 0x6E, 0x62, 0xCE, 0x60, 0x06, 0x60,
+    0x3E, 0x61, 0x96, 0x6D, 0xBE, 0xE2, 0x76, 0x60, 0x5E, 0x75, 0x8E, 0x0E, 0x56, 0x9C, 0x09, 0xE6,
+    0x02, 0xE6, 0x05, 0xE6, 0x09, 0x66, 0x92, 0x6E, 0x29, 0xE6, 0xF5, 0x6E, 0x30, 0xE6, 0x12, 0x6E,
+    0x06, 0xE6, 0x00, 0x66, 0x5F, 0xE6, 0x0F, 0xE6, 0x42, 0x68, 0x13, 0xE4, 0x0F, 0x67, 0x18, 0xEE,
+    0x42, 0xE3, 0x8D, 0xEE, 0xE8, 0xBE, 0xE0, 0x4E, 0x6D, 0xD6, 0xE4, 0x76, 0xE0, 0xAE, 0x60, 0x06,
+    0x60, 0x46, 0x60, 0x06, 0x60, 0x3E, 0x60, 0x0E, 0x6A, 0xEE, 0xE0, 0x66, 0xF9, 0x8F, 0x4D, 0x86,
+    0xAE, 0x0E, 0xE6, 0x0A, 0x66, 0x00, 0x66, 0x36, 0x6E, 0x1A, 0x66, 0x66, 0x6E, 0x01, 0x66, 0x06,
+    0x66, 0x15, 0xE6, 0x1B, 0x6E, 0x61, 0x6E, 0x0A, 0x66, 0x11, 0x66, 0x2B, 0x66, 0x11, 0x66, 0x00,
+    0x66, 0x34, 0x66, 0x05, 0x66, 0x8A, 0xEE, 0xE1, 0x70, 0x2C, 0x6C, 0x17, 0x6E, 0x0A, 0xE6, 0x08,
+    0x66, 0x0E, 0xE6, 0x17, 0x6E, 0x07, 0xE6, 0x3D, 0xE6, 0x02, 0xE6, 0x03, 0x6E, 0x21, 0x66, 0x1A,
+    0x66, 0x13, 0x66, 0xB7, 0xEE, 0x0D, 0xE6, 0x19, 0x66, 0x0C, 0xE6, 0x04, 0xE6, 0x01, 0x66, 0x00,
+    0x67, 0x60, 0xDC, 0x76, 0xEE, 0x60, 0xCE, 0x60, 0xB6, 0x73, 0x0D, 0xD7, 0x73, 0xD6, 0x2E, 0xE6,
+    0xBA, 0xE9, 0x42, 0xAC, 0x45, 0x19, 0x4D, 0xE8, 0x11, 0xAE, 0x76, 0xC8, 0xC1, 0xDC, 0x00, 0xCC,
+    0x2D, 0xDC, 0x16, 0xCE, 0x61, 0xA5, 0xAD, 0xF5, 0xC2, 0xDC, 0xC4, 0xEC, 0xEC, 0x1A, 0x48, 0x56,
+    0x6C, 0x09, 0xCE, 0x21, 0xC1, 0xB9, 0x77, 0x77, 0x1F, 0x4A, 0x04, 0xBC, 0x1D, 0xCC, 0x12, 0xCC,
+    0x73, 0xCC, 0x34, 0xCC, 0x39, 0xCC, 0x0D, 0xDC, 0x7D, 0xDC, 0xC6, 0xD0, 0x1F, 0xC8, 0x09, 0xCF,
+    0xA1, 0x5A, 0x91, 0x5D, 0xC1, 0x7C, 0xD0, 0x7D, 0xD0, 0xAD, 0xC1, 0x4C, 0xCB, 0xDD, 0xC0, 0xCC,
+    0xC9, 0xDD, 0xC2, 0xCC, 0xC3, 0x9C, 0xC1, 0x9C, 0xD9, 0x9D, 0xC3, 0xCD, 0xC8, 0x5C, 0xDB, 0x4D,
+    0xC2, 0x7C, 0xEC, 0x19, 0x1A, 0xDE, 0x14, 0x60, 0xDE, 0xD1, 0x58, 0x92, 0xCD, 0x04, 0x9C, 0xC0,
+    0x5C, 0xD2, 0x5D, 0xDB, 0x6D, 0xC0, 0x7C, 0xC1, 0xAC, 0xC9, 0x5D, 0x29, 0x1A, 0x5B, 0x5A, 0x19,
+    0xB9, 0x57, 0x98, 0x17, 0x98, 0x35, 0x9A, 0x59, 0xB8, 0x67, 0x9C, 0xE2, 0x1D, 0x38, 0xF2, 0x06,
+    0xF9, 0x8F, 0x9B, 0xB2, 0xFB, 0x83, 0xB9, 0xB1, 0x7B, 0x80, 0xB9, 0x82, 0x79, 0xAA, 0xFB, 0xA5,
+    0xBB, 0x80, 0x99, 0x81, 0xD9, 0x80, 0x39, 0xD8, 0x24, 0x7B, 0x0E, 0x08, 0x53, 0xA7, 0x13, 0xC9,
+    0xFB, 0x03, 0xF3, 0x1C, 0x33, 0x02, 0xF3, 0x0D, 0xF3, 0xD0, 0x76, 0xE6, 0xF6, 0x00, 0x6F, 0x31,
+    0xF3, 0x42, 0xD7, 0x60, 0x9F, 0x4D, 0xFC, 0x1A, 0xBA, 0xB3, 0x68, 0xE0, 0xE7, 0x27, 0xBA, 0x57,
+    0x41, 0xAC, 0xFD, 0x17, 0x0E, 0x2F, 0x18, 0x06, 0xCC, 0x04, 0xCF, 0xA1, 0xE9, 0xE5, 0xDC, 0xA5,
+    0x12, 0xBE, 0x67, 0xC4, 0x1A, 0xCC, 0x1D, 0xCC, 0x47, 0xCD, 0xB2, 0xDC, 0x0D, 0xCC, 0xE5, 0xDC,
+    0x7C, 0xDD, 0x9A, 0xDC, 0x49, 0xDC, 0x39, 0xCC, 0x50, 0xCC, 0x81, 0xDC, 0xFF, 0xD2, 0x0F, 0x3A,
+    0x98, 0x9C, 0xBB, 0x82, 0x99, 0x80, 0x59, 0x8A, 0x3B, 0x8E, 0x7B, 0x82, 0x99, 0x88, 0x1A, 0x05,
+    0x59, 0x0A, 0xFB, 0xC4, 0x25, 0xF4, 0x94, 0xDB, 0x80, 0xD7, 0x30, 0x67, 0x30, 0x2B, 0x31, 0x57,
+    0x31, 0x03, 0x30, 0x5F, 0x35, 0x5B, 0x40, 0x33, 0x2D, 0xC4, 0x77, 0x5F, 0xE4, 0x03, 0xF3, 0x07,
+    0xB3, 0x00, 0x33, 0x2C, 0xF7, 0x03, 0x33, 0x08, 0xB3, 0x65, 0xF7, 0x0B, 0x77, 0x05, 0x33, 0x02,
+    0x33, 0x04, 0xB3, 0x02, 0xF3, 0x6A, 0x37, 0x13, 0x33, 0x12, 0xB3, 0x3E, 0xB7, 0x1F, 0x37, 0x03,
+    0x73, 0x18, 0x77, 0x0B, 0xF7, 0x02, 0x33, 0x02, 0xB3, 0x2A, 0x73, 0xA0, 0x4B, 0xBE, 0xD5, 0xB0,
+    0xC3, 0x31, 0xD3, 0x30, 0xE7, 0x3D, 0x07, 0x8E, 0x41, 0x8A, 0x06, 0x33, 0x03, 0x33, 0x0C, 0xF3,
+    0x01, 0xB3, 0x08, 0x73, 0x06, 0x33, 0x07, 0x33, 0x0E, 0x37, 0x07, 0x73, 0x61, 0xB7, 0x0C, 0xB3,
+    0x0C, 0x33, 0x05, 0x33, 0x3B, 0x77, 0x03, 0xF3, 0x42, 0x37, 0x04, 0x33, 0x03, 0x37, 0x02, 0x33,
+    0x6D, 0xF7, 0x2D, 0xB7, 0x19, 0xF7, 0x5B, 0xB7, 0x60, 0x77, 0xF4, 0x55, 0xAB, 0x1C, 0x00, 0x43,
+    0x30, 0xA7, 0x30, 0x37, 0x3A, 0x46, 0x4A, 0xE7, 0x92, 0x00, 0xB3, 0x53, 0xF7, 0x0F, 0x33, 0x07,
+    0xB3, 0x15, 0xB3, 0x37, 0x37, 0x0D, 0xF3, 0x66, 0x77, 0x06, 0xB7, 0xDC, 0x68, 0x3E, 0xF8, 0x5A,
+    0x46, 0x47, 0xE7, 0x4D, 0x09, 0x73, 0xF0, 0x44, 0x77, 0xD5, 0x63, 0x93, 0xB7, 0x3B, 0x73, 0xBF,
+    0x70, 0xBF, 0x76, 0x13, 0x70, 0xA3, 0x39, 0xC6, 0xA3, 0x75, 0xEB, 0x00, 0xB3, 0x03, 0x33, 0xD4,
+    0x4E, 0xAA, 0x56, 0x02, 0x97, 0x76, 0x4F, 0x70, 0xFB, 0x70, 0xAB, 0x39, 0x87, 0x62, 0x6F, 0x77,
+    0x94, 0x56, 0xE0, 0x50, 0xA0, 0x57, 0x3D, 0x86, 0x22, 0xF9, 0xFE, 0x04, 0xB3, 0x06, 0xF3, 0x77,
+    0x37, 0x06, 0xB3, 0x00, 0xF3, 0x0A, 0x33, 0x6D, 0xB7, 0x02, 0xB3, 0x15, 0xB7, 0x08, 0x73, 0x04,
+    0xB3, 0x01, 0xB3, 0x0C, 0xB3, 0x3F, 0x3B, 0x08, 0x33, 0x14, 0xB3, 0x50, 0xF7, 0x0D, 0xB3, 0x67,
+    0x77, 0x0A, 0xB7, 0x03, 0x73, 0x0D, 0xF7, 0x19, 0xF7, 0x30, 0x77, 0x70, 0x77, 0xDC, 0x70, 0xB5,
+    0x56, 0x00, 0x2F, 0x30, 0x9B, 0x30, 0xFF, 0x4C, 0xA4, 0xAE, 0xFA, 0x2F, 0xE6, 0x14, 0x66, 0x09,
+    0x66, 0x98, 0xEE, 0xBE, 0xEE, 0x06, 0xE6, 0xCD, 0xEE, 0xDD, 0x6E, 0x7E, 0x6E, 0x2E, 0xE6, 0x13,
+    0xE6, 0x02, 0x67, 0x80, 0xD4, 0xC9, 0xF8, 0x82, 0x36, 0x64, 0xE6, 0xE0, 0x86, 0x60, 0x9E, 0x65,
+    0x46, 0xE0, 0x86, 0x60, 0xC6, 0x60, 0x66, 0x67, 0xC6, 0xE8, 0x66, 0xEB, 0xFE, 0xE0, 0x26, 0x60,
+    0x56, 0x75, 0x89, 0xB5, 0x2B, 0xC5, 0x18, 0xF3, 0xEB, 0x66, 0x8D, 0x56, 0xF1, 0x0D, 0xCE, 0x93,
+    0xB4, 0x0C, 0xE6, 0xE1, 0x6F, 0xD0, 0xF0, 0xEC, 0x27, 0x8E, 0x4E, 0xF3, 0x0B, 0x7E, 0x43, 0xA2,
+    0x46, 0x6E, 0x07, 0x67, 0x08, 0xE7, 0xEE, 0x3D, 0x20, 0x0E, 0x60, 0xAE, 0x60, 0xF6, 0x60, 0xEE,
+    0x65, 0x9E, 0xE5, 0xA6, 0xE1, 0xC6, 0x60, 0x46, 0x63, 0xE6, 0xE0, 0x8E, 0x61, 0xB6, 0x60, 0xA6,
+    0x60, 0x66, 0x60, 0xCE, 0x7C, 0x88, 0x64, 0x8F, 0x6E, 0x01, 0xE6, 0x19, 0xE6, 0xB0, 0x6F, 0x48,
+    0xAE, 0x75, 0x3F, 0xA6, 0x1E, 0xF6, 0x0F, 0xC4, 0x1B, 0x96, 0x07, 0xE6, 0x03, 0x66, 0x98, 0x6E,
+    0x05, 0xE6, 0x0B, 0xE6, 0x47, 0xEE, 0x36, 0x6E, 0x17, 0x67, 0x80, 0xA2, 0x7F, 0x20, 0xA1, 0x0E,
+    0x63, 0xD6, 0xFE, 0x0A, 0x56, 0x00, 0x44, 0xD0, 0x3C, 0xCD, 0x2C, 0xDC, 0x00, 0xCC, 0x46, 0xCC,
+    0x6B, 0xED, 0x38, 0xDC, 0x0C, 0xCC, 0x20, 0xCC, 0x61, 0xDC, 0x66, 0xCC, 0x9E, 0xCC, 0x09, 0xCC,
+    0x5A, 0xCC, 0xB5, 0xED, 0xD9, 0xDC, 0x27, 0xCC, 0x24, 0xCC, 0x09, 0xCC, 0x0F, 0xCD, 0x38, 0xDC,
+    0x2B, 0xCC, 0x00, 0xCC, 0xE9, 0xDC, 0x28, 0xCC, 0x02, 0xD1, 0xA7, 0xD8, 0xA7, 0xDE, 0xC1, 0x06,
+    0xC3, 0x60, 0xD8, 0x9D, 0xDE, 0xFD, 0xD2, 0x2D, 0xF8, 0x1C, 0x78, 0x6E, 0x6C, 0x82, 0xDC, 0x2D,
+    0xCE, 0xE1, 0xA4, 0xBC, 0xE7, 0x94, 0x1D, 0xC0, 0x3C, 0xFA, 0x1A, 0x3F, 0xBC, 0xA8, 0x5D, 0xDD,
+    0xDD, 0xDF, 0x81, 0x36, 0xF3, 0x4D, 0x41, 0xAC, 0xD9, 0x8D, 0xC0, 0x7C, 0xD7, 0xBE, 0xC2, 0x9D,
+    0xD4, 0x9D, 0xC0, 0xCC, 0xC2, 0x1C, 0xC2, 0xDC, 0xC0, 0xDC, 0xC3, 0xED, 0xE1, 0x19, 0xC9, 0x44,
+    0x14, 0xA7, 0xEC, 0x9C, 0xDC, 0x6E, 0xCC, 0x9B, 0xDD, 0x53, 0xDC, 0x15, 0xCC, 0x01, 0xCE, 0x11,
+    0xBC, 0xB3, 0xEB, 0x01, 0x9C, 0xFD, 0x16, 0xA8, 0xAF, 0xB8, 0x46, 0xCF, 0x81, 0x1D, 0x86, 0x73,
+    0x4C, 0xFD, 0xC0, 0xEC, 0xC1, 0x3D, 0xC0, 0x6C, 0xEF, 0x17, 0xBB, 0xB6, 0x6B, 0x7F, 0xBE, 0xA1,
+    0x34, 0xDA, 0x1C, 0x9B, 0x93, 0xB9, 0x82, 0xB9, 0xDC, 0x3F, 0xF3, 0x29, 0x20, 0x07, 0x9B, 0x03,
+    0xB8, 0x0F, 0x98, 0x31, 0x9D, 0x23, 0x7F, 0xA9, 0xA1, 0xDA, 0x25, 0x15, 0x07, 0x07, 0x40, 0x8F,
+    0x70, 0x4B, 0x33, 0x0B, 0x70, 0xBF, 0x34, 0x0B, 0x70, 0x9B, 0x30, 0xF3, 0x4C, 0xD4, 0x0A, 0x90,
+    0xEB, 0x69, 0xB5, 0xF1, 0xDD, 0x01, 0xAC, 0xC0, 0xEC, 0xC6, 0xBC, 0xD8, 0xAD, 0xD5, 0x4D, 0xC0,
+    0x0C, 0xC0, 0x6C, 0xCC, 0x7D, 0xC7, 0x8D, 0xC0, 0x7C, 0xC1, 0x5C, 0xC4, 0x8C, 0xC4, 0xEC, 0xC5,
+    0x4C, 0xC1, 0x8C, 0xC3, 0xCD, 0xC4, 0x2C, 0xC4, 0x7C, 0xC5, 0x2C, 0xC0, 0x1C, 0xC1, 0x5C, 0xC0,
+    0xCC, 0xF7, 0x1D, 0x2B, 0x0E, 0x44, 0x03, 0xCC, 0x12, 0xCC, 0x2F, 0xDC, 0x03, 0xCC, 0x18, 0xDC,
+    0x9F, 0xDF, 0x31, 0xE2, 0xD6, 0x76, 0x82, 0x1C, 0xC1, 0x6C, 0xF7, 0x16, 0x4E, 0xD2, 0x0F, 0xA4,
+    0x42, 0x29, 0x27, 0xF4, 0x1C, 0x3B, 0x81, 0xB9, 0xB0, 0x5A, 0x00, 0x39, 0x23, 0x7D, 0xB5, 0x3B,
+    0xE6, 0x2C, 0x36, 0x39, 0x9C, 0xC3, 0x11, 0x59, 0xDA, 0x98, 0x1B, 0x81, 0xB9, 0x88, 0xD9, 0x9E,
+    0x1A, 0x7F, 0x24, 0xF7, 0xF0, 0xAF, 0x30, 0x1B, 0x32, 0x23, 0x40, 0x33, 0x2B, 0x06, 0x63, 0xEF,
+    0x51, 0x72, 0xFB, 0xA8, 0x75, 0xF6, 0x32, 0x40, 0x0F, 0x39, 0x84, 0x5B, 0x73, 0x34, 0x00, 0xF3,
+    0x00, 0x33, 0xBC, 0x7B, 0xA2, 0xF9, 0x30, 0x8F, 0x30, 0xA3, 0x30, 0x83, 0x70, 0x97, 0x30, 0x77,
+    0x3E, 0xC4, 0x4E, 0xCD, 0xC2, 0x11, 0x73, 0xAC, 0x45, 0x64, 0xD3, 0xD0, 0x13, 0x75, 0x2B, 0x70,
+    0x83, 0x71, 0xE3, 0x32, 0xFB, 0x77, 0x27, 0x70, 0x1B, 0x30, 0x2F, 0x30, 0x53, 0x31, 0x13, 0x32,
+    0x57, 0x76, 0xCB, 0x77, 0xEB, 0x71, 0xCF, 0x7F, 0xC4, 0x3F, 0xFF, 0x06, 0xBC, 0x7C, 0xE1, 0xF0,
+    0x7E, 0x45, 0xDA, 0xE3, 0xD5, 0x02, 0xB3, 0x17, 0x33, 0x2C, 0x77, 0x05, 0xB3, 0x74, 0xF7, 0x0A,
+    0x73, 0x0B, 0x33, 0x0F, 0x73, 0x06, 0x73, 0x00, 0x73, 0x8C, 0x42, 0xEA, 0x99, 0x00, 0x5B, 0x33,
+    0x6F, 0x71, 0x73, 0x30, 0x2F, 0x39, 0x87, 0x1F, 0xCD, 0xBA, 0x98, 0x4C, 0x23, 0xD2, 0x20, 0x4F,
+    0x30, 0x33, 0x30, 0x6F, 0x30, 0x8B, 0x30, 0x07, 0x71, 0x5B, 0x75, 0x8F, 0x70, 0x33, 0x38, 0x47,
+    0x5E, 0xD3, 0x44, 0x09, 0x33, 0x07, 0x33, 0x47, 0x77, 0x9C, 0x7B, 0xAF, 0xF7, 0xE0, 0x2F, 0x31,
+    0xDB, 0x70, 0x1F, 0x3F, 0x45, 0xDE, 0x1B, 0x2C, 0xC8, 0x79, 0x3E, 0xDD, 0xC0, 0x7F, 0x3C, 0x84,
+    0x0E, 0xC5, 0x5E, 0xCC, 0x67, 0xE2, 0x3D, 0xC3, 0xA7, 0x71, 0x1F, 0x3B, 0x85, 0x6E, 0xF5, 0x23,
+    0x00, 0xB3, 0x27, 0xB3, 0x80, 0x60, 0xB2, 0x75, 0x44, 0x6B, 0x7A, 0x07, 0x12, 0x27, 0x57, 0x00,
+    0x73, 0x13, 0xB7, 0xC4, 0x74, 0xE4, 0xDE, 0x70, 0x7F, 0x38, 0x06, 0x92, 0x85, 0x0A, 0x0E, 0xF3,
+    0x0A, 0xB3, 0x12, 0x33, 0x03, 0xB3, 0x36, 0x34, 0xFD, 0xD4, 0xA1, 0xA1, 0x4E, 0x61, 0xB6, 0x69,
+    0xD6, 0xEF, 0xFE, 0xE8, 0xB7, 0x64, 0xDE, 0xE0, 0x06, 0x66, 0x16, 0x64, 0x86, 0x60, 0x5E, 0x7B,
+    0x0C, 0x96, 0xB6, 0x88, 0x0D, 0xE7, 0xA8, 0x9E, 0x7A, 0xB0, 0x47, 0xEE, 0xE2, 0x86, 0x6F, 0xEE,
+    0xE0, 0x9E, 0x60, 0xEE, 0xF6, 0x08, 0xFD, 0x5E, 0x94, 0x43, 0x66, 0x03, 0x66, 0x08, 0xE6, 0x23,
+    0x66, 0x01, 0x66, 0x00, 0xE7, 0x60, 0xC0, 0xF4, 0xA8, 0x28, 0xCF, 0x60, 0x86, 0x65, 0x8E, 0x71,
+    0x8F, 0xAE, 0xE3, 0xAE, 0x04, 0x66, 0x0A, 0xE6, 0x23, 0xE7, 0xC0, 0xB1, 0x7B, 0xBE, 0x60, 0x5E,
+    0x72, 0x09, 0x1D, 0xBB, 0x48, 0x13, 0x66, 0x10, 0xE6, 0x0B, 0x66, 0x03, 0x66, 0x14, 0xE6, 0x06,
+    0xE6, 0x15, 0x66, 0x08, 0x67, 0xE8, 0xFE, 0x5D, 0x6F, 0x80, 0x36, 0x70, 0x8C, 0x9C, 0xCB, 0xF8,
+    0x10, 0x66, 0xFE, 0xEE, 0x00, 0x66, 0xF5, 0x6E, 0x2D, 0x66, 0x12, 0x66, 0xA7, 0xEE, 0x04, 0xE6,
+    0x00, 0xE6, 0x7F, 0xEE, 0xF7, 0xEE, 0x3E, 0x66, 0x06, 0xE6, 0x26, 0xE6, 0x96, 0x6E, 0x03, 0x66,
+    0x08, 0xE6, 0x0F, 0xF6, 0x21, 0x66, 0x09, 0xE6, 0xBD, 0x6E, 0x19, 0xE6, 0x2B, 0xE6, 0x02, 0x66,
+    0xCB, 0xEE, 0x08, 0x67, 0xB8, 0xE6, 0xC9, 0xE0, 0x97, 0x0E, 0xEE, 0x1A, 0x9E, 0x06, 0xE6, 0x0D,
+    0x66, 0x16, 0x66, 0x80, 0xEE, 0x12, 0x66, 0x60, 0xEE, 0x9C, 0x6E, 0x06, 0xE6, 0xB5, 0x6E, 0x0E,
+    0xE6, 0x28, 0xEE, 0x15, 0xEE, 0x7A, 0x6E, 0x22, 0x66, 0x14, 0xE6, 0x07, 0x66, 0x03, 0x66, 0xC7,
+    0x6E, 0x12, 0xE6, 0x11, 0x66, 0x13, 0xEE, 0x04, 0x66, 0xDF, 0xEE, 0x0B, 0xE6, 0x14, 0x66, 0xD6,
+    0x6E, 0x1A, 0x66, 0x03, 0x66, 0x47, 0xE6, 0x33, 0xEE, 0x2F, 0xE6, 0x3D, 0xE6, 0x2E, 0x6E, 0x07,
+    0xE6, 0x90, 0xE8, 0x0C, 0xE5, 0xBF, 0xC9, 0xD5, 0x25, 0xA1, 0xA6, 0x60, 0x1E, 0x73, 0x8E, 0x14,
+    0xEE, 0x60, 0x0E, 0x6E, 0x11, 0xE6, 0x13, 0x67, 0xE8, 0xC9, 0xF5, 0xBB, 0xA0, 0xE6, 0x7C, 0x89,
+    0x37, 0xC7, 0x9A, 0x0D, 0x67, 0x50, 0x8A, 0x48, 0xAD, 0x82, 0x5E, 0x99, 0x5E, 0x5C, 0x30, 0x16,
+    0xCD, 0x16, 0xD3, 0x3D, 0x42, 0x9C, 0xE1, 0x21, 0xBA, 0x70, 0x6B, 0x40, 0xBF, 0x76, 0xE7, 0x70,
+    0x47, 0x31, 0x4F, 0x70, 0x67, 0x36, 0x53, 0x71, 0x2B, 0x70, 0x0F, 0x31, 0x87, 0x70, 0x83, 0x30,
+    0xA3, 0x30, 0x6F, 0x34, 0xDF, 0x70, 0x1F, 0x75, 0xC7, 0x70, 0x7B, 0x33, 0x47, 0x40, 0x3F, 0x29,
+    0x44, 0x37, 0x0F, 0xC3, 0x57, 0x34, 0xD1, 0x54, 0x3E, 0xA5, 0xA7, 0x15, 0xDB, 0x44, 0x69, 0x17,
+    0xDC, 0x0B, 0xCD, 0x40, 0xDD, 0x9D, 0xDC, 0x67, 0xDC, 0x08, 0xCC, 0x24, 0xCC, 0x54, 0xDF, 0x51,
+    0xB7, 0x8B, 0xD4, 0x81, 0x0C, 0xCB, 0xDD, 0xC0, 0x9C, 0xF6, 0x1F, 0x5C, 0x4E, 0x89, 0x41, 0xDC,
+    0x42, 0xCE, 0x91, 0x99, 0x96, 0x77, 0x42, 0x5C, 0xC5, 0x7C, 0xD6, 0x2D, 0xD8, 0x6E, 0xC8, 0x2C,
+    0xC0, 0x9C, 0xC6, 0xBD, 0xC1, 0xFC, 0xC3, 0x3C, 0xC0, 0xBC, 0xC0, 0xAC, 0xC5, 0x5C, 0xE9, 0x1B,
+    0xDB, 0x15, 0xA0, 0x07, 0xCC, 0x25, 0xCD, 0x62, 0xDC, 0x46, 0xDC, 0x11, 0xCC, 0x0C, 0xCC, 0x2E,
+    0xDC, 0x96, 0xD0, 0x1B, 0xC8, 0x18, 0xCD, 0x35, 0xDC, 0x17, 0xCC, 0x03, 0xCC, 0x2C, 0xCC, 0x16,
+    0xCC, 0x6B, 0xCC, 0x8A, 0xCC, 0x4E, 0xCD, 0x11, 0xDC, 0x19, 0xCC, 0xAE, 0xDD, 0x37, 0xDC, 0x08,
+    0xCC, 0x05, 0xCD, 0x77, 0xD3, 0xAD, 0xA1, 0x6A, 0x74, 0x00, 0xB3, 0x07, 0xB3, 0x00, 0x73, 0x10,
+    0x77, 0x2A, 0x77, 0x17, 0x33, 0x02, 0xF3, 0x04, 0x33, 0x24, 0x73, 0x00, 0xB3, 0x08, 0xF3, 0x08,
+    0x33, 0xB0, 0x5A, 0x7F, 0xB3, 0x78, 0x46, 0x97, 0xEB, 0xC0, 0x08, 0xF7, 0x19, 0x33, 0x00, 0x73,
+    0x13, 0x33, 0x02, 0xB3, 0x35, 0xB7, 0x04, 0x73, 0x5D, 0xB7, 0x00, 0x33, 0x00, 0xB3, 0x06, 0x33,
+    0x84, 0x46, 0xA4, 0xB7, 0xA0, 0x4F, 0x38, 0x86, 0x4E, 0xC7, 0x9B, 0xC8, 0x45, 0x67, 0xBC, 0x90,
+    0x3B, 0x30, 0x2B, 0x3A, 0x44, 0x83, 0x87, 0xA2, 0x08, 0x73, 0x04, 0xF3, 0x00, 0x73, 0x0D, 0x77,
+    0x21, 0x37, 0x14, 0x33, 0xC8, 0x73, 0xEB, 0xB8, 0x41, 0x67, 0x7A, 0xC7, 0xCB, 0x49, 0x98, 0x24,
+    0xB7, 0x40, 0x77, 0x61, 0x77, 0x16, 0xF7, 0x26, 0x77, 0x31, 0xF7, 0xFC, 0x7E, 0xB9, 0x72, 0xF1,
+    0x5B, 0x30, 0x1B, 0x33, 0x83, 0x7B, 0xC6, 0x8F, 0xAD, 0xE0, 0x07, 0x33, 0x03, 0x33, 0x04, 0xF3,
+    0x00, 0x73, 0x06, 0x33, 0x0F, 0xB3, 0x00, 0xF3, 0x01, 0xB3, 0x0B, 0xF3, 0x07, 0x33, 0x45, 0xF7,
+    0x00, 0x73, 0x64, 0xF7, 0x09, 0xF3, 0x3D, 0x77, 0x00, 0xF3, 0x80, 0x70, 0xEF, 0x34, 0xD0, 0x6F,
+    0x34, 0x83, 0x78, 0x87, 0x07, 0x15, 0x3E, 0x61, 0xF7, 0x08, 0x33, 0x01, 0xB3, 0x1E, 0x33, 0x17,
+    0xB3, 0x53, 0x77, 0x04, 0xF3, 0x09, 0x37, 0x00, 0x73, 0x3F, 0x77, 0x02, 0xB3, 0x13, 0x73, 0x8F,
+    0x03, 0x59, 0x5C, 0x37, 0x31, 0xDB, 0xB0, 0x1F, 0x98, 0x59, 0x9B, 0x71, 0xB8, 0xDD, 0xB8, 0x09,
+    0x9C, 0x23, 0x67, 0xCC, 0x8A, 0x28, 0xFB, 0xF6, 0x34, 0x1B, 0x7F, 0x10, 0x03, 0x99, 0x29, 0x9B,
+    0xAD, 0xB8, 0xDF, 0xBE, 0x22, 0x11, 0x32, 0xFC, 0x87, 0x19, 0x91, 0xDB, 0xAE, 0x5B, 0x84, 0xF9,
+    0xA5, 0xDA, 0x7C, 0x20, 0xFA, 0xA0, 0x9B, 0x32, 0x8B, 0x70, 0x8B, 0x30, 0x2F, 0x31, 0x0F, 0x30,
+    0x7F, 0x33, 0x83, 0x7D, 0x05, 0x26, 0xF5, 0x0D, 0x05, 0x33, 0x88, 0x4B, 0xA3, 0x57, 0x34, 0xEB,
+    0x70, 0xCB, 0x30, 0x6F, 0x30, 0x57, 0x33, 0xB7, 0x70, 0x53, 0x30, 0xCB, 0x73, 0x2B, 0x72, 0xD7,
+    0x30, 0x07, 0x30, 0x53, 0x30, 0x5F, 0x33, 0xAB, 0x70, 0x43, 0x37, 0x63, 0x4B, 0x54, 0xE5, 0x8D,
+    0xD0, 0x07, 0xCC, 0x29, 0xCC, 0x1C, 0xCC, 0x28, 0xCC, 0x0F, 0xCC, 0x15, 0xCC, 0x3E, 0xDC, 0x2C,
+    0xCD, 0x86, 0xDC, 0x0F, 0xCD, 0x09, 0xDC, 0x01, 0xCC, 0x0B, 0xCF, 0x11, 0x1E, 0xD3, 0xE6, 0x40,
+    0x8C, 0xC5, 0x7C, 0xF6, 0x1A, 0xCF, 0x84, 0xD0, 0xBD, 0xDC, 0x5A, 0xDC, 0x26, 0xCC, 0x1B, 0xCC,
+    0x10, 0xCC, 0xD6, 0xDC, 0xB1, 0xDC, 0x82, 0xDC, 0xDF, 0xEF, 0xF1, 0xC8, 0x89, 0xEB, 0x01, 0xAC,
+    0xD0, 0x9D, 0xC4, 0x6D, 0xC8, 0x2C, 0xC0, 0x5C, 0xFA, 0x13, 0x3C, 0xEF, 0x50, 0x18, 0xCD, 0xA6,
+    0xDC, 0x15, 0xCC, 0x2F, 0xCC, 0x10, 0xCC, 0xE7, 0xDC, 0x0A, 0xCC, 0x35, 0xCD, 0x6D, 0xDC, 0x27,
+    0xCE, 0x21, 0xC5, 0xF1, 0xDB, 0x26, 0x12, 0x9B, 0xC6, 0x70, 0x83, 0xCD, 0x73, 0xEC, 0x49, 0xCC,
+    0x07, 0xCC, 0x3D, 0xCC, 0x46, 0xCC, 0x01, 0xCC, 0x5C, 0xCC, 0x07, 0xCC, 0x3B, 0xDE, 0x81, 0x7E,
+    0x96, 0xD4, 0xC3, 0xCC, 0xD1, 0xED, 0xC2, 0x1C, 0xC6, 0x8D, 0xC1, 0xDC, 0xC0, 0xFC, 0xC2, 0x2C,
+    0xC5, 0x8D, 0xC9, 0x4D, 0xC0, 0x8C, 0xC2, 0x2D, 0xC1, 0xAC, 0xC0, 0x0C, 0xC0, 0xBC, 0xED, 0x17,
+    0xF9, 0x07, 0x99, 0x64, 0xDD, 0x21, 0xDF, 0x81, 0xA1, 0xFE, 0x59, 0x41, 0x3D, 0xC3, 0xDC, 0xC2,
+    0x4D, 0xEC, 0x11, 0x2A, 0xB5, 0x60, 0x1C, 0xCC, 0x36, 0xDC, 0xEB, 0xDD, 0x20, 0xDC, 0x51, 0xCC,
+    0x00, 0xCC, 0x48, 0xCC, 0x14, 0xCC, 0x42, 0xCC, 0x08, 0xCF, 0xA1, 0x38, 0x85, 0x67, 0x7B, 0x1E,
+    0xE8, 0xD6, 0x62, 0x71, 0x0B, 0xF8, 0x5F, 0x40, 0x3C, 0xD1, 0x7D, 0xE4, 0x10, 0xBB, 0x95, 0xE0,
+    0x24, 0xCD, 0x23, 0xDC, 0x0C, 0xCE, 0x61, 0x7C, 0x8D, 0x5C, 0x03, 0x4C, 0xC1, 0x1C, 0xF6, 0x18,
+    0x1C, 0x26, 0x71, 0x4C, 0xDC, 0x0D, 0xCC, 0x24, 0xCE, 0x81, 0x30, 0xE1, 0xD2, 0x41, 0xCC, 0xC0,
+    0x2C, 0xC9, 0xDC, 0xC3, 0x7C, 0xC1, 0x2C, 0xC0, 0x0C, 0xC4, 0x1D, 0xC0, 0xAC, 0xC2, 0x3C, 0xE6,
+    0x14, 0x4E, 0xFC, 0x7C, 0x35, 0xCC, 0xC1, 0xD0, 0x06, 0xCB, 0x51, 0xDA, 0x8E, 0xE5, 0x10, 0x7D,
+    0xC1, 0xDC, 0xC2, 0x1C, 0xC0, 0x7C, 0xC1, 0xBC, 0xDB, 0xFD, 0x26, 0x7C, 0x29, 0x60, 0x03, 0x98,
+    0x45, 0x98, 0x27, 0x9A, 0xBD, 0xB8, 0x67, 0x99, 0x55, 0xB8, 0x0B, 0x98, 0x53, 0x98, 0x13, 0x98,
+    0xFD, 0x98, 0x11, 0x98, 0x09, 0x98, 0x37, 0x9E, 0xA3, 0x55, 0xE4, 0xA1, 0xFC, 0x3F, 0xF8, 0x98,
+    0x03, 0x83, 0xB8, 0x5D, 0x98, 0x63, 0x98, 0x0F, 0x98, 0x59, 0xBE, 0xC2, 0x79, 0xE9, 0xA5, 0x81,
+    0x59, 0x8A, 0x79, 0xD2, 0x37, 0x7A, 0x28, 0xC1, 0xE7, 0xB8, 0x17, 0x98, 0x11, 0x98, 0xC5, 0xB8,
+    0x57, 0x98, 0x03, 0x98, 0x6D, 0xB8, 0x89, 0xB9, 0xE5, 0xBA, 0x39, 0xB8, 0x8D, 0x99, 0xEB, 0xB8,
+    0x2B, 0x98, 0x15, 0x98, 0xE3, 0x98, 0x09, 0x98, 0x01, 0x98, 0x41, 0x9E, 0xC3, 0x71, 0x9E, 0xEC,
+    0x81, 0x39, 0xB8, 0x7D, 0xA6, 0x3D, 0xDA, 0x20, 0x19, 0xEB, 0x20, 0x15, 0x98, 0x05, 0x98, 0x17,
+    0x9D, 0x03, 0x51, 0x27, 0x91, 0xA7, 0xDB, 0x83, 0x59, 0xBC, 0xBB, 0x82, 0x19, 0xC6, 0x20, 0x3F,
+    0x1C, 0x11, 0x21, 0x9F, 0xE3, 0xF1, 0x12, 0xCC, 0x9C, 0x3B, 0x80, 0xB9, 0xB8, 0x1B, 0x80, 0x59,
+    0x82, 0xD9, 0x87, 0x7B, 0x9C, 0xBA, 0x06, 0x59, 0x03, 0xB9, 0x86, 0x79, 0x83, 0x39, 0x82, 0x99,
+    0x82, 0xF9, 0x81, 0x99, 0x80, 0x59, 0x86, 0x1B, 0x80, 0x79, 0xC6, 0x2B, 0xBD, 0xC9, 0x78, 0x3B,
+    0x98, 0x09, 0x98, 0xAF, 0x98, 0x47, 0x99, 0xB1, 0xB8, 0x2F, 0x98, 0x7F, 0x9D, 0x43, 0x1B, 0xFF,
+    0xF7, 0x8D, 0xD9, 0x82, 0x99, 0x84, 0x19, 0xB1, 0xDB, 0x9F, 0x7B, 0xEA, 0x2E, 0x9C, 0x3E, 0xCB,
+    0x41, 0xB8, 0x3F, 0x9B, 0xC1, 0xB8, 0x25, 0x99, 0xFB, 0xB8, 0x61, 0x98, 0x25, 0x98, 0x69, 0xA4,
+    0xDB, 0xD7, 0x19, 0x05, 0xF3, 0xCC, 0x4D, 0x66, 0x91, 0x80, 0x1B, 0x31, 0x2B, 0x70, 0x33, 0x30,
+    0x8B, 0x70, 0xC3, 0x30, 0x33, 0x31, 0xB7, 0x30, 0xB3, 0x30, 0x07, 0x30, 0xAF, 0x30, 0x2F, 0x33,
+    0x03, 0x71, 0xF7, 0x34, 0x1F, 0x43, 0xC7, 0x24, 0x07, 0x70, 0x87, 0x31, 0x3B, 0x30, 0x23, 0x38,
+    0x46, 0x0A, 0x4F, 0xF0, 0x57, 0xF7, 0xBC, 0x58, 0xE8, 0xFB, 0x00, 0xD3, 0x70, 0x1F, 0x35, 0xD3,
+    0x4A, 0x95, 0xD6, 0x62, 0x28, 0x6E, 0x18, 0xE7, 0x48, 0xF8, 0x54, 0x2C, 0xA5, 0xA6, 0xE0, 0xB6,
+    0x6B, 0xC6, 0xE1, 0x0E, 0x62, 0x26, 0xE2, 0x96, 0xE1, 0x2E, 0xE1, 0x5E, 0x7D, 0x8D, 0xEE, 0xCB,
+    0x3E, 0x1F, 0x67, 0xE0, 0x9A, 0x57, 0x27, 0x58, 0x09, 0xD7, 0x36, 0x48, 0x06, 0xE6, 0x3D, 0x66,
+    0x24, 0x66, 0x09, 0xE7, 0xB0, 0x86, 0xF1, 0xB9, 0xF8, 0x8A, 0xDD, 0xC7, 0x81, 0x08, 0xF7, 0xC1,
+    0x71, 0x61, 0x6E, 0x6D, 0x36, 0xE2, 0x96, 0x60, 0xFE, 0x6D, 0x2E, 0xEA, 0x76, 0xF2, 0x8E, 0x37,
+    0x46, 0xA0, 0x6D, 0xEE, 0x1B, 0x66, 0x29, 0xE6, 0x0E, 0x66, 0xB5, 0xEE, 0x00, 0x66, 0x06, 0x66,
+    0x47, 0xEF, 0xF8, 0xE7, 0xDE, 0x3F, 0xE3, 0x36, 0xE9, 0x4E, 0xE0, 0x2E, 0x75, 0x8E, 0x06, 0xDE,
+    0xCC, 0x57, 0x6E, 0x6A, 0x6E, 0x08, 0x66, 0x04, 0xE6, 0xC6, 0x6E, 0x57, 0x6E, 0x25, 0xE7, 0xF8,
+    0xE8, 0x77, 0xB4, 0xB1, 0x88, 0x67, 0xF3, 0x0E, 0x30, 0x6E, 0x00, 0x67, 0x10, 0xBD, 0x61, 0xEE,
+    0x80, 0x46, 0x79, 0x8A, 0xBF, 0xB7, 0xA0, 0x0B, 0x66, 0xB1, 0xEE, 0x01, 0x66, 0x1B, 0xE6, 0x1D,
+    0x66, 0x0A, 0x66, 0x11, 0xE7, 0x48, 0xFD, 0x42, 0x7A, 0x36, 0x89, 0x05, 0x46, 0x4C, 0x58, 0x6E,
+    0x95, 0xEE, 0x05, 0xE7, 0xD0, 0xA0, 0x45, 0x3D, 0x60, 0x66, 0x60, 0xE6, 0xF6, 0xC6, 0x4F, 0xA6,
+    0xA7, 0x70, 0xCF, 0x31, 0x17, 0x3D, 0xC6, 0xF6, 0xA7, 0x14, 0x0F, 0x73, 0xF0, 0x51, 0xAA, 0xF4,
+    0x50, 0x3F, 0x30, 0x73, 0x31, 0x6F, 0x30, 0x03, 0x30, 0x53, 0x30, 0xC7, 0x30, 0xEF, 0x35, 0xF7,
+    0x70, 0xAF, 0x72, 0x53, 0x41, 0xA7, 0x20, 0x4F, 0x3D, 0x47, 0x07, 0x71, 0x87, 0x09, 0xB3, 0x13,
+    0xF7, 0x05, 0xF3, 0xC8, 0x70, 0xF5, 0x75, 0xE0, 0x3B, 0x30, 0x0B, 0x30, 0x67, 0x35, 0xAF, 0x70,
+    0x97, 0x30, 0x0F, 0x30, 0x83, 0x72, 0xDF, 0x70, 0x0B, 0x32, 0xEF, 0x70, 0x1F, 0x30, 0xAB, 0x3D,
+    0x06, 0x8F, 0xDD, 0x90, 0x13, 0xB7, 0x0E, 0x73, 0x01, 0x73, 0x4C, 0x37, 0x0A, 0x77, 0x00, 0xF3,
+    0x0B, 0x73, 0xEC, 0x58, 0xAE, 0x3D, 0xA0, 0x2B, 0x30, 0x23, 0x30, 0x2B, 0x30, 0x7B, 0x39, 0x04,
+    0x97, 0x33, 0x88, 0x05, 0x33, 0xBC, 0x7F, 0xF2, 0x56, 0x81, 0xCB, 0x70, 0x4B, 0x30, 0x13, 0x39,
+    0x06, 0x7E, 0x85, 0x73, 0x07, 0x73, 0x04, 0x73, 0x79, 0x37, 0xCC, 0x6C, 0x76, 0x78, 0x17, 0x63,
+    0x77, 0xBB, 0x45, 0xCB, 0x67, 0xA3, 0x70, 0xEF, 0x30, 0x2F, 0x30, 0x0B, 0x30, 0x1F, 0x3C, 0x44,
+    0xC6, 0x99, 0xE1, 0x08, 0x37, 0x72, 0x77, 0x01, 0xF3, 0x0B, 0xB3, 0x10, 0xB3, 0x00, 0x73, 0xAC,
+    0x42, 0xB2, 0x1E, 0xF7, 0xEF, 0x71, 0x37, 0x3F, 0x45, 0xEB, 0x93, 0xB1, 0x43, 0xB7, 0x15, 0x33,
+    0x7E, 0x37, 0x6E, 0xB7, 0x4B, 0xB7, 0x31, 0x37, 0x04, 0xF3, 0xA4, 0x02, 0xB9, 0x00, 0x79, 0xF6,
+    0x3F, 0x94, 0x7E, 0x50, 0x23, 0x98, 0x09, 0x98, 0x53, 0x98, 0x21, 0x98, 0x33, 0x98, 0xC1, 0x98,
+    0x61, 0xB8, 0xD1, 0x9C, 0xE2, 0x1F, 0x63, 0xF4, 0x05, 0xD9, 0x84, 0xB9, 0x80, 0xB9, 0xC2, 0x3F,
+    0xD7, 0xAB, 0xC8, 0x0D, 0xB8, 0x33, 0x98, 0x0D, 0x9A, 0x79, 0xB8, 0x23, 0x98, 0x3F, 0x9A, 0x23,
+    0xB8, 0x3D, 0x9B, 0x1B, 0xB9, 0x81, 0xB8, 0x1B, 0x9A, 0x07, 0x9E, 0x43, 0x61, 0xE2, 0xFD, 0xDA,
+    0x25, 0x7E, 0xC8, 0x9C, 0xA2, 0xCB, 0xAD, 0xA3, 0x3F, 0x7B, 0x88, 0x99, 0x81, 0x19, 0x84, 0x99,
+    0xB0, 0x9B, 0x93, 0x5B, 0x83, 0xD9, 0xAE, 0xDB, 0x80, 0x59, 0x8E, 0xD9, 0x83, 0x19, 0x89, 0x39,
+    0x81, 0x99, 0x85, 0xD9, 0xAF, 0xBB, 0x80, 0x19, 0x82, 0x99, 0xD6, 0x29, 0xFD, 0x1C, 0x58, 0x81,
+    0x98, 0x5D, 0x98, 0x27, 0xB8, 0x07, 0x98, 0x49, 0x9A, 0x55, 0xB8, 0x0B, 0x99, 0x63, 0xBB, 0x19,
+    0xB8, 0x11, 0x9E, 0x23, 0x47, 0x84, 0x98, 0x11, 0xBA, 0x02, 0x39, 0x09, 0x39, 0x86, 0x7B, 0xA1,
+    0x1B, 0x83, 0x9A, 0x0A, 0x39, 0x32, 0x3B, 0x80, 0xF9, 0xA6, 0x9B, 0x81, 0xF9, 0x8C, 0x79, 0xCA,
+    0xAD, 0x35, 0x8D, 0xFC, 0xCA, 0xC5, 0x5F, 0xDD, 0xC1, 0xA0, 0xB6, 0xFC, 0xBC, 0x5B, 0x53, 0x07,
+    0xE2, 0xE2, 0xFD, 0x19, 0xED, 0x0C, 0x13, 0x3F, 0xF1, 0xBB, 0x52, 0x7F, 0xFF, 0x79, 0xAE, 0x23,
+    0xB9, 0x9E, 0xAC, 0xFF, 0xB4, 0xD1, 0x7C, 0x7D, 0x97, 0x23, 0x15, 0x85, 0xC1, 0xED, 0x35, 0x58,
+    0xF6, 0x5B, 0x98, 0x47, 0x65, 0xB7, 0xEF, 0xE2, 0xAA, 0xDF, 0xBF, 0xD5, 0x8E, 0x2F, 0x14, 0xF0,
+    0x55, 0x3F, 0x56, 0x29, 0xA6, 0x1F, 0x03, 0x86, 0xC7, 0xCE, 0xF9, 0x19, 0x18, 0x74, 0x0F, 0x53,
+    0x2E, 0x95, 0xE8, 0x7A, 0x12, 0x99, 0x0C, 0xD7, 0x7D, 0xD1, 0xFA, 0x64, 0x2F, 0x7C, 0x9E, 0x87,
+    0x0B, 0xEB, 0xE4, 0xC8, 0xD3, 0x27, 0x9A, 0x99, 0xC7, 0x1F, 0x65, 0x23, 0xEC, 0x6D, 0x6C, 0x96,
+    0x8A, 0xBD, 0xF7, 0xCF, 0xA8, 0x99, 0x69, 0xBE, 0xFA, 0xF9, 0xB4, 0x02, 0x6F, 0xC1, 0xA7, 0xDC,
+    0xA4, 0x73, 0xBC, 0x0F, 0x2B, 0x41, 0x9B, 0x88, 0xF2, 0x2E, 0xF9, 0x5D, 0x94, 0xE7, 0x3F, 0xFF,
+    0xA7, 0x65, 0xF1, 0xFC, 0x8C, 0x87, 0x2B, 0xF7, 0x04, 0xF6, 0xCE, 0x24, 0x94, 0x6D, 0xEE, 0x2B,
+    0x8F, 0xB2, 0xE6, 0xF2, 0x62, 0x71, 0x1B, 0x46, 0x5A, 0x09, 0xD7, 0xC5, 0xF0, 0xE4, 0x10, 0x1B,
+    0x76, 0x4F, 0x11, 0xFB, 0xE6, 0xCC, 0x23, 0x93, 0x19, 0x8E, 0x27, 0x69, 0xD6, 0x97, 0xE4, 0x67,
+    0xF4, 0x78, 0x25, 0x8B, 0x5D, 0x55, 0xEE, 0x4A, 0x71, 0xF6, 0x5D, 0x1F, 0xF2, 0x73, 0x76, 0xEF,
+    0x5B, 0x77, 0x1E, 0xFF, 0x7F, 0x52, 0x87, 0x2D, 0xC7, 0xF7, 0x3E, 0x9C, 0xCC, 0x37, 0x8A, 0x51,
+    0xA6, 0xF3, 0x73, 0x31, 0xFC, 0x2E, 0x4F, 0xDE, 0x0D, 0x0D, 0xB3, 0x4C, 0x79, 0x7C, 0x3D, 0x8C,
+    0xC6, 0xBD, 0x49, 0xB8, 0x60, 0x64, 0xDA, 0x58, 0xFE, 0xB2, 0x1F, 0x36, 0xEC, 0xD2, 0x3A, 0x7D,
+    0x49, 0x0E, 0x52, 0xAF, 0x35, 0xBB, 0xC3, 0x3E, 0x9B, 0x6D, 0xA6, 0xAF, 0xDB, 0x58, 0xBD, 0x55,
+    0x31, 0x96, 0x6D, 0x8E, 0x0F, 0x9D, 0x72, 0x82, 0x65, 0xA9, 0x9E, 0x49, 0x54, 0xEB, 0x31, 0xE6,
+    0xDD, 0xEF, 0x7A, 0x93, 0xE9, 0xCD, 0xEB, 0x83, 0xB9, 0xAE, 0x63, 0xBE, 0x15, 0xCA, 0x8D, 0x86,
+    0x69, 0xA8, 0xA4, 0x57, 0xED, 0xFD, 0x4F, 0xEE, 0x8B, 0x0D, 0x67, 0xA5, 0xFA, 0x7D, 0x7F, 0xAE,
+    0x14, 0xB2, 0x59, 0xC4, 0xE9, 0xDD, 0xB5, 0x32, 0x4F, 0x96, 0x4F, 0x67, 0xC5, 0xE0, 0x6D, 0xA6,
+    0x52, 0x9F, 0x67, 0xBF, 0x59, 0x9B, 0xAA, 0xE6, 0xE9, 0x1F, 0x79, 0x26, 0x42, 0x93, 0x39, 0xE4,
+    0xCD, 0x6E, 0xF9, 0xBF, 0xAF, 0x3F, 0xE5, 0x81, 0xB8, 0xC3, 0x77, 0xBA, 0x0C, 0x64, 0xFA, 0xB3,
+    0x43, 0xB2, 0x6C, 0x77, 0xDE, 0xC8, 0xC6, 0x36, 0xD7, 0x12, 0xFC, 0x74, 0xED, 0xD4, 0xBB, 0x86,
+    0x92, 0x97, 0x7F, 0xAD, 0x60, 0xAE, 0x70, 0x1F, 0xDF, 0xFB, 0x69, 0x43, 0xE1, 0x68, 0x36, 0xB0,
+    0xEE, 0x94, 0x76, 0xA5, 0x88, 0x8E, 0xCA, 0xE4, 0xD8, 0xEE, 0x5D, 0x5F, 0xF7, 0xAD, 0x89, 0x5E,
+    0x29, 0x92, 0xFD, 0xBC, 0x1E, 0x55, 0x59, 0xC5, 0xCB, 0xB9, 0xBA, 0x6C, 0x86, 0x5F, 0xAD, 0x51,
+    0xA3, 0x52, 0x34, 0x19, 0x28, 0x8F, 0xAE, 0x27, 0xBE, 0xD7, 0xE8, 0xB3, 0x16, 0x4F, 0xAD, 0x36,
+    0xFF, 0x4D, 0x88, 0xC8, 0x35, 0x58, 0x1C, 0xA7, 0x32, 0xBD, 0x74, 0xAF, 0x7D, 0x7F, 0x55, 0xEB,
+    0x4C, 0xBB, 0x2D, 0xA9, 0xCB, 0x47, 0xF5, 0x36, 0x3D, 0x16, 0x7B, 0x11, 0x16, 0xE6, 0x46, 0xB0,
+    0xB3, 0x1D, 0x7E, 0xEA, 0x65, 0x86, 0xB6, 0x7B, 0xFC, 0x5C, 0x5A, 0xE4, 0x23, 0xAD, 0x17, 0xF9,
+    0x6F, 0x29, 0x3B, 0x1B, 0x3E, 0x3A, 0x2B, 0x8B, 0x96, 0x70, 0xF0, 0xFB, 0xC9, 0xEF, 0x0A, 0xA9,
+    0xCF, 0xBE, 0xE7, 0xF4, 0x92, 0xCA, 0x16, 0x27, 0x9F, 0x0E, 0xCF, 0xE1, 0xB2, 0xD4, 0x38, 0xDF,
+    0xC2, 0xC1, 0x0B, 0xB1, 0xE3, 0xA3, 0xBE, 0x1F, 0xDD, 0x1B, 0xDD, 0xA5, 0xCF, 0x59, 0xE1, 0x99,
+    0x2D, 0x9F, 0x8B, 0xD3, 0xA3, 0xC8, 0x70, 0x30, 0x54, 0xA9, 0x64, 0x3B, 0x41, 0xE1, 0xC9, 0x63,
+    0x6C, 0x9D, 0x69, 0x35, 0x1A, 0xA9, 0x6C, 0xC5, 0x57, 0xAD, 0x18, 0x6C, 0x6D, 0x87, 0x21, 0xF2,
+    0xD4, 0xEC, 0xE8, 0xF4, 0x59, 0x3D, 0xF2, 0x25, 0x9A, 0xEC, 0xCC, 0x63, 0x5F, 0x0F, 0xCE, 0xE3,
+    0xD9, 0xE3, 0x88, 0x66, 0x7C, 0x9F, 0xB9, 0x8D, 0x23, 0xD1, 0x31, 0xDD, 0xFB, 0xFA, 0x56, 0x7B,
+    0x15, 0x76, 0x33, 0xA4, 0xBD, 0x53, 0xB7, 0x9E, 0xBA, 0xFF, 0xD7, 0x43, 0x11, 0x88, 0x4B, 0xE8,
+    0x19, 0xD9, 0xA6, 0x6E, 0x29, 0x68, 0x8C, 0xFE, 0x3F, 0xB8, 0xEC, 0x9D, 0x36, 0xEF, 0x94, 0x80,
+    0xE4, 0x26, 0x5D, 0x3F, 0x87, 0x7A, 0x05, 0xCF, 0xEE, 0xED, 0x2C, 0x7C, 0x9E, 0x44, 0x87, 0x8F,
+    0x29, 0xA0, 0x78, 0xAE, 0xD6, 0xA8, 0xFE, 0x1A, 0x63, 0xF3, 0xE2, 0x72, 0x31, 0x17, 0xED, 0xC6,
+    0x9E, 0x6D, 0xD0, 0x9F, 0x78, 0x76, 0xBA, 0x4F, 0x37, 0x8E, 0xE7, 0x5B, 0x8D, 0xC0, 0xF8, 0x5B,
+    0x3A, 0x84, 0xC2, 0x55, 0xD2, 0xD5, 0x44, 0x33, 0x57, 0x8F, 0x95, 0xFA, 0xDD, 0xC3, 0x94, 0xF5,
+    0xA4, 0x38, 0xAF, 0x6D, 0x2E, 0xC3, 0x98, 0xE4, 0x40, 0x3F, 0xD7, 0x5E, 0xD6, 0x0F, 0xD5, 0x68,
+    0xAB, 0xF3, 0x67, 0x53, 0x1B, 0x2E, 0x3A, 0xCD, 0x36, 0x9C, 0xE6, 0xAB, 0xF3, 0x1C, 0x44, 0x63,
+    0x77, 0xDD, 0xF3, 0xC2, 0x71, 0x92, 0x5F, 0x34, 0xB3, 0x87, 0xE1, 0xED, 0xC6, 0x3F, 0x90, 0x9C,
+    0x85, 0xA7, 0x67, 0xDD, 0xD3, 0xCF, 0xA2, 0x39, 0x5A, 0x37, 0x6A, 0x5D, 0x80, 0xDE, 0xD3, 0xB8,
+    0x10, 0xAA, 0x1E, 0x07, 0x0B, 0xAB, 0xBA, 0x56, 0x2C, 0x10, 0xDB, 0x87, 0x63, 0x57, 0xA1, 0xDF,
+    0x59, 0x3B, 0x76, 0x78, 0x97, 0xE6, 0xBB, 0x8F, 0xBA, 0x73, 0xE4, 0xBB, 0xCB, 0x14, 0x8F, 0x53,
+    0x72, 0xAC, 0xE4, 0x27, 0xBD, 0x0E, 0xBC, 0x7A, 0x25, 0x29, 0xBF, 0x6A, 0x24, 0x95, 0x2F, 0xD4,
+    0x4E, 0x43, 0x55, 0xA1, 0xF4, 0xFF, 0x1E, 0xB8, 0x54, 0x8A, 0x1B, 0xA3, 0xA0, 0xDA, 0x76, 0xBA,
+    0x9E, 0x05, 0x56, 0xD1, 0xA9, 0xBF, 0xEF, 0x7D, 0x96, 0xEA, 0xBE, 0xFE, 0x05, 0xA2, 0xE1, 0x41,
+    0xAB, 0x37, 0xCB, 0x55, 0xCF, 0xE9, 0x1C, 0x98, 0xDE, 0xFE, 0x99, 0x9D, 0x9F, 0x9F, 0x9F, 0xBF,
+    0x87, 0x61, 0x3D, 0xBD, 0xCB, 0x3D, 0xE7, 0x7F, 0xC7, 0xE8, 0xE7, 0x74, 0xBA, 0x78, 0x6C, 0x2A,
+    0x49, 0x14, 0xCB, 0x73, 0xF8, 0x36, 0xA8, 0x2C, 0x3E, 0xDF, 0x70, 0xCD, 0x47, 0xBF, 0x5E, 0x3A,
+    0x36, 0x1B, 0x1D, 0xCE, 0xB9, 0x6A, 0xB7, 0xBC, 0xDF, 0xBF, 0xD2, 0x83, 0xE0, 0xF1, 0x7D, 0x77,
+    0xD7, 0xBE, 0x26, 0x3F, 0xEF, 0xD6, 0xBF, 0x72, 0xE1, 0xF6, 0x5A, 0x5D, 0x43, 0xAD, 0x27, 0xB2,
+    0x45, 0xA8, 0x7E, 0x1E, 0x8C, 0xBB, 0xB7, 0x34, 0xAE, 0xFE, 0xE3, 0xDB, 0x6B, 0xFE, 0x5B, 0x7F,
+    0x96, 0xB2, 0x7A, 0x64, 0xDE, 0x3A, 0xF5, 0x6E, 0xBD, 0x66, 0xF5, 0xCE, 0x2B, 0x5E, 0x3D, 0xE4,
+    0x86, 0x09, 0x6B, 0xA2, 0x54, 0x3F, 0x77, 0xC9, 0x64, 0xAE, 0x77, 0x15, 0x97, 0xF9, 0xAB, 0x7D,
+    0x5F, 0x0F, 0xD3, 0xC5, 0xBC, 0xDE, 0xD0, 0x6D, 0xFC, 0xAB, 0x75, 0x43, 0xB9, 0xB5, 0xF6, 0x7A,
+    0xE6, 0xBD, 0x4D, 0xA6, 0x7F, 0x9B, 0x4E, 0x8E, 0xD6, 0x2C, 0x1E, 0xE8, 0xC7, 0x8E, 0x17, 0x82,
+    0xE2, 0x5A, 0xEA, 0xF9, 0x1B, 0x34, 0x93, 0x2F, 0x81, 0x92, 0x7B, 0x31, 0xD1, 0xBC, 0x7F, 0x3A,
+    0x6D, 0xD0, 0x8F, 0xE4, 0x35, 0x9D, 0x88, 0x5F, 0x77, 0x93, 0x08, 0xA9, 0xF2, 0xA8, 0x33, 0x9A,
+    0xCE, 0xD3, 0x0D, 0x8A, 0xB5, 0xF0, 0x25, 0x18, 0xAE, 0xBF, 0x0F, 0xEF, 0xFC, 0x8E, 0x76, 0x21,
+    0x18, 0x1C, 0xAC, 0xC2, 0xB7, 0xB2, 0xB3, 0x5E, 0x7F, 0x1A, 0x0A, 0x87, 0xE3, 0x7F, 0x3B, 0xF5,
+    0x7F, 0xF5, 0x3D, 0x4F, 0xEF, 0x4F, 0xFB, 0x29, 0x92, 0x6B, 0xE4, 0xD8, 0x0E, 0xF7, 0x46, 0x57,
+    0x78, 0x8B, 0x7B, 0x7E, 0xB2, 0x0B, 0x25, 0xFE, 0x35, 0x7D, 0xFA, 0x59, 0x32, 0x36, 0x1F, 0xAF,
+    0x4A, 0x65, 0x7C, 0xE4, 0x52, 0xB5, 0x53, 0x5A, 0xBD, 0x6A, 0xBB, 0x1E, 0x9B, 0x53, 0xB1, 0x15,
+    0xDD, 0xD4, 0x64,
+};
+
+constexpr uint8_t FIXTURE_IMAGE_SMALL_WINDOW[] = {
+    0x54, 0x42, 0x5A, 0x31, 0x08, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x94, 0xDB, 0xA3, 0x1C,
+    0x5A, 0x8E, 0xDB, 0x71, 0xF4, 0xD0, 0x59, 0x37, 0xDF, 0xC0, 0x5B, 0x03, 0xBB, 0x44, 0x2A, 0x5D,
+    0xAC, 0xE2, 0x7D, 0x24, 0x14, 0x8E, 0x37, 0x3B, 0x8D, 0x8C, 0x01, 0xBE, 0x4D, 0xCF, 0x85, 0xE7,
+    0x88, 0xD2, 0xF6, 0x33, 0xA8, 0xAF, 0xAA, 0xCB, 0x35, 0x9F, 0x5F, 0x3C, 0x7E, 0xAD, 0xFE, 0xFA,
+    0xA9, 0x2D, 0xFD, 0x44, 0xFA, 0x50, 0xF1, 0xBB, 0xBD, 0xE6, 0xFD, 0xB4, 0xCE, 0x06, 0x7A, 0xA7,
+    0x14, 0xA6, 0xF8, 0xB5, 0x12, 0x98, 0x05, 0x1A, 0x35, 0xBE, 0x11, 0xBB, 0x4E, 0xB7, 0xB5, 0xF6,
+    0xC4, 0x41, 0xE7, 0x57, 0x08, 0x44, 0x12, 0x19, 0xC9, 0x1F, 0xBF, 0xC4, 0xF7, 0x7F, 0x69, 0xD6,
+    0x74, 0x20, 0x7F, 0x82, 0xDB, 0xDC, 0x54, 0xB2, 0xBF, 0xD1, 0xBB, 0xCC, 0x58, 0xF1, 0x9B, 0xD3,
+    0x7B, 0x90, 0xEA, 0x69, 0x7C, 0xF0, 0x7B, 0xC2, 0x43, 0x71, 0xDE, 0xA2, 0x1B, 0xCA, 0x7E, 0xB8,
+    0x94, 0x00, 0x1F, 0xCC, 0x6B, 0x36, 0x78, 0x12, 0x3B, 0x45, 0xBE, 0x25, 0x96, 0x41, 0x48, 0x11,
+    0xB0, 0x7B, 0x45, 0xB2, 0x9B, 0x3D, 0xB2, 0x9B, 0x39, 0xB0, 0xDB, 0x17, 0xB2, 0x7F, 0xA0, 0x6D,
+    0xA7, 0xBE, 0x66, 0x3B, 0x3F, 0xB4, 0x7B, 0x11, 0xBB, 0x87, 0x1B, 0x85, 0x09, 0x86, 0x4B, 0xFF,
+    0x72, 0x91, 0xBB, 0x8E, 0xD3, 0xF9, 0x58, 0x90, 0xFB, 0x0B, 0xB8, 0xC7, 0x2A, 0x2D, 0xA0, 0xE4,
+    0xE0, 0xF8, 0x5E, 0x78, 0x44, 0x6A, 0xB5, 0xC9, 0x41, 0xB4, 0xBB, 0x39, 0xB7, 0x5B, 0xB0, 0x78,
+    0x74, 0x75, 0x10, 0x7B, 0x86, 0x49, 0x61, 0xF4, 0xE7, 0x9B, 0x84, 0x45, 0x7B, 0xF4, 0xF3, 0x1F,
+    0xFC, 0xE9, 0xE0, 0x9C, 0x16, 0xBB, 0x07, 0xB4, 0x7B, 0x1D, 0xB0, 0x3B, 0x0D, 0xB5, 0x1B, 0x1F,
+    0xB0, 0x7B, 0xD1, 0xC9, 0x2B, 0x71, 0x55, 0x3B, 0x4F, 0xBF, 0xC1, 0x1D, 0x03, 0xD8, 0x6D, 0x93,
+    0xD8, 0x2D, 0x8F, 0xDA, 0x9D, 0x92, 0xDD, 0xE3, 0x59, 0x56, 0xE5, 0x6F, 0xF7, 0xD5, 0x49, 0x6B,
+    0xFD, 0xA0, 0xDA, 0xBD, 0x93, 0xDE, 0x63, 0xF7, 0x9F, 0xA2, 0x08, 0xDC, 0xA2, 0x17, 0xB4, 0xD5,
+    0x70, 0x38, 0xDF, 0x2A, 0x88, 0xFD, 0x93, 0xD8, 0x7D, 0xA0, 0xFB, 0x5D, 0xE1, 0x21, 0xB8, 0xEF,
+    0x50, 0x9D, 0x99, 0xD8, 0x7D, 0x98, 0xD8, 0x3D, 0xB9, 0xDA, 0x7D, 0xF6, 0x3D, 0x34, 0xDC, 0x60,
+    0x5D, 0xB4, 0xE0, 0xED, 0x5A, 0x21, 0x52, 0xED, 0x60, 0xAD, 0xD6, 0x28, 0xF1, 0xE8, 0xC1, 0xBD,
+    0x8F, 0xDB, 0x5D, 0xE7, 0x74, 0x79, 0xAF, 0x70, 0x0D, 0xB1, 0xDE, 0x22, 0x0F, 0x3A, 0xB8, 0x2F,
+    0xD9, 0x2D, 0x8B, 0xDA, 0x6D, 0x83, 0xDD, 0x03, 0xD3, 0x00, 0xAA, 0xAA, 0xD8, 0x9D, 0xD6, 0x3C,
+    0xBF, 0x6D, 0x61, 0x3D, 0x88, 0xD8, 0x7F, 0xA8, 0xD9, 0xDD, 0xDA, 0x75, 0xBD, 0xAF, 0xB3, 0xEF,
+    0x86, 0xDA, 0x1D, 0xFA, 0x24, 0xD9, 0x1A, 0xEA, 0x5D, 0x8E, 0xD8, 0x8D, 0xFA, 0x20, 0x5D, 0x5A,
+    0x58, 0xCD, 0x86, 0xDB, 0xBD, 0x80, 0xDC, 0x43, 0x9D, 0xDB, 0xC8, 0xA3, 0xDF, 0x27, 0x07, 0xC2,
+    0xF3, 0xB7, 0xD8, 0x2D, 0xC7, 0x69, 0xFC, 0xAC, 0x4A, 0xFF, 0x8F, 0xDA, 0x6D, 0x8A, 0xDA, 0xCD,
+    0x86, 0xDB, 0x0D, 0xAC, 0xDD, 0xE2, 0xC5, 0x3B, 0x8E, 0x02, 0xDD, 0xEF, 0x37, 0xED, 0xA6, 0x15,
+    0xDE, 0x83, 0x7B, 0x28, 0xF6, 0x8B, 0xDA, 0x7D, 0x98, 0xDA, 0xAD, 0x9D, 0xD9, 0x4D, 0x85, 0xD8,
+    0xAD, 0x84, 0xD8, 0x2D, 0x85, 0xD9, 0x7D, 0x80, 0xDE, 0x8E, 0x49, 0x5B, 0x8A, 0x96, 0xDF, 0xE2,
+    0x7B, 0xBF, 0xB4, 0xA0, 0xD8, 0x8D, 0x99, 0xD8, 0x2D, 0x86, 0xDA, 0x6D, 0xDA, 0x21, 0x52, 0xED,
+    0x63, 0x8D, 0x81, 0xDA, 0x3F, 0xFA, 0x2D, 0xBA, 0xCF, 0xFF, 0x83, 0x91, 0x3B, 0x98, 0x3B, 0xDE,
+    0xB3, 0xA1, 0x03, 0xFC, 0x0A, 0xDB, 0xFD, 0xEF, 0xF7, 0xD5, 0x49, 0x68, 0x8D, 0x85, 0xDA, 0x9D,
+    0x82, 0xDE, 0xC3, 0xAD, 0x91, 0xBD, 0x83, 0xDF, 0xA2, 0x1D, 0xD9, 0xD4, 0x99, 0xD9, 0x8D, 0x8A,
+    0xDD, 0xC3, 0x7B, 0x0D, 0x92, 0x8D, 0xD9, 0x6D, 0x80, 0xD9, 0x5D, 0xD8, 0x26, 0x34, 0x0F, 0x28,
+    0x7D, 0xB0, 0xD8, 0x3D, 0xDA, 0x36, 0x56, 0x9D, 0x69, 0xDD, 0xB8, 0xD9, 0x6D, 0x84, 0xD8, 0x0D,
+    0x8D, 0xD8, 0x8D, 0x97, 0xDE, 0x77, 0x47, 0x9A, 0xF7, 0x54, 0x36, 0x90, 0xDE, 0xA2, 0x2F, 0xBC,
+    0xD8, 0xBD, 0xFE, 0xA2, 0x7D, 0x28, 0x78, 0x0D, 0xB9, 0xDA, 0x2D, 0x89, 0xDE, 0x63, 0x59, 0xB3,
+    0xC0, 0xB7, 0xD8, 0xFD, 0x8A, 0xDA, 0x1D, 0xBA, 0xD9, 0x1D, 0x97, 0xD8, 0x5D, 0xC5, 0x7D, 0x56,
+    0x59, 0xA9, 0x6D, 0xA1, 0xDE, 0x43, 0xA5, 0xD4, 0xA4, 0x95, 0xDE, 0x22, 0x99, 0x88, 0xDB, 0x88,
+    0xD9, 0x1D, 0xF2, 0x70, 0x7C, 0x2F, 0x38, 0x6D, 0x89, 0xDA, 0x6D, 0x90, 0xDD, 0xA3, 0x81, 0x4B,
+    0x80, 0x81, 0xDD, 0xEF, 0x37, 0xED, 0xA6, 0x26, 0xF8, 0x2D, 0x98, 0xDF, 0xE7, 0x4F, 0x04, 0xE0,
+    0x9E, 0xD9, 0xDD, 0xA3, 0xDD, 0xE3, 0x3D, 0x9A, 0xB5, 0x10, 0xD9, 0x2F, 0x95, 0xDF, 0x1B, 0x9D,
+    0xC6, 0xC6, 0x3D, 0xF8, 0x3D, 0x9C, 0xDA, 0x5D, 0x8F, 0xD8, 0x1D, 0x8E, 0xD8, 0x1D, 0xF1, 0x3E,
+    0x92, 0x0A, 0x43, 0x3D, 0x82, 0xD8, 0xED, 0x83, 0xD8, 0xDD, 0xAE, 0xD9, 0x6D, 0x8E, 0xDB, 0xED,
+    0x9E, 0xD9, 0xDD, 0x95, 0xD8, 0xAD, 0xFE, 0x27, 0xBB, 0xFB, 0x48, 0x8D, 0x95, 0xDA, 0xDD, 0x9E,
+    0xDE, 0x63, 0xCF, 0xCD, 0xF1, 0x92, 0xDB, 0x0D, 0x91, 0xDA, 0xDD, 0x8D, 0xDB, 0x1D, 0x8C, 0xD8,
+    0x0D, 0xDA, 0x75, 0xBD, 0xAF, 0xB0, 0xBD, 0xDE, 0x35, 0xF3, 0xE8, 0x3C, 0x42, 0x09, 0xE9, 0xC4,
+    0x27, 0xD8, 0x3D, 0xE4, 0x21, 0x7B, 0xDA, 0xC8, 0x7D, 0x9E, 0xD8, 0xFD, 0x9D, 0xD9, 0xBD, 0x95,
+    0xD8, 0x5D, 0x91, 0xD9, 0x4D, 0xD4, 0x30, 0xF8, 0x0D, 0x30, 0xCD, 0xBF, 0xDB, 0x2D, 0xA0, 0xD9,
+    0x9D, 0x95, 0xD8, 0xBD, 0x82, 0xDF, 0x23, 0xFB, 0xFF, 0xEF, 0x1C, 0xDB, 0x8D, 0xA9, 0xD8, 0xDD,
+    0x80, 0xD9, 0x2D, 0x95, 0xDF, 0x63, 0x09, 0x96, 0x82, 0x36, 0xD9, 0x5D, 0x83, 0xD9, 0xCD, 0x93,
+    0xDC, 0xC3, 0x21, 0x08, 0x8F, 0x04, 0xD9, 0x4D, 0xB1, 0xDB, 0xAD, 0x93, 0xD8, 0xED, 0x92, 0xDB,
+    0xAD, 0x9C, 0xDF, 0x27, 0x07, 0xC2, 0xF3, 0x86, 0xD8, 0x2D, 0xD8, 0x21, 0x3C, 0xB8, 0x28, 0x5D,
+    0x91, 0xD9, 0x0D, 0x81, 0xD8, 0xFD, 0xE6, 0x35, 0x9B, 0x3C, 0x0D, 0x82, 0x89, 0xEE, 0x85, 0x84,
+    0xDA, 0xED, 0xB4, 0xDF, 0x43, 0xD9, 0x73, 0xAE, 0x07, 0xDA, 0xFD, 0x8C, 0xDE, 0x12, 0x1B, 0x8E,
+    0xF5, 0x15, 0xD9, 0xAD, 0x94, 0xDE, 0xE2, 0x69, 0x3D, 0xB7, 0x45, 0x7D, 0x56, 0x59, 0xAA, 0x9D,
+    0x8D, 0xD8, 0x1D, 0x80, 0xDF, 0x42, 0x15, 0xB0, 0xBD, 0x0C, 0xDB, 0x4D, 0x9D, 0xDC, 0x22, 0xD7,
+    0x49, 0xC8, 0x0E, 0xDB, 0x6D, 0xDE, 0x3F, 0x12, 0x6F, 0x26, 0x82, 0xC9, 0xBE, 0xFE, 0x78, 0x3F,
+    0xD0, 0xCA, 0xB4, 0x23, 0xB7, 0xC3, 0xF9, 0xD4, 0x76, 0xDB, 0x8F, 0xA1, 0x4D, 0xAD, 0xF8, 0xDD,
+    0x97, 0xD9, 0x9F, 0xFE, 0x74, 0xF0, 0x4E, 0x09, 0x1D, 0x82, 0xD9, 0xAD, 0x90, 0xDD, 0xA7, 0x5B,
+    0xDA, 0xFB, 0x44, 0x27, 0xBA, 0x5E, 0x02, 0x4D, 0x82, 0xDC, 0xA3, 0x57, 0xE2, 0xE5, 0x88, 0xD8,
+    0xCD, 0x96, 0xD8, 0x2D, 0x89, 0xF8, 0xCD, 0x95, 0xD9, 0xFD, 0x86, 0xDE, 0xB3, 0xA1, 0x03, 0xFC,
+    0x78, 0x25, 0x5A, 0x0A, 0xB7, 0xEA, 0x27, 0xD2, 0x87, 0x86, 0xDC, 0xFA, 0xF9, 0xE3, 0xF5, 0x3A,
+    0xDE, 0xFF, 0x7D, 0x54, 0x96, 0xCD, 0x45, 0xE9, 0x0E, 0xC8, 0xEF, 0x11, 0xD3, 0xB6, 0xFD, 0x40,
+    0xEC, 0x96, 0xF8, 0x11, 0x39, 0xD4, 0xD0, 0x2E, 0xD9, 0x6C, 0x26, 0xF7, 0x19, 0x7D, 0x64, 0x0C,
+    0x6E, 0xFF, 0x55, 0xCE, 0x94, 0x3F, 0x93, 0x83, 0xE1, 0x79, 0xE4, 0x3A, 0x9A, 0x5F, 0x3F, 0x31,
+    0xAC, 0xD9, 0xE0, 0x40, 0xEE, 0x11, 0x2A, 0xBB, 0xFF, 0xD2, 0xEE, 0xF7, 0x9B, 0xF6, 0xD3, 0x21,
+    0x92, 0xFF, 0xDC, 0xA4, 0x06, 0xC4, 0x6C, 0x0E, 0xF3, 0xBA, 0x3C, 0xD7, 0xB8, 0xCE, 0xD1, 0xEE,
+    0x51, 0x26, 0xBE, 0xF7, 0x41, 0x6C, 0xA6, 0xC7, 0x6C, 0x66, 0xDD, 0x6F, 0xA1, 0xA9, 0xD6, 0xF6,
+    0x80, 0xED, 0x3E, 0xCC, 0x6C, 0xEE, 0xF1, 0x10, 0x79, 0xD5, 0xC0, 0x26, 0xC7, 0xEC, 0x76, 0xC2,
+    0xED, 0x96, 0xC2, 0xEC, 0x3E, 0xF6, 0x13, 0xB9, 0x9E, 0xE0, 0xC6, 0xF8, 0x1E, 0x8C, 0xDD, 0xA4,
+    0x1E, 0xCA, 0xEC, 0x3E, 0xC2, 0x6E, 0xD2, 0xD3, 0x51, 0x08, 0x4C, 0x4A, 0x67, 0x08, 0x98, 0xCD,
+    0xA6, 0x86, 0x76, 0xEB, 0x7A, 0xCE, 0x85, 0xA3, 0xF0, 0x9F, 0x64, 0x76, 0xDF, 0x61, 0x77, 0x51,
+    0xDB, 0x6E, 0x3E, 0x86, 0x37, 0x51, 0xF2, 0xEE, 0x3E, 0x89, 0x36, 0x17, 0x6C, 0xF6, 0x27, 0x78,
+    0x48, 0x6E, 0x38, 0x4F, 0x12, 0x6E, 0x61, 0x67, 0x9A, 0xC8, 0x05, 0x6E, 0x9B, 0xE2, 0xD4, 0x4A,
+    0x57, 0x7F, 0xF1, 0x3D, 0xDF, 0xDA, 0x63, 0xB4, 0xFE, 0x56, 0x24, 0x06, 0xE5, 0x36, 0xE8, 0xC7,
+    0x14, 0x4E, 0xC7, 0x6C, 0x16, 0xE2, 0xBE, 0xAB, 0x2C, 0xD5, 0x06, 0xC5, 0xEC, 0x0E, 0xC5, 0xEC,
+    0x16, 0xCA, 0xED, 0x4E, 0xD8, 0x6C, 0xBE, 0xC0, 0x6F, 0x59, 0xD0, 0x81, 0xFE, 0x06, 0x6C, 0x46,
+    0xC0, 0x6C, 0x5E, 0xD9, 0xEC, 0x0E, 0xD9, 0xFE, 0x19, 0x2F, 0xFD, 0xCA, 0x62, 0x34, 0xBD, 0x8C,
+    0xE8, 0x1E, 0xD0, 0xEC, 0x16, 0xD3, 0xFC, 0xB7, 0xDC, 0x6D, 0x96, 0xF4, 0x1E, 0x4C, 0x4E, 0xC5,
+    0x46, 0xCC, 0x6E, 0x91, 0xEC, 0x98, 0xE9, 0x4D, 0xEC, 0x4E, 0xC8, 0x6D, 0xC7, 0xC1, 0x6C, 0x6E,
+    0xD1, 0xEC, 0x66, 0xCD, 0xEF, 0x89, 0xF4, 0x90, 0x52, 0x08, 0xEF, 0x29, 0xFA, 0xE2, 0x50, 0x0F,
+    0x6C, 0xBE, 0xE8, 0x1B, 0xDD, 0xD5, 0x24, 0xD6, 0xC4, 0xEC, 0x5E, 0xCF, 0xED, 0x56, 0xE7, 0xD7,
+    0xCF, 0x1F, 0xA8, 0x2E, 0xFF, 0x13, 0xDD, 0xFD, 0xA7, 0x91, 0x55, 0xCE, 0xF0, 0x4F, 0x6D, 0x8E,
+    0xF3, 0xBA, 0x3C, 0xD7, 0xBB, 0x41, 0x82, 0xB4, 0x54, 0x7F, 0x51, 0x3E, 0x94, 0x3C, 0x46, 0xC3,
+    0xEC, 0x06, 0xC5, 0x6C, 0xC6, 0xCD, 0x6E, 0x2B, 0xEA, 0xB2, 0xCD, 0x42, 0x6D, 0x2E, 0xC1, 0xEC,
+    0xDE, 0xCE, 0xEC, 0x06, 0xC7, 0xEC, 0x56, 0xE3, 0xB4, 0xFE, 0x56, 0x24, 0xFE, 0xD2, 0x6C, 0x26,
+    0xC7, 0x6C, 0x66, 0xC4, 0x6D, 0x36, 0xC6, 0xED, 0x26, 0xD9, 0x6C, 0x26, 0xCD, 0xEE, 0xB1, 0x6F,
+    0xB8, 0xD8, 0xCE, 0x6E, 0x43, 0xA9, 0xA5, 0xF3, 0xCC, 0x6C, 0x6E, 0xEA, 0x3B, 0x6D, 0xC7, 0xD1,
+    0x2E, 0xC8, 0xEC, 0xDF, 0xC3, 0xEF, 0xF1, 0x52, 0x81, 0xE7, 0x21, 0x92, 0xFF, 0xDC, 0xA4, 0x7E,
+    0xC4, 0xEC, 0x86, 0xC6, 0x6C, 0x46, 0xC0, 0xEC, 0xB6, 0xD0, 0xEC, 0x2E, 0xFF, 0x17, 0x8B, 0x55,
+    0xE8, 0x7E, 0xF8, 0xDC, 0xEE, 0x36, 0x30, 0x9E, 0xF1, 0x10, 0x79, 0xD5, 0xC0, 0x86, 0xDE, 0x6C,
+    0x0E, 0xE5, 0x36, 0xE8, 0xC7, 0x14, 0x56, 0xF8, 0x12, 0x5D, 0x07, 0xB7, 0x41, 0x64, 0xDF, 0x7F,
+    0x1D, 0x7D, 0x16, 0xC9, 0x6D, 0x96, 0xC4, 0x6C, 0x36, 0xC1, 0x6C, 0x7E, 0xD0, 0xEF, 0xB1, 0xDA,
+    0xFD, 0xE2, 0x71, 0x1D, 0x2D, 0xA6, 0x98, 0x8E, 0xDA, 0x6D, 0x86, 0xC5, 0xEE, 0xC1, 0x54, 0xE8,
+    0xC5, 0x4D, 0x6D, 0x16, 0xC0, 0xEC, 0x96, 0xF2, 0x9F, 0xAE, 0x25, 0x00, 0x36, 0xC8, 0xED, 0x5E,
+    0xCE, 0xEC, 0x66, 0xDD, 0xFC, 0x3E, 0xCB, 0xED, 0x9E, 0xC0, 0x6C, 0x26, 0xC6, 0xED, 0xF6, 0xC8,
+    0xED, 0x9E, 0xF9, 0x38, 0x3E, 0x17, 0x9F, 0x09, 0x0D, 0xC7, 0x0B, 0xE2, 0x1D, 0x80, 0xD9, 0x1F,
+    0x88, 0xD9, 0x2D, 0x84, 0xD8, 0xAD, 0xE6, 0x35, 0x9B, 0x3C, 0x08, 0x4D, 0xEA, 0x25, 0x7A, 0x7B,
+    0x61, 0x1D, 0xF6, 0x2B, 0xB0, 0x39, 0x6A, 0xDD, 0x93, 0xDC, 0xA3, 0x45, 0x07, 0xA2, 0x38, 0xD8,
+    0xBD, 0x89, 0xD8, 0x0D, 0x85, 0xDB, 0x4D, 0x82, 0xDF, 0xE2, 0x7B, 0xBF, 0xB4, 0x95, 0xD8, 0x7D,
+    0xA2, 0xDF, 0x62, 0xDF, 0x78, 0xFC, 0x54, 0x76, 0xDB, 0x8F, 0xA0, 0x5D, 0x96, 0xD8, 0x2D, 0xA2,
+    0xD8, 0x7D, 0xB3, 0xD9, 0xFD, 0xCA, 0x24, 0x3D, 0xAA, 0x28, 0xCD, 0x95, 0xDE, 0x02, 0x77, 0x1B,
+    0xEA, 0x06, 0xD9, 0x4D, 0x86, 0xDC, 0x43, 0x9D, 0x16, 0x8E, 0x5A, 0x21, 0x52, 0xED, 0x62, 0x1D,
+    0xAA, 0xF9, 0x0D, 0x83, 0xD9, 0x1D, 0xFE, 0xA2, 0x7D, 0x28, 0x7F, 0x13, 0xE9, 0x20, 0xA4, 0x0C,
+    0xD8, 0xFD, 0xA0, 0xDC, 0x57, 0xD5, 0x65, 0x9A, 0x83, 0xDE, 0x82, 0xC9, 0xBE, 0xFE, 0x00, 0xD8,
+    0xCD, 0x97, 0xDF, 0x1B, 0x9D, 0xC6, 0xC6, 0x07, 0xDD, 0x37, 0xC5, 0xA8, 0x94, 0x80, 0xD9, 0x1D,
+    0x8C, 0xD8, 0xBD, 0xA7, 0xDA, 0xBD, 0xDA, 0x3C, 0xF7, 0x2A, 0x72, 0x5D, 0x9C, 0xD9, 0x7D, 0x99,
+    0xD8, 0x3F, 0x9A, 0xDD, 0x22, 0x13, 0xCD, 0xE3, 0x02, 0xD9, 0x4D, 0x83, 0xDF, 0x02, 0xD9, 0x62,
+    0xAE, 0x35, 0xDA, 0xBD, 0x80, 0xD9, 0x4D, 0xE7, 0x74, 0x79, 0xAF, 0x75, 0xC2, 0x3D, 0x40, 0x91,
+    0x9C, 0xD8, 0x6D, 0xC3, 0x25, 0xFF, 0xB9, 0x4A, 0x3D, 0x9F, 0xD9, 0x2D, 0x9A, 0xD8, 0x2D, 0x84,
+    0xD9, 0xCD, 0xA4, 0xDD, 0xE3, 0x83, 0x77, 0xB3, 0x94, 0xD8, 0x4D, 0x9D, 0xD8, 0x4D, 0x97, 0xDB,
+    0xCF, 0x90, 0xDE, 0x22, 0x0F, 0x3A, 0xB8, 0x00, 0xD9, 0x5D, 0xC7, 0x69, 0xFC, 0xAC, 0x49, 0x2D,
+    0xBD, 0xF9, 0x4D, 0xC8, 0x20, 0xF9, 0x8D, 0x68, 0xCD, 0xC0, 0x2C, 0xB0, 0x58, 0xC9, 0x0D, 0x84,
+    0xDF, 0x62, 0xA9, 0x31, 0x95, 0xB7, 0xD8, 0xAD, 0xA2, 0xD9, 0xCE, 0x05, 0xD0, 0x3D, 0xA9, 0xDE,
+    0x82, 0x2D, 0x6A, 0xB2, 0xAD, 0xD9, 0x0D, 0xAE, 0xDE, 0x53, 0xF5, 0xC4, 0xA0, 0x18, 0xDF, 0xE7,
+    0x4F, 0x04, 0xE0, 0x9D, 0xDE, 0xC3, 0xE5, 0x65, 0x88, 0x06, 0xDF, 0x13, 0xE9, 0x20, 0xA4, 0x6C,
+    0x2B, 0x73, 0x9E, 0x61, 0xED, 0x93, 0xD8, 0x9D, 0xB0, 0xD8, 0xAD, 0x87, 0xD9, 0x2D, 0xA4, 0xD8,
+    0x1D, 0x84, 0xDA, 0x1D, 0xB0, 0xD8, 0x8D, 0x9B, 0xDC, 0xC2, 0x99, 0xD4, 0xCD, 0x97, 0xD8, 0xFD,
+    0x84, 0xD8, 0x0D, 0xFC, 0x21, 0x97, 0x69, 0xC0, 0xAD, 0x9F, 0xD8, 0x8D, 0x87, 0xDB, 0x9D, 0x81,
+    0xD8, 0x0D, 0xAB, 0xD9, 0xAD, 0xD3, 0x7C, 0x5A, 0x89, 0x4D, 0xA2, 0x15, 0x2E, 0xD6, 0x16, 0xDD,
+    0x03, 0xBD, 0x20, 0xE9, 0xA5, 0xDE, 0x02, 0xB3, 0x44, 0xB3, 0x84, 0xD8, 0x7D, 0xFE, 0x24, 0xB0,
+    0xFA, 0x75, 0xA7, 0x5B, 0xDA, 0xFB, 0x72, 0x3E, 0x7B, 0xA6, 0x3C, 0x25, 0xBD, 0x47, 0xFE, 0xE0,
+    0x77, 0x9A, 0x39, 0x25, 0x6E, 0x2A, 0x5F, 0x62, 0xB7, 0xA0, 0xB2, 0x6F, 0xBF, 0x8F, 0x76, 0x07,
+    0x61, 0xB7, 0x78, 0xC5, 0xF1, 0x78, 0xC3, 0xF6, 0xA7, 0x66, 0xF7, 0x98, 0xE4, 0xC4, 0x61, 0x63,
+    0xF6, 0x4B, 0x6E, 0xF6, 0x0B, 0x6D, 0x36, 0x2F, 0x67, 0x36, 0x13, 0x62, 0xB6, 0x4B, 0x65, 0x36,
+    0x8F, 0x64, 0xB8, 0x7F, 0x43, 0xF6, 0x6B, 0x73, 0x08, 0x1C, 0x5E, 0xD9, 0x08, 0xF2, 0x56, 0x60,
+    0x4D, 0x76, 0x13, 0x74, 0x0C, 0x55, 0x2F, 0x48, 0x17, 0x7D, 0x09, 0x3C, 0x43, 0x8C, 0xC7, 0x64,
+    0x76, 0x83, 0x6D, 0xB7, 0xF9, 0xD3, 0xC1, 0x38, 0x25, 0xF6, 0x0F, 0x7F, 0xA8, 0x9F, 0x4A, 0x1F,
+    0x20, 0xDD, 0x64, 0xB3, 0xAC, 0xBE, 0x2B, 0x79, 0x4F, 0xD7, 0x12, 0x81, 0xE8, 0xD6, 0xF8, 0x2B,
+    0x02, 0x37, 0xC8, 0xE3, 0xC7, 0xE5, 0x22, 0xF6, 0x2B, 0x72, 0x1D, 0x4D, 0x2F, 0x9E, 0x53, 0x60,
+    0x77, 0xC9, 0xC1, 0xF0, 0xBC, 0xFC, 0x0D, 0x2D, 0x9F, 0xBA, 0x33, 0x60, 0xF7, 0xC6, 0xE7, 0x71,
+    0xB1, 0x84, 0x36, 0x1F, 0x72, 0x8B, 0x5D, 0x9B, 0x7A, 0xC3, 0x66, 0xB6, 0x4F, 0xE0, 0x77, 0x3E,
+    0xBE, 0x78, 0xFD, 0x58, 0x8F, 0x7D, 0xF7, 0x48, 0x2B, 0x60, 0x36, 0x13, 0x6A, 0xF6, 0x37, 0x6D,
+    0xB6, 0xA3, 0x60, 0x76, 0x6F, 0x60, 0x36, 0xE7, 0x78, 0x48, 0x6E, 0x3B, 0xD4, 0x37, 0x71, 0x5F,
+    0x55, 0x96, 0x6A, 0xAB, 0x65, 0x37, 0x0C, 0x97, 0xFE, 0xE5, 0x2F, 0xF6, 0x07, 0x62, 0xF6, 0x03,
+    0x64, 0xF6, 0x0F, 0x62, 0xF6, 0x6F, 0x60, 0xF7, 0x30, 0x95, 0x7A, 0x7B, 0x4B, 0x76, 0x3F, 0x61,
+    0x36, 0xA7, 0x62, 0x36, 0x03, 0x7E, 0x0D, 0x9D, 0x13, 0x50, 0x2B, 0x64, 0xF7, 0xC4, 0xFA, 0x48,
+    0x29, 0x1A, 0xCE, 0x84, 0x0F, 0xF0, 0x5F, 0x6F, 0x36, 0x17, 0x75, 0x1D, 0xB6, 0xE3, 0xE9, 0xE0,
+    0xC8, 0xCD, 0xF1, 0x0A, 0x36, 0x17, 0x7F, 0x8C, 0xA4, 0x47, 0x08, 0x23, 0x69, 0x36, 0x4B, 0x63,
+    0x36, 0x83, 0x6B, 0xF6, 0x7F, 0x63, 0x36, 0x73, 0x63, 0xF6, 0x03, 0x61, 0xF6, 0x27, 0x67, 0xF6,
+    0xD7, 0x75, 0x8D, 0x04, 0x07, 0x5E, 0x6B, 0x63, 0xFE, 0x37, 0x65, 0x76, 0x37, 0x62, 0xB6, 0x0F,
+    0x7A, 0x39, 0x25, 0x6E, 0x2A, 0xF7, 0x61, 0xF6, 0x0B, 0x63, 0x76, 0x73, 0x68, 0xB6, 0x1F, 0x7F,
+    0x89, 0x2C, 0x3E, 0x9C, 0x0B, 0x61, 0xF7, 0x10, 0xF4, 0xFD, 0xB3, 0xC7, 0x76, 0x5F, 0x62, 0x36,
+    0x1F, 0x76, 0x9D, 0x6F, 0x6B, 0xED, 0xC8, 0xF3, 0x4B, 0x34, 0x9C, 0x9C, 0x1F, 0x0B, 0xCF, 0x18,
+    0xBB, 0x53, 0xA1, 0x25, 0xF7, 0xE8, 0xF9, 0x5B, 0x77, 0xDF, 0x0D, 0x64, 0xBA, 0x0D, 0x28, 0xB0,
+    0x6A, 0x34, 0xA0, 0xF7, 0x88, 0xF7, 0x7B, 0xF8, 0x92, 0x1D, 0x4D, 0x2F, 0x9F, 0x88, 0xE2, 0xCD,
+    0x22, 0xFF, 0x89, 0xEE, 0xFE, 0xD3, 0x20, 0xF6, 0x72, 0x61, 0x8A, 0xF6, 0x77, 0x6B, 0xF6, 0x63,
+    0xF8, 0x8D, 0x14, 0x67, 0x8E, 0xDF, 0x65, 0x37, 0x70, 0x88, 0xC8, 0x61, 0x43, 0x36, 0x17, 0x63,
+    0x37, 0x15, 0xF5, 0x59, 0x66, 0xB8, 0x0C, 0xAE, 0xFF, 0x24, 0x7B, 0x62, 0x36, 0x03, 0xE9, 0x77,
+    0xA0, 0xF8, 0xEB, 0xA0, 0xA1, 0xF7, 0x3E, 0xBE, 0x78, 0xFD, 0x59, 0x8D, 0x66, 0xCF, 0x02, 0x57,
+    0x65, 0x37, 0x00, 0xFF, 0x7C, 0x20, 0xB1, 0x8C, 0x84, 0xBA, 0xB8, 0x63, 0x71, 0x1A, 0x5E, 0xC6,
+    0x75, 0xD0, 0x8F, 0xD1, 0xEE, 0xE0, 0xB6, 0xE7, 0x79, 0xDD, 0x1E, 0x6B, 0xDD, 0x4D, 0xF1, 0x6A,
+    0x25, 0x2E, 0xF6, 0x07, 0x63, 0xBE, 0x4F, 0x61, 0xF6, 0x5B, 0x67, 0xB6, 0xA7, 0x62, 0x37, 0x0C,
+    0x97, 0xFE, 0xE5, 0x25, 0x36, 0x17, 0x78, 0x48, 0x6E, 0x3B, 0xD5, 0xC4, 0xFA, 0x48, 0x29, 0x00,
+    0xF6, 0x33, 0x7B, 0x0A, 0xC6, 0x5A, 0x01, 0x70, 0xC9, 0xE1, 0xF7, 0x78, 0x88, 0x3C, 0xEA, 0xE0,
+    0x7B, 0x60, 0x36, 0x0B, 0xF4, 0x0C, 0xE7, 0x56, 0x20, 0x73, 0x7F, 0xA8, 0x9F, 0x4A, 0x1E, 0x03,
+    0x65, 0xB5, 0xEC, 0x19, 0xB6, 0x3B, 0xE0, 0x6E, 0x3B, 0x56, 0x13, 0x5B, 0xE4, 0xE0, 0xF8, 0x5E,
+    0x78, 0x84, 0xC2, 0xD7, 0xAB, 0x19, 0xB0, 0xBB, 0xAC, 0x62, 0x7C, 0xDF, 0xE1, 0x5B, 0x39, 0xB0,
+    0x7B, 0x55, 0xB0, 0xDB, 0x43, 0xB9, 0x87, 0xA7, 0x93, 0x4F, 0x09, 0xB0, 0x1B, 0x07, 0xB9, 0x0E,
+    0xA6, 0x97, 0xCF, 0x21, 0xB3, 0x1B, 0x57, 0xB0, 0x9B, 0x7F, 0xC9, 0xEE, 0xFE, 0xD2, 0xF3, 0x6A,
+    0x37, 0x69, 0xD6, 0xF6, 0xBE, 0xD7, 0xBC, 0xDF, 0xB6, 0x99, 0x15, 0xF5, 0x59, 0x66, 0xA1, 0xB6,
+    0x57, 0x62, 0x76, 0x23, 0x65, 0x76, 0x5F, 0x74, 0x0B, 0x7E, 0xCB, 0xC2, 0x1F, 0x62, 0xB6, 0xDF,
+    0x7C, 0x8C, 0x8E, 0x62, 0x3F, 0x18, 0xBA, 0x64, 0xF7, 0x39, 0x0F, 0x6C, 0x4E, 0x6B, 0xC0, 0xF8,
+    0xE6, 0x2B, 0x99, 0x0E, 0x16, 0xEA, 0x2C, 0x2B, 0x70, 0x8B, 0xA7, 0x0A, 0x06, 0x57, 0x74, 0xDF,
+    0x16, 0xA2, 0x52, 0x37, 0x6C, 0xB6, 0x37, 0x79, 0x4F, 0xD7, 0x12, 0x80, 0x3B, 0x68, 0x77, 0x90,
+    0xE2, 0xFE, 0xBA, 0x25, 0xF6, 0x1B, 0x67, 0xF6, 0x7B, 0x73, 0xEB, 0xE7, 0x8F, 0xD4, 0x03, 0x7C,
+    0x0E, 0x4C, 0x56, 0x58, 0x7F, 0x6B, 0x36, 0x07, 0x6B, 0xF6, 0x1F, 0x67, 0x36, 0xBF, 0x69, 0xF7,
+    0xA8, 0xA5, 0x5C, 0x68, 0xF6, 0x88, 0x54, 0xBB, 0x59, 0x00, 0xC1, 0xDA, 0x35, 0xA7, 0x36, 0x1F,
+    0x7F, 0xA8, 0x9F, 0x4A, 0x1E, 0x1F, 0x7C, 0x0E, 0x7E, 0xD3, 0x4D, 0x1D, 0xA7, 0xF2, 0xB1, 0x2F,
+    0xF6, 0x87, 0x64, 0x36, 0x47, 0xE2, 0x36, 0x73, 0x64, 0x36, 0x8B, 0xEA, 0x36, 0x77, 0x69, 0xF6,
+    0x0F, 0x61, 0xB6, 0x0F, 0x66, 0xF6, 0x1B, 0x65, 0x37, 0xC4, 0xFA, 0x48, 0x29, 0x05, 0x36, 0xC7,
+    0x6B, 0x76, 0x8F, 0xE1, 0x37, 0xC9, 0xC1, 0xF0, 0xBC, 0xE3, 0xB7, 0xAC, 0xE8, 0x40, 0xFF, 0x19,
+    0x0D, 0xED, 0xDB, 0x02, 0x0F, 0x60, 0x36, 0xFF, 0x64, 0xF6, 0xC7, 0x62, 0xF6, 0x3B, 0x65, 0x77,
+    0x88, 0x92, 0x5A, 0x27, 0xE4, 0x36, 0xB7, 0x63, 0x36, 0xA3, 0x64, 0xB6, 0xC3, 0xFF, 0x89, 0xEE,
+    0xFE, 0xD2, 0x0F, 0x61, 0xF6, 0x43, 0x60, 0x76, 0x2F, 0x61, 0x76, 0x57, 0x69, 0xF6, 0x77, 0x64,
+    0xB6, 0x9B, 0x77, 0x88, 0x9F, 0xC2, 0xFC, 0xDB, 0x60, 0x3E, 0x33, 0x7A, 0x0B, 0x26, 0xFB, 0xF8,
+    0x57, 0x7D, 0x8E, 0x1D, 0x63, 0x30, 0x07, 0x68, 0x76, 0x07, 0x64, 0x76, 0x03, 0x6A, 0xF7, 0x60,
+    0xFB, 0x6C, 0x72, 0x66, 0xF9, 0x25, 0x87, 0xD3, 0x8A, 0xEC, 0x0E, 0xEC, 0x1D, 0xAD, 0xAF, 0x84,
+    0xF6, 0xE1, 0x92, 0xFF, 0xDC, 0xA5, 0x5E, 0xEA, 0x11, 0x7C, 0x66, 0x23, 0x31, 0xAC, 0xD9, 0xE0,
+    0x73, 0xBA, 0x3C, 0xD7, 0xBA, 0xD3, 0xAD, 0xED, 0x7D, 0x8E, 0x6C, 0x8F, 0xC2, 0xED, 0xB6, 0xC7,
+    0x6D, 0x8E, 0xD4, 0xEE, 0xC1, 0x97, 0xFB, 0x7B, 0x86, 0xEC, 0x16, 0xC6, 0x6E, 0xD1, 0x0A, 0x97,
+    0x6B, 0x2A, 0x1B, 0x69, 0x94, 0x95, 0x1E, 0xC1, 0x6C, 0x76, 0xE9, 0x14, 0x9B, 0x5D, 0x5C, 0x0E,
+    0xD7, 0x6E, 0x31, 0x5E, 0xFE, 0x69, 0xE5, 0x36, 0xE8, 0xC7, 0x17, 0x89, 0xF4, 0x90, 0x52, 0x08,
+    0xEC, 0x66, 0xE2, 0x1E, 0x5C, 0x16, 0x9A, 0x01, 0x98, 0x99, 0xEF, 0x83, 0xEC, 0x8E, 0xDE, 0xEC,
+    0xEE, 0xF9, 0x1C, 0x8D, 0x25, 0x45, 0x2E, 0xDC, 0x6D, 0x5F, 0xD8, 0xEC, 0xF6, 0xC4, 0x6C, 0x56,
+    0xC1, 0xFC, 0x06, 0xD4, 0x6F, 0xF3, 0xA7, 0x82, 0x70, 0x7B, 0x1B, 0x1B, 0xD7, 0x53, 0xF1, 0xEF,
+    0xBF, 0xF2, 0xA7, 0x17, 0x3C, 0xF7, 0x1C, 0x46, 0xC2, 0x6C, 0xFF, 0xC9, 0xEF, 0x8D, 0xCE, 0xE3,
+    0x63, 0x18, 0xED, 0x0E, 0xC8, 0xED, 0x7E, 0xE3, 0xB4, 0xFE, 0x56, 0x25, 0x5E, 0xE9, 0xBE, 0x2D,
+    0x44, 0xA4, 0xD6, 0xC4, 0xEE, 0xF7, 0x9B, 0xF6, 0xD3, 0x3A, 0x12, 0x79, 0x47, 0x48, 0x6E, 0xC4,
+    0x6C, 0x86, 0xD0, 0x6C, 0x9E, 0xC1, 0xFE, 0x21, 0xCF, 0x9F, 0xDC, 0x7F, 0x51, 0x3E, 0x94, 0x3F,
+    0x31, 0xAC, 0xD9, 0xE0, 0x40, 0xEF, 0x21, 0x20, 0xC9, 0x5F, 0xBA, 0x18, 0x7C, 0x3D, 0xA8, 0xC6,
+    0xC1, 0xEC, 0x0E, 0xC0, 0x6C, 0x5E, 0xCE, 0x6D, 0x96, 0xC6, 0xED, 0x6E, 0xF2, 0x1F, 0x9C, 0xBF,
+    0xFF, 0x89, 0xF4, 0x90, 0x52, 0x02, 0x6D, 0xA7, 0x0B, 0x68, 0x56, 0xD0, 0x6D, 0x1E, 0xC4, 0x6E,
+    0xD3, 0xAD, 0xED, 0x7D, 0x84, 0x6C, 0x3E, 0xCE, 0xEC, 0x46, 0xDC, 0xEF, 0x41, 0x64, 0xDF, 0x7F,
+    0x02, 0xEC, 0x26, 0xC5, 0x6C, 0x1E, 0xCD, 0xED, 0x66, 0xFC, 0x10, 0x9C, 0x6D, 0x12, 0x71, 0x1C,
+    0xCF, 0x54, 0xC4, 0xEC, 0x36, 0xDC, 0x6D, 0x3E, 0xC9, 0x6C, 0xBE, 0xC8, 0x6F, 0x09, 0x0D, 0xC7,
+    0x7A, 0xAA, 0x18, 0x2B, 0x45, 0xB5, 0x26, 0xE7, 0xD7, 0xCF, 0x1F, 0xA9, 0xC6, 0xCC, 0x6D, 0x16,
+    0xDF, 0xEC, 0x6F, 0xC0, 0x70, 0x5E, 0xA2, 0x19, 0xBA, 0x05, 0xD4, 0x56, 0xF3, 0x1D, 0x08, 0x3E,
+    0xE4, 0x3E, 0xCF, 0x6E, 0x19, 0x2F, 0xFD, 0xCA, 0x54, 0x6D, 0x5E, 0xE5, 0x36, 0xE8, 0xC7, 0x14,
+    0x8E, 0xD0, 0xEC, 0x76, 0xC9, 0xEC, 0x46, 0xC3, 0xEE, 0xD1, 0x0A, 0x97, 0x6B, 0x0F, 0xED, 0x56,
+    0xF1, 0x10, 0x79, 0xD5, 0xC1, 0x06, 0xC3, 0xEE, 0x21, 0xB1, 0x84, 0x55, 0xC7, 0x6C, 0xBE, 0xE0,
+    0x1F, 0x48, 0xC4, 0x08, 0x76, 0xC5, 0xEC, 0x36, 0xF3, 0xBA, 0x3C, 0xD7, 0xB8, 0xDE, 0xDA, 0x6E,
+    0x81, 0xD0, 0x83, 0x73, 0x0B, 0xED, 0x36, 0xF1, 0x16, 0x6E, 0x6D, 0xCC, 0xBE, 0xDB, 0x6C, 0x76,
+    0xDC, 0x7C, 0x37, 0x0B, 0x68, 0xD6, 0xD3, 0xEF, 0x51, 0xE5, 0x95, 0x5C, 0x46, 0x6D, 0xE6, 0xDA,
+    0xED, 0xDE, 0xC1, 0x6E, 0x11, 0xBF, 0xC0, 0xC7, 0xE7, 0x1C, 0xCB, 0xAC, 0x90, 0xB7, 0xF3, 0x17,
+    0x49, 0xEC, 0x50, 0x2E, 0xF3, 0x10, 0x0D, 0xC4, 0x82, 0xF7, 0x9B, 0xF6, 0xD3, 0x10, 0x6C, 0x6E,
+    0xEA, 0x16, 0x1A, 0x76, 0xED, 0x7E, 0xC7, 0x6E, 0x71, 0xD4, 0x9C, 0xD9, 0x82, 0x6C, 0x16, 0xD7,
+    0x6C, 0x4E, 0xDD, 0x6C, 0x1E, 0xC1, 0x6D, 0x0E, 0xCF, 0x6C, 0x5E, 0xE2, 0x34, 0xBD, 0x8C, 0xE8,
+    0x2E, 0xF1, 0x1B, 0xFF, 0x1D, 0x70, 0xC6, 0xE4, 0x19, 0x4B, 0x8C, 0xD1, 0x26, 0xFF, 0x1D, 0x8A,
+    0x07, 0x3D, 0x46, 0xEC, 0x11, 0x5A, 0x44, 0xDD, 0x3E, 0xC6, 0xED, 0xCE, 0xCF, 0x6E, 0x61, 0xD8,
+    0xAE, 0x7F, 0x4A, 0x7D, 0x4E, 0xE2, 0xBE, 0xAB, 0x2C, 0xD7, 0x31, 0xAC, 0xD9, 0xE0, 0x78, 0x13,
+    0x6E, 0xDE, 0x44, 0x86, 0xCA, 0xEC, 0x1E, 0xED, 0x1E, 0x1A, 0xDC, 0x5B, 0x29, 0xFA, 0xE2, 0x50,
+    0x1D, 0xEC, 0x2E, 0xCE, 0x7F, 0x61, 0x74, 0x90, 0x4F, 0xFF, 0x12, 0x58, 0x7D, 0x38, 0x2E, 0xC0,
+    0x6C, 0xFE, 0xFD, 0x1F, 0x6A, 0xF5, 0x85, 0x16, 0xCD, 0x6E, 0xC1, 0x79, 0xCF, 0xC9, 0x0D, 0x6F,
+    0x91, 0x44, 0xEE, 0x4E, 0x3F, 0x13, 0xDD, 0xFD, 0xA4, 0x96, 0xCE, 0xEC, 0x66, 0xC0, 0xEC, 0x4E,
+    0xEF, 0x11, 0x2A, 0xA4, 0x34, 0xFE, 0xFB, 0x11, 0x8B, 0xBD, 0xC9, 0xC6, 0xDD, 0xED, 0x6E, 0xC3,
+    0x6C, 0xD6, 0xFA, 0x14, 0xC9, 0x84, 0x85, 0xCE, 0xD8, 0x6E, 0x21, 0xD4, 0xD6, 0xC5, 0x03, 0xEE,
+    0x19, 0x2F, 0xFD, 0xCA, 0x55, 0xEE, 0xF1, 0xE1, 0x86, 0xC5, 0x5E, 0xFC, 0xBE, 0xFA, 0x1A, 0x0A,
+    0x54, 0xB3, 0xF1, 0x03, 0xA1, 0xDC, 0x91, 0x6C, 0x86, 0xCA, 0xF3, 0xF3, 0x0E, 0xD2, 0xAA, 0xDE,
+    0x82, 0xC9, 0xBE, 0xFE, 0x09, 0xD9, 0x8D, 0xA1, 0xD8, 0x3D, 0xBE, 0xDA, 0x2D, 0x82, 0xDA, 0x3D,
+    0xFC, 0x38, 0xFC, 0x0B, 0x98, 0x1D, 0x98, 0xDE, 0xFF, 0x7D, 0x54, 0x96, 0x9D, 0xDC, 0x83, 0x3F,
+    0xF4, 0x84, 0x6A, 0x30, 0xF0, 0xAF, 0xC9, 0xFD, 0x8E, 0xDC, 0x57, 0xD5, 0x65, 0x9A, 0x86, 0xDB,
+    0x5D, 0xFE, 0xA2, 0x7D, 0x28, 0x7F, 0xE7, 0x4F, 0x04, 0xE0, 0xE5, 0x3F, 0x5C, 0x4A, 0x01, 0x4D,
+    0x9D, 0xDA, 0x6D, 0xE2, 0x20, 0xF3, 0xAB, 0x81, 0xED, 0xF2, 0x70, 0x7C, 0x2F, 0x3B, 0x0D, 0x97,
+    0xF8, 0x7D, 0x86, 0xDD, 0xA3, 0x0D, 0x45, 0xBD, 0x04, 0xD8, 0x0D, 0x92, 0xFA, 0xBD, 0xE7, 0x74,
+    0x79, 0xAF, 0x71, 0xED, 0x9D, 0xD9, 0x3D, 0x96, 0xD8, 0xBD, 0x8E, 0xD9, 0xDD, 0xFC, 0x36, 0x39,
+    0x2D, 0x89, 0x0D, 0x95, 0xD8, 0x6D, 0x9F, 0xD8, 0x2D, 0xE1, 0x21, 0xB8, 0xEF, 0x53, 0x8D, 0xA1,
+    0xD9, 0x4D, 0x88, 0xFE, 0xE3, 0x47, 0x12, 0xB5, 0xFE, 0x27, 0xBB, 0xFB, 0x4A, 0xED, 0xE0, 0x2B,
+    0x3C, 0x2D, 0x29, 0x9D, 0xEB, 0x3A, 0x10, 0x3F, 0xC1, 0x7D, 0x80, 0xD8, 0x5D, 0x9D, 0xD8, 0x8D,
+    0x8E, 0xFF, 0x63, 0xDF, 0x07, 0xAE, 0x0F, 0xDB, 0x9F, 0xDE, 0xF3, 0x7E, 0xDA, 0x62, 0x4D, 0xC0,
+    0x21, 0x3A, 0xA8, 0xE8, 0xCD, 0x9A, 0xDA, 0x4D, 0x87, 0xD8, 0x3D, 0xF1, 0xB9, 0xDC, 0x6C, 0x60,
+    0x1D, 0x90, 0xDF, 0xE2, 0x6B, 0x69, 0x81, 0x91, 0xD8, 0x6D, 0xAC, 0xDB, 0xCF, 0x86, 0xD9, 0xED,
+    0xA4, 0xDC, 0x22, 0xD3, 0x58, 0x88, 0x15, 0xD8, 0x8F, 0xBC, 0xDC, 0x32, 0x5F, 0xFB, 0x94, 0x89,
+    0xDF, 0x83, 0x45, 0xC3, 0xD9, 0x84, 0xDE, 0xC2, 0xED, 0x32, 0xEB, 0xB3, 0xFC, 0x23, 0x13, 0x06,
+    0xF2, 0xBA, 0xD8, 0x8D, 0x86, 0xDE, 0x8E, 0x49, 0x5B, 0x8A, 0x93, 0xDE, 0x63, 0x59, 0xB3, 0xC0,
+    0x94, 0xD8, 0xDD, 0x86, 0xDB, 0x2D, 0xAF, 0xD8, 0x6D, 0xC4, 0x69, 0x7B, 0x19, 0xD2, 0x5D, 0x8F,
+    0xDA, 0x6D, 0x83, 0xD8, 0x1D, 0x9A, 0xDB, 0x2D, 0x82, 0xDC, 0xA3, 0xCD, 0x2B, 0xA8, 0x6B, 0x3A,
+    0x10, 0x3F, 0xC3, 0x3D, 0xDA, 0x21, 0x52, 0xED, 0x61, 0x3D, 0x71, 0x30, 0x12, 0x4F, 0x8F, 0x3B,
+    0x61, 0x67, 0xA5, 0xE9, 0x87, 0x6D, 0x56, 0xC5, 0x6C, 0x46, 0xEF, 0x79, 0xBF, 0x6D, 0x31, 0x66,
+    0xCC, 0xEC, 0x1E, 0xCC, 0xED, 0x3E, 0xD8, 0x6C, 0xA6, 0xC1, 0xEC, 0x66, 0xD7, 0x72, 0x49, 0x30,
+    0xD9, 0x26, 0xD8, 0x2D, 0xA1, 0xFF, 0xEA, 0x27, 0xD2, 0x87, 0x89, 0xD8, 0xED, 0x90, 0xD8, 0xED,
+    0x94, 0xD9, 0x1F, 0xC2, 0x26, 0xFA, 0xBB, 0xC9, 0x2D, 0xB9, 0xDA, 0x3D, 0x84, 0xDE, 0x22, 0x0F,
+    0x3A, 0xB8, 0x0D, 0xDB, 0x0D, 0x81, 0xDE, 0x82, 0xAB, 0xB0, 0xEC, 0x85, 0xDA, 0xED, 0x84, 0xD9,
+    0x2D, 0x80, 0xD9, 0x5D, 0x94, 0xDB, 0xDD, 0xCF, 0xAF, 0x9E, 0x3F, 0x57, 0x82, 0x33, 0x9F, 0xDC,
+    0x84, 0xDB, 0x4D, 0xE3, 0x05, 0x6B, 0xF1, 0x25, 0x87, 0xD3, 0xAA, 0x3B, 0x6D, 0xC7, 0xD0, 0x26,
+    0xDA, 0x6D, 0x2E, 0xE4, 0x3A, 0x9A, 0x5F, 0x3D, 0x2E, 0xD3, 0xEF, 0xC1, 0x01, 0xF2, 0x60, 0x10,
+    0xEF, 0xC1, 0x62, 0xF7, 0x69, 0x84, 0xEC, 0x16, 0xC9, 0xED, 0x16, 0xC3, 0xEE, 0x53, 0x6E, 0x8C,
+    0x71, 0x6A, 0x1D, 0x0E, 0xE7, 0x9C, 0x1E, 0xDA, 0xEF, 0x47, 0x24, 0xAD, 0xC5, 0x4D, 0x6D, 0x26,
+    0xD1, 0x6C, 0xCE, 0xD1, 0xEC, 0x9E, 0xF4, 0x15, 0x2C, 0x65, 0x80, 0x7E, 0xE3, 0xB4, 0xFE, 0x56,
+    0x27, 0xC1, 0x29, 0xAF, 0x5D, 0x4E, 0x6E, 0xB1, 0x5A, 0x8E, 0x67, 0xC3, 0xEC, 0x2E, 0xC0, 0xEC,
+    0xC6, 0xD2, 0x6D, 0x96, 0xCB, 0x6C, 0x06, 0xC8, 0xEC, 0xE6, 0xC0, 0x6D, 0x3E, 0xC6, 0xEE, 0x21,
+    0xE4, 0xE3, 0x51, 0xD5, 0xEC, 0x36, 0xEF, 0x79, 0xBF, 0x6D, 0x30, 0xBE, 0xC7, 0xEC, 0xDE, 0xC3,
+    0xEF, 0x7F, 0xBE, 0xAA, 0x4B, 0x5F, 0xED, 0x96, 0xE4, 0x1C, 0x68, 0xFE, 0xC2, 0x2B, 0xEA, 0xB2,
+    0xCD, 0x70, 0x14, 0x8C, 0x8D, 0xF7, 0x81, 0x3A, 0xD6, 0xF1, 0x04, 0x6C, 0x2E, 0xD5, 0xEC, 0xA6,
+    0xC1, 0x6C, 0x0E, 0xC8, 0xFE, 0x7D, 0x7C, 0xF1, 0xFA, 0x88, 0x6D, 0xD7, 0xC1, 0x6D, 0x2E, 0xF1,
+    0x10, 0x79, 0xD5, 0xC0, 0xE6, 0xC3, 0xED, 0x86, 0xEF, 0x73, 0xEF, 0x6D, 0x31, 0x4E, 0xDF, 0x7C,
+    0x16, 0xE2, 0x34, 0xBD, 0x8C, 0xE8, 0x66, 0xCC, 0x6C, 0xFE, 0xF4, 0x72, 0x4A, 0xDC, 0x55, 0xAF,
+    0xD7, 0x6C, 0x3E, 0xC2, 0x6C, 0xE6, 0xC5, 0xEE, 0x51, 0xDF, 0xA3, 0xD5, 0xC3, 0x6D, 0x8F, 0xC2,
+    0x6C, 0xC6, 0xC7, 0xEC, 0x06, 0xCA, 0xEE, 0xB1, 0x90, 0xE4, 0x4A, 0x44, 0x6C, 0x76, 0xDA, 0xEF,
+    0xF1, 0x3D, 0xDF, 0xDA, 0x4A, 0x6C, 0x86, 0xCA, 0x6C, 0x76, 0xD4, 0x6C, 0x1E, 0xFC, 0x11, 0x1E,
+    0xD6, 0x5C, 0x36, 0xEE, 0x1D, 0x2F, 0x64, 0x28, 0xCE, 0xC6, 0xEE, 0x21, 0x25, 0x85, 0x60, 0x57,
+    0x6F, 0xC1, 0x90, 0xA4, 0xE3, 0x87, 0x6C, 0x16, 0xC0, 0xED, 0x86, 0xFF, 0x51, 0x3E, 0x94, 0x3E,
+    0x53, 0x6E, 0x8C, 0x71, 0x76, 0x17, 0xCE, 0x56, 0x50, 0x16, 0xF0, 0x90, 0xDC, 0x77, 0xA8, 0xE6,
+    0xC3, 0x6D, 0xAE, 0xC2, 0x6C, 0x16, 0xC6, 0xFD, 0xCF, 0xE2, 0xBE, 0xAB, 0x2C, 0xD6, 0x31, 0x5D,
+    0xFC, 0xD1, 0xA7, 0xD7, 0xCF, 0x1F, 0xA9, 0x06, 0xC1, 0xEC, 0x4E, 0xF1, 0x1F, 0xBE, 0x4E, 0xD1,
+    0x46, 0xF8, 0xDC, 0xEE, 0x36, 0x33, 0xF1, 0x25, 0x87, 0xD3, 0xAC, 0x1E, 0x5F, 0x75, 0x19, 0x0E,
+    0xF4, 0x16, 0x4D, 0xF7, 0xF2, 0x19, 0x2F, 0xFD, 0xCA, 0x5A, 0x6D, 0xDF, 0xC6, 0x6D, 0x56, 0xC9,
+    0xEC, 0x86, 0xF8, 0x17, 0xDF, 0x3E, 0x00, 0x0E, 0xC5, 0x6D, 0x9F, 0xC7, 0x6C, 0xEE, 0xC5, 0xEC,
+    0x7E, 0xE4, 0x1A, 0xBE, 0x27, 0xB6, 0xE1, 0x79, 0xD9, 0x5B, 0x12, 0xEC, 0x36, 0xD5, 0xEC, 0xCE,
+    0xC6, 0xEC, 0xEE, 0xEF, 0x79, 0xBF, 0x6D, 0x30, 0xF6, 0xD7, 0x6D, 0xC7, 0xE5, 0x11, 0x6A, 0x95,
+    0x61, 0x6E, 0xE2, 0x34, 0xBD, 0x8C, 0xEB, 0x93, 0x83, 0xE1, 0x79, 0xCF, 0xEE, 0x41, 0x82, 0x9D,
+    0x7C, 0x75, 0x9D, 0x08, 0x1F, 0xE1, 0x1E, 0xC9, 0x6C, 0x26, 0xCC, 0xEE, 0x21, 0xCE, 0xA0, 0x77,
+    0xCF, 0x6D, 0x36, 0xEB, 0x1C, 0xFA, 0x1C, 0x39, 0x16, 0xE5, 0x36, 0xE8, 0xC7, 0x14, 0x46, 0xD0,
+    0x6C, 0x86, 0xDC, 0xF0, 0x56, 0x86, 0x6C, 0x9E, 0xD2, 0xEC, 0xF6, 0xC6, 0xEE, 0x7D, 0x7C, 0xF1,
+    0xFA, 0x9A, 0x6C, 0xB6, 0xC7, 0x6C, 0x6E, 0xD0, 0xED, 0x56, 0xC1, 0x6C, 0x06, 0xC4, 0xEC, 0x3E,
+    0xC6, 0x6E, 0x31, 0xC0, 0xD6, 0xD8, 0xD7, 0x6E, 0xA1, 0xD8, 0x96, 0x54, 0xD4, 0x6C, 0xA7, 0xDA,
+    0xEC, 0x96, 0xE4, 0x3A, 0x9A, 0x5F, 0x3C, 0x06, 0xCA, 0x6C, 0x6E, 0xC2, 0xEC, 0xF6, 0xF8, 0x9F,
+    0x49, 0x05, 0x21, 0x2E, 0xDC, 0xEC, 0x36, 0xC1, 0xEC, 0x8E, 0xD6, 0xEC, 0x7E, 0xD4, 0xEC, 0x7E,
+    0xCF, 0x6C, 0xCE, 0xD4, 0x6C, 0x16, 0xC9, 0x6D, 0x2E, 0xC3, 0xED, 0x06, 0xC1, 0xEF, 0x8D, 0xCE,
+    0xE3, 0x63, 0x06, 0x6F, 0x61, 0x3A, 0xA8, 0xC6, 0x09, 0x6C, 0x26, 0xC9, 0x6C, 0xCE, 0xC4, 0xED,
+    0x2E, 0xD6, 0xED, 0x0F, 0xCD, 0x6E, 0x9B, 0xE2, 0xD4, 0x4A, 0x46, 0x6E, 0xF1, 0xCB, 0xFE, 0xE4,
+    0x52, 0xEC, 0x56, 0xCC, 0x6C, 0x56, 0xD0, 0x6C, 0x46, 0xE3, 0xB4, 0xFE, 0x56, 0x26, 0xF7, 0x9B,
+    0xF6, 0xD3, 0x08, 0x6C, 0xF6, 0xC0,
+};
+
+constexpr uint8_t FIXTURE_PATCH[] = {
+    0x54, 0x42, 0x5A, 0x31, 0x0B, 0x04, 0x00, 0x00, 0x9C, 0x1F, 0x00, 0x00, 0xAA, 0x50, 0xA8, 0x93,
+    0x18, 0x07, 0x02, 0x01, 0x00, 0xBF, 0xEC, 0xFE, 0x7A, 0xCD, 0x87, 0x12, 0x01, 0x00, 0xD0, 0x67,
+    0x20, 0x30, 0x0F, 0x44, 0x1E, 0x4B, 0x01, 0xF8, 0x60, 0xE0, 0x30, 0x1B, 0x8D, 0xFA, 0x03, 0x14,
+    0xC1, 0xC3, 0x20, 0x3C, 0xC9, 0x84, 0x06, 0x93, 0xB8, 0x80, 0xC0, 0x6C, 0xB1, 0xA8, 0x0C, 0xBF,
+    0x03, 0x13, 0x80, 0xF5, 0xF0, 0x30, 0xB8, 0x0E, 0x6F, 0x13, 0x07, 0x80, 0xD0, 0xFA, 0x10, 0x18,
+    0x0C, 0xFF, 0x81, 0x02, 0x80, 0xE8, 0xF5, 0xD0, 0x68, 0x0C, 0x12, 0x06, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E,
+    0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x5E, 0x00, 0x4B,
+    0xB2, 0x01, 0x1F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00,
+    0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2F, 0x00, 0x2D, 0x84, 0xC1, 0x20, 0x13, 0x78, 0x04, 0x12,
+    0x01, 0xEF, 0x80, 0x00, 0xCF, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80,
+    0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80,
+    0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80,
+    0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80,
+    0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80, 0x17, 0x80,
+    0x11, 0x41, 0x60, 0x93, 0x08, 0x01, 0x33, 0xF8, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78,
+    0x01, 0x78, 0x01, 0x78, 0x01, 0x14, 0x16, 0x09, 0x00, 0x80, 0x7C, 0x80, 0x57, 0xC0, 0x0B, 0xC0,
+    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
+    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0,
+    0x0B, 0xC0, 0x0B, 0xC0, 0x0B, 0xC0, 0x08, 0xAC, 0x40, 0x23, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05,
+    0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05,
+    0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE5, 0x10,
+    0x79, 0x20, 0x15, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
+    0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
+    0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
+    0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0, 0x02, 0xF0,
+    0x02, 0xDA, 0x18, 0x08, 0xF8, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01,
+    0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x78, 0x01, 0x49, 0x66, 0x9E, 0x70,
+    0x05, 0x7C, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
+    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
+    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC,
+    0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0x9A, 0x0B, 0x04, 0xAE, 0xC0, 0x20, 0x00,
+    0x2B, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0,
+    0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0,
+    0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0,
+    0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0,
+    0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0, 0x05, 0xE0,
+    0x05, 0xE0, 0x05, 0xE8, 0xE4, 0xA0, 0x25, 0xF0, 0x48, 0x06, 0x24, 0xAE, 0x7C, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00,
+    0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xBC, 0x00, 0xAF, 0x3F, 0x05, 0x80, 0xD7, 0x78, 0xD1, 0x18,
+    0x0F, 0x53, 0x79, 0x05, 0xC8, 0x53, 0xB7, 0x90, 0x58, 0x07, 0x46, 0x0F, 0x01, 0xBA, 0xEB, 0x20,
+    0x30, 0x1B, 0xAC, 0x92, 0x03, 0xEE, 0xE4, 0x44, 0x60, 0x36, 0xCC, 0x04, 0x0A, 0x03, 0x50, 0xF5,
+    0x43, 0x20, 0x39, 0x7E, 0x04, 0x32, 0x03, 0xAD, 0x99, 0x40, 0x62, 0x9A, 0x88, 0x14, 0x06, 0x2D,
+    0xD8, 0x81, 0x40, 0x68, 0x78, 0x38, 0x34, 0x07, 0x6B, 0xA0, 0x81, 0x40, 0x6E, 0x9B, 0x88, 0x24,
+    0x06, 0x39, 0x8A, 0x82, 0x40, 0x7F, 0x3D, 0x88, 0x0C, 0x66, 0x7D, 0x3A, 0xDA, 0xC7, 0xE6, 0xFD,
+    0x0D, 0xFC, 0xE7, 0x71, 0xEE, 0xDA, 0x74, 0xE7, 0x9B, 0x8A, 0xFE, 0x2B, 0xBD, 0x7D, 0x9F, 0xEF,
+    0xFB, 0xDD, 0x8D, 0x14, 0x72, 0x93, 0xEA, 0xC7, 0x78, 0x6E, 0x9A, 0x6C, 0xD5, 0xAE, 0x83, 0xC7,
+    0xBD, 0x5F, 0xAF, 0xDA, 0xEE, 0xFE, 0x76, 0xE7, 0x29, 0xDA, 0x5D, 0xAC, 0xB3, 0xDD, 0x37, 0x6E,
+    0xE9, 0xCE, 0xFE, 0xDF, 0x68, 0x90, 0xFB, 0x45, 0xDF, 0xCB, 0x29, 0xDC, 0x65, 0x33, 0x12, 0xEE,
+    0x05, 0x4F, 0x9F, 0xE2, 0xF6, 0x6C, 0x35, 0x72, 0xCD, 0xEF, 0x2F, 0x6F, 0xC7, 0xE0, 0x61, 0xE5,
+    0x77, 0x68, 0x0C, 0x17, 0x3F, 0xFB, 0xF0, 0x61, 0x34, 0x98, 0x6E, 0xC4, 0x6E, 0xD9, 0xF1, 0xB4,
+    0xC7, 0x21, 0x30, 0xFF, 0xC4, 0x6E, 0x19, 0xED, 0xEE, 0xF2, 0xB4, 0x3B, 0xDA, 0x16, 0x76, 0x19,
+    0xDE, 0xDF, 0xEA, 0x66, 0xBE, 0x0A, 0xAD, 0x3F, 0x67, 0xD7, 0xBC, 0x60, 0xEC, 0xBB, 0xBC, 0x7C,
+    0x5B, 0x77, 0x30, 0x8D, 0xD3, 0x7C, 0x31, 0xDE, 0x0F, 0x96, 0xF1, 0x99, 0xEC, 0x5C, 0xB5, 0x9A,
+    0xE9, 0x6F, 0x1B, 0x1B, 0x2F, 0xC8, 0xE4, 0x2F, 0x15, 0xDB, 0xA5, 0xD2, 0x33, 0xC2, 0xFA, 0x5D,
+    0xE5, 0xD3, 0x1F, 0x64, 0xAE, 0x07, 0x16, 0x83, 0x7E, 0xA2, 0x18, 0x5D, 0x16, 0x66, 0x49, 0xD3,
+    0xD8, 0xF2, 0x20, 0x1C, 0x7F, 0xE6, 0x9B, 0x07, 0x4C, 0xDF, 0x79, 0xA1, 0x15, 0x1F, 0x9F, 0xBF,
+    0x6B, 0x10, 0xD7, 0xC3, 0x70, 0xD8, 0xAC, 0x9C, 0xBA, 0xCB, 0xE9, 0xC3, 0x4A, 0xFA, 0xD4, 0x9D,
+    0xAF, 0xFA, 0x6D, 0xAC, 0xE6, 0xF9, 0xFE, 0xDE, 0xE8, 0xC6, 0xB2, 0x0D, 0xC0, 0xBA, 0xFF, 0x63,
+    0x12, 0xEC, 0x56, 0xEA, 0x35, 0x5A, 0x98, 0x7E, 0x7F, 0xF0, 0x2A, 0x0F, 0xC7, 0x6D, 0x44, 0xB5,
+    0x76, 0x24, 0x71, 0x3F, 0x57, 0x13, 0x61, 0xA0, 0xE1, 0x6B, 0xA4, 0x9B, 0x7F, 0xB6, 0xE3, 0x41,
+    0x65, 0xD1, 0x76, 0x36, 0xB9, 0x18, 0x66, 0xBE, 0xDD, 0xBC, 0x9E, 0xE0, 0x7A, 0xD9, 0x39, 0x94,
+    0x67, 0x13, 0x08, 0xF7, 0x5C, 0xB9, 0x96, 0xAC, 0x9F, 0xDB, 0x8B, 0xB0, 0xC3, 0xC6, 0x32, 0x57,
+    0x0D, 0x6C, 0xDE, 0x13, 0xCE, 0xBE, 0xD4, 0xBF, 0xB0, 0xBB, 0xCC, 0xD3, 0xF9, 0xA8, 0xE9, 0xC0,
+    0xFC, 0x1D, 0x89, 0xAD, 0xFA, 0x4F, 0xE7, 0x8E, 0xE9, 0x20, 0xDB, 0xAB, 0x86, 0x67, 0x57, 0xEF,
+    0xFC, 0x41, 0x2C, 0xF2, 0xEA, 0xDD, 0x4A, 0xE3, 0x05, 0xD9, 0xC7, 0xAB, 0x1C, 0xAB, 0xD7, 0x7B,
+    0x3B, 0x17, 0xA8, 0x71, 0x3D, 0x1A, 0x1B, 0x46, 0x6F, 0x17, 0xE0, 0xF7, 0x4C, 0x73, 0x3D, 0xD8,
+    0xBE, 0x03, 0x37, 0xF8, 0xB1, 0xCB, 0xF6, 0x71, 0x0D, 0xDF, 0x87, 0x29, 0x17, 0xB1, 0xE9, 0xEB,
+    0xF5, 0x9F, 0x16, 0x8B, 0x2B, 0x2D, 0xAF, 0xD2, 0xEB, 0xDA, 0x1B, 0xA5, 0xBB, 0xD7, 0x56, 0x9C,
+    0x77, 0x71, 0xF1, 0x6A, 0x6D, 0x37, 0x63, 0xD2, 0xA3, 0x46, 0xF3, 0x7D, 0xFC, 0x7C, 0xBE, 0xD7,
+    0x5E, 0xA2, 0x64, 0xA6, 0x31, 0x19, 0xC4, 0x5A, 0xF9, 0x11, 0xFA, 0xE2, 0x6C, 0xF6, 0x09, 0xF5,
+    0x2E, 0xF9, 0xD7, 0x9D, 0xFF, 0x32, 0x59, 0x7E, 0xF6, 0x9A, 0x49, 0x96, 0x94, 0xE7, 0xA1, 0x97,
+    0xEC, 0x47, 0x8A, 0x45, 0x96, 0xCD, 0xD4, 0x67, 0xD2, 0xBD, 0x95, 0x2B, 0x7D, 0xAE, 0xA0, 0xD2,
+    0x7B, 0x99, 0x5F, 0x25, 0x3A, 0x2F, 0xF5, 0xC4, 0xCE, 0x39, 0x94, 0x7B, 0xBE, 0x9E, 0x5B, 0xBE,
+    0xF0, 0x4B, 0x6D, 0x3C, 0x9D, 0x46, 0x66, 0xB7, 0x89, 0xF6, 0xCA, 0x6B, 0xFD, 0x1A, 0x97, 0x3F,
+    0x59, 0x26, 0xA0, 0xF9, 0x3E, 0xB9, 0x0D, 0x04, 0x32, 0x59, 0x68, 0xB0, 0xCD, 0x3C, 0xFE, 0x2F,
+    0x4D, 0xB2, 0xEF, 0xC9, 0x9A, 0xDE, 0x71, 0x12, 0xAA, 0x04, 0x8B, 0x77, 0x9E, 0xAA, 0xC1, 0x20,
+    0x54, 0x89, 0x84, 0x0B, 0x8D, 0xFE, 0xAF, 0x7B, 0x2A, 0xFA, 0xEE, 0xFE, 0x17, 0xD7, 0x83, 0x9B,
+    0x40, 0x3D, 0x78, 0x9C, 0x0D, 0x62, 0x5D, 0xEE, 0xFE, 0xC3, 0x77, 0x7A, 0x1B, 0x15, 0xA3, 0xF1,
+    0x79, 0xD6, 0x63, 0x6A, 0x97, 0x4F, 0x47, 0x12, 0x8F, 0xB3, 0xB4, 0x5F, 0xE6, 0x5B, 0xED, 0xF4,
+    0x57, 0xED, 0x5F, 0x8A, 0xF2, 0xE7, 0x58, 0xFA, 0xAD, 0x32, 0x63, 0x8C, 0x92, 0x4A, 0xB9, 0x19,
+    0xE8, 0xE4, 0x5A, 0x79, 0x08, 0xAD, 0x76, 0xEE, 0xFC, 0x4C, 0x2C, 0xB6, 0xD7, 0x8A, 0xCF, 0x74,
+    0xA0, 0xDA, 0x69, 0xEF, 0xAE, 0x3F, 0xAA, 0xFD, 0x6B, 0x71, 0x9C, 0x2D, 0xC4, 0x13, 0xD7, 0x57,
+    0xC3, 0x4A, 0x3B, 0xF8, 0xDF, 0x7D, 0x32, 0xAD, 0xEE, 0x84, 0xC7, 0xBB, 0x58, 0xC9, 0x84, 0x8F,
+    0xD7, 0x67, 0xA4, 0xE0, 0xA0, 0xD5, 0x68, 0x27, 0x57, 0xF9, 0x43, 0xED, 0x5B, 0x30, 0x71, 0x78,
+    0xCC, 0x8A, 0x0B, 0x45, 0xA0, 0xD3, 0xF5, 0x39, 0x3C, 0xD7, 0xCF, 0x63, 0x96, 0x8E, 0x53, 0x23,
+    0xFD, 0xF8, 0xDD, 0x83, 0xCD, 0xE1, 0xC2, 0xE9, 0x23, 0x19, 0x78, 0xDE, 0x9B, 0x9F, 0xE9, 0xA0,
+    0x55, 0xF4, 0x56, 0x8E, 0x2F, 0xEA, 0x7B, 0x99, 0x96, 0xD7, 0xE8, 0xFA, 0x3F, 0xEF, 0x57, 0x85,
+    0x02, 0xED, 0x75, 0x3D, 0x32, 0x3A, 0x1C, 0x12, 0x49, 0xAB, 0x95, 0x55, 0x61, 0x32, 0xFD, 0xE6,
+    0x2A, 0xFB, 0xAE, 0xDD, 0xFE, 0x39, 0x31, 0x5B, 0x4C, 0x0A, 0xEF, 0x53, 0xF8, 0xD6, 0x21, 0x73,
+    0x69, 0x64, 0x62, 0x5B, 0x2D, 0x9B, 0xE8, 0xFE, 0xB4, 0x5C, 0x9E, 0xB3, 0x35, 0x57, 0xED, 0x6D,
+    0x21, 0x9E, 0xEE, 0x36, 0x4E, 0xF5, 0xDF, 0xDC, 0x6B, 0xE5, 0xB1, 0xFE, 0x2D, 0x83, 0x25, 0x00,
+    0xD8, 0xF0, 0x21, 0x3F, 0x6D, 0xB5, 0xC2, 0x8D, 0x52, 0xC2, 0x66, 0xBF, 0xD3, 0x3D, 0xEC, 0x23,
+    0x51, 0xB6, 0xB2, 0x62, 0x3F, 0xD1, 0xB8, 0x76, 0xAB, 0xF1, 0x56, 0x8E, 0x77, 0x32, 0x30, 0x1F,
+    0x44, 0x1E, 0x01, 0x85, 0x84, 0xC0, 0x74, 0xB5, 0x48, 0x0D, 0x6F, 0xC7, 0x06, 0x80, 0xF2, 0x32,
+    0xB0, 0x68, 0x0F, 0xE3, 0xB7, 0x01, 0x80, 0xF5, 0xF4, 0xB0, 0xB8, 0x0F, 0x22, 0x81, 0x01, 0xF5,
+    0xFD, 0x60, 0x90, 0x1F, 0xA7, 0x7A, 0x17, 0x01, 0xB9, 0x77, 0xE0, 0x30, 0x1D, 0x1E, 0xAA, 0x05,
+    0x01, 0xB2, 0x7A, 0x20, 0x70, 0x19, 0x77, 0x6A, 0x0B, 0x01, 0xE5, 0xF1, 0x20, 0xB0, 0x1C, 0xDE,
+    0xD6, 0x09, 0x01, 0xDC, 0xFA, 0x22, 0x30, 0x1E, 0x0F, 0xFA, 0x17, 0x01, 0xF7, 0x7A, 0xE0, 0xB0,
+    0x19, 0x7E, 0x2A, 0x0B, 0x01, 0xEA, 0xD2, 0x20, 0x31, 0x9E, 0xEC, 0x1A, 0x03, 0x26, 0xF9, 0xC3,
+    0xA0, 0x3A, 0x83, 0x30, 0x28, 0x2E, 0x5A, 0x03, 0x01, 0xE6, 0xFA, 0xE0, 0x52, 0xAB, 0x4D, 0x63,
+    0x7F, 0x32, 0xB1, 0x57, 0xF7, 0x70, 0x68, 0x2D, 0xBF, 0x2F, 0x16, 0xD4, 0xC1, 0xF8, 0xB8, 0xBF,
+    0x46, 0x7B, 0x43, 0x04, 0xCF, 0xFC, 0x6E, 0xD4, 0x9F, 0xFF, 0xDE, 0x6B, 0x88, 0xEE, 0x67, 0xAB,
+    0x3F, 0xED, 0x34, 0x5F, 0x1F, 0x65, 0xC8, 0xC5, 0x61, 0x70, 0x7B, 0x4D, 0x56, 0x3D, 0x96, 0xE6,
+    0x6E, 0x3E, 0x98, 0x8D, 0xBF, 0x7F, 0x15, 0x56, 0xFD, 0xFE, 0xAC, 0x71, 0x78, 0xA7, 0x82, 0xA9,
+    0xFA, 0xB1, 0x4D, 0x30, 0xF8, 0x1C, 0x36, 0x3E, 0x77, 0xC8, 0xC8, 0xC3, 0xA0, 0x7A, 0x99, 0x74,
+    0xAF, 0x43, 0xD0, 0x94, 0xC8, 0x66, 0xBB, 0xEE, 0x8F, 0xD3, 0x21, 0x7B, 0xE4, 0xF4, 0x38, 0x5F,
+    0x5F, 0x26, 0x46, 0x99, 0x3C, 0xD4, 0xCE, 0x38, 0xFB, 0x29, 0x1F, 0x63, 0x6B, 0x64, 0xB4, 0x55,
+    0xEF, 0xBE, 0x7D, 0x44, 0xCB, 0x4D, 0xF7, 0xD7, 0xCD, 0xA0, 0x13, 0x7E, 0x0D, 0x3E, 0xE5, 0x23,
+    0x9D, 0xE0, 0x79, 0x5A, 0x0C, 0xDC, 0x47, 0x91, 0x77, 0xCA, 0xEC, 0xA7, 0x39, 0xFF, 0xFD, 0x3B,
+    0x2F, 0x8F, 0xE4, 0x64, 0x39, 0x5F, 0xB8, 0x27, 0xB6, 0x71, 0x24, 0xA3, 0x6F, 0x71, 0x5C, 0x7D,
+    0x97, 0x37, 0x93, 0x13, 0x88, 0xDA, 0x32, 0xD0, 0x4E, 0xBE, 0x2F, 0x87, 0x20, 0x80, 0xDB, 0xB2,
+    0x78, 0x8F, 0xDF, 0x36, 0x61, 0x1C, 0x98, 0xCC, 0x71, 0x3B, 0x4E, 0xB4, 0xBF, 0x23, 0x3F, 0xA3,
+    0xC1, 0x2C, 0x5A, 0xEA, 0xAF, 0x72, 0x53, 0x8F, 0xB2, 0xE8, 0xFF, 0x93, 0x9B, 0xB7, 0x7A, 0xDB,
+    0xB8, 0xF7, 0xFB, 0xFA, 0x94, 0x39, 0x6E, 0x3F, 0xB9, 0xF4, 0xE6, 0x61, 0xBC, 0x52, 0x8D, 0x37,
+    0x9B, 0x99, 0x8F, 0xE1, 0x72, 0x7E, 0xF0, 0x68, 0x6D, 0x9A, 0x63, 0xCB, 0xE1, 0xEC, 0x66, 0x35,
+    0xEA, 0x4D, 0xC3, 0x03, 0x26, 0xD2, 0xC7, 0xF5, 0x90, 0xF9, 0xB7, 0x66, 0x91, 0xD3, 0xEA, 0x48,
+    0x72, 0x95, 0x79, 0xAD, 0xDE, 0x19, 0xF4, 0xDB, 0x6D, 0x35, 0x7E, 0xDA, 0xC5, 0xEA, 0xA9, 0x8C,
+    0xB3, 0x6C, 0x70, 0x7C, 0xEB, 0x94, 0x13, 0x2D, 0x4C, 0xF2, 0x4A, 0xA7, 0x59, 0x8F, 0x36, 0xEF,
+    0x7B, 0xD4, 0x9F, 0x4E, 0x6F, 0x5C, 0x1D, 0xCD, 0x73, 0x1D, 0xF0, 0xAE, 0x54, 0x6C, 0x33, 0x4D,
+    0x45, 0x22, 0xBF, 0x6F, 0xEA, 0x7F, 0x74, 0x58, 0x6B, 0x3D, 0x2F, 0xD3, 0xEB, 0xFD, 0x70, 0xA5,
+    0x92, 0xCE, 0x27, 0x4E, 0xED, 0xA9, 0x92, 0x7C, 0xB2, 0x7B, 0x3E, 0x2F, 0x03, 0x6D, 0x32, 0x94,
+    0xFB, 0x3D, 0xFA, 0xCC, 0xDD, 0x57, 0x37, 0x48, 0xFB, 0xC9, 0x32, 0x14, 0x99, 0xCF, 0x26, 0x6B,
+    0x77, 0xCD, 0xFD, 0x79, 0xFF, 0x2C, 0x0D, 0xC6, 0x1B, 0xBD, 0xD0, 0x63, 0x27, 0xD5, 0x9A, 0x1D,
+    0x93, 0x63, 0xBE, 0xF6, 0x46, 0x31, 0xB6, 0xB8, 0x97, 0xE3, 0xA7, 0x6E, 0xA5, 0xDC, 0x34, 0x94,
+    0xBB, 0xFD, 0x6B, 0x05, 0x73, 0x80, 0xFE, 0xFF, 0xDB, 0x4A, 0x1F, 0x0B, 0x41, 0xB5, 0x87, 0x74,
+    0xA3, 0xB5, 0x2C, 0x44, 0x76, 0x57, 0x26, 0xC7, 0x72, 0xEA, 0xFF, 0xBD, 0x6C, 0x4A, 0xF1, 0x4C,
+    0x97, 0xED, 0xE0, 0xF2, 0xAA, 0xCE, 0x2E, 0x5D, 0xCD, 0xD3, 0x64, 0x32, 0xFD, 0x6A, 0x8D, 0x1A,
+    0x91, 0xA0, 0xC9, 0x44, 0x7D, 0x71, 0x3D, 0xF6, 0xBF, 0x45, 0x98, 0xB2, 0x7D, 0x69, 0xB7, 0xFA,
+    0x6C, 0x46, 0x41, 0xAA, 0xC0, 0xE5, 0x39, 0x95, 0xEB, 0xA5, 0x7B, 0xEB, 0xFA, 0xAF, 0x5A, 0x65,
+    0xD9, 0x6D, 0x4E, 0x5A, 0x3F, 0xA9, 0xB1, 0xE8, 0xB3, 0xD8, 0x88, 0xB7, 0x32, 0x35, 0x85, 0x98,
+    0xEB, 0xF7, 0x53, 0x2C, 0x35, 0xB3, 0xDF, 0xE2, 0xE2, 0xD7, 0x21, 0x1D, 0x68, 0xBF, 0xCB, 0x79,
+    0x49, 0xD8, 0xD9, 0xF1, 0xD1, 0x5C, 0x5C, 0xB3, 0x87, 0x87, 0xDE, 0x4F, 0x78, 0x55, 0x4E, 0x7D,
+    0xF7, 0x3F, 0xA4, 0x96, 0x50, 0xB1, 0x3C, 0xF8, 0x76, 0x7F, 0x0D, 0x96, 0xA1, 0xC6, 0xFE, 0x16,
+    0x08, 0x5D, 0x8F, 0x1D, 0x1D, 0xF0, 0xFE, 0xE8, 0xDE, 0xED, 0x2E, 0x7A, 0xCF, 0x0C, 0xC9, 0x6C,
+    0xFC, 0x5E, 0x9D, 0x1E, 0x43, 0x81, 0x82, 0xA5, 0x4B, 0x21, 0xDA, 0x0F, 0x0E, 0x4B, 0x1B, 0x64,
+    0xEB, 0x49, 0xA8, 0xD5, 0x4B, 0x66, 0x2A, 0xBD, 0x68, 0xC3, 0x63, 0x6C, 0x39, 0x0F, 0x96, 0xA7,
+    0x67, 0x47, 0xA2, 0xC9, 0xEF, 0x91, 0x2C, 0xD7, 0x66, 0x63, 0x1A, 0xF8, 0x7E, 0x77, 0x1E, 0xCF,
+    0x1C, 0x43, 0x33, 0xE4, 0xFD, 0xCC, 0x69, 0x1E, 0x89, 0x8E, 0xEF, 0xDF, 0xD2, 0xB3, 0xD8, 0xAB,
+    0xB1, 0x9D, 0x25, 0xEA, 0x9D, 0xBC, 0xF5, 0xD7, 0xFE, 0xBA, 0x18, 0x8C, 0x42, 0x5F, 0x40, 0xCE,
+    0xCD, 0x33, 0x71, 0x4B, 0x44, 0x67, 0xF1, 0xFD, 0xC7, 0x64, 0xE9, 0xB7, 0x7C, 0xA4, 0x07, 0x21,
+    0x32, 0xE9, 0xFC, 0x3B, 0xD0, 0x2E, 0x7F, 0x77, 0x69, 0x63, 0xE4, 0xF2, 0x24, 0x3C, 0x79, 0x4D,
+    0x03, 0xC5, 0x76, 0xB5, 0x47, 0xF0, 0xD3, 0x1F, 0x9F, 0x13, 0x91, 0x88, 0xBF, 0x6E, 0x34, 0xF3,
+    0x6E, 0x84, 0xFB, 0xC3, 0xB5, 0xD2, 0x79, 0xBC, 0x77, 0x3A, 0xDC, 0x6E, 0x07, 0xC2, 0xD9, 0xD4,
+    0x26, 0x12, 0xAE, 0x96, 0xAA, 0x21, 0x9A, 0xBC, 0x7C, 0xAF, 0xD6, 0xEE, 0x1C, 0xA7, 0xAD, 0x21,
+    0xC5, 0x7B, 0x69, 0x76, 0x1C, 0xC7, 0x22, 0x01, 0xFE, 0xBA, 0xF6, 0xB0, 0x7E, 0xAB, 0x45, 0x5F,
+    0x9B, 0x3A, 0x98, 0xD9, 0x71, 0xD6, 0x69, 0xB4, 0xE7, 0x35, 0x5F, 0x98, 0xE2, 0x23, 0x1B, 0xBE,
+    0xEF, 0x9E, 0x13, 0x8C, 0x92, 0xF9, 0xA5, 0x9C, 0x3F, 0x0F, 0x6E, 0x31, 0xFC, 0x84, 0xE4, 0x2D,
+    0x3B, 0x3E, 0xEE, 0x9E, 0x7D, 0x11, 0xCA, 0xD1, 0xBB, 0x52, 0xEC, 0x06, 0xF6, 0x9D, 0xC0, 0x85,
+    0x50, 0xF0, 0x38, 0x5D, 0x5D, 0xD2, 0xB1, 0x60, 0x86, 0xDC, 0x3B, 0x1A, 0xBD, 0x0E, 0xFA, 0xC9,
+    0xDB, 0xB3, 0xC4, 0xBF, 0x35, 0xDC, 0x7D, 0xD3, 0x9F, 0x25, 0xDE, 0x58, 0xA4, 0x7A, 0x9B, 0x95,
+    0x67, 0x21, 0x3D, 0xE8, 0x75, 0xE3, 0xD1, 0x29, 0x4D, 0xFB, 0x51, 0x24, 0xA9, 0x7E, 0xA2, 0x72,
+    0x1A, 0xAD, 0x0F, 0xA7, 0xF8, 0xF5, 0xC2, 0xA4, 0x50, 0xDD, 0x1D, 0x06, 0xD3, 0xB5, 0xD4, 0xF0,
+    0x2A, 0xB6, 0x8D, 0x4D, 0xFF, 0x7B, 0xEC, 0xB7, 0x55, 0xF7, 0xF0, 0x2D, 0x17, 0x0A, 0x0D, 0x59,
+    0xBE, 0x5A, 0xAE, 0x7F, 0x48, 0xE4, 0xC6, 0xF7, 0xF4, 0xCC, 0xEC, 0xFC, 0xFC, 0xFD, 0xFC, 0x3B,
+    0x09, 0xED, 0xEE, 0x59, 0xEF, 0x3B, 0xFE, 0x3F, 0x47, 0x3B, 0xA5, 0xD3, 0xC3, 0x61, 0x52, 0x48,
+    0xA6, 0x5B, 0x9F, 0xC1, 0xB5, 0x41, 0x61, 0xF6, 0xFB, 0x86, 0x6A, 0x3D, 0xFA, 0xF1, 0xD1, 0xB0,
+    0xD8, 0xEE, 0x75, 0xCB, 0x55, 0xBD, 0xE6, 0xFD, 0xFE, 0x94, 0x1F, 0x07, 0x8B, 0xEB, 0xBE, 0xBD,
+    0xF1, 0x31, 0xFF, 0x7E, 0xB5, 0xFB, 0x97, 0x0F, 0xB2, 0xD2, 0xEA, 0x1D, 0x69, 0x3D, 0x92, 0x2D,
+    0x43, 0xF0, 0xF4, 0x65, 0xDD, 0xB9, 0xA5, 0x77, 0xF7, 0x1E, 0xDB, 0x5F, 0xF2, 0xDB, 0xFC, 0xB5,
+    0x93, 0xD3, 0x26, 0xF1, 0xD7, 0xAB, 0x75, 0xEB, 0x37, 0xAE, 0x71, 0x5A, 0xF1, 0xEF, 0x24, 0x30,
+    0x4B, 0x5D, 0x12, 0xA1, 0xFB, 0xBE, 0x4B, 0x25, 0x73, 0xB8, 0xAC, 0xBF, 0xCD, 0x5B, 0xEA, 0xF8,
+    0x7E, 0x9E, 0x2D, 0xE6, 0xF6, 0x83, 0x6F, 0xE5, 0x5B, 0xAA, 0x1D, 0xCD, 0xAF, 0xB3, 0xD7, 0x35,
+    0xEA, 0x6D, 0x33, 0xFC, 0xDA, 0x74, 0x76, 0xB1, 0x60, 0xF7, 0x46, 0x3C, 0x70, 0xBC, 0x17, 0x12,
+    0xD7, 0x57, 0xC8, 0xD9, 0xA4, 0x99, 0x7C, 0x0C, 0x93, 0xD9, 0x8E, 0x8D, 0xE3, 0xF9, 0xD3, 0x6E,
+    0x84, 0x7F, 0x21, 0xAC, 0xEC, 0x42, 0xFB, 0xBC, 0x98, 0x45, 0x4F, 0x95, 0x41, 0x9C, 0xD6, 0x76,
+    0x98, 0x6C, 0x55, 0xAF, 0x81, 0x28, 0xC5, 0x75, 0xF8, 0x7F, 0x7F, 0xE4, 0x73, 0xB1, 0x08, 0xC0,
+    0xE5, 0x66, 0x15, 0xBD, 0x95, 0x9A, 0xF3, 0xF8, 0xD0, 0x54, 0x3F, 0x1B, 0xF9, 0xDF, 0xAB, 0xFF,
+    0xA9, 0xEA, 0x7F, 0x7A, 0x7F, 0xD9, 0x4C, 0x93, 0x5F, 0x26, 0xC0, 0x77, 0xBA, 0x32, 0xBB, 0xC4,
+    0x5B, 0xDB, 0xF5, 0x90, 0x59, 0x2F, 0xF1, 0xAB, 0xEF, 0xD2, 0xC9, 0x91, 0xB0, 0xFD, 0x7A, 0x53,
+    0x2B, 0xE7, 0x22, 0x95, 0xAA, 0x9A, 0xD5, 0xEB, 0x55, 0xD8, 0xF4, 0xDA, 0x9D, 0x88, 0xAE, 0xEE,
+    0xA3, 0x20,
+};
+
+#endif // HEATSHRINK_FIXTURE_H
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Tạo fixture.h cho test_heatshrink bằng chính tools/ota_compress.py.
+
+    python test/test_heatshrink/make_fixture.py
+
+Image được sinh như trong test_delta_patch/make_fixture.py (test_main.cpp sinh lại
+image cũ bằng cùng bộ sinh số), fixture chứa image mới nén với window mặc định và
+8 KiB đầu của nó với window nhỏ, cùng patch của test_delta_patch ở dạng nén.
+"""
+
+import importlib.util
+import os
+import sys
+import zlib
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.join(HERE, "..", "..", "tools"))
+
+import ota_compress  # noqa: E402
+import ota_delta  # noqa: E402
+
+SMALL_WINDOW_SIZE = 8 * 1024
+
+
+def load_delta_fixture():
+    spec = importlib.util.spec_from_file_location("delta_fixture", os.path.join(HERE, "..", "test_delta_patch", "make_fixture.py"))
+    module = importlib.util.module_from_spec(spec)
+    spec.loader.exec_module(module)
+    return module
+
+
+def compress(data, *args):
+    packed = ota_compress.compress(data, *args)
+    assert ota_compress.decompress(packed) == data
+    return packed
+
+
+def array(name, data):
+    lines = ["constexpr uint8_t %s[] = {" % name]
+    for start in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[start:start + 16]) + ",")
+    return lines + ["};", ""]
+
+
+def main():
+    delta_fixture = load_delta_fixture()
+    source = delta_fixture.source_image()
+    target = delta_fixture.target_image(source)
+    patch = ota_delta.make_patch(source, target)
+    image = compress(target)
+    # Window nhỏ nhất mà tool cho phép dùng với lookahead 3 bit, chỉ phần đầu image để fixture gọn
+    small_window = compress(target[:SMALL_WINDOW_SIZE], 8, 3)
+    compressed_patch = compress(patch)
+    lines = [
+        "// Tạo bởi make_fixture.py từ tools/ota_compress.py, không sửa trực tiếp",
+        "#ifndef HEATSHRINK_FIXTURE_H",
+        "#define HEATSHRINK_FIXTURE_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "constexpr uint32_t FIXTURE_SOURCE_SIZE = %dU;" % len(source),
+        "constexpr uint32_t FIXTURE_TARGET_SIZE = %dU;" % len(target),
+        "constexpr uint32_t FIXTURE_TARGET_CRC = 0x%08XU;" % zlib.crc32(target),
+        "constexpr uint32_t FIXTURE_SMALL_WINDOW_SIZE = %dU;" % SMALL_WINDOW_SIZE,
+        "constexpr uint32_t FIXTURE_SMALL_WINDOW_CRC = 0x%08XU;" % zlib.crc32(target[:SMALL_WINDOW_SIZE]),
+        "constexpr uint32_t FIXTURE_PATCH_SIZE = %dU;" % len(patch),
+        "",
+    ]
+    lines += array("FIXTURE_IMAGE", image)
+    lines += array("FIXTURE_IMAGE_SMALL_WINDOW", small_window)
+    lines += array("FIXTURE_PATCH", compressed_patch)
+    lines += ["#endif // HEATSHRINK_FIXTURE_H", ""]
+    with open(os.path.join(HERE, "fixture.h"), "w") as f:
+        f.write("\n".join(lines))
+    print("image %d -> %d (window 2^11), %d -> %d (window 2^8) bytes, patch %d -> %d bytes" %
+          (len(target), len(image), SMALL_WINDOW_SIZE, len(small_window), len(patch), len(compressed_patch)))
+
+
+if __name__ == "__main__":
+    main()
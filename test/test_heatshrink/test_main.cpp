@@ -0,0 +1,288 @@
+// HeatshrinkDecoder inflates streams made by tools/ota_compress.py (fixture.h, regenerated with make_fixture.py) in chunks of any size,
+// also straight into DeltaPatch like OtaImage does, rejects headers it cannot decode and never writes past the announced size
+#include <unity.h>
+#include <HeatshrinkDecoder.h>
+#include <DeltaPatch.h>
+#include <HashGenerator.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "fixture.h"
+
+namespace {
+
+/// @brief Same generator as test_delta_patch/make_fixture.py
+class XorShift32 {
+  public:
+    explicit XorShift32(const uint32_t& seed) : m_state(seed) {}
+
+    uint32_t next() {
+        m_state ^= m_state << 13U;
+        m_state ^= m_state >> 17U;
+        m_state ^= m_state << 5U;
+        return m_state;
+    }
+
+  private:
+    uint32_t m_state;
+};
+
+std::vector<uint8_t> source_image() {
+    XorShift32 random(0x12345678U);
+    uint32_t words[32];
+    for (uint32_t& word : words) {
+        word = random.next();
+    }
+    std::vector<uint8_t> image;
+    while (image.size() < FIXTURE_SOURCE_SIZE) {
+        const uint32_t value = random.next();
+        const uint32_t word = value % 8U == 0U ? value : words[value % 32U];
+        for (uint8_t i = 0U; i < 4U; i++) {
+            image.push_back(static_cast<uint8_t>(word >> (8U * i)));
+        }
+    }
+    image.resize(FIXTURE_SOURCE_SIZE);
+    return image;
+}
+
+/// @brief Collects the decompressed blocks, fails once the given amount of bytes was received
+struct Sink {
+    std::vector<uint8_t> data;
+    size_t largest_block = 0U;
+    size_t fail_after = SIZE_MAX;
+
+    static bool write(void* context, uint8_t* data, size_t length) {
+        Sink *sink = static_cast<Sink *>(context);
+        sink->data.insert(sink->data.end(), data, data + length);
+        sink->largest_block = std::max(sink->largest_block, length);
+        return sink->data.size() <= sink->fail_after;
+    }
+};
+
+/// @brief Running image and new partition, checks the base of the patch like OtaImage does
+class Fake_Target : public DeltaTarget {
+  public:
+    explicit Fake_Target(const std::vector<uint8_t>& source) : source(source) {}
+
+    bool readSource(size_t offset, uint8_t* buffer, size_t length) override {
+        if (offset + length > source.size()) {
+            return false;
+        }
+        memcpy(buffer, source.data() + offset, length);
+        return true;
+    }
+
+    bool beginTarget(uint32_t sourceSize, uint32_t sourceCrc, uint32_t targetSize) override {
+        return sourceSize == source.size() && sourceCrc == HashGenerator::crc32(0U, source.data(), source.size());
+    }
+
+    bool writeTarget(uint8_t* data, size_t length) override {
+        target.insert(target.end(), data, data + length);
+        return true;
+    }
+
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> target;
+};
+
+bool to_delta(void* context, uint8_t* data, size_t length) {
+    return static_cast<DeltaPatch *>(context)->feed(data, length);
+}
+
+HeatshrinkDecoder decoder;
+
+/// @brief Feeds the given stream in chunks of random size up to the given maximum
+bool feed(const uint8_t *data, const size_t& size, const uint32_t& max_chunk, const uint32_t& seed) {
+    std::mt19937 random(seed);
+    size_t position = 0U;
+    while (position < size) {
+        const size_t length = std::min<size_t>(1U + random() % max_chunk, size - position);
+        if (!decoder.feed(data + position, length)) {
+            return false;
+        }
+        position += length;
+    }
+    return true;
+}
+
+/// @brief Header of a stream with the given parameters, followed by no data
+std::vector<uint8_t> header(const uint8_t& window_bits, const uint8_t& lookahead_bits, const uint32_t& size) {
+    std::vector<uint8_t> stream(FIXTURE_IMAGE, FIXTURE_IMAGE + HEATSHRINK_HEADER_SIZE);
+    stream[4U] = window_bits;
+    stream[5U] = lookahead_bits;
+    memcpy(stream.data() + 8U, &size, sizeof(size));
+    return stream;
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_detects_compressed(void) {
+    TEST_ASSERT_TRUE(HeatshrinkDecoder::isCompressed(FIXTURE_IMAGE, sizeof(FIXTURE_IMAGE)));
+    TEST_ASSERT_TRUE(HeatshrinkDecoder::isCompressed(FIXTURE_PATCH, sizeof(FIXTURE_PATCH)));
+    TEST_ASSERT_FALSE(HeatshrinkDecoder::isCompressed(FIXTURE_IMAGE, 3U));
+    const uint8_t image[] = { 0xE9, 0x05, 0x02, 0x20 };
+    TEST_ASSERT_FALSE(HeatshrinkDecoder::isCompressed(image, sizeof(image)));
+}
+
+// The output matches the image the tool compressed, no matter how the stream is split, and is passed on in blocks of at most HEATSHRINK_OUTPUT_SIZE
+void test_round_trip(void) {
+    const uint32_t max_chunks[] = { 1U, 7U, 256U, 4096U, sizeof(FIXTURE_IMAGE) };
+    for (const uint32_t& max_chunk : max_chunks) {
+        Sink sink;
+        decoder.begin(Sink::write, &sink);
+        TEST_ASSERT_TRUE(feed(FIXTURE_IMAGE, sizeof(FIXTURE_IMAGE), max_chunk, max_chunk));
+        TEST_ASSERT_TRUE(decoder.finished());
+        TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, decoder.getOutputSize());
+        TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, sink.data.size());
+        TEST_ASSERT_EQUAL_HEX32(FIXTURE_TARGET_CRC, HashGenerator::crc32(0U, sink.data.data(), sink.data.size()));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(HEATSHRINK_OUTPUT_SIZE, sink.largest_block);
+    }
+}
+
+// Window and lookahead are read from the header, a smaller window than the device supports decodes as well
+void test_small_window(void) {
+    TEST_ASSERT_EQUAL_UINT_MESSAGE(8U, FIXTURE_IMAGE_SMALL_WINDOW[4U], "window bits");
+    Sink sink;
+    decoder.begin(Sink::write, &sink);
+    TEST_ASSERT_TRUE(feed(FIXTURE_IMAGE_SMALL_WINDOW, sizeof(FIXTURE_IMAGE_SMALL_WINDOW), 64U, 1U));
+    TEST_ASSERT_TRUE(decoder.finished());
+    TEST_ASSERT_EQUAL_UINT32(FIXTURE_SMALL_WINDOW_SIZE, sink.data.size());
+    TEST_ASSERT_EQUAL_HEX32(FIXTURE_SMALL_WINDOW_CRC, HashGenerator::crc32(0U, sink.data.data(), sink.data.size()));
+}
+
+// A compressed patch is inflated straight into DeltaPatch, the chain OtaImage uses for compressed delta downloads
+void test_compressed_patch(void) {
+    Fake_Target target(source_image());
+    DeltaPatch patch;
+    patch.begin(&target);
+    decoder.begin(to_delta, &patch);
+    TEST_ASSERT_TRUE(feed(FIXTURE_PATCH, sizeof(FIXTURE_PATCH), 1024U, 2U));
+    TEST_ASSERT_TRUE(decoder.finished());
+    TEST_ASSERT_EQUAL_UINT32(FIXTURE_PATCH_SIZE, decoder.getOutputSize());
+    TEST_ASSERT_TRUE(patch.finished());
+    TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, target.target.size());
+    TEST_ASSERT_EQUAL_HEX32(FIXTURE_TARGET_CRC, HashGenerator::crc32(0U, target.target.data(), target.target.size()));
+}
+
+// Windows larger than the buffer of the device and parameters heatshrink does not allow are refused before any output
+void test_rejects_header(void) {
+    struct Case {
+        uint8_t window_bits;
+        uint8_t lookahead_bits;
+        bool valid;
+    };
+    const Case cases[] = {
+        { 4U, 3U, true },
+        { HEATSHRINK_MAX_WINDOW_BITS, HEATSHRINK_MAX_WINDOW_BITS - 1U, true },
+        { HEATSHRINK_MAX_WINDOW_BITS + 1U, 4U, false },
+        { 3U, 2U, false },
+        { 8U, 2U, false },
+        { 8U, 8U, false },
+    };
+    for (const Case& test : cases) {
+        Sink sink;
+        decoder.begin(Sink::write, &sink);
+        const std::vector<uint8_t> stream = header(test.window_bits, test.lookahead_bits, 0U);
+        TEST_ASSERT_EQUAL_MESSAGE(test.valid, decoder.feed(stream.data(), stream.size()), "header accepted");
+        // An empty image is complete right after the header
+        TEST_ASSERT_EQUAL(test.valid, decoder.finished());
+    }
+
+    std::vector<uint8_t> stream(FIXTURE_IMAGE, FIXTURE_IMAGE + sizeof(FIXTURE_IMAGE));
+    stream[0U] = 'X';
+    Sink sink;
+    decoder.begin(Sink::write, &sink);
+    TEST_ASSERT_FALSE(decoder.feed(stream.data(), stream.size()));
+    TEST_ASSERT_EQUAL_UINT32(0U, sink.data.size());
+
+    decoder.begin(nullptr, nullptr);
+    TEST_ASSERT_FALSE(decoder.feed(FIXTURE_IMAGE, sizeof(FIXTURE_IMAGE)));
+}
+
+void test_truncated_and_trailing_data(void) {
+    Sink truncated;
+    decoder.begin(Sink::write, &truncated);
+    TEST_ASSERT_TRUE(decoder.feed(FIXTURE_IMAGE, sizeof(FIXTURE_IMAGE) - 1U));
+    TEST_ASSERT_FALSE(decoder.finished());
+    TEST_ASSERT_TRUE(truncated.data.size() < FIXTURE_TARGET_SIZE);
+
+    Sink trailing;
+    decoder.begin(Sink::write, &trailing);
+    std::vector<uint8_t> longer(FIXTURE_IMAGE, FIXTURE_IMAGE + sizeof(FIXTURE_IMAGE));
+    longer.push_back(0U);
+    TEST_ASSERT_FALSE(decoder.feed(longer.data(), longer.size()));
+    TEST_ASSERT_FALSE(decoder.finished());
+}
+
+// A failing sink, like a flash write error, stops the decoder
+void test_sink_failure(void) {
+    Sink sink;
+    sink.fail_after = 1000U;
+    decoder.begin(Sink::write, &sink);
+    TEST_ASSERT_FALSE(feed(FIXTURE_IMAGE, sizeof(FIXTURE_IMAGE), 512U, 3U));
+    TEST_ASSERT_FALSE(decoder.finished());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(sink.fail_after + HEATSHRINK_OUTPUT_SIZE, sink.data.size());
+}
+
+// Randomly corrupted streams never produce more than the size in the header and never complete with trailing garbage
+void test_corrupted_streams(void) {
+    std::mt19937 random(42U);
+    uint32_t rejected = 0U;
+    for (uint32_t trial = 0U; trial < 300U; trial++) {
+        std::vector<uint8_t> corrupted(FIXTURE_IMAGE, FIXTURE_IMAGE + sizeof(FIXTURE_IMAGE));
+        const uint8_t flips = 1U + random() % 4U;
+        for (uint8_t i = 0U; i < flips; i++) {
+            // Header stays intact, otherwise the stream is simply rejected
+            corrupted[HEATSHRINK_HEADER_SIZE + random() % (corrupted.size() - HEATSHRINK_HEADER_SIZE)] = static_cast<uint8_t>(random());
+        }
+        Sink sink;
+        decoder.begin(Sink::write, &sink);
+        const bool accepted = feed(corrupted.data(), corrupted.size(), 512U, trial);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(FIXTURE_TARGET_SIZE, sink.data.size());
+        if (accepted && decoder.finished()) {
+            TEST_ASSERT_EQUAL_UINT32(FIXTURE_TARGET_SIZE, sink.data.size());
+        }
+        else {
+            rejected++;
+        }
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, rejected);
+}
+
+void test_benchmark(void) {
+    constexpr uint8_t ROUNDS = 20U;
+    Sink sink;
+    sink.data.reserve(FIXTURE_TARGET_SIZE);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint8_t round = 0U; round < ROUNDS; round++) {
+        sink.data.clear();
+        decoder.begin(Sink::write, &sink);
+        for (size_t position = 0U; position < sizeof(FIXTURE_IMAGE); position += 1024U) {
+            decoder.feed(FIXTURE_IMAGE + position, std::min<size_t>(1024U, sizeof(FIXTURE_IMAGE) - position));
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_TRUE(decoder.finished());
+    char message[96];
+    snprintf(message, sizeof(message), "decoded %.1f MB/s, decoder state %u bytes",
+             ROUNDS * FIXTURE_TARGET_SIZE / seconds / 1e6, static_cast<unsigned>(sizeof(HeatshrinkDecoder)));
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_detects_compressed);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_small_window);
+    RUN_TEST(test_compressed_patch);
+    RUN_TEST(test_rejects_header);
+    RUN_TEST(test_truncated_and_trailing_data);
+    RUN_TEST(test_sink_failure);
+    RUN_TEST(test_corrupted_streams);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,225 @@
+// Helper::getJsonFields fuzzed with random documents: the counted fields have to be exactly the memory ArduinoJson needs to deserialize
+// the document in zero copy mode, one field less has to fail. Random bytes and truncated documents must not read past the given length.
+// Compared against the previous estimate that counted the colons of the payload
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <stdio.h>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace {
+
+std::mt19937 random_engine;
+
+std::string whitespace() {
+    static const char *const WHITESPACE[] = { "", "", "", " ", "\n  ", "\t", "\r\n" };
+    return WHITESPACE[random_engine() % 7U];
+}
+
+/// @brief String with the given quote, its content contains separators, brackets and escape sequences that must not be counted
+std::string string(const char& quote) {
+    static const char *const PARTS[] = { "abc", ",", ":", "{", "}", "[", "]", "\\\"", "\\\\", "\\n", "\\u00e9", "x y", "'", "\\/", "1,2" };
+    std::string result(1U, quote);
+    const uint32_t parts = random_engine() % 5U;
+    for (uint32_t i = 0U; i < parts; i++) {
+        std::string part = PARTS[random_engine() % 15U];
+        if (quote == '\'' && part == "'") {
+            part = "\\\"";
+        }
+        result += part;
+    }
+    return result + quote;
+}
+
+std::string value(const uint32_t& depth, size_t& fields);
+
+/// @brief Object with unique keys, quoted with either quote or not at all, which ArduinoJson accepts as well
+std::string object(const uint32_t& depth, size_t& fields) {
+    const uint32_t members = random_engine() % 6U;
+    std::string result = "{" + whitespace();
+    for (uint32_t i = 0U; i < members; i++) {
+        if (i != 0U) {
+            result += whitespace() + "," + whitespace();
+        }
+        const std::string key = "k" + std::to_string(i);
+        const uint32_t style = random_engine() % 4U;
+        result += style == 0U ? "'" + key + "'" : (style == 1U ? key : "\"" + key + "\"");
+        result += whitespace() + ":" + whitespace() + value(depth + 1U, fields);
+    }
+    fields += members;
+    return result + whitespace() + "}";
+}
+
+std::string array(const uint32_t& depth, size_t& fields) {
+    const uint32_t elements = random_engine() % 6U;
+    std::string result = "[" + whitespace();
+    for (uint32_t i = 0U; i < elements; i++) {
+        if (i != 0U) {
+            result += whitespace() + "," + whitespace();
+        }
+        result += value(depth + 1U, fields);
+    }
+    fields += elements;
+    return result + whitespace() + "]";
+}
+
+std::string value(const uint32_t& depth, size_t& fields) {
+    switch (random_engine() % (depth > 6U ? 6U : 9U)) {
+        case 0U:
+            return "123";
+        case 1U:
+            return "-1.5e3";
+        case 2U:
+            return "true";
+        case 3U:
+            return "null";
+        case 4U:
+            return string('"');
+        case 5U:
+            return string('\'');
+        case 6U:
+        case 7U:
+            return object(depth, fields);
+        default:
+            return array(depth, fields);
+    }
+}
+
+/// @brief Deserializes a copy of the given json in zero copy mode into a document with memory for the given amount of fields
+DeserializationError deserialize(const std::string& json, const size_t& fields, size_t *used = nullptr) {
+    // Exact size without null terminator, so the sanitizer catches reads past the length
+    std::unique_ptr<char[]> buffer(new char[json.size()]);
+    memcpy(buffer.get(), json.data(), json.size());
+    DynamicJsonDocument document(JSON_OBJECT_SIZE(fields));
+    const DeserializationError error = deserializeJson(document, buffer.get(), json.size());
+    if (used != nullptr) {
+        *used = document.memoryUsage();
+    }
+    return error;
+}
+
+size_t colons(const std::string& json) {
+    size_t count = 0U;
+    for (const char& character : json) {
+        count += character == ':';
+    }
+    return count;
+}
+
+} // namespace
+
+void setUp(void) {
+    random_engine.seed(7U);
+}
+
+void tearDown(void) {}
+
+// Random documents with nested objects and arrays, strings containing separators and every kind of whitespace
+void test_exact_for_random_documents(void) {
+    constexpr uint32_t DOCUMENTS = 20000U;
+    uint32_t colon_failures = 0U;
+    size_t colon_bytes = 0U;
+    size_t exact_bytes = 0U;
+    for (uint32_t i = 0U; i < DOCUMENTS; i++) {
+        size_t expected = 0U;
+        const std::string json = whitespace() + (random_engine() % 4U != 0U ? object(0U, expected) : array(0U, expected)) + whitespace();
+        const size_t fields = Helper::getJsonFields(json.data(), json.size());
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected, fields, json.c_str());
+        size_t used = 0U;
+        TEST_ASSERT_TRUE_MESSAGE(deserialize(json, fields, &used) == DeserializationError::Ok, json.c_str());
+        TEST_ASSERT_EQUAL_UINT32(JSON_OBJECT_SIZE(fields), used);
+        if (fields > 0U) {
+            TEST_ASSERT_TRUE_MESSAGE(deserialize(json, fields - 1U) == DeserializationError::NoMemory, json.c_str());
+        }
+
+        colon_failures += deserialize(json, colons(json)) != DeserializationError::Ok;
+        colon_bytes += JSON_OBJECT_SIZE(colons(json));
+        exact_bytes += JSON_OBJECT_SIZE(fields);
+    }
+
+    char message[160];
+    snprintf(message, sizeof(message), "%u documents: counting colons failed for %u and reserved %u bytes, exact size %u bytes",
+             DOCUMENTS, colon_failures, static_cast<unsigned>(colon_bytes), static_cast<unsigned>(exact_bytes));
+    TEST_MESSAGE(message);
+}
+
+// Random bytes and truncated documents terminate without reading past the given length
+void test_garbage_stays_in_bounds(void) {
+    for (uint32_t i = 0U; i < 50000U; i++) {
+        std::string json;
+        if (i % 2U == 0U) {
+            json.resize(random_engine() % 64U);
+            for (char& character : json) {
+                character = "{}[],\"'\\: a0"[random_engine() % 13U];
+            }
+        }
+        else {
+            size_t fields = 0U;
+            json = object(0U, fields);
+            json.resize(random_engine() % (json.size() + 1U));
+        }
+        std::unique_ptr<char[]> buffer(new char[json.size() + 1U]);
+        memcpy(buffer.get(), json.data(), json.size());
+        (void)Helper::getJsonFields(buffer.get(), json.size());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, Helper::getJsonFields(nullptr, 10U));
+    TEST_ASSERT_EQUAL_UINT32(0U, Helper::getJsonFields("{\"a\":1}", 0U));
+}
+
+// Typical ThingsBoard payloads, the scan is compared with counting colons and with deserializing the payload
+void test_benchmark(void) {
+    const char *const PAYLOADS[] = {
+        "{\"method\":\"setValue\",\"params\":{\"pin\":4,\"enabled\":true}}",
+        "{\"shared\":{\"fw_title\":\"BTL\",\"fw_version\":\"1.2.3\",\"fw_checksum\":\"0a1b2c3d4e5f60718293a4b5c6d7e8f90a1b2c3d4e5f60718293a4b5c6d7e8f9\","
+            "\"fw_checksum_algorithm\":\"SHA256\",\"fw_size\":1048576}}",
+        "{\"schedule\":[{\"at\":\"06:30\",\"on\":true},{\"at\":\"12:00\",\"on\":false},{\"at\":\"18:45\",\"on\":true}],\"label\":\"a, b: c\"}"
+    };
+    const size_t EXPECTED[] = { 4U, 6U, 11U };
+    constexpr uint32_t ROUNDS = 200000U;
+
+    for (size_t p = 0U; p < 3U; p++) {
+        const std::string json = PAYLOADS[p];
+        const size_t fields = Helper::getJsonFields(json.data(), json.size());
+        TEST_ASSERT_EQUAL_UINT32(EXPECTED[p], fields);
+        TEST_ASSERT_TRUE(deserialize(json, fields) == DeserializationError::Ok);
+
+        volatile size_t sink = 0U;
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < ROUNDS; i++) {
+            sink = sink + Helper::getJsonFields(json.data(), json.size());
+        }
+        const double scan_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ROUNDS;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < ROUNDS; i++) {
+            sink = sink + Helper::getOccurences(json.c_str(), ':');
+        }
+        const double colon_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ROUNDS;
+
+        std::string copy;
+        DynamicJsonDocument document(JSON_OBJECT_SIZE(fields));
+        start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < ROUNDS / 10U; i++) {
+            copy.assign(json);
+            document.clear();
+            deserializeJson(document, &copy[0], copy.size());
+        }
+        const double deserialize_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (ROUNDS / 10U);
+
+        char message[160];
+        snprintf(message, sizeof(message), "%u bytes, %u fields, %u colons: scan %.0f ns, counting colons %.0f ns, deserializing %.0f ns",
+                 static_cast<unsigned>(json.size()), static_cast<unsigned>(fields), static_cast<unsigned>(colons(json)),
+                 scan_ns, colon_ns, deserialize_ns);
+        TEST_MESSAGE(message);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_exact_for_random_documents);
+    RUN_TEST(test_garbage_stays_in_bounds);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,164 @@
+// MQTT_Client_Benchmark run through the loopback broker stand-in, with a simulated clock for exact latencies and with the real clock as a benchmark
+#include <unity.h>
+#include <MQTT_Client_Benchmark.h>
+#include <Loopback_MQTT_Client.h>
+#include <stdio.h>
+
+namespace {
+
+constexpr char TOPIC[] = "bench/loopback";
+constexpr uint16_t BUFFER_SIZE = 256U;
+
+// Simulated clock, every read advances it slightly and every loop of the client advances it further
+uint64_t simulated_now = 0U;
+
+uint64_t simulated_clock() {
+    simulated_now += 3U;
+    return simulated_now;
+}
+
+Loopback_MQTT_Client *heap_client = nullptr;
+constexpr size_t SIMULATED_HEAP = 1000000U;
+
+// Messages that are waiting in the broker stand-in count as allocated heap memory
+size_t simulated_free_heap() {
+    return heap_client != nullptr ? SIMULATED_HEAP - heap_client->queued_bytes() : SIMULATED_HEAP;
+}
+
+void connect(Loopback_MQTT_Client& client) {
+    client.set_buffer_size(BUFFER_SIZE);
+    client.on_loop = []() { simulated_now += 50U; };
+    TEST_ASSERT_TRUE(client.connect("benchmark", nullptr, nullptr));
+    heap_client = &client;
+}
+
+void print_result(const MQTT_Benchmark_Result& result) {
+    char line[256];
+    MQTT_Client_Benchmark::Format_Result(result, line, sizeof(line));
+    TEST_MESSAGE(line);
+}
+
+} // namespace
+
+void setUp(void) {
+    simulated_now = 1000U;
+}
+
+void tearDown(void) {
+    heap_client = nullptr;
+}
+
+// All three scripted workloads pass through the broker stand-in with 500 us latency, every 10th message takes 20 ms instead and overtakes nothing
+void test_workloads_are_conformant(void) {
+    const MQTT_Benchmark_Workload workloads[] = { TELEMETRY_BURST, ATTRIBUTE_STORM, OTA_CHUNK_STREAM };
+    for (const MQTT_Benchmark_Workload& workload : workloads) {
+        Loopback_MQTT_Client client(simulated_clock);
+        connect(client);
+        client.latency_us = 500U;
+        client.slow_every = 10U;
+        client.slow_latency_us = 20000U;
+        MQTT_Client_Benchmark benchmark(client, TOPIC, 5000U, simulated_clock, simulated_free_heap);
+        MQTT_Benchmark_Result result;
+        TEST_ASSERT_TRUE_MESSAGE(benchmark.run(workload, result), workload.name);
+        print_result(result);
+        TEST_ASSERT_EQUAL_UINT32(workload.message_count, result.sent);
+        TEST_ASSERT_EQUAL_UINT32(workload.message_count, result.received);
+        TEST_ASSERT_EQUAL_UINT32(0U, result.corrupted);
+        TEST_ASSERT_EQUAL_UINT32(0U, result.duplicated);
+        // Slow messages arrive after the ones published after them
+        TEST_ASSERT_TRUE(workload.in_flight == 1U || result.reordered > 0U);
+        TEST_ASSERT_TRUE(result.p50_latency_us >= 500U && result.p50_latency_us < 700U);
+        TEST_ASSERT_TRUE(result.max_latency_us >= 20000U);
+        TEST_ASSERT_TRUE(result.p99_latency_us >= result.p50_latency_us && result.p99_latency_us <= result.max_latency_us);
+        TEST_ASSERT_TRUE(result.peak_heap > 0U);
+        // Buffer size is only increased while the workload runs
+        TEST_ASSERT_EQUAL_UINT16(BUFFER_SIZE, client.get_buffer_size());
+        TEST_ASSERT_EQUAL_UINT32(0U, client.queued_bytes());
+    }
+}
+
+void test_detects_lost_message(void) {
+    Loopback_MQTT_Client client(simulated_clock);
+    connect(client);
+    client.drop_message = 7U;
+    MQTT_Client_Benchmark benchmark(client, TOPIC, 50U, simulated_clock, nullptr);
+    MQTT_Benchmark_Result result;
+    TEST_ASSERT_FALSE(benchmark.run(ATTRIBUTE_STORM, result));
+    print_result(result);
+    TEST_ASSERT_EQUAL_UINT32(ATTRIBUTE_STORM.message_count - 1U, result.received);
+}
+
+void test_detects_corrupted_message(void) {
+    Loopback_MQTT_Client client(simulated_clock);
+    connect(client);
+    client.corrupt_message = 9U;
+    MQTT_Client_Benchmark benchmark(client, TOPIC, 50U, simulated_clock, nullptr);
+    MQTT_Benchmark_Result result;
+    TEST_ASSERT_FALSE(benchmark.run(ATTRIBUTE_STORM, result));
+    TEST_ASSERT_EQUAL_UINT32(1U, result.corrupted);
+    TEST_ASSERT_EQUAL_UINT32(ATTRIBUTE_STORM.message_count - 1U, result.received);
+}
+
+void test_detects_duplicated_message(void) {
+    Loopback_MQTT_Client client(simulated_clock);
+    connect(client);
+    client.duplicate_message = 5U;
+    MQTT_Client_Benchmark benchmark(client, TOPIC, 50U, simulated_clock, nullptr);
+    MQTT_Benchmark_Result result;
+    TEST_ASSERT_FALSE(benchmark.run(ATTRIBUTE_STORM, result));
+    TEST_ASSERT_EQUAL_UINT32(1U, result.duplicated);
+    TEST_ASSERT_EQUAL_UINT32(ATTRIBUTE_STORM.message_count, result.received);
+}
+
+// Histogram buckets have a resolution of 12.5%, so the reported latency is at most that much below the real one
+void test_latency_resolution(void) {
+    Loopback_MQTT_Client client(simulated_clock);
+    connect(client);
+    client.latency_us = 123456U;
+    MQTT_Client_Benchmark benchmark(client, TOPIC, 5000U, simulated_clock, nullptr);
+    const MQTT_Benchmark_Workload workload = { "slow", 20U, 10U, 1U, false };
+    MQTT_Benchmark_Result result;
+    TEST_ASSERT_TRUE(benchmark.run(workload, result));
+    TEST_ASSERT_TRUE(result.p50_latency_us <= result.max_latency_us);
+    TEST_ASSERT_TRUE(static_cast<uint64_t>(result.p50_latency_us) * 1000U >= 123456U * 875U);
+    TEST_ASSERT_EQUAL_UINT32(0U, result.peak_heap);
+}
+
+void test_rejects_invalid_runs(void) {
+    Loopback_MQTT_Client client(simulated_clock);
+    MQTT_Client_Benchmark benchmark(client, TOPIC, 5000U, simulated_clock, nullptr);
+    MQTT_Benchmark_Result result;
+    // Not connected
+    TEST_ASSERT_FALSE(benchmark.run(TELEMETRY_BURST, result));
+    connect(client);
+    // Payload and topic do not fit into a 16 bit buffer size
+    const MQTT_Benchmark_Workload huge = { "huge", 1U, 65535U, 1U, false };
+    TEST_ASSERT_FALSE(benchmark.run(huge, result));
+    TEST_ASSERT_EQUAL_UINT16(BUFFER_SIZE, client.get_buffer_size());
+}
+
+// Same workloads with the real clock and no simulated latency, measures the overhead of the benchmark and the client interface itself
+void test_benchmark_real_clock(void) {
+    const MQTT_Benchmark_Workload workloads[] = { TELEMETRY_BURST, ATTRIBUTE_STORM, OTA_CHUNK_STREAM };
+    for (const MQTT_Benchmark_Workload& workload : workloads) {
+        Loopback_MQTT_Client client;
+        client.set_buffer_size(BUFFER_SIZE);
+        TEST_ASSERT_TRUE(client.connect("benchmark", nullptr, nullptr));
+        MQTT_Client_Benchmark benchmark(client, TOPIC, 5000U, MQTT_Client_Benchmark::Default_Clock, nullptr);
+        MQTT_Benchmark_Result result;
+        TEST_ASSERT_TRUE(benchmark.run(workload, result));
+        print_result(result);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_workloads_are_conformant);
+    RUN_TEST(test_detects_lost_message);
+    RUN_TEST(test_detects_corrupted_message);
+    RUN_TEST(test_detects_duplicated_message);
+    RUN_TEST(test_latency_resolution);
+    RUN_TEST(test_rejects_invalid_runs);
+    RUN_TEST(test_benchmark_real_clock);
+    return UNITY_END();
+}
@@ -0,0 +1,149 @@
+// MqttProvisioner against the loopback broker: the server side answers the provisioning request from loop(), like ThingsBoard does
+// for a device profile with provisioning enabled. The token may only be written for an accepted request with an access token
+#include <unity.h>
+#include <mqtt_provision.hpp>
+#include <Loopback_MQTT_Client.h>
+#include <string.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr char DEVICE_NAME[] = "BUILDING-a1b2c3";
+constexpr char PROVISION_KEY[] = "building-key";
+constexpr char PROVISION_SECRET[] = "building-secret";
+constexpr char UNTOUCHED[] = "untouched";
+
+/// @brief Answers every provisioning request once with the given response, an empty response means the server never answers
+void answer_with(Loopback_MQTT_Client& client, const std::string& response) {
+    std::shared_ptr<size_t> answered(new size_t(0U));
+    client.on_loop = [&client, response, answered]() {
+        const size_t requests = client.published("/provision/request").size();
+        if (!response.empty() && requests > *answered) {
+            *answered = requests;
+            client.inject("/provision/response", response);
+        }
+    };
+}
+
+/// @brief Broker that refuses the connection, like wrong credentials or no network
+class Refusing_MQTT_Client : public Loopback_MQTT_Client {
+  public:
+    bool connect(const char *client_id, const char *user_name, const char *password) override {
+        (void)client_id;
+        (void)user_name;
+        (void)password;
+        return false;
+    }
+};
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// An accepted request stores the issued token, the request is sent as user "provision" with the device name as client id
+void test_success_stores_token(void) {
+    Loopback_MQTT_Client client;
+    answer_with(client, "{\"status\":\"SUCCESS\",\"credentialsType\":\"ACCESS_TOKEN\",\"credentialsValue\":\"A1_TEST_TOKEN\"}");
+    MqttProvisioner provisioner(client);
+    char token[32];
+    strcpy(token, UNTOUCHED);
+
+    TEST_ASSERT_EQUAL(MQTT_PROVISION_OK, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY, PROVISION_SECRET,
+                                                               token, sizeof(token), 1000U));
+    TEST_ASSERT_EQUAL_STRING("A1_TEST_TOKEN", token);
+    TEST_ASSERT_EQUAL_STRING("provision", client.user_name().c_str());
+    TEST_ASSERT_EQUAL_STRING(DEVICE_NAME, client.client_id().c_str());
+    TEST_ASSERT_FALSE(client.connected());
+
+    const std::vector<Loopback_MQTT_Client::Message> requests = client.published("/provision/request");
+    TEST_ASSERT_EQUAL_UINT32(1U, requests.size());
+    StaticJsonDocument<256> request;
+    TEST_ASSERT_TRUE(deserializeJson(request, requests.front().payload) == DeserializationError::Ok);
+    TEST_ASSERT_EQUAL_STRING(DEVICE_NAME, request["deviceName"].as<const char*>());
+    TEST_ASSERT_EQUAL_STRING(PROVISION_KEY, request["provisionDeviceKey"].as<const char*>());
+    TEST_ASSERT_EQUAL_STRING(PROVISION_SECRET, request["provisionDeviceSecret"].as<const char*>());
+}
+
+// A rejected request, e.g. wrong secret or an already provisioned device, leaves the token untouched
+void test_failure_is_rejected(void) {
+    Loopback_MQTT_Client client;
+    answer_with(client, "{\"status\":\"FAILURE\",\"errorMsg\":\"Failed to provision device!\"}");
+    MqttProvisioner provisioner(client);
+    char token[32];
+    strcpy(token, UNTOUCHED);
+
+    TEST_ASSERT_EQUAL(MQTT_PROVISION_REJECTED, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY, PROVISION_SECRET,
+                                                                     token, sizeof(token), 1000U));
+    TEST_ASSERT_EQUAL_STRING(UNTOUCHED, token);
+    TEST_ASSERT_FALSE(client.connected());
+}
+
+// Credentials the device can not connect with, or a token that does not fit into the buffer, are rejected as well
+void test_unusable_credentials_are_rejected(void) {
+    const char *const RESPONSES[] = {
+        "{\"status\":\"SUCCESS\",\"credentialsType\":\"MQTT_BASIC\",\"credentialsValue\":{\"userName\":\"a\",\"password\":\"b\"}}",
+        "{\"status\":\"SUCCESS\",\"credentialsType\":\"ACCESS_TOKEN\",\"credentialsValue\":\"\"}",
+        "{\"status\":\"SUCCESS\",\"credentialsType\":\"ACCESS_TOKEN\",\"credentialsValue\":\"0123456789abcdef\"}",
+        "{\"status\":\"SUCCESS\"}"
+    };
+    for (const char *response : RESPONSES) {
+        Loopback_MQTT_Client client;
+        answer_with(client, response);
+        MqttProvisioner provisioner(client);
+        char token[16];
+        strcpy(token, UNTOUCHED);
+
+        TEST_ASSERT_EQUAL_MESSAGE(MQTT_PROVISION_REJECTED, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY,
+                                                                                 PROVISION_SECRET, token, sizeof(token), 1000U), response);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(UNTOUCHED, token, response);
+    }
+}
+
+// Without an answer the provisioner gives up after the timeout and disconnects
+void test_no_response(void) {
+    Loopback_MQTT_Client client;
+    answer_with(client, "");
+    MqttProvisioner provisioner(client);
+    char token[32];
+    strcpy(token, UNTOUCHED);
+
+    const unsigned long started = millis();
+    TEST_ASSERT_EQUAL(MQTT_PROVISION_NO_RESPONSE, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY, PROVISION_SECRET,
+                                                                        token, sizeof(token), 100U));
+    const unsigned long elapsed = millis() - started;
+    TEST_ASSERT_TRUE(elapsed >= 100U);
+    TEST_ASSERT_TRUE(elapsed < 1000U);
+    TEST_ASSERT_EQUAL_STRING(UNTOUCHED, token);
+    TEST_ASSERT_EQUAL_UINT32(1U, client.published("/provision/request").size());
+    TEST_ASSERT_FALSE(client.connected());
+}
+
+// Nothing is sent when the broker refuses the connection, a missing token buffer is refused before connecting
+void test_connect_failed(void) {
+    Refusing_MQTT_Client client;
+    MqttProvisioner provisioner(client);
+    char token[32];
+    strcpy(token, UNTOUCHED);
+
+    TEST_ASSERT_EQUAL(MQTT_PROVISION_CONNECT_FAILED, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY, PROVISION_SECRET,
+                                                                           token, sizeof(token), 100U));
+    TEST_ASSERT_EQUAL_STRING(UNTOUCHED, token);
+    TEST_ASSERT_EQUAL_UINT32(0U, client.published().size());
+
+    TEST_ASSERT_EQUAL(MQTT_PROVISION_REQUEST_FAILED, provisioner.provision("localhost", 1883U, DEVICE_NAME, PROVISION_KEY, PROVISION_SECRET,
+                                                                           nullptr, 0U, 100U));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_success_stores_token);
+    RUN_TEST(test_failure_is_rejected);
+    RUN_TEST(test_unusable_credentials_are_rejected);
+    RUN_TEST(test_no_response);
+    RUN_TEST(test_connect_failed);
+    return UNITY_END();
+}
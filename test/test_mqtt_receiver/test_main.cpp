@@ -0,0 +1,341 @@
+// MqttReceiver against a minimal MQTT broker on the loopback interface, measures the time from the broker sending a command
+// until the callback dispatched it, while the receiving task sleeps in select() instead of polling
+#include <unity.h>
+#include <mqtt_receiver.hpp>
+#include <poll.h>
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char COMMAND_TOPIC[] = "v1/devices/me/attributes";
+constexpr uint32_t SERVICE_TIMEOUT_MS = 1000U;
+
+/// @brief Accepts a single client and speaks just enough MQTT 3.1.1 for PubSubClient: CONNACK, SUBACK, PINGRESP and outgoing PUBLISH packets
+class Loopback_Broker {
+  public:
+    Loopback_Broker() {
+        m_listener = socket(AF_INET, SOCK_STREAM, 0);
+        const int enable = 1;
+        setsockopt(m_listener, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(m_listener, reinterpret_cast<const sockaddr *>(&address), sizeof(address));
+        socklen_t length = sizeof(address);
+        getsockname(m_listener, reinterpret_cast<sockaddr *>(&address), &length);
+        m_port = ntohs(address.sin_port);
+        listen(m_listener, 1);
+        m_thread = std::thread(&Loopback_Broker::run, this);
+    }
+
+    ~Loopback_Broker() {
+        m_running = false;
+        m_thread.join();
+        close(m_listener);
+    }
+
+    uint16_t port() const { return m_port; }
+
+    /// @brief Queues a PUBLISH to the client, sent by the broker thread at the given time
+    void publish_at(const Clock::time_point& at, const std::string& payload) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_outgoing.push_back(Outgoing{ at, payload });
+    }
+
+    /// @brief Closes the connection to the client without a DISCONNECT, like a broker that went away
+    void drop_client() { m_drop = true; }
+
+    bool subscribed() const { return m_subscribed; }
+
+    /// @brief Times the queued messages have actually been written to the socket, in the order they were queued
+    std::vector<Clock::time_point> sent_at() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_sent_at;
+    }
+
+  private:
+    struct Outgoing {
+        Clock::time_point at;
+        std::string payload;
+    };
+
+    void run() {
+        int client = -1;
+        std::vector<uint8_t> received;
+        while (m_running) {
+            if (client < 0) {
+                pollfd listener = { m_listener, POLLIN, 0 };
+                if (poll(&listener, 1, 5) > 0) {
+                    client = accept(m_listener, nullptr, nullptr);
+                    const int enable = 1;
+                    setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+                }
+                continue;
+            }
+            if (m_drop) {
+                close(client);
+                client = -1;
+                m_drop = false;
+                continue;
+            }
+            send_due(client);
+            pollfd incoming = { client, POLLIN, 0 };
+            if (poll(&incoming, 1, 1) <= 0) {
+                continue;
+            }
+            uint8_t buffer[512];
+            const ssize_t length = recv(client, buffer, sizeof(buffer), 0);
+            if (length <= 0) {
+                close(client);
+                client = -1;
+                continue;
+            }
+            received.insert(received.end(), buffer, buffer + length);
+            handle_packets(client, received);
+        }
+        if (client >= 0) {
+            close(client);
+        }
+    }
+
+    void send_due(const int& client) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const Clock::time_point now = Clock::now();
+        while (m_next < m_outgoing.size() && m_outgoing[m_next].at <= now) {
+            const std::string& payload = m_outgoing[m_next].payload;
+            std::vector<uint8_t> packet;
+            const size_t remaining = 2U + strlen(COMMAND_TOPIC) + payload.size();
+            packet.push_back(0x30U);
+            encode_length(packet, remaining);
+            packet.push_back(static_cast<uint8_t>(strlen(COMMAND_TOPIC) >> 8U));
+            packet.push_back(static_cast<uint8_t>(strlen(COMMAND_TOPIC)));
+            packet.insert(packet.end(), COMMAND_TOPIC, COMMAND_TOPIC + strlen(COMMAND_TOPIC));
+            packet.insert(packet.end(), payload.begin(), payload.end());
+            m_sent_at.push_back(Clock::now());
+            send(client, packet.data(), packet.size(), MSG_NOSIGNAL);
+            m_next++;
+        }
+    }
+
+    void handle_packets(const int& client, std::vector<uint8_t>& received) {
+        for (;;) {
+            size_t remaining = 0U;
+            size_t header = 1U;
+            uint32_t multiplier = 1U;
+            for (;;) {
+                if (header >= received.size()) {
+                    return;
+                }
+                remaining += (received[header] & 0x7FU) * multiplier;
+                multiplier *= 128U;
+                if ((received[header++] & 0x80U) == 0U) {
+                    break;
+                }
+            }
+            if (received.size() < header + remaining) {
+                return;
+            }
+            const uint8_t type = received[0U] >> 4U;
+            if (type == 1U) {
+                const uint8_t connack[] = { 0x20U, 0x02U, 0x00U, 0x00U };
+                send(client, connack, sizeof(connack), MSG_NOSIGNAL);
+            }
+            else if (type == 8U) {
+                const uint8_t suback[] = { 0x90U, 0x03U, received[header], received[header + 1U], 0x00U };
+                send(client, suback, sizeof(suback), MSG_NOSIGNAL);
+                m_subscribed = true;
+            }
+            else if (type == 12U) {
+                const uint8_t pingresp[] = { 0xD0U, 0x00U };
+                send(client, pingresp, sizeof(pingresp), MSG_NOSIGNAL);
+            }
+            received.erase(received.begin(), received.begin() + header + remaining);
+        }
+    }
+
+    static void encode_length(std::vector<uint8_t>& packet, size_t length) {
+        do {
+            uint8_t digit = length % 128U;
+            length /= 128U;
+            packet.push_back(length > 0U ? digit | 0x80U : digit);
+        } while (length > 0U);
+    }
+
+    int m_listener;
+    uint16_t m_port;
+    std::thread m_thread;
+    std::atomic<bool> m_running{true};
+    std::atomic<bool> m_drop{false};
+    std::atomic<bool> m_subscribed{false};
+    std::mutex m_mutex;
+    std::vector<Outgoing> m_outgoing;
+    size_t m_next = 0U;
+    std::vector<Clock::time_point> m_sent_at;
+};
+
+// Receive times of the commands, written by the callback on the test thread
+std::vector<Clock::time_point> received_at;
+std::vector<std::string> received_payloads;
+
+void on_message(char *topic, uint8_t *payload, unsigned int length) {
+    (void)topic;
+    received_at.push_back(Clock::now());
+    received_payloads.emplace_back(reinterpret_cast<const char *>(payload), length);
+}
+
+bool connect(PubSubClient& client, Loopback_Broker& broker) {
+    client.setServer(IPAddress(127U, 0U, 0U, 1U), broker.port());
+    client.setCallback(on_message);
+    if (!client.connect("receiver") || !client.subscribe(COMMAND_TOPIC)) {
+        return false;
+    }
+    for (uint32_t i = 0U; i < 100U && !broker.subscribed(); i++) {
+        client.loop();
+        delay(1U);
+    }
+    return broker.subscribed();
+}
+
+uint32_t latency_ms(const Clock::time_point& sent, const Clock::time_point& received) {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(received - sent).count());
+}
+
+} // namespace
+
+void setUp(void) {
+    received_at.clear();
+    received_payloads.clear();
+}
+
+void tearDown(void) {}
+
+// Commands at random times are dispatched well within 50 ms, even though every service() call may sleep up to a second
+void test_command_latency(void) {
+    constexpr size_t COMMANDS = 40U;
+    Loopback_Broker broker;
+    WiFiClient socket;
+    PubSubClient client(socket);
+    TEST_ASSERT_TRUE(connect(client, broker));
+    MqttReceiver receiver(client, socket, socket);
+
+    std::mt19937 random(42U);
+    Clock::time_point at = Clock::now() + std::chrono::milliseconds(20);
+    for (size_t i = 0U; i < COMMANDS; i++) {
+        at += std::chrono::milliseconds(5U + random() % 60U);
+        broker.publish_at(at, "{\"ledState\":" + std::to_string(i % 2U) + "}");
+    }
+    const Clock::time_point end = at + std::chrono::seconds(2);
+    uint32_t calls = 0U;
+    while (received_at.size() < COMMANDS && Clock::now() < end) {
+        receiver.service(SERVICE_TIMEOUT_MS);
+        calls++;
+    }
+
+    const std::vector<Clock::time_point> sent = broker.sent_at();
+    TEST_ASSERT_EQUAL_UINT32(COMMANDS, received_at.size());
+    std::vector<uint32_t> latencies;
+    for (size_t i = 0U; i < COMMANDS; i++) {
+        TEST_ASSERT_EQUAL_STRING(("{\"ledState\":" + std::to_string(i % 2U) + "}").c_str(), received_payloads[i].c_str());
+        latencies.push_back(latency_ms(sent[i], received_at[i]));
+    }
+    std::sort(latencies.begin(), latencies.end());
+    char message[128];
+    snprintf(message, sizeof(message), "%u commands: p50 %u ms, max %u ms, %u service() calls",
+      static_cast<unsigned>(COMMANDS), static_cast<unsigned>(latencies[COMMANDS / 2U]), static_cast<unsigned>(latencies.back()), static_cast<unsigned>(calls));
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(latencies.back() < 50U);
+    // Sleeping in select() instead of polling, roughly one wake up per command
+    TEST_ASSERT_TRUE(calls <= COMMANDS * 3U);
+}
+
+// A burst larger than MQTT_RECEIVER_MAX_BURST is handled completely over consecutive service() calls, nothing stays in the buffers
+void test_burst_is_drained(void) {
+    constexpr size_t COMMANDS = MQTT_RECEIVER_MAX_BURST * 3U + 5U;
+    Loopback_Broker broker;
+    WiFiClient socket;
+    PubSubClient client(socket);
+    TEST_ASSERT_TRUE(connect(client, broker));
+    MqttReceiver receiver(client, socket, socket);
+
+    const Clock::time_point at = Clock::now() + std::chrono::milliseconds(10);
+    for (size_t i = 0U; i < COMMANDS; i++) {
+        broker.publish_at(at, std::to_string(i));
+    }
+    const Clock::time_point end = Clock::now() + std::chrono::seconds(3);
+    while (received_at.size() < COMMANDS && Clock::now() < end) {
+        receiver.service(SERVICE_TIMEOUT_MS);
+    }
+    TEST_ASSERT_EQUAL_UINT32(COMMANDS, received_payloads.size());
+    for (size_t i = 0U; i < COMMANDS; i++) {
+        TEST_ASSERT_EQUAL_STRING(std::to_string(i).c_str(), received_payloads[i].c_str());
+    }
+    TEST_ASSERT_TRUE(latency_ms(broker.sent_at().back(), received_at.back()) < 50U);
+}
+
+// Other tasks publish through the shared lock while the receiving task sleeps in select(), the lock is only held while loop() runs
+void test_publish_while_waiting(void) {
+    Loopback_Broker broker;
+    WiFiClient socket;
+    PubSubClient client(socket);
+    TEST_ASSERT_TRUE(connect(client, broker));
+    SemaphoreHandle_t mutex = xSemaphoreCreateRecursiveMutex();
+    MqttReceiver receiver(client, socket, socket, mutex);
+
+    std::atomic<bool> waiting(true);
+    std::thread receiving([&receiver, &waiting]() {
+        receiver.service(SERVICE_TIMEOUT_MS / 2U);
+        waiting = false;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    const Clock::time_point start = Clock::now();
+    xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
+    const bool published = client.publish("v1/devices/me/telemetry", "{\"temperature\":25}");
+    xSemaphoreGiveRecursive(mutex);
+    const uint32_t blocked_ms = latency_ms(start, Clock::now());
+    const bool still_waiting = waiting;
+    receiving.join();
+    vSemaphoreDelete(mutex);
+    TEST_ASSERT_TRUE(published);
+    TEST_ASSERT_TRUE(still_waiting);
+    TEST_ASSERT_TRUE(blocked_ms < 50U);
+}
+
+// Connection closed by the broker wakes the receiving task up at once, loop() then detects the lost connection
+void test_closed_connection_wakes_up(void) {
+    Loopback_Broker broker;
+    WiFiClient socket;
+    PubSubClient client(socket);
+    TEST_ASSERT_TRUE(connect(client, broker));
+    MqttReceiver receiver(client, socket, socket);
+
+    broker.drop_client();
+    const Clock::time_point start = Clock::now();
+    for (uint32_t i = 0U; i < 5U && client.connected(); i++) {
+        receiver.service(SERVICE_TIMEOUT_MS);
+    }
+    TEST_ASSERT_FALSE(client.connected());
+    TEST_ASSERT_TRUE(latency_ms(start, Clock::now()) < SERVICE_TIMEOUT_MS / 2U);
+    // Without a socket the timeout is simply waited out, so a reconnect loop does not spin
+    const Clock::time_point idle = Clock::now();
+    TEST_ASSERT_EQUAL_UINT32(0U, receiver.service(20U));
+    TEST_ASSERT_TRUE(latency_ms(idle, Clock::now()) >= 20U);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_command_latency);
+    RUN_TEST(test_burst_is_drained);
+    RUN_TEST(test_publish_while_waiting);
+    RUN_TEST(test_closed_connection_wakes_up);
+    return UNITY_END();
+}
@@ -0,0 +1,245 @@
+// OtaChunkSizer driving OtaWindow over simulated links with limited bandwidth, loss that grows with the message size
+// and gateways that drop large messages, the chunk size has to settle where the download is fastest
+#include <unity.h>
+#include <OtaChunkSizer.h>
+#include <OtaWindow.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t IMAGE_SIZE = 1000000U;
+constexpr uint16_t MAX_CHUNK_SIZE = 4096U;
+constexpr uint8_t WINDOW = 4U;
+constexpr uint32_t TIMEOUT_MS = 10000U;
+constexpr uint32_t GIVE_UP_MS = 3600000U;
+constexpr uint8_t SEEDS = 5U;
+
+std::vector<uint8_t> image;
+std::vector<uint8_t> written;
+
+bool write_chunk(uint8_t* data, size_t length) {
+    written.insert(written.end(), data, data + length);
+    return true;
+}
+
+/// @brief Broker behind a link that sends one message at a time, alternates between two phases when period_ms is set
+struct Link {
+    uint32_t round_trip_ms;
+    uint32_t bytes_per_ms[2U];
+    double loss_per_512_bytes[2U];  // Probability that a 512 byte part of a message is lost, a message is lost with any of its parts
+    uint32_t period_ms;
+    uint16_t drop_above;            // Messages larger than this are dropped with drop_probability, 0 = never
+    double drop_probability;
+
+    uint8_t phase(const uint32_t& now) const {
+        return period_ms == 0U ? 0U : (now / period_ms) % 2U;
+    }
+
+    bool lost(const uint32_t& now, const uint16_t& length, std::mt19937& random) const {
+        std::uniform_real_distribution<double> uniform(0.0, 1.0);
+        if (drop_above != 0U && length > drop_above && uniform(random) < drop_probability) {
+            return true;
+        }
+        return uniform(random) < 1.0 - pow(1.0 - loss_per_512_bytes[phase(now)], length / 512.0);
+    }
+};
+
+struct Transfer {
+    bool complete;
+    uint32_t elapsed_ms;
+    uint16_t final_chunk_size;
+    uint16_t largest_chunk_size;
+};
+
+struct Response {
+    uint32_t at;
+    uint32_t index;
+    uint32_t offset;
+    uint16_t length;
+    uint32_t generation;
+};
+
+/// @brief Runs the download like the OTA task: the sizer picks the chunk size before every round of requests,
+/// counts every new retry of the window as a failure and every accepted response as a success
+/// @param adaptive False to keep the initial chunk size, like the firmware before the sizer
+Transfer simulate(const Link& link, const uint16_t& initial_chunk_size, const bool& adaptive, const uint32_t& seed) {
+    std::mt19937 random(seed);
+    written.clear();
+    OtaWindow window;
+    OtaChunkSizer sizer;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, initial_chunk_size, WINDOW, write_chunk, 0U, MAX_CHUNK_SIZE));
+    sizer.begin(MAX_CHUNK_SIZE, initial_chunk_size);
+    std::vector<Response> network;
+    Transfer transfer = { false, 0U, initial_chunk_size, initial_chunk_size };
+    uint32_t now = 1U;
+    uint32_t link_free = 0U;
+    uint32_t retries = 0U;
+    while (!window.complete() && now < GIVE_UP_MS) {
+        if (adaptive) {
+            window.setChunkSize(sizer.getChunkSize());
+        }
+        int32_t index;
+        while ((index = window.nextRequest(now, TIMEOUT_MS)) >= 0) {
+            const uint32_t offset = static_cast<uint32_t>(index) * window.getChunkSize();
+            const uint16_t length = static_cast<uint16_t>(std::min<uint32_t>(window.getChunkSize(), IMAGE_SIZE - offset));
+            transfer.largest_chunk_size = std::max(transfer.largest_chunk_size, window.getChunkSize());
+            // The response waits for the ones sent before it, the time on the link depends on its size
+            const uint32_t start = std::max(now + link.round_trip_ms / 2U, link_free);
+            link_free = start + length / link.bytes_per_ms[link.phase(start)];
+            if (!link.lost(start, length, random)) {
+                network.push_back({ link_free + link.round_trip_ms / 2U, static_cast<uint32_t>(index), offset, length, window.getGeneration() });
+            }
+        }
+        for (; retries < window.getRetries(); retries++) {
+            if (adaptive) {
+                sizer.onFailure(now);
+            }
+        }
+        std::vector<Response>::iterator earliest = std::min_element(network.begin(), network.end(),
+            [](const Response& a, const Response& b) { return a.at < b.at; });
+        const uint32_t wait = std::max<uint32_t>(window.msUntilTimeout(now, TIMEOUT_MS), 1U);
+        if (earliest == network.end() || earliest->at > now + wait) {
+            now += wait;
+            continue;
+        }
+        const Response response = *earliest;
+        network.erase(earliest);
+        now = std::max(now, response.at);
+        // Responses to a request id of the previous chunk size are dropped like in otaChunkHandler
+        if (response.generation != window.getGeneration()) {
+            continue;
+        }
+        const OtaChunkResult result = window.onChunk(response.index, image.data() + response.offset, response.length);
+        if (adaptive && result != OTA_CHUNK_IGNORED && result != OTA_CHUNK_RETRY) {
+            sizer.onSuccess(response.length, now);
+        }
+    }
+    transfer.complete = window.complete();
+    transfer.elapsed_ms = now;
+    transfer.final_chunk_size = window.getChunkSize();
+    return transfer;
+}
+
+/// @brief Mean download time over several seeds, every download has to complete with the exact image
+uint32_t mean_elapsed(const Link& link, const uint16_t& initial_chunk_size, const bool& adaptive) {
+    uint64_t total = 0U;
+    for (uint8_t seed = 0U; seed < SEEDS; seed++) {
+        const Transfer transfer = simulate(link, initial_chunk_size, adaptive, seed);
+        TEST_ASSERT_TRUE(transfer.complete);
+        TEST_ASSERT_TRUE(written == image);
+        total += transfer.elapsed_ms;
+    }
+    return static_cast<uint32_t>(total / SEEDS);
+}
+
+struct Comparison {
+    double to_best;     // Adaptive download time relative to the best fixed size for the link
+    double to_default;  // Relative to the fixed OTA_MAX_CHUNK_SIZE chunks the firmware requested before the sizer
+};
+
+/// @brief Compares the sizer against every fixed chunk size on the given link and reports the times
+Comparison compare(const char *name, const Link& link) {
+    uint32_t best = UINT32_MAX;
+    uint32_t largest = 0U;
+    char message[160];
+    int written_chars = snprintf(message, sizeof(message), "%s:", name);
+    for (uint16_t size = MAX_CHUNK_SIZE; size >= OTA_MIN_CHUNK_SIZE; size /= 2U) {
+        const uint32_t elapsed = mean_elapsed(link, size, false);
+        best = std::min(best, elapsed);
+        largest = size == MAX_CHUNK_SIZE ? elapsed : largest;
+        written_chars += snprintf(message + written_chars, sizeof(message) - written_chars, " %u %.1f s,", size, elapsed / 1000.0);
+    }
+    const uint32_t adaptive = mean_elapsed(link, MAX_CHUNK_SIZE, true);
+    snprintf(message + written_chars, sizeof(message) - written_chars, " adaptive %.1f s", adaptive / 1000.0);
+    TEST_MESSAGE(message);
+    return { static_cast<double>(adaptive) / best, static_cast<double>(adaptive) / largest };
+}
+
+} // namespace
+
+void setUp(void) {
+    image.resize(IMAGE_SIZE);
+    for (size_t i = 0U; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>(i * 31U + (i >> 8U));
+    }
+}
+
+void tearDown(void) {}
+
+// The firmware rounds the fw_chunk_size of the server to a size the sizer can move away from
+void test_round_size(void) {
+    TEST_ASSERT_EQUAL_UINT16(4096U, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 4096U));
+    TEST_ASSERT_EQUAL_UINT16(2048U, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 4095U));
+    TEST_ASSERT_EQUAL_UINT16(1024U, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 1500U));
+    TEST_ASSERT_EQUAL_UINT16(512U, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 1000U));
+    TEST_ASSERT_EQUAL_UINT16(OTA_MIN_CHUNK_SIZE, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 100U));
+    TEST_ASSERT_EQUAL_UINT16(3000U, OtaChunkSizer::roundSize(3000U, 3000U));
+    TEST_ASSERT_EQUAL_UINT16(750U, OtaChunkSizer::roundSize(3000U, 1000U));
+
+    OtaChunkSizer sizer;
+    sizer.begin(MAX_CHUNK_SIZE, OtaChunkSizer::roundSize(MAX_CHUNK_SIZE, 1500U));
+    TEST_ASSERT_EQUAL_UINT16(1024U, sizer.getChunkSize());
+}
+
+// The chunk size of an older checkpoint outside of the sequence is kept, chunk indexes of the resumed download depend on it
+void test_keeps_other_size(void) {
+    OtaChunkSizer sizer;
+    sizer.begin(MAX_CHUNK_SIZE, 1000U);
+    uint32_t now = 0U;
+    for (uint8_t i = 0U; i < 50U; i++) {
+        sizer.onFailure(now += 100U);
+        sizer.onSuccess(1000U, now += 100U);
+    }
+    TEST_ASSERT_EQUAL_UINT16(1000U, sizer.getChunkSize());
+}
+
+// A small fw_chunk_size is only the starting point, on a fast link the sizer grows up to the MQTT buffer limit
+void test_grows_to_buffer_limit(void) {
+    const Link link = { 150U, { 20U, 20U }, { 0.0, 0.0 }, 0U, 0U, 0.0 };
+    const Transfer transfer = simulate(link, OTA_MIN_CHUNK_SIZE, true, 1U);
+    TEST_ASSERT_TRUE(transfer.complete);
+    TEST_ASSERT_TRUE(written == image);
+    TEST_ASSERT_EQUAL_UINT16(MAX_CHUNK_SIZE, transfer.final_chunk_size);
+    TEST_ASSERT_TRUE(transfer.elapsed_ms < mean_elapsed(link, OTA_MIN_CHUNK_SIZE, false));
+}
+
+// A gateway that never forwards large messages: a fixed large size never completes, the sizer moves below the limit
+void test_shrinks_below_dropped_size(void) {
+    const Link link = { 150U, { 10U, 10U }, { 0.0, 0.0 }, 0U, 1024U, 1.0 };
+    TEST_ASSERT_FALSE(simulate(link, MAX_CHUNK_SIZE, false, 1U).complete);
+    const Transfer transfer = simulate(link, MAX_CHUNK_SIZE, true, 1U);
+    TEST_ASSERT_TRUE(transfer.complete);
+    TEST_ASSERT_TRUE(written == image);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1024U, transfer.final_chunk_size);
+}
+
+// The best fixed size differs from link to link, the sizer is never far behind it. Every probe of a size that
+// turns out worse costs request timeouts, so on links where only small chunks get through it stays measurably behind
+void test_close_to_best_fixed_size(void) {
+    const Link fast = { 150U, { 20U, 20U }, { 0.0, 0.0 }, 0U, 0U, 0.0 };
+    const Link lossy = { 150U, { 4U, 4U }, { 0.03, 0.03 }, 0U, 0U, 0.0 };
+    const Link alternating = { 150U, { 20U, 3U }, { 0.0, 0.04 }, 10000U, 0U, 0.0 };
+    const Link gateway = { 150U, { 10U, 10U }, { 0.01, 0.01 }, 0U, 1024U, 0.3 };
+    const Link *links[] = { &fast, &lossy, &alternating, &gateway };
+    const char *names[] = { "fast", "lossy", "alternating", "gateway" };
+    Comparison comparisons[4U];
+    for (uint8_t i = 0U; i < 4U; i++) {
+        comparisons[i] = compare(names[i], *links[i]);
+        TEST_ASSERT_TRUE_MESSAGE(comparisons[i].to_best < 1.5, names[i]);
+        TEST_ASSERT_TRUE_MESSAGE(comparisons[i].to_default < 1.25, names[i]);
+    }
+    // Only small chunks get through the gateway: far faster than the fixed default
+    TEST_ASSERT_TRUE(comparisons[3U].to_default < 0.6);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_size);
+    RUN_TEST(test_keeps_other_size);
+    RUN_TEST(test_grows_to_buffer_limit);
+    RUN_TEST(test_shrinks_below_dropped_size);
+    RUN_TEST(test_close_to_best_fixed_size);
+    return UNITY_END();
+}
@@ -0,0 +1,377 @@
+// OtaHttpDownloader with the vendored HttpClient against an in-memory HTTP server: Range requests on a kept-alive connection,
+// resuming after dropped connections, servers without Range support or with chunked responses, and the download time over
+// a link with latency and limited bandwidth compared to the MQTT chunk protocol
+#include <unity.h>
+#include <OtaHttp.h>
+#include <OtaWindow.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t IMAGE_SIZE = 100000U;
+constexpr char PATH[] = "/api/v1/token/firmware?title=fw&version=1.1";
+
+std::vector<uint8_t> image;
+
+/// @brief HTTP/1.1 server behind the client connection, answers every GET of PATH with (a part of) the image
+class Fake_Http_Server : public Client {
+  public:
+    bool ranges = true;             // Answers Range requests with 206, otherwise always sends the whole image with 200
+    bool chunked = false;           // Transfer-Encoding: chunked instead of Content-Length
+    uint32_t wrong_range_once = 0U; // Shifts the Content-Range start of the next response by this amount
+    std::vector<uint32_t> drops;    // Body bytes after which the next responses are cut off by closing the connection
+    uint32_t round_trip_ms = 0U;    // The first byte of a response arrives one round trip after the request, a new connection costs another
+    uint32_t bytes_per_ms = 0U;     // Bandwidth of the link, 0 = unlimited
+
+    uint32_t connects = 0U;
+    std::vector<std::string> requests;
+
+    int connect(IPAddress ip, uint16_t port) override { return connect("", port); }
+
+    int connect(const char *host, uint16_t port) override {
+        connects++;
+        m_open = true;
+        m_new_connection = true;
+        m_request.clear();
+        m_response.clear();
+        m_position = 0U;
+        return 1;
+    }
+
+    size_t write(uint8_t c) override { return write(&c, 1U); }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        if (!m_open) {
+            return 0U;
+        }
+        m_request.append(reinterpret_cast<const char *>(buffer), size);
+        const size_t end = m_request.find("\r\n\r\n");
+        if (end != std::string::npos) {
+            respond(m_request.substr(0U, end + 2U));
+            m_request.erase(0U, end + 4U);
+        }
+        return size;
+    }
+
+    int available() override {
+        return m_open ? static_cast<int>(deliverable() - m_position) : 0;
+    }
+
+    int read() override {
+        uint8_t c;
+        return read(&c, 1U) == 1 ? c : -1;
+    }
+
+    int read(uint8_t *buffer, size_t size) override {
+        const size_t length = std::min(size, static_cast<size_t>(std::max(available(), 0)));
+        if (length == 0U) {
+            return -1;
+        }
+        memcpy(buffer, m_response.data() + m_position, length);
+        m_position += length;
+        return static_cast<int>(length);
+    }
+
+    int peek() override { return available() > 0 ? m_response[m_position] : -1; }
+
+    void flush() override {}
+
+    void stop() override {
+        m_open = false;
+        m_response.clear();
+        m_position = 0U;
+    }
+
+    uint8_t connected() override {
+        // A cut off response closes the connection once the remaining bytes were read
+        return m_open && !(m_closing && m_position >= m_response.size());
+    }
+
+    operator bool() override { return m_open; }
+
+  private:
+    void respond(const std::string& request) {
+        requests.push_back(request);
+        uint32_t from = 0U;
+        const size_t range = request.find("Range: bytes=");
+        if (ranges && range != std::string::npos) {
+            from = static_cast<uint32_t>(strtoul(request.c_str() + range + 13U, nullptr, 10));
+        }
+        std::string body(reinterpret_cast<const char *>(image.data()) + from, IMAGE_SIZE - from);
+        char headers[256];
+        const uint32_t shown_from = from + wrong_range_once;
+        wrong_range_once = 0U;
+        int length = from > 0U ? snprintf(headers, sizeof(headers), "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes %u-%u/%u\r\n",
+                                          shown_from, IMAGE_SIZE - 1U, IMAGE_SIZE)
+                               : snprintf(headers, sizeof(headers), "HTTP/1.1 200 OK\r\n");
+        if (chunked) {
+            std::string encoded;
+            for (size_t position = 0U; position < body.size(); position += 3000U) {
+                char size_line[16];
+                const size_t size = std::min<size_t>(3000U, body.size() - position);
+                snprintf(size_line, sizeof(size_line), "%zx\r\n", size);
+                encoded += size_line + body.substr(position, size) + "\r\n";
+            }
+            body = encoded + "0\r\n\r\n";
+            snprintf(headers + length, sizeof(headers) - length, "Transfer-Encoding: chunked\r\n\r\n");
+        }
+        else {
+            snprintf(headers + length, sizeof(headers) - length, "Content-Length: %zu\r\n\r\n", body.size());
+        }
+        m_closing = !drops.empty();
+        if (m_closing) {
+            body.resize(std::min<size_t>(body.size(), drops.front()));
+            drops.erase(drops.begin());
+        }
+        m_response = headers + body;
+        m_position = 0U;
+        m_sent_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(round_trip_ms * (m_new_connection ? 2U : 1U));
+        m_new_connection = false;
+    }
+
+    /// @brief Amount of response bytes that reached the client over the link so far
+    size_t deliverable() const {
+        const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - m_sent_at;
+        if (elapsed < std::chrono::steady_clock::duration::zero()) {
+            return m_position;
+        }
+        if (bytes_per_ms == 0U) {
+            return m_response.size();
+        }
+        const uint64_t bytes = std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() * bytes_per_ms / 1000U;
+        return std::min<size_t>(m_response.size(), bytes);
+    }
+
+    bool m_open = false;
+    bool m_new_connection = false;
+    bool m_closing = false;
+    std::string m_request;
+    std::string m_response;
+    size_t m_position = 0U;
+    std::chrono::steady_clock::time_point m_sent_at;
+};
+
+std::vector<uint8_t> written;
+std::vector<uint32_t> block_ends;
+uint32_t fail_after_blocks = UINT32_MAX;
+OtaHttpDownloader *cancel_after_blocks = nullptr;
+
+/// @brief Receives the blocks like the writer of the OTA task, records where each block ends
+bool write_block(uint8_t* data, size_t length) {
+    if (block_ends.size() >= fail_after_blocks) {
+        return false;
+    }
+    written.insert(written.end(), data, data + length);
+    block_ends.push_back(written.size());
+    if (cancel_after_blocks != nullptr && block_ends.size() == 3U) {
+        cancel_after_blocks->cancel();
+    }
+    return true;
+}
+
+/// @brief Every block ends at a multiple of OTA_HTTP_BLOCK_SIZE or at the end of the image
+bool blocks_aligned() {
+    for (const uint32_t& end : block_ends) {
+        if (end % OTA_HTTP_BLOCK_SIZE != 0U && end != IMAGE_SIZE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool image_written() {
+    return written.size() == IMAGE_SIZE && memcmp(written.data(), image.data(), IMAGE_SIZE) == 0;
+}
+
+/// @brief Starts the download at the given offset, the bytes before it are already in the partition
+OtaHttpResult download(OtaHttpDownloader& downloader, const uint32_t& offset = 0U) {
+    written.assign(image.begin(), image.begin() + offset);
+    return downloader.download(PATH, offset, IMAGE_SIZE, write_block);
+}
+
+/// @brief Download time of the MQTT chunk protocol over the same link in simulated time, every chunk is one request and one
+/// response message whose topic and header add to the payload, a response is sent as soon as the link is free
+uint32_t mqtt_download_ms(const uint32_t& round_trip_ms, const uint32_t& bytes_per_ms, const uint8_t& window_size, const uint16_t& chunk_size) {
+    constexpr uint32_t RESPONSE_OVERHEAD = 32U; // Fixed header, topic length and "v2/fw/response/1/chunk/<index>"
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, chunk_size, window_size, [](uint8_t* data, size_t length) { return true; }));
+    std::vector<std::pair<uint32_t, uint32_t>> network; // Arrival time and chunk index
+    uint32_t now = 0U;
+    uint32_t link_free = 0U;
+    while (!window.complete()) {
+        int32_t index;
+        while ((index = window.nextRequest(now + 1U, UINT32_MAX / 2U)) >= 0) {
+            const uint32_t length = std::min<uint32_t>(chunk_size, IMAGE_SIZE - static_cast<uint32_t>(index) * chunk_size);
+            const uint32_t start = std::max(now + round_trip_ms / 2U, link_free);
+            link_free = start + (length + RESPONSE_OVERHEAD) / bytes_per_ms;
+            network.push_back({ link_free + round_trip_ms / 2U, static_cast<uint32_t>(index) });
+        }
+        std::vector<std::pair<uint32_t, uint32_t>>::iterator earliest = std::min_element(network.begin(), network.end());
+        now = std::max(now, earliest->first);
+        const uint32_t offset = earliest->second * chunk_size;
+        window.onChunk(earliest->second, image.data() + offset, std::min<uint32_t>(chunk_size, IMAGE_SIZE - offset));
+        network.erase(earliest);
+    }
+    return now;
+}
+
+} // namespace
+
+void setUp(void) {
+    image.resize(IMAGE_SIZE);
+    for (size_t i = 0U; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>(i * 7U + (i >> 9U));
+    }
+    written.clear();
+    block_ends.clear();
+    fail_after_blocks = UINT32_MAX;
+    cancel_after_blocks = nullptr;
+}
+
+void tearDown(void) {}
+
+// The whole image in one response, written in aligned blocks
+void test_download(void) {
+    Fake_Http_Server server;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_TRUE(blocks_aligned());
+    TEST_ASSERT_EQUAL_UINT32(1U, server.connects);
+    TEST_ASSERT_EQUAL_UINT32(1U, downloader.getRequests());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, downloader.getBytesReceived());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, downloader.getOffset());
+    TEST_ASSERT_TRUE(server.requests[0U].find("GET /api/v1/token/firmware?title=fw&version=1.1 HTTP/1.1") == 0U);
+    TEST_ASSERT_TRUE(server.requests[0U].find("Range:") == std::string::npos);
+}
+
+// A resumed download asks for the rest with an open-ended Range, the first block only fills up to the next boundary
+void test_resume_from_offset(void) {
+    Fake_Http_Server server;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader, 10000U));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_EQUAL_UINT32(3U * OTA_HTTP_BLOCK_SIZE, block_ends[0U]);
+    TEST_ASSERT_TRUE(blocks_aligned());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE - 10000U, downloader.getBytesReceived());
+    TEST_ASSERT_TRUE(server.requests[0U].find("Range: bytes=10000-\r\n") != std::string::npos);
+
+    // The connection stays open for the next request
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader, 50000U));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_EQUAL_UINT32(1U, server.connects);
+}
+
+// Servers without Range support send the whole image, the part that is already written is skipped
+void test_server_without_ranges(void) {
+    Fake_Http_Server server;
+    server.ranges = false;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader, 10000U));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_TRUE(blocks_aligned());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, downloader.getBytesReceived());
+}
+
+// After a dropped connection the download continues at the last received byte on a new connection,
+// bytes that did not fill a block yet are kept
+void test_resume_after_dropped_connection(void) {
+    Fake_Http_Server server;
+    server.drops = { 30000U, 20001U };
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_TRUE(blocks_aligned());
+    TEST_ASSERT_EQUAL_UINT32(3U, downloader.getRequests());
+    TEST_ASSERT_EQUAL_UINT32(3U, server.connects);
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, downloader.getBytesReceived());
+    TEST_ASSERT_TRUE(server.requests[1U].find("Range: bytes=30000-\r\n") != std::string::npos);
+    TEST_ASSERT_TRUE(server.requests[2U].find("Range: bytes=50001-\r\n") != std::string::npos);
+
+    // Without Range support every new connection starts at the beginning again
+    Fake_Http_Server full;
+    full.ranges = false;
+    full.drops = { 30000U };
+    OtaHttpDownloader restarted(full, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(restarted));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE + 30000U, restarted.getBytesReceived());
+}
+
+void test_chunked_response(void) {
+    Fake_Http_Server server;
+    server.chunked = true;
+    server.drops = { 40000U };
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader, 5000U));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_TRUE(blocks_aligned());
+    TEST_ASSERT_EQUAL_UINT32(2U, downloader.getRequests());
+}
+
+// A response for another part of the image is never written, the range is requested again
+void test_rejects_wrong_range(void) {
+    Fake_Http_Server server;
+    server.wrong_range_once = 4096U;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader, 10000U));
+    TEST_ASSERT_TRUE(image_written());
+    TEST_ASSERT_EQUAL_UINT32(2U, downloader.getRequests());
+}
+
+void test_write_failure_and_cancel(void) {
+    Fake_Http_Server server;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    fail_after_blocks = 2U;
+    TEST_ASSERT_EQUAL(OTA_HTTP_WRITE_FAILED, download(downloader));
+    TEST_ASSERT_EQUAL_UINT32(2U * OTA_HTTP_BLOCK_SIZE, downloader.getOffset());
+    TEST_ASSERT_EQUAL_UINT32(1U, downloader.getRequests());
+
+    fail_after_blocks = UINT32_MAX;
+    block_ends.clear();
+    cancel_after_blocks = &downloader;
+    TEST_ASSERT_EQUAL(OTA_HTTP_CANCELLED, download(downloader));
+    TEST_ASSERT_EQUAL_UINT32(3U, block_ends.size());
+    TEST_ASSERT_EQUAL_UINT32(3U * OTA_HTTP_BLOCK_SIZE, downloader.getOffset());
+}
+
+// One streamed response against one request per chunk: HTTP pays the round trip once, MQTT once per window of chunks
+void test_throughput_against_mqtt(void) {
+    constexpr uint32_t ROUND_TRIP_MS = 100U;
+    constexpr uint32_t BYTES_PER_MS = 500U;
+    Fake_Http_Server server;
+    server.round_trip_ms = ROUND_TRIP_MS;
+    server.bytes_per_ms = BYTES_PER_MS;
+    OtaHttpDownloader downloader(server, "thingsboard.local", 80U);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    TEST_ASSERT_EQUAL(OTA_HTTP_OK, download(downloader));
+    const uint32_t http_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_TRUE(image_written());
+
+    const uint32_t sequential_ms = mqtt_download_ms(ROUND_TRIP_MS, BYTES_PER_MS, 1U, 4096U);
+    const uint32_t window_ms = mqtt_download_ms(ROUND_TRIP_MS, BYTES_PER_MS, OTA_WINDOW_SIZE, 4096U);
+    char message[160];
+    snprintf(message, sizeof(message), "%u KB at %u KB/s, %u ms RTT: HTTP %u ms, MQTT 4096 B chunks %u ms (window 1), %u ms (window %u)",
+             IMAGE_SIZE / 1000U, BYTES_PER_MS, ROUND_TRIP_MS, http_ms, sequential_ms, window_ms, OTA_WINDOW_SIZE);
+    TEST_MESSAGE(message);
+    // The link alone needs IMAGE_SIZE / BYTES_PER_MS = 200 ms
+    TEST_ASSERT_TRUE(http_ms >= IMAGE_SIZE / BYTES_PER_MS);
+    TEST_ASSERT_TRUE(http_ms < window_ms);
+    TEST_ASSERT_TRUE(window_ms < sequential_ms);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_download);
+    RUN_TEST(test_resume_from_offset);
+    RUN_TEST(test_server_without_ranges);
+    RUN_TEST(test_resume_after_dropped_connection);
+    RUN_TEST(test_chunked_response);
+    RUN_TEST(test_rejects_wrong_range);
+    RUN_TEST(test_write_failure_and_cancel);
+    RUN_TEST(test_throughput_against_mqtt);
+    return UNITY_END();
+}
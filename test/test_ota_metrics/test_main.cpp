@@ -0,0 +1,250 @@
+// OtaMetrics fed by OtaWindow over a simulated link the way the OTA task does it: latency, retries, throughput and ETA have to match
+// the link, and the telemetry payload must not be published more often than once per OTA_METRICS_INTERVAL
+#include <unity.h>
+#include <ArduinoJson.h>
+#include <OtaMetrics.h>
+#include <OtaWindow.h>
+#include <algorithm>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint16_t CHUNK_SIZE = 4096U;
+constexpr uint8_t WINDOW = 4U;
+constexpr uint32_t ROUND_TRIP_MS = 150U;
+constexpr uint32_t BYTES_PER_SECOND = 20000U;
+constexpr uint32_t TIMEOUT_MS = 2000U;
+constexpr uint32_t WRITE_US = 1200U;
+// The OTA task wakes up at least this often while it waits for chunks
+constexpr uint32_t WAKE_UP_MS = 1000U;
+
+uint8_t chunk[CHUNK_SIZE];
+
+bool write_chunk(uint8_t* data, size_t length) {
+    return true;
+}
+
+struct Arrival {
+    uint32_t at;
+    uint32_t index;
+
+    bool operator<(const Arrival& other) const {
+        return at > other.at;
+    }
+};
+
+struct Report {
+    uint32_t at;
+    std::string payload;
+};
+
+/// @brief Download result and every telemetry payload published during it
+struct Download {
+    uint32_t started_ms;
+    uint32_t finished_ms;
+    uint32_t chunks;
+    std::vector<Report> reports;
+};
+
+uint32_t now_ms = 0U;
+
+void publish(OtaMetrics& metrics, Download& download, const bool& force = false) {
+    char payload[448];
+    if (metrics.report(now_ms, payload, sizeof(payload), force)) {
+        download.reports.push_back({ now_ms, payload });
+    }
+}
+
+/// @brief Downloads over a link that sends one chunk at a time, every drop_every-th request is lost (0 = none)
+Download download(OtaMetrics& metrics, const uint32_t& size, const uint32_t& first_chunk, const uint32_t& drop_every) {
+    Download result = {};
+    result.started_ms = now_ms;
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(size, CHUNK_SIZE, WINDOW, write_chunk, first_chunk));
+    metrics.begin(size, first_chunk * CHUNK_SIZE, now_ms);
+    result.chunks = (size + CHUNK_SIZE - 1U) / CHUNK_SIZE - first_chunk;
+
+    std::priority_queue<Arrival> network;
+    uint32_t link_free_at = 0U;
+    uint32_t sent = 0U;
+    while (!window.complete()) {
+        uint32_t retries = window.getRetries();
+        int32_t index;
+        while ((index = window.nextRequest(now_ms, TIMEOUT_MS)) >= 0) {
+            metrics.onRequest(index, now_ms);
+            if (drop_every != 0U && ++sent % drop_every == 0U) {
+                continue;
+            }
+            const uint32_t length = std::min<uint32_t>(CHUNK_SIZE, size - index * CHUNK_SIZE);
+            link_free_at = std::max(now_ms + ROUND_TRIP_MS / 2U, link_free_at) + length * 1000U / BYTES_PER_SECOND;
+            network.push({ link_free_at + ROUND_TRIP_MS / 2U, static_cast<uint32_t>(index) });
+        }
+        for (; retries < window.getRetries(); retries++) {
+            metrics.onRetry();
+        }
+        publish(metrics, result);
+
+        uint32_t wake_up = now_ms + window.msUntilTimeout(now_ms, TIMEOUT_MS);
+        if (!network.empty()) {
+            wake_up = std::min(wake_up, network.top().at);
+        }
+        wake_up = std::max(wake_up, now_ms + 1U);
+        for (now_ms += WAKE_UP_MS; now_ms < wake_up; now_ms += WAKE_UP_MS) {
+            publish(metrics, result);
+        }
+        now_ms = wake_up;
+
+        while (!network.empty() && network.top().at <= now_ms) {
+            const Arrival arrival = network.top();
+            network.pop();
+            const uint32_t length = std::min<uint32_t>(CHUNK_SIZE, size - arrival.index * CHUNK_SIZE);
+            const OtaChunkResult chunk_result = window.onChunk(arrival.index, chunk, length);
+            TEST_ASSERT_TRUE(chunk_result != OTA_CHUNK_WRITE_FAILED);
+            if (chunk_result == OTA_CHUNK_IGNORED) {
+                continue;
+            }
+            if (chunk_result != OTA_CHUNK_RETRY) {
+                metrics.onResponse(arrival.index, now_ms);
+            }
+            metrics.onWrite(WRITE_US);
+            metrics.onProgress(window.writtenBytes());
+        }
+    }
+    publish(metrics, result, true);
+    metrics.end();
+    result.finished_ms = now_ms;
+    return result;
+}
+
+uint32_t field(const std::string& payload, const char *key) {
+    StaticJsonDocument<1024> document;
+    TEST_ASSERT_TRUE(deserializeJson(document, payload) == DeserializationError::Ok);
+    TEST_ASSERT_TRUE(document.containsKey(key));
+    return document[key].as<uint32_t>();
+}
+
+} // namespace
+
+void setUp(void) {
+    now_ms = 1000U;
+}
+
+void tearDown(void) {}
+
+// Periodic reports are at least OTA_METRICS_INTERVAL apart, only forced ones may come earlier, nothing is reported when inactive
+void test_rate_limited(void) {
+    OtaMetrics metrics;
+    const Download result = download(metrics, 1000000U, 0U, 0U);
+    const uint32_t duration = result.finished_ms - result.started_ms;
+    const uint32_t periodic = result.reports.size() - 1U;
+
+    char message[96];
+    snprintf(message, sizeof(message), "%u ms download, %u periodic reports", duration, periodic);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(periodic <= duration / OTA_METRICS_INTERVAL);
+    TEST_ASSERT_TRUE(periodic + 1U >= duration / OTA_METRICS_INTERVAL);
+    uint32_t previous = result.started_ms;
+    for (uint32_t i = 0U; i < periodic; i++) {
+        TEST_ASSERT_TRUE(result.reports[i].at - previous >= OTA_METRICS_INTERVAL);
+        previous = result.reports[i].at;
+    }
+
+    char payload[448];
+    TEST_ASSERT_FALSE(metrics.report(now_ms + OTA_METRICS_INTERVAL, payload, sizeof(payload), true));
+    metrics.begin(1000U, 0U, now_ms);
+    TEST_ASSERT_FALSE(metrics.report(now_ms + OTA_METRICS_INTERVAL - 1U, payload, sizeof(payload)));
+    TEST_ASSERT_TRUE(metrics.report(now_ms + 1U, payload, sizeof(payload), true));
+    TEST_ASSERT_FALSE(metrics.report(now_ms + OTA_METRICS_INTERVAL, payload, sizeof(payload)));
+    TEST_ASSERT_TRUE(metrics.report(now_ms + OTA_METRICS_INTERVAL + 1U, payload, sizeof(payload)));
+}
+
+// Without loss the throughput is the link bandwidth, the latency includes waiting for the chunks queued before,
+// and the first ETA is close to the time the download really took
+void test_clean_link(void) {
+    OtaMetrics metrics;
+    const Download result = download(metrics, 1000000U, 0U, 0U);
+    const OtaMetricsData& data = metrics.getMetrics();
+    TEST_ASSERT_EQUAL_UINT32(1000000U, data.writtenBytes);
+    TEST_ASSERT_EQUAL_UINT32(0U, data.etaSec);
+    TEST_ASSERT_EQUAL_UINT32(0U, data.retries);
+    TEST_ASSERT_EQUAL_UINT32(result.chunks, data.requests);
+    TEST_ASSERT_UINT32_WITHIN(BYTES_PER_SECOND / 20U, BYTES_PER_SECOND, data.throughput);
+    TEST_ASSERT_TRUE(data.latencyAvgMs >= ROUND_TRIP_MS + CHUNK_SIZE * 1000U / BYTES_PER_SECOND);
+    TEST_ASSERT_TRUE(data.latencyAvgMs < ROUND_TRIP_MS + WINDOW * CHUNK_SIZE * 1000U / BYTES_PER_SECOND);
+
+    const Report& first = result.reports.front();
+    const uint32_t remaining_sec = (result.finished_ms - first.at) / 1000U;
+    char message[96];
+    snprintf(message, sizeof(message), "ETA after %u s: %u s, really took %u s", (first.at - result.started_ms) / 1000U,
+             field(first.payload, "otaEta"), remaining_sec);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_UINT32_WITHIN(2U, remaining_sec, field(first.payload, "otaEta"));
+
+    const Report& last = result.reports.back();
+    TEST_ASSERT_EQUAL_UINT32(100U, field(last.payload, "otaProgress"));
+    TEST_ASSERT_EQUAL_UINT32(1000000U, field(last.payload, "otaBytes"));
+    TEST_ASSERT_EQUAL_UINT32(WRITE_US, field(last.payload, "otaWriteMaxUs"));
+    TEST_ASSERT_EQUAL_UINT32(data.latencyAvgMs, field(last.payload, "otaLatencyAvg"));
+}
+
+// Lost requests are counted as retries, responses to resent requests are not sampled since they may belong to either request
+void test_lossy_link(void) {
+    OtaMetrics metrics;
+    const Download result = download(metrics, 300000U, 0U, 10U);
+    const OtaMetricsData& data = metrics.getMetrics();
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, data.retries);
+    TEST_ASSERT_EQUAL_UINT32(result.chunks + data.retries, data.requests);
+    TEST_ASSERT_TRUE(data.latencyAvgMs < TIMEOUT_MS);
+    TEST_ASSERT_EQUAL_UINT32(data.retries, field(result.reports.back().payload, "otaRetries"));
+}
+
+// A download resumed from a checkpoint only counts the bytes received now into the throughput
+void test_resumed_download(void) {
+    OtaMetrics metrics;
+    download(metrics, 400000U, 50U, 0U);
+    const OtaMetricsData& data = metrics.getMetrics();
+    TEST_ASSERT_EQUAL_UINT32(50U * CHUNK_SIZE, data.startOffset);
+    TEST_ASSERT_EQUAL_UINT32(400000U, data.writtenBytes);
+    TEST_ASSERT_TRUE(data.throughput <= BYTES_PER_SECOND + BYTES_PER_SECOND / 20U);
+}
+
+// Maxima cover one reporting period, the payload with every counter at its largest value still fits the buffer
+void test_payload(void) {
+    OtaMetrics metrics;
+    metrics.begin(UINT32_MAX, 0U, 0U);
+    metrics.onRequest(0U, 0U);
+    metrics.onResponse(0U, 500U);
+    metrics.onWrite(3000U);
+    char payload[448];
+    TEST_ASSERT_TRUE(metrics.report(OTA_METRICS_INTERVAL, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_UINT32(500U, field(payload, "otaLatencyMax"));
+    TEST_ASSERT_EQUAL_UINT32(3000U, field(payload, "otaWriteMaxUs"));
+    TEST_ASSERT_TRUE(metrics.report(2U * OTA_METRICS_INTERVAL, payload, sizeof(payload)));
+    TEST_ASSERT_EQUAL_UINT32(0U, field(payload, "otaLatencyMax"));
+    TEST_ASSERT_EQUAL_UINT32(0U, field(payload, "otaWriteMaxUs"));
+    TEST_ASSERT_EQUAL_UINT32(500U, field(payload, "otaLatencyAvg"));
+
+    metrics.onWrite(UINT32_MAX);
+    metrics.onFlashStats(UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX);
+    metrics.onRequest(1U, 0U);
+    metrics.onResponse(1U, UINT32_MAX);
+    for (uint8_t i = 0U; i < 4U; i++) {
+        metrics.onRetry();
+    }
+    metrics.onProgress(UINT32_MAX - 1U);
+    TEST_ASSERT_TRUE(metrics.report(UINT32_MAX, payload, sizeof(payload), true));
+    TEST_ASSERT_TRUE(strlen(payload) < sizeof(payload) - 1U);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, field(payload, "otaFlashStallMs"));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rate_limited);
+    RUN_TEST(test_clean_link);
+    RUN_TEST(test_lossy_link);
+    RUN_TEST(test_resumed_download);
+    RUN_TEST(test_payload);
+    return UNITY_END();
+}
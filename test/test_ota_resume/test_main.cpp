@@ -0,0 +1,252 @@
+// Interrupted OTA downloads continued from the NVS checkpoint, with the partition and the checkpoint in the host stand-ins of flash and NVS.
+// Follows the resume sequence of startOtaProcess() in OTA.cpp: load and match the checkpoint, resume the partition, rehash the written part
+#include <unity.h>
+#include <OtaCheckpoint.h>
+#include <OtaWindow.h>
+#include <HashGenerator.h>
+#include <Partition_Updater.h>
+#include <esp_ota_ops.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr char NAMESPACE[] = "ota_test";
+constexpr uint16_t CHUNK_SIZE = 4096U;
+constexpr size_t IMAGE_SIZE = 300001U;
+
+std::vector<uint8_t> image;
+std::string checksum;
+
+/// @brief State of the OTA module that is lost on a power cycle, only flash and NVS survive
+struct Device {
+    OtaCheckpoint checkpoint;
+    Partition_Updater updater;
+    HashGenerator hash;
+    OtaWindow window;
+    uint16_t chunk_size;
+
+    Device() : checkpoint(NAMESPACE), chunk_size(CHUNK_SIZE) {}
+
+    /// @brief Starts or resumes the download of the given firmware
+    /// @return First chunk that still has to be requested, negative if starting failed
+    int32_t start(const char *version, const uint16_t& offered_chunk_size) {
+        chunk_size = offered_chunk_size;
+        uint32_t first_chunk = 0U;
+        uint16_t max_chunk_size = chunk_size;
+        hash.start(MD_TYPE_CRC32);
+        if (checkpoint.load() && updater.begin(IMAGE_SIZE) &&
+            checkpoint.matches("firmware", version, "CRC32", checksum.c_str(), IMAGE_SIZE, updater.get_partition_address())) {
+            const uint16_t saved_chunk_size = checkpoint.getChunkSize();
+            const size_t offset = std::min(static_cast<size_t>(checkpoint.getChunks()) * saved_chunk_size, IMAGE_SIZE);
+            if (updater.resume(IMAGE_SIZE, offset) && rehash(offset)) {
+                chunk_size = saved_chunk_size;
+                max_chunk_size = std::max(max_chunk_size, saved_chunk_size);
+                first_chunk = checkpoint.getChunks();
+            }
+            else {
+                hash.start(MD_TYPE_CRC32);
+            }
+        }
+        if (first_chunk == 0U && (!updater.begin(IMAGE_SIZE) ||
+            !checkpoint.begin("firmware", version, "CRC32", checksum.c_str(), IMAGE_SIZE, chunk_size, updater.get_partition_address()))) {
+            return -1;
+        }
+        return window.begin(IMAGE_SIZE, chunk_size, 4U, write, first_chunk, max_chunk_size) ? static_cast<int32_t>(first_chunk) : -1;
+    }
+
+    bool rehash(const size_t& length) {
+        uint8_t buffer[512];
+        for (size_t position = 0U; position < length; position += sizeof(buffer)) {
+            const size_t block = std::min(sizeof(buffer), length - position);
+            if (updater.read(position, buffer, block) != block || !hash.update(buffer, block)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void on_written(const OtaChunkResult& result) {
+        if (result == OTA_CHUNK_WRITTEN) {
+            checkpoint.update(updater.get_offset() / chunk_size, chunk_size);
+        }
+    }
+
+    static bool write(uint8_t* data, size_t length);
+};
+
+Device *device = nullptr;
+
+bool Device::write(uint8_t* data, size_t length) {
+    return device->updater.write(data, length) == length && device->hash.update(data, length);
+}
+
+/// @brief Receives the chunks in random order until the download completes or the given amount of responses was handled
+/// @return Whether the download completed
+bool download(std::mt19937& random, const uint32_t& power_loss_after) {
+    std::vector<uint32_t> pending;
+    uint32_t responses = 0U;
+    while (!device->window.complete()) {
+        int32_t index;
+        while ((index = device->window.nextRequest(1U, 100000U)) >= 0) {
+            pending.push_back(static_cast<uint32_t>(index));
+        }
+        const size_t pick = random() % pending.size();
+        const uint32_t chunk = pending[pick];
+        pending.erase(pending.begin() + pick);
+        const size_t offset = static_cast<size_t>(chunk) * device->window.getChunkSize();
+        const size_t length = std::min<size_t>(device->window.getChunkSize(), IMAGE_SIZE - offset);
+        device->on_written(device->window.onChunk(chunk, image.data() + offset, length));
+        if (++responses == power_loss_after) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool partition_matches_image() {
+    const std::vector<uint8_t> *written = host_flash::content(esp_ota_get_next_update_partition(nullptr));
+    return memcmp(written->data(), image.data(), IMAGE_SIZE) == 0;
+}
+
+} // namespace
+
+void setUp(void) {
+    std::mt19937 random(7U);
+    image.resize(IMAGE_SIZE);
+    for (uint8_t& byte : image) {
+        byte = static_cast<uint8_t>(random());
+    }
+    image[0U] = ESP_IMAGE_HEADER_MAGIC;
+    HashGenerator expected;
+    expected.start(MD_TYPE_CRC32);
+    expected.update(image.data(), image.size());
+    checksum = expected.get_hash_string();
+    // Left behind by an older image, every sector has to be erased before it is written
+    host_flash::reset(0x5AU);
+    Preferences::storage().clear();
+}
+
+void tearDown(void) {
+    delete device;
+    device = nullptr;
+}
+
+// Power is lost at random points, every restart continues at the checkpoint and the final image and checksum are intact
+void test_power_loss(void) {
+    std::mt19937 random(11U);
+    for (uint8_t trial = 0U; trial < 20U; trial++) {
+        host_flash::reset(0x5AU);
+        Preferences::storage().clear();
+        uint8_t restarts = 0U;
+        uint32_t resumed_chunks = 0U;
+        bool complete = false;
+        while (!complete) {
+            delete device;
+            device = new Device();
+            const int32_t first_chunk = device->start("1.1", CHUNK_SIZE);
+            TEST_ASSERT_TRUE(first_chunk >= 0);
+            resumed_chunks += first_chunk;
+            const uint32_t power_loss_after = restarts < 5U ? 1U + random() % 40U : 0U;
+            complete = download(random, power_loss_after);
+            restarts++;
+        }
+        TEST_ASSERT_EQUAL_STRING(checksum.c_str(), device->hash.get_hash_string().c_str());
+        TEST_ASSERT_TRUE(partition_matches_image());
+        TEST_ASSERT_TRUE(device->updater.end());
+        TEST_ASSERT_EQUAL_UINT32(0U, host_flash::flash().violations);
+        TEST_ASSERT_GREATER_THAN_UINT32(0U, resumed_chunks);
+    }
+}
+
+// Only a checkpoint of the same firmware is continued, anything else starts over
+void test_other_firmware_starts_over(void) {
+    std::mt19937 random(3U);
+    device = new Device();
+    TEST_ASSERT_EQUAL_INT32(0, device->start("1.1", CHUNK_SIZE));
+    TEST_ASSERT_FALSE(download(random, 40U));
+    delete device;
+
+    device = new Device();
+    TEST_ASSERT_EQUAL_INT32(0, device->start("1.2", CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0U, device->checkpoint.getChunks());
+    TEST_ASSERT_TRUE(download(random, 0U));
+    TEST_ASSERT_TRUE(partition_matches_image());
+    TEST_ASSERT_EQUAL_UINT32(0U, host_flash::flash().violations);
+}
+
+// The checkpoint keeps the chunk size of the interrupted download, chunk indexes depend on it.
+// Chunk sizes that are not a multiple of the sector size leave the checkpoint inside of a sector,
+// whose data behind the checkpoint was already written before the power loss and is programmed again with the same bytes
+void test_resume_keeps_chunk_size(void) {
+    const uint16_t sizes[] = { 1024U, 1000U, 1500U };
+    for (const uint16_t& size : sizes) {
+        std::mt19937 random(size);
+        host_flash::reset(0x5AU);
+        Preferences::storage().clear();
+        delete device;
+        device = new Device();
+        TEST_ASSERT_EQUAL_INT32(0, device->start("1.1", size));
+        TEST_ASSERT_FALSE(download(random, 3U * OTA_CHECKPOINT_INTERVAL + 5U));
+        delete device;
+
+        device = new Device();
+        const int32_t first_chunk = device->start("1.1", CHUNK_SIZE);
+        TEST_ASSERT_TRUE(first_chunk > 0);
+        TEST_ASSERT_EQUAL_UINT16(size, device->window.getChunkSize());
+        TEST_ASSERT_EQUAL_UINT32(static_cast<uint32_t>(first_chunk) * size, device->updater.get_offset());
+        TEST_ASSERT_TRUE(download(random, 0U));
+        TEST_ASSERT_EQUAL_STRING(checksum.c_str(), device->hash.get_hash_string().c_str());
+        TEST_ASSERT_TRUE(partition_matches_image());
+        TEST_ASSERT_EQUAL_UINT32(0U, host_flash::flash().violations);
+    }
+}
+
+// NVS is only written every OTA_CHECKPOINT_INTERVAL chunks, forced writes and chunk size changes are written right away
+void test_checkpoint_interval(void) {
+    OtaCheckpoint checkpoint(NAMESPACE);
+    TEST_ASSERT_TRUE(checkpoint.begin("firmware", "1.1", "CRC32", "00", IMAGE_SIZE, CHUNK_SIZE, 0x110000U));
+    for (uint32_t chunk = 1U; chunk < OTA_CHECKPOINT_INTERVAL; chunk++) {
+        checkpoint.update(chunk, CHUNK_SIZE);
+    }
+    OtaCheckpoint stored(NAMESPACE);
+    TEST_ASSERT_TRUE(stored.load());
+    TEST_ASSERT_EQUAL_UINT32(0U, stored.getChunks());
+    checkpoint.update(OTA_CHECKPOINT_INTERVAL, CHUNK_SIZE);
+    TEST_ASSERT_TRUE(stored.load());
+    TEST_ASSERT_EQUAL_UINT32(OTA_CHECKPOINT_INTERVAL, stored.getChunks());
+    checkpoint.update(OTA_CHECKPOINT_INTERVAL + 1U, CHUNK_SIZE, true);
+    TEST_ASSERT_TRUE(stored.load());
+    TEST_ASSERT_EQUAL_UINT32(OTA_CHECKPOINT_INTERVAL + 1U, stored.getChunks());
+    checkpoint.update(2U * (OTA_CHECKPOINT_INTERVAL + 1U), CHUNK_SIZE / 2U);
+    TEST_ASSERT_TRUE(stored.load());
+    TEST_ASSERT_EQUAL_UINT16(CHUNK_SIZE / 2U, stored.getChunkSize());
+    TEST_ASSERT_TRUE(stored.matches("firmware", "1.1", "crc32", "00", IMAGE_SIZE, 0x110000U));
+    TEST_ASSERT_FALSE(stored.matches("firmware", "1.1", "CRC32", "00", IMAGE_SIZE, 0x10000U));
+
+    checkpoint.clear();
+    TEST_ASSERT_FALSE(stored.load());
+}
+
+// A truncated or foreign value in NVS is not used
+void test_corrupt_checkpoint(void) {
+    OtaCheckpoint checkpoint(NAMESPACE);
+    TEST_ASSERT_TRUE(checkpoint.begin("firmware", "1.1", "CRC32", "00", IMAGE_SIZE, CHUNK_SIZE, 0x110000U));
+    std::vector<uint8_t>& value = Preferences::storage()[NAMESPACE]["progress"];
+    value.resize(value.size() - 1U);
+    TEST_ASSERT_FALSE(checkpoint.load());
+    value.resize(sizeof(OtaCheckpointData), 0U);
+    value[0U] ^= 0xFFU;
+    TEST_ASSERT_FALSE(checkpoint.load());
+    TEST_ASSERT_FALSE(checkpoint.matches("firmware", "1.1", "CRC32", "00", IMAGE_SIZE, 0x110000U));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_power_loss);
+    RUN_TEST(test_other_firmware_starts_over);
+    RUN_TEST(test_resume_keeps_chunk_size);
+    RUN_TEST(test_checkpoint_interval);
+    RUN_TEST(test_corrupt_checkpoint);
+    return UNITY_END();
+}
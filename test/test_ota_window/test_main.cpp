@@ -0,0 +1,356 @@
+// OtaWindow against a simulated link with latency, jitter, reordering, duplicates and loss, the written image has to match byte for byte.
+// Responses carry the window generation of their request, like the request id of the firmware chunk topic, and are dropped like
+// otaChunkHandler drops them once the chunk size changed
+#include <unity.h>
+#include <OtaWindow.h>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t IMAGE_SIZE = 100000U;
+constexpr uint16_t CHUNK_SIZE = 4096U;
+constexpr uint32_t TIMEOUT_MS = 2000U;
+
+std::vector<uint8_t> image;
+std::vector<uint8_t> written;
+size_t fail_after = SIZE_MAX;
+
+bool write_chunk(uint8_t* data, size_t length) {
+    if (written.size() + length > fail_after) {
+        return false;
+    }
+    written.insert(written.end(), data, data + length);
+    return true;
+}
+
+/// @brief Broker that answers every chunk request after a random delay, can drop or duplicate the responses
+struct Link {
+    uint32_t latency_ms;
+    uint32_t jitter_ms;
+    uint32_t loss_percent;
+    uint32_t duplicate_percent;
+};
+
+struct Transfer {
+    bool complete;
+    uint32_t elapsed_ms;
+    uint32_t retries;
+    uint32_t requests;
+};
+
+struct Response {
+    uint32_t at;
+    uint32_t index;
+    uint32_t offset;
+    uint16_t length;
+    uint32_t generation;
+};
+
+/// @brief Response to a chunk request with the chunk size at the time of the request
+Response respond(const OtaWindow& window, const uint32_t& index, const uint32_t& at, const uint32_t& image_size = IMAGE_SIZE) {
+    const uint32_t offset = index * window.getChunkSize();
+    const uint16_t length = static_cast<uint16_t>(std::min<uint32_t>(window.getChunkSize(), image_size - offset));
+    return { at, index, offset, length, window.getGeneration() };
+}
+
+/// @brief Same check as otaChunkHandler, the request id changes together with the generation
+OtaChunkResult deliver(OtaWindow& window, const Response& response) {
+    if (response.generation != window.getGeneration()) {
+        return OTA_CHUNK_IGNORED;
+    }
+    return window.onChunk(response.index, image.data() + response.offset, response.length);
+}
+
+/// @brief Runs the download like the OTA task does: send every request the window allows, then wait for the next response or timeout
+/// @param resize_at Written chunk count at which the chunk size is changed to resize_to, 0 to keep the chunk size
+/// @param cycle_bytes Cycles the chunk size through 1024, 4096 and 2048 every cycle_bytes written bytes, 0 to disable it
+Transfer simulate(OtaWindow& window, const Link& link, const uint32_t& seed, const uint32_t& resize_at = 0U, const uint16_t& resize_to = 0U,
+                  const uint32_t& cycle_bytes = 0U) {
+    static const uint16_t CYCLE[] = { 1024U, 4096U, 2048U };
+    std::mt19937 random(seed);
+    std::vector<Response> network;
+    Transfer transfer = {};
+    uint32_t now = 1U;
+    while (!window.complete() && now < 10000000U) {
+        if (resize_at != 0U && window.writtenChunks() >= resize_at) {
+            window.setChunkSize(resize_to);
+        }
+        if (cycle_bytes != 0U) {
+            window.setChunkSize(CYCLE[(window.writtenBytes() / cycle_bytes) % 3U]);
+        }
+        int32_t index;
+        while ((index = window.nextRequest(now, TIMEOUT_MS)) >= 0) {
+            transfer.requests++;
+            if (random() % 100U < link.loss_percent) {
+                continue;
+            }
+            // Chunk indexes are relative to the chunk size at the time of the request, like the firmware chunk topic
+            const uint32_t delay = link.latency_ms + (link.jitter_ms > 0U ? random() % link.jitter_ms : 0U);
+            network.push_back(respond(window, static_cast<uint32_t>(index), now + delay));
+            if (random() % 100U < link.duplicate_percent) {
+                network.push_back(respond(window, static_cast<uint32_t>(index), now + delay + link.latency_ms));
+            }
+        }
+        size_t earliest = network.size();
+        for (size_t i = 0U; i < network.size(); i++) {
+            if (earliest == network.size() || network[i].at < network[earliest].at) {
+                earliest = i;
+            }
+        }
+        const uint32_t wait = window.msUntilTimeout(now, TIMEOUT_MS);
+        if (earliest == network.size() || network[earliest].at > now + wait) {
+            now += std::max<uint32_t>(wait, 1U);
+            continue;
+        }
+        const Response response = network[earliest];
+        network.erase(network.begin() + earliest);
+        now = std::max(now, response.at);
+        if (deliver(window, response) == OTA_CHUNK_WRITE_FAILED) {
+            break;
+        }
+    }
+    transfer.complete = window.complete();
+    transfer.elapsed_ms = now;
+    transfer.retries = window.getRetries();
+    return transfer;
+}
+
+} // namespace
+
+void setUp(void) {
+    image.resize(IMAGE_SIZE);
+    for (size_t i = 0U; i < image.size(); i++) {
+        image[i] = static_cast<uint8_t>(i * 31U + (i >> 8U));
+    }
+    written.clear();
+    fail_after = SIZE_MAX;
+}
+
+void tearDown(void) {}
+
+// Reordered and duplicated responses are written strictly in order, for every window size
+void test_reordered_duplicates(void) {
+    const Link link = { 50U, 100U, 0U, 10U };
+    for (uint8_t size = 1U; size <= OTA_WINDOW_MAX; size *= 2U) {
+        written.clear();
+        OtaWindow window;
+        TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, size, write_chunk));
+        const Transfer transfer = simulate(window, link, size);
+        TEST_ASSERT_TRUE(transfer.complete);
+        TEST_ASSERT_EQUAL_UINT32(0U, transfer.retries);
+        TEST_ASSERT_EQUAL_UINT32(IMAGE_SIZE, window.writtenBytes());
+        TEST_ASSERT_TRUE(written == image);
+    }
+}
+
+// Lost responses are requested again after the timeout
+void test_lost_chunks_are_requested_again(void) {
+    const Link link = { 50U, 100U, 15U, 5U };
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 4U, write_chunk));
+    const Transfer transfer = simulate(window, link, 7U);
+    TEST_ASSERT_TRUE(transfer.complete);
+    TEST_ASSERT_GREATER_THAN_UINT32(0U, transfer.retries);
+    TEST_ASSERT_EQUAL_UINT32(25U + transfer.retries, transfer.requests);
+    TEST_ASSERT_TRUE(written == image);
+}
+
+// With several chunks in flight the download takes about one round trip per window instead of one per chunk
+void test_window_hides_latency(void) {
+    const Link link = { 150U, 20U, 0U, 0U };
+    uint32_t elapsed[OTA_WINDOW_MAX + 1U] = {};
+    for (uint8_t size = 1U; size <= OTA_WINDOW_MAX; size *= 2U) {
+        written.clear();
+        OtaWindow window;
+        TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, size, write_chunk));
+        const Transfer transfer = simulate(window, link, 3U);
+        TEST_ASSERT_TRUE(transfer.complete);
+        elapsed[size] = transfer.elapsed_ms;
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(elapsed[1U] / 3U, elapsed[4U]);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(elapsed[4U], elapsed[8U]);
+    char message[128];
+    snprintf(message, sizeof(message), "25 chunks over 150 ms: window 1 %u ms, 2 %u ms, 4 %u ms, 8 %u ms",
+      static_cast<unsigned>(elapsed[1U]), static_cast<unsigned>(elapsed[2U]), static_cast<unsigned>(elapsed[4U]), static_cast<unsigned>(elapsed[8U]));
+    TEST_MESSAGE(message);
+}
+
+void test_unexpected_chunks(void) {
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 2U, write_chunk));
+    TEST_ASSERT_EQUAL_INT32(0, window.nextRequest(1U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_INT32(1, window.nextRequest(1U, TIMEOUT_MS));
+    // Window full, nothing to request until a chunk is written or times out
+    TEST_ASSERT_EQUAL_INT32(-1, window.nextRequest(2U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_UINT32(TIMEOUT_MS - 1U, window.msUntilTimeout(2U, TIMEOUT_MS));
+
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, window.onChunk(2U, image.data(), CHUNK_SIZE));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_RETRY, window.onChunk(0U, image.data(), CHUNK_SIZE - 1U));
+    // Truncated chunk is requested again right away, without waiting for the timeout
+    TEST_ASSERT_EQUAL_UINT32(0U, window.msUntilTimeout(3U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_INT32(0, window.nextRequest(3U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_UINT32(1U, window.getRetries());
+
+    TEST_ASSERT_EQUAL(OTA_CHUNK_BUFFERED, window.onChunk(1U, image.data() + CHUNK_SIZE, CHUNK_SIZE));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, window.onChunk(1U, image.data() + CHUNK_SIZE, CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(0U, written.size());
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, window.onChunk(0U, image.data(), CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(2U, window.writtenChunks());
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, window.onChunk(0U, image.data(), CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(image.data(), written.data(), 2U * CHUNK_SIZE);
+}
+
+// The last chunk is shorter, its expected length is derived from the total size
+void test_last_chunk_length(void) {
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 1U, write_chunk, 24U));
+    TEST_ASSERT_EQUAL_INT32(24, window.nextRequest(1U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_RETRY, window.onChunk(24U, image.data() + 24U * CHUNK_SIZE, CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_INT32(24, window.nextRequest(2U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, window.onChunk(24U, image.data() + 24U * CHUNK_SIZE, IMAGE_SIZE - 24U * CHUNK_SIZE));
+    TEST_ASSERT_TRUE(window.complete());
+    TEST_ASSERT_EQUAL_INT32(-1, window.nextRequest(3U, TIMEOUT_MS));
+}
+
+// A resumed download starts at the first chunk that was not written yet
+void test_resume_from_first_chunk(void) {
+    const Link link = { 50U, 100U, 5U, 5U };
+    written.assign(image.begin(), image.begin() + 10U * CHUNK_SIZE);
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 4U, write_chunk, 10U));
+    TEST_ASSERT_EQUAL_UINT32(10U, window.writtenChunks());
+    const Transfer transfer = simulate(window, link, 11U);
+    TEST_ASSERT_TRUE(transfer.complete);
+    TEST_ASSERT_TRUE(written == image);
+}
+
+// The chunk size changes once every chunk in flight was written and the position is a multiple of the new size
+void test_chunk_size_change(void) {
+    const Link link = { 50U, 100U, 5U, 0U };
+    const uint16_t sizes[][2] = { { 1024U, 4096U }, { 4096U, 1024U }, { 1024U, 3072U }, { 2048U, 2048U } };
+    for (const auto& size : sizes) {
+        written.clear();
+        OtaWindow window;
+        TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, size[0U], 4U, write_chunk, 0U, 4096U));
+        const Transfer transfer = simulate(window, link, size[0U] + size[1U], 5U, size[1U]);
+        TEST_ASSERT_TRUE(transfer.complete);
+        TEST_ASSERT_EQUAL_UINT16(size[1U], window.getChunkSize());
+        TEST_ASSERT_TRUE(written == image);
+    }
+
+    // Larger than the buffers allocated in begin()
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, 1024U, 4U, write_chunk, 0U, 2048U));
+    window.setChunkSize(4096U);
+    TEST_ASSERT_EQUAL_INT32(0, window.nextRequest(1U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL_UINT16(1024U, window.getChunkSize());
+}
+
+// Late responses of the old chunk size, whose length happens to match the chunk with the same index at the new size. Passed to
+// onChunk() they would be written at the wrong offset, the changed generation drops them
+void test_late_responses_across_resize(void) {
+    constexpr uint32_t SIZE = 5U * 1024U;
+
+    // Shrinking from 2048 to 1024 drops chunk 1 and 2 in flight, old chunk 2 has the 1024 bytes the new chunk 2 expects
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(SIZE, 2048U, 4U, write_chunk, 0U, 2048U));
+    std::vector<Response> old;
+    int32_t index;
+    while ((index = window.nextRequest(1U, TIMEOUT_MS)) >= 0) {
+        old.push_back(respond(window, static_cast<uint32_t>(index), 1U, SIZE));
+    }
+    TEST_ASSERT_EQUAL_UINT32(3U, old.size());
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, deliver(window, old[0U]));
+    window.setChunkSize(1024U);
+    std::vector<Response> requests;
+    while ((index = window.nextRequest(2U, TIMEOUT_MS)) >= 0) {
+        requests.push_back(respond(window, static_cast<uint32_t>(index), 2U, SIZE));
+    }
+    TEST_ASSERT_EQUAL_UINT16(1024U, window.getChunkSize());
+    TEST_ASSERT_EQUAL_UINT32(2U, requests.front().index);
+    TEST_ASSERT_EQUAL_UINT32(old[2U].index, requests.front().index);
+    TEST_ASSERT_EQUAL_UINT16(old[2U].length, requests.front().length);
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, deliver(window, old[2U]));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, deliver(window, old[1U]));
+    for (const Response& response : requests) {
+        TEST_ASSERT_TRUE(deliver(window, response) != OTA_CHUNK_RETRY);
+    }
+    TEST_ASSERT_TRUE(window.complete());
+    TEST_ASSERT_EQUAL_UINT32(0U, window.getRetries());
+    TEST_ASSERT_EQUAL_UINT32(SIZE, written.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(image.data(), written.data(), SIZE);
+
+    // Growing from 1024 to 2048 after chunk 2 timed out and was answered by its second request, the first answer arrives late
+    // and has the 1024 bytes of the last chunk, which is chunk 2 at the new size as well
+    written.clear();
+    TEST_ASSERT_TRUE(window.begin(SIZE, 1024U, 4U, write_chunk, 0U, 2048U));
+    old.clear();
+    while ((index = window.nextRequest(1U, TIMEOUT_MS)) >= 0) {
+        old.push_back(respond(window, static_cast<uint32_t>(index), 1U, SIZE));
+    }
+    TEST_ASSERT_EQUAL_UINT32(4U, old.size());
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, deliver(window, old[0U]));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, deliver(window, old[1U]));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_BUFFERED, deliver(window, old[3U]));
+    TEST_ASSERT_EQUAL_INT32(2, window.nextRequest(TIMEOUT_MS + 1U, TIMEOUT_MS));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, deliver(window, respond(window, 2U, TIMEOUT_MS + 1U, SIZE)));
+    window.setChunkSize(2048U);
+    requests.clear();
+    while ((index = window.nextRequest(TIMEOUT_MS + 2U, TIMEOUT_MS)) >= 0) {
+        requests.push_back(respond(window, static_cast<uint32_t>(index), TIMEOUT_MS + 2U, SIZE));
+    }
+    TEST_ASSERT_EQUAL_UINT16(2048U, window.getChunkSize());
+    TEST_ASSERT_EQUAL_UINT32(1U, requests.size());
+    TEST_ASSERT_EQUAL_UINT32(old[2U].index, requests.front().index);
+    TEST_ASSERT_EQUAL_UINT16(old[2U].length, requests.front().length);
+    TEST_ASSERT_EQUAL(OTA_CHUNK_IGNORED, deliver(window, old[2U]));
+    TEST_ASSERT_EQUAL(OTA_CHUNK_WRITTEN, deliver(window, requests.front()));
+    TEST_ASSERT_TRUE(window.complete());
+    TEST_ASSERT_EQUAL_UINT32(SIZE, written.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(image.data(), written.data(), SIZE);
+}
+
+// Chunk size changing back and forth under jitter and duplicates: stale responses neither corrupt the image nor cause retries
+void test_repeated_resizes(void) {
+    const Link link = { 50U, 400U, 0U, 20U };
+    for (uint32_t seed = 1U; seed <= 20U; seed++) {
+        written.clear();
+        OtaWindow window;
+        TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, 2048U, 4U, write_chunk, 0U, 4096U));
+        const Transfer transfer = simulate(window, link, seed, 0U, 0U, 4096U);
+        TEST_ASSERT_TRUE(transfer.complete);
+        TEST_ASSERT_GREATER_THAN_UINT32(2U, window.getGeneration());
+        TEST_ASSERT_EQUAL_UINT32(0U, transfer.retries);
+        TEST_ASSERT_TRUE(written == image);
+    }
+}
+
+void test_write_failure(void) {
+    const Link link = { 50U, 100U, 0U, 0U };
+    fail_after = 5U * CHUNK_SIZE;
+    OtaWindow window;
+    TEST_ASSERT_TRUE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 4U, write_chunk));
+    const Transfer transfer = simulate(window, link, 5U);
+    TEST_ASSERT_FALSE(transfer.complete);
+    TEST_ASSERT_EQUAL_UINT32(5U * CHUNK_SIZE, written.size());
+
+    TEST_ASSERT_FALSE(window.begin(0U, CHUNK_SIZE, 4U, write_chunk));
+    TEST_ASSERT_FALSE(window.begin(IMAGE_SIZE, 0U, 4U, write_chunk));
+    TEST_ASSERT_FALSE(window.begin(IMAGE_SIZE, CHUNK_SIZE, 4U, nullptr));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_reordered_duplicates);
+    RUN_TEST(test_lost_chunks_are_requested_again);
+    RUN_TEST(test_window_hides_latency);
+    RUN_TEST(test_unexpected_chunks);
+    RUN_TEST(test_last_chunk_length);
+    RUN_TEST(test_resume_from_first_chunk);
+    RUN_TEST(test_chunk_size_change);
+    RUN_TEST(test_late_responses_across_resize);
+    RUN_TEST(test_repeated_resizes);
+    RUN_TEST(test_write_failure);
+    return UNITY_END();
+}
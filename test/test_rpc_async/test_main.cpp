@@ -0,0 +1,490 @@
+// RPC_Async_Dispatcher under concurrent load: the test thread acts as the MQTT task that submits requests and sends responses,
+// the worker task calls the callbacks, several responder threads answer out of order and the watchdog timers expire unanswered requests
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <Loopback_MQTT_Client.h>
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/// @brief Counts the log messages instead of printing them, a flooded dispatcher logs every dropped request
+struct Counting_Logger {
+    static std::atomic<uint32_t> messages;
+    static void log(const char *message) {
+        (void)message;
+        messages++;
+    }
+};
+std::atomic<uint32_t> Counting_Logger::messages(0U);
+
+using Dispatcher = RPC_Async_Dispatcher<Counting_Logger>;
+using Clock = std::chrono::steady_clock;
+
+constexpr char TIMEOUT_RESPONSE[] = "{\"error\":\"timeout\"}";
+
+/// @brief Request that has been handed to the callback and waits for one of the responder threads
+struct Pending {
+    RPC_Token token;
+    int value;
+    Clock::time_point due;
+};
+
+/// @brief Requests waiting for a response, filled by the callbacks on the worker task and emptied by the responder threads
+struct Pending_Queue {
+    std::mutex mutex;
+    std::vector<Pending> pending;
+    std::atomic<uint32_t> accepted{0U};
+    std::atomic<uint32_t> rejected{0U};
+    std::map<uint32_t, bool> accepted_ids; // Guarded by mutex, whether respond() accepted the response of the request
+
+    void add(const RPC_Token& token, const int& value, const Clock::duration& delay) {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending.push_back(Pending{ token, value, Clock::now() + delay });
+    }
+
+    /// @brief Takes a random request whose response is due, so responses are given in a different order than the requests were received in
+    bool take_due(std::mt19937& random, Pending& taken) {
+        std::lock_guard<std::mutex> lock(mutex);
+        const Clock::time_point now = Clock::now();
+        std::vector<size_t> due;
+        for (size_t i = 0U; i < pending.size(); i++) {
+            if (pending[i].due <= now) {
+                due.push_back(i);
+            }
+        }
+        if (due.empty()) {
+            return false;
+        }
+        const size_t index = due[random() % due.size()];
+        taken = pending[index];
+        pending.erase(pending.begin() + index);
+        return true;
+    }
+
+    void record(const uint32_t& request_id, const bool& result) {
+        (result ? accepted : rejected)++;
+        std::lock_guard<std::mutex> lock(mutex);
+        accepted_ids[request_id] = result;
+    }
+};
+
+/// @brief Responder threads, that answer due requests with twice their value
+class Responders {
+  public:
+    Responders(Dispatcher& dispatcher, Pending_Queue& queue, const size_t& count) {
+        for (size_t i = 0U; i < count; i++) {
+            m_threads.emplace_back([this, &dispatcher, &queue, i]() {
+                std::mt19937 random(static_cast<uint32_t>(i + 1U));
+                while (m_running) {
+                    Pending taken;
+                    if (!queue.take_due(random, taken)) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                        continue;
+                    }
+                    queue.record(taken.token.request_id, dispatcher.respond(taken.token, RPC_Response("result", taken.value * 2)));
+                }
+            });
+        }
+    }
+
+    ~Responders() {
+        m_running = false;
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+  private:
+    std::atomic<bool> m_running{true};
+    std::vector<std::thread> m_threads;
+};
+
+/// @brief Responses sent by process(), in the order they were sent
+struct Sent_Responses {
+    std::map<uint32_t, std::vector<std::string>> responses;
+
+    size_t process(Dispatcher& dispatcher) {
+        return dispatcher.process([this](const uint32_t& request_id, const char *json, const size_t& length) {
+            responses[request_id].emplace_back(json, length);
+            return true;
+        });
+    }
+
+    /// @brief Calls process() until nothing is pending anymore or the given time passed
+    void drain(Dispatcher& dispatcher, const std::chrono::milliseconds& limit) {
+        const Clock::time_point end = Clock::now() + limit;
+        while (dispatcher.get_pending() > 0U && Clock::now() < end) {
+            process(dispatcher);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        process(dispatcher);
+    }
+};
+
+std::string result_json(const int& value) {
+    return "{\"result\":" + std::to_string(value) + "}";
+}
+
+bool submit_value(Dispatcher& dispatcher, const RPC_Async_Callback& callback, const uint32_t& request_id, const int& value) {
+    StaticJsonDocument<64> params;
+    params["v"] = value;
+    return dispatcher.submit(callback, request_id, params.as<JsonVariantConst>());
+}
+
+/// @brief Amount of running tasks once the given amount is reached or the time passed, the worker task deletes itself only after stop() returned
+UBaseType_t wait_for_tasks(const UBaseType_t& count) {
+    for (uint32_t i = 0U; i < 100U && uxTaskGetNumberOfTasks() != count; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return uxTaskGetNumberOfTasks();
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// Floods submit() from the test thread, retrying whenever all slots are in use, while three responder threads answer out of order.
+// Every tenth request is answered only after its timeout and every seventh is never answered, both have to be expired by their watchdog
+void test_flood_out_of_order_and_expiry(void) {
+    constexpr uint32_t REQUESTS = 400U;
+    constexpr uint64_t TIMEOUT_US = 60000U;
+    Pending_Queue queue;
+    std::mt19937 random(1234U);
+    std::mutex random_mutex;
+    const RPC_Async_Callback callback("flood", [&queue, &random, &random_mutex](const RPC_Token& token, RPC_Data& params) {
+        const int value = params["v"].as<int>();
+        uint32_t delay_ms;
+        {
+            std::lock_guard<std::mutex> lock(random_mutex);
+            delay_ms = random() % 30U;
+        }
+        if (value % 7 == 0) {
+            return;
+        }
+        if (value % 10 == 0) {
+            delay_ms = 150U;
+        }
+        queue.add(token, value, std::chrono::milliseconds(delay_ms));
+    }, TIMEOUT_US);
+
+    Sent_Responses sent;
+    uint32_t busy = 0U;
+    {
+        Dispatcher dispatcher(8U, 128U);
+        Responders responders(dispatcher, queue, 3U);
+        for (uint32_t id = 1U; id <= REQUESTS; id++) {
+            while (!submit_value(dispatcher, callback, id, static_cast<int>(id))) {
+                busy++;
+                sent.process(dispatcher);
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+            sent.process(dispatcher);
+        }
+        sent.drain(dispatcher, std::chrono::seconds(5));
+        TEST_ASSERT_EQUAL_UINT32(0U, dispatcher.get_pending());
+        // Late responses of expired requests are still in the queue, wait until all of them were rejected
+        const Clock::time_point end = Clock::now() + std::chrono::seconds(2);
+        while (Clock::now() < end) {
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.pending.empty()) {
+                    break;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        TEST_ASSERT_EQUAL_UINT32(busy, dispatcher.get_dropped());
+        TEST_ASSERT_EQUAL_UINT32(queue.rejected.load(), dispatcher.get_rejected());
+
+        uint32_t timeouts = 0U;
+        uint32_t answered = 0U;
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        for (uint32_t id = 1U; id <= REQUESTS; id++) {
+            // Every request is answered exactly once, either with its result or with the timeout error, never with the result of another request
+            const std::vector<std::string>& responses = sent.responses[id];
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(1U, responses.size(), std::to_string(id).c_str());
+            const std::map<uint32_t, bool>::const_iterator result = queue.accepted_ids.find(id);
+            const bool accepted = result != queue.accepted_ids.end() && result->second;
+            if (accepted) {
+                TEST_ASSERT_EQUAL_STRING(result_json(static_cast<int>(id) * 2).c_str(), responses[0U].c_str());
+                answered++;
+            }
+            else {
+                TEST_ASSERT_EQUAL_STRING(TIMEOUT_RESPONSE, responses[0U].c_str());
+                timeouts++;
+            }
+            if (id % 7U == 0U || id % 10U == 0U) {
+                TEST_ASSERT_FALSE_MESSAGE(accepted, std::to_string(id).c_str());
+            }
+        }
+        TEST_ASSERT_EQUAL_UINT32(timeouts, dispatcher.get_timeouts());
+        TEST_ASSERT_EQUAL_UINT32(answered, queue.accepted.load());
+        char message[128];
+        snprintf(message, sizeof(message), "%u requests: %u answered, %u timed out, %u late responses rejected, %u submits retried",
+          static_cast<unsigned>(REQUESTS), static_cast<unsigned>(answered), static_cast<unsigned>(timeouts), static_cast<unsigned>(queue.rejected.load()), static_cast<unsigned>(busy));
+        TEST_MESSAGE(message);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, wait_for_tasks(0U));
+}
+
+// Responses racing the watchdog of their request: whichever wins, respond() has to report it correctly and exactly one response is sent
+void test_expire_races_respond(void) {
+    constexpr uint32_t REQUESTS = 200U;
+    Pending_Queue queue;
+    const RPC_Async_Callback callback("race", [&queue](const RPC_Token& token, RPC_Data& params) {
+        const int value = params["v"].as<int>();
+        // Due around the 20 ms timeout, which has a resolution of 10 ms
+        queue.add(token, value, std::chrono::milliseconds(10 + value % 21));
+    }, 20000U);
+
+    Sent_Responses sent;
+    {
+        Dispatcher dispatcher(16U, 128U);
+        Responders responders(dispatcher, queue, 4U);
+        for (uint32_t id = 1U; id <= REQUESTS; id++) {
+            while (!submit_value(dispatcher, callback, id, static_cast<int>(id))) {
+                sent.process(dispatcher);
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+            sent.process(dispatcher);
+        }
+        sent.drain(dispatcher, std::chrono::seconds(5));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        sent.process(dispatcher);
+
+        uint32_t answered = 0U;
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        TEST_ASSERT_TRUE(queue.pending.empty());
+        for (uint32_t id = 1U; id <= REQUESTS; id++) {
+            const std::vector<std::string>& responses = sent.responses[id];
+            TEST_ASSERT_EQUAL_UINT32(1U, responses.size());
+            const bool accepted = queue.accepted_ids[id];
+            TEST_ASSERT_EQUAL_STRING(accepted ? result_json(static_cast<int>(id) * 2).c_str() : TIMEOUT_RESPONSE, responses[0U].c_str());
+            answered += accepted ? 1U : 0U;
+        }
+        // Both outcomes have to occur, otherwise the race was not exercised
+        TEST_ASSERT_TRUE(answered > 0U && answered < REQUESTS);
+        TEST_ASSERT_EQUAL_UINT32(REQUESTS - answered, dispatcher.get_timeouts());
+    }
+}
+
+// Tokens of earlier requests are rejected once their slot has been reused, because the sequence of the slot changed
+void test_stale_token_after_slot_reuse(void) {
+    std::vector<RPC_Token> tokens;
+    std::mutex mutex;
+    const RPC_Async_Callback callback("reuse", [&tokens, &mutex](const RPC_Token& token, RPC_Data& params) {
+        (void)params;
+        std::lock_guard<std::mutex> lock(mutex);
+        tokens.push_back(token);
+    }, 1000000U);
+    const auto wait_for_tokens = [&tokens, &mutex](const size_t& count) {
+        for (uint32_t i = 0U; i < 1000U; i++) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (tokens.size() >= count) {
+                    return;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+
+    Sent_Responses sent;
+    Dispatcher dispatcher(1U, 128U);
+    TEST_ASSERT_TRUE(submit_value(dispatcher, callback, 10U, 1));
+    // Single slot is in use until the response has been sent
+    TEST_ASSERT_FALSE(submit_value(dispatcher, callback, 11U, 2));
+    wait_for_tokens(1U);
+    TEST_ASSERT_TRUE(dispatcher.respond(tokens[0U], RPC_Response("first", 1)));
+    TEST_ASSERT_FALSE(dispatcher.respond(tokens[0U], RPC_Response("again", 1)));
+    TEST_ASSERT_EQUAL_UINT32(1U, sent.process(dispatcher));
+
+    TEST_ASSERT_TRUE(submit_value(dispatcher, callback, 12U, 3));
+    wait_for_tokens(2U);
+    TEST_ASSERT_EQUAL_UINT16(tokens[0U].slot, tokens[1U].slot);
+    TEST_ASSERT_FALSE(dispatcher.respond(tokens[0U], RPC_Response("stale", 1)));
+    // Empty response releases the request without sending anything
+    TEST_ASSERT_TRUE(dispatcher.respond(tokens[1U], RPC_Response()));
+    TEST_ASSERT_EQUAL_UINT32(0U, sent.process(dispatcher));
+    TEST_ASSERT_EQUAL_UINT32(0U, dispatcher.get_pending());
+    TEST_ASSERT_EQUAL_STRING("{\"first\":1}", sent.responses[10U][0U].c_str());
+    TEST_ASSERT_TRUE(sent.responses[12U].empty());
+    TEST_ASSERT_EQUAL_UINT32(1U, dispatcher.get_dropped());
+    TEST_ASSERT_EQUAL_UINT32(2U, dispatcher.get_rejected());
+}
+
+// Stopping while requests are queued on the worker task and responses are given concurrently, pending requests are discarded without a response.
+// After the dispatcher started again, tokens of the discarded requests stay invalid even though their slots are reused
+void test_stop_with_pending_requests(void) {
+    Pending_Queue queue;
+    const RPC_Async_Callback callback("stop", [&queue](const RPC_Token& token, RPC_Data& params) {
+        const int value = params["v"].as<int>();
+        queue.add(token, value, std::chrono::milliseconds(value * 2));
+        // Keeps the worker task busy, so requests are still queued once stop() is called
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }, 1000000U);
+    Sent_Responses sent;
+    {
+        Dispatcher dispatcher(4U, 128U);
+        {
+            Responders responders(dispatcher, queue, 2U);
+            for (uint32_t id = 1U; id <= 4U; id++) {
+                TEST_ASSERT_TRUE(submit_value(dispatcher, callback, id, static_cast<int>(id)));
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            dispatcher.stop();
+            TEST_ASSERT_EQUAL_UINT32(0U, dispatcher.get_pending());
+            TEST_ASSERT_EQUAL_UINT32(0U, wait_for_tasks(0U));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        TEST_ASSERT_EQUAL_UINT32(0U, sent.process(dispatcher));
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            TEST_ASSERT_TRUE(queue.pending.empty());
+        }
+
+        // Dispatcher starts again on the next request, the callbacks keep their tokens until the test answers them
+        const RPC_Async_Callback keep("keep", [&queue](const RPC_Token& token, RPC_Data& params) {
+            queue.add(token, params["v"].as<int>(), std::chrono::hours(1));
+        }, 1000000U);
+        for (uint32_t id = 5U; id <= 8U; id++) {
+            TEST_ASSERT_TRUE(submit_value(dispatcher, keep, id, static_cast<int>(id)));
+        }
+        TEST_ASSERT_EQUAL_UINT32(1U, wait_for_tasks(1U));
+        std::vector<Pending> current;
+        for (uint32_t i = 0U; i < 1000U && current.size() < 4U; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            current = queue.pending;
+        }
+        TEST_ASSERT_EQUAL_UINT32(4U, current.size());
+        for (uint16_t slot = 0U; slot < 4U; slot++) {
+            // Discarded requests used the first sequence of each slot
+            RPC_Token stale;
+            stale.request_id = 1U + slot;
+            stale.slot = slot;
+            stale.sequence = 1U;
+            TEST_ASSERT_FALSE(dispatcher.respond(stale, RPC_Response("stale", 1)));
+        }
+        for (const Pending& pending : current) {
+            TEST_ASSERT_TRUE(pending.token.sequence > 1U);
+            TEST_ASSERT_TRUE(dispatcher.respond(pending.token, RPC_Response("result", pending.value * 2)));
+        }
+        sent.drain(dispatcher, std::chrono::seconds(1));
+        for (uint32_t id = 1U; id <= 4U; id++) {
+            TEST_ASSERT_TRUE(sent.responses[id].empty());
+        }
+        for (uint32_t id = 5U; id <= 8U; id++) {
+            TEST_ASSERT_EQUAL_UINT32(1U, sent.responses[id].size());
+            TEST_ASSERT_EQUAL_STRING(result_json(static_cast<int>(id) * 2).c_str(), sent.responses[id][0U].c_str());
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, wait_for_tasks(0U));
+}
+
+// Requests received over MQTT are answered through ThingsBoard::loop(), while a synchronous RPC is answered at once even though the worker task is blocked
+void test_thingsboard_integration(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    client.set_buffer_size(512U);
+    {
+        ThingsBoard tb(client);
+        Pending_Queue queue;
+        std::atomic<bool> release(false);
+        const RPC_Async_Callback slow("slow", [&queue](const RPC_Token& token, RPC_Data& params) {
+            queue.add(token, params["v"].as<int>(), std::chrono::milliseconds(params["v"].as<int>() % 20));
+        }, 2000000U);
+        const RPC_Async_Callback blocking("block", [&tb, &release](const RPC_Token& token, RPC_Data& params) {
+            (void)params;
+            while (!release) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            tb.RPC_Async_Respond(token, RPC_Response("done", true));
+        }, 2000000U);
+        const RPC_Callback ping("ping", [](const RPC_Data& params) {
+            (void)params;
+            return RPC_Response("pong", 1);
+        });
+        TEST_ASSERT_TRUE(tb.RPC_Async_Subscribe(slow));
+        TEST_ASSERT_TRUE(tb.RPC_Async_Subscribe(blocking));
+        TEST_ASSERT_TRUE(tb.RPC_Subscribe(ping));
+
+        client.deliver_now("v1/devices/me/rpc/request/1", "{\"method\":\"block\",\"params\":{}}");
+        client.deliver_now("v1/devices/me/rpc/request/2", "{\"method\":\"ping\",\"params\":{}}");
+        std::vector<Loopback_MQTT_Client::Message> responses = client.published("v1/devices/me/rpc/response/");
+        TEST_ASSERT_EQUAL_UINT32(1U, responses.size());
+        TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/2", responses[0U].topic.c_str());
+        TEST_ASSERT_EQUAL_STRING("{\"pong\":1}", responses[0U].payload.c_str());
+        release = true;
+
+        std::vector<std::thread> responders;
+        std::atomic<bool> running(true);
+        for (uint32_t i = 0U; i < 2U; i++) {
+            responders.emplace_back([&queue, &tb, &running, i]() {
+                std::mt19937 random(i + 7U);
+                while (running) {
+                    Pending taken;
+                    if (!queue.take_due(random, taken)) {
+                        std::this_thread::sleep_for(std::chrono::microseconds(200));
+                        continue;
+                    }
+                    queue.record(taken.token.request_id, tb.RPC_Async_Respond(taken.token, RPC_Response("result", taken.value * 2)));
+                }
+            });
+        }
+        // Requests are received in batches of four, the amount of slots of the default dispatcher, and answered before the next batch
+        const auto wait_for_responses = [&client, &tb](const size_t& count) {
+            const Clock::time_point end = Clock::now() + std::chrono::seconds(3);
+            while (client.published("v1/devices/me/rpc/response/").size() < count && Clock::now() < end) {
+                tb.loop();
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        };
+        wait_for_responses(2U);
+        for (uint32_t id = 3U; id < 23U; id++) {
+            char topic[64];
+            snprintf(topic, sizeof(topic), "v1/devices/me/rpc/request/%u", static_cast<unsigned>(id));
+            char payload[64];
+            snprintf(payload, sizeof(payload), "{\"method\":\"slow\",\"params\":{\"v\":%u}}", static_cast<unsigned>(id));
+            client.deliver_now(topic, payload);
+            if ((id - 2U) % 4U == 0U) {
+                wait_for_responses(id);
+            }
+        }
+        wait_for_responses(22U);
+        running = false;
+        for (std::thread& thread : responders) {
+            thread.join();
+        }
+
+        std::map<std::string, std::string> by_topic;
+        for (const Loopback_MQTT_Client::Message& message : client.published("v1/devices/me/rpc/response/")) {
+            TEST_ASSERT_TRUE_MESSAGE(by_topic.emplace(message.topic, message.payload).second, message.topic.c_str());
+        }
+        TEST_ASSERT_EQUAL_STRING("{\"done\":true}", by_topic["v1/devices/me/rpc/response/1"].c_str());
+        for (uint32_t id = 3U; id < 23U; id++) {
+            TEST_ASSERT_EQUAL_STRING(result_json(static_cast<int>(id) * 2).c_str(), by_topic["v1/devices/me/rpc/response/" + std::to_string(id)].c_str());
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, wait_for_tasks(0U));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_flood_out_of_order_and_expiry);
+    RUN_TEST(test_expire_races_respond);
+    RUN_TEST(test_stale_token_after_slot_reuse);
+    RUN_TEST(test_stop_with_pending_requests);
+    RUN_TEST(test_thingsboard_integration);
+    return UNITY_END();
+}
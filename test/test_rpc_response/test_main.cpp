@@ -0,0 +1,218 @@
+// RPC request to response path of ThingsBoard without heap allocations: operator new is counted around every request, the MQTT client
+// copies the published response into fixed buffers. Also measures the round trip through the loopback broker
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <Loopback_MQTT_Client.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <iterator>
+#include <new>
+
+namespace {
+
+size_t allocations = 0U;
+
+/// @brief Keeps the last published message in fixed buffers, so the client itself does not allocate
+class Fixed_MQTT_Client : public IMQTT_Client {
+  public:
+    char topic[64] = {};
+    char payload[128] = {};
+    size_t published = 0U;
+    function callback;
+
+    void set_callback(function callback) override { this->callback = callback; }
+    bool set_buffer_size(const uint16_t& buffer_size) override { return true; }
+    uint16_t get_buffer_size() override { return 256U; }
+    void set_server(const char *domain, const uint16_t& port) override {}
+    bool connect(const char *client_id, const char *user_name, const char *password) override { return true; }
+    void disconnect() override {}
+    bool loop() override { return true; }
+
+    bool publish(const char *topic, const uint8_t *payload, const size_t& length) override {
+        published++;
+        snprintf(this->topic, sizeof(this->topic), "%s", topic);
+        snprintf(this->payload, sizeof(this->payload), "%.*s", static_cast<int>(length), reinterpret_cast<const char*>(payload));
+        return true;
+    }
+
+    bool subscribe(const char *topic) override { return true; }
+    bool unsubscribe(const char *topic) override { return true; }
+    bool connected() override { return true; }
+
+    /// @brief Delivers a request like PubSubClient, the topic and payload are modified in place by the zero copy deserialization
+    void request(const char *topic, const char *payload) {
+        char topic_buffer[64];
+        char payload_buffer[128];
+        snprintf(topic_buffer, sizeof(topic_buffer), "%s", topic);
+        const size_t length = snprintf(payload_buffer, sizeof(payload_buffer), "%s", payload);
+        callback(topic_buffer, reinterpret_cast<uint8_t*>(payload_buffer), length);
+    }
+};
+
+StaticJsonDocument<64> document_response;
+
+const RPC_Callback CALLBACKS[] = {
+    RPC_Callback("getValue", [](const RPC_Data& data) {
+        return RPC_Response("value", data.as<int>());
+    }),
+    RPC_Callback("getDocument", [](const RPC_Data& data) {
+        (void)data;
+        return RPC_Response(document_response.as<JsonVariant>());
+    }),
+    RPC_Callback("getNothing", [](const RPC_Data& data) {
+        (void)data;
+        return RPC_Response();
+    })
+};
+
+} // namespace
+
+void* operator new(size_t size) {
+    allocations++;
+    void *memory = malloc(size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void *memory, size_t size) noexcept {
+    free(memory);
+}
+
+void operator delete[](void *memory, size_t size) noexcept {
+    free(memory);
+}
+
+void setUp(void) {
+    document_response.clear();
+    document_response["value"] = 42;
+}
+
+void tearDown(void) {}
+
+// Key-value and document responses are sent on the response topic with the request id, empty responses are not sent
+void test_responses(void) {
+    Fixed_MQTT_Client client;
+    ThingsBoardSized<8U> tb(client);
+    TEST_ASSERT_TRUE(tb.RPC_Subscribe(std::begin(CALLBACKS), std::end(CALLBACKS)));
+
+    client.request("v1/devices/me/rpc/request/17", "{\"method\":\"getValue\",\"params\":7}");
+    TEST_ASSERT_EQUAL_UINT32(1U, client.published);
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/17", client.topic);
+    TEST_ASSERT_EQUAL_STRING("{\"value\":7}", client.payload);
+
+    client.request("v1/devices/me/rpc/request/0", "{\"method\":\"getDocument\",\"params\":{}}");
+    TEST_ASSERT_EQUAL_UINT32(2U, client.published);
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/0", client.topic);
+    TEST_ASSERT_EQUAL_STRING("{\"value\":42}", client.payload);
+
+    client.request("v1/devices/me/rpc/request/4294967294", "{\"method\":\"getValue\",\"params\":-1}");
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/4294967294", client.topic);
+    TEST_ASSERT_EQUAL_STRING("{\"value\":-1}", client.payload);
+
+    client.request("v1/devices/me/rpc/request/18", "{\"method\":\"getNothing\",\"params\":{}}");
+    client.request("v1/devices/me/rpc/request/19", "{\"method\":\"unknown\",\"params\":{}}");
+    client.request("v1/devices/me/rpc/request/20", "{\"params\":{}}");
+    TEST_ASSERT_EQUAL_UINT32(3U, client.published);
+}
+
+// A request id that is not a number or does not fit into 32 bits is not answered, instead of answering a different request
+void test_invalid_request_id(void) {
+    Fixed_MQTT_Client client;
+    ThingsBoardSized<8U> tb(client);
+    TEST_ASSERT_TRUE(tb.RPC_Subscribe(std::begin(CALLBACKS), std::end(CALLBACKS)));
+    client.request("v1/devices/me/rpc/request/12a", "{\"method\":\"getValue\",\"params\":1}");
+    client.request("v1/devices/me/rpc/request/4294967296", "{\"method\":\"getValue\",\"params\":1}");
+    client.request("v1/devices/me/rpc/request/", "{\"method\":\"getValue\",\"params\":1}");
+    TEST_ASSERT_EQUAL_UINT32(0U, client.published);
+}
+
+// The topic is formatted without printf into a buffer of TOPIC_ID_SIZE, a smaller buffer is rejected instead of truncating the id
+void test_format_topic(void) {
+    char topic[TOPIC_ID_SIZE(sizeof(RPC_RESPONSE_TOPIC) - 1U)];
+    TEST_ASSERT_EQUAL_UINT32(sizeof(RPC_RESPONSE_TOPIC) + 10U, Helper::formatTopic(topic, sizeof(topic), RPC_RESPONSE_TOPIC, UINT32_MAX));
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/4294967295", topic);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(RPC_RESPONSE_TOPIC) + 1U, Helper::formatTopic(topic, sizeof(topic), RPC_RESPONSE_TOPIC, 0U));
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/0", topic);
+    TEST_ASSERT_EQUAL_UINT32(0U, Helper::formatTopic(topic, sizeof(RPC_RESPONSE_TOPIC) + 1U, RPC_RESPONSE_TOPIC, 10U));
+    TEST_ASSERT_EQUAL_UINT32(0U, Helper::formatTopic(nullptr, sizeof(topic), RPC_RESPONSE_TOPIC, 1U));
+}
+
+// Answering a request allocates nothing on the heap, neither for key-value nor for document responses
+void test_no_allocations(void) {
+    Fixed_MQTT_Client client;
+    ThingsBoardSized<8U> tb(client);
+    TEST_ASSERT_TRUE(tb.RPC_Subscribe(std::begin(CALLBACKS), std::end(CALLBACKS)));
+
+    constexpr uint32_t REQUESTS = 100000U;
+    const char *const methods[] = { "{\"method\":\"getValue\",\"params\":7}", "{\"method\":\"getDocument\",\"params\":7}" };
+    for (const char *request : methods) {
+        client.published = 0U;
+        const size_t before = allocations;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < REQUESTS; i++) {
+            client.request("v1/devices/me/rpc/request/12345", request);
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        const size_t allocated = allocations - before;
+        TEST_ASSERT_EQUAL_UINT32(REQUESTS, client.published);
+
+        char message[128];
+        snprintf(message, sizeof(message), "%s: %.0f ns per request, %u heap allocations", request,
+                 std::chrono::duration<double, std::nano>(end - start).count() / REQUESTS, static_cast<unsigned>(allocated));
+        TEST_MESSAGE(message);
+        TEST_ASSERT_EQUAL_UINT32(0U, allocated);
+    }
+}
+
+// Requests injected into the loopback broker are answered from ThingsBoard::loop(), measured from injecting to the published response
+void test_loopback_round_trip(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    client.set_buffer_size(256U);
+    ThingsBoardSized<8U> tb(client);
+    TEST_ASSERT_TRUE(tb.RPC_Subscribe(std::begin(CALLBACKS), std::end(CALLBACKS)));
+
+    constexpr uint32_t REQUESTS = 20000U;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < REQUESTS; i++) {
+        const std::string topic = "v1/devices/me/rpc/request/" + std::to_string(i);
+        client.inject(topic.c_str(), "{\"method\":\"getValue\",\"params\":" + std::to_string(i) + "}");
+        TEST_ASSERT_TRUE(tb.loop());
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    const std::vector<Loopback_MQTT_Client::Message> responses = client.published("v1/devices/me/rpc/response/");
+    TEST_ASSERT_EQUAL_UINT32(REQUESTS, responses.size());
+    TEST_ASSERT_EQUAL_STRING("v1/devices/me/rpc/response/19999", responses.back().topic.c_str());
+    TEST_ASSERT_EQUAL_STRING("{\"value\":19999}", responses.back().payload.c_str());
+
+    char message[96];
+    snprintf(message, sizeof(message), "loopback round trip: %.0f ns per request",
+             std::chrono::duration<double, std::nano>(end - start).count() / REQUESTS);
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_responses);
+    RUN_TEST(test_invalid_request_id);
+    RUN_TEST(test_format_topic);
+    RUN_TEST(test_no_allocations);
+    RUN_TEST(test_loopback_round_trip);
+    return UNITY_END();
+}
@@ -0,0 +1,239 @@
+// Shared attribute updates dispatched through Shared_Attribute_Index with 50 subscriptions: the same callbacks have to be called
+// in the same order as by the linear containsKey loop it replaced, plus a microbenchmark of both
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <Loopback_MQTT_Client.h>
+#include <stdio.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t SUBSCRIPTIONS = 50U;
+constexpr char ATTRIBUTES_TOPIC[] = "v1/devices/me/attributes";
+
+using Thingsboard = ThingsBoardSized<64U>;
+
+std::vector<size_t> calls;
+std::vector<std::string> keys;
+std::vector<Shared_Attribute_Callback> callbacks;
+
+Shared_Attribute_Callback::function record(const size_t& position) {
+    return [position](const Shared_Attribute_Data& data) {
+        (void)data;
+        calls.push_back(position);
+    };
+}
+
+std::string key(const size_t& number) {
+    char buffer[16];
+    snprintf(buffer, sizeof(buffer), "attr%03u", static_cast<unsigned>(number));
+    return buffer;
+}
+
+/// @brief Subscription i is interested in the keys 2i, 2i + 1 and 2i + 2, so neighbours share a key, the last one has no keys and gets every update
+void subscribe_all(Thingsboard& tb) {
+    keys.clear();
+    callbacks.clear();
+    for (size_t i = 0U; i <= 2U * SUBSCRIPTIONS; i++) {
+        keys.push_back(key(i));
+    }
+    for (size_t i = 0U; i < SUBSCRIPTIONS; i++) {
+        const std::vector<const char *> subscribed = { keys[2U * i].c_str(), keys[2U * i + 1U].c_str(), keys[2U * i + 2U].c_str() };
+        callbacks.push_back(Shared_Attribute_Callback(record(i), subscribed.cbegin(), subscribed.cend()));
+    }
+    callbacks.push_back(Shared_Attribute_Callback(record(SUBSCRIPTIONS)));
+    for (const Shared_Attribute_Callback& callback : callbacks) {
+        TEST_ASSERT_TRUE(tb.Shared_Attributes_Subscribe(callback));
+    }
+}
+
+/// @brief The dispatch before the index: every subscribed key of every callback is checked against the payload
+void linear_dispatch(const JsonObjectConst& data) {
+    for (const Shared_Attribute_Callback& callback : callbacks) {
+        bool contains_key = callback.Get_Attributes().empty();
+        for (const char *att : callback.Get_Attributes()) {
+            if (att != nullptr && data.containsKey(att)) {
+                contains_key = true;
+                break;
+            }
+        }
+        if (contains_key) {
+            callback.Call_Callback<ThingsBoardDefaultLogger>(data);
+        }
+    }
+}
+
+std::vector<size_t> expected_calls(const std::string& payload) {
+    StaticJsonDocument<1024> document;
+    TEST_ASSERT_TRUE(deserializeJson(document, payload) == DeserializationError::Ok);
+    JsonObjectConst data = document.as<JsonObjectConst>();
+    if (data.containsKey("shared")) {
+        data = data["shared"];
+    }
+    calls.clear();
+    linear_dispatch(data);
+    return calls;
+}
+
+std::vector<size_t> received_calls(Loopback_MQTT_Client& client, const std::string& payload) {
+    calls.clear();
+    client.deliver_now(ATTRIBUTES_TOPIC, payload);
+    return calls;
+}
+
+} // namespace
+
+void setUp(void) {
+    calls.clear();
+}
+
+void tearDown(void) {}
+
+// Random updates with up to 6 keys, some of them unknown and some wrapped into "shared" like the response to an attribute request
+void test_matches_linear_dispatch(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    Thingsboard tb(client, 1024U);
+    subscribe_all(tb);
+
+    std::mt19937 random(1U);
+    for (uint32_t update = 0U; update < 500U; update++) {
+        std::string payload = "{";
+        const uint32_t amount = 1U + random() % 6U;
+        for (uint32_t i = 0U; i < amount; i++) {
+            payload += (i == 0U ? "\"" : ",\"") + key(random() % (2U * SUBSCRIPTIONS + 30U)) + "\":" + std::to_string(i);
+        }
+        payload += "}";
+        if (update % 7U == 0U) {
+            payload = "{\"shared\":" + payload + "}";
+        }
+        const std::vector<size_t> expected = expected_calls(payload);
+        const std::vector<size_t> received = received_calls(client, payload);
+        TEST_ASSERT_EQUAL_UINT32(expected.size(), received.size());
+        TEST_ASSERT_TRUE_MESSAGE(expected == received, payload.c_str());
+    }
+}
+
+// A callback subscribed to several received keys, or to the same key twice, is still called only once
+void test_called_once_per_update(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    Thingsboard tb(client, 1024U);
+    const std::vector<const char *> twice = { "fan", "fan", "led" };
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Subscribe(Shared_Attribute_Callback(record(0U), twice.cbegin(), twice.cend())));
+    const std::vector<const char *> other = { "led" };
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Subscribe(Shared_Attribute_Callback(record(1U), other.cbegin(), other.cend())));
+
+    const std::vector<size_t> both = { 0U, 1U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"fan\":1,\"led\":0}") == both);
+    const std::vector<size_t> first = { 0U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"fan\":1}") == first);
+    TEST_ASSERT_TRUE(received_calls(client, "{}").empty());
+}
+
+// Keys that are a prefix of each other or only differ in case are different keys
+void test_exact_keys(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    Thingsboard tb(client, 1024U);
+    const char *const subscribed[] = { "led", "led1", "LED", "" };
+    for (size_t i = 0U; i < 4U; i++) {
+        const std::vector<const char *> single = { subscribed[i] };
+        TEST_ASSERT_TRUE(tb.Shared_Attributes_Subscribe(Shared_Attribute_Callback(record(i), single.cbegin(), single.cend())));
+    }
+
+    const std::vector<size_t> led = { 0U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"led\":1}") == led);
+    const std::vector<size_t> led1 = { 1U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"led1\":1}") == led1);
+    const std::vector<size_t> upper = { 2U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"LED\":1}") == upper);
+    const std::vector<size_t> empty = { 3U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"\":1}") == empty);
+    TEST_ASSERT_TRUE(received_calls(client, "{\"le\":1,\"led10\":1}").empty());
+}
+
+// Unsubscribing clears the index, callbacks subscribed afterwards get their own positions
+void test_unsubscribe_clears_index(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    Thingsboard tb(client, 1024U);
+    subscribe_all(tb);
+    TEST_ASSERT_EQUAL_UINT32(2U, received_calls(client, "{\"attr000\":1}").size());
+
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Unsubscribe());
+    TEST_ASSERT_TRUE(received_calls(client, "{\"attr000\":1}").empty());
+
+    const std::vector<const char *> subscribed = { "attr000" };
+    TEST_ASSERT_TRUE(tb.Shared_Attributes_Subscribe(Shared_Attribute_Callback(record(7U), subscribed.cbegin(), subscribed.cend())));
+    const std::vector<size_t> only = { 7U };
+    TEST_ASSERT_TRUE(received_calls(client, "{\"attr000\":1,\"attr002\":1}") == only);
+}
+
+// Dispatch of an already deserialized update to 50 subscriptions with 150 keys, for 1, 4 and 8 keys in the update
+void test_benchmark(void) {
+    Loopback_MQTT_Client client;
+    TEST_ASSERT_TRUE(client.connect("device", "token", nullptr));
+    Thingsboard tb(client, 1024U);
+    subscribe_all(tb);
+    Shared_Attribute_Index index;
+    for (const Shared_Attribute_Callback& callback : callbacks) {
+        index.add(callback);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3U * SUBSCRIPTIONS, index.size());
+
+    constexpr uint32_t ROUNDS = 100000U;
+    for (const uint32_t amount : { 1U, 4U, 8U }) {
+        std::string payload = "{";
+        for (uint32_t i = 0U; i < amount; i++) {
+            payload += (i == 0U ? "\"" : ",\"") + key(97U - 11U * i) + "\":1";
+        }
+        payload += "}";
+        StaticJsonDocument<1024> document;
+        TEST_ASSERT_TRUE(deserializeJson(document, payload) == DeserializationError::Ok);
+        const JsonObjectConst data = document.as<JsonObjectConst>();
+
+        size_t linear_calls = 0U;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t round = 0U; round < ROUNDS; round++) {
+            calls.clear();
+            linear_dispatch(data);
+            linear_calls += calls.size();
+        }
+        const std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+        size_t indexed_calls = 0U;
+        for (uint32_t round = 0U; round < ROUNDS; round++) {
+            calls.clear();
+            index.match(data);
+            for (size_t i = 0U; i < callbacks.size(); i++) {
+                if (callbacks[i].Get_Attributes().empty() || index.matched_key(i) != nullptr) {
+                    callbacks[i].Call_Callback<ThingsBoardDefaultLogger>(data);
+                }
+            }
+            indexed_calls += calls.size();
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        TEST_ASSERT_EQUAL_UINT32(linear_calls, indexed_calls);
+
+        const double linear_ns = std::chrono::duration<double, std::nano>(middle - start).count() / ROUNDS;
+        const double indexed_ns = std::chrono::duration<double, std::nano>(end - middle).count() / ROUNDS;
+        char message[128];
+        snprintf(message, sizeof(message), "%u keys in the update: linear %.0f ns, indexed %.0f ns per update",
+                 amount, linear_ns, indexed_ns);
+        TEST_MESSAGE(message);
+        TEST_ASSERT_TRUE(indexed_ns < linear_ns);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_matches_linear_dispatch);
+    RUN_TEST(test_called_once_per_update);
+    RUN_TEST(test_exact_keys);
+    RUN_TEST(test_unsubscribe_clears_index);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,197 @@
+// Messages bigger than the buffer of the MQTT client are streamed into it with THINGSBOARD_ENABLE_STREAM_UTILS, which is set for this suite
+// by the native_stream_utils env. The length announced to begin_publish() has to equal the bytes written afterwards, otherwise the client
+// sends a packet whose header does not match its payload
+#include <unity.h>
+#include <ThingsBoard.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#if !THINGSBOARD_ENABLE_STREAM_UTILS
+#error "test_streamed_publish has to be run with the native_stream_utils env"
+#endif // !THINGSBOARD_ENABLE_STREAM_UTILS
+
+namespace {
+
+constexpr uint16_t BUFFER_SIZE = 64U;
+constexpr size_t BUFFERING_SIZE = 16U;
+constexpr char TELEMETRY_TOPIC_NAME[] = "v1/devices/me/telemetry";
+
+/// @brief Records the streamed messages and every message published at once, without any broker behind it
+class Recording_MQTT_Client : public IMQTT_Client {
+  public:
+    /// @brief Single message, either streamed or published at once
+    struct Message {
+        std::string topic;
+        size_t announced;
+        std::string payload;
+        bool ended;
+    };
+
+    std::vector<Message> streamed;
+    std::vector<Message> published;
+    bool begin_fails = false;
+
+    void set_callback(function callback) override { (void)callback; }
+    bool set_buffer_size(const uint16_t& buffer_size) override { return buffer_size == BUFFER_SIZE; }
+    uint16_t get_buffer_size() override { return BUFFER_SIZE; }
+    void set_server(const char *domain, const uint16_t& port) override {}
+    bool connect(const char *client_id, const char *user_name, const char *password) override { return true; }
+    void disconnect() override {}
+    bool loop() override { return true; }
+
+    bool publish(const char *topic, const uint8_t *payload, const size_t& length) override {
+        published.push_back(Message{ topic, length, std::string(reinterpret_cast<const char*>(payload), length), true });
+        return true;
+    }
+
+    bool subscribe(const char *topic) override { return true; }
+    bool unsubscribe(const char *topic) override { return true; }
+    bool connected() override { return true; }
+
+    bool begin_publish(const char *topic, const size_t& length) override {
+        if (begin_fails) {
+            return false;
+        }
+        streamed.push_back(Message{ topic, length, std::string(), false });
+        return true;
+    }
+
+    bool end_publish() override {
+        TEST_ASSERT_FALSE(streamed.empty());
+        streamed.back().ended = true;
+        return streamed.back().payload.size() == streamed.back().announced;
+    }
+
+    size_t write(uint8_t payload_byte) override {
+        TEST_ASSERT_FALSE(streamed.empty());
+        streamed.back().payload.push_back(static_cast<char>(payload_byte));
+        return 1U;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        TEST_ASSERT_FALSE(streamed.empty());
+        streamed.back().payload.append(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+};
+
+using Thingsboard = ThingsBoardSized<32U>;
+
+/// @brief Keys of the telemetry records, have to stay valid until the message has been sent
+std::vector<std::string> keys;
+
+/// @brief Telemetry with the given amount of key-value pairs of every type
+std::vector<Telemetry> telemetry(const size_t& amount) {
+    keys.clear();
+    for (size_t i = 0U; i < amount; i++) {
+        keys.push_back("key\"" + std::to_string(i));
+    }
+    std::vector<Telemetry> data;
+    for (size_t i = 0U; i < amount; i++) {
+        switch (i % 3U) {
+            case 0U:
+                data.push_back(Telemetry(keys[i].c_str(), static_cast<int>(i) * -1000));
+                break;
+            case 1U:
+                data.push_back(Telemetry(keys[i].c_str(), 0.25 * i));
+                break;
+            default:
+                data.push_back(Telemetry(keys[i].c_str(), "value\\"));
+                break;
+        }
+    }
+    return data;
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// Serialize_Json() announces the length without the null terminator that is part of the measured size, and writes exactly that many bytes
+void test_announced_length_matches_json(void) {
+    for (size_t amount = 1U; amount <= 32U; amount++) {
+        Recording_MQTT_Client client;
+        Thingsboard tb(client, BUFFER_SIZE, Default_Max_Stack_Size, BUFFERING_SIZE);
+        const std::vector<Telemetry> data = telemetry(amount);
+        TEST_ASSERT_TRUE(tb.sendTelemetry(data.data(), data.size()));
+
+        StaticJsonDocument<JSON_OBJECT_SIZE(32U)> expected;
+        const JsonVariant object = expected.to<JsonVariant>();
+        for (const Telemetry& record : data) {
+            TEST_ASSERT_TRUE(record.SerializeKeyValue(object));
+        }
+        std::string json;
+        serializeJson(expected, json);
+
+        if (json.size() + 1U <= BUFFER_SIZE) {
+            TEST_ASSERT_EQUAL_UINT32(0U, client.streamed.size());
+            TEST_ASSERT_EQUAL_UINT32(1U, client.published.size());
+            TEST_ASSERT_EQUAL_STRING(json.c_str(), client.published.front().payload.c_str());
+            continue;
+        }
+        TEST_ASSERT_EQUAL_UINT32(0U, client.published.size());
+        TEST_ASSERT_EQUAL_UINT32(1U, client.streamed.size());
+        const Recording_MQTT_Client::Message& message = client.streamed.front();
+        TEST_ASSERT_EQUAL_STRING(TELEMETRY_TOPIC_NAME, message.topic.c_str());
+        TEST_ASSERT_EQUAL_UINT32(json.size(), message.announced);
+        TEST_ASSERT_EQUAL_UINT32(message.announced, message.payload.size());
+        TEST_ASSERT_EQUAL_STRING(json.c_str(), message.payload.c_str());
+        TEST_ASSERT_TRUE(message.ended);
+    }
+}
+
+// Thousands of samples are streamed as a single message without building the json in memory, with the measured length announced
+void test_samples_streamed(void) {
+    constexpr size_t SAMPLES = 4000U;
+    std::vector<Telemetry_Sample> samples;
+    for (size_t i = 0U; i < SAMPLES; i++) {
+        samples.push_back(Telemetry_Sample(1700000000000ULL + (i / 4U) * 1000U, i % 2U == 0U ? "temperature" : "hum\"idity", 20.5 + (i % 7U)));
+    }
+    const size_t size = Telemetry_Sample::MeasureSeries(samples.data(), samples.size());
+    std::vector<char> json(size + 1U);
+    TEST_ASSERT_EQUAL_UINT32(size, Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), json.data(), json.size()));
+
+    Recording_MQTT_Client client;
+    Thingsboard tb(client, BUFFER_SIZE, Default_Max_Stack_Size, BUFFERING_SIZE);
+    TEST_ASSERT_TRUE(tb.sendTelemetrySamples(samples.data(), samples.size()));
+    TEST_ASSERT_EQUAL_UINT32(0U, client.published.size());
+    TEST_ASSERT_EQUAL_UINT32(1U, client.streamed.size());
+    const Recording_MQTT_Client::Message& message = client.streamed.front();
+    TEST_ASSERT_EQUAL_STRING(TELEMETRY_TOPIC_NAME, message.topic.c_str());
+    TEST_ASSERT_EQUAL_UINT32(size, message.announced);
+    TEST_ASSERT_EQUAL_UINT32(size, message.payload.size());
+    TEST_ASSERT_EQUAL_STRING(json.data(), message.payload.c_str());
+    TEST_ASSERT_TRUE(message.ended);
+
+    // A batch that fits into the buffer is published at once
+    TEST_ASSERT_TRUE(tb.sendTelemetrySamples(samples.data(), 1U));
+    TEST_ASSERT_EQUAL_UINT32(1U, client.published.size());
+    TEST_ASSERT_EQUAL_STRING("[{\"ts\":1700000000000,\"values\":{\"temperature\":20.5}}]", client.published.front().payload.c_str());
+}
+
+// A client that can not start the streamed message fails the send, without writing anything
+void test_begin_publish_fails(void) {
+    Recording_MQTT_Client client;
+    client.begin_fails = true;
+    Thingsboard tb(client, BUFFER_SIZE, Default_Max_Stack_Size, BUFFERING_SIZE);
+    const std::vector<Telemetry> data = telemetry(16U);
+    TEST_ASSERT_FALSE(tb.sendTelemetry(data.data(), data.size()));
+    std::vector<Telemetry_Sample> samples;
+    for (size_t i = 0U; i < 64U; i++) {
+        samples.push_back(Telemetry_Sample(i, "temperature", 21));
+    }
+    TEST_ASSERT_FALSE(tb.sendTelemetrySamples(samples.data(), samples.size()));
+    TEST_ASSERT_EQUAL_UINT32(0U, client.streamed.size());
+    TEST_ASSERT_EQUAL_UINT32(0U, client.published.size());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_announced_length_matches_json);
+    RUN_TEST(test_samples_streamed);
+    RUN_TEST(test_begin_publish_fails);
+    return UNITY_END();
+}
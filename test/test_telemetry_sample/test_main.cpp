@@ -0,0 +1,193 @@
+// Telemetry_Sample serializes a batch of timestamped samples token by token into any destination: the measured size has to equal
+// what the buffered and the streamed writer produce, consecutive samples with the same timestamp share one entry, keys and strings are escaped
+// and a buffer that is too small is filled with a null terminated prefix instead of being overrun
+#include <unity.h>
+#include <Telemetry_Sample.h>
+#include <StreamUtils.h>
+#include <Print.h>
+#include <stdio.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t BATCHES = 2000U;
+
+const char *const KEYS[] = { "temperature", "humidity", "co2", "quote\"key", "back\\slash", "line\nbreak", "tab\tkey", "\xC3\xA4umlaut" };
+const char *const STRINGS[] = { "ok", "", "say \"hi\"", "C:\\path", "multi\nline", "\x01control" };
+const double REALS[] = { 0.5, -12.25, 1024.0, 3.0e-3, 21.5 };
+
+/// @brief Streamed destination, collects every byte the BufferingPrint forwards to it, like the MQTT client does
+class String_Print : public Print {
+  public:
+    std::string text;
+
+    size_t write(uint8_t c) override {
+        text.push_back(static_cast<char>(c));
+        return 1U;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override {
+        text.append(reinterpret_cast<const char*>(buffer), size);
+        return size;
+    }
+};
+
+/// @brief Random batch sorted by its timestamp, every timestamp has up to 4 samples with different keys and values of every type
+std::vector<Telemetry_Sample> random_batch(std::mt19937& random) {
+    std::vector<Telemetry_Sample> samples;
+    uint64_t timestamp = 1700000000000ULL + random() % 1000U;
+    const size_t entries = 1U + random() % 8U;
+    for (size_t entry = 0U; entry < entries; entry++) {
+        timestamp += 1U + random() % 60000U;
+        const size_t values = 1U + random() % 4U;
+        const size_t first_key = random() % (sizeof(KEYS) / sizeof(KEYS[0]));
+        for (size_t i = 0U; i < values; i++) {
+            const char *key = KEYS[(first_key + i) % (sizeof(KEYS) / sizeof(KEYS[0]))];
+            switch (random() % 4U) {
+                case 0U:
+                    samples.push_back(Telemetry_Sample(timestamp, key, static_cast<int64_t>(random()) - 0x7FFFFFFFLL));
+                    break;
+                case 1U:
+                    samples.push_back(Telemetry_Sample(timestamp, key, REALS[random() % (sizeof(REALS) / sizeof(REALS[0]))]));
+                    break;
+                case 2U:
+                    samples.push_back(Telemetry_Sample(timestamp, key, random() % 2U == 0U));
+                    break;
+                default:
+                    samples.push_back(Telemetry_Sample(timestamp, key, STRINGS[random() % (sizeof(STRINGS) / sizeof(STRINGS[0]))]));
+                    break;
+            }
+        }
+    }
+    return samples;
+}
+
+/// @brief Serializes the samples into a buffer of exactly the measured size plus the null terminator
+std::string buffered(const std::vector<Telemetry_Sample>& samples) {
+    const size_t size = Telemetry_Sample::MeasureSeries(samples.data(), samples.size());
+    std::vector<char> buffer(size + 1U);
+    TEST_ASSERT_EQUAL_UINT32(size, Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), buffer.data(), buffer.size()));
+    return std::string(buffer.data());
+}
+
+/// @brief Streams the samples through a BufferingPrint with the given capacity, like sendTelemetrySamples() does for big batches
+std::string streamed(const std::vector<Telemetry_Sample>& samples, const size_t& capacity) {
+    String_Print destination;
+    size_t written = 0U;
+    {
+        BufferingPrint buffered_print(destination, capacity);
+        written = Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), buffered_print);
+        buffered_print.flush();
+    }
+    TEST_ASSERT_EQUAL_UINT32(written, destination.text.size());
+    return destination.text;
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// The measured size equals the output of the buffered and the streamed writer, which is valid json containing every sample
+void test_measure_matches_writers(void) {
+    std::mt19937 random(46U);
+    const size_t CAPACITIES[] = { 1U, 7U, 64U, 4096U };
+    for (size_t batch = 0U; batch < BATCHES; batch++) {
+        const std::vector<Telemetry_Sample> samples = random_batch(random);
+        const size_t size = Telemetry_Sample::MeasureSeries(samples.data(), samples.size());
+        const std::string json = buffered(samples);
+        TEST_ASSERT_EQUAL_UINT32(size, json.size());
+        for (const size_t& capacity : CAPACITIES) {
+            TEST_ASSERT_EQUAL_STRING(json.c_str(), streamed(samples, capacity).c_str());
+        }
+
+        DynamicJsonDocument document(4096U);
+        TEST_ASSERT_TRUE(deserializeJson(document, json) == DeserializationError::Ok);
+        size_t parsed = 0U;
+        for (const JsonObjectConst entry : document.as<JsonArrayConst>()) {
+            parsed += entry["values"].as<JsonObjectConst>().size();
+        }
+        TEST_ASSERT_EQUAL_UINT32(samples.size(), parsed);
+    }
+}
+
+// Consecutive samples with the same timestamp are grouped into the values of one entry, a timestamp that returns later starts a new entry
+void test_same_timestamp_grouped(void) {
+    const Telemetry_Sample samples[] = {
+        Telemetry_Sample(1000U, "temperature", 21.5),
+        Telemetry_Sample(1000U, "humidity", 40),
+        Telemetry_Sample(1000U, "door", true),
+        Telemetry_Sample(2000U, "temperature", 22),
+        Telemetry_Sample(1000U, "state", "late")
+    };
+    const std::vector<Telemetry_Sample> batch(std::begin(samples), std::end(samples));
+    TEST_ASSERT_EQUAL_STRING("[{\"ts\":1000,\"values\":{\"temperature\":21.5,\"humidity\":40,\"door\":true}},"
+                             "{\"ts\":2000,\"values\":{\"temperature\":22}},"
+                             "{\"ts\":1000,\"values\":{\"state\":\"late\"}}]", buffered(batch).c_str());
+
+    // Millisecond timestamps do not fit into 32 bits
+    const std::vector<Telemetry_Sample> single = { Telemetry_Sample(1700000000123ULL, "co2", 412) };
+    TEST_ASSERT_EQUAL_STRING("[{\"ts\":1700000000123,\"values\":{\"co2\":412}}]", buffered(single).c_str());
+}
+
+// Keys are escaped like string values, so a key containing quotes, backslashes or control characters still results in valid json
+void test_keys_escaped(void) {
+    for (const char *key : KEYS) {
+        const std::vector<Telemetry_Sample> samples = { Telemetry_Sample(1U, key, key) };
+        const std::string json = buffered(samples);
+        TEST_ASSERT_EQUAL_UINT32(Telemetry_Sample::MeasureSeries(samples.data(), samples.size()), json.size());
+
+        StaticJsonDocument<256> document;
+        TEST_ASSERT_TRUE_MESSAGE(deserializeJson(document, json) == DeserializationError::Ok, json.c_str());
+        const JsonObjectConst values = document[0]["values"];
+        TEST_ASSERT_EQUAL_UINT32(1U, values.size());
+        TEST_ASSERT_EQUAL_STRING(key, values.begin()->key().c_str());
+        TEST_ASSERT_EQUAL_STRING(key, values.begin()->value().as<const char*>());
+    }
+    const std::vector<Telemetry_Sample> quoted = { Telemetry_Sample(1U, "a\"b", "c\\d") };
+    TEST_ASSERT_EQUAL_STRING("[{\"ts\":1,\"values\":{\"a\\\"b\":\"c\\\\d\"}}]", buffered(quoted).c_str());
+}
+
+// A buffer that is too small receives the beginning of the json and a null terminator, the returned size tells that it was truncated
+void test_truncated_buffer(void) {
+    const std::vector<Telemetry_Sample> samples = {
+        Telemetry_Sample(1000U, "temperature", 21.5),
+        Telemetry_Sample(1000U, "quote\"key", "say \"hi\""),
+        Telemetry_Sample(2000U, "humidity", 40)
+    };
+    const std::string json = buffered(samples);
+    for (size_t buffer_size = 1U; buffer_size <= json.size() + 1U; buffer_size++) {
+        // Exactly sized heap buffer, so writing past its end is caught by the address sanitizer
+        std::vector<char> buffer(buffer_size, '#');
+        const size_t written = Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), buffer.data(), buffer.size());
+        TEST_ASSERT_EQUAL_UINT32(buffer_size - 1U, written);
+        TEST_ASSERT_EQUAL_UINT32(written, strlen(buffer.data()));
+        TEST_ASSERT_EQUAL_STRING(json.substr(0U, written).c_str(), buffer.data());
+    }
+
+    char buffer[8] = "#######";
+    TEST_ASSERT_EQUAL_UINT32(0U, Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), buffer, 0U));
+    TEST_ASSERT_EQUAL_STRING("#######", buffer);
+    TEST_ASSERT_EQUAL_UINT32(0U, Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), nullptr, sizeof(buffer)));
+}
+
+// An empty sample can not be serialized, so the whole batch is refused instead of sending json without its key
+void test_empty_sample(void) {
+    const std::vector<Telemetry_Sample> samples = { Telemetry_Sample(1U, "temperature", 21), Telemetry_Sample() };
+    TEST_ASSERT_EQUAL_UINT32(0U, Telemetry_Sample::MeasureSeries(samples.data(), samples.size()));
+    char buffer[64];
+    TEST_ASSERT_EQUAL_UINT32(0U, Telemetry_Sample::SerializeSeries(samples.data(), samples.size(), buffer, sizeof(buffer)));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_measure_matches_writers);
+    RUN_TEST(test_same_timestamp_grouped);
+    RUN_TEST(test_keys_escaped);
+    RUN_TEST(test_truncated_buffer);
+    RUN_TEST(test_empty_sample);
+    return UNITY_END();
+}
@@ -0,0 +1,352 @@
+// Timer_Service driven by a simulated clock through advance(), compared against the expected expiry tick of every timer
+#include <unity.h>
+#include <Timer_Service.h>
+#include <Callback_Watchdog.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t RESOLUTION = 1000U; // 1 ms ticks
+
+/// @brief Timer that records when its callback was called, optionally cancels another entry or re-arms itself from inside the callback.
+/// Unity assertions can not be used inside the callbacks, because they would jump out of Timer_Service::advance(), so violations are counted instead
+struct Entry {
+    Timer_Service::Timer timer;
+    Timer_Service *service = nullptr;
+    uint64_t *clock = nullptr;
+    uint64_t armed_at = 0U;
+    uint64_t timeout = 0U;
+    bool armed = false;
+    uint32_t fired = 0U;
+    uint64_t fired_at = 0U;
+    uint32_t early = 0U;             // Callback was called before the timeout passed
+    uint32_t rearms = 0U;            // Amount of times the callback re-arms the timer
+    uint64_t rearm_timeout = 0U;     // Timeout used when re-arming
+    Entry *cancel_other = nullptr;   // Entry that is cancelled from inside the callback
+    bool cancel_other_result = false;
+    bool cancel_self_result = true;
+
+    Entry() : timer(&Entry::callback, this) {}
+
+    void arm(Timer_Service& owner, uint64_t& now, const uint64_t& timeout_us) {
+        service = &owner;
+        clock = &now;
+        armed_at = now;
+        timeout = timeout_us;
+        armed = true;
+        service->arm(timer, timeout);
+    }
+
+    static void callback(void *arg) {
+        Entry *entry = static_cast<Entry*>(arg);
+        const uint64_t now = *entry->clock;
+        if (!entry->armed || now < entry->armed_at + entry->timeout) {
+            entry->early++;
+        }
+        entry->armed = false;
+        entry->fired++;
+        entry->fired_at = now;
+        if (entry->cancel_other != nullptr) {
+            entry->cancel_other_result = entry->service->cancel(entry->cancel_other->timer);
+            entry->cancel_other->armed = false;
+        }
+        // Timer is already unlinked while its own callback runs
+        entry->cancel_self_result = entry->service->cancel(entry->timer);
+        if (entry->rearms > 0U) {
+            entry->rearms--;
+            entry->arm(*entry->service, *entry->clock, entry->rearm_timeout);
+        }
+    }
+};
+
+/// @brief Arms a timer for the given amount of ticks at the given start tick and checks it fires exactly on its deadline tick, not one tick earlier or later
+void check_fires_on_tick(const uint64_t& start_tick, const uint64_t& delta_ticks) {
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = start_tick * RESOLUTION;
+    service.advance(now);
+    Entry entry;
+    entry.arm(service, now, delta_ticks * RESOLUTION);
+    TEST_ASSERT_EQUAL_UINT32(1U, service.get_armed());
+
+    // Every tick until the one before the deadline is processed inside this single call, including all cascades on the way
+    now = (start_tick + delta_ticks - 1U) * RESOLUTION;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0U, entry.fired, "fired before its deadline tick");
+    TEST_ASSERT_TRUE(entry.timer.is_armed());
+
+    now += RESOLUTION;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(1U, entry.fired, "did not fire on its deadline tick");
+    TEST_ASSERT_EQUAL_UINT32(0U, entry.early);
+    TEST_ASSERT_FALSE(entry.timer.is_armed());
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+}
+
+} // namespace
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+// Deltas right below, on and above the span of every level (64, 4096 and 262144 ticks) and beyond the span of all levels (2^24 ticks),
+// armed from ticks that are aligned to a level boundary and from ticks that are not, because the cascade happens on aligned ticks
+void test_cascade_boundaries(void) {
+    const uint64_t deltas[] = { 1U, 2U, 63U, 64U, 65U, 127U, 128U, 4095U, 4096U, 4097U, 262143U, 262144U, 262145U,
+                                (1ULL << 24U) - 1U, 1ULL << 24U, (1ULL << 24U) + 1U, (1ULL << 24U) + 4096U, (1ULL << 25U) + 77U };
+    const uint64_t starts[] = { 0U, 1U, 62U, 63U, 64U, 4095U, 4096U, 262143U, (1ULL << 24U) - 1U, 123456789U };
+    for (const uint64_t& start : starts) {
+        for (const uint64_t& delta : deltas) {
+            check_fires_on_tick(start, delta);
+        }
+    }
+}
+
+// Timeouts that are not a multiple of the resolution are rounded up, so a timer never expires early
+void test_rounds_partial_ticks_up(void) {
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = 5500U;
+    service.advance(now);
+    Entry entry;
+    entry.arm(service, now, 1U);
+    now = 5999U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(0U, entry.fired);
+    now = 6000U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(1U, entry.fired);
+    TEST_ASSERT_EQUAL_UINT32(0U, entry.early);
+}
+
+void test_cancel_from_callback(void) {
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = 0U;
+    Entry first, same_tick, later_level, other_level;
+    // Both cancel each other, whichever runs first cancels a timer of the slot that is being processed
+    first.cancel_other = &same_tick;
+    same_tick.cancel_other = &first;
+    first.arm(service, now, 10U * RESOLUTION);
+    same_tick.arm(service, now, 10U * RESOLUTION);
+    // Cancels a timer that waits in a coarser level
+    later_level.cancel_other = &other_level;
+    later_level.arm(service, now, 20U * RESOLUTION);
+    other_level.arm(service, now, 5000U * RESOLUTION);
+    TEST_ASSERT_EQUAL_UINT32(4U, service.get_armed());
+
+    now = 10000U * RESOLUTION;
+    service.advance(now);
+    // Slot order decides which of both same tick timers runs first, the other one has to be cancelled either way
+    TEST_ASSERT_EQUAL_UINT32(1U, first.fired + same_tick.fired);
+    Entry& ran = first.fired == 1U ? first : same_tick;
+    TEST_ASSERT_TRUE(ran.cancel_other_result);
+    TEST_ASSERT_EQUAL_UINT32(1U, later_level.fired);
+    TEST_ASSERT_TRUE(later_level.cancel_other_result);
+    TEST_ASSERT_EQUAL_UINT32(0U, other_level.fired);
+    TEST_ASSERT_FALSE(ran.cancel_self_result);
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+}
+
+void test_rearm_from_callback(void) {
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = 0U;
+    // Re-arming with a zero timeout expires on the next tick, instead of being called again from the same tick forever
+    Entry immediate;
+    immediate.rearms = 3U;
+    immediate.rearm_timeout = 0U;
+    immediate.arm(service, now, RESOLUTION);
+    now = RESOLUTION;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(1U, immediate.fired);
+    TEST_ASSERT_TRUE(immediate.timer.is_armed());
+    for (uint32_t tick = 2U; tick <= 4U; tick++) {
+        now = tick * RESOLUTION;
+        service.advance(now);
+        TEST_ASSERT_EQUAL_UINT32(tick, immediate.fired);
+    }
+    TEST_ASSERT_FALSE(immediate.timer.is_armed());
+
+    // Re-arming with timeouts that reach into the coarser levels, timeouts are relative to the time passed to advance(),
+    // so the clock is advanced tick by tick to check every expiry lands on its exact tick
+    Entry crossing;
+    crossing.rearms = 2U;
+    crossing.rearm_timeout = 4096U * RESOLUTION;
+    crossing.arm(service, now, 63U * RESOLUTION);
+    const uint64_t start = now;
+    const uint64_t expiries[] = { start + 63U * RESOLUTION, start + (63U + 4096U) * RESOLUTION, start + (63U + 8192U) * RESOLUTION };
+    uint32_t expected = 0U;
+    while (now < expiries[2]) {
+        now += RESOLUTION;
+        service.advance(now);
+        if (expected < 3U && now == expiries[expected]) {
+            expected++;
+        }
+        TEST_ASSERT_EQUAL_UINT32(expected, crossing.fired);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3U, crossing.fired);
+    TEST_ASSERT_EQUAL_UINT32(0U, crossing.early);
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+}
+
+// Random arm, cancel and re-arm operations on many timers with timeouts from zero to beyond the span of all levels,
+// while the clock advances in irregular steps, compared against the expected state of every timer
+void test_random_against_model(void) {
+    std::mt19937_64 random(42U);
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = 0U;
+    constexpr size_t TIMERS = 2000U;
+    std::vector<std::unique_ptr<Entry>> entries;
+    for (size_t i = 0U; i < TIMERS; i++) {
+        entries.emplace_back(new Entry());
+        entries.back()->service = &service;
+        entries.back()->clock = &now;
+    }
+    for (size_t i = 0U; i < 50U; i++) {
+        entries[i]->rearms = 3U;
+        entries[i]->rearm_timeout = 12345U;
+    }
+    for (size_t i = 50U; i < 100U; i++) {
+        entries[i]->cancel_other = entries[i + 100U].get();
+    }
+    const auto random_timeout = [&random]() -> uint64_t {
+        switch (random() % 6U) {
+            case 0U: return random() % 2000U;
+            case 1U: return random() % 70000U;
+            case 2U: return random() % 5000000U;
+            case 3U: return random() % 300000000U;
+            case 4U: return (1ULL << 24U) * RESOLUTION + random() % 100000000U;
+            default: return random() % 20000000000ULL;
+        }
+    };
+
+    uint32_t mismatched_cancels = 0U;
+    for (uint32_t step = 0U; step < 50000U; step++) {
+        Entry& entry = *entries[random() % TIMERS];
+        const uint32_t operation = random() % 10U;
+        if (operation < 5U) {
+            entry.arm(service, now, random_timeout());
+        }
+        else if (operation < 7U) {
+            if (service.cancel(entry.timer) != entry.armed) {
+                mismatched_cancels++;
+            }
+            entry.armed = false;
+        }
+        now += random() % 500U == 0U ? random() % 50000000U : random() % 3000U;
+        service.advance(now);
+        if (step % 97U == 0U) {
+            size_t armed = 0U;
+            for (const std::unique_ptr<Entry>& other : entries) {
+                armed += other->armed ? 1U : 0U;
+                TEST_ASSERT_EQUAL(other->armed, other->timer.is_armed());
+            }
+            TEST_ASSERT_EQUAL_UINT32(armed, service.get_armed());
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, mismatched_cancels);
+
+    while (service.get_armed() > 0U) {
+        now += 1000000U;
+        service.advance(now);
+    }
+    for (const std::unique_ptr<Entry>& entry : entries) {
+        TEST_ASSERT_FALSE(entry->armed);
+        TEST_ASSERT_EQUAL_UINT32(0U, entry->early);
+    }
+}
+
+void test_callback_watchdog(void) {
+    Timer_Service service(RESOLUTION, false);
+    uint64_t now = 0U;
+    uint32_t first = 0U;
+    uint32_t second = 0U;
+    Callback_Watchdog first_watchdog([&first]() { first++; }, &service);
+    Callback_Watchdog second_watchdog([&second]() { second++; }, &service);
+    first_watchdog.once(5000U);
+    second_watchdog.once(8000U);
+    now += 4000U;
+    service.advance(now);
+    // Restarting moves the expiry to 9000
+    first_watchdog.once(5000U);
+    now += 4500U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(0U, first);
+    TEST_ASSERT_EQUAL_UINT32(1U, second);
+    now += 1000U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(1U, first);
+
+    second_watchdog.once(1000U);
+    second_watchdog.detach();
+    now += 5000U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(1U, second);
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+
+    {
+        Callback_Watchdog destroyed([&first]() { first += 100U; }, &service);
+        destroyed.once(1000U);
+        TEST_ASSERT_EQUAL_UINT32(1U, service.get_armed());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+    now += 5000U;
+    service.advance(now);
+    TEST_ASSERT_EQUAL_UINT32(1U, first);
+}
+
+// Hardware timer fallback, which is the Ticker on this host, advances the wheel on its own and stops once nothing is armed anymore
+void test_hardware_timer(void) {
+    Timer_Service service(RESOLUTION, true);
+    std::atomic<bool> fired(false);
+    Timer_Service::Timer timer([](void *arg) { static_cast<std::atomic<bool>*>(arg)->store(true); }, &fired);
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    service.arm(timer, 20000U);
+    while (!fired && std::chrono::steady_clock::now() - start < std::chrono::seconds(2)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const int64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    TEST_ASSERT_TRUE(fired);
+    TEST_ASSERT_TRUE(elapsed_ms >= 20);
+    TEST_ASSERT_EQUAL_UINT32(0U, service.get_armed());
+}
+
+// Arming and cancelling has to stay constant time, independent of the amount of other armed timers
+void test_arm_cancel_cost(void) {
+    std::mt19937_64 random(7U);
+    for (const size_t& others : { static_cast<size_t>(0U), static_cast<size_t>(1000U), static_cast<size_t>(100000U) }) {
+        Timer_Service service(RESOLUTION, false);
+        std::vector<std::unique_ptr<Timer_Service::Timer>> timers;
+        for (size_t i = 0U; i < others; i++) {
+            timers.emplace_back(new Timer_Service::Timer(nullptr, nullptr));
+            service.arm(*timers.back(), random() % 100000000U);
+        }
+        Timer_Service::Timer timer(nullptr, nullptr);
+        constexpr uint32_t OPERATIONS = 200000U;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < OPERATIONS; i++) {
+            service.arm(timer, 1000U + (static_cast<uint64_t>(i) * 7919U) % 60000000U);
+            service.cancel(timer);
+        }
+        const int64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+        char message[96];
+        snprintf(message, sizeof(message), "arm + cancel with %u other timers armed: %u ns", static_cast<unsigned>(others), static_cast<unsigned>(elapsed_ns / OPERATIONS));
+        TEST_MESSAGE(message);
+        TEST_ASSERT_EQUAL_UINT32(others, service.get_armed());
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cascade_boundaries);
+    RUN_TEST(test_rounds_partial_ticks_up);
+    RUN_TEST(test_cancel_from_callback);
+    RUN_TEST(test_rearm_from_callback);
+    RUN_TEST(test_random_against_model);
+    RUN_TEST(test_callback_watchdog);
+    RUN_TEST(test_hardware_timer);
+    RUN_TEST(test_arm_cancel_cost);
+    return UNITY_END();
+}
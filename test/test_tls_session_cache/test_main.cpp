@@ -0,0 +1,139 @@
+// TlsSessionCache keyed on host, port and trust configuration, with the NVS copy kept in the Preferences stand-in
+#include <unity.h>
+#include <TlsSessionCache.hpp>
+#include <vector>
+
+namespace {
+
+constexpr char NAMESPACE[] = "tls_test";
+constexpr char HOST[] = "mqtt.example.com";
+constexpr uint16_t PORT = 8883U;
+constexpr uint32_t CA_TRUST = 0x11111111U;
+constexpr uint32_t PINNED_TRUST = 0x22222222U;
+
+std::vector<uint8_t> session_blob(const size_t& length, const uint8_t& seed) {
+    std::vector<uint8_t> blob(length);
+    for (size_t i = 0U; i < length; i++) {
+        blob[i] = static_cast<uint8_t>(seed + i * 7U);
+    }
+    return blob;
+}
+
+bool load(TlsSessionCache& cache, const char *host, const uint16_t& port, const uint32_t& trust, std::vector<uint8_t>& loaded) {
+    loaded.assign(TLS_SESSION_MAX_SIZE, 0U);
+    size_t length = 0U;
+    if (!cache.load(host, port, trust, loaded.data(), loaded.size(), length)) {
+        return false;
+    }
+    loaded.resize(length);
+    return true;
+}
+
+bool nvs_has_session() {
+    return Preferences::storage()[NAMESPACE].count("session") > 0U;
+}
+
+} // namespace
+
+void setUp(void) {
+    TlsSessionCache cache(NAMESPACE);
+    cache.clear();
+}
+
+void tearDown(void) {}
+
+void test_round_trip(void) {
+    TlsSessionCache cache(NAMESPACE);
+    const std::vector<uint8_t> blob = session_blob(300U, 1U);
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    std::vector<uint8_t> loaded;
+    TEST_ASSERT_TRUE(load(cache, HOST, PORT, CA_TRUST, loaded));
+    TEST_ASSERT_EQUAL_UINT32(blob.size(), loaded.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(blob.data(), loaded.data(), blob.size());
+    TEST_ASSERT_TRUE(nvs_has_session());
+}
+
+// A session authenticated with other trust anchors must not be resumed, because resumption skips the certificate check
+void test_keyed_on_trust_configuration(void) {
+    TlsSessionCache cache(NAMESPACE);
+    const std::vector<uint8_t> blob = session_blob(120U, 2U);
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    std::vector<uint8_t> loaded;
+    TEST_ASSERT_FALSE(load(cache, HOST, PORT, PINNED_TRUST, loaded));
+    TEST_ASSERT_FALSE(load(cache, HOST, PORT + 1U, CA_TRUST, loaded));
+    TEST_ASSERT_FALSE(load(cache, "192.168.1.10", PORT, CA_TRUST, loaded));
+    TEST_ASSERT_TRUE(load(cache, HOST, PORT, CA_TRUST, loaded));
+
+    // Storing the session of the new trust configuration replaces the old one
+    const std::vector<uint8_t> pinned = session_blob(140U, 3U);
+    cache.store(HOST, PORT, PINNED_TRUST, pinned.data(), pinned.size());
+    TEST_ASSERT_FALSE(load(cache, HOST, PORT, CA_TRUST, loaded));
+    TEST_ASSERT_TRUE(load(cache, HOST, PORT, PINNED_TRUST, loaded));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(pinned.data(), loaded.data(), pinned.size());
+}
+
+// Flash is only written when the session changed, the cached copy in RTC memory is compared against the one in NVS
+void test_nvs_written_only_on_change(void) {
+    TlsSessionCache cache(NAMESPACE);
+    const std::vector<uint8_t> blob = session_blob(200U, 4U);
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    TEST_ASSERT_TRUE(nvs_has_session());
+    Preferences::storage()[NAMESPACE].clear();
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    TEST_ASSERT_FALSE(nvs_has_session());
+    // Same ticket, but now authenticated with a different trust configuration
+    cache.store(HOST, PORT, PINNED_TRUST, blob.data(), blob.size());
+    TEST_ASSERT_TRUE(nvs_has_session());
+    Preferences::storage()[NAMESPACE].clear();
+    const std::vector<uint8_t> changed = session_blob(200U, 5U);
+    cache.store(HOST, PORT, PINNED_TRUST, changed.data(), changed.size());
+    TEST_ASSERT_TRUE(nvs_has_session());
+}
+
+void test_clear(void) {
+    TlsSessionCache cache(NAMESPACE);
+    const std::vector<uint8_t> blob = session_blob(64U, 6U);
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    cache.clear();
+    std::vector<uint8_t> loaded;
+    TEST_ASSERT_FALSE(load(cache, HOST, PORT, CA_TRUST, loaded));
+    TEST_ASSERT_FALSE(nvs_has_session());
+}
+
+void test_rejects_oversized_entries(void) {
+    TlsSessionCache cache(NAMESPACE);
+    const std::vector<uint8_t> too_big = session_blob(TLS_SESSION_MAX_SIZE + 1U, 7U);
+    cache.store(HOST, PORT, CA_TRUST, too_big.data(), too_big.size());
+    const std::string long_host(64U, 'h');
+    const std::vector<uint8_t> blob = session_blob(32U, 8U);
+    cache.store(long_host.c_str(), PORT, CA_TRUST, blob.data(), blob.size());
+    std::vector<uint8_t> loaded;
+    TEST_ASSERT_FALSE(load(cache, HOST, PORT, CA_TRUST, loaded));
+    TEST_ASSERT_FALSE(load(cache, long_host.c_str(), PORT, CA_TRUST, loaded));
+    TEST_ASSERT_FALSE(nvs_has_session());
+
+    // Buffer of the caller too small for the cached session
+    cache.store(HOST, PORT, CA_TRUST, blob.data(), blob.size());
+    uint8_t small[16];
+    size_t length = 0U;
+    TEST_ASSERT_FALSE(cache.load(HOST, PORT, CA_TRUST, small, sizeof(small), length));
+}
+
+// Known CRC32 check value, must match esp_rom_crc32_le() so sessions persisted by the device validate the same way
+void test_crc32(void) {
+    const char check[] = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926U, TlsSessionCache::crc32(0U, reinterpret_cast<const uint8_t *>(check), 9U));
+    const uint32_t first = TlsSessionCache::crc32(0U, reinterpret_cast<const uint8_t *>(check), 4U);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926U, TlsSessionCache::crc32(first, reinterpret_cast<const uint8_t *>(check) + 4U, 5U));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_keyed_on_trust_configuration);
+    RUN_TEST(test_nvs_written_only_on_change);
+    RUN_TEST(test_clear);
+    RUN_TEST(test_rejects_oversized_entries);
+    RUN_TEST(test_crc32);
+    return UNITY_END();
+}
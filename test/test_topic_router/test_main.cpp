@@ -0,0 +1,434 @@
+// Topic_Router match table, captures, limits and the dispatch of MqttSession to every handler whose filter matches,
+// plus the inbound topics of ThingsBoard and a microbenchmark of their dispatch against the strncmp chain and id copies it replaced
+#include <unity.h>
+#include <Topic_Router.h>
+#include <ThingsBoard.h>
+#include <mqtt_session.hpp>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Route : uint8_t {
+    ATTRIBUTES,
+    ATTRIBUTE_RESPONSE,
+    RPC_REQUEST,
+    RPC_RESPONSE,
+    FIRMWARE_CHUNK,
+    PROVISION_RESPONSE,
+    DEVICE_WILDCARD,
+    CLAIM
+};
+
+constexpr Topic_Route ROUTES[] = {
+    { "v1/devices/me/attributes", ATTRIBUTES },
+    { "v1/devices/me/attributes/response/+", ATTRIBUTE_RESPONSE },
+    { "v1/devices/me/rpc/request/+", RPC_REQUEST },
+    { "v1/devices/me/rpc/response/+", RPC_RESPONSE },
+    { "v2/fw/response/+/chunk/+", FIRMWARE_CHUNK },
+    { "/provision/response", PROVISION_RESPONSE },
+    { "v1/devices/me/#", DEVICE_WILDCARD },
+    { "v1/devices/me/claim", CLAIM }
+};
+
+using Router = Topic_Router<32U, 2U>;
+
+struct Expected {
+    const char *topic;
+    uint8_t route;
+    uint8_t captures;
+    uint32_t first;
+    uint32_t second;
+};
+
+// Highest precedence filter for every topic: literal levels before "+", "+" before "#"
+constexpr Expected TABLE[] = {
+    { "v1/devices/me/attributes", ATTRIBUTES, 0U, 0U, 0U },
+    { "v1/devices/me/attributes/response/17", ATTRIBUTE_RESPONSE, 1U, 17U, 0U },
+    { "v1/devices/me/attributes/response/abc", ATTRIBUTE_RESPONSE, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/attributes/response/", ATTRIBUTE_RESPONSE, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/request/4294967294", RPC_REQUEST, 1U, 4294967294U, 0U },
+    { "v1/devices/me/rpc/request/4294967296", RPC_REQUEST, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/request/99999999999999999999", RPC_REQUEST, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/request/12a", RPC_REQUEST, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/response/0", RPC_RESPONSE, 1U, 0U, 0U },
+    { "v2/fw/response/3/chunk/250", FIRMWARE_CHUNK, 2U, 3U, 250U },
+    { "/provision/response", PROVISION_RESPONSE, 0U, 0U, 0U },
+    { "v1/devices/me/claim", CLAIM, 0U, 0U, 0U },
+    // Only the multi-level wildcard matches, also the parent level itself
+    { "v1/devices/me/rpc/request/1/extra", DEVICE_WILDCARD, 0U, 0U, 0U },
+    { "v1/devices/me/telemetry", DEVICE_WILDCARD, 0U, 0U, 0U },
+    { "v1/devices/me", DEVICE_WILDCARD, 0U, 0U, 0U },
+    { "v1/devices/me/rpc", DEVICE_WILDCARD, 0U, 0U, 0U },
+    { "v1/devices/you/attributes", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v2/fw/response/3/chunk", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v2/fw/response/3/chunk/1/2", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "provision/response", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "", TOPIC_NO_ROUTE, 0U, 0U, 0U }
+};
+
+// Inbound topics of ThingsBoard, with the id that has to be read from the topic
+constexpr Expected INBOUND_TABLE[] = {
+    { "v1/devices/me/attributes", ATTRIBUTE_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/attributes/response/17", ATTRIBUTE_RESPONSE_ROUTE, 1U, 17U, 0U },
+    { "v1/devices/me/attributes/response/", ATTRIBUTE_RESPONSE_ROUTE, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/request/4294967295", RPC_REQUEST_ROUTE, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/request/4294967294", RPC_REQUEST_ROUTE, 1U, 4294967294U, 0U },
+    { "v1/devices/me/rpc/request/12a", RPC_REQUEST_ROUTE, 1U, TOPIC_CAPTURE_INVALID, 0U },
+    { "v1/devices/me/rpc/response/0", RPC_RESPONSE_ROUTE, 1U, 0U, 0U },
+    { "v2/fw/response/0/chunk/250", FIRMWARE_RESPONSE_ROUTE, 1U, 250U, 0U },
+    { "/provision/response", PROV_RESPONSE_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/attributes/shared", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/attributesX", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/rpc/request", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/rpc/requests/1", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/rpc/request/1/extra", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v2/fw/response/0/chunk", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v2/fw/response/1/chunk/0", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "/provision/response/1", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "v1/devices/me/telemetry", TOPIC_NO_ROUTE, 0U, 0U, 0U },
+    { "", TOPIC_NO_ROUTE, 0U, 0U, 0U }
+};
+
+// Subscribed filters of the inbound topics, matched by the trie in the benchmark
+constexpr Topic_Route INBOUND_FILTERS[] = {
+    { RPC_RESPONSE_SUBSCRIBE_TOPIC, RPC_RESPONSE_ROUTE },
+    { RPC_SUBSCRIBE_TOPIC, RPC_REQUEST_ROUTE },
+    { ATTRIBUTE_RESPONSE_SUBSCRIBE_TOPIC, ATTRIBUTE_RESPONSE_ROUTE },
+    { ATTRIBUTE_TOPIC, ATTRIBUTE_ROUTE },
+    { PROV_RESPONSE_TOPIC, PROV_RESPONSE_ROUTE },
+    { "v2/fw/response/0/chunk/+", FIRMWARE_RESPONSE_ROUTE }
+};
+
+/// @brief Id of the topic, copied out of it into a std::string and converted with atoi, the way each process function read it before
+uint32_t copied_id(const char *topic, const char *prefix) {
+    const size_t index = strlen(prefix) + 1U;
+    std::string response = topic;
+    response = response.substr(index, response.length() - index);
+    return static_cast<uint32_t>(atoi(response.c_str()));
+}
+
+/// @brief Chain of prefix comparisons in the order onMQTTMessage checked them before the inbound topics table, including the id copies
+bool old_dispatch(const char *topic, Inbound_Match& match) {
+    match.captures = 1U;
+    if (strncmp_P(FIRMWARE_RESPONSE_TOPIC, topic, strlen(FIRMWARE_RESPONSE_TOPIC)) == 0) {
+        match.route = FIRMWARE_RESPONSE_ROUTE;
+        match.values[0] = copied_id(topic, FIRMWARE_RESPONSE_TOPIC);
+    }
+    else if (strncmp_P(RPC_RESPONSE_TOPIC, topic, strlen(RPC_RESPONSE_TOPIC)) == 0) {
+        match.route = RPC_RESPONSE_ROUTE;
+        match.values[0] = copied_id(topic, RPC_RESPONSE_TOPIC);
+    }
+    else if (strncmp_P(RPC_REQUEST_TOPIC, topic, strlen(RPC_REQUEST_TOPIC)) == 0) {
+        match.route = RPC_REQUEST_ROUTE;
+        match.values[0] = copied_id(topic, RPC_REQUEST_TOPIC);
+    }
+    else if (strncmp_P(ATTRIBUTE_RESPONSE_TOPIC, topic, strlen(ATTRIBUTE_RESPONSE_TOPIC)) == 0) {
+        match.route = ATTRIBUTE_RESPONSE_ROUTE;
+        match.values[0] = copied_id(topic, ATTRIBUTE_RESPONSE_TOPIC);
+    }
+    else if (strncmp_P(ATTRIBUTE_TOPIC, topic, strlen(ATTRIBUTE_TOPIC)) == 0) {
+        match.route = ATTRIBUTE_ROUTE;
+        match.captures = 0U;
+    }
+    else if (strncmp_P(PROV_RESPONSE_TOPIC, topic, strlen(PROV_RESPONSE_TOPIC)) == 0) {
+        match.route = PROV_RESPONSE_ROUTE;
+        match.captures = 0U;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+/// @brief Client that answers CONNECT with a CONNACK and then returns the bytes the test queued, like a broker that sends PUBLISH packets
+class Scripted_Client : public Client {
+  public:
+    int connect(IPAddress ip, uint16_t port) override {
+        (void)ip;
+        (void)port;
+        return connect("", 0U);
+    }
+    int connect(const char *host, uint16_t port) override {
+        (void)host;
+        (void)port;
+        const uint8_t connack[] = { 0x20U, 0x02U, 0x00U, 0x00U };
+        m_input.assign(connack, connack + sizeof(connack));
+        m_connected = true;
+        return 1;
+    }
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1U); }
+    size_t write(const uint8_t *buffer, size_t size) override {
+        (void)buffer;
+        return size;
+    }
+    int available() override { return static_cast<int>(m_input.size() - m_position); }
+    int read() override { return m_position < m_input.size() ? m_input[m_position++] : -1; }
+    int read(uint8_t *buffer, size_t size) override {
+        size_t count = 0U;
+        while (count < size && m_position < m_input.size()) {
+            buffer[count++] = m_input[m_position++];
+        }
+        return count > 0U ? static_cast<int>(count) : -1;
+    }
+    int peek() override { return m_position < m_input.size() ? m_input[m_position] : -1; }
+    void flush() override {}
+    void stop() override { m_connected = false; }
+    uint8_t connected() override { return m_connected ? 1U : 0U; }
+    operator bool() override { return m_connected; }
+
+    void queue_publish(const char *topic, const char *payload) {
+        const size_t topic_length = strlen(topic);
+        const size_t remaining = 2U + topic_length + strlen(payload);
+        m_input.push_back(0x30U);
+        m_input.push_back(static_cast<uint8_t>(remaining));
+        m_input.push_back(static_cast<uint8_t>(topic_length >> 8U));
+        m_input.push_back(static_cast<uint8_t>(topic_length));
+        m_input.insert(m_input.end(), topic, topic + topic_length);
+        m_input.insert(m_input.end(), payload, payload + strlen(payload));
+    }
+
+  private:
+    std::vector<uint8_t> m_input;
+    size_t m_position = 0U;
+    bool m_connected = false;
+};
+
+// Handlers of the session, record which filter was called with which capture
+std::vector<std::string> calls;
+
+void on_attributes(const MqttMessage& message) {
+    calls.push_back(std::string("attributes:") + std::string(reinterpret_cast<const char *>(message.payload), message.length));
+}
+
+void on_rpc(const MqttMessage& message) {
+    calls.push_back("rpc:" + std::to_string(message.route.value(0U)));
+}
+
+void on_device(const MqttMessage& message) {
+    (void)message;
+    calls.push_back("device");
+}
+
+void on_rpc_second(const MqttMessage& message) {
+    (void)message;
+    calls.push_back("rpc-second");
+}
+
+} // namespace
+
+void setUp(void) {
+    calls.clear();
+}
+
+void tearDown(void) {}
+
+void test_match_table(void) {
+    const Router router(ROUTES);
+    for (const Expected& expected : TABLE) {
+        Router::Match match;
+        const bool matched = router.match(expected.topic, match);
+        TEST_ASSERT_EQUAL_MESSAGE(expected.route != TOPIC_NO_ROUTE, matched, expected.topic);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.route, match.route, expected.topic);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.captures, match.captures, expected.topic);
+        if (expected.captures > 0U) {
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.first, match.value(0U), expected.topic);
+        }
+        if (expected.captures > 1U) {
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.second, match.value(1U), expected.topic);
+        }
+        TEST_ASSERT_EQUAL_UINT32(TOPIC_CAPTURE_INVALID, match.value(expected.captures));
+    }
+    TEST_ASSERT_EQUAL_UINT8(TOPIC_NO_ROUTE, router.route(nullptr));
+}
+
+// Every matching filter is visited in precedence order, the captures belong to the filter that is visited
+void test_match_all(void) {
+    const Router router(ROUTES);
+    std::vector<uint8_t> routes;
+    std::vector<uint32_t> captures;
+    const size_t count = router.match_all("v1/devices/me/rpc/request/42", [&routes, &captures](const Router::Match& match) {
+        routes.push_back(match.route);
+        captures.push_back(match.value(0U));
+    });
+    TEST_ASSERT_EQUAL_UINT32(2U, count);
+    TEST_ASSERT_EQUAL_UINT8(RPC_REQUEST, routes[0U]);
+    TEST_ASSERT_EQUAL_UINT32(42U, captures[0U]);
+    TEST_ASSERT_EQUAL_UINT8(DEVICE_WILDCARD, routes[1U]);
+    TEST_ASSERT_EQUAL_UINT32(TOPIC_CAPTURE_INVALID, captures[1U]);
+
+    routes.clear();
+    TEST_ASSERT_EQUAL_UINT32(2U, router.match_all("v1/devices/me/attributes", [&routes](const Router::Match& match) { routes.push_back(match.route); }));
+    TEST_ASSERT_EQUAL_UINT8(ATTRIBUTES, routes[0U]);
+    TEST_ASSERT_EQUAL_UINT8(DEVICE_WILDCARD, routes[1U]);
+    TEST_ASSERT_EQUAL_UINT32(0U, router.match_all("v1/devices/you", [](const Router::Match& match) { (void)match; }));
+
+    // "a" and "a/#" both match "a"
+    Router parent;
+    TEST_ASSERT_TRUE(parent.add("a", 1U));
+    TEST_ASSERT_TRUE(parent.add("a/#", 2U));
+    TEST_ASSERT_TRUE(parent.add("+", 3U));
+    routes.clear();
+    TEST_ASSERT_EQUAL_UINT32(3U, parent.match_all("a", [&routes](const Router::Match& match) { routes.push_back(match.route); }));
+    TEST_ASSERT_EQUAL_UINT8(1U, routes[0U]);
+    TEST_ASSERT_EQUAL_UINT8(2U, routes[1U]);
+    TEST_ASSERT_EQUAL_UINT8(3U, routes[2U]);
+}
+
+void test_rejected_filters(void) {
+    Topic_Router<8U, 1U> router;
+    TEST_ASSERT_FALSE(router.add(nullptr, 1U));
+    TEST_ASSERT_FALSE(router.add("a/b", TOPIC_NO_ROUTE));
+    TEST_ASSERT_FALSE(router.add("a/#/b", 1U));
+    // Level lengths are stored in 8 bits, a longer level would otherwise wrap around and match other topics.
+    // The router keeps pointers into the filters, they have to outlive it
+    const std::string long_level(256U, 'x');
+    const std::string rejected = "a/" + long_level;
+    const std::string accepted = "b/" + long_level.substr(1U);
+    TEST_ASSERT_FALSE(router.add(rejected.c_str(), 1U));
+    TEST_ASSERT_TRUE(router.add(accepted.c_str(), 2U));
+    TEST_ASSERT_EQUAL_UINT8(2U, router.route(accepted.c_str()));
+    TEST_ASSERT_EQUAL_UINT8(TOPIC_NO_ROUTE, router.route(("b/" + long_level).c_str()));
+    TEST_ASSERT_EQUAL_UINT8(TOPIC_NO_ROUTE, router.route(rejected.c_str()));
+    // Trie is full, the root and the two levels of each filter above are in use
+    TEST_ASSERT_TRUE(router.add("c/d/e", 3U));
+    TEST_ASSERT_FALSE(router.add("f/g/h", 4U));
+    TEST_ASSERT_EQUAL_UINT32(8U, router.size());
+}
+
+// Captures beyond MaxCaptures still match, but their value is discarded
+void test_capture_limit(void) {
+    Topic_Router<8U, 1U> router;
+    TEST_ASSERT_TRUE(router.add("+/+/+", 1U));
+    Topic_Router<8U, 1U>::Match match;
+    TEST_ASSERT_TRUE(router.match("1/2/3", match));
+    TEST_ASSERT_EQUAL_UINT8(1U, match.captures);
+    TEST_ASSERT_EQUAL_UINT32(1U, match.value(0U));
+    TEST_ASSERT_EQUAL_UINT32(TOPIC_CAPTURE_INVALID, match.value(1U));
+}
+
+// Received topics only match an inbound route if they end with its topic or with exactly one id level behind it
+void test_inbound_topics(void) {
+    for (const Expected& expected : INBOUND_TABLE) {
+        Inbound_Match match;
+        const bool matched = Match_Inbound_Topic(expected.topic, match);
+        TEST_ASSERT_EQUAL_MESSAGE(expected.route != TOPIC_NO_ROUTE, matched, expected.topic);
+        if (!matched) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.route, match.route, expected.topic);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.captures, match.captures, expected.topic);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.captures > 0U ? expected.first : TOPIC_CAPTURE_INVALID, match.value(0U), expected.topic);
+    }
+}
+
+// MqttSession calls the handlers of every filter that matches, with the captures of that filter
+void test_session_dispatches_every_match(void) {
+    Scripted_Client transport;
+    PubSubClient client(transport);
+    MqttSession session(client);
+    TEST_ASSERT_TRUE(session.subscribe("v1/devices/me/attributes", on_attributes));
+    TEST_ASSERT_TRUE(session.subscribe("v1/devices/me/rpc/request/+", on_rpc));
+    TEST_ASSERT_TRUE(session.addHandler("v1/devices/me/rpc/request/+", on_rpc_second));
+    TEST_ASSERT_TRUE(session.subscribe("v1/devices/me/#", on_device));
+    TEST_ASSERT_TRUE(session.connect("device", "token", nullptr));
+
+    transport.queue_publish("v1/devices/me/rpc/request/7", "{}");
+    transport.queue_publish("v1/devices/me/attributes", "{\"ledState\":true}");
+    transport.queue_publish("v1/devices/other", "{}");
+    transport.queue_publish("v1/devices/me/telemetry", "{}");
+    for (uint8_t i = 0U; i < 4U; i++) {
+        TEST_ASSERT_TRUE(client.loop());
+    }
+    const char *expected[] = { "rpc:7", "rpc-second", "device", "attributes:{\"ledState\":true}", "device", "device" };
+    TEST_ASSERT_EQUAL_UINT32(sizeof(expected) / sizeof(expected[0U]), calls.size());
+    for (size_t i = 0U; i < calls.size(); i++) {
+        TEST_ASSERT_EQUAL_STRING(expected[i], calls[i].c_str());
+    }
+    // The session lives as long as the device and never releases its lock
+    vSemaphoreDelete(session.getMutex());
+}
+
+// Topics in the proportion they are received while a firmware update is running, chunks first, then server-side RPC and shared attributes.
+// The table has to match every topic like the old dispatch and the trie, while being faster than the old dispatch
+void test_benchmark(void) {
+    constexpr uint32_t ITERATIONS = 200000U;
+    const Topic_Router<24U, 1U> router(INBOUND_FILTERS);
+    const char *topics[] = {
+        "v2/fw/response/0/chunk/0",
+        "v2/fw/response/0/chunk/17",
+        "v2/fw/response/0/chunk/250",
+        "v2/fw/response/0/chunk/4096",
+        "v2/fw/response/0/chunk/4097",
+        "v2/fw/response/0/chunk/4098",
+        "v1/devices/me/rpc/request/123456",
+        "v1/devices/me/rpc/request/123457",
+        "v1/devices/me/rpc/request/123458",
+        "v1/devices/me/attributes",
+        "v1/devices/me/attributes",
+        "v1/devices/me/attributes/response/17",
+        "v1/devices/me/rpc/response/3",
+        "/provision/response"
+    };
+    constexpr size_t TOPIC_COUNT = sizeof(topics) / sizeof(topics[0U]);
+    for (const char *topic : topics) {
+        Inbound_Match expected;
+        Inbound_Match table;
+        Inbound_Match trie;
+        TEST_ASSERT_TRUE(old_dispatch(topic, expected));
+        TEST_ASSERT_TRUE(Match_Inbound_Topic(topic, table));
+        TEST_ASSERT_TRUE(router.match(topic, trie));
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.route, table.route, topic);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(expected.route, trie.route, topic);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.value(0U), table.value(0U), topic);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.value(0U), trie.value(0U), topic);
+    }
+    volatile uint32_t sink = 0U;
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ITERATIONS; i++) {
+        Inbound_Match match;
+        old_dispatch(topics[i % TOPIC_COUNT], match);
+        sink += match.route + match.value(0U);
+    }
+    const std::chrono::steady_clock::time_point old_end = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ITERATIONS; i++) {
+        Inbound_Match match;
+        router.match(topics[i % TOPIC_COUNT], match);
+        sink += match.route + match.value(0U);
+    }
+    const std::chrono::steady_clock::time_point trie_end = std::chrono::steady_clock::now();
+    for (uint32_t i = 0U; i < ITERATIONS; i++) {
+        Inbound_Match match;
+        Match_Inbound_Topic(topics[i % TOPIC_COUNT], match);
+        sink += match.route + match.value(0U);
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    (void)sink;
+
+    const double old_ns = std::chrono::duration<double, std::nano>(old_end - start).count() / ITERATIONS;
+    const double trie_ns = std::chrono::duration<double, std::nano>(trie_end - old_end).count() / ITERATIONS;
+    const double table_ns = std::chrono::duration<double, std::nano>(end - trie_end).count() / ITERATIONS;
+    char message[128];
+    snprintf(message, sizeof(message), "strncmp chain with id copies %.1f ns, trie %.1f ns, inbound topics table %.1f ns per topic",
+             old_ns, trie_ns, table_ns);
+    TEST_MESSAGE(message);
+    TEST_ASSERT_TRUE(table_ns < old_ns);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_match_table);
+    RUN_TEST(test_match_all);
+    RUN_TEST(test_rejected_filters);
+    RUN_TEST(test_capture_limit);
+    RUN_TEST(test_inbound_topics);
+    RUN_TEST(test_session_dispatches_every_match);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,433 @@
+// Non-STL Vector compared against std::vector, with a move-only element type and an element type that counts its lifetimes
+#include <unity.h>
+// Vector only exists for boards without the C++ STL, forced here so the host can test it
+#define THINGSBOARD_ENABLE_STL 0
+#include <Vector.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// @brief Counts constructions, destructions, copies and moves of all instances, and any use of an instance that has already been destroyed or moved from
+struct Counted {
+    static long live;
+    static long copies;
+    static long moves;
+    static long move_assignments;
+    static long invalid;
+
+    int value;
+    bool alive;
+    std::string text; // Non trivial member, breaks if the element is ever copied bytewise
+
+    Counted(int v = 0) : value(v), alive(true), text(expected_text(v)) { live++; }
+    Counted(const Counted& other) : value(other.value), alive(true), text(other.text) { check(other); live++; copies++; }
+    Counted(Counted&& other) : value(other.value), alive(true), text(static_cast<std::string&&>(other.text)) { check(other); live++; moves++; }
+    ~Counted() { check(*this); alive = false; live--; }
+
+    Counted& operator=(const Counted& other) {
+        check(*this);
+        check(other);
+        value = other.value;
+        text = other.text;
+        return *this;
+    }
+
+    Counted& operator=(Counted&& other) {
+        check(*this);
+        check(other);
+        value = other.value;
+        text = static_cast<std::string&&>(other.text);
+        move_assignments++;
+        return *this;
+    }
+
+    bool intact() const { return alive && text == expected_text(value); }
+
+    static std::string expected_text(int v) { return std::to_string(v) + std::string(32U, 'x'); }
+    static void check(const Counted& other) { if (!other.alive) invalid++; }
+    static void reset() { copies = 0; moves = 0; move_assignments = 0; }
+};
+
+long Counted::live = 0;
+long Counted::copies = 0;
+long Counted::moves = 0;
+long Counted::move_assignments = 0;
+long Counted::invalid = 0;
+
+/// @brief Element that can only be moved, like a callback owning a resource
+struct MoveOnly {
+    int *value;
+
+    explicit MoveOnly(int v) : value(new int(v)) {}
+    MoveOnly(MoveOnly&& other) : value(other.value) { other.value = nullptr; }
+    MoveOnly& operator=(MoveOnly&& other) {
+        if (this != &other) {
+            delete value;
+            value = other.value;
+            other.value = nullptr;
+        }
+        return *this;
+    }
+    ~MoveOnly() { delete value; }
+    MoveOnly(const MoveOnly&) = delete;
+    MoveOnly& operator=(const MoveOnly&) = delete;
+
+    int get() const { return value != nullptr ? *value : -1; }
+};
+
+template <typename V>
+bool same(const V& actual, const std::vector<Counted>& expected) {
+    if (actual.size() != expected.size() || actual.size() > actual.capacity() || static_cast<size_t>(actual.cend() - actual.cbegin()) != actual.size()) {
+        return false;
+    }
+    for (size_t i = 0U; i < expected.size(); i++) {
+        if (actual[i].value != expected[i].value || !actual[i].intact()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename V>
+bool same(const V& actual, const std::vector<MoveOnly>& expected) {
+    if (actual.size() != expected.size() || actual.size() > actual.capacity()) {
+        return false;
+    }
+    for (size_t i = 0U; i < expected.size(); i++) {
+        if (actual[i].get() != expected[i].get() || actual[i].get() < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Applies the same random operations to the Vector and to std::vector and compares both after every step
+/// @return Step that first differed, 0 if both always matched
+template <typename V>
+uint32_t fuzz_counted(const uint64_t& seed) {
+    std::mt19937_64 random(seed);
+    V actual;
+    std::vector<Counted> expected;
+    for (uint32_t step = 1U; step <= 5000U; step++) {
+        const int value = static_cast<int>(random() % 1000U);
+        switch (random() % 12U) {
+            case 0U:
+            case 1U:
+                actual.push_back(Counted(value));
+                expected.push_back(Counted(value));
+                break;
+            case 2U: {
+                const Counted element(value);
+                actual.push_back(element);
+                expected.push_back(element);
+                break;
+            }
+            case 3U:
+                actual.emplace_back(value);
+                expected.emplace_back(value);
+                break;
+            case 4U:
+                // Pushes an element of the container itself, which has to stay valid even if the push reallocates
+                if (!expected.empty()) {
+                    const size_t index = random() % expected.size();
+                    actual.push_back(actual[index]);
+                    expected.push_back(expected[index]);
+                }
+                break;
+            case 5U:
+            case 6U:
+                if (!expected.empty()) {
+                    const size_t index = random() % expected.size();
+                    actual.erase(index);
+                    expected.erase(expected.begin() + index);
+                }
+                break;
+            case 7U:
+                if (!expected.empty()) {
+                    actual.pop_back();
+                    expected.pop_back();
+                }
+                break;
+            case 8U: {
+                const size_t capacity = random() % 64U;
+                actual.reserve(capacity);
+                expected.reserve(capacity);
+                if (actual.capacity() < capacity) {
+                    return step;
+                }
+                break;
+            }
+            case 9U:
+                if (random() % 20U == 0U) {
+                    actual.clear();
+                    expected.clear();
+                }
+                break;
+            case 10U: {
+                // Round trip through every constructor and assignment operator
+                V copied(actual);
+                V assigned;
+                assigned = copied;
+                V moved(static_cast<V&&>(assigned));
+                if (!same(copied, expected) || !same(moved, expected) || !assigned.empty()) {
+                    return step;
+                }
+                actual = static_cast<V&&>(moved);
+                if (!moved.empty()) {
+                    return step;
+                }
+                break;
+            }
+            default:
+                if (random() % 50U == 0U) {
+                    V big;
+                    for (int i = 0; i < 100; i++) {
+                        big.emplace_back(i);
+                    }
+                    actual = big;
+                    expected.clear();
+                    for (int i = 0; i < 100; i++) {
+                        expected.emplace_back(i);
+                    }
+                }
+                break;
+        }
+        if (!same(actual, expected)) {
+            return step;
+        }
+    }
+    return 0U;
+}
+
+template <typename V>
+uint32_t fuzz_move_only(const uint64_t& seed) {
+    std::mt19937_64 random(seed);
+    V actual;
+    std::vector<MoveOnly> expected;
+    for (uint32_t step = 1U; step <= 5000U; step++) {
+        const int value = static_cast<int>(random() % 1000U);
+        switch (random() % 8U) {
+            case 0U:
+            case 1U:
+                actual.push_back(MoveOnly(value));
+                expected.push_back(MoveOnly(value));
+                break;
+            case 2U:
+                actual.emplace_back(value);
+                expected.emplace_back(value);
+                break;
+            case 3U:
+            case 4U:
+                if (!expected.empty()) {
+                    const size_t index = random() % expected.size();
+                    actual.erase(index);
+                    expected.erase(expected.begin() + index);
+                }
+                break;
+            case 5U:
+                if (!expected.empty()) {
+                    actual.pop_back();
+                    expected.pop_back();
+                }
+                break;
+            case 6U: {
+                V moved(static_cast<V&&>(actual));
+                if (!actual.empty() || !same(moved, expected)) {
+                    return step;
+                }
+                actual = static_cast<V&&>(moved);
+                break;
+            }
+            default:
+                if (random() % 20U == 0U) {
+                    actual.clear();
+                    expected.clear();
+                }
+                break;
+        }
+        if (!same(actual, expected)) {
+            return step;
+        }
+    }
+    return 0U;
+}
+
+template <typename V>
+bool uses_inline_storage(const V& vector) {
+    const unsigned char *start = reinterpret_cast<const unsigned char*>(&vector);
+    const unsigned char *elements = reinterpret_cast<const unsigned char*>(vector.data());
+    return elements >= start && elements < start + sizeof(V);
+}
+
+template <typename F>
+uint32_t measure_us(F function) {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    function();
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+} // namespace
+
+void setUp(void) {
+    Counted::reset();
+    Counted::invalid = 0;
+}
+
+void tearDown(void) {}
+
+void test_counted_matches_std_vector(void) {
+    for (uint64_t seed = 1U; seed <= 10U; seed++) {
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_counted<Vector<Counted>>(seed)));
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_counted<Vector<Counted, 8U>>(seed)));
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_counted<Vector<Counted, 3U, Vector_Exact_Growth>>(seed)));
+    }
+    // Every constructed element has been destroyed exactly once and no destroyed element was ever used again
+    TEST_ASSERT_EQUAL(0, Counted::live);
+    TEST_ASSERT_EQUAL(0, Counted::invalid);
+}
+
+void test_move_only_matches_std_vector(void) {
+    for (uint64_t seed = 1U; seed <= 10U; seed++) {
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_move_only<Vector<MoveOnly>>(seed)));
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_move_only<Vector<MoveOnly, 4U>>(seed)));
+        TEST_ASSERT_EQUAL_UINT32(0U, (fuzz_move_only<Vector<MoveOnly, 2U, Vector_Exact_Growth>>(seed)));
+    }
+}
+
+void test_inline_to_heap_transitions(void) {
+    {
+        Vector<Counted, 4U> vector;
+        TEST_ASSERT_EQUAL_UINT32(4U, vector.capacity());
+        for (int i = 0; i < 4; i++) {
+            vector.emplace_back(i);
+        }
+        TEST_ASSERT_TRUE(uses_inline_storage(vector));
+        // Filling the inline storage constructs every element in place
+        TEST_ASSERT_EQUAL(0, Counted::copies + Counted::moves);
+
+        vector.emplace_back(4);
+        TEST_ASSERT_FALSE(uses_inline_storage(vector));
+        TEST_ASSERT_EQUAL_UINT32(8U, vector.capacity());
+        // Growing moves the existing elements instead of copying them
+        TEST_ASSERT_EQUAL(0, Counted::copies);
+
+        // Moving a vector that allocated takes over its memory without touching the elements
+        const Counted *heap = vector.data();
+        Counted::reset();
+        Vector<Counted, 4U> moved(static_cast<Vector<Counted, 4U>&&>(vector));
+        TEST_ASSERT_TRUE(moved.data() == heap);
+        TEST_ASSERT_EQUAL(0, Counted::copies + Counted::moves);
+        TEST_ASSERT_TRUE(vector.empty());
+        TEST_ASSERT_TRUE(uses_inline_storage(vector));
+        TEST_ASSERT_EQUAL_UINT32(4U, vector.capacity());
+
+        // Clearing keeps the heap memory, so refilling it does not allocate again
+        moved.clear();
+        TEST_ASSERT_TRUE(moved.data() == heap);
+        TEST_ASSERT_EQUAL_UINT32(8U, moved.capacity());
+
+        // Moving a vector that still uses its inline storage moves the elements one by one
+        Vector<Counted, 4U> small;
+        small.emplace_back(10);
+        small.emplace_back(11);
+        Counted::reset();
+        Vector<Counted, 4U> moved_small(static_cast<Vector<Counted, 4U>&&>(small));
+        TEST_ASSERT_TRUE(uses_inline_storage(moved_small));
+        TEST_ASSERT_EQUAL(2, Counted::moves);
+        TEST_ASSERT_EQUAL(0, Counted::copies);
+        TEST_ASSERT_TRUE(small.empty());
+        TEST_ASSERT_EQUAL(11, moved_small[1U].value);
+
+        // Move assigning inline elements into a vector that allocated releases its heap memory
+        moved = static_cast<Vector<Counted, 4U>&&>(moved_small);
+        TEST_ASSERT_TRUE(uses_inline_storage(moved));
+        TEST_ASSERT_EQUAL_UINT32(2U, moved.size());
+        TEST_ASSERT_EQUAL(10, moved[0U].value);
+    }
+    TEST_ASSERT_EQUAL(0, Counted::live);
+    TEST_ASSERT_EQUAL(0, Counted::invalid);
+}
+
+void test_self_referencing_push_back(void) {
+    {
+        Vector<Counted, 2U> vector;
+        vector.emplace_back(7);
+        vector.emplace_back(8);
+        // Full, so both pushes reallocate the memory the pushed element is stored in
+        vector.push_back(vector[0U]);
+        TEST_ASSERT_EQUAL_UINT32(3U, vector.size());
+        TEST_ASSERT_EQUAL(7, vector[2U].value);
+        TEST_ASSERT_TRUE(vector[2U].intact());
+        vector.push_back(vector[2U]);
+        vector.push_back(static_cast<Counted&&>(vector[1U]));
+        TEST_ASSERT_EQUAL_UINT32(5U, vector.size());
+        TEST_ASSERT_EQUAL(7, vector[3U].value);
+        TEST_ASSERT_EQUAL(8, vector[4U].value);
+        TEST_ASSERT_TRUE(vector[4U].intact());
+        vector.emplace_back(vector[4U]);
+        TEST_ASSERT_EQUAL(8, vector[5U].value);
+        TEST_ASSERT_TRUE(vector[5U].intact());
+    }
+    TEST_ASSERT_EQUAL(0, Counted::live);
+    TEST_ASSERT_EQUAL(0, Counted::invalid);
+}
+
+void test_erase_moves_instead_of_copies(void) {
+    {
+        Vector<Counted> vector;
+        for (int i = 0; i < 10; i++) {
+            vector.emplace_back(i);
+        }
+        const long live = Counted::live;
+        Counted::reset();
+        vector.erase(2U);
+        // Every element after the erased one is move assigned one to the left and the last one is destroyed
+        TEST_ASSERT_EQUAL(7, Counted::move_assignments);
+        TEST_ASSERT_EQUAL(0, Counted::copies);
+        TEST_ASSERT_EQUAL(live - 1, Counted::live);
+        for (size_t i = 0U; i < vector.size(); i++) {
+            TEST_ASSERT_EQUAL(i < 2U ? static_cast<int>(i) : static_cast<int>(i) + 1, vector[i].value);
+            TEST_ASSERT_TRUE(vector[i].intact());
+        }
+        // Erasing past the end is ignored
+        vector.erase(vector.size());
+        TEST_ASSERT_EQUAL_UINT32(9U, vector.size());
+        vector.erase(vector.size() - 1U);
+        TEST_ASSERT_EQUAL(8, vector.back().value);
+    }
+    TEST_ASSERT_EQUAL(0, Counted::live);
+}
+
+void test_push_erase_benchmark(void) {
+    constexpr int PUSHES = 1000000;
+    constexpr int ERASES = 20000;
+    constexpr int SMALL_ROUNDS = 100000;
+    volatile long sink = 0;
+    const uint32_t push_vector = measure_us([&sink]() { Vector<int> v; for (int i = 0; i < PUSHES; i++) v.push_back(i); sink += v[PUSHES / 2]; });
+    const uint32_t push_std = measure_us([&sink]() { std::vector<int> v; for (int i = 0; i < PUSHES; i++) v.push_back(i); sink += v[PUSHES / 2]; });
+    const uint32_t small_inline = measure_us([&sink]() { for (int r = 0; r < SMALL_ROUNDS; r++) { Vector<int, 8U> v; for (int i = 0; i < 8; i++) v.push_back(i); sink += v[3U]; } });
+    const uint32_t small_heap = measure_us([&sink]() { for (int r = 0; r < SMALL_ROUNDS; r++) { Vector<int> v; for (int i = 0; i < 8; i++) v.push_back(i); sink += v[3U]; } });
+    const uint32_t erase_vector = measure_us([]() { Vector<int> v; for (int i = 0; i < ERASES; i++) v.push_back(i); while (!v.empty()) v.erase(0U); });
+    const uint32_t erase_std = measure_us([]() { std::vector<int> v; for (int i = 0; i < ERASES; i++) v.push_back(i); while (!v.empty()) v.erase(v.begin()); });
+    char message[160];
+    snprintf(message, sizeof(message), "push_back 1M int: Vector %u us, std::vector %u us", static_cast<unsigned>(push_vector), static_cast<unsigned>(push_std));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "8 push_back x 100k: inline capacity 8 %u us, heap %u us", static_cast<unsigned>(small_inline), static_cast<unsigned>(small_heap));
+    TEST_MESSAGE(message);
+    snprintf(message, sizeof(message), "erase front of 20k int: Vector %u us, std::vector %u us", static_cast<unsigned>(erase_vector), static_cast<unsigned>(erase_std));
+    TEST_MESSAGE(message);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_counted_matches_std_vector);
+    RUN_TEST(test_move_only_matches_std_vector);
+    RUN_TEST(test_inline_to_heap_transitions);
+    RUN_TEST(test_self_referencing_push_back);
+    RUN_TEST(test_erase_moves_instead_of_copies);
+    RUN_TEST(test_push_erase_benchmark);
+    return UNITY_END();
+}
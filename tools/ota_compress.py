@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Nén image OTA (định dạng "TBZ1", xem lib/OTA/HeatshrinkDecoder.h).
+
+    python tools/ota_compress.py compress   firmware.bin firmware.tbz
+    python tools/ota_compress.py decompress firmware.tbz firmware.bin
+
+Có thể nén image đầy đủ hoặc patch tạo bởi tools/ota_delta.py. File nén được upload
+lên ThingsBoard như firmware bình thường (checksum tính trên file nén), thiết bị giải
+nén trong lúc tải với window 2^W byte.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"TBZ1"
+HEADER = struct.Struct("<4sBBHI")
+
+# Window 2 KB (giới hạn HEATSHRINK_MAX_WINDOW_BITS của thiết bị), đoạn lặp tối đa 16 byte
+WINDOW_BITS = 11
+LOOKAHEAD_BITS = 4
+# Số vị trí trước đó được thử cho mỗi khóa 3 byte
+MAX_CHAIN = 64
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.value = 0
+        self.count = 0
+
+    def write(self, value, bits):
+        self.value = (self.value << bits) | value
+        self.count += bits
+        while self.count >= 8:
+            self.count -= 8
+            self.out.append((self.value >> self.count) & 0xFF)
+        self.value &= (1 << self.count) - 1
+
+    def finish(self):
+        if self.count:
+            self.out.append((self.value << (8 - self.count)) & 0xFF)
+        return bytes(self.out)
+
+
+def compress(data, window_bits=WINDOW_BITS, lookahead_bits=LOOKAHEAD_BITS):
+    window = 1 << window_bits
+    max_length = 1 << lookahead_bits
+    # Sao chép chỉ có lợi khi rẻ hơn số literal tương ứng (9 bit mỗi literal)
+    min_length = (1 + window_bits + lookahead_bits) // 9 + 1
+
+    writer = BitWriter()
+    chains = {}
+    pos = 0
+    while pos < len(data):
+        best_length = best_distance = 0
+        key = data[pos:pos + 3]
+        candidates = chains.get(key, ()) if len(key) == 3 else ()
+        limit = min(max_length, len(data) - pos)
+        for candidate in reversed(candidates[-MAX_CHAIN:]):
+            distance = pos - candidate
+            if distance > window:
+                break
+            length = 3
+            while length < limit and data[candidate + length] == data[pos + length]:
+                length += 1
+            if length > best_length:
+                best_length, best_distance = length, distance
+                if length == limit:
+                    break
+
+        step = best_length if best_length >= min_length else 1
+        if step > 1:
+            writer.write(0, 1)
+            writer.write(best_distance - 1, window_bits)
+            writer.write(best_length - 1, lookahead_bits)
+        else:
+            writer.write(0x100 | data[pos], 9)
+        for i in range(pos, pos + step):
+            chain = chains.setdefault(data[i:i + 3], [])
+            chain.append(i)
+            if len(chain) > 4 * MAX_CHAIN:
+                del chain[:-MAX_CHAIN]
+        pos += step
+
+    return HEADER.pack(MAGIC, window_bits, lookahead_bits, 0, len(data)) + writer.finish()
+
+
+def decompress(packed):
+    magic, window_bits, lookahead_bits, _, size = HEADER.unpack_from(packed)
+    if magic != MAGIC:
+        raise ValueError("not a compressed image")
+    bits = "".join(format(byte, "08b") for byte in packed[HEADER.size:])
+    out = bytearray()
+    pos = 0
+    while len(out) < size:
+        if bits[pos] == "1":
+            out.append(int(bits[pos + 1:pos + 9], 2))
+            pos += 9
+        else:
+            distance = int(bits[pos + 1:pos + 1 + window_bits], 2) + 1
+            pos += 1 + window_bits
+            length = int(bits[pos:pos + lookahead_bits], 2) + 1
+            pos += lookahead_bits
+            for _ in range(length):
+                out.append(out[-distance] if distance <= len(out) else 0)
+    if len(out) != size or len(bits) - pos >= 8:
+        raise ValueError("corrupted compressed image")
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("command", choices=("compress", "decompress"))
+    parser.add_argument("input")
+    parser.add_argument("output")
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as f:
+        data = f.read()
+    if args.command == "compress":
+        result = compress(data)
+        # Luôn kiểm tra lại trước khi ghi ra file
+        if decompress(result) != data:
+            sys.exit("internal error: compressed image does not round-trip")
+        print("image: %d bytes, compressed: %d bytes (%.1f%%)" % (len(data), len(result), 100.0 * len(result) / max(len(data), 1)))
+    else:
+        try:
+            result = decompress(data)
+        except ValueError as error:
+            sys.exit(str(error))
+        print("wrote %d bytes" % len(result))
+    with open(args.output, "wb") as f:
+        f.write(result)
+
+
+if __name__ == "__main__":
+    main()
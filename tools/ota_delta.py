@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+"""Tạo và kiểm tra delta patch cho OTA (định dạng "TBD1", xem lib/OTA/DeltaPatch.h).
+
+    python tools/ota_delta.py diff  old.bin new.bin patch.bin
+    python tools/ota_delta.py apply old.bin patch.bin out.bin
+
+Patch được upload lên ThingsBoard như một firmware bình thường (checksum tính trên
+file patch). Thiết bị nhận diện patch qua magic và chỉ áp dụng được lên đúng image
+đang chạy (old.bin), nếu không sẽ báo lỗi OTA.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+MAGIC = b"TBD1"
+HEADER = struct.Struct("<4sIII")
+
+# Độ dài tối thiểu của một đoạn khớp chính xác để bắt đầu record mới
+MIN_MATCH = 16
+# Số byte liên tiếp không khớp trước khi dừng kéo dài một đoạn
+MAX_MISMATCH_RUN = 64
+# Số vị trí source tối đa được thử cho mỗi khóa
+MAX_CANDIDATES = 8
+# Khóa index: 8 byte, index mỗi 4 vị trí source
+KEY_LEN = 8
+KEY_STEP = 4
+
+
+def write_varint(out, value):
+    while True:
+        byte = value & 0x7F
+        value >>= 7
+        if value:
+            out.append(byte | 0x80)
+        else:
+            out.append(byte)
+            return
+
+
+def read_varint(data, pos):
+    value = shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return value, pos
+
+
+def zigzag(value):
+    return (value << 1) ^ (value >> 63)
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def build_index(source):
+    index = {}
+    for pos in range(0, len(source) - KEY_LEN + 1, KEY_STEP):
+        positions = index.setdefault(source[pos:pos + KEY_LEN], [])
+        if len(positions) < MAX_CANDIDATES:
+            positions.append(pos)
+    return index
+
+
+def exact_length(source, spos, target, tpos):
+    length = 0
+    limit = min(len(source) - spos, len(target) - tpos)
+    # So sánh theo khối trước, sau đó từng byte
+    while length + 64 <= limit and source[spos + length:spos + length + 64] == target[tpos + length:tpos + length + 64]:
+        length += 64
+    while length < limit and source[spos + length] == target[tpos + length]:
+        length += 1
+    return length
+
+
+def extend(source, spos, target, tpos, length):
+    """Kéo dài đoạn khớp theo kiểu bsdiff: chấp nhận byte khác nhau (ví dụ địa chỉ
+    bị dịch) miễn là số byte giống nhau vẫn chiếm đa số."""
+    best = length
+    score = best_score = 0
+    limit = min(len(source) - spos, len(target) - tpos)
+    i = length
+    while i < limit and i - best <= MAX_MISMATCH_RUN:
+        score += 1 if source[spos + i] == target[tpos + i] else -1
+        i += 1
+        if score > best_score:
+            best_score = score
+            best = i
+    return best
+
+
+def find_match(index, source, target, tpos):
+    best_pos, best_len = -1, 0
+    # Đoạn khớp bắt đầu ở vị trí source chưa được index: lùi lại tối đa KEY_STEP - 1 byte
+    for back in range(KEY_STEP):
+        if tpos + back + KEY_LEN > len(target):
+            break
+        for spos in index.get(target[tpos + back:tpos + back + KEY_LEN], ()):
+            if spos < back:
+                continue
+            length = exact_length(source, spos - back, target, tpos)
+            if length > best_len:
+                best_pos, best_len = spos - back, length
+        if best_len >= MIN_MATCH:
+            break
+    return best_pos, best_len
+
+
+def find_segments(source, target):
+    """Trả về danh sách (tpos, spos, length): vùng target được tạo từ source + diff,
+    phần còn lại của target được ghi nguyên vẹn (extra)."""
+    index = build_index(source)
+    segments = []
+    tpos = 0
+    while tpos < len(target):
+        spos, length = find_match(index, source, target, tpos)
+        if length < MIN_MATCH:
+            tpos += 1
+            continue
+        length = extend(source, spos, target, tpos, length)
+        segments.append((tpos, spos, length))
+        tpos += length
+    return segments
+
+
+def encode_diff(out, source, spos, target, tpos, length):
+    diff = bytes((target[tpos + i] - source[spos + i]) & 0xFF for i in range(length))
+    i = 0
+    while True:
+        start = i
+        while i < length and diff[i] == 0:
+            i += 1
+        write_varint(out, i - start)
+        if i == length:
+            return
+        # Literal kết thúc ở dãy >= 3 byte 0 (dãy ngắn hơn rẻ hơn khi nằm trong literal)
+        start = i
+        while i < length and diff[i:i + 3] != b"\0\0\0":
+            i += 1
+        i = min(i, length)
+        write_varint(out, i - start)
+        out += diff[start:i]
+        if i == length:
+            return
+
+
+def make_patch(source, target):
+    out = bytearray(HEADER.pack(MAGIC, len(source), zlib.crc32(source) & 0xFFFFFFFF, len(target)))
+    segments = find_segments(source, target)
+
+    # Record: diff của đoạn khớp, extra đến đoạn khớp kế tiếp, seek tới vị trí source của đoạn đó
+    records = []
+    if not segments or segments[0][0] > 0:
+        records.append((0, 0, 0))
+    records += segments
+    for i, (tpos, spos, length) in enumerate(records):
+        next_tpos, next_spos = (records[i + 1][0], records[i + 1][1]) if i + 1 < len(records) else (len(target), spos + length)
+        extra_start = tpos + length
+        write_varint(out, length)
+        write_varint(out, next_tpos - extra_start)
+        write_varint(out, zigzag(next_spos - (spos + length)))
+        if length:
+            encode_diff(out, source, spos, target, tpos, length)
+        out += target[extra_start:next_tpos]
+    return bytes(out)
+
+
+def apply_patch(source, patch):
+    magic, source_size, source_crc, target_size = HEADER.unpack_from(patch)
+    if magic != MAGIC:
+        raise ValueError("not a delta patch")
+    if source_size != len(source) or source_crc != zlib.crc32(source) & 0xFFFFFFFF:
+        raise ValueError("patch was made for a different source image")
+
+    target = bytearray()
+    pos, spos = HEADER.size, 0
+    while len(target) < target_size:
+        diff_len, pos = read_varint(patch, pos)
+        extra_len, pos = read_varint(patch, pos)
+        seek, pos = read_varint(patch, pos)
+        end = len(target) + diff_len
+        while len(target) < end:
+            run, pos = read_varint(patch, pos)
+            target += source[spos:spos + run]
+            spos += run
+            if len(target) == end:
+                break
+            literal, pos = read_varint(patch, pos)
+            for value in patch[pos:pos + literal]:
+                target.append((source[spos] + value) & 0xFF)
+                spos += 1
+            pos += literal
+        target += patch[pos:pos + extra_len]
+        pos += extra_len
+        spos += unzigzag(seek)
+    if len(target) != target_size or pos != len(patch):
+        raise ValueError("corrupted patch")
+    return bytes(target)
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        return f.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+    diff = commands.add_parser("diff", help="create a patch from old.bin to new.bin")
+    diff.add_argument("old")
+    diff.add_argument("new")
+    diff.add_argument("patch")
+    apply = commands.add_parser("apply", help="apply a patch to old.bin")
+    apply.add_argument("old")
+    apply.add_argument("patch")
+    apply.add_argument("out")
+    args = parser.parse_args()
+
+    if args.command == "diff":
+        source, target = read_file(args.old), read_file(args.new)
+        patch = make_patch(source, target)
+        # Luôn kiểm tra lại patch trước khi ghi ra file
+        if apply_patch(source, patch) != target:
+            sys.exit("internal error: patch does not reproduce the new image")
+        with open(args.patch, "wb") as f:
+            f.write(patch)
+        print("full image: %d bytes, patch: %d bytes (%.1f%%)" % (len(target), len(patch), 100.0 * len(patch) / max(len(target), 1)))
+    else:
+        try:
+            target = apply_patch(read_file(args.old), read_file(args.patch))
+        except ValueError as error:
+            sys.exit(str(error))
+        with open(args.out, "wb") as f:
+            f.write(target)
+        print("wrote %d bytes" % len(target))
+
+
+if __name__ == "__main__":
+    main()